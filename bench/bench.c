@@ -0,0 +1,391 @@
+/**
+ *
+ * @file
+ *
+ *  COREBLAS is a software package provided by:
+ *  University of Tennessee, US,
+ *  University of Manchester, UK.
+ *
+ *  coreblas_bench times the tile kernels over a sweep of tile sizes nb and
+ *  inner-blocking sizes ib and reports Gflop/s in table, CSV or JSON form.
+ *  The result of the last timed call of every kernel is checked against a
+ *  BLAS or LAPACK reference; kernels whose scaled residual exceeds
+ *  BENCH_RESID_TOL are reported as failed.
+ *
+ *  Usage:
+ *      coreblas_bench [--nb=64,128,256] [--ib=32] [--iter=10]
+ *                     [--prec=s,d,c,z,ds,zc] [--routine=zgemm,dgeqrt,...]
+ *                     [--format=table|csv|json] [--output=file]
+ *                     [--check-alloc]
+ *
+ *  With --check-alloc, heap allocations made during the timed calls are
+ *  counted through a malloc interposer (glibc only), and kernels that
+ *  allocate are reported as failed.
+ *
+ **/
+#define _POSIX_C_SOURCE 199309L
+
+#include "bench.h"
+
+#include <errno.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+#define BENCH_MAX_LIST 64
+
+/******************************************************************************/
+// Counting allocator. The executable's definitions take precedence over
+// the C library's for all shared objects, including coreblas and BLAS.
+#if defined(__GLIBC__)
+#define BENCH_HAVE_ALLOC_COUNT
+
+extern void *__libc_malloc(size_t size);
+extern void *__libc_calloc(size_t nmemb, size_t size);
+extern void *__libc_realloc(void *ptr, size_t size);
+extern void *__libc_memalign(size_t alignment, size_t size);
+
+static int bench_alloc_enabled = 0;
+static long bench_alloc_count = 0;
+
+static inline void bench_alloc_hit(void)
+{
+    if (__atomic_load_n(&bench_alloc_enabled, __ATOMIC_RELAXED))
+        __atomic_add_fetch(&bench_alloc_count, 1, __ATOMIC_RELAXED);
+}
+
+void *malloc(size_t size)
+{
+    bench_alloc_hit();
+    return __libc_malloc(size);
+}
+
+void *calloc(size_t nmemb, size_t size)
+{
+    bench_alloc_hit();
+    return __libc_calloc(nmemb, size);
+}
+
+void *realloc(void *ptr, size_t size)
+{
+    bench_alloc_hit();
+    return __libc_realloc(ptr, size);
+}
+
+int posix_memalign(void **ptr, size_t alignment, size_t size)
+{
+    bench_alloc_hit();
+    void *p = __libc_memalign(alignment, size);
+    if (p == NULL)
+        return ENOMEM;
+    *ptr = p;
+    return 0;
+}
+#endif
+
+/******************************************************************************/
+// Starts counting allocations.
+static void bench_alloc_start(void)
+{
+#ifdef BENCH_HAVE_ALLOC_COUNT
+    __atomic_store_n(&bench_alloc_count, 0, __ATOMIC_RELAXED);
+    __atomic_store_n(&bench_alloc_enabled, 1, __ATOMIC_RELAXED);
+#endif
+}
+
+/******************************************************************************/
+// Stops counting and returns the number of allocations since the start,
+// or -1 if allocations cannot be counted on this platform.
+static long bench_alloc_stop(void)
+{
+#ifdef BENCH_HAVE_ALLOC_COUNT
+    __atomic_store_n(&bench_alloc_enabled, 0, __ATOMIC_RELAXED);
+    return __atomic_load_n(&bench_alloc_count, __ATOMIC_RELAXED);
+#else
+    return -1;
+#endif
+}
+
+typedef enum {
+    BenchTable,
+    BenchCsv,
+    BenchJson
+} bench_format_t;
+
+/******************************************************************************/
+static const struct {
+    const char *name;
+    const bench_precision_t *prec;
+} bench_precisions[] = {
+    { "s",  &bench_s  },
+    { "d",  &bench_d  },
+    { "c",  &bench_c  },
+    { "z",  &bench_z  },
+    { "ds", &bench_ds },
+    { "zc", &bench_zc },
+};
+
+/******************************************************************************/
+static const char *bench_blas_vendor(void)
+{
+#if defined(COREBLAS_WITH_MKL)
+    return "mkl";
+#elif defined(COREBLAS_WITH_OPENBLAS)
+    return "openblas";
+#elif defined(COREBLAS_WITH_ESSL)
+    return "essl";
+#elif defined(COREBLAS_WITH_ACCELERATE)
+    return "accelerate";
+#elif defined(COREBLAS_WITH_NETLIB)
+    return "netlib";
+#else
+    return "generic";
+#endif
+}
+
+/******************************************************************************/
+double bench_wtime(void)
+{
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (double)ts.tv_sec + 1e-9*(double)ts.tv_nsec;
+}
+
+/******************************************************************************/
+// Parses a comma separated list of positive integers.
+static int bench_parse_ints(const char *str, int *list)
+{
+    int n = 0;
+    while (*str != '\0' && n < BENCH_MAX_LIST) {
+        char *end;
+        long val = strtol(str, &end, 10);
+        if (end == str || val <= 0)
+            return -1;
+        list[n++] = (int)val;
+        str = (*end == ',') ? end+1 : end;
+    }
+    return n;
+}
+
+/******************************************************************************/
+// Returns nonzero if name is on the comma separated list, or list is empty.
+static int bench_in_list(const char *list, const char *name)
+{
+    if (list == NULL)
+        return 1;
+
+    size_t len = strlen(name);
+    for (const char *p = list; *p != '\0'; ) {
+        const char *end = strchr(p, ',');
+        size_t plen = end == NULL ? strlen(p) : (size_t)(end-p);
+        if (plen == len && strncmp(p, name, len) == 0)
+            return 1;
+        if (end == NULL)
+            break;
+        p = end+1;
+    }
+    return 0;
+}
+
+/******************************************************************************/
+static void bench_usage(const char *prog)
+{
+    printf("Usage: %s [options]\n"
+           "  --nb=list      tile sizes (default 64,128,256,512)\n"
+           "  --ib=list      inner-blocking sizes (default 32)\n"
+           "  --iter=n       timed calls per configuration (default 10)\n"
+           "  --prec=list    precisions among s,d,c,z,ds,zc (default all)\n"
+           "  --routine=list routine names, e.g., zgemm,dgeqrt (default all)\n"
+           "  --format=fmt   table, csv or json (default table)\n"
+           "  --output=file  write results to file (default stdout)\n"
+           "  --check-alloc  fail kernels that allocate heap memory\n",
+           prog);
+}
+
+/******************************************************************************/
+int main(int argc, char **argv)
+{
+    int nbs[BENCH_MAX_LIST] = { 64, 128, 256, 512 };
+    int ibs[BENCH_MAX_LIST] = { 32 };
+    int nnb = 4;
+    int nib = 1;
+    int niter = 10;
+    const char *precs = NULL;
+    const char *routines = NULL;
+    const char *output = NULL;
+    bench_format_t format = BenchTable;
+    int check_alloc = 0;
+
+    for (int i = 1; i < argc; i++) {
+        const char *arg = argv[i];
+        if (strncmp(arg, "--nb=", 5) == 0) {
+            nnb = bench_parse_ints(arg+5, nbs);
+        }
+        else if (strncmp(arg, "--ib=", 5) == 0) {
+            nib = bench_parse_ints(arg+5, ibs);
+        }
+        else if (strncmp(arg, "--iter=", 7) == 0) {
+            niter = atoi(arg+7);
+        }
+        else if (strncmp(arg, "--prec=", 7) == 0) {
+            precs = arg+7;
+        }
+        else if (strncmp(arg, "--routine=", 10) == 0) {
+            routines = arg+10;
+        }
+        else if (strncmp(arg, "--output=", 9) == 0) {
+            output = arg+9;
+        }
+        else if (strcmp(arg, "--format=table") == 0) {
+            format = BenchTable;
+        }
+        else if (strcmp(arg, "--format=csv") == 0) {
+            format = BenchCsv;
+        }
+        else if (strcmp(arg, "--format=json") == 0) {
+            format = BenchJson;
+        }
+        else if (strcmp(arg, "--check-alloc") == 0) {
+            check_alloc = 1;
+        }
+        else {
+            bench_usage(argv[0]);
+            return strcmp(arg, "--help") == 0 ? EXIT_SUCCESS : EXIT_FAILURE;
+        }
+    }
+    if (nnb <= 0 || nib <= 0 || niter <= 0) {
+        bench_usage(argv[0]);
+        return EXIT_FAILURE;
+    }
+#ifndef BENCH_HAVE_ALLOC_COUNT
+    if (check_alloc) {
+        fprintf(stderr, "--check-alloc is not supported on this platform\n");
+        return EXIT_FAILURE;
+    }
+#endif
+
+    FILE *out = stdout;
+    if (output != NULL) {
+        out = fopen(output, "w");
+        if (out == NULL) {
+            fprintf(stderr, "cannot open %s\n", output);
+            return EXIT_FAILURE;
+        }
+    }
+
+    const char *blas = bench_blas_vendor();
+    switch (format) {
+        case BenchTable:
+            fprintf(out, "# BLAS: %s\n", blas);
+            fprintf(out, "%-28s %6s %6s %14s %14s %10s %10s\n",
+                    "routine", "nb", "ib", "time [s]", "avg [s]", "Gflop/s",
+                    "resid");
+            break;
+        case BenchCsv:
+            fprintf(out, "blas,routine,nb,ib,iter,time,time_avg,gflops,info,"
+                         "allocs,resid\n");
+            break;
+        case BenchJson:
+            fprintf(out, "[\n");
+            break;
+    }
+
+    int first = 1;
+    int failed = 0;
+    int nprec = sizeof(bench_precisions)/sizeof(bench_precisions[0]);
+    for (int p = 0; p < nprec; p++) {
+        if (!bench_in_list(precs, bench_precisions[p].name))
+            continue;
+
+        const bench_precision_t *prec = bench_precisions[p].prec;
+        for (int inb = 0; inb < nnb; inb++) {
+            for (int iib = 0; iib < nib; iib++) {
+                int nb = nbs[inb];
+                int ib = ibs[iib] < nb ? ibs[iib] : nb;
+                void *data = prec->create(nb, ib);
+                if (data == NULL) {
+                    fprintf(stderr, "allocation failed for nb %d\n", nb);
+                    return EXIT_FAILURE;
+                }
+
+                for (const bench_routine_t *r = prec->routines;
+                     r->name != NULL; r++) {
+                    if (!bench_in_list(routines, r->name))
+                        continue;
+
+                    // One untimed call to warm up caches and BLAS.
+                    prec->reset(data);
+                    int info = r->call(data);
+
+                    double best = 0.0;
+                    double total = 0.0;
+                    long allocs = 0;
+                    for (int iter = 0; iter < niter; iter++) {
+                        prec->reset(data);
+                        if (check_alloc)
+                            bench_alloc_start();
+                        double start = bench_wtime();
+                        info = r->call(data);
+                        double time = bench_wtime() - start;
+                        if (check_alloc)
+                            allocs += bench_alloc_stop();
+                        total += time;
+                        if (iter == 0 || time < best)
+                            best = time;
+                    }
+                    if (!check_alloc)
+                        allocs = -1;
+                    double avg = total/niter;
+                    double gflops = best > 0.0 ?
+                        r->flops(nb, ib)/best/1e9 : 0.0;
+
+                    // The data holds the result of the last call.
+                    bench_resid_t resid = r->check(data);
+                    int wrong = info != 0 || !(resid <= BENCH_RESID_TOL);
+                    if (wrong || allocs > 0)
+                        failed++;
+
+                    switch (format) {
+                        case BenchTable:
+                            fprintf(out,
+                                    "%-28s %6d %6d %14.6e %14.6e %10.3f "
+                                    "%10.2e%s%s\n",
+                                    r->name, nb, ib, best, avg, gflops, resid,
+                                    wrong ? "  FAILED" : "",
+                                    allocs > 0 ? "  ALLOCATES" : "");
+                            break;
+                        case BenchCsv:
+                            fprintf(out,
+                                    "%s,%s,%d,%d,%d,%.6e,%.6e,%.4f,%d,%ld,"
+                                    "%.4e\n",
+                                    blas, r->name, nb, ib, niter,
+                                    best, avg, gflops, info, allocs, resid);
+                            break;
+                        case BenchJson:
+                            fprintf(out,
+                                    "%s  {\"blas\": \"%s\", \"routine\": \"%s\", "
+                                    "\"nb\": %d, \"ib\": %d, \"iter\": %d, "
+                                    "\"time\": %.6e, \"time_avg\": %.6e, "
+                                    "\"gflops\": %.4f, \"info\": %d, "
+                                    "\"allocs\": %ld, \"resid\": %.4e}",
+                                    first ? "" : ",\n",
+                                    blas, r->name, nb, ib, niter,
+                                    best, avg, gflops, info, allocs, resid);
+                            break;
+                    }
+                    first = 0;
+                    fflush(out);
+                }
+                prec->destroy(data);
+            }
+        }
+    }
+
+    if (format == BenchJson)
+        fprintf(out, "\n]\n");
+    if (out != stdout)
+        fclose(out);
+
+    return failed == 0 ? EXIT_SUCCESS : EXIT_FAILURE;
+}
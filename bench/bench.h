@@ -0,0 +1,72 @@
+/**
+ *
+ * @file
+ *
+ *  COREBLAS is a software package provided by:
+ *  University of Tennessee, US,
+ *  University of Manchester, UK.
+ *
+ **/
+#ifndef COREBLAS_BENCH_H
+#define COREBLAS_BENCH_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/***************************************************************************//**
+ *  Operation counts; kept in double precision by all precision variants.
+ **/
+typedef double bench_flops_t;
+
+/***************************************************************************//**
+ *  Scaled residuals of the checks; kept in double precision as well.
+ **/
+typedef double bench_resid_t;
+
+/***************************************************************************//**
+ *  A single benchmarked kernel. The call is the timed region; everything
+ *  the kernel needs is prepared in the precision specific data passed to it.
+ *  The check compares the result of the last call, made on freshly reset
+ *  data, with a reference and returns the error relative to the reference
+ *  divided by nb times the machine epsilon.
+ **/
+typedef struct {
+    const char *name;                 ///< routine name, e.g., "zgemm"
+    int (*call)(void *data);          ///< one kernel invocation
+    bench_flops_t (*flops)(int nb, int ib);  ///< operations per call
+    bench_resid_t (*check)(void *data);  ///< scaled residual of the last call
+} bench_routine_t;
+
+/***************************************************************************//**
+ *  Largest scaled residual of a passing check.
+ **/
+#define BENCH_RESID_TOL 100.0
+
+/***************************************************************************//**
+ *  Set of benchmarked kernels of one precision.
+ *  create() allocates and initializes nb-by-nb tiles, reset() restores
+ *  the tiles overwritten by a call, destroy() releases the data.
+ **/
+typedef struct {
+    const bench_routine_t *routines;  ///< terminated by a NULL name
+    void *(*create)(int nb, int ib);
+    void (*reset)(void *data);
+    void (*destroy)(void *data);
+} bench_precision_t;
+
+extern const bench_precision_t bench_s;
+extern const bench_precision_t bench_d;
+extern const bench_precision_t bench_c;
+extern const bench_precision_t bench_z;
+extern const bench_precision_t bench_ds;
+extern const bench_precision_t bench_zc;
+
+/******************************************************************************/
+double bench_wtime(void);
+
+#ifdef __cplusplus
+}  // extern "C"
+#endif
+
+#endif // COREBLAS_BENCH_H
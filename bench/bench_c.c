@@ -0,0 +1,2611 @@
+/**
+ *
+ * @file
+ *
+ *  COREBLAS is a software package provided by:
+ *  University of Tennessee, US,
+ *  University of Manchester, UK.
+ *
+ * @generated from bench/bench_z.c, normal z -> c, Fri Oct 16 03:37:07 2026
+ *
+ **/
+
+#include "bench.h"
+#include "flops.h"
+
+#include <coreblas.h>
+#include "core_lapack.h"
+#include "bulge.h"
+
+#include <math.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#define COMPLEX
+
+/***************************************************************************//**
+ *  Tiles shared by all kernels of one precision. All tiles are nb-by-nb with
+ *  leading dimension nb; X0 are pristine copies the working tiles are reset
+ *  from before every timed call.
+ **/
+typedef struct {
+    int nb;
+    int ib;
+
+    coreblas_complex32_t *A;   ///< Hermitian positive definite
+    coreblas_complex32_t *B;
+    coreblas_complex32_t *C;
+    coreblas_complex32_t *A0;
+    coreblas_complex32_t *B0;
+    coreblas_complex32_t *C0;
+    coreblas_complex32_t *L;   ///< Cholesky factor of A0
+
+    // Reflectors and T factors produced once by the factorization kernels
+    // and consumed by the update kernels.
+    coreblas_complex32_t *Vqr,  *Tqr;
+    coreblas_complex32_t *Vqrx;   ///< Vqr with its unit triangle explicit
+    coreblas_complex32_t *Vlqx;   ///< Vlq with its unit triangle explicit
+    coreblas_complex32_t *Vcbx, *Vrbx;   ///< explicit backward V of larfb_gemm
+    coreblas_complex32_t *Vlq,  *Tlq;
+    coreblas_complex32_t *Vts,  *Tts;
+    coreblas_complex32_t *Vtt,  *Ttt;
+    coreblas_complex32_t *Vtsl, *Ttsl;
+    coreblas_complex32_t *Vttl, *Tttl;
+    coreblas_complex32_t *Vtsb, *Ttsb;
+    coreblas_complex32_t *Vtsr, *Ttsr;
+
+    coreblas_complex32_t *T;
+    coreblas_complex32_t *tau;
+    coreblas_complex32_t *tauqr;   ///< scalar factors of Vqr
+    int *ipiv;   ///< pivots of the LU factorization of B0
+    coreblas_complex32_t *wcalu;
+    int *iwcalu;
+    int *iwork;
+    coreblas_complex32_t *work;
+    float *dwork;
+    float value[2];
+
+    // Batch of independent tiles for the batched kernels.
+    int batch;
+    coreblas_complex32_t *Ab, *Cb, *Db, *Tb;
+    coreblas_complex32_t **Abp, **Cbp, **Dbp, **Tbp;
+    const coreblas_complex32_t **Vp, **Tp;
+    coreblas_workspace_t wbatch;
+
+    // Lower band of order nb and width bw for the bulge chasing kernels, in
+    // the (3*bw+1)-by-nb storage of the gbtype kernels, with the reflectors
+    // VQ, TAUQ, VP, TAUP of length 2*nb each in vband. Copy i < 3 is worked
+    // on by task i+1 of the first sweep and reset from band0[i], vband0[i]:
+    // the band, the band after task 1, and after task 2. Copy 3 is worked on
+    // by gbbrd_static and reset from the band.
+    int bw;
+    int ldband;
+    coreblas_complex32_t *band[4], *vband[4];
+    coreblas_complex32_t *band0[3], *vband0[3];
+    int *iwband;
+    float band_fro;   ///< Frobenius norm of the band
+    float band_fro2;  ///< Frobenius norm of its Gram matrix
+} bench_cdata_t;
+
+/******************************************************************************/
+// Number of tiles of the batched kernels, about 256K elements per batch.
+static int bench_cbatch(int nb)
+{
+    int batch = (1 << 18)/(nb*nb);
+    return batch > 1 ? batch : 1;
+}
+
+/******************************************************************************/
+static bench_flops_t bench_cflops(bench_flops_t fmuls, bench_flops_t fadds)
+{
+#ifdef COMPLEX
+    return 6.0*fmuls + 2.0*fadds;
+#else
+    return fmuls + fadds;
+#endif
+}
+
+/******************************************************************************/
+static float bench_crand(unsigned long long *seed)
+{
+    // 64-bit linear congruential generator, uniform in [-0.5, 0.5)
+    *seed = *seed*6364136223846793005ULL + 1442695040888963407ULL;
+    return (float)(*seed >> 11)/9007199254740992.0 - 0.5;
+}
+
+/******************************************************************************/
+static void bench_cfill(int m, int n, coreblas_complex32_t *A, int lda,
+                        unsigned long long *seed)
+{
+    for (int j = 0; j < n; j++) {
+        for (int i = 0; i < m; i++) {
+#ifdef COMPLEX
+            float re = bench_crand(seed);
+            float im = bench_crand(seed);
+            A[i + lda*j] = re + im*_Complex_I;
+#else
+            A[i + lda*j] = bench_crand(seed);
+#endif
+        }
+    }
+}
+
+/******************************************************************************/
+// LU factorization of one nb-by-nb tile by a single panel thread.
+static int bench_cgetrf_tile(coreblas_complex32_t *A, int nb, int ib,
+                             int *ipiv)
+{
+    coreblas_desc_t desc;
+    coreblas_desc_general_init(CoreBlasComplexFloat, A, nb, nb,
+                               nb, nb, 0, 0, nb, nb, &desc);
+
+    volatile int max_idx;
+    volatile coreblas_complex32_t max_val;
+    volatile int info = 0;
+    coreblas_barrier_t barrier;
+    coreblas_barrier_init(&barrier);
+
+    coreblas_cgetrf(desc, ipiv, ib, 0, 1,
+                    &max_idx, &max_val, &info, &barrier);
+    return info;
+}
+
+/*******************************************************************************
+ *  References for the checks, computed with unblocked loops or with the
+ *  BLAS and LAPACK routines the kernels are meant to match.
+ **/
+static coreblas_complex32_t *bench_cmalloc(size_t size)
+{
+    coreblas_complex32_t *A = (coreblas_complex32_t*)malloc(
+        (size > 0 ? size : 1)*sizeof(coreblas_complex32_t));
+    if (A == NULL) {
+        fprintf(stderr, "allocation failed in the check\n");
+        exit(EXIT_FAILURE);
+    }
+    return A;
+}
+
+/******************************************************************************/
+// Error relative to the reference, in units of nb times the machine epsilon.
+static float bench_cscaled(float err, float nrm, int nb)
+{
+    float eps = LAPACKE_slamch_work('e');
+    return err/(nrm > 0.0 ? nrm : 1.0)/(nb*eps);
+}
+
+/******************************************************************************/
+// Scaled Frobenius norm error of the uplo part of the m-by-n matrix X
+// against the reference R.
+static float bench_cresid(coreblas_enum_t uplo, int m, int n,
+                           const coreblas_complex32_t *X, int ldx,
+                           const coreblas_complex32_t *R, int ldr)
+{
+    float err = 0.0;
+    float nrm = 0.0;
+    for (int j = 0; j < n; j++) {
+        int ifirst = uplo == CoreBlasLower ? j : 0;
+        int ilast  = uplo == CoreBlasUpper && j+1 < m ? j+1 : m;
+        for (int i = ifirst; i < ilast; i++) {
+            float e = cabsf(X[i + (size_t)ldx*j] - R[i + (size_t)ldr*j]);
+            float r = cabsf(R[i + (size_t)ldr*j]);
+            err += e*e;
+            nrm += r*r;
+        }
+    }
+    return bench_cscaled(sqrtf(err), sqrtf(nrm), m > n ? m : n);
+}
+
+/******************************************************************************/
+// B = the uplo triangle of A, zero elsewhere.
+static void bench_ctri(coreblas_enum_t uplo, int n,
+                       const coreblas_complex32_t *A, int lda,
+                       coreblas_complex32_t *B, int ldb)
+{
+    for (int j = 0; j < n; j++) {
+        for (int i = 0; i < n; i++) {
+            int in = uplo == CoreBlasLower ? i >= j : i <= j;
+            B[i + (size_t)ldb*j] = in ? A[i + (size_t)lda*j] : 0.0;
+        }
+    }
+}
+
+/******************************************************************************/
+// B = the full matrix of which A holds the lower triangle, Hermitian if herm
+// and symmetric otherwise; the diagonal is copied as is.
+static void bench_cfull(int herm, int n,
+                        const coreblas_complex32_t *A, int lda,
+                        coreblas_complex32_t *B, int ldb)
+{
+    for (int j = 0; j < n; j++) {
+        B[j + (size_t)ldb*j] = A[j + (size_t)lda*j];
+        for (int i = j+1; i < n; i++) {
+            coreblas_complex32_t a = A[i + (size_t)lda*j];
+            B[i + (size_t)ldb*j] = a;
+            B[j + (size_t)ldb*i] = herm ? conjf(a) : a;
+        }
+    }
+}
+
+/******************************************************************************/
+// Applies the row interchanges of the 1-based pivots ipiv to the n rows of X.
+static void bench_cpivot(int n, const int *ipiv,
+                         coreblas_complex32_t *X, int ldx)
+{
+    for (int i = 0; i < n; i++) {
+        int p = ipiv[i]-1;
+        for (int j = 0; p != i && j < n; j++) {
+            coreblas_complex32_t x = X[i + (size_t)ldx*j];
+            X[i + (size_t)ldx*j] = X[p + (size_t)ldx*j];
+            X[p + (size_t)ldx*j] = x;
+        }
+    }
+}
+
+/******************************************************************************/
+static void bench_clarfb(coreblas_enum_t side, coreblas_enum_t trans,
+                         coreblas_enum_t direct, coreblas_enum_t storev,
+                         int m, int n, int k,
+                         const coreblas_complex32_t *V, int ldv,
+                         const coreblas_complex32_t *T, int ldt,
+                               coreblas_complex32_t *C, int ldc)
+{
+    int ldwork = side == CoreBlasLeft ? n : m;
+    coreblas_complex32_t *work = bench_cmalloc((size_t)ldwork*k);
+#ifdef COREBLAS_USE_64BIT_BLAS
+    LAPACKE_clarfb_work64_(LAPACK_COL_MAJOR,
+                           lapack_const(side), lapack_const(trans),
+                           lapack_const(direct), lapack_const(storev),
+                           m, n, k, V, ldv, T, ldt, C, ldc, work, ldwork);
+#else
+    LAPACKE_clarfb_work(LAPACK_COL_MAJOR,
+                        lapack_const(side), lapack_const(trans),
+                        lapack_const(direct), lapack_const(storev),
+                        m, n, k, V, ldv, T, ldt, C, ldc, work, ldwork);
+#endif
+    free(work);
+}
+
+/******************************************************************************/
+// V = the k reflectors of order n in A, columnwise (n-by-k) or rowwise
+// (k-by-n), with the unit triangle of larfb_gemm stored explicitly: in the
+// first k positions for forward and in the last k for backward reflectors.
+static void bench_clarfb_v(coreblas_enum_t direct, coreblas_enum_t storev,
+                           int n, int k,
+                           const coreblas_complex32_t *A, int lda,
+                                 coreblas_complex32_t *V, int ldv)
+{
+    int col = storev == CoreBlasColumnwise;
+    int off = direct == CoreBlasForward ? 0 : n-k;
+    for (int q = 0; q < k; q++) {
+        for (int p = 0; p < n; p++) {
+            size_t ij = col ? p + (size_t)ldv*q : q + (size_t)ldv*p;
+            int r = p-off;
+            V[ij] = A[col ? p + (size_t)lda*q : q + (size_t)lda*p];
+            if (r == q)
+                V[ij] = 1.0;
+            else if (r >= 0 && r < k &&
+                     (direct == CoreBlasForward ? r < q : r > q))
+                V[ij] = 0.0;
+        }
+    }
+}
+
+/******************************************************************************/
+// Order of the blocks of reflectors applied by op(Q), as in LAPACK: with
+// rowwise storage, op is swapped, since LAPACK applies the reflectors of
+// an LQ factorization with the transposed block reflector.
+static int bench_cascending(coreblas_enum_t side, coreblas_enum_t transt,
+                            coreblas_enum_t direct)
+{
+    int left = side == CoreBlasLeft;
+    int notran = transt == CoreBlasNoTrans;
+    return direct == CoreBlasForward ? left != notran : left == notran;
+}
+
+static coreblas_enum_t bench_ctranst(coreblas_enum_t trans,
+                                     coreblas_enum_t storev)
+{
+    if (storev == CoreBlasColumnwise)
+        return trans;
+    return trans == CoreBlasNoTrans ? CoreBlas_ConjTrans : CoreBlasNoTrans;
+}
+
+/******************************************************************************/
+// C = op(Q) C or C op(Q), where Q is given by the k forward reflectors of a
+// geqrt (columnwise) or gelqt (rowwise) factorization with blocking ib.
+static void bench_cunm_ref(coreblas_enum_t side, coreblas_enum_t trans,
+                           coreblas_enum_t storev, int m, int n, int k,
+                           int ib,
+                           const coreblas_complex32_t *V, int ldv,
+                           const coreblas_complex32_t *T, int ldt,
+                                 coreblas_complex32_t *C, int ldc)
+{
+    int left = side == CoreBlasLeft;
+    coreblas_enum_t transt = bench_ctranst(trans, storev);
+    int ascend = bench_cascending(side, transt, CoreBlasForward);
+    int nblk = (k+ib-1)/ib;
+    for (int b = 0; b < nblk; b++) {
+        int i = (ascend ? b : nblk-1-b)*ib;
+        int kb = k-i < ib ? k-i : ib;
+        bench_clarfb(side, transt, CoreBlasForward, storev,
+                     left ? m-i : m, left ? n : n-i, kb,
+                     &V[i + (size_t)ldv*i], ldv, &T[(size_t)ldt*i], ldt,
+                     left ? &C[i] : &C[(size_t)ldc*i], ldc);
+    }
+}
+
+/******************************************************************************/
+// Element r of the stack of the kb rows (left) or columns (right) of A1
+// starting at i1 and the whole A2, in the order (A1; A2) for forward and
+// (A2; A1) for backward reflectors; c indexes the other dimension.
+static coreblas_complex32_t *bench_cstack(int left, int forward, int kb,
+                                          int p2, int i1, int r, int c,
+                                          coreblas_complex32_t *A1, int lda1,
+                                          coreblas_complex32_t *A2, int lda2)
+{
+    int r1 = forward ? r : r-p2;
+    int r2 = forward ? r-kb : r;
+    if (r1 >= 0 && r1 < kb) {
+        return left ? &A1[(i1+r1) + (size_t)lda1*c]
+                    : &A1[c + (size_t)lda1*(i1+r1)];
+    }
+    return left ? &A2[r2 + (size_t)lda2*c] : &A2[c + (size_t)lda2*r2];
+}
+
+/******************************************************************************/
+// Applies op(Q) from the side to the pair (A1, A2), where Q is given by the
+// k reflectors of a ts (tri = 0) or tt (tri = 1) factorization with
+// blocking ib, stored in V and T as the factorization kernels leave them.
+// Each block is applied by larfb on an explicit copy of the stacked rows
+// or columns, with the unit part of the reflectors made explicit.
+static void bench_cts_ref(coreblas_enum_t side, coreblas_enum_t trans,
+                          coreblas_enum_t direct, coreblas_enum_t storev,
+                          int tri,
+                          int m1, int n1, coreblas_complex32_t *A1, int lda1,
+                          int m2, int n2, coreblas_complex32_t *A2, int lda2,
+                          int k, int ib,
+                          const coreblas_complex32_t *V, int ldv,
+                          const coreblas_complex32_t *T, int ldt)
+{
+    int left = side == CoreBlasLeft;
+    int forward = direct == CoreBlasForward;
+    int colwise = storev == CoreBlasColumnwise;
+    coreblas_enum_t transt = bench_ctranst(trans, storev);
+    int ascend = bench_cascending(side, transt, direct);
+    int p2 = left ? m2 : n2;
+    int q  = left ? n1 : m1;
+    int off = forward ? 0 : (left ? m1 : n1) - k;
+
+    coreblas_complex32_t *S  = bench_cmalloc((size_t)(ib+p2)*q);
+    coreblas_complex32_t *Vb = bench_cmalloc((size_t)(ib+p2)*ib);
+    int nblk = (k+ib-1)/ib;
+    for (int b = 0; b < nblk; b++) {
+        int i = (ascend ? b : nblk-1-b)*ib;
+        int kb = k-i < ib ? k-i : ib;
+        int ls = kb + p2;
+        int lds = left ? ls : q;
+        int ldvb = colwise ? ls : kb;
+        for (int r = 0; r < ls; r++) {
+            for (int c = 0; c < q; c++) {
+                coreblas_complex32_t *a = bench_cstack(
+                    left, forward, kb, p2, off+i, r, c, A1, lda1, A2, lda2);
+                S[left ? r + (size_t)lds*c : c + (size_t)lds*r] = *a;
+            }
+            for (int c = 0; c < kb; c++) {
+                int r1 = forward ? r : r-p2;
+                int r2 = forward ? r-kb : r;
+                coreblas_complex32_t v;
+                if (r1 >= 0 && r1 < kb)
+                    v = r1 == c ? 1.0 : 0.0;
+                else if (tri && r2 > i+c)
+                    v = 0.0;
+                else
+                    v = colwise ? V[r2 + (size_t)ldv*(i+c)]
+                                : V[(i+c) + (size_t)ldv*r2];
+                Vb[colwise ? r + (size_t)ldvb*c : c + (size_t)ldvb*r] = v;
+            }
+        }
+        bench_clarfb(side, transt, direct, storev,
+                     left ? ls : q, left ? q : ls, kb,
+                     Vb, ldvb, &T[(size_t)ldt*i], ldt, S, lds);
+        for (int r = 0; r < ls; r++) {
+            for (int c = 0; c < q; c++) {
+                coreblas_complex32_t *a = bench_cstack(
+                    left, forward, kb, p2, off+i, r, c, A1, lda1, A2, lda2);
+                *a = S[left ? r + (size_t)lds*c : c + (size_t)lds*r];
+            }
+        }
+    }
+    free(S);
+    free(Vb);
+}
+
+/******************************************************************************/
+// Task t of the first sweep of the chase of the band of the data.
+static void bench_cgbtype(bench_cdata_t *d, int t,
+                          coreblas_complex32_t *band,
+                          coreblas_complex32_t *vband)
+{
+    int nb = d->nb;
+    int st, ed;
+    coreblas_bulge_task(nb, d->bw, 0, t, &st, &ed);
+    coreblas_complex32_t *VQ = vband;
+    coreblas_complex32_t *TAUQ = &vband[2*nb];
+    coreblas_complex32_t *VP = &vband[4*nb];
+    coreblas_complex32_t *TAUP = &vband[6*nb];
+    if (t == 1) {
+        coreblas_cgbtype1cb(CoreBlasLower, nb, d->bw, band, d->ldband,
+                            VQ, TAUQ, VP, TAUP, st, ed, 0, 1, 0, d->work);
+    }
+    else if (t%2 == 0) {
+        coreblas_cgbtype2cb(CoreBlasLower, nb, d->bw, band, d->ldband,
+                            VQ, TAUQ, VP, TAUP, st, ed, 0, 1, 0, d->work);
+    }
+    else {
+        coreblas_cgbtype3cb(CoreBlasLower, nb, d->bw, band, d->ldband,
+                            VQ, TAUQ, VP, TAUP, st, ed, 0, 1, 0, d->work);
+    }
+}
+
+/******************************************************************************/
+// Expands the band storage into the dense nb-by-nb D.
+static void bench_cband_dense(const bench_cdata_t *d,
+                              const coreblas_complex32_t *band,
+                              coreblas_complex32_t *D)
+{
+    int nb = d->nb;
+    int bw = d->bw;
+    for (int j = 0; j < nb; j++) {
+        for (int i = 0; i < nb; i++) {
+            int r = bw + i - j;
+            D[i + (size_t)nb*j] = r >= 0 && r < d->ldband
+                                ? band[r + (size_t)d->ldband*j] : 0.0;
+        }
+    }
+}
+
+/******************************************************************************/
+// Unitary invariants of the band: the Frobenius norms of D and of D^H D.
+static void bench_cband_norms(const bench_cdata_t *d,
+                              const coreblas_complex32_t *band,
+                              float *fro, float *fro2)
+{
+    int nb = d->nb;
+    coreblas_complex32_t *D = bench_cmalloc(2*(size_t)nb*nb);
+    coreblas_complex32_t *G = &D[(size_t)nb*nb];
+    bench_cband_dense(d, band, D);
+    coreblas_cgemm(CoreBlas_ConjTrans, CoreBlasNoTrans, nb, nb, nb,
+                   1.0, D, nb, D, nb, 0.0, G, nb);
+    float s = 0.0;
+    float s2 = 0.0;
+    for (size_t i = 0; i < (size_t)nb*nb; i++) {
+        s  += cabsf(D[i])*cabsf(D[i]);
+        s2 += cabsf(G[i])*cabsf(G[i]);
+    }
+    *fro = sqrtf(s);
+    *fro2 = sqrtf(s2);
+    free(D);
+}
+
+/******************************************************************************/
+static void *bench_ccreate(int nb, int ib)
+{
+    bench_cdata_t *d = (bench_cdata_t*)calloc(1, sizeof(bench_cdata_t));
+    if (d == NULL)
+        return NULL;
+
+    size_t tile = (size_t)nb*nb;
+    d->nb = nb;
+    d->ib = ib;
+
+    coreblas_complex32_t **tiles[] = {
+        &d->A, &d->B, &d->C, &d->A0, &d->B0, &d->C0, &d->L,
+        &d->Vqr, &d->Vlq, &d->Vts, &d->Vtt, &d->Vtsl, &d->Vttl,
+        &d->Vtsb, &d->Vtsr, &d->Vqrx, &d->Vlqx, &d->Vcbx, &d->Vrbx,
+    };
+    coreblas_complex32_t **tfactors[] = {
+        &d->Tqr, &d->Tlq, &d->Tts, &d->Ttt, &d->Ttsl, &d->Tttl, &d->T,
+        &d->Ttsb, &d->Ttsr,
+    };
+    int ok = 1;
+    for (size_t i = 0; i < sizeof(tiles)/sizeof(tiles[0]); i++) {
+        *tiles[i] = (coreblas_complex32_t*)malloc(
+            tile*sizeof(coreblas_complex32_t));
+        ok = ok && *tiles[i] != NULL;
+    }
+    for (size_t i = 0; i < sizeof(tfactors)/sizeof(tfactors[0]); i++) {
+        *tfactors[i] = (coreblas_complex32_t*)calloc(
+            (size_t)ib*nb, sizeof(coreblas_complex32_t));
+        ok = ok && *tfactors[i] != NULL;
+    }
+    d->tau   = (coreblas_complex32_t*)malloc(
+        (size_t)nb*sizeof(coreblas_complex32_t));
+    d->tauqr = (coreblas_complex32_t*)malloc(
+        (size_t)nb*sizeof(coreblas_complex32_t));
+    d->work  = (coreblas_complex32_t*)malloc(
+        4*tile*sizeof(coreblas_complex32_t));
+    d->dwork = (float*)malloc(2*(size_t)nb*sizeof(float));
+    d->ipiv  = (int*)malloc((size_t)nb*sizeof(int));
+
+    coreblas_desc_t panel;
+    coreblas_desc_general_init(CoreBlasComplexFloat, d->B, nb, nb,
+                               nb, nb, 0, 0, nb, nb, &panel);
+    d->wcalu  = (coreblas_complex32_t*)malloc(
+        coreblas_cgetrf_calu_lwork(panel, 1)*sizeof(coreblas_complex32_t));
+    d->iwcalu = (int*)malloc(coreblas_cgetrf_calu_liwork(panel, 1)*sizeof(int));
+    d->iwork  = (int*)malloc(
+        coreblas_cgeswp_blocked_liwork(1, nb)*sizeof(int));
+
+    int batch = bench_cbatch(nb);
+    d->batch = batch;
+    d->Ab  = (coreblas_complex32_t*)malloc(
+        batch*tile*sizeof(coreblas_complex32_t));
+    d->Cb  = (coreblas_complex32_t*)malloc(
+        batch*tile*sizeof(coreblas_complex32_t));
+    d->Db  = (coreblas_complex32_t*)malloc(
+        batch*tile*sizeof(coreblas_complex32_t));
+    d->Tb  = (coreblas_complex32_t*)calloc(
+        batch*(size_t)ib*nb, sizeof(coreblas_complex32_t));
+    d->Abp = (coreblas_complex32_t**)malloc(
+        batch*sizeof(coreblas_complex32_t*));
+    d->Cbp = (coreblas_complex32_t**)malloc(
+        batch*sizeof(coreblas_complex32_t*));
+    d->Dbp = (coreblas_complex32_t**)malloc(
+        batch*sizeof(coreblas_complex32_t*));
+    d->Tbp = (coreblas_complex32_t**)malloc(
+        batch*sizeof(coreblas_complex32_t*));
+    d->Vp  = (const coreblas_complex32_t**)malloc(
+        batch*sizeof(coreblas_complex32_t*));
+    d->Tp  = (const coreblas_complex32_t**)malloc(
+        batch*sizeof(coreblas_complex32_t*));
+    size_t lwbatch = coreblas_cgeqrt_batched_lwork(nb, nb, ib);
+    size_t lwtsmqr = coreblas_ctsmqr_lwork(CoreBlasLeft, nb, nb, ib);
+    int wbatch = coreblas_workspace_create(
+        &d->wbatch, lwbatch > lwtsmqr ? lwbatch : lwtsmqr,
+        CoreBlasComplexFloat);
+
+    // Task 3 of the first sweep exists from nb = bw+3 on.
+    int bw = nb-3 < ib ? nb-3 : ib;
+    bw = bw > 1 ? bw : 1;
+    d->bw = bw;
+    d->ldband = 3*bw+1;
+    size_t lband = (size_t)d->ldband*nb;
+    for (int i = 0; i < 4; i++) {
+        d->band[i]  = (coreblas_complex32_t*)calloc(
+            lband, sizeof(coreblas_complex32_t));
+        d->vband[i] = (coreblas_complex32_t*)calloc(
+            8*(size_t)nb, sizeof(coreblas_complex32_t));
+        ok = ok && d->band[i] != NULL && d->vband[i] != NULL;
+    }
+    for (int i = 0; i < 3; i++) {
+        d->band0[i]  = (coreblas_complex32_t*)calloc(
+            lband, sizeof(coreblas_complex32_t));
+        d->vband0[i] = (coreblas_complex32_t*)calloc(
+            8*(size_t)nb, sizeof(coreblas_complex32_t));
+        ok = ok && d->band0[i] != NULL && d->vband0[i] != NULL;
+    }
+    d->iwband = (int*)malloc(
+        coreblas_cgbbrd_static_liwork(nb, bw)*sizeof(int));
+
+    if (!ok || d->tau == NULL || d->tauqr == NULL || d->work == NULL ||
+        d->dwork == NULL ||
+        d->ipiv == NULL || d->wcalu == NULL || d->iwcalu == NULL ||
+        d->iwork == NULL || d->Ab == NULL || d->Cb == NULL ||
+        d->Db == NULL || d->Tb == NULL || d->Abp == NULL ||
+        d->Cbp == NULL || d->Dbp == NULL || d->Tbp == NULL ||
+        d->Vp == NULL || d->Tp == NULL || d->iwband == NULL ||
+        wbatch != CoreBlasSuccess) {
+        bench_c.destroy(d);
+        return NULL;
+    }
+
+    unsigned long long seed = 42;
+    bench_cfill(nb, nb, d->A0, nb, &seed);
+    bench_cfill(nb, nb, d->B0, nb, &seed);
+    bench_cfill(nb, nb, d->C0, nb, &seed);
+
+    // Make A0 Hermitian and diagonally dominant, hence positive definite
+    // and well conditioned for the triangular solvers.
+    for (int j = 0; j < nb; j++) {
+        for (int i = j+1; i < nb; i++)
+            d->A0[j + nb*i] = conjf(d->A0[i + nb*j]);
+        d->A0[j + nb*j] = creal(d->A0[j + nb*j]) + nb;
+    }
+    memcpy(d->L, d->A0, tile*sizeof(coreblas_complex32_t));
+    coreblas_cpotrf(CoreBlasLower, nb, d->L, nb);
+
+    // Factors consumed by the update kernels.
+    memcpy(d->Vqr, d->B0, tile*sizeof(coreblas_complex32_t));
+    coreblas_cgeqrt(nb, nb, ib, d->Vqr, nb, d->Tqr, ib, d->tau, d->work);
+    for (int j = 0; j < nb; j++) {
+        d->tauqr[j] = d->Tqr[j%ib + ib*j];
+        for (int i = 0; i < nb; i++)
+            d->Vqrx[i + nb*j] = i > j ? d->Vqr[i + nb*j] : (i == j ? 1.0 : 0.0);
+    }
+    memcpy(d->Vlq, d->B0, tile*sizeof(coreblas_complex32_t));
+    coreblas_cgelqt(nb, nb, ib, d->Vlq, nb, d->Tlq, ib, d->tau, d->work);
+    bench_clarfb_v(CoreBlasForward, CoreBlasRowwise, nb, ib,
+                   d->Vlq, nb, d->Vlqx, nb);
+    bench_clarfb_v(CoreBlasBackward, CoreBlasColumnwise, nb, ib,
+                   d->C0, nb, d->Vcbx, nb);
+    bench_clarfb_v(CoreBlasBackward, CoreBlasRowwise, nb, ib,
+                   d->C0, nb, d->Vrbx, nb);
+
+    memcpy(d->A, d->Vqr, tile*sizeof(coreblas_complex32_t));
+    memcpy(d->Vts, d->C0, tile*sizeof(coreblas_complex32_t));
+    coreblas_ctsqrt(nb, nb, ib, d->A, nb, d->Vts, nb, d->Tts, ib,
+                    d->tau, d->work);
+    memcpy(d->A, d->Vqr, tile*sizeof(coreblas_complex32_t));
+    memcpy(d->Vtt, d->Vqr, tile*sizeof(coreblas_complex32_t));
+    coreblas_cttqrt(nb, nb, ib, d->A, nb, d->Vtt, nb, d->Ttt, ib,
+                    d->tau, d->work);
+
+    memcpy(d->A, d->Vlq, tile*sizeof(coreblas_complex32_t));
+    memcpy(d->Vtsl, d->C0, tile*sizeof(coreblas_complex32_t));
+    coreblas_ctslqt(nb, nb, ib, d->A, nb, d->Vtsl, nb, d->Ttsl, ib,
+                    d->tau, d->work);
+    memcpy(d->A, d->Vlq, tile*sizeof(coreblas_complex32_t));
+    memcpy(d->Vttl, d->Vlq, tile*sizeof(coreblas_complex32_t));
+    coreblas_cttlqt(nb, nb, ib, d->A, nb, d->Vttl, nb, d->Tttl, ib,
+                    d->tau, d->work);
+
+    memcpy(d->A, d->Vlq, tile*sizeof(coreblas_complex32_t));
+    memcpy(d->Vtsb, d->C0, tile*sizeof(coreblas_complex32_t));
+    coreblas_ctsqlt(nb, nb, ib, d->A, nb, d->Vtsb, nb, d->Ttsb, ib,
+                    d->tau, d->work);
+    memcpy(d->A, d->Vqr, tile*sizeof(coreblas_complex32_t));
+    memcpy(d->Vtsr, d->C0, tile*sizeof(coreblas_complex32_t));
+    coreblas_ctsrqt(nb, nb, ib, d->A, nb, d->Vtsr, nb, d->Ttsr, ib,
+                    d->tau, d->work);
+
+    // Batch of copies of B0 and C0; all the pairs of the batched update
+    // share the reflectors of the ts factorization.
+    for (int i = 0; i < batch; i++) {
+        d->Abp[i] = &d->Ab[tile*i];
+        d->Cbp[i] = &d->Cb[tile*i];
+        d->Dbp[i] = &d->Db[tile*i];
+        d->Tbp[i] = &d->Tb[(size_t)ib*nb*i];
+        d->Vp[i] = d->Vts;
+        d->Tp[i] = d->Tts;
+        memcpy(d->Abp[i], d->B0, tile*sizeof(coreblas_complex32_t));
+        memcpy(d->Cbp[i], d->C0, tile*sizeof(coreblas_complex32_t));
+        memcpy(d->Dbp[i], d->B0, tile*sizeof(coreblas_complex32_t));
+    }
+
+    // Pivots consumed by the row interchange kernel.
+    memcpy(d->A, d->B0, tile*sizeof(coreblas_complex32_t));
+    bench_cgetrf_tile(d->A, nb, ib, d->ipiv);
+
+    // Band and its states after the first two tasks of the first sweep.
+    for (int j = 0; j < nb; j++)
+        bench_cfill(j+bw < nb ? bw+1 : nb-j, 1,
+                    &d->band0[0][bw + (size_t)d->ldband*j], d->ldband, &seed);
+    bench_cband_norms(d, d->band0[0], &d->band_fro, &d->band_fro2);
+    for (int t = 1; t < 3; t++) {
+        memcpy(d->band0[t], d->band0[t-1], lband*sizeof(coreblas_complex32_t));
+        memcpy(d->vband0[t], d->vband0[t-1],
+               8*(size_t)nb*sizeof(coreblas_complex32_t));
+        bench_cgbtype(d, t, d->band0[t], d->vband0[t]);
+    }
+
+    bench_c.reset(d);
+    return d;
+}
+
+/******************************************************************************/
+static void bench_creset(void *data)
+{
+    bench_cdata_t *d = (bench_cdata_t*)data;
+    size_t size = (size_t)d->nb*d->nb*sizeof(coreblas_complex32_t);
+    size_t lband = (size_t)d->ldband*d->nb*sizeof(coreblas_complex32_t);
+    size_t lvband = 8*(size_t)d->nb*sizeof(coreblas_complex32_t);
+    for (int i = 0; i < 4; i++) {
+        memcpy(d->band[i],  d->band0[i%3],  lband);
+        memcpy(d->vband[i], d->vband0[i%3], lvband);
+    }
+    memcpy(d->A, d->A0, size);
+    memcpy(d->B, d->B0, size);
+    memcpy(d->C, d->C0, size);
+}
+
+/******************************************************************************/
+static void bench_cdestroy(void *data)
+{
+    bench_cdata_t *d = (bench_cdata_t*)data;
+    if (d == NULL)
+        return;
+
+    free(d->A);    free(d->B);    free(d->C);
+    free(d->A0);   free(d->B0);   free(d->C0);   free(d->L);
+    free(d->Vqr);  free(d->Vlq);  free(d->Vts);  free(d->Vtt);
+    free(d->Vtsl); free(d->Vttl); free(d->Vtsb); free(d->Vtsr);
+    free(d->Vqrx); free(d->Vlqx); free(d->Vcbx); free(d->Vrbx);
+    free(d->Tqr);  free(d->Tlq);  free(d->Tts);  free(d->Ttt);
+    free(d->Ttsl); free(d->Tttl); free(d->Ttsb); free(d->Ttsr);
+    free(d->T);
+    free(d->tau);  free(d->tauqr); free(d->work); free(d->dwork);
+    free(d->ipiv);
+    free(d->wcalu); free(d->iwcalu); free(d->iwork);
+    free(d->Ab);   free(d->Cb);   free(d->Db);   free(d->Tb);
+    free(d->Abp);  free(d->Cbp);  free(d->Dbp);  free(d->Tbp);
+    free(d->Vp);   free(d->Tp);
+    for (int i = 0; i < 4; i++) {
+        free(d->band[i]);
+        free(d->vband[i]);
+    }
+    for (int i = 0; i < 3; i++) {
+        free(d->band0[i]);
+        free(d->vband0[i]);
+    }
+    free(d->iwband);
+    if (d->wbatch.spaces != NULL)
+        coreblas_workspace_destroy(&d->wbatch);
+    free(d);
+}
+
+/*******************************************************************************
+ *  Kernel calls.
+ **/
+#define BENCH_DATA bench_cdata_t *d = (bench_cdata_t*)data; int nb = d->nb; \
+                   int ib = d->ib; (void)nb; (void)ib;
+
+static const coreblas_complex32_t zone  =  1.0;
+static const coreblas_complex32_t zmone = -1.0;
+
+//==============================================================================
+// Level 3 BLAS
+static int bench_cgemm_call(void *data) {
+    BENCH_DATA
+    coreblas_cgemm(CoreBlasNoTrans, CoreBlasNoTrans, nb, nb, nb,
+                   zmone, d->A, nb, d->B, nb, zone, d->C, nb);
+    return 0;
+}
+static bench_flops_t bench_cgemm_flops(int nb, int ib) {
+    return bench_cflops(FMULS_GEMM(nb, nb, nb), FADDS_GEMM(nb, nb, nb));
+}
+
+static int bench_cgemm_batched_call(void *data) {
+    BENCH_DATA
+    return coreblas_cgemm_batched(
+        CoreBlasNoTrans, CoreBlasNoTrans, nb, nb, nb,
+        zmone, (const coreblas_complex32_t * const *)d->Abp, nb,
+               (const coreblas_complex32_t * const *)d->Dbp, nb,
+        zone, d->Cbp, nb, d->batch);
+}
+static bench_flops_t bench_cgemm_batched_flops(int nb, int ib) {
+    return bench_cbatch(nb)*bench_cgemm_flops(nb, ib);
+}
+
+#ifdef COMPLEX
+static int bench_chemm_call(void *data) {
+    BENCH_DATA
+    coreblas_chemm(CoreBlasLeft, CoreBlasLower, nb, nb,
+                   zmone, d->A, nb, d->B, nb, zone, d->C, nb);
+    return 0;
+}
+
+static int bench_cherk_call(void *data) {
+    BENCH_DATA
+    coreblas_cherk(CoreBlasLower, CoreBlasNoTrans, nb, nb,
+                   -1.0, d->B, nb, 1.0, d->A, nb);
+    return 0;
+}
+
+static int bench_cher2k_call(void *data) {
+    BENCH_DATA
+    coreblas_cher2k(CoreBlasLower, CoreBlasNoTrans, nb, nb,
+                    zmone, d->B, nb, d->C, nb, 1.0, d->A, nb);
+    return 0;
+}
+#endif
+
+static int bench_csymm_call(void *data) {
+    BENCH_DATA
+    coreblas_csymm(CoreBlasLeft, CoreBlasLower, nb, nb,
+                   zmone, d->A, nb, d->B, nb, zone, d->C, nb);
+    return 0;
+}
+static bench_flops_t bench_csymm_flops(int nb, int ib) {
+    return bench_cflops(FMULS_SYMM(nb, nb), FADDS_SYMM(nb, nb));
+}
+
+static int bench_csyrk_call(void *data) {
+    BENCH_DATA
+    coreblas_csyrk(CoreBlasLower, CoreBlasNoTrans, nb, nb,
+                   zmone, d->B, nb, zone, d->A, nb);
+    return 0;
+}
+static bench_flops_t bench_csyrk_flops(int nb, int ib) {
+    return bench_cflops(FMULS_SYRK(nb, nb), FADDS_SYRK(nb, nb));
+}
+
+static int bench_csyr2k_call(void *data) {
+    BENCH_DATA
+    coreblas_csyr2k(CoreBlasLower, CoreBlasNoTrans, nb, nb,
+                    zmone, d->B, nb, d->C, nb, zone, d->A, nb);
+    return 0;
+}
+static bench_flops_t bench_csyr2k_flops(int nb, int ib) {
+    return bench_cflops(FMULS_SYR2K(nb, nb), FADDS_SYR2K(nb, nb));
+}
+
+static int bench_ctrmm_call(void *data) {
+    BENCH_DATA
+    coreblas_ctrmm(CoreBlasLeft, CoreBlasLower, CoreBlasNoTrans,
+                   CoreBlasNonUnit, nb, nb, zone, d->A, nb, d->B, nb);
+    return 0;
+}
+static bench_flops_t bench_ctrmm_flops(int nb, int ib) {
+    return bench_cflops(FMULS_TRMM(nb, nb), FADDS_TRMM(nb, nb));
+}
+
+static int bench_ctrsm_call(void *data) {
+    BENCH_DATA
+    coreblas_ctrsm(CoreBlasLeft, CoreBlasLower, CoreBlasNoTrans,
+                   CoreBlasNonUnit, nb, nb, zone, d->A, nb, d->B, nb);
+    return 0;
+}
+static bench_flops_t bench_ctrsm_flops(int nb, int ib) {
+    return bench_cflops(FMULS_TRSM(nb, nb), FADDS_TRSM(nb, nb));
+}
+
+//==============================================================================
+// Auxiliary
+static int bench_cgeadd_call(void *data) {
+    BENCH_DATA
+    return coreblas_cgeadd(CoreBlasNoTrans, nb, nb,
+                           zmone, d->B, nb, zone, d->C, nb);
+}
+static bench_flops_t bench_cgeadd_flops(int nb, int ib) {
+    return bench_cflops(2.0*nb*nb, (float)nb*nb);
+}
+
+static int bench_ctradd_call(void *data) {
+    BENCH_DATA
+    return coreblas_ctradd(CoreBlasLower, CoreBlasNoTrans, nb, nb,
+                           zmone, d->B, nb, zone, d->C, nb);
+}
+static bench_flops_t bench_ctradd_flops(int nb, int ib) {
+    return bench_cflops((float)nb*(nb+1), 0.5*nb*(nb+1));
+}
+
+static int bench_clacpy_call(void *data) {
+    BENCH_DATA
+    coreblas_clacpy(CoreBlasGeneral, CoreBlasNoTrans, nb, nb,
+                    d->B, nb, d->C, nb);
+    return 0;
+}
+
+static int bench_clacpy_lapack2tile_band_call(void *data) {
+    BENCH_DATA
+    coreblas_clacpy_lapack2tile_band(CoreBlasGeneral, 0, 0, nb, nb, nb,
+                                     ib, ib, d->B, nb, d->C, nb);
+    return 0;
+}
+
+static int bench_clacpy_tile2lapack_band_call(void *data) {
+    BENCH_DATA
+    coreblas_clacpy_tile2lapack_band(CoreBlasGeneral, 0, 0, nb, nb, nb,
+                                     ib, ib, d->B, nb, d->C, nb);
+    return 0;
+}
+
+static int bench_claset_call(void *data) {
+    BENCH_DATA
+    coreblas_claset(CoreBlasGeneral, nb, nb, 0.0, 1.0, d->C, nb);
+    return 0;
+}
+
+static int bench_clascl_call(void *data) {
+    BENCH_DATA
+    coreblas_clascl(CoreBlasGeneral, 2.0, 3.0, nb, nb, d->C, nb);
+    return 0;
+}
+static bench_flops_t bench_clascl_flops(int nb, int ib) {
+    return bench_cflops((float)nb*nb, 0.0);
+}
+
+static bench_flops_t bench_cnorm_flops(int nb, int ib) {
+    return bench_cflops((float)nb*nb, (float)nb*nb);
+}
+
+static int bench_clange_one_call(void *data) {
+    BENCH_DATA
+    coreblas_clange(CoreBlasOneNorm, nb, nb, d->B, nb, d->dwork, d->value);
+    return 0;
+}
+
+static int bench_clange_inf_call(void *data) {
+    BENCH_DATA
+    coreblas_clange(CoreBlasInfNorm, nb, nb, d->B, nb, d->dwork, d->value);
+    return 0;
+}
+
+static int bench_clange_fro_call(void *data) {
+    BENCH_DATA
+    coreblas_clange(CoreBlasFrobeniusNorm, nb, nb, d->B, nb,
+                    d->dwork, d->value);
+    return 0;
+}
+
+static int bench_clange_max_call(void *data) {
+    BENCH_DATA
+    coreblas_clange(CoreBlasMaxNorm, nb, nb, d->B, nb, d->dwork, d->value);
+    return 0;
+}
+
+// Column and row sums, as computed on every tile by the tile norms.
+static int bench_clange_aux_one_call(void *data) {
+    BENCH_DATA
+    coreblas_clange_aux(CoreBlasOneNorm, nb, nb, d->B, nb, d->dwork);
+    return 0;
+}
+
+static int bench_clange_aux_inf_call(void *data) {
+    BENCH_DATA
+    coreblas_clange_aux(CoreBlasInfNorm, nb, nb, d->B, nb, d->dwork);
+    return 0;
+}
+
+static int bench_clantr_aux_inf_call(void *data) {
+    BENCH_DATA
+    coreblas_clantr_aux(CoreBlasInfNorm, CoreBlasUpper, CoreBlasNonUnit,
+                        nb, nb, d->B, nb, d->dwork);
+    return 0;
+}
+
+static int bench_clansy_aux_call(void *data) {
+    BENCH_DATA
+    coreblas_clansy_aux(CoreBlasOneNorm, CoreBlasLower, nb, d->A, nb,
+                        d->dwork);
+    return 0;
+}
+
+#ifdef COMPLEX
+static int bench_clanhe_one_call(void *data) {
+    BENCH_DATA
+    coreblas_clanhe(CoreBlasOneNorm, CoreBlasLower, nb, d->A, nb,
+                    d->dwork, d->value);
+    return 0;
+}
+
+static int bench_clanhe_aux_call(void *data) {
+    BENCH_DATA
+    coreblas_clanhe_aux(CoreBlasOneNorm, CoreBlasLower, nb, d->A, nb,
+                        d->dwork);
+    return 0;
+}
+
+static int bench_chessq_call(void *data) {
+    BENCH_DATA
+    d->value[0] = 0.0;
+    d->value[1] = 1.0;
+    coreblas_chessq(CoreBlasLower, nb, d->A, nb, &d->value[0], &d->value[1]);
+    return 0;
+}
+#endif
+
+static int bench_clansy_one_call(void *data) {
+    BENCH_DATA
+    coreblas_clansy(CoreBlasOneNorm, CoreBlasLower, nb, d->A, nb,
+                    d->dwork, d->value);
+    return 0;
+}
+
+static int bench_clantr_one_call(void *data) {
+    BENCH_DATA
+    coreblas_clantr(CoreBlasOneNorm, CoreBlasLower, CoreBlasNonUnit, nb, nb,
+                    d->B, nb, d->dwork, d->value);
+    return 0;
+}
+
+static int bench_cgessq_call(void *data) {
+    BENCH_DATA
+    d->value[0] = 0.0;
+    d->value[1] = 1.0;
+    coreblas_cgessq(nb, nb, d->B, nb, &d->value[0], &d->value[1]);
+    return 0;
+}
+
+static int bench_csyssq_call(void *data) {
+    BENCH_DATA
+    d->value[0] = 0.0;
+    d->value[1] = 1.0;
+    coreblas_csyssq(CoreBlasLower, nb, d->A, nb, &d->value[0], &d->value[1]);
+    return 0;
+}
+
+// Reductions of the partial results of nb*nb tiles, read from the tile B.
+static int bench_creduce_ssq_call(void *data) {
+    BENCH_DATA
+    const float *scale = (const float*)d->B;
+    int n = nb*nb/2;
+    coreblas_creduce_ssq(n, scale, &scale[n], &d->value[0], &d->value[1]);
+    return 0;
+}
+
+static int bench_creduce_one_call(void *data) {
+    BENCH_DATA
+    coreblas_creduce_norm(CoreBlasOneNorm, nb, nb, (const float*)d->B, nb,
+                          d->value);
+    return 0;
+}
+
+static int bench_ctrssq_call(void *data) {
+    BENCH_DATA
+    d->value[0] = 0.0;
+    d->value[1] = 1.0;
+    coreblas_ctrssq(CoreBlasLower, CoreBlasNonUnit, nb, nb, d->B, nb,
+                    &d->value[0], &d->value[1]);
+    return 0;
+}
+
+//==============================================================================
+// Cholesky and triangular
+static int bench_cpotrf_call(void *data) {
+    BENCH_DATA
+    return coreblas_cpotrf(CoreBlasLower, nb, d->A, nb);
+}
+static bench_flops_t bench_cpotrf_flops(int nb, int ib) {
+    return bench_cflops(FMULS_POTRF(nb), FADDS_POTRF(nb));
+}
+
+static int bench_ctrtri_call(void *data) {
+    BENCH_DATA
+    return coreblas_ctrtri(CoreBlasLower, CoreBlasNonUnit, nb, d->A, nb);
+}
+static bench_flops_t bench_ctrtri_flops(int nb, int ib) {
+    return bench_cflops(FMULS_TRTRI(nb), FADDS_TRTRI(nb));
+}
+
+static int bench_clauum_call(void *data) {
+    BENCH_DATA
+    return coreblas_clauum(CoreBlasLower, nb, d->A, nb);
+}
+static bench_flops_t bench_clauum_flops(int nb, int ib) {
+    return bench_cflops(FMULS_LAUUM(nb), FADDS_LAUUM(nb));
+}
+
+static int bench_chegst_call(void *data) {
+    BENCH_DATA
+    return coreblas_chegst(1, CoreBlasLower, nb, d->A, nb, d->L, nb);
+}
+static bench_flops_t bench_chegst_flops(int nb, int ib) {
+    return bench_cflops(FMULS_SYGST(nb), FADDS_SYGST(nb));
+}
+
+//==============================================================================
+// LU
+static int bench_cgetrf_call(void *data) {
+    BENCH_DATA
+    return bench_cgetrf_tile(d->B, nb, ib, d->ipiv);
+}
+static bench_flops_t bench_cgetrf_flops(int nb, int ib) {
+    return bench_cflops(FMULS_GETRF(nb, nb), FADDS_GETRF(nb, nb));
+}
+
+static int bench_cgetrf_calu_call(void *data) {
+    BENCH_DATA
+    coreblas_desc_t desc;
+    coreblas_desc_general_init(CoreBlasComplexFloat, d->B, nb, nb,
+                               nb, nb, 0, 0, nb, nb, &desc);
+
+    volatile int info = 0;
+    coreblas_barrier_t barrier;
+    coreblas_barrier_init(&barrier);
+
+    coreblas_cgetrf_calu(desc, d->ipiv, 0, 1, d->wcalu, d->iwcalu,
+                         &info, &barrier);
+    return info;
+}
+
+// Pivot search over the whole tile B.
+static int bench_icamax_tile_call(void *data) {
+    BENCH_DATA
+    int imax, jmax;
+    coreblas_icamax_tile(nb, nb, d->B, nb, &imax, &jmax, &d->value[0]);
+    return 0;
+}
+
+static int bench_cgeswp_call(void *data) {
+    BENCH_DATA
+    coreblas_desc_t desc;
+    coreblas_desc_general_init(CoreBlasComplexFloat, d->C, nb, nb,
+                               nb, nb, 0, 0, nb, nb, &desc);
+    coreblas_cgeswp(CoreBlasRowwise, desc, 1, nb, d->ipiv, 1);
+    return 0;
+}
+
+static int bench_cgeswp_blocked_call(void *data) {
+    BENCH_DATA
+    coreblas_desc_t desc;
+    coreblas_desc_general_init(CoreBlasComplexFloat, d->C, nb, nb,
+                               nb, nb, 0, 0, nb, nb, &desc);
+    coreblas_cgeswp_blocked(CoreBlasRowwise, desc, 1, nb, d->ipiv, 1,
+                            0, 1, d->work, d->iwork);
+    return 0;
+}
+
+//==============================================================================
+// QR and LQ
+static int bench_cgeqrt_call(void *data) {
+    BENCH_DATA
+    return coreblas_cgeqrt(nb, nb, ib, d->B, nb, d->T, ib, d->tau, d->work);
+}
+static bench_flops_t bench_cgeqrt_flops(int nb, int ib) {
+    return bench_cflops(FMULS_GEQRF(nb, nb), FADDS_GEQRF(nb, nb));
+}
+
+static int bench_cgeqrt_batched_call(void *data) {
+    BENCH_DATA
+    return coreblas_cgeqrt_batched(nb, nb, ib, d->Abp, nb, d->Tbp, ib,
+                                   &d->wbatch, d->batch);
+}
+static bench_flops_t bench_cgeqrt_batched_flops(int nb, int ib) {
+    return bench_cbatch(nb)*bench_cgeqrt_flops(nb, ib);
+}
+
+static int bench_cgelqt_call(void *data) {
+    BENCH_DATA
+    return coreblas_cgelqt(nb, nb, ib, d->B, nb, d->T, ib, d->tau, d->work);
+}
+static bench_flops_t bench_cgelqt_flops(int nb, int ib) {
+    return bench_cflops(FMULS_GELQF(nb, nb), FADDS_GELQF(nb, nb));
+}
+
+static int bench_ctsqrt_call(void *data) {
+    BENCH_DATA
+    return coreblas_ctsqrt(nb, nb, ib, d->A, nb, d->B, nb, d->T, ib,
+                           d->tau, d->work);
+}
+
+static int bench_ctsqrt_rec_call(void *data) {
+    BENCH_DATA
+    return coreblas_ctsqrt_rec(nb, nb, ib, d->A, nb, d->B, nb, d->T, ib,
+                               d->tau, d->work);
+}
+
+static int bench_ctslqt_call(void *data) {
+    BENCH_DATA
+    return coreblas_ctslqt(nb, nb, ib, d->A, nb, d->B, nb, d->T, ib,
+                           d->tau, d->work);
+}
+
+static int bench_ctsqlt_call(void *data) {
+    BENCH_DATA
+    return coreblas_ctsqlt(nb, nb, ib, d->A, nb, d->B, nb, d->T, ib,
+                           d->tau, d->work);
+}
+
+static int bench_ctsrqt_call(void *data) {
+    BENCH_DATA
+    return coreblas_ctsrqt(nb, nb, ib, d->A, nb, d->B, nb, d->T, ib,
+                           d->tau, d->work);
+}
+static bench_flops_t bench_ctsqrt_flops(int nb, int ib) {
+    return bench_cflops(FMULS_TSQRT(nb, nb), FADDS_TSQRT(nb, nb));
+}
+
+static int bench_cttqrt_call(void *data) {
+    BENCH_DATA
+    return coreblas_cttqrt(nb, nb, ib, d->A, nb, d->B, nb, d->T, ib,
+                           d->tau, d->work);
+}
+
+static int bench_cttqrt_rec_call(void *data) {
+    BENCH_DATA
+    return coreblas_cttqrt_rec(nb, nb, ib, d->A, nb, d->B, nb, d->T, ib,
+                               d->tau, d->work);
+}
+
+static int bench_cttlqt_call(void *data) {
+    BENCH_DATA
+    return coreblas_cttlqt(nb, nb, ib, d->A, nb, d->B, nb, d->T, ib,
+                           d->tau, d->work);
+}
+static bench_flops_t bench_cttqrt_flops(int nb, int ib) {
+    return bench_cflops(FMULS_TTQRT(nb), FADDS_TTQRT(nb));
+}
+
+static int bench_cunmqr_call(void *data) {
+    BENCH_DATA
+    return coreblas_cunmqr(CoreBlasLeft, CoreBlas_ConjTrans, nb, nb, nb, ib,
+                           d->Vqr, nb, d->Tqr, ib, d->C, nb, d->work, nb);
+}
+
+static int bench_cunmlq_call(void *data) {
+    BENCH_DATA
+    return coreblas_cunmlq(CoreBlasLeft, CoreBlas_ConjTrans, nb, nb, nb, ib,
+                           d->Vlq, nb, d->Tlq, ib, d->C, nb, d->work, nb);
+}
+static bench_flops_t bench_cunmqr_flops(int nb, int ib) {
+    return bench_cflops(FMULS_UNMQR(nb, nb, nb), FADDS_UNMQR(nb, nb, nb));
+}
+
+static int bench_ctsmqr_call(void *data) {
+    BENCH_DATA
+    return coreblas_ctsmqr(CoreBlasLeft, CoreBlas_ConjTrans,
+                           nb, nb, nb, nb, nb, ib,
+                           d->B, nb, d->C, nb, d->Vts, nb, d->Tts, ib,
+                           d->work, ib);
+}
+
+static int bench_ctsmlq_call(void *data) {
+    BENCH_DATA
+    return coreblas_ctsmlq(CoreBlasLeft, CoreBlas_ConjTrans,
+                           nb, nb, nb, nb, nb, ib,
+                           d->B, nb, d->C, nb, d->Vtsl, nb, d->Ttsl, ib,
+                           d->work, ib);
+}
+
+static int bench_ctsmql_call(void *data) {
+    BENCH_DATA
+    return coreblas_ctsmql(CoreBlasLeft, CoreBlas_ConjTrans,
+                           nb, nb, nb, nb, nb, ib,
+                           d->B, nb, d->C, nb, d->Vtsb, nb, d->Ttsb, ib,
+                           d->work, ib);
+}
+
+static int bench_ctsmrq_call(void *data) {
+    BENCH_DATA
+    return coreblas_ctsmrq(CoreBlasLeft, CoreBlas_ConjTrans,
+                           nb, nb, nb, nb, nb, ib,
+                           d->B, nb, d->C, nb, d->Vtsr, nb, d->Ttsr, ib,
+                           d->work, ib);
+}
+static bench_flops_t bench_ctsmqr_flops(int nb, int ib) {
+    return bench_cflops(FMULS_TSMQR(nb, nb, nb), FADDS_TSMQR(nb, nb, nb));
+}
+
+static int bench_ctsmqr_batched_call(void *data) {
+    BENCH_DATA
+    return coreblas_ctsmqr_batched(CoreBlasLeft, CoreBlas_ConjTrans,
+                                   nb, nb, nb, nb, nb, ib,
+                                   d->Dbp, nb, d->Cbp, nb,
+                                   d->Vp, nb, d->Tp, ib,
+                                   &d->wbatch, d->batch);
+}
+static bench_flops_t bench_ctsmqr_batched_flops(int nb, int ib) {
+    return bench_cbatch(nb)*bench_ctsmqr_flops(nb, ib);
+}
+
+static int bench_ctsmqr_row_call(void *data) {
+    BENCH_DATA
+    return coreblas_ctsmqr_row(CoreBlasLeft, CoreBlas_ConjTrans,
+                               nb, nb, nb, nb, nb, ib,
+                               d->Dbp, nb, d->Cbp, nb,
+                               d->Vts, nb, d->Tts, ib,
+                               &d->wbatch, d->batch);
+}
+
+static int bench_cttmqr_call(void *data) {
+    BENCH_DATA
+    return coreblas_cttmqr(CoreBlasLeft, CoreBlas_ConjTrans,
+                           nb, nb, nb, nb, nb, ib,
+                           d->B, nb, d->C, nb, d->Vtt, nb, d->Ttt, ib,
+                           d->work, ib);
+}
+
+static int bench_cttmlq_call(void *data) {
+    BENCH_DATA
+    return coreblas_cttmlq(CoreBlasLeft, CoreBlas_ConjTrans,
+                           nb, nb, nb, nb, nb, ib,
+                           d->B, nb, d->C, nb, d->Vttl, nb, d->Tttl, ib,
+                           d->work, ib);
+}
+static bench_flops_t bench_cttmqr_flops(int nb, int ib) {
+    return bench_cflops(FMULS_TTMQR(nb, nb), FADDS_TTMQR(nb, nb));
+}
+
+// One ib-wide block of the ts update, as issued by coreblas_ctsmqr.
+static int bench_cparfb_call(void *data) {
+    BENCH_DATA
+    return coreblas_cparfb(CoreBlasLeft, CoreBlas_ConjTrans,
+                           CoreBlasForward, CoreBlasColumnwise,
+                           ib, nb, nb, nb, ib, 0,
+                           d->B, nb, d->C, nb, d->Vts, nb, d->Tts, ib,
+                           d->work, ib);
+}
+static bench_flops_t bench_cparfb_flops(int nb, int ib) {
+    return bench_cflops(FMULS_TSMQR(nb, nb, ib), FADDS_TSMQR(nb, nb, ib));
+}
+
+static int bench_cpamm_call(void *data) {
+    BENCH_DATA
+    return coreblas_cpamm(CoreBlasW, CoreBlasLeft, CoreBlasColumnwise,
+                          ib, nb, nb, 0,
+                          d->B, nb, d->C, nb, d->Vts, nb, d->work, ib);
+}
+static bench_flops_t bench_cpamm_flops(int nb, int ib) {
+    return bench_cflops(FMULS_GEMM(ib, nb, nb), FADDS_GEMM(ib, nb, nb));
+}
+
+static int bench_cpemv_call(void *data) {
+    BENCH_DATA
+    return coreblas_cpemv(CoreBlasConjTrans, CoreBlasColumnwise,
+                          nb, nb, 0, zone, d->Vts, nb, d->B, 1,
+                          zone, d->C, 1, d->work);
+}
+static bench_flops_t bench_cpemv_flops(int nb, int ib) {
+    return bench_cflops((float)nb*nb, (float)nb*nb);
+}
+
+static int bench_clarfb_gemm_call(void *data) {
+    BENCH_DATA
+    return coreblas_clarfb_gemm(CoreBlasLeft, CoreBlas_ConjTrans,
+                                CoreBlasForward, CoreBlasColumnwise,
+                                nb, nb, ib, d->Vqrx, nb, d->Tqr, ib,
+                                d->C, nb, d->work, nb);
+}
+
+// The other storev/direct cases; backward T is lower triangular and taken
+// from B0, which is not a T factor of V but is valid for the check.
+static int bench_clarfb_gemm_rowfwd_call(void *data) {
+    BENCH_DATA
+    return coreblas_clarfb_gemm(CoreBlasRight, CoreBlasNoTrans,
+                                CoreBlasForward, CoreBlasRowwise,
+                                nb, nb, ib, d->Vlqx, nb, d->Tlq, ib,
+                                d->C, nb, d->work, nb);
+}
+
+static int bench_clarfb_gemm_colbwd_call(void *data) {
+    BENCH_DATA
+    return coreblas_clarfb_gemm(CoreBlasLeft, CoreBlas_ConjTrans,
+                                CoreBlasBackward, CoreBlasColumnwise,
+                                nb, nb, ib, d->Vcbx, nb, d->B0, nb,
+                                d->C, nb, d->work, nb);
+}
+
+static int bench_clarfb_gemm_rowbwd_call(void *data) {
+    BENCH_DATA
+    return coreblas_clarfb_gemm(CoreBlasRight, CoreBlasNoTrans,
+                                CoreBlasBackward, CoreBlasRowwise,
+                                nb, nb, ib, d->Vrbx, nb, d->B0, nb,
+                                d->C, nb, d->work, nb);
+}
+static bench_flops_t bench_clarfb_gemm_flops(int nb, int ib) {
+    return bench_cflops(FMULS_TSMQR(nb, nb, ib), FADDS_TSMQR(nb, nb, ib));
+}
+
+// T factor of all the reflectors of the geqrt factorization at once.
+static int bench_clarft_call(void *data) {
+    BENCH_DATA
+    return coreblas_clarft(CoreBlasColumnwise, nb, nb, d->Vqr, nb, d->tauqr,
+                           d->C, nb);
+}
+static bench_flops_t bench_clarft_flops(int nb, int ib) {
+    return bench_cflops(FMULS_GEMM(nb, nb, nb)/6.0, FADDS_GEMM(nb, nb, nb)/6.0);
+}
+
+//==============================================================================
+// Two-sided and band reductions
+static int bench_cheswp_call(void *data) {
+    BENCH_DATA
+    coreblas_desc_t desc;
+    coreblas_desc_general_init(CoreBlasComplexFloat, d->A, nb, nb,
+                               nb, nb, 0, 0, nb, nb, &desc);
+    coreblas_barrier_t barrier;
+    coreblas_barrier_init(&barrier);
+    coreblas_cheswp(0, 1, CoreBlasLower, desc, 1, nb, d->ipiv, 1, &barrier);
+    return 0;
+}
+
+static int bench_cherfb_call(void *data) {
+    BENCH_DATA
+    return coreblas_cherfb(CoreBlasLower, nb, nb, ib, d->Vqr, nb, d->Tqr, ib,
+                           d->A, nb, d->work);
+}
+static bench_flops_t bench_cherfb_flops(int nb, int ib) {
+    return 2.0*bench_cunmqr_flops(nb, ib);
+}
+
+// B holds the conjugate transpose of the top tile.
+static int bench_ctsmqr_hetra1_call(void *data) {
+    BENCH_DATA
+    return coreblas_ctsmqr_hetra1(CoreBlasLeft, CoreBlas_ConjTrans,
+                                  nb, nb, nb, nb, nb, ib,
+                                  d->B, nb, d->C, nb, d->Vts, nb, d->Tts, ib,
+                                  d->work, ib);
+}
+
+// The diagonal tiles A and B and the off-diagonal tile C of a Hermitian
+// 2-by-2 block.
+static int bench_ctsmqr_corner_call(void *data) {
+    BENCH_DATA
+    return coreblas_ctsmqr_corner(nb, nb, nb, nb, nb, nb, nb, ib,
+                                  d->A, nb, d->C, nb, d->B, nb,
+                                  d->Vts, nb, d->Tts, ib, d->work);
+}
+static bench_flops_t bench_ctsmqr_corner_flops(int nb, int ib) {
+    return 4.0*bench_ctsmqr_flops(nb, ib);
+}
+
+// The first three tasks of the first sweep of the chase of the band,
+// each on the band as left by the previous one.
+static int bench_cgbtype1cb_call(void *data) {
+    BENCH_DATA
+    bench_cgbtype(d, 1, d->band[0], d->vband[0]);
+    return 0;
+}
+
+static int bench_cgbtype2cb_call(void *data) {
+    BENCH_DATA
+    bench_cgbtype(d, 2, d->band[1], d->vband[1]);
+    return 0;
+}
+
+static int bench_cgbtype3cb_call(void *data) {
+    BENCH_DATA
+    bench_cgbtype(d, 3, d->band[2], d->vband[2]);
+    return 0;
+}
+
+static int bench_cgbbrd_static_call(void *data) {
+    BENCH_DATA
+    coreblas_complex32_t *vband = d->vband[3];
+    return coreblas_cgbbrd_static(CoreBlasLower, nb, d->bw, 1,
+                                  d->band[3], d->ldband,
+                                  vband, &vband[2*nb], &vband[4*nb],
+                                  &vband[6*nb], 0, &d->wbatch, d->iwband);
+}
+
+/*******************************************************************************
+ *  Checks of the result of the last call, made on reset data.
+ **/
+#define BENCH_CHECK bench_cdata_t *d = (bench_cdata_t*)data; int nb = d->nb; \
+                    int ib = d->ib; (void)ib; \
+                    size_t tile = (size_t)nb*nb; (void)tile;
+
+//==============================================================================
+// Level 3 BLAS
+// Freivalds' check against an unblocked product with a random vector, which
+// does not rely on the BLAS gemm the kernel calls.
+static bench_resid_t bench_cgemm_check(void *data) {
+    BENCH_CHECK
+    coreblas_complex32_t *x = bench_cmalloc(3*(size_t)nb);
+    coreblas_complex32_t *y = &x[nb];
+    coreblas_complex32_t *z = &x[2*nb];
+    unsigned long long seed = 7;
+    bench_cfill(nb, 1, x, nb, &seed);
+    float err = 0.0;
+    float nrm = 0.0;
+    for (int i = 0; i < nb; i++) {
+        y[i] = 0.0;
+        for (int l = 0; l < nb; l++)
+            y[i] += d->B0[i + nb*l]*x[l];
+    }
+    for (int i = 0; i < nb; i++) {
+        coreblas_complex32_t r = 0.0;
+        z[i] = 0.0;
+        for (int l = 0; l < nb; l++) {
+            r += d->C0[i + nb*l]*x[l] - d->A0[i + nb*l]*y[l];
+            z[i] += d->C[i + nb*l]*x[l];
+        }
+        err += cabsf(z[i] - r)*cabsf(z[i] - r);
+        nrm += cabsf(r)*cabsf(r);
+    }
+    free(x);
+    return bench_cscaled(sqrtf(err), sqrtf(nrm), nb);
+}
+
+// R = C0 - op(A) B0, where A is the full matrix of the lower triangle of A0.
+static float bench_csymm_ref_check(bench_cdata_t *d, int herm)
+{
+    int nb = d->nb;
+    size_t tile = (size_t)nb*nb;
+    coreblas_complex32_t *F = bench_cmalloc(2*tile);
+    coreblas_complex32_t *R = &F[tile];
+    bench_cfull(herm, nb, d->A0, nb, F, nb);
+    memcpy(R, d->C0, tile*sizeof(coreblas_complex32_t));
+    coreblas_cgemm(CoreBlasNoTrans, CoreBlasNoTrans, nb, nb, nb,
+                   zmone, F, nb, d->B0, nb, zone, R, nb);
+    float resid = bench_cresid(CoreBlasGeneral, nb, nb, d->C, nb, R, nb);
+    free(F);
+    return resid;
+}
+
+// R = A0 - X Y^T - Y X^T for rank 2 and A0 - X X^T for rank 1, with
+// ^T the transposition trans, compared on the lower triangle.
+static float bench_crank_ref_check(bench_cdata_t *d, coreblas_enum_t trans,
+                                    int rank2)
+{
+    int nb = d->nb;
+    size_t tile = (size_t)nb*nb;
+    coreblas_complex32_t *R = bench_cmalloc(tile);
+    memcpy(R, d->A0, tile*sizeof(coreblas_complex32_t));
+    const coreblas_complex32_t *Y = rank2 ? d->C0 : d->B0;
+    coreblas_cgemm(CoreBlasNoTrans, trans, nb, nb, nb,
+                   zmone, d->B0, nb, Y, nb, zone, R, nb);
+    if (rank2) {
+        coreblas_cgemm(CoreBlasNoTrans, trans, nb, nb, nb,
+                       zmone, d->C0, nb, d->B0, nb, zone, R, nb);
+    }
+    float resid = bench_cresid(CoreBlasLower, nb, nb, d->A, nb, R, nb);
+    free(R);
+    return resid;
+}
+
+#ifdef COMPLEX
+static bench_resid_t bench_chemm_check(void *data) {
+    return bench_csymm_ref_check((bench_cdata_t*)data, 1);
+}
+
+static bench_resid_t bench_cherk_check(void *data) {
+    return bench_crank_ref_check((bench_cdata_t*)data, CoreBlasConjTrans, 0);
+}
+
+static bench_resid_t bench_cher2k_check(void *data) {
+    return bench_crank_ref_check((bench_cdata_t*)data, CoreBlasConjTrans, 1);
+}
+#endif
+
+static bench_resid_t bench_csymm_check(void *data) {
+    return bench_csymm_ref_check((bench_cdata_t*)data, 0);
+}
+
+static bench_resid_t bench_csyrk_check(void *data) {
+    return bench_crank_ref_check((bench_cdata_t*)data, CoreBlasTrans, 0);
+}
+
+static bench_resid_t bench_csyr2k_check(void *data) {
+    return bench_crank_ref_check((bench_cdata_t*)data, CoreBlasTrans, 1);
+}
+
+static bench_resid_t bench_ctrmm_check(void *data) {
+    BENCH_CHECK
+    coreblas_complex32_t *L = bench_cmalloc(2*tile);
+    coreblas_complex32_t *R = &L[tile];
+    bench_ctri(CoreBlasLower, nb, d->A0, nb, L, nb);
+    coreblas_cgemm(CoreBlasNoTrans, CoreBlasNoTrans, nb, nb, nb,
+                   zone, L, nb, d->B0, nb, 0.0, R, nb);
+    float resid = bench_cresid(CoreBlasGeneral, nb, nb, d->B, nb, R, nb);
+    free(L);
+    return resid;
+}
+
+// The residual L B - B0 of the solution.
+static bench_resid_t bench_ctrsm_check(void *data) {
+    BENCH_CHECK
+    coreblas_complex32_t *L = bench_cmalloc(2*tile);
+    coreblas_complex32_t *X = &L[tile];
+    bench_ctri(CoreBlasLower, nb, d->A0, nb, L, nb);
+    coreblas_cgemm(CoreBlasNoTrans, CoreBlasNoTrans, nb, nb, nb,
+                   zone, L, nb, d->B, nb, 0.0, X, nb);
+    float resid = bench_cresid(CoreBlasGeneral, nb, nb, X, nb, d->B0, nb);
+    free(L);
+    return resid;
+}
+
+//==============================================================================
+// Auxiliary
+static bench_resid_t bench_cgeadd_check(void *data) {
+    BENCH_CHECK
+    coreblas_complex32_t *R = bench_cmalloc(tile);
+    for (size_t i = 0; i < tile; i++)
+        R[i] = d->C0[i] - d->B0[i];
+    float resid = bench_cresid(CoreBlasGeneral, nb, nb, d->C, nb, R, nb);
+    free(R);
+    return resid;
+}
+
+// The strictly upper triangle is left as is.
+static bench_resid_t bench_ctradd_check(void *data) {
+    BENCH_CHECK
+    coreblas_complex32_t *R = bench_cmalloc(tile);
+    for (int j = 0; j < nb; j++)
+        for (int i = 0; i < nb; i++)
+            R[i + nb*j] = d->C0[i + nb*j] - (i >= j ? d->B0[i + nb*j] : 0.0);
+    float resid = bench_cresid(CoreBlasGeneral, nb, nb, d->C, nb, R, nb);
+    free(R);
+    return resid;
+}
+
+// The copies of B0 into C.
+static bench_resid_t bench_clacpy_check(void *data) {
+    BENCH_CHECK
+    return bench_cresid(CoreBlasGeneral, nb, nb, d->C, nb, d->B0, nb);
+}
+
+static bench_resid_t bench_claset_check(void *data) {
+    BENCH_CHECK
+    coreblas_complex32_t *R = bench_cmalloc(tile);
+    for (int j = 0; j < nb; j++)
+        for (int i = 0; i < nb; i++)
+            R[i + nb*j] = i == j ? 1.0 : 0.0;
+    float resid = bench_cresid(CoreBlasGeneral, nb, nb, d->C, nb, R, nb);
+    free(R);
+    return resid;
+}
+
+static bench_resid_t bench_clascl_check(void *data) {
+    BENCH_CHECK
+    coreblas_complex32_t *R = bench_cmalloc(tile);
+    for (size_t i = 0; i < tile; i++)
+        R[i] = 1.5*d->C0[i];
+    float resid = bench_cresid(CoreBlasGeneral, nb, nb, d->C, nb, R, nb);
+    free(R);
+    return resid;
+}
+
+// Sums of the moduli of the columns (sum = 0) or rows (sum = 1) of the
+// uplo part of A, with the moduli of the mirrored entries for herm.
+static void bench_cabs_sums(int sum, coreblas_enum_t uplo, int herm, int nb,
+                            const coreblas_complex32_t *A, float *s)
+{
+    for (int i = 0; i < nb; i++)
+        s[i] = 0.0;
+    for (int j = 0; j < nb; j++) {
+        for (int i = 0; i < nb; i++) {
+            int in = uplo == CoreBlasGeneral ||
+                     (uplo == CoreBlasLower ? i >= j : i <= j);
+            if (in) {
+                float a = cabsf(A[i + nb*j]);
+                s[sum ? i : j] += a;
+                if (herm && i != j)
+                    s[sum ? j : i] += a;
+            }
+        }
+    }
+}
+
+// Scaled error of the n values x against the reference r.
+static float bench_cvalues(int n, const float *x, const float *r, int nb)
+{
+    float err = 0.0;
+    float nrm = 0.0;
+    for (int i = 0; i < n; i++) {
+        err = fmax(err, fabsf(x[i] - r[i]));
+        nrm = fmax(nrm, fabsf(r[i]));
+    }
+    return bench_cscaled(err, nrm, nb);
+}
+
+static float bench_csums_check(bench_cdata_t *d, int sum,
+                                coreblas_enum_t uplo, int herm,
+                                const coreblas_complex32_t *A,
+                                const float *x, int max)
+{
+    int nb = d->nb;
+    float *s = (float*)bench_cmalloc(nb);
+    bench_cabs_sums(sum, uplo, herm, nb, A, s);
+    float r = 0.0;
+    for (int i = 0; i < nb; i++)
+        r = fmax(r, s[i]);
+    float resid = max ? bench_cvalues(1, x, &r, nb)
+                       : bench_cvalues(nb, x, s, nb);
+    free(s);
+    return resid;
+}
+
+static bench_resid_t bench_clange_one_check(void *data) {
+    bench_cdata_t *d = (bench_cdata_t*)data;
+    return bench_csums_check(d, 0, CoreBlasGeneral, 0, d->B0, d->value, 1);
+}
+
+static bench_resid_t bench_clange_inf_check(void *data) {
+    bench_cdata_t *d = (bench_cdata_t*)data;
+    return bench_csums_check(d, 1, CoreBlasGeneral, 0, d->B0, d->value, 1);
+}
+
+static bench_resid_t bench_clange_fro_check(void *data) {
+    BENCH_CHECK
+    float s = 0.0;
+    for (size_t i = 0; i < tile; i++)
+        s += cabsf(d->B0[i])*cabsf(d->B0[i]);
+    float r = sqrtf(s);
+    return bench_cvalues(1, d->value, &r, nb);
+}
+
+static bench_resid_t bench_clange_max_check(void *data) {
+    BENCH_CHECK
+    float r = 0.0;
+    for (size_t i = 0; i < tile; i++)
+        r = fmax(r, cabsf(d->B0[i]));
+    return bench_cvalues(1, d->value, &r, nb);
+}
+
+static bench_resid_t bench_clange_aux_one_check(void *data) {
+    bench_cdata_t *d = (bench_cdata_t*)data;
+    return bench_csums_check(d, 0, CoreBlasGeneral, 0, d->B0, d->dwork, 0);
+}
+
+static bench_resid_t bench_clange_aux_inf_check(void *data) {
+    bench_cdata_t *d = (bench_cdata_t*)data;
+    return bench_csums_check(d, 1, CoreBlasGeneral, 0, d->B0, d->dwork, 0);
+}
+
+static bench_resid_t bench_clantr_aux_inf_check(void *data) {
+    bench_cdata_t *d = (bench_cdata_t*)data;
+    return bench_csums_check(d, 1, CoreBlasUpper, 0, d->B0, d->dwork, 0);
+}
+
+// Column sums of the Hermitian (or symmetric) matrix of the lower triangle
+// of A0.
+static bench_resid_t bench_clansy_aux_check(void *data) {
+    bench_cdata_t *d = (bench_cdata_t*)data;
+    return bench_csums_check(d, 0, CoreBlasLower, 1, d->A0, d->dwork, 0);
+}
+
+static bench_resid_t bench_clansy_one_check(void *data) {
+    bench_cdata_t *d = (bench_cdata_t*)data;
+    return bench_csums_check(d, 0, CoreBlasLower, 1, d->A0, d->value, 1);
+}
+
+static bench_resid_t bench_clantr_one_check(void *data) {
+    bench_cdata_t *d = (bench_cdata_t*)data;
+    return bench_csums_check(d, 0, CoreBlasLower, 0, d->B0, d->value, 1);
+}
+
+// Scaled sum of squares (value[0], value[1]) of the uplo part of A,
+// with the mirrored entries for herm.
+static float bench_cssq_check(bench_cdata_t *d, coreblas_enum_t uplo,
+                               int herm, const coreblas_complex32_t *A)
+{
+    int nb = d->nb;
+    float s = 0.0;
+    for (int j = 0; j < nb; j++) {
+        for (int i = 0; i < nb; i++) {
+            int in = uplo == CoreBlasGeneral ||
+                     (uplo == CoreBlasLower ? i >= j : i <= j);
+            if (in) {
+                float a = cabsf(A[i + nb*j]);
+                s += (herm && i != j ? 2.0 : 1.0)*a*a;
+            }
+        }
+    }
+    float x = d->value[0]*d->value[0]*d->value[1];
+    return bench_cvalues(1, &x, &s, nb);
+}
+
+#ifdef COMPLEX
+static bench_resid_t bench_clanhe_one_check(void *data) {
+    return bench_clansy_one_check(data);
+}
+
+static bench_resid_t bench_clanhe_aux_check(void *data) {
+    return bench_clansy_aux_check(data);
+}
+
+static bench_resid_t bench_chessq_check(void *data) {
+    bench_cdata_t *d = (bench_cdata_t*)data;
+    return bench_cssq_check(d, CoreBlasLower, 1, d->A0);
+}
+#endif
+
+static bench_resid_t bench_cgessq_check(void *data) {
+    bench_cdata_t *d = (bench_cdata_t*)data;
+    return bench_cssq_check(d, CoreBlasGeneral, 0, d->B0);
+}
+
+static bench_resid_t bench_csyssq_check(void *data) {
+    bench_cdata_t *d = (bench_cdata_t*)data;
+    return bench_cssq_check(d, CoreBlasLower, 1, d->A0);
+}
+
+static bench_resid_t bench_ctrssq_check(void *data) {
+    bench_cdata_t *d = (bench_cdata_t*)data;
+    return bench_cssq_check(d, CoreBlasLower, 0, d->B0);
+}
+
+// The sum of the terms scale^2 sumsq, relative to the sum of their moduli,
+// as the partial results read from B0 may be negative.
+static bench_resid_t bench_creduce_ssq_check(void *data) {
+    BENCH_CHECK
+    const float *scale = (const float*)d->B0;
+    int n = nb*nb/2;
+    float s = 0.0;
+    float a = 0.0;
+    for (int i = 0; i < n; i++) {
+        s += scale[i]*scale[i]*scale[n+i];
+        a += fabsf(scale[i]*scale[i]*scale[n+i]);
+    }
+    float x = d->value[0]*d->value[0]*d->value[1];
+
+    // An infinite scale factor gives an infinite norm and not a NaN, also
+    // when two of them are merged by the tree.
+    const float iscale[3] = {1.0, INFINITY, 2.0};
+    const float isumsq[3] = {1.0, 1.0, 3.0};
+    float tscale[100], tsumsq[100];
+    for (int i = 0; i < 100; i++) {
+        tscale[i] = 1.0;
+        tsumsq[i] = 1.0;
+    }
+    tscale[0] = tscale[99] = INFINITY;
+    float iscl, isum, inorm, tscl, tsum;
+    coreblas_creduce_ssq(3, iscale, isumsq, &iscl, &isum);
+    coreblas_cgessq_aux(3, iscale, isumsq, &inorm);
+    coreblas_creduce_ssq(100, tscale, tsumsq, &tscl, &tsum);
+    if (!(isinf(iscl) && isum == 1.0 && isinf(inorm) &&
+          isinf(tscl) && tsum == 1.0))
+        return INFINITY;
+
+    return bench_cscaled(fabsf(x - s), a, nb);
+}
+
+// The largest of the column sums of the nb-by-nb partial sums read from B0.
+static bench_resid_t bench_creduce_one_check(void *data) {
+    BENCH_CHECK
+    const float *W = (const float*)d->B0;
+    float r = -INFINITY;
+    for (int j = 0; j < nb; j++) {
+        float s = 0.0;
+        for (int i = 0; i < nb; i++)
+            s += W[i + nb*j];
+        r = fmax(r, s);
+    }
+    return bench_cvalues(1, d->value, &r, nb);
+}
+
+//==============================================================================
+// Cholesky and triangular
+// L L^H = A0 on the lower triangle.
+static bench_resid_t bench_cpotrf_check(void *data) {
+    BENCH_CHECK
+    coreblas_complex32_t *L = bench_cmalloc(2*tile);
+    coreblas_complex32_t *X = &L[tile];
+    bench_ctri(CoreBlasLower, nb, d->A, nb, L, nb);
+    coreblas_cgemm(CoreBlasNoTrans, CoreBlas_ConjTrans, nb, nb, nb,
+                   zone, L, nb, L, nb, 0.0, X, nb);
+    float resid = bench_cresid(CoreBlasLower, nb, nb, X, nb, d->A0, nb);
+    free(L);
+    return resid;
+}
+
+// L0 inv(L0) = I.
+static bench_resid_t bench_ctrtri_check(void *data) {
+    BENCH_CHECK
+    coreblas_complex32_t *L = bench_cmalloc(4*tile);
+    coreblas_complex32_t *Y = &L[tile];
+    coreblas_complex32_t *X = &L[2*tile];
+    coreblas_complex32_t *E = &L[3*tile];
+    bench_ctri(CoreBlasLower, nb, d->A0, nb, L, nb);
+    bench_ctri(CoreBlasLower, nb, d->A, nb, Y, nb);
+    coreblas_cgemm(CoreBlasNoTrans, CoreBlasNoTrans, nb, nb, nb,
+                   zone, L, nb, Y, nb, 0.0, X, nb);
+    for (int j = 0; j < nb; j++)
+        for (int i = 0; i < nb; i++)
+            E[i + nb*j] = i == j ? 1.0 : 0.0;
+    float resid = bench_cresid(CoreBlasGeneral, nb, nb, X, nb, E, nb);
+    free(L);
+    return resid;
+}
+
+// L0^H L0 on the lower triangle.
+static bench_resid_t bench_clauum_check(void *data) {
+    BENCH_CHECK
+    coreblas_complex32_t *L = bench_cmalloc(2*tile);
+    coreblas_complex32_t *R = &L[tile];
+    bench_ctri(CoreBlasLower, nb, d->A0, nb, L, nb);
+    coreblas_cgemm(CoreBlas_ConjTrans, CoreBlasNoTrans, nb, nb, nb,
+                   zone, L, nb, L, nb, 0.0, R, nb);
+    float resid = bench_cresid(CoreBlasLower, nb, nb, d->A, nb, R, nb);
+    free(L);
+    return resid;
+}
+
+// L A L^H = A0 on the lower triangle, where A is Hermitian.
+static bench_resid_t bench_chegst_check(void *data) {
+    BENCH_CHECK
+    coreblas_complex32_t *L = bench_cmalloc(3*tile);
+    coreblas_complex32_t *F = &L[tile];
+    coreblas_complex32_t *X = &L[2*tile];
+    bench_ctri(CoreBlasLower, nb, d->L, nb, L, nb);
+    bench_cfull(1, nb, d->A, nb, F, nb);
+    coreblas_cgemm(CoreBlasNoTrans, CoreBlasNoTrans, nb, nb, nb,
+                   zone, L, nb, F, nb, 0.0, X, nb);
+    coreblas_cgemm(CoreBlasNoTrans, CoreBlas_ConjTrans, nb, nb, nb,
+                   zone, X, nb, L, nb, 0.0, F, nb);
+    float resid = bench_cresid(CoreBlasLower, nb, nb, F, nb, d->A0, nb);
+    free(L);
+    return resid;
+}
+
+//==============================================================================
+// LU
+// L U = P B0.
+static bench_resid_t bench_cgetrf_check(void *data) {
+    BENCH_CHECK
+    coreblas_complex32_t *L = bench_cmalloc(4*tile);
+    coreblas_complex32_t *U = &L[tile];
+    coreblas_complex32_t *X = &L[2*tile];
+    coreblas_complex32_t *R = &L[3*tile];
+    bench_ctri(CoreBlasLower, nb, d->B, nb, L, nb);
+    bench_ctri(CoreBlasUpper, nb, d->B, nb, U, nb);
+    for (int i = 0; i < nb; i++)
+        L[i + nb*i] = 1.0;
+    coreblas_cgemm(CoreBlasNoTrans, CoreBlasNoTrans, nb, nb, nb,
+                   zone, L, nb, U, nb, 0.0, X, nb);
+    memcpy(R, d->B0, tile*sizeof(coreblas_complex32_t));
+    bench_cpivot(nb, d->ipiv, R, nb);
+    float resid = bench_cresid(CoreBlasGeneral, nb, nb, X, nb, R, nb);
+    free(L);
+    return resid;
+}
+
+static bench_resid_t bench_cgetrf_calu_check(void *data) {
+    return bench_cgetrf_check(data);
+}
+
+// The first entry of B0 of largest |re| + |im| in column major order.
+static bench_resid_t bench_icamax_tile_check(void *data) {
+    BENCH_CHECK
+    float r = -1.0;
+    for (size_t i = 0; i < tile; i++) {
+        float a = fabsf(creal(d->B0[i])) + fabsf(cimag(d->B0[i]));
+        if (a > r)
+            r = a;
+    }
+    return d->value[0] == r ? 0.0 : INFINITY;
+}
+
+static bench_resid_t bench_cgeswp_check(void *data) {
+    BENCH_CHECK
+    coreblas_complex32_t *R = bench_cmalloc(tile);
+    memcpy(R, d->C0, tile*sizeof(coreblas_complex32_t));
+    bench_cpivot(nb, d->ipiv, R, nb);
+    float resid = bench_cresid(CoreBlasGeneral, nb, nb, d->C, nb, R, nb);
+    free(R);
+    return resid;
+}
+
+static bench_resid_t bench_cgeswp_blocked_check(void *data) {
+    return bench_cgeswp_check(data);
+}
+
+//==============================================================================
+// QR and LQ
+// Q R = B0, with R the upper triangle of B.
+static bench_resid_t bench_cgeqrt_check(void *data) {
+    BENCH_CHECK
+    coreblas_complex32_t *R = bench_cmalloc(tile);
+    bench_ctri(CoreBlasUpper, nb, d->B, nb, R, nb);
+    bench_cunm_ref(CoreBlasLeft, CoreBlasNoTrans, CoreBlasColumnwise,
+                   nb, nb, nb, ib, d->B, nb, d->T, ib, R, nb);
+    float resid = bench_cresid(CoreBlasGeneral, nb, nb, R, nb, d->B0, nb);
+    free(R);
+    return resid;
+}
+
+// L Q = B0, with L the lower triangle of B.
+static bench_resid_t bench_cgelqt_check(void *data) {
+    BENCH_CHECK
+    coreblas_complex32_t *L = bench_cmalloc(tile);
+    bench_ctri(CoreBlasLower, nb, d->B, nb, L, nb);
+    bench_cunm_ref(CoreBlasRight, CoreBlasNoTrans, CoreBlasRowwise,
+                   nb, nb, nb, ib, d->B, nb, d->T, ib, L, nb);
+    float resid = bench_cresid(CoreBlasGeneral, nb, nb, L, nb, d->B0, nb);
+    free(L);
+    return resid;
+}
+
+// Rebuilds the pair (A0, B0) factored into the triangle uplo of A and the
+// reflectors in B, and compares it on the triangle of A0 and on B0, or its
+// triangle uplo for the tt kernels.
+static float bench_cts_fact_check(bench_cdata_t *d, coreblas_enum_t side,
+                                   coreblas_enum_t direct,
+                                   coreblas_enum_t storev,
+                                   coreblas_enum_t uplo, int tri)
+{
+    int nb = d->nb;
+    size_t tile = (size_t)nb*nb;
+    coreblas_complex32_t *X1 = bench_cmalloc(2*tile);
+    coreblas_complex32_t *X2 = &X1[tile];
+    bench_ctri(uplo, nb, d->A, nb, X1, nb);
+    memset(X2, 0, tile*sizeof(coreblas_complex32_t));
+    bench_cts_ref(side, CoreBlasNoTrans, direct, storev, tri,
+                  nb, nb, X1, nb, nb, nb, X2, nb, nb, d->ib,
+                  d->B, nb, d->T, d->ib);
+    float resid1 = bench_cresid(uplo, nb, nb, X1, nb, d->A0, nb);
+    float resid2 = bench_cresid(tri ? uplo : CoreBlasGeneral, nb, nb,
+                                 X2, nb, d->B0, nb);
+    free(X1);
+    return fmax(resid1, resid2);
+}
+
+static bench_resid_t bench_ctsqrt_check(void *data) {
+    return bench_cts_fact_check((bench_cdata_t*)data, CoreBlasLeft,
+                                CoreBlasForward, CoreBlasColumnwise,
+                                CoreBlasUpper, 0);
+}
+
+static bench_resid_t bench_ctsqrt_rec_check(void *data) {
+    return bench_ctsqrt_check(data);
+}
+
+static bench_resid_t bench_ctslqt_check(void *data) {
+    return bench_cts_fact_check((bench_cdata_t*)data, CoreBlasRight,
+                                CoreBlasForward, CoreBlasRowwise,
+                                CoreBlasLower, 0);
+}
+
+static bench_resid_t bench_ctsqlt_check(void *data) {
+    return bench_cts_fact_check((bench_cdata_t*)data, CoreBlasLeft,
+                                CoreBlasBackward, CoreBlasColumnwise,
+                                CoreBlasLower, 0);
+}
+
+static bench_resid_t bench_ctsrqt_check(void *data) {
+    return bench_cts_fact_check((bench_cdata_t*)data, CoreBlasRight,
+                                CoreBlasBackward, CoreBlasRowwise,
+                                CoreBlasUpper, 0);
+}
+
+static bench_resid_t bench_cttqrt_check(void *data) {
+    return bench_cts_fact_check((bench_cdata_t*)data, CoreBlasLeft,
+                                CoreBlasForward, CoreBlasColumnwise,
+                                CoreBlasUpper, 1);
+}
+
+static bench_resid_t bench_cttqrt_rec_check(void *data) {
+    return bench_cttqrt_check(data);
+}
+
+static bench_resid_t bench_cttlqt_check(void *data) {
+    return bench_cts_fact_check((bench_cdata_t*)data, CoreBlasRight,
+                                CoreBlasForward, CoreBlasRowwise,
+                                CoreBlasLower, 1);
+}
+
+// op(Q) C0, with k reflectors of the geqrt or gelqt factorization.
+static float bench_cunm_check(bench_cdata_t *d, coreblas_enum_t storev,
+                               int k, const coreblas_complex32_t *V,
+                               const coreblas_complex32_t *T)
+{
+    int nb = d->nb;
+    size_t tile = (size_t)nb*nb;
+    coreblas_complex32_t *R = bench_cmalloc(tile);
+    memcpy(R, d->C0, tile*sizeof(coreblas_complex32_t));
+    bench_cunm_ref(CoreBlasLeft, CoreBlas_ConjTrans, storev,
+                   nb, nb, k, d->ib, V, nb, T, d->ib, R, nb);
+    float resid = bench_cresid(CoreBlasGeneral, nb, nb, d->C, nb, R, nb);
+    free(R);
+    return resid;
+}
+
+static bench_resid_t bench_cunmqr_check(void *data) {
+    bench_cdata_t *d = (bench_cdata_t*)data;
+    return bench_cunm_check(d, CoreBlasColumnwise, d->nb, d->Vqr, d->Tqr);
+}
+
+static bench_resid_t bench_cunmlq_check(void *data) {
+    bench_cdata_t *d = (bench_cdata_t*)data;
+    return bench_cunm_check(d, CoreBlasRowwise, d->nb, d->Vlq, d->Tlq);
+}
+
+// op(Q) applied to the first m1 rows of B0 over C0, compared with B and C.
+static float bench_cts_update_check(bench_cdata_t *d, int m1, int k,
+                                     coreblas_enum_t direct,
+                                     coreblas_enum_t storev, int tri,
+                                     const coreblas_complex32_t *V,
+                                     const coreblas_complex32_t *T,
+                                     const coreblas_complex32_t *B,
+                                     const coreblas_complex32_t *C)
+{
+    int nb = d->nb;
+    size_t tile = (size_t)nb*nb;
+    coreblas_complex32_t *R1 = bench_cmalloc(2*tile);
+    coreblas_complex32_t *R2 = &R1[tile];
+    memcpy(R1, d->B0, tile*sizeof(coreblas_complex32_t));
+    memcpy(R2, d->C0, tile*sizeof(coreblas_complex32_t));
+    bench_cts_ref(CoreBlasLeft, CoreBlas_ConjTrans, direct, storev, tri,
+                  m1, nb, R1, nb, nb, nb, R2, nb, k, d->ib, V, nb, T, d->ib);
+    float resid = fmax(
+        bench_cresid(CoreBlasGeneral, nb, nb, B, nb, R1, nb),
+        bench_cresid(CoreBlasGeneral, nb, nb, C, nb, R2, nb));
+    free(R1);
+    return resid;
+}
+
+static bench_resid_t bench_ctsmqr_check(void *data) {
+    bench_cdata_t *d = (bench_cdata_t*)data;
+    return bench_cts_update_check(d, d->nb, d->nb, CoreBlasForward,
+                                  CoreBlasColumnwise, 0, d->Vts, d->Tts,
+                                  d->B, d->C);
+}
+
+static bench_resid_t bench_ctsmlq_check(void *data) {
+    bench_cdata_t *d = (bench_cdata_t*)data;
+    return bench_cts_update_check(d, d->nb, d->nb, CoreBlasForward,
+                                  CoreBlasRowwise, 0, d->Vtsl, d->Ttsl,
+                                  d->B, d->C);
+}
+
+static bench_resid_t bench_ctsmql_check(void *data) {
+    bench_cdata_t *d = (bench_cdata_t*)data;
+    return bench_cts_update_check(d, d->nb, d->nb, CoreBlasBackward,
+                                  CoreBlasColumnwise, 0, d->Vtsb, d->Ttsb,
+                                  d->B, d->C);
+}
+
+static bench_resid_t bench_ctsmrq_check(void *data) {
+    bench_cdata_t *d = (bench_cdata_t*)data;
+    return bench_cts_update_check(d, d->nb, d->nb, CoreBlasBackward,
+                                  CoreBlasRowwise, 0, d->Vtsr, d->Ttsr,
+                                  d->B, d->C);
+}
+
+static bench_resid_t bench_cttmqr_check(void *data) {
+    bench_cdata_t *d = (bench_cdata_t*)data;
+    return bench_cts_update_check(d, d->nb, d->nb, CoreBlasForward,
+                                  CoreBlasColumnwise, 1, d->Vtt, d->Ttt,
+                                  d->B, d->C);
+}
+
+static bench_resid_t bench_cttmlq_check(void *data) {
+    bench_cdata_t *d = (bench_cdata_t*)data;
+    return bench_cts_update_check(d, d->nb, d->nb, CoreBlasForward,
+                                  CoreBlasRowwise, 1, d->Vttl, d->Tttl,
+                                  d->B, d->C);
+}
+
+static bench_resid_t bench_cparfb_check(void *data) {
+    bench_cdata_t *d = (bench_cdata_t*)data;
+    return bench_cts_update_check(d, d->ib, d->ib, CoreBlasForward,
+                                  CoreBlasColumnwise, 0, d->Vts, d->Tts,
+                                  d->B, d->C);
+}
+
+// W = B0(0:ib,:) + V(:,0:ib)^H C0.
+static bench_resid_t bench_cpamm_check(void *data) {
+    BENCH_CHECK
+    coreblas_complex32_t *R = bench_cmalloc((size_t)ib*nb);
+    coreblas_clacpy(CoreBlasGeneral, CoreBlasNoTrans, ib, nb,
+                    d->B0, nb, R, ib);
+    coreblas_cgemm(CoreBlas_ConjTrans, CoreBlasNoTrans, ib, nb, nb,
+                   zone, d->Vts, nb, d->C0, nb, zone, R, ib);
+    float resid = bench_cresid(CoreBlasGeneral, ib, nb, d->work, ib, R, ib);
+    free(R);
+    return resid;
+}
+
+// The first column of C0 + V^H B0.
+static bench_resid_t bench_cpemv_check(void *data) {
+    BENCH_CHECK
+    coreblas_complex32_t *r = bench_cmalloc(nb);
+    for (int j = 0; j < nb; j++) {
+        r[j] = d->C0[j];
+        for (int i = 0; i < nb; i++)
+            r[j] += conjf(d->Vts[i + nb*j])*d->B0[i];
+    }
+    float resid = bench_cresid(CoreBlasGeneral, nb, 1, d->C, nb, r, nb);
+    free(r);
+    return resid;
+}
+
+// Every side and trans for one storev/direct case, against LAPACKE larfb
+// with the same V and T.
+static float bench_clarfb_gemm_cases(bench_cdata_t *d,
+                                      coreblas_enum_t direct,
+                                      coreblas_enum_t storev,
+                                      const coreblas_complex32_t *V,
+                                      const coreblas_complex32_t *T,
+                                      int ldt)
+{
+    int nb = d->nb;
+    int ib = d->ib;
+    size_t tile = (size_t)nb*nb;
+    coreblas_enum_t sides[] = { CoreBlasLeft, CoreBlasRight };
+    coreblas_enum_t transs[] = { CoreBlasNoTrans, CoreBlas_ConjTrans };
+    coreblas_complex32_t *R = bench_cmalloc(tile);
+    float resid = 0.0;
+    for (int s = 0; s < 2; s++) {
+        for (int t = 0; t < 2; t++) {
+            memcpy(d->C, d->C0, tile*sizeof(coreblas_complex32_t));
+            memcpy(R, d->C0, tile*sizeof(coreblas_complex32_t));
+            coreblas_clarfb_gemm(sides[s], transs[t], direct, storev,
+                                 nb, nb, ib, V, nb, T, ldt,
+                                 d->C, nb, d->work, nb);
+            bench_clarfb(sides[s], transs[t], direct, storev,
+                         nb, nb, ib, V, nb, T, ldt, R, nb);
+            float r = bench_cresid(CoreBlasGeneral, nb, nb, d->C, nb, R, nb);
+            resid = r > resid ? r : resid;
+        }
+    }
+    free(R);
+    return resid;
+}
+
+static bench_resid_t bench_clarfb_gemm_check(void *data) {
+    bench_cdata_t *d = (bench_cdata_t*)data;
+    float resid = bench_cunm_check(d, CoreBlasColumnwise, d->ib,
+                                    d->Vqr, d->Tqr);
+    float rcases = bench_clarfb_gemm_cases(d, CoreBlasForward,
+                                            CoreBlasColumnwise,
+                                            d->Vqrx, d->Tqr, d->ib);
+    return rcases > resid ? rcases : resid;
+}
+
+static bench_resid_t bench_clarfb_gemm_rowfwd_check(void *data) {
+    bench_cdata_t *d = (bench_cdata_t*)data;
+    return bench_clarfb_gemm_cases(d, CoreBlasForward, CoreBlasRowwise,
+                                   d->Vlqx, d->Tlq, d->ib);
+}
+
+static bench_resid_t bench_clarfb_gemm_colbwd_check(void *data) {
+    bench_cdata_t *d = (bench_cdata_t*)data;
+    return bench_clarfb_gemm_cases(d, CoreBlasBackward, CoreBlasColumnwise,
+                                   d->Vcbx, d->B0, d->nb);
+}
+
+static bench_resid_t bench_clarfb_gemm_rowbwd_check(void *data) {
+    bench_cdata_t *d = (bench_cdata_t*)data;
+    return bench_clarfb_gemm_cases(d, CoreBlasBackward, CoreBlasRowwise,
+                                   d->Vrbx, d->B0, d->nb);
+}
+
+static bench_resid_t bench_clarft_check(void *data) {
+    BENCH_CHECK
+    coreblas_complex32_t *R = bench_cmalloc(tile);
+#ifdef COREBLAS_USE_64BIT_BLAS
+    LAPACKE_clarft_work64_(LAPACK_COL_MAJOR, 'F', 'C', nb, nb,
+                           d->Vqr, nb, d->tauqr, R, nb);
+#else
+    LAPACKE_clarft_work(LAPACK_COL_MAJOR, 'F', 'C', nb, nb,
+                        d->Vqr, nb, d->tauqr, R, nb);
+#endif
+    float resid = bench_cresid(CoreBlasUpper, nb, nb, d->C, nb, R, nb);
+    free(R);
+    return resid;
+}
+
+//==============================================================================
+// Batched kernels
+// The batch is not reset before the timed calls, which accumulate on it:
+// the checks reset it, repeat the call and compare every tile.
+static void bench_creset_batch(bench_cdata_t *d)
+{
+    size_t tile = (size_t)d->nb*d->nb;
+    for (int i = 0; i < d->batch; i++) {
+        memcpy(d->Abp[i], d->B0, tile*sizeof(coreblas_complex32_t));
+        memcpy(d->Cbp[i], d->C0, tile*sizeof(coreblas_complex32_t));
+        memcpy(d->Dbp[i], d->B0, tile*sizeof(coreblas_complex32_t));
+    }
+}
+
+static bench_resid_t bench_cgemm_batched_check(void *data) {
+    BENCH_CHECK
+    bench_creset_batch(d);
+    if (bench_cgemm_batched_call(data) != 0)
+        return INFINITY;
+    coreblas_complex32_t *R = bench_cmalloc(tile);
+    memcpy(R, d->C0, tile*sizeof(coreblas_complex32_t));
+    coreblas_cgemm(CoreBlasNoTrans, CoreBlasNoTrans, nb, nb, nb,
+                   zmone, d->B0, nb, d->B0, nb, zone, R, nb);
+    float resid = 0.0;
+    for (int i = 0; i < d->batch; i++) {
+        resid = fmax(resid, bench_cresid(CoreBlasGeneral, nb, nb,
+                                         d->Cbp[i], nb, R, nb));
+    }
+    free(R);
+    return resid;
+}
+
+static bench_resid_t bench_cgeqrt_batched_check(void *data) {
+    BENCH_CHECK
+    bench_creset_batch(d);
+    if (bench_cgeqrt_batched_call(data) != 0)
+        return INFINITY;
+    coreblas_complex32_t *R = bench_cmalloc(tile);
+    float resid = 0.0;
+    for (int i = 0; i < d->batch; i++) {
+        bench_ctri(CoreBlasUpper, nb, d->Abp[i], nb, R, nb);
+        bench_cunm_ref(CoreBlasLeft, CoreBlasNoTrans, CoreBlasColumnwise,
+                       nb, nb, nb, ib, d->Abp[i], nb, d->Tbp[i], ib, R, nb);
+        resid = fmax(resid, bench_cresid(CoreBlasGeneral, nb, nb,
+                                         R, nb, d->B0, nb));
+    }
+    free(R);
+    return resid;
+}
+
+static bench_resid_t bench_ctsmqr_batched_check(void *data) {
+    BENCH_CHECK
+    bench_creset_batch(d);
+    if (bench_ctsmqr_batched_call(data) != 0)
+        return INFINITY;
+    float resid = 0.0;
+    for (int i = 0; i < d->batch; i++) {
+        resid = fmax(resid, bench_cts_update_check(
+            d, nb, nb, CoreBlasForward, CoreBlasColumnwise, 0,
+            d->Vts, d->Tts, d->Dbp[i], d->Cbp[i]));
+    }
+    return resid;
+}
+
+static bench_resid_t bench_ctsmqr_row_check(void *data) {
+    BENCH_CHECK
+    bench_creset_batch(d);
+    if (bench_ctsmqr_row_call(data) != 0)
+        return INFINITY;
+    float resid = 0.0;
+    for (int i = 0; i < d->batch; i++) {
+        resid = fmax(resid, bench_cts_update_check(
+            d, nb, nb, CoreBlasForward, CoreBlasColumnwise, 0,
+            d->Vts, d->Tts, d->Dbp[i], d->Cbp[i]));
+    }
+    return resid;
+}
+
+//==============================================================================
+// Two-sided and band reductions
+// P A0 P^T on the lower triangle.
+static bench_resid_t bench_cheswp_check(void *data) {
+    BENCH_CHECK
+    coreblas_complex32_t *R = bench_cmalloc(tile);
+    memcpy(R, d->A0, tile*sizeof(coreblas_complex32_t));
+    for (int i = 0; i < nb; i++) {
+        int p = d->ipiv[i]-1;
+        for (int j = 0; p != i && j < nb; j++) {
+            coreblas_complex32_t x = R[i + nb*j];
+            R[i + nb*j] = R[p + nb*j];
+            R[p + nb*j] = x;
+        }
+        for (int j = 0; p != i && j < nb; j++) {
+            coreblas_complex32_t x = R[j + nb*i];
+            R[j + nb*i] = R[j + nb*p];
+            R[j + nb*p] = x;
+        }
+    }
+    float resid = bench_cresid(CoreBlasLower, nb, nb, d->A, nb, R, nb);
+    free(R);
+    return resid;
+}
+
+// Q^H A0 Q on the lower triangle.
+static bench_resid_t bench_cherfb_check(void *data) {
+    BENCH_CHECK
+    coreblas_complex32_t *R = bench_cmalloc(tile);
+    memcpy(R, d->A0, tile*sizeof(coreblas_complex32_t));
+    bench_cunm_ref(CoreBlasLeft, CoreBlas_ConjTrans, CoreBlasColumnwise,
+                   nb, nb, nb, ib, d->Vqr, nb, d->Tqr, ib, R, nb);
+    bench_cunm_ref(CoreBlasRight, CoreBlasNoTrans, CoreBlasColumnwise,
+                   nb, nb, nb, ib, d->Vqr, nb, d->Tqr, ib, R, nb);
+    float resid = bench_cresid(CoreBlasLower, nb, nb, d->A, nb, R, nb);
+    free(R);
+    return resid;
+}
+
+// The tsmqr update of (B0^H, C0), with B compared with the conjugate
+// transpose of the top tile.
+static bench_resid_t bench_ctsmqr_hetra1_check(void *data) {
+    BENCH_CHECK
+    coreblas_complex32_t *R1 = bench_cmalloc(3*tile);
+    coreblas_complex32_t *R2 = &R1[tile];
+    coreblas_complex32_t *X1 = &R1[2*tile];
+    for (int j = 0; j < nb; j++) {
+        for (int i = 0; i < nb; i++) {
+            R1[i + nb*j] = conjf(d->B0[j + nb*i]);
+            X1[i + nb*j] = conjf(d->B[j + nb*i]);
+        }
+    }
+    memcpy(R2, d->C0, tile*sizeof(coreblas_complex32_t));
+    bench_cts_ref(CoreBlasLeft, CoreBlas_ConjTrans, CoreBlasForward,
+                  CoreBlasColumnwise, 0, nb, nb, R1, nb, nb, nb, R2, nb,
+                  nb, ib, d->Vts, nb, d->Tts, ib);
+    float resid = fmax(
+        bench_cresid(CoreBlasGeneral, nb, nb, X1, nb, R1, nb),
+        bench_cresid(CoreBlasGeneral, nb, nb, d->C, nb, R2, nb));
+    free(R1);
+    return resid;
+}
+
+// Q^H M Q, where M is the Hermitian matrix of the lower triangles of A0 and
+// B0 on the diagonal and C0 below.
+static bench_resid_t bench_ctsmqr_corner_check(void *data) {
+    BENCH_CHECK
+    int n2 = 2*nb;
+    coreblas_complex32_t *M = bench_cmalloc(4*tile);
+    coreblas_complex32_t *F = bench_cmalloc(tile);
+    bench_cfull(1, nb, d->A0, nb, F, nb);
+    coreblas_clacpy(CoreBlasGeneral, CoreBlasNoTrans, nb, nb, F, nb, M, n2);
+    bench_cfull(1, nb, d->B0, nb, F, nb);
+    coreblas_clacpy(CoreBlasGeneral, CoreBlasNoTrans, nb, nb,
+                    F, nb, &M[nb + n2*nb], n2);
+    for (int j = 0; j < nb; j++) {
+        for (int i = 0; i < nb; i++) {
+            M[(nb+i) + n2*j] = d->C0[i + nb*j];
+            M[j + n2*(nb+i)] = conjf(d->C0[i + nb*j]);
+        }
+    }
+    bench_cts_ref(CoreBlasLeft, CoreBlas_ConjTrans, CoreBlasForward,
+                  CoreBlasColumnwise, 0, nb, n2, M, n2, nb, n2, &M[nb], n2,
+                  nb, ib, d->Vts, nb, d->Tts, ib);
+    bench_cts_ref(CoreBlasRight, CoreBlasNoTrans, CoreBlasForward,
+                  CoreBlasColumnwise, 0, n2, nb, M, n2, n2, nb, &M[n2*nb], n2,
+                  nb, ib, d->Vts, nb, d->Tts, ib);
+    float resid = fmax(fmax(
+        bench_cresid(CoreBlasLower, nb, nb, d->A, nb, M, n2),
+        bench_cresid(CoreBlasGeneral, nb, nb, d->C, nb, &M[nb], n2)),
+        bench_cresid(CoreBlasLower, nb, nb, d->B, nb, &M[nb + n2*nb], n2));
+    free(M);
+    free(F);
+    return resid;
+}
+
+// The chase is a unitary two-sided transformation of the band: it keeps the
+// Frobenius norms of the band and of its Gram matrix, and leaves the first
+// ncol columns and rows lower bidiagonal.
+static float bench_cband_check(bench_cdata_t *d,
+                                const coreblas_complex32_t *band, int ncol)
+{
+    int nb = d->nb;
+    coreblas_complex32_t *D = bench_cmalloc((size_t)nb*nb);
+    bench_cband_dense(d, band, D);
+    float off = 0.0;
+    for (int j = 0; j < nb; j++) {
+        for (int i = 0; i < nb; i++) {
+            if ((i < ncol || j < ncol) && i != j && i != j+1)
+                off += cabsf(D[i + nb*j])*cabsf(D[i + nb*j]);
+        }
+    }
+    free(D);
+    float fro, fro2;
+    bench_cband_norms(d, band, &fro, &fro2);
+    return fmax(fmax(
+        bench_cscaled(fabsf(fro - d->band_fro), d->band_fro, nb),
+        bench_cscaled(fabsf(fro2 - d->band_fro2), d->band_fro2, nb)),
+        bench_cscaled(sqrtf(off), d->band_fro, nb));
+}
+
+// A task leaves a part of its update to the next ones: the first sweep is
+// completed from the task t on before the check.
+static float bench_csweep_check(bench_cdata_t *d, int t)
+{
+    int ntask = coreblas_bulge_ntask(d->nb, d->bw, 0);
+    for (int s = t+1; s <= ntask; s++)
+        bench_cgbtype(d, s, d->band[t-1], d->vband[t-1]);
+    return bench_cband_check(d, d->band[t-1], 1);
+}
+
+static bench_resid_t bench_cgbtype1cb_check(void *data) {
+    return bench_csweep_check((bench_cdata_t*)data, 1);
+}
+
+static bench_resid_t bench_cgbtype2cb_check(void *data) {
+    return bench_csweep_check((bench_cdata_t*)data, 2);
+}
+
+static bench_resid_t bench_cgbtype3cb_check(void *data) {
+    return bench_csweep_check((bench_cdata_t*)data, 3);
+}
+
+static bench_resid_t bench_cgbbrd_static_check(void *data) {
+    bench_cdata_t *d = (bench_cdata_t*)data;
+    return bench_cband_check(d, d->band[3], d->nb);
+}
+
+/******************************************************************************/
+static bench_flops_t bench_cnone_flops(int nb, int ib)
+{
+    return 0.0;
+}
+
+#define BENCH_ROUTINE(name, flops, check) \
+    { #name, bench_##name##_call, flops, check }
+
+static const bench_routine_t bench_croutines[] = {
+    // Level 3 BLAS
+    BENCH_ROUTINE(cgemm,   bench_cgemm_flops, bench_cgemm_check),
+    BENCH_ROUTINE(cgemm_batched, bench_cgemm_batched_flops,
+                  bench_cgemm_batched_check),
+#ifdef COMPLEX
+    BENCH_ROUTINE(chemm,   bench_csymm_flops, bench_chemm_check),
+    BENCH_ROUTINE(cherk,   bench_csyrk_flops, bench_cherk_check),
+    BENCH_ROUTINE(cher2k,  bench_csyr2k_flops, bench_cher2k_check),
+#endif
+    BENCH_ROUTINE(csymm,   bench_csymm_flops, bench_csymm_check),
+    BENCH_ROUTINE(csyrk,   bench_csyrk_flops, bench_csyrk_check),
+    BENCH_ROUTINE(csyr2k,  bench_csyr2k_flops, bench_csyr2k_check),
+    BENCH_ROUTINE(ctrmm,   bench_ctrmm_flops, bench_ctrmm_check),
+    BENCH_ROUTINE(ctrsm,   bench_ctrsm_flops, bench_ctrsm_check),
+
+    // Auxiliary
+    BENCH_ROUTINE(cgeadd,  bench_cgeadd_flops, bench_cgeadd_check),
+    BENCH_ROUTINE(ctradd,  bench_ctradd_flops, bench_ctradd_check),
+    BENCH_ROUTINE(clacpy,  bench_cnone_flops, bench_clacpy_check),
+    BENCH_ROUTINE(clacpy_lapack2tile_band, bench_cnone_flops,
+                  bench_clacpy_check),
+    BENCH_ROUTINE(clacpy_tile2lapack_band, bench_cnone_flops,
+                  bench_clacpy_check),
+    BENCH_ROUTINE(claset,  bench_cnone_flops, bench_claset_check),
+    BENCH_ROUTINE(clascl,  bench_clascl_flops, bench_clascl_check),
+    BENCH_ROUTINE(clange_one, bench_cnorm_flops, bench_clange_one_check),
+    BENCH_ROUTINE(clange_inf, bench_cnorm_flops, bench_clange_inf_check),
+    BENCH_ROUTINE(clange_fro, bench_cnorm_flops, bench_clange_fro_check),
+    BENCH_ROUTINE(clange_max, bench_cnorm_flops, bench_clange_max_check),
+    BENCH_ROUTINE(clange_aux_one, bench_cnorm_flops,
+                  bench_clange_aux_one_check),
+    BENCH_ROUTINE(clange_aux_inf, bench_cnorm_flops,
+                  bench_clange_aux_inf_check),
+    BENCH_ROUTINE(clantr_aux_inf, bench_cnorm_flops,
+                  bench_clantr_aux_inf_check),
+    BENCH_ROUTINE(clansy_aux, bench_cnorm_flops, bench_clansy_aux_check),
+#ifdef COMPLEX
+    BENCH_ROUTINE(clanhe_one, bench_cnorm_flops, bench_clanhe_one_check),
+    BENCH_ROUTINE(clanhe_aux, bench_cnorm_flops, bench_clanhe_aux_check),
+    BENCH_ROUTINE(chessq,  bench_cnorm_flops, bench_chessq_check),
+#endif
+    BENCH_ROUTINE(clansy_one, bench_cnorm_flops, bench_clansy_one_check),
+    BENCH_ROUTINE(clantr_one, bench_cnorm_flops, bench_clantr_one_check),
+    BENCH_ROUTINE(cgessq,  bench_cnorm_flops, bench_cgessq_check),
+    BENCH_ROUTINE(csyssq,  bench_cnorm_flops, bench_csyssq_check),
+    BENCH_ROUTINE(ctrssq,  bench_cnorm_flops, bench_ctrssq_check),
+    BENCH_ROUTINE(creduce_ssq, bench_cnorm_flops, bench_creduce_ssq_check),
+    BENCH_ROUTINE(creduce_one, bench_cnorm_flops, bench_creduce_one_check),
+
+    // Cholesky and triangular
+    BENCH_ROUTINE(cpotrf,  bench_cpotrf_flops, bench_cpotrf_check),
+    BENCH_ROUTINE(ctrtri,  bench_ctrtri_flops, bench_ctrtri_check),
+    BENCH_ROUTINE(clauum,  bench_clauum_flops, bench_clauum_check),
+    BENCH_ROUTINE(chegst,  bench_chegst_flops, bench_chegst_check),
+
+    // LU
+    BENCH_ROUTINE(cgetrf,  bench_cgetrf_flops, bench_cgetrf_check),
+    BENCH_ROUTINE(cgetrf_calu, bench_cgetrf_flops, bench_cgetrf_calu_check),
+    BENCH_ROUTINE(icamax_tile, bench_cnorm_flops, bench_icamax_tile_check),
+    BENCH_ROUTINE(cgeswp,  bench_cnone_flops, bench_cgeswp_check),
+    BENCH_ROUTINE(cgeswp_blocked, bench_cnone_flops,
+                  bench_cgeswp_blocked_check),
+
+    // QR and LQ
+    BENCH_ROUTINE(cgeqrt,  bench_cgeqrt_flops, bench_cgeqrt_check),
+    BENCH_ROUTINE(cgeqrt_batched, bench_cgeqrt_batched_flops,
+                  bench_cgeqrt_batched_check),
+    BENCH_ROUTINE(cgelqt,  bench_cgelqt_flops, bench_cgelqt_check),
+    BENCH_ROUTINE(ctsqrt,  bench_ctsqrt_flops, bench_ctsqrt_check),
+    BENCH_ROUTINE(ctsqrt_rec, bench_ctsqrt_flops, bench_ctsqrt_rec_check),
+    BENCH_ROUTINE(ctslqt,  bench_ctsqrt_flops, bench_ctslqt_check),
+    BENCH_ROUTINE(ctsqlt,  bench_ctsqrt_flops, bench_ctsqlt_check),
+    BENCH_ROUTINE(ctsrqt,  bench_ctsqrt_flops, bench_ctsrqt_check),
+    BENCH_ROUTINE(cttqrt,  bench_cttqrt_flops, bench_cttqrt_check),
+    BENCH_ROUTINE(cttqrt_rec, bench_cttqrt_flops, bench_cttqrt_rec_check),
+    BENCH_ROUTINE(cttlqt,  bench_cttqrt_flops, bench_cttlqt_check),
+    BENCH_ROUTINE(cunmqr,  bench_cunmqr_flops, bench_cunmqr_check),
+    BENCH_ROUTINE(cunmlq,  bench_cunmqr_flops, bench_cunmlq_check),
+    BENCH_ROUTINE(ctsmqr,  bench_ctsmqr_flops, bench_ctsmqr_check),
+    BENCH_ROUTINE(ctsmqr_batched, bench_ctsmqr_batched_flops,
+                  bench_ctsmqr_batched_check),
+    BENCH_ROUTINE(ctsmqr_row, bench_ctsmqr_batched_flops,
+                  bench_ctsmqr_row_check),
+    BENCH_ROUTINE(ctsmlq,  bench_ctsmqr_flops, bench_ctsmlq_check),
+    BENCH_ROUTINE(ctsmql,  bench_ctsmqr_flops, bench_ctsmql_check),
+    BENCH_ROUTINE(ctsmrq,  bench_ctsmqr_flops, bench_ctsmrq_check),
+    BENCH_ROUTINE(cttmqr,  bench_cttmqr_flops, bench_cttmqr_check),
+    BENCH_ROUTINE(cttmlq,  bench_cttmqr_flops, bench_cttmlq_check),
+    BENCH_ROUTINE(cparfb,  bench_cparfb_flops, bench_cparfb_check),
+    BENCH_ROUTINE(cpamm,   bench_cpamm_flops, bench_cpamm_check),
+    BENCH_ROUTINE(cpemv,   bench_cpemv_flops, bench_cpemv_check),
+    BENCH_ROUTINE(clarfb_gemm, bench_clarfb_gemm_flops,
+                  bench_clarfb_gemm_check),
+    BENCH_ROUTINE(clarfb_gemm_rowfwd, bench_clarfb_gemm_flops,
+                  bench_clarfb_gemm_rowfwd_check),
+    BENCH_ROUTINE(clarfb_gemm_colbwd, bench_clarfb_gemm_flops,
+                  bench_clarfb_gemm_colbwd_check),
+    BENCH_ROUTINE(clarfb_gemm_rowbwd, bench_clarfb_gemm_flops,
+                  bench_clarfb_gemm_rowbwd_check),
+    BENCH_ROUTINE(clarft,  bench_clarft_flops, bench_clarft_check),
+
+    // Two-sided and band reductions
+    BENCH_ROUTINE(cheswp,  bench_cnone_flops, bench_cheswp_check),
+    BENCH_ROUTINE(cherfb,  bench_cherfb_flops, bench_cherfb_check),
+    BENCH_ROUTINE(ctsmqr_hetra1, bench_ctsmqr_flops,
+                  bench_ctsmqr_hetra1_check),
+    BENCH_ROUTINE(ctsmqr_corner, bench_ctsmqr_corner_flops,
+                  bench_ctsmqr_corner_check),
+    BENCH_ROUTINE(cgbtype1cb, bench_cnone_flops, bench_cgbtype1cb_check),
+    BENCH_ROUTINE(cgbtype2cb, bench_cnone_flops, bench_cgbtype2cb_check),
+    BENCH_ROUTINE(cgbtype3cb, bench_cnone_flops, bench_cgbtype3cb_check),
+    BENCH_ROUTINE(cgbbrd_static, bench_cnone_flops,
+                  bench_cgbbrd_static_check),
+
+    { NULL, NULL, NULL, NULL }
+};
+
+/******************************************************************************/
+const bench_precision_t bench_c = {
+    bench_croutines,
+    bench_ccreate,
+    bench_creset,
+    bench_cdestroy,
+};
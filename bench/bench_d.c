@@ -0,0 +1,2611 @@
+/**
+ *
+ * @file
+ *
+ *  COREBLAS is a software package provided by:
+ *  University of Tennessee, US,
+ *  University of Manchester, UK.
+ *
+ * @generated from bench/bench_z.c, normal z -> d, Fri Oct 16 03:37:07 2026
+ *
+ **/
+
+#include "bench.h"
+#include "flops.h"
+
+#include <coreblas.h>
+#include "core_lapack.h"
+#include "bulge.h"
+
+#include <math.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#define REAL
+
+/***************************************************************************//**
+ *  Tiles shared by all kernels of one precision. All tiles are nb-by-nb with
+ *  leading dimension nb; X0 are pristine copies the working tiles are reset
+ *  from before every timed call.
+ **/
+typedef struct {
+    int nb;
+    int ib;
+
+    double *A;   ///< symmetric positive definite
+    double *B;
+    double *C;
+    double *A0;
+    double *B0;
+    double *C0;
+    double *L;   ///< Cholesky factor of A0
+
+    // Reflectors and T factors produced once by the factorization kernels
+    // and consumed by the update kernels.
+    double *Vqr,  *Tqr;
+    double *Vqrx;   ///< Vqr with its unit triangle explicit
+    double *Vlqx;   ///< Vlq with its unit triangle explicit
+    double *Vcbx, *Vrbx;   ///< explicit backward V of larfb_gemm
+    double *Vlq,  *Tlq;
+    double *Vts,  *Tts;
+    double *Vtt,  *Ttt;
+    double *Vtsl, *Ttsl;
+    double *Vttl, *Tttl;
+    double *Vtsb, *Ttsb;
+    double *Vtsr, *Ttsr;
+
+    double *T;
+    double *tau;
+    double *tauqr;   ///< scalar factors of Vqr
+    int *ipiv;   ///< pivots of the LU factorization of B0
+    double *wcalu;
+    int *iwcalu;
+    int *iwork;
+    double *work;
+    double *dwork;
+    double value[2];
+
+    // Batch of independent tiles for the batched kernels.
+    int batch;
+    double *Ab, *Cb, *Db, *Tb;
+    double **Abp, **Cbp, **Dbp, **Tbp;
+    const double **Vp, **Tp;
+    coreblas_workspace_t wbatch;
+
+    // Lower band of order nb and width bw for the bulge chasing kernels, in
+    // the (3*bw+1)-by-nb storage of the gbtype kernels, with the reflectors
+    // VQ, TAUQ, VP, TAUP of length 2*nb each in vband. Copy i < 3 is worked
+    // on by task i+1 of the first sweep and reset from band0[i], vband0[i]:
+    // the band, the band after task 1, and after task 2. Copy 3 is worked on
+    // by gbbrd_static and reset from the band.
+    int bw;
+    int ldband;
+    double *band[4], *vband[4];
+    double *band0[3], *vband0[3];
+    int *iwband;
+    double band_fro;   ///< Frobenius norm of the band
+    double band_fro2;  ///< Frobenius norm of its Gram matrix
+} bench_ddata_t;
+
+/******************************************************************************/
+// Number of tiles of the batched kernels, about 256K elements per batch.
+static int bench_dbatch(int nb)
+{
+    int batch = (1 << 18)/(nb*nb);
+    return batch > 1 ? batch : 1;
+}
+
+/******************************************************************************/
+static bench_flops_t bench_dflops(bench_flops_t fmuls, bench_flops_t fadds)
+{
+#ifdef COMPLEX
+    return 6.0*fmuls + 2.0*fadds;
+#else
+    return fmuls + fadds;
+#endif
+}
+
+/******************************************************************************/
+static double bench_drand(unsigned long long *seed)
+{
+    // 64-bit linear congruential generator, uniform in [-0.5, 0.5)
+    *seed = *seed*6364136223846793005ULL + 1442695040888963407ULL;
+    return (double)(*seed >> 11)/9007199254740992.0 - 0.5;
+}
+
+/******************************************************************************/
+static void bench_dfill(int m, int n, double *A, int lda,
+                        unsigned long long *seed)
+{
+    for (int j = 0; j < n; j++) {
+        for (int i = 0; i < m; i++) {
+#ifdef COMPLEX
+            double re = bench_drand(seed);
+            double im = bench_drand(seed);
+            A[i + lda*j] = re + im*_Complex_I;
+#else
+            A[i + lda*j] = bench_drand(seed);
+#endif
+        }
+    }
+}
+
+/******************************************************************************/
+// LU factorization of one nb-by-nb tile by a single panel thread.
+static int bench_dgetrf_tile(double *A, int nb, int ib,
+                             int *ipiv)
+{
+    coreblas_desc_t desc;
+    coreblas_desc_general_init(CoreBlasRealDouble, A, nb, nb,
+                               nb, nb, 0, 0, nb, nb, &desc);
+
+    volatile int max_idx;
+    volatile double max_val;
+    volatile int info = 0;
+    coreblas_barrier_t barrier;
+    coreblas_barrier_init(&barrier);
+
+    coreblas_dgetrf(desc, ipiv, ib, 0, 1,
+                    &max_idx, &max_val, &info, &barrier);
+    return info;
+}
+
+/*******************************************************************************
+ *  References for the checks, computed with unblocked loops or with the
+ *  BLAS and LAPACK routines the kernels are meant to match.
+ **/
+static double *bench_dmalloc(size_t size)
+{
+    double *A = (double*)malloc(
+        (size > 0 ? size : 1)*sizeof(double));
+    if (A == NULL) {
+        fprintf(stderr, "allocation failed in the check\n");
+        exit(EXIT_FAILURE);
+    }
+    return A;
+}
+
+/******************************************************************************/
+// Error relative to the reference, in units of nb times the machine epsilon.
+static double bench_dscaled(double err, double nrm, int nb)
+{
+    double eps = LAPACKE_dlamch_work('e');
+    return err/(nrm > 0.0 ? nrm : 1.0)/(nb*eps);
+}
+
+/******************************************************************************/
+// Scaled Frobenius norm error of the uplo part of the m-by-n matrix X
+// against the reference R.
+static double bench_dresid(coreblas_enum_t uplo, int m, int n,
+                           const double *X, int ldx,
+                           const double *R, int ldr)
+{
+    double err = 0.0;
+    double nrm = 0.0;
+    for (int j = 0; j < n; j++) {
+        int ifirst = uplo == CoreBlasLower ? j : 0;
+        int ilast  = uplo == CoreBlasUpper && j+1 < m ? j+1 : m;
+        for (int i = ifirst; i < ilast; i++) {
+            double e = fabs(X[i + (size_t)ldx*j] - R[i + (size_t)ldr*j]);
+            double r = fabs(R[i + (size_t)ldr*j]);
+            err += e*e;
+            nrm += r*r;
+        }
+    }
+    return bench_dscaled(sqrt(err), sqrt(nrm), m > n ? m : n);
+}
+
+/******************************************************************************/
+// B = the uplo triangle of A, zero elsewhere.
+static void bench_dtri(coreblas_enum_t uplo, int n,
+                       const double *A, int lda,
+                       double *B, int ldb)
+{
+    for (int j = 0; j < n; j++) {
+        for (int i = 0; i < n; i++) {
+            int in = uplo == CoreBlasLower ? i >= j : i <= j;
+            B[i + (size_t)ldb*j] = in ? A[i + (size_t)lda*j] : 0.0;
+        }
+    }
+}
+
+/******************************************************************************/
+// B = the full matrix of which A holds the lower triangle, symmetric if herm
+// and symmetric otherwise; the diagonal is copied as is.
+static void bench_dfull(int herm, int n,
+                        const double *A, int lda,
+                        double *B, int ldb)
+{
+    for (int j = 0; j < n; j++) {
+        B[j + (size_t)ldb*j] = A[j + (size_t)lda*j];
+        for (int i = j+1; i < n; i++) {
+            double a = A[i + (size_t)lda*j];
+            B[i + (size_t)ldb*j] = a;
+            B[j + (size_t)ldb*i] = herm ? (a) : a;
+        }
+    }
+}
+
+/******************************************************************************/
+// Applies the row interchanges of the 1-based pivots ipiv to the n rows of X.
+static void bench_dpivot(int n, const int *ipiv,
+                         double *X, int ldx)
+{
+    for (int i = 0; i < n; i++) {
+        int p = ipiv[i]-1;
+        for (int j = 0; p != i && j < n; j++) {
+            double x = X[i + (size_t)ldx*j];
+            X[i + (size_t)ldx*j] = X[p + (size_t)ldx*j];
+            X[p + (size_t)ldx*j] = x;
+        }
+    }
+}
+
+/******************************************************************************/
+static void bench_dlarfb(coreblas_enum_t side, coreblas_enum_t trans,
+                         coreblas_enum_t direct, coreblas_enum_t storev,
+                         int m, int n, int k,
+                         const double *V, int ldv,
+                         const double *T, int ldt,
+                               double *C, int ldc)
+{
+    int ldwork = side == CoreBlasLeft ? n : m;
+    double *work = bench_dmalloc((size_t)ldwork*k);
+#ifdef COREBLAS_USE_64BIT_BLAS
+    LAPACKE_dlarfb_work64_(LAPACK_COL_MAJOR,
+                           lapack_const(side), lapack_const(trans),
+                           lapack_const(direct), lapack_const(storev),
+                           m, n, k, V, ldv, T, ldt, C, ldc, work, ldwork);
+#else
+    LAPACKE_dlarfb_work(LAPACK_COL_MAJOR,
+                        lapack_const(side), lapack_const(trans),
+                        lapack_const(direct), lapack_const(storev),
+                        m, n, k, V, ldv, T, ldt, C, ldc, work, ldwork);
+#endif
+    free(work);
+}
+
+/******************************************************************************/
+// V = the k reflectors of order n in A, columnwise (n-by-k) or rowwise
+// (k-by-n), with the unit triangle of larfb_gemm stored explicitly: in the
+// first k positions for forward and in the last k for backward reflectors.
+static void bench_dlarfb_v(coreblas_enum_t direct, coreblas_enum_t storev,
+                           int n, int k,
+                           const double *A, int lda,
+                                 double *V, int ldv)
+{
+    int col = storev == CoreBlasColumnwise;
+    int off = direct == CoreBlasForward ? 0 : n-k;
+    for (int q = 0; q < k; q++) {
+        for (int p = 0; p < n; p++) {
+            size_t ij = col ? p + (size_t)ldv*q : q + (size_t)ldv*p;
+            int r = p-off;
+            V[ij] = A[col ? p + (size_t)lda*q : q + (size_t)lda*p];
+            if (r == q)
+                V[ij] = 1.0;
+            else if (r >= 0 && r < k &&
+                     (direct == CoreBlasForward ? r < q : r > q))
+                V[ij] = 0.0;
+        }
+    }
+}
+
+/******************************************************************************/
+// Order of the blocks of reflectors applied by op(Q), as in LAPACK: with
+// rowwise storage, op is swapped, since LAPACK applies the reflectors of
+// an LQ factorization with the transposed block reflector.
+static int bench_dascending(coreblas_enum_t side, coreblas_enum_t transt,
+                            coreblas_enum_t direct)
+{
+    int left = side == CoreBlasLeft;
+    int notran = transt == CoreBlasNoTrans;
+    return direct == CoreBlasForward ? left != notran : left == notran;
+}
+
+static coreblas_enum_t bench_dtranst(coreblas_enum_t trans,
+                                     coreblas_enum_t storev)
+{
+    if (storev == CoreBlasColumnwise)
+        return trans;
+    return trans == CoreBlasNoTrans ? CoreBlasTrans : CoreBlasNoTrans;
+}
+
+/******************************************************************************/
+// C = op(Q) C or C op(Q), where Q is given by the k forward reflectors of a
+// geqrt (columnwise) or gelqt (rowwise) factorization with blocking ib.
+static void bench_dunm_ref(coreblas_enum_t side, coreblas_enum_t trans,
+                           coreblas_enum_t storev, int m, int n, int k,
+                           int ib,
+                           const double *V, int ldv,
+                           const double *T, int ldt,
+                                 double *C, int ldc)
+{
+    int left = side == CoreBlasLeft;
+    coreblas_enum_t transt = bench_dtranst(trans, storev);
+    int ascend = bench_dascending(side, transt, CoreBlasForward);
+    int nblk = (k+ib-1)/ib;
+    for (int b = 0; b < nblk; b++) {
+        int i = (ascend ? b : nblk-1-b)*ib;
+        int kb = k-i < ib ? k-i : ib;
+        bench_dlarfb(side, transt, CoreBlasForward, storev,
+                     left ? m-i : m, left ? n : n-i, kb,
+                     &V[i + (size_t)ldv*i], ldv, &T[(size_t)ldt*i], ldt,
+                     left ? &C[i] : &C[(size_t)ldc*i], ldc);
+    }
+}
+
+/******************************************************************************/
+// Element r of the stack of the kb rows (left) or columns (right) of A1
+// starting at i1 and the whole A2, in the order (A1; A2) for forward and
+// (A2; A1) for backward reflectors; c indexes the other dimension.
+static double *bench_dstack(int left, int forward, int kb,
+                                          int p2, int i1, int r, int c,
+                                          double *A1, int lda1,
+                                          double *A2, int lda2)
+{
+    int r1 = forward ? r : r-p2;
+    int r2 = forward ? r-kb : r;
+    if (r1 >= 0 && r1 < kb) {
+        return left ? &A1[(i1+r1) + (size_t)lda1*c]
+                    : &A1[c + (size_t)lda1*(i1+r1)];
+    }
+    return left ? &A2[r2 + (size_t)lda2*c] : &A2[c + (size_t)lda2*r2];
+}
+
+/******************************************************************************/
+// Applies op(Q) from the side to the pair (A1, A2), where Q is given by the
+// k reflectors of a ts (tri = 0) or tt (tri = 1) factorization with
+// blocking ib, stored in V and T as the factorization kernels leave them.
+// Each block is applied by larfb on an explicit copy of the stacked rows
+// or columns, with the unit part of the reflectors made explicit.
+static void bench_dts_ref(coreblas_enum_t side, coreblas_enum_t trans,
+                          coreblas_enum_t direct, coreblas_enum_t storev,
+                          int tri,
+                          int m1, int n1, double *A1, int lda1,
+                          int m2, int n2, double *A2, int lda2,
+                          int k, int ib,
+                          const double *V, int ldv,
+                          const double *T, int ldt)
+{
+    int left = side == CoreBlasLeft;
+    int forward = direct == CoreBlasForward;
+    int colwise = storev == CoreBlasColumnwise;
+    coreblas_enum_t transt = bench_dtranst(trans, storev);
+    int ascend = bench_dascending(side, transt, direct);
+    int p2 = left ? m2 : n2;
+    int q  = left ? n1 : m1;
+    int off = forward ? 0 : (left ? m1 : n1) - k;
+
+    double *S  = bench_dmalloc((size_t)(ib+p2)*q);
+    double *Vb = bench_dmalloc((size_t)(ib+p2)*ib);
+    int nblk = (k+ib-1)/ib;
+    for (int b = 0; b < nblk; b++) {
+        int i = (ascend ? b : nblk-1-b)*ib;
+        int kb = k-i < ib ? k-i : ib;
+        int ls = kb + p2;
+        int lds = left ? ls : q;
+        int ldvb = colwise ? ls : kb;
+        for (int r = 0; r < ls; r++) {
+            for (int c = 0; c < q; c++) {
+                double *a = bench_dstack(
+                    left, forward, kb, p2, off+i, r, c, A1, lda1, A2, lda2);
+                S[left ? r + (size_t)lds*c : c + (size_t)lds*r] = *a;
+            }
+            for (int c = 0; c < kb; c++) {
+                int r1 = forward ? r : r-p2;
+                int r2 = forward ? r-kb : r;
+                double v;
+                if (r1 >= 0 && r1 < kb)
+                    v = r1 == c ? 1.0 : 0.0;
+                else if (tri && r2 > i+c)
+                    v = 0.0;
+                else
+                    v = colwise ? V[r2 + (size_t)ldv*(i+c)]
+                                : V[(i+c) + (size_t)ldv*r2];
+                Vb[colwise ? r + (size_t)ldvb*c : c + (size_t)ldvb*r] = v;
+            }
+        }
+        bench_dlarfb(side, transt, direct, storev,
+                     left ? ls : q, left ? q : ls, kb,
+                     Vb, ldvb, &T[(size_t)ldt*i], ldt, S, lds);
+        for (int r = 0; r < ls; r++) {
+            for (int c = 0; c < q; c++) {
+                double *a = bench_dstack(
+                    left, forward, kb, p2, off+i, r, c, A1, lda1, A2, lda2);
+                *a = S[left ? r + (size_t)lds*c : c + (size_t)lds*r];
+            }
+        }
+    }
+    free(S);
+    free(Vb);
+}
+
+/******************************************************************************/
+// Task t of the first sweep of the chase of the band of the data.
+static void bench_dgbtype(bench_ddata_t *d, int t,
+                          double *band,
+                          double *vband)
+{
+    int nb = d->nb;
+    int st, ed;
+    coreblas_bulge_task(nb, d->bw, 0, t, &st, &ed);
+    double *VQ = vband;
+    double *TAUQ = &vband[2*nb];
+    double *VP = &vband[4*nb];
+    double *TAUP = &vband[6*nb];
+    if (t == 1) {
+        coreblas_dgbtype1cb(CoreBlasLower, nb, d->bw, band, d->ldband,
+                            VQ, TAUQ, VP, TAUP, st, ed, 0, 1, 0, d->work);
+    }
+    else if (t%2 == 0) {
+        coreblas_dgbtype2cb(CoreBlasLower, nb, d->bw, band, d->ldband,
+                            VQ, TAUQ, VP, TAUP, st, ed, 0, 1, 0, d->work);
+    }
+    else {
+        coreblas_dgbtype3cb(CoreBlasLower, nb, d->bw, band, d->ldband,
+                            VQ, TAUQ, VP, TAUP, st, ed, 0, 1, 0, d->work);
+    }
+}
+
+/******************************************************************************/
+// Expands the band storage into the dense nb-by-nb D.
+static void bench_dband_dense(const bench_ddata_t *d,
+                              const double *band,
+                              double *D)
+{
+    int nb = d->nb;
+    int bw = d->bw;
+    for (int j = 0; j < nb; j++) {
+        for (int i = 0; i < nb; i++) {
+            int r = bw + i - j;
+            D[i + (size_t)nb*j] = r >= 0 && r < d->ldband
+                                ? band[r + (size_t)d->ldband*j] : 0.0;
+        }
+    }
+}
+
+/******************************************************************************/
+// Unitary invariants of the band: the Frobenius norms of D and of D^T D.
+static void bench_dband_norms(const bench_ddata_t *d,
+                              const double *band,
+                              double *fro, double *fro2)
+{
+    int nb = d->nb;
+    double *D = bench_dmalloc(2*(size_t)nb*nb);
+    double *G = &D[(size_t)nb*nb];
+    bench_dband_dense(d, band, D);
+    coreblas_dgemm(CoreBlasTrans, CoreBlasNoTrans, nb, nb, nb,
+                   1.0, D, nb, D, nb, 0.0, G, nb);
+    double s = 0.0;
+    double s2 = 0.0;
+    for (size_t i = 0; i < (size_t)nb*nb; i++) {
+        s  += fabs(D[i])*fabs(D[i]);
+        s2 += fabs(G[i])*fabs(G[i]);
+    }
+    *fro = sqrt(s);
+    *fro2 = sqrt(s2);
+    free(D);
+}
+
+/******************************************************************************/
+static void *bench_dcreate(int nb, int ib)
+{
+    bench_ddata_t *d = (bench_ddata_t*)calloc(1, sizeof(bench_ddata_t));
+    if (d == NULL)
+        return NULL;
+
+    size_t tile = (size_t)nb*nb;
+    d->nb = nb;
+    d->ib = ib;
+
+    double **tiles[] = {
+        &d->A, &d->B, &d->C, &d->A0, &d->B0, &d->C0, &d->L,
+        &d->Vqr, &d->Vlq, &d->Vts, &d->Vtt, &d->Vtsl, &d->Vttl,
+        &d->Vtsb, &d->Vtsr, &d->Vqrx, &d->Vlqx, &d->Vcbx, &d->Vrbx,
+    };
+    double **tfactors[] = {
+        &d->Tqr, &d->Tlq, &d->Tts, &d->Ttt, &d->Ttsl, &d->Tttl, &d->T,
+        &d->Ttsb, &d->Ttsr,
+    };
+    int ok = 1;
+    for (size_t i = 0; i < sizeof(tiles)/sizeof(tiles[0]); i++) {
+        *tiles[i] = (double*)malloc(
+            tile*sizeof(double));
+        ok = ok && *tiles[i] != NULL;
+    }
+    for (size_t i = 0; i < sizeof(tfactors)/sizeof(tfactors[0]); i++) {
+        *tfactors[i] = (double*)calloc(
+            (size_t)ib*nb, sizeof(double));
+        ok = ok && *tfactors[i] != NULL;
+    }
+    d->tau   = (double*)malloc(
+        (size_t)nb*sizeof(double));
+    d->tauqr = (double*)malloc(
+        (size_t)nb*sizeof(double));
+    d->work  = (double*)malloc(
+        4*tile*sizeof(double));
+    d->dwork = (double*)malloc(2*(size_t)nb*sizeof(double));
+    d->ipiv  = (int*)malloc((size_t)nb*sizeof(int));
+
+    coreblas_desc_t panel;
+    coreblas_desc_general_init(CoreBlasRealDouble, d->B, nb, nb,
+                               nb, nb, 0, 0, nb, nb, &panel);
+    d->wcalu  = (double*)malloc(
+        coreblas_dgetrf_calu_lwork(panel, 1)*sizeof(double));
+    d->iwcalu = (int*)malloc(coreblas_dgetrf_calu_liwork(panel, 1)*sizeof(int));
+    d->iwork  = (int*)malloc(
+        coreblas_dgeswp_blocked_liwork(1, nb)*sizeof(int));
+
+    int batch = bench_dbatch(nb);
+    d->batch = batch;
+    d->Ab  = (double*)malloc(
+        batch*tile*sizeof(double));
+    d->Cb  = (double*)malloc(
+        batch*tile*sizeof(double));
+    d->Db  = (double*)malloc(
+        batch*tile*sizeof(double));
+    d->Tb  = (double*)calloc(
+        batch*(size_t)ib*nb, sizeof(double));
+    d->Abp = (double**)malloc(
+        batch*sizeof(double*));
+    d->Cbp = (double**)malloc(
+        batch*sizeof(double*));
+    d->Dbp = (double**)malloc(
+        batch*sizeof(double*));
+    d->Tbp = (double**)malloc(
+        batch*sizeof(double*));
+    d->Vp  = (const double**)malloc(
+        batch*sizeof(double*));
+    d->Tp  = (const double**)malloc(
+        batch*sizeof(double*));
+    size_t lwbatch = coreblas_dgeqrt_batched_lwork(nb, nb, ib);
+    size_t lwtsmqr = coreblas_dtsmqr_lwork(CoreBlasLeft, nb, nb, ib);
+    int wbatch = coreblas_workspace_create(
+        &d->wbatch, lwbatch > lwtsmqr ? lwbatch : lwtsmqr,
+        CoreBlasRealDouble);
+
+    // Task 3 of the first sweep exists from nb = bw+3 on.
+    int bw = nb-3 < ib ? nb-3 : ib;
+    bw = bw > 1 ? bw : 1;
+    d->bw = bw;
+    d->ldband = 3*bw+1;
+    size_t lband = (size_t)d->ldband*nb;
+    for (int i = 0; i < 4; i++) {
+        d->band[i]  = (double*)calloc(
+            lband, sizeof(double));
+        d->vband[i] = (double*)calloc(
+            8*(size_t)nb, sizeof(double));
+        ok = ok && d->band[i] != NULL && d->vband[i] != NULL;
+    }
+    for (int i = 0; i < 3; i++) {
+        d->band0[i]  = (double*)calloc(
+            lband, sizeof(double));
+        d->vband0[i] = (double*)calloc(
+            8*(size_t)nb, sizeof(double));
+        ok = ok && d->band0[i] != NULL && d->vband0[i] != NULL;
+    }
+    d->iwband = (int*)malloc(
+        coreblas_dgbbrd_static_liwork(nb, bw)*sizeof(int));
+
+    if (!ok || d->tau == NULL || d->tauqr == NULL || d->work == NULL ||
+        d->dwork == NULL ||
+        d->ipiv == NULL || d->wcalu == NULL || d->iwcalu == NULL ||
+        d->iwork == NULL || d->Ab == NULL || d->Cb == NULL ||
+        d->Db == NULL || d->Tb == NULL || d->Abp == NULL ||
+        d->Cbp == NULL || d->Dbp == NULL || d->Tbp == NULL ||
+        d->Vp == NULL || d->Tp == NULL || d->iwband == NULL ||
+        wbatch != CoreBlasSuccess) {
+        bench_d.destroy(d);
+        return NULL;
+    }
+
+    unsigned long long seed = 42;
+    bench_dfill(nb, nb, d->A0, nb, &seed);
+    bench_dfill(nb, nb, d->B0, nb, &seed);
+    bench_dfill(nb, nb, d->C0, nb, &seed);
+
+    // Make A0 symmetric and diagonally dominant, hence positive definite
+    // and well conditioned for the triangular solvers.
+    for (int j = 0; j < nb; j++) {
+        for (int i = j+1; i < nb; i++)
+            d->A0[j + nb*i] = (d->A0[i + nb*j]);
+        d->A0[j + nb*j] = creal(d->A0[j + nb*j]) + nb;
+    }
+    memcpy(d->L, d->A0, tile*sizeof(double));
+    coreblas_dpotrf(CoreBlasLower, nb, d->L, nb);
+
+    // Factors consumed by the update kernels.
+    memcpy(d->Vqr, d->B0, tile*sizeof(double));
+    coreblas_dgeqrt(nb, nb, ib, d->Vqr, nb, d->Tqr, ib, d->tau, d->work);
+    for (int j = 0; j < nb; j++) {
+        d->tauqr[j] = d->Tqr[j%ib + ib*j];
+        for (int i = 0; i < nb; i++)
+            d->Vqrx[i + nb*j] = i > j ? d->Vqr[i + nb*j] : (i == j ? 1.0 : 0.0);
+    }
+    memcpy(d->Vlq, d->B0, tile*sizeof(double));
+    coreblas_dgelqt(nb, nb, ib, d->Vlq, nb, d->Tlq, ib, d->tau, d->work);
+    bench_dlarfb_v(CoreBlasForward, CoreBlasRowwise, nb, ib,
+                   d->Vlq, nb, d->Vlqx, nb);
+    bench_dlarfb_v(CoreBlasBackward, CoreBlasColumnwise, nb, ib,
+                   d->C0, nb, d->Vcbx, nb);
+    bench_dlarfb_v(CoreBlasBackward, CoreBlasRowwise, nb, ib,
+                   d->C0, nb, d->Vrbx, nb);
+
+    memcpy(d->A, d->Vqr, tile*sizeof(double));
+    memcpy(d->Vts, d->C0, tile*sizeof(double));
+    coreblas_dtsqrt(nb, nb, ib, d->A, nb, d->Vts, nb, d->Tts, ib,
+                    d->tau, d->work);
+    memcpy(d->A, d->Vqr, tile*sizeof(double));
+    memcpy(d->Vtt, d->Vqr, tile*sizeof(double));
+    coreblas_dttqrt(nb, nb, ib, d->A, nb, d->Vtt, nb, d->Ttt, ib,
+                    d->tau, d->work);
+
+    memcpy(d->A, d->Vlq, tile*sizeof(double));
+    memcpy(d->Vtsl, d->C0, tile*sizeof(double));
+    coreblas_dtslqt(nb, nb, ib, d->A, nb, d->Vtsl, nb, d->Ttsl, ib,
+                    d->tau, d->work);
+    memcpy(d->A, d->Vlq, tile*sizeof(double));
+    memcpy(d->Vttl, d->Vlq, tile*sizeof(double));
+    coreblas_dttlqt(nb, nb, ib, d->A, nb, d->Vttl, nb, d->Tttl, ib,
+                    d->tau, d->work);
+
+    memcpy(d->A, d->Vlq, tile*sizeof(double));
+    memcpy(d->Vtsb, d->C0, tile*sizeof(double));
+    coreblas_dtsqlt(nb, nb, ib, d->A, nb, d->Vtsb, nb, d->Ttsb, ib,
+                    d->tau, d->work);
+    memcpy(d->A, d->Vqr, tile*sizeof(double));
+    memcpy(d->Vtsr, d->C0, tile*sizeof(double));
+    coreblas_dtsrqt(nb, nb, ib, d->A, nb, d->Vtsr, nb, d->Ttsr, ib,
+                    d->tau, d->work);
+
+    // Batch of copies of B0 and C0; all the pairs of the batched update
+    // share the reflectors of the ts factorization.
+    for (int i = 0; i < batch; i++) {
+        d->Abp[i] = &d->Ab[tile*i];
+        d->Cbp[i] = &d->Cb[tile*i];
+        d->Dbp[i] = &d->Db[tile*i];
+        d->Tbp[i] = &d->Tb[(size_t)ib*nb*i];
+        d->Vp[i] = d->Vts;
+        d->Tp[i] = d->Tts;
+        memcpy(d->Abp[i], d->B0, tile*sizeof(double));
+        memcpy(d->Cbp[i], d->C0, tile*sizeof(double));
+        memcpy(d->Dbp[i], d->B0, tile*sizeof(double));
+    }
+
+    // Pivots consumed by the row interchange kernel.
+    memcpy(d->A, d->B0, tile*sizeof(double));
+    bench_dgetrf_tile(d->A, nb, ib, d->ipiv);
+
+    // Band and its states after the first two tasks of the first sweep.
+    for (int j = 0; j < nb; j++)
+        bench_dfill(j+bw < nb ? bw+1 : nb-j, 1,
+                    &d->band0[0][bw + (size_t)d->ldband*j], d->ldband, &seed);
+    bench_dband_norms(d, d->band0[0], &d->band_fro, &d->band_fro2);
+    for (int t = 1; t < 3; t++) {
+        memcpy(d->band0[t], d->band0[t-1], lband*sizeof(double));
+        memcpy(d->vband0[t], d->vband0[t-1],
+               8*(size_t)nb*sizeof(double));
+        bench_dgbtype(d, t, d->band0[t], d->vband0[t]);
+    }
+
+    bench_d.reset(d);
+    return d;
+}
+
+/******************************************************************************/
+static void bench_dreset(void *data)
+{
+    bench_ddata_t *d = (bench_ddata_t*)data;
+    size_t size = (size_t)d->nb*d->nb*sizeof(double);
+    size_t lband = (size_t)d->ldband*d->nb*sizeof(double);
+    size_t lvband = 8*(size_t)d->nb*sizeof(double);
+    for (int i = 0; i < 4; i++) {
+        memcpy(d->band[i],  d->band0[i%3],  lband);
+        memcpy(d->vband[i], d->vband0[i%3], lvband);
+    }
+    memcpy(d->A, d->A0, size);
+    memcpy(d->B, d->B0, size);
+    memcpy(d->C, d->C0, size);
+}
+
+/******************************************************************************/
+static void bench_ddestroy(void *data)
+{
+    bench_ddata_t *d = (bench_ddata_t*)data;
+    if (d == NULL)
+        return;
+
+    free(d->A);    free(d->B);    free(d->C);
+    free(d->A0);   free(d->B0);   free(d->C0);   free(d->L);
+    free(d->Vqr);  free(d->Vlq);  free(d->Vts);  free(d->Vtt);
+    free(d->Vtsl); free(d->Vttl); free(d->Vtsb); free(d->Vtsr);
+    free(d->Vqrx); free(d->Vlqx); free(d->Vcbx); free(d->Vrbx);
+    free(d->Tqr);  free(d->Tlq);  free(d->Tts);  free(d->Ttt);
+    free(d->Ttsl); free(d->Tttl); free(d->Ttsb); free(d->Ttsr);
+    free(d->T);
+    free(d->tau);  free(d->tauqr); free(d->work); free(d->dwork);
+    free(d->ipiv);
+    free(d->wcalu); free(d->iwcalu); free(d->iwork);
+    free(d->Ab);   free(d->Cb);   free(d->Db);   free(d->Tb);
+    free(d->Abp);  free(d->Cbp);  free(d->Dbp);  free(d->Tbp);
+    free(d->Vp);   free(d->Tp);
+    for (int i = 0; i < 4; i++) {
+        free(d->band[i]);
+        free(d->vband[i]);
+    }
+    for (int i = 0; i < 3; i++) {
+        free(d->band0[i]);
+        free(d->vband0[i]);
+    }
+    free(d->iwband);
+    if (d->wbatch.spaces != NULL)
+        coreblas_workspace_destroy(&d->wbatch);
+    free(d);
+}
+
+/*******************************************************************************
+ *  Kernel calls.
+ **/
+#define BENCH_DATA bench_ddata_t *d = (bench_ddata_t*)data; int nb = d->nb; \
+                   int ib = d->ib; (void)nb; (void)ib;
+
+static const double zone  =  1.0;
+static const double zmone = -1.0;
+
+//==============================================================================
+// Level 3 BLAS
+static int bench_dgemm_call(void *data) {
+    BENCH_DATA
+    coreblas_dgemm(CoreBlasNoTrans, CoreBlasNoTrans, nb, nb, nb,
+                   zmone, d->A, nb, d->B, nb, zone, d->C, nb);
+    return 0;
+}
+static bench_flops_t bench_dgemm_flops(int nb, int ib) {
+    return bench_dflops(FMULS_GEMM(nb, nb, nb), FADDS_GEMM(nb, nb, nb));
+}
+
+static int bench_dgemm_batched_call(void *data) {
+    BENCH_DATA
+    return coreblas_dgemm_batched(
+        CoreBlasNoTrans, CoreBlasNoTrans, nb, nb, nb,
+        zmone, (const double * const *)d->Abp, nb,
+               (const double * const *)d->Dbp, nb,
+        zone, d->Cbp, nb, d->batch);
+}
+static bench_flops_t bench_dgemm_batched_flops(int nb, int ib) {
+    return bench_dbatch(nb)*bench_dgemm_flops(nb, ib);
+}
+
+#ifdef COMPLEX
+static int bench_dsymm_call(void *data) {
+    BENCH_DATA
+    coreblas_dsymm(CoreBlasLeft, CoreBlasLower, nb, nb,
+                   zmone, d->A, nb, d->B, nb, zone, d->C, nb);
+    return 0;
+}
+
+static int bench_dsyrk_call(void *data) {
+    BENCH_DATA
+    coreblas_dsyrk(CoreBlasLower, CoreBlasNoTrans, nb, nb,
+                   -1.0, d->B, nb, 1.0, d->A, nb);
+    return 0;
+}
+
+static int bench_dsyr2k_call(void *data) {
+    BENCH_DATA
+    coreblas_dsyr2k(CoreBlasLower, CoreBlasNoTrans, nb, nb,
+                    zmone, d->B, nb, d->C, nb, 1.0, d->A, nb);
+    return 0;
+}
+#endif
+
+static int bench_dsymm_call(void *data) {
+    BENCH_DATA
+    coreblas_dsymm(CoreBlasLeft, CoreBlasLower, nb, nb,
+                   zmone, d->A, nb, d->B, nb, zone, d->C, nb);
+    return 0;
+}
+static bench_flops_t bench_dsymm_flops(int nb, int ib) {
+    return bench_dflops(FMULS_SYMM(nb, nb), FADDS_SYMM(nb, nb));
+}
+
+static int bench_dsyrk_call(void *data) {
+    BENCH_DATA
+    coreblas_dsyrk(CoreBlasLower, CoreBlasNoTrans, nb, nb,
+                   zmone, d->B, nb, zone, d->A, nb);
+    return 0;
+}
+static bench_flops_t bench_dsyrk_flops(int nb, int ib) {
+    return bench_dflops(FMULS_SYRK(nb, nb), FADDS_SYRK(nb, nb));
+}
+
+static int bench_dsyr2k_call(void *data) {
+    BENCH_DATA
+    coreblas_dsyr2k(CoreBlasLower, CoreBlasNoTrans, nb, nb,
+                    zmone, d->B, nb, d->C, nb, zone, d->A, nb);
+    return 0;
+}
+static bench_flops_t bench_dsyr2k_flops(int nb, int ib) {
+    return bench_dflops(FMULS_SYR2K(nb, nb), FADDS_SYR2K(nb, nb));
+}
+
+static int bench_dtrmm_call(void *data) {
+    BENCH_DATA
+    coreblas_dtrmm(CoreBlasLeft, CoreBlasLower, CoreBlasNoTrans,
+                   CoreBlasNonUnit, nb, nb, zone, d->A, nb, d->B, nb);
+    return 0;
+}
+static bench_flops_t bench_dtrmm_flops(int nb, int ib) {
+    return bench_dflops(FMULS_TRMM(nb, nb), FADDS_TRMM(nb, nb));
+}
+
+static int bench_dtrsm_call(void *data) {
+    BENCH_DATA
+    coreblas_dtrsm(CoreBlasLeft, CoreBlasLower, CoreBlasNoTrans,
+                   CoreBlasNonUnit, nb, nb, zone, d->A, nb, d->B, nb);
+    return 0;
+}
+static bench_flops_t bench_dtrsm_flops(int nb, int ib) {
+    return bench_dflops(FMULS_TRSM(nb, nb), FADDS_TRSM(nb, nb));
+}
+
+//==============================================================================
+// Auxiliary
+static int bench_dgeadd_call(void *data) {
+    BENCH_DATA
+    return coreblas_dgeadd(CoreBlasNoTrans, nb, nb,
+                           zmone, d->B, nb, zone, d->C, nb);
+}
+static bench_flops_t bench_dgeadd_flops(int nb, int ib) {
+    return bench_dflops(2.0*nb*nb, (double)nb*nb);
+}
+
+static int bench_dtradd_call(void *data) {
+    BENCH_DATA
+    return coreblas_dtradd(CoreBlasLower, CoreBlasNoTrans, nb, nb,
+                           zmone, d->B, nb, zone, d->C, nb);
+}
+static bench_flops_t bench_dtradd_flops(int nb, int ib) {
+    return bench_dflops((double)nb*(nb+1), 0.5*nb*(nb+1));
+}
+
+static int bench_dlacpy_call(void *data) {
+    BENCH_DATA
+    coreblas_dlacpy(CoreBlasGeneral, CoreBlasNoTrans, nb, nb,
+                    d->B, nb, d->C, nb);
+    return 0;
+}
+
+static int bench_dlacpy_lapack2tile_band_call(void *data) {
+    BENCH_DATA
+    coreblas_dlacpy_lapack2tile_band(CoreBlasGeneral, 0, 0, nb, nb, nb,
+                                     ib, ib, d->B, nb, d->C, nb);
+    return 0;
+}
+
+static int bench_dlacpy_tile2lapack_band_call(void *data) {
+    BENCH_DATA
+    coreblas_dlacpy_tile2lapack_band(CoreBlasGeneral, 0, 0, nb, nb, nb,
+                                     ib, ib, d->B, nb, d->C, nb);
+    return 0;
+}
+
+static int bench_dlaset_call(void *data) {
+    BENCH_DATA
+    coreblas_dlaset(CoreBlasGeneral, nb, nb, 0.0, 1.0, d->C, nb);
+    return 0;
+}
+
+static int bench_dlascl_call(void *data) {
+    BENCH_DATA
+    coreblas_dlascl(CoreBlasGeneral, 2.0, 3.0, nb, nb, d->C, nb);
+    return 0;
+}
+static bench_flops_t bench_dlascl_flops(int nb, int ib) {
+    return bench_dflops((double)nb*nb, 0.0);
+}
+
+static bench_flops_t bench_dnorm_flops(int nb, int ib) {
+    return bench_dflops((double)nb*nb, (double)nb*nb);
+}
+
+static int bench_dlange_one_call(void *data) {
+    BENCH_DATA
+    coreblas_dlange(CoreBlasOneNorm, nb, nb, d->B, nb, d->dwork, d->value);
+    return 0;
+}
+
+static int bench_dlange_inf_call(void *data) {
+    BENCH_DATA
+    coreblas_dlange(CoreBlasInfNorm, nb, nb, d->B, nb, d->dwork, d->value);
+    return 0;
+}
+
+static int bench_dlange_fro_call(void *data) {
+    BENCH_DATA
+    coreblas_dlange(CoreBlasFrobeniusNorm, nb, nb, d->B, nb,
+                    d->dwork, d->value);
+    return 0;
+}
+
+static int bench_dlange_max_call(void *data) {
+    BENCH_DATA
+    coreblas_dlange(CoreBlasMaxNorm, nb, nb, d->B, nb, d->dwork, d->value);
+    return 0;
+}
+
+// Column and row sums, as computed on every tile by the tile norms.
+static int bench_dlange_aux_one_call(void *data) {
+    BENCH_DATA
+    coreblas_dlange_aux(CoreBlasOneNorm, nb, nb, d->B, nb, d->dwork);
+    return 0;
+}
+
+static int bench_dlange_aux_inf_call(void *data) {
+    BENCH_DATA
+    coreblas_dlange_aux(CoreBlasInfNorm, nb, nb, d->B, nb, d->dwork);
+    return 0;
+}
+
+static int bench_dlantr_aux_inf_call(void *data) {
+    BENCH_DATA
+    coreblas_dlantr_aux(CoreBlasInfNorm, CoreBlasUpper, CoreBlasNonUnit,
+                        nb, nb, d->B, nb, d->dwork);
+    return 0;
+}
+
+static int bench_dlansy_aux_call(void *data) {
+    BENCH_DATA
+    coreblas_dlansy_aux(CoreBlasOneNorm, CoreBlasLower, nb, d->A, nb,
+                        d->dwork);
+    return 0;
+}
+
+#ifdef COMPLEX
+static int bench_dlansy_one_call(void *data) {
+    BENCH_DATA
+    coreblas_dlansy(CoreBlasOneNorm, CoreBlasLower, nb, d->A, nb,
+                    d->dwork, d->value);
+    return 0;
+}
+
+static int bench_dlansy_aux_call(void *data) {
+    BENCH_DATA
+    coreblas_dlansy_aux(CoreBlasOneNorm, CoreBlasLower, nb, d->A, nb,
+                        d->dwork);
+    return 0;
+}
+
+static int bench_dsyssq_call(void *data) {
+    BENCH_DATA
+    d->value[0] = 0.0;
+    d->value[1] = 1.0;
+    coreblas_dsyssq(CoreBlasLower, nb, d->A, nb, &d->value[0], &d->value[1]);
+    return 0;
+}
+#endif
+
+static int bench_dlansy_one_call(void *data) {
+    BENCH_DATA
+    coreblas_dlansy(CoreBlasOneNorm, CoreBlasLower, nb, d->A, nb,
+                    d->dwork, d->value);
+    return 0;
+}
+
+static int bench_dlantr_one_call(void *data) {
+    BENCH_DATA
+    coreblas_dlantr(CoreBlasOneNorm, CoreBlasLower, CoreBlasNonUnit, nb, nb,
+                    d->B, nb, d->dwork, d->value);
+    return 0;
+}
+
+static int bench_dgessq_call(void *data) {
+    BENCH_DATA
+    d->value[0] = 0.0;
+    d->value[1] = 1.0;
+    coreblas_dgessq(nb, nb, d->B, nb, &d->value[0], &d->value[1]);
+    return 0;
+}
+
+static int bench_dsyssq_call(void *data) {
+    BENCH_DATA
+    d->value[0] = 0.0;
+    d->value[1] = 1.0;
+    coreblas_dsyssq(CoreBlasLower, nb, d->A, nb, &d->value[0], &d->value[1]);
+    return 0;
+}
+
+// Reductions of the partial results of nb*nb tiles, read from the tile B.
+static int bench_dreduce_ssq_call(void *data) {
+    BENCH_DATA
+    const double *scale = (const double*)d->B;
+    int n = nb*nb/2;
+    coreblas_dreduce_ssq(n, scale, &scale[n], &d->value[0], &d->value[1]);
+    return 0;
+}
+
+static int bench_dreduce_one_call(void *data) {
+    BENCH_DATA
+    coreblas_dreduce_norm(CoreBlasOneNorm, nb, nb, (const double*)d->B, nb,
+                          d->value);
+    return 0;
+}
+
+static int bench_dtrssq_call(void *data) {
+    BENCH_DATA
+    d->value[0] = 0.0;
+    d->value[1] = 1.0;
+    coreblas_dtrssq(CoreBlasLower, CoreBlasNonUnit, nb, nb, d->B, nb,
+                    &d->value[0], &d->value[1]);
+    return 0;
+}
+
+//==============================================================================
+// Cholesky and triangular
+static int bench_dpotrf_call(void *data) {
+    BENCH_DATA
+    return coreblas_dpotrf(CoreBlasLower, nb, d->A, nb);
+}
+static bench_flops_t bench_dpotrf_flops(int nb, int ib) {
+    return bench_dflops(FMULS_POTRF(nb), FADDS_POTRF(nb));
+}
+
+static int bench_dtrtri_call(void *data) {
+    BENCH_DATA
+    return coreblas_dtrtri(CoreBlasLower, CoreBlasNonUnit, nb, d->A, nb);
+}
+static bench_flops_t bench_dtrtri_flops(int nb, int ib) {
+    return bench_dflops(FMULS_TRTRI(nb), FADDS_TRTRI(nb));
+}
+
+static int bench_dlauum_call(void *data) {
+    BENCH_DATA
+    return coreblas_dlauum(CoreBlasLower, nb, d->A, nb);
+}
+static bench_flops_t bench_dlauum_flops(int nb, int ib) {
+    return bench_dflops(FMULS_LAUUM(nb), FADDS_LAUUM(nb));
+}
+
+static int bench_dsygst_call(void *data) {
+    BENCH_DATA
+    return coreblas_dsygst(1, CoreBlasLower, nb, d->A, nb, d->L, nb);
+}
+static bench_flops_t bench_dsygst_flops(int nb, int ib) {
+    return bench_dflops(FMULS_SYGST(nb), FADDS_SYGST(nb));
+}
+
+//==============================================================================
+// LU
+static int bench_dgetrf_call(void *data) {
+    BENCH_DATA
+    return bench_dgetrf_tile(d->B, nb, ib, d->ipiv);
+}
+static bench_flops_t bench_dgetrf_flops(int nb, int ib) {
+    return bench_dflops(FMULS_GETRF(nb, nb), FADDS_GETRF(nb, nb));
+}
+
+static int bench_dgetrf_calu_call(void *data) {
+    BENCH_DATA
+    coreblas_desc_t desc;
+    coreblas_desc_general_init(CoreBlasRealDouble, d->B, nb, nb,
+                               nb, nb, 0, 0, nb, nb, &desc);
+
+    volatile int info = 0;
+    coreblas_barrier_t barrier;
+    coreblas_barrier_init(&barrier);
+
+    coreblas_dgetrf_calu(desc, d->ipiv, 0, 1, d->wcalu, d->iwcalu,
+                         &info, &barrier);
+    return info;
+}
+
+// Pivot search over the whole tile B.
+static int bench_idamax_tile_call(void *data) {
+    BENCH_DATA
+    int imax, jmax;
+    coreblas_idamax_tile(nb, nb, d->B, nb, &imax, &jmax, &d->value[0]);
+    return 0;
+}
+
+static int bench_dgeswp_call(void *data) {
+    BENCH_DATA
+    coreblas_desc_t desc;
+    coreblas_desc_general_init(CoreBlasRealDouble, d->C, nb, nb,
+                               nb, nb, 0, 0, nb, nb, &desc);
+    coreblas_dgeswp(CoreBlasRowwise, desc, 1, nb, d->ipiv, 1);
+    return 0;
+}
+
+static int bench_dgeswp_blocked_call(void *data) {
+    BENCH_DATA
+    coreblas_desc_t desc;
+    coreblas_desc_general_init(CoreBlasRealDouble, d->C, nb, nb,
+                               nb, nb, 0, 0, nb, nb, &desc);
+    coreblas_dgeswp_blocked(CoreBlasRowwise, desc, 1, nb, d->ipiv, 1,
+                            0, 1, d->work, d->iwork);
+    return 0;
+}
+
+//==============================================================================
+// QR and LQ
+static int bench_dgeqrt_call(void *data) {
+    BENCH_DATA
+    return coreblas_dgeqrt(nb, nb, ib, d->B, nb, d->T, ib, d->tau, d->work);
+}
+static bench_flops_t bench_dgeqrt_flops(int nb, int ib) {
+    return bench_dflops(FMULS_GEQRF(nb, nb), FADDS_GEQRF(nb, nb));
+}
+
+static int bench_dgeqrt_batched_call(void *data) {
+    BENCH_DATA
+    return coreblas_dgeqrt_batched(nb, nb, ib, d->Abp, nb, d->Tbp, ib,
+                                   &d->wbatch, d->batch);
+}
+static bench_flops_t bench_dgeqrt_batched_flops(int nb, int ib) {
+    return bench_dbatch(nb)*bench_dgeqrt_flops(nb, ib);
+}
+
+static int bench_dgelqt_call(void *data) {
+    BENCH_DATA
+    return coreblas_dgelqt(nb, nb, ib, d->B, nb, d->T, ib, d->tau, d->work);
+}
+static bench_flops_t bench_dgelqt_flops(int nb, int ib) {
+    return bench_dflops(FMULS_GELQF(nb, nb), FADDS_GELQF(nb, nb));
+}
+
+static int bench_dtsqrt_call(void *data) {
+    BENCH_DATA
+    return coreblas_dtsqrt(nb, nb, ib, d->A, nb, d->B, nb, d->T, ib,
+                           d->tau, d->work);
+}
+
+static int bench_dtsqrt_rec_call(void *data) {
+    BENCH_DATA
+    return coreblas_dtsqrt_rec(nb, nb, ib, d->A, nb, d->B, nb, d->T, ib,
+                               d->tau, d->work);
+}
+
+static int bench_dtslqt_call(void *data) {
+    BENCH_DATA
+    return coreblas_dtslqt(nb, nb, ib, d->A, nb, d->B, nb, d->T, ib,
+                           d->tau, d->work);
+}
+
+static int bench_dtsqlt_call(void *data) {
+    BENCH_DATA
+    return coreblas_dtsqlt(nb, nb, ib, d->A, nb, d->B, nb, d->T, ib,
+                           d->tau, d->work);
+}
+
+static int bench_dtsrqt_call(void *data) {
+    BENCH_DATA
+    return coreblas_dtsrqt(nb, nb, ib, d->A, nb, d->B, nb, d->T, ib,
+                           d->tau, d->work);
+}
+static bench_flops_t bench_dtsqrt_flops(int nb, int ib) {
+    return bench_dflops(FMULS_TSQRT(nb, nb), FADDS_TSQRT(nb, nb));
+}
+
+static int bench_dttqrt_call(void *data) {
+    BENCH_DATA
+    return coreblas_dttqrt(nb, nb, ib, d->A, nb, d->B, nb, d->T, ib,
+                           d->tau, d->work);
+}
+
+static int bench_dttqrt_rec_call(void *data) {
+    BENCH_DATA
+    return coreblas_dttqrt_rec(nb, nb, ib, d->A, nb, d->B, nb, d->T, ib,
+                               d->tau, d->work);
+}
+
+static int bench_dttlqt_call(void *data) {
+    BENCH_DATA
+    return coreblas_dttlqt(nb, nb, ib, d->A, nb, d->B, nb, d->T, ib,
+                           d->tau, d->work);
+}
+static bench_flops_t bench_dttqrt_flops(int nb, int ib) {
+    return bench_dflops(FMULS_TTQRT(nb), FADDS_TTQRT(nb));
+}
+
+static int bench_dormqr_call(void *data) {
+    BENCH_DATA
+    return coreblas_dormqr(CoreBlasLeft, CoreBlasTrans, nb, nb, nb, ib,
+                           d->Vqr, nb, d->Tqr, ib, d->C, nb, d->work, nb);
+}
+
+static int bench_dormlq_call(void *data) {
+    BENCH_DATA
+    return coreblas_dormlq(CoreBlasLeft, CoreBlasTrans, nb, nb, nb, ib,
+                           d->Vlq, nb, d->Tlq, ib, d->C, nb, d->work, nb);
+}
+static bench_flops_t bench_dormqr_flops(int nb, int ib) {
+    return bench_dflops(FMULS_UNMQR(nb, nb, nb), FADDS_UNMQR(nb, nb, nb));
+}
+
+static int bench_dtsmqr_call(void *data) {
+    BENCH_DATA
+    return coreblas_dtsmqr(CoreBlasLeft, CoreBlasTrans,
+                           nb, nb, nb, nb, nb, ib,
+                           d->B, nb, d->C, nb, d->Vts, nb, d->Tts, ib,
+                           d->work, ib);
+}
+
+static int bench_dtsmlq_call(void *data) {
+    BENCH_DATA
+    return coreblas_dtsmlq(CoreBlasLeft, CoreBlasTrans,
+                           nb, nb, nb, nb, nb, ib,
+                           d->B, nb, d->C, nb, d->Vtsl, nb, d->Ttsl, ib,
+                           d->work, ib);
+}
+
+static int bench_dtsmql_call(void *data) {
+    BENCH_DATA
+    return coreblas_dtsmql(CoreBlasLeft, CoreBlasTrans,
+                           nb, nb, nb, nb, nb, ib,
+                           d->B, nb, d->C, nb, d->Vtsb, nb, d->Ttsb, ib,
+                           d->work, ib);
+}
+
+static int bench_dtsmrq_call(void *data) {
+    BENCH_DATA
+    return coreblas_dtsmrq(CoreBlasLeft, CoreBlasTrans,
+                           nb, nb, nb, nb, nb, ib,
+                           d->B, nb, d->C, nb, d->Vtsr, nb, d->Ttsr, ib,
+                           d->work, ib);
+}
+static bench_flops_t bench_dtsmqr_flops(int nb, int ib) {
+    return bench_dflops(FMULS_TSMQR(nb, nb, nb), FADDS_TSMQR(nb, nb, nb));
+}
+
+static int bench_dtsmqr_batched_call(void *data) {
+    BENCH_DATA
+    return coreblas_dtsmqr_batched(CoreBlasLeft, CoreBlasTrans,
+                                   nb, nb, nb, nb, nb, ib,
+                                   d->Dbp, nb, d->Cbp, nb,
+                                   d->Vp, nb, d->Tp, ib,
+                                   &d->wbatch, d->batch);
+}
+static bench_flops_t bench_dtsmqr_batched_flops(int nb, int ib) {
+    return bench_dbatch(nb)*bench_dtsmqr_flops(nb, ib);
+}
+
+static int bench_dtsmqr_row_call(void *data) {
+    BENCH_DATA
+    return coreblas_dtsmqr_row(CoreBlasLeft, CoreBlasTrans,
+                               nb, nb, nb, nb, nb, ib,
+                               d->Dbp, nb, d->Cbp, nb,
+                               d->Vts, nb, d->Tts, ib,
+                               &d->wbatch, d->batch);
+}
+
+static int bench_dttmqr_call(void *data) {
+    BENCH_DATA
+    return coreblas_dttmqr(CoreBlasLeft, CoreBlasTrans,
+                           nb, nb, nb, nb, nb, ib,
+                           d->B, nb, d->C, nb, d->Vtt, nb, d->Ttt, ib,
+                           d->work, ib);
+}
+
+static int bench_dttmlq_call(void *data) {
+    BENCH_DATA
+    return coreblas_dttmlq(CoreBlasLeft, CoreBlasTrans,
+                           nb, nb, nb, nb, nb, ib,
+                           d->B, nb, d->C, nb, d->Vttl, nb, d->Tttl, ib,
+                           d->work, ib);
+}
+static bench_flops_t bench_dttmqr_flops(int nb, int ib) {
+    return bench_dflops(FMULS_TTMQR(nb, nb), FADDS_TTMQR(nb, nb));
+}
+
+// One ib-wide block of the ts update, as issued by coreblas_dtsmqr.
+static int bench_dparfb_call(void *data) {
+    BENCH_DATA
+    return coreblas_dparfb(CoreBlasLeft, CoreBlasTrans,
+                           CoreBlasForward, CoreBlasColumnwise,
+                           ib, nb, nb, nb, ib, 0,
+                           d->B, nb, d->C, nb, d->Vts, nb, d->Tts, ib,
+                           d->work, ib);
+}
+static bench_flops_t bench_dparfb_flops(int nb, int ib) {
+    return bench_dflops(FMULS_TSMQR(nb, nb, ib), FADDS_TSMQR(nb, nb, ib));
+}
+
+static int bench_dpamm_call(void *data) {
+    BENCH_DATA
+    return coreblas_dpamm(CoreBlasW, CoreBlasLeft, CoreBlasColumnwise,
+                          ib, nb, nb, 0,
+                          d->B, nb, d->C, nb, d->Vts, nb, d->work, ib);
+}
+static bench_flops_t bench_dpamm_flops(int nb, int ib) {
+    return bench_dflops(FMULS_GEMM(ib, nb, nb), FADDS_GEMM(ib, nb, nb));
+}
+
+static int bench_dpemv_call(void *data) {
+    BENCH_DATA
+    return coreblas_dpemv(CoreBlasConjTrans, CoreBlasColumnwise,
+                          nb, nb, 0, zone, d->Vts, nb, d->B, 1,
+                          zone, d->C, 1, d->work);
+}
+static bench_flops_t bench_dpemv_flops(int nb, int ib) {
+    return bench_dflops((double)nb*nb, (double)nb*nb);
+}
+
+static int bench_dlarfb_gemm_call(void *data) {
+    BENCH_DATA
+    return coreblas_dlarfb_gemm(CoreBlasLeft, CoreBlasTrans,
+                                CoreBlasForward, CoreBlasColumnwise,
+                                nb, nb, ib, d->Vqrx, nb, d->Tqr, ib,
+                                d->C, nb, d->work, nb);
+}
+
+// The other storev/direct cases; backward T is lower triangular and taken
+// from B0, which is not a T factor of V but is valid for the check.
+static int bench_dlarfb_gemm_rowfwd_call(void *data) {
+    BENCH_DATA
+    return coreblas_dlarfb_gemm(CoreBlasRight, CoreBlasNoTrans,
+                                CoreBlasForward, CoreBlasRowwise,
+                                nb, nb, ib, d->Vlqx, nb, d->Tlq, ib,
+                                d->C, nb, d->work, nb);
+}
+
+static int bench_dlarfb_gemm_colbwd_call(void *data) {
+    BENCH_DATA
+    return coreblas_dlarfb_gemm(CoreBlasLeft, CoreBlasTrans,
+                                CoreBlasBackward, CoreBlasColumnwise,
+                                nb, nb, ib, d->Vcbx, nb, d->B0, nb,
+                                d->C, nb, d->work, nb);
+}
+
+static int bench_dlarfb_gemm_rowbwd_call(void *data) {
+    BENCH_DATA
+    return coreblas_dlarfb_gemm(CoreBlasRight, CoreBlasNoTrans,
+                                CoreBlasBackward, CoreBlasRowwise,
+                                nb, nb, ib, d->Vrbx, nb, d->B0, nb,
+                                d->C, nb, d->work, nb);
+}
+static bench_flops_t bench_dlarfb_gemm_flops(int nb, int ib) {
+    return bench_dflops(FMULS_TSMQR(nb, nb, ib), FADDS_TSMQR(nb, nb, ib));
+}
+
+// T factor of all the reflectors of the geqrt factorization at once.
+static int bench_dlarft_call(void *data) {
+    BENCH_DATA
+    return coreblas_dlarft(CoreBlasColumnwise, nb, nb, d->Vqr, nb, d->tauqr,
+                           d->C, nb);
+}
+static bench_flops_t bench_dlarft_flops(int nb, int ib) {
+    return bench_dflops(FMULS_GEMM(nb, nb, nb)/6.0, FADDS_GEMM(nb, nb, nb)/6.0);
+}
+
+//==============================================================================
+// Two-sided and band reductions
+static int bench_dsyswp_call(void *data) {
+    BENCH_DATA
+    coreblas_desc_t desc;
+    coreblas_desc_general_init(CoreBlasRealDouble, d->A, nb, nb,
+                               nb, nb, 0, 0, nb, nb, &desc);
+    coreblas_barrier_t barrier;
+    coreblas_barrier_init(&barrier);
+    coreblas_dsyswp(0, 1, CoreBlasLower, desc, 1, nb, d->ipiv, 1, &barrier);
+    return 0;
+}
+
+static int bench_dsyrfb_call(void *data) {
+    BENCH_DATA
+    return coreblas_dsyrfb(CoreBlasLower, nb, nb, ib, d->Vqr, nb, d->Tqr, ib,
+                           d->A, nb, d->work);
+}
+static bench_flops_t bench_dsyrfb_flops(int nb, int ib) {
+    return 2.0*bench_dormqr_flops(nb, ib);
+}
+
+// B holds the conjugate transpose of the top tile.
+static int bench_dtsmqr_sytra1_call(void *data) {
+    BENCH_DATA
+    return coreblas_dtsmqr_sytra1(CoreBlasLeft, CoreBlasTrans,
+                                  nb, nb, nb, nb, nb, ib,
+                                  d->B, nb, d->C, nb, d->Vts, nb, d->Tts, ib,
+                                  d->work, ib);
+}
+
+// The diagonal tiles A and B and the off-diagonal tile C of a symmetric
+// 2-by-2 block.
+static int bench_dtsmqr_corner_call(void *data) {
+    BENCH_DATA
+    return coreblas_dtsmqr_corner(nb, nb, nb, nb, nb, nb, nb, ib,
+                                  d->A, nb, d->C, nb, d->B, nb,
+                                  d->Vts, nb, d->Tts, ib, d->work);
+}
+static bench_flops_t bench_dtsmqr_corner_flops(int nb, int ib) {
+    return 4.0*bench_dtsmqr_flops(nb, ib);
+}
+
+// The first three tasks of the first sweep of the chase of the band,
+// each on the band as left by the previous one.
+static int bench_dgbtype1cb_call(void *data) {
+    BENCH_DATA
+    bench_dgbtype(d, 1, d->band[0], d->vband[0]);
+    return 0;
+}
+
+static int bench_dgbtype2cb_call(void *data) {
+    BENCH_DATA
+    bench_dgbtype(d, 2, d->band[1], d->vband[1]);
+    return 0;
+}
+
+static int bench_dgbtype3cb_call(void *data) {
+    BENCH_DATA
+    bench_dgbtype(d, 3, d->band[2], d->vband[2]);
+    return 0;
+}
+
+static int bench_dgbbrd_static_call(void *data) {
+    BENCH_DATA
+    double *vband = d->vband[3];
+    return coreblas_dgbbrd_static(CoreBlasLower, nb, d->bw, 1,
+                                  d->band[3], d->ldband,
+                                  vband, &vband[2*nb], &vband[4*nb],
+                                  &vband[6*nb], 0, &d->wbatch, d->iwband);
+}
+
+/*******************************************************************************
+ *  Checks of the result of the last call, made on reset data.
+ **/
+#define BENCH_CHECK bench_ddata_t *d = (bench_ddata_t*)data; int nb = d->nb; \
+                    int ib = d->ib; (void)ib; \
+                    size_t tile = (size_t)nb*nb; (void)tile;
+
+//==============================================================================
+// Level 3 BLAS
+// Freivalds' check against an unblocked product with a random vector, which
+// does not rely on the BLAS gemm the kernel calls.
+static bench_resid_t bench_dgemm_check(void *data) {
+    BENCH_CHECK
+    double *x = bench_dmalloc(3*(size_t)nb);
+    double *y = &x[nb];
+    double *z = &x[2*nb];
+    unsigned long long seed = 7;
+    bench_dfill(nb, 1, x, nb, &seed);
+    double err = 0.0;
+    double nrm = 0.0;
+    for (int i = 0; i < nb; i++) {
+        y[i] = 0.0;
+        for (int l = 0; l < nb; l++)
+            y[i] += d->B0[i + nb*l]*x[l];
+    }
+    for (int i = 0; i < nb; i++) {
+        double r = 0.0;
+        z[i] = 0.0;
+        for (int l = 0; l < nb; l++) {
+            r += d->C0[i + nb*l]*x[l] - d->A0[i + nb*l]*y[l];
+            z[i] += d->C[i + nb*l]*x[l];
+        }
+        err += fabs(z[i] - r)*fabs(z[i] - r);
+        nrm += fabs(r)*fabs(r);
+    }
+    free(x);
+    return bench_dscaled(sqrt(err), sqrt(nrm), nb);
+}
+
+// R = C0 - op(A) B0, where A is the full matrix of the lower triangle of A0.
+static double bench_dsymm_ref_check(bench_ddata_t *d, int herm)
+{
+    int nb = d->nb;
+    size_t tile = (size_t)nb*nb;
+    double *F = bench_dmalloc(2*tile);
+    double *R = &F[tile];
+    bench_dfull(herm, nb, d->A0, nb, F, nb);
+    memcpy(R, d->C0, tile*sizeof(double));
+    coreblas_dgemm(CoreBlasNoTrans, CoreBlasNoTrans, nb, nb, nb,
+                   zmone, F, nb, d->B0, nb, zone, R, nb);
+    double resid = bench_dresid(CoreBlasGeneral, nb, nb, d->C, nb, R, nb);
+    free(F);
+    return resid;
+}
+
+// R = A0 - X Y^T - Y X^T for rank 2 and A0 - X X^T for rank 1, with
+// ^T the transposition trans, compared on the lower triangle.
+static double bench_drank_ref_check(bench_ddata_t *d, coreblas_enum_t trans,
+                                    int rank2)
+{
+    int nb = d->nb;
+    size_t tile = (size_t)nb*nb;
+    double *R = bench_dmalloc(tile);
+    memcpy(R, d->A0, tile*sizeof(double));
+    const double *Y = rank2 ? d->C0 : d->B0;
+    coreblas_dgemm(CoreBlasNoTrans, trans, nb, nb, nb,
+                   zmone, d->B0, nb, Y, nb, zone, R, nb);
+    if (rank2) {
+        coreblas_dgemm(CoreBlasNoTrans, trans, nb, nb, nb,
+                       zmone, d->C0, nb, d->B0, nb, zone, R, nb);
+    }
+    double resid = bench_dresid(CoreBlasLower, nb, nb, d->A, nb, R, nb);
+    free(R);
+    return resid;
+}
+
+#ifdef COMPLEX
+static bench_resid_t bench_dsymm_check(void *data) {
+    return bench_dsymm_ref_check((bench_ddata_t*)data, 1);
+}
+
+static bench_resid_t bench_dsyrk_check(void *data) {
+    return bench_drank_ref_check((bench_ddata_t*)data, CoreBlasConjTrans, 0);
+}
+
+static bench_resid_t bench_dsyr2k_check(void *data) {
+    return bench_drank_ref_check((bench_ddata_t*)data, CoreBlasConjTrans, 1);
+}
+#endif
+
+static bench_resid_t bench_dsymm_check(void *data) {
+    return bench_dsymm_ref_check((bench_ddata_t*)data, 0);
+}
+
+static bench_resid_t bench_dsyrk_check(void *data) {
+    return bench_drank_ref_check((bench_ddata_t*)data, CoreBlasTrans, 0);
+}
+
+static bench_resid_t bench_dsyr2k_check(void *data) {
+    return bench_drank_ref_check((bench_ddata_t*)data, CoreBlasTrans, 1);
+}
+
+static bench_resid_t bench_dtrmm_check(void *data) {
+    BENCH_CHECK
+    double *L = bench_dmalloc(2*tile);
+    double *R = &L[tile];
+    bench_dtri(CoreBlasLower, nb, d->A0, nb, L, nb);
+    coreblas_dgemm(CoreBlasNoTrans, CoreBlasNoTrans, nb, nb, nb,
+                   zone, L, nb, d->B0, nb, 0.0, R, nb);
+    double resid = bench_dresid(CoreBlasGeneral, nb, nb, d->B, nb, R, nb);
+    free(L);
+    return resid;
+}
+
+// The residual L B - B0 of the solution.
+static bench_resid_t bench_dtrsm_check(void *data) {
+    BENCH_CHECK
+    double *L = bench_dmalloc(2*tile);
+    double *X = &L[tile];
+    bench_dtri(CoreBlasLower, nb, d->A0, nb, L, nb);
+    coreblas_dgemm(CoreBlasNoTrans, CoreBlasNoTrans, nb, nb, nb,
+                   zone, L, nb, d->B, nb, 0.0, X, nb);
+    double resid = bench_dresid(CoreBlasGeneral, nb, nb, X, nb, d->B0, nb);
+    free(L);
+    return resid;
+}
+
+//==============================================================================
+// Auxiliary
+static bench_resid_t bench_dgeadd_check(void *data) {
+    BENCH_CHECK
+    double *R = bench_dmalloc(tile);
+    for (size_t i = 0; i < tile; i++)
+        R[i] = d->C0[i] - d->B0[i];
+    double resid = bench_dresid(CoreBlasGeneral, nb, nb, d->C, nb, R, nb);
+    free(R);
+    return resid;
+}
+
+// The strictly upper triangle is left as is.
+static bench_resid_t bench_dtradd_check(void *data) {
+    BENCH_CHECK
+    double *R = bench_dmalloc(tile);
+    for (int j = 0; j < nb; j++)
+        for (int i = 0; i < nb; i++)
+            R[i + nb*j] = d->C0[i + nb*j] - (i >= j ? d->B0[i + nb*j] : 0.0);
+    double resid = bench_dresid(CoreBlasGeneral, nb, nb, d->C, nb, R, nb);
+    free(R);
+    return resid;
+}
+
+// The copies of B0 into C.
+static bench_resid_t bench_dlacpy_check(void *data) {
+    BENCH_CHECK
+    return bench_dresid(CoreBlasGeneral, nb, nb, d->C, nb, d->B0, nb);
+}
+
+static bench_resid_t bench_dlaset_check(void *data) {
+    BENCH_CHECK
+    double *R = bench_dmalloc(tile);
+    for (int j = 0; j < nb; j++)
+        for (int i = 0; i < nb; i++)
+            R[i + nb*j] = i == j ? 1.0 : 0.0;
+    double resid = bench_dresid(CoreBlasGeneral, nb, nb, d->C, nb, R, nb);
+    free(R);
+    return resid;
+}
+
+static bench_resid_t bench_dlascl_check(void *data) {
+    BENCH_CHECK
+    double *R = bench_dmalloc(tile);
+    for (size_t i = 0; i < tile; i++)
+        R[i] = 1.5*d->C0[i];
+    double resid = bench_dresid(CoreBlasGeneral, nb, nb, d->C, nb, R, nb);
+    free(R);
+    return resid;
+}
+
+// Sums of the moduli of the columns (sum = 0) or rows (sum = 1) of the
+// uplo part of A, with the moduli of the mirrored entries for herm.
+static void bench_dabs_sums(int sum, coreblas_enum_t uplo, int herm, int nb,
+                            const double *A, double *s)
+{
+    for (int i = 0; i < nb; i++)
+        s[i] = 0.0;
+    for (int j = 0; j < nb; j++) {
+        for (int i = 0; i < nb; i++) {
+            int in = uplo == CoreBlasGeneral ||
+                     (uplo == CoreBlasLower ? i >= j : i <= j);
+            if (in) {
+                double a = fabs(A[i + nb*j]);
+                s[sum ? i : j] += a;
+                if (herm && i != j)
+                    s[sum ? j : i] += a;
+            }
+        }
+    }
+}
+
+// Scaled error of the n values x against the reference r.
+static double bench_dvalues(int n, const double *x, const double *r, int nb)
+{
+    double err = 0.0;
+    double nrm = 0.0;
+    for (int i = 0; i < n; i++) {
+        err = fmax(err, fabs(x[i] - r[i]));
+        nrm = fmax(nrm, fabs(r[i]));
+    }
+    return bench_dscaled(err, nrm, nb);
+}
+
+static double bench_dsums_check(bench_ddata_t *d, int sum,
+                                coreblas_enum_t uplo, int herm,
+                                const double *A,
+                                const double *x, int max)
+{
+    int nb = d->nb;
+    double *s = (double*)bench_dmalloc(nb);
+    bench_dabs_sums(sum, uplo, herm, nb, A, s);
+    double r = 0.0;
+    for (int i = 0; i < nb; i++)
+        r = fmax(r, s[i]);
+    double resid = max ? bench_dvalues(1, x, &r, nb)
+                       : bench_dvalues(nb, x, s, nb);
+    free(s);
+    return resid;
+}
+
+static bench_resid_t bench_dlange_one_check(void *data) {
+    bench_ddata_t *d = (bench_ddata_t*)data;
+    return bench_dsums_check(d, 0, CoreBlasGeneral, 0, d->B0, d->value, 1);
+}
+
+static bench_resid_t bench_dlange_inf_check(void *data) {
+    bench_ddata_t *d = (bench_ddata_t*)data;
+    return bench_dsums_check(d, 1, CoreBlasGeneral, 0, d->B0, d->value, 1);
+}
+
+static bench_resid_t bench_dlange_fro_check(void *data) {
+    BENCH_CHECK
+    double s = 0.0;
+    for (size_t i = 0; i < tile; i++)
+        s += fabs(d->B0[i])*fabs(d->B0[i]);
+    double r = sqrt(s);
+    return bench_dvalues(1, d->value, &r, nb);
+}
+
+static bench_resid_t bench_dlange_max_check(void *data) {
+    BENCH_CHECK
+    double r = 0.0;
+    for (size_t i = 0; i < tile; i++)
+        r = fmax(r, fabs(d->B0[i]));
+    return bench_dvalues(1, d->value, &r, nb);
+}
+
+static bench_resid_t bench_dlange_aux_one_check(void *data) {
+    bench_ddata_t *d = (bench_ddata_t*)data;
+    return bench_dsums_check(d, 0, CoreBlasGeneral, 0, d->B0, d->dwork, 0);
+}
+
+static bench_resid_t bench_dlange_aux_inf_check(void *data) {
+    bench_ddata_t *d = (bench_ddata_t*)data;
+    return bench_dsums_check(d, 1, CoreBlasGeneral, 0, d->B0, d->dwork, 0);
+}
+
+static bench_resid_t bench_dlantr_aux_inf_check(void *data) {
+    bench_ddata_t *d = (bench_ddata_t*)data;
+    return bench_dsums_check(d, 1, CoreBlasUpper, 0, d->B0, d->dwork, 0);
+}
+
+// Column sums of the symmetric (or symmetric) matrix of the lower triangle
+// of A0.
+static bench_resid_t bench_dlansy_aux_check(void *data) {
+    bench_ddata_t *d = (bench_ddata_t*)data;
+    return bench_dsums_check(d, 0, CoreBlasLower, 1, d->A0, d->dwork, 0);
+}
+
+static bench_resid_t bench_dlansy_one_check(void *data) {
+    bench_ddata_t *d = (bench_ddata_t*)data;
+    return bench_dsums_check(d, 0, CoreBlasLower, 1, d->A0, d->value, 1);
+}
+
+static bench_resid_t bench_dlantr_one_check(void *data) {
+    bench_ddata_t *d = (bench_ddata_t*)data;
+    return bench_dsums_check(d, 0, CoreBlasLower, 0, d->B0, d->value, 1);
+}
+
+// Scaled sum of squares (value[0], value[1]) of the uplo part of A,
+// with the mirrored entries for herm.
+static double bench_dssq_check(bench_ddata_t *d, coreblas_enum_t uplo,
+                               int herm, const double *A)
+{
+    int nb = d->nb;
+    double s = 0.0;
+    for (int j = 0; j < nb; j++) {
+        for (int i = 0; i < nb; i++) {
+            int in = uplo == CoreBlasGeneral ||
+                     (uplo == CoreBlasLower ? i >= j : i <= j);
+            if (in) {
+                double a = fabs(A[i + nb*j]);
+                s += (herm && i != j ? 2.0 : 1.0)*a*a;
+            }
+        }
+    }
+    double x = d->value[0]*d->value[0]*d->value[1];
+    return bench_dvalues(1, &x, &s, nb);
+}
+
+#ifdef COMPLEX
+static bench_resid_t bench_dlansy_one_check(void *data) {
+    return bench_dlansy_one_check(data);
+}
+
+static bench_resid_t bench_dlansy_aux_check(void *data) {
+    return bench_dlansy_aux_check(data);
+}
+
+static bench_resid_t bench_dsyssq_check(void *data) {
+    bench_ddata_t *d = (bench_ddata_t*)data;
+    return bench_dssq_check(d, CoreBlasLower, 1, d->A0);
+}
+#endif
+
+static bench_resid_t bench_dgessq_check(void *data) {
+    bench_ddata_t *d = (bench_ddata_t*)data;
+    return bench_dssq_check(d, CoreBlasGeneral, 0, d->B0);
+}
+
+static bench_resid_t bench_dsyssq_check(void *data) {
+    bench_ddata_t *d = (bench_ddata_t*)data;
+    return bench_dssq_check(d, CoreBlasLower, 1, d->A0);
+}
+
+static bench_resid_t bench_dtrssq_check(void *data) {
+    bench_ddata_t *d = (bench_ddata_t*)data;
+    return bench_dssq_check(d, CoreBlasLower, 0, d->B0);
+}
+
+// The sum of the terms scale^2 sumsq, relative to the sum of their moduli,
+// as the partial results read from B0 may be negative.
+static bench_resid_t bench_dreduce_ssq_check(void *data) {
+    BENCH_CHECK
+    const double *scale = (const double*)d->B0;
+    int n = nb*nb/2;
+    double s = 0.0;
+    double a = 0.0;
+    for (int i = 0; i < n; i++) {
+        s += scale[i]*scale[i]*scale[n+i];
+        a += fabs(scale[i]*scale[i]*scale[n+i]);
+    }
+    double x = d->value[0]*d->value[0]*d->value[1];
+
+    // An infinite scale factor gives an infinite norm and not a NaN, also
+    // when two of them are merged by the tree.
+    const double iscale[3] = {1.0, INFINITY, 2.0};
+    const double isumsq[3] = {1.0, 1.0, 3.0};
+    double tscale[100], tsumsq[100];
+    for (int i = 0; i < 100; i++) {
+        tscale[i] = 1.0;
+        tsumsq[i] = 1.0;
+    }
+    tscale[0] = tscale[99] = INFINITY;
+    double iscl, isum, inorm, tscl, tsum;
+    coreblas_dreduce_ssq(3, iscale, isumsq, &iscl, &isum);
+    coreblas_dgessq_aux(3, iscale, isumsq, &inorm);
+    coreblas_dreduce_ssq(100, tscale, tsumsq, &tscl, &tsum);
+    if (!(isinf(iscl) && isum == 1.0 && isinf(inorm) &&
+          isinf(tscl) && tsum == 1.0))
+        return INFINITY;
+
+    return bench_dscaled(fabs(x - s), a, nb);
+}
+
+// The largest of the column sums of the nb-by-nb partial sums read from B0.
+static bench_resid_t bench_dreduce_one_check(void *data) {
+    BENCH_CHECK
+    const double *W = (const double*)d->B0;
+    double r = -INFINITY;
+    for (int j = 0; j < nb; j++) {
+        double s = 0.0;
+        for (int i = 0; i < nb; i++)
+            s += W[i + nb*j];
+        r = fmax(r, s);
+    }
+    return bench_dvalues(1, d->value, &r, nb);
+}
+
+//==============================================================================
+// Cholesky and triangular
+// L L^T = A0 on the lower triangle.
+static bench_resid_t bench_dpotrf_check(void *data) {
+    BENCH_CHECK
+    double *L = bench_dmalloc(2*tile);
+    double *X = &L[tile];
+    bench_dtri(CoreBlasLower, nb, d->A, nb, L, nb);
+    coreblas_dgemm(CoreBlasNoTrans, CoreBlasTrans, nb, nb, nb,
+                   zone, L, nb, L, nb, 0.0, X, nb);
+    double resid = bench_dresid(CoreBlasLower, nb, nb, X, nb, d->A0, nb);
+    free(L);
+    return resid;
+}
+
+// L0 inv(L0) = I.
+static bench_resid_t bench_dtrtri_check(void *data) {
+    BENCH_CHECK
+    double *L = bench_dmalloc(4*tile);
+    double *Y = &L[tile];
+    double *X = &L[2*tile];
+    double *E = &L[3*tile];
+    bench_dtri(CoreBlasLower, nb, d->A0, nb, L, nb);
+    bench_dtri(CoreBlasLower, nb, d->A, nb, Y, nb);
+    coreblas_dgemm(CoreBlasNoTrans, CoreBlasNoTrans, nb, nb, nb,
+                   zone, L, nb, Y, nb, 0.0, X, nb);
+    for (int j = 0; j < nb; j++)
+        for (int i = 0; i < nb; i++)
+            E[i + nb*j] = i == j ? 1.0 : 0.0;
+    double resid = bench_dresid(CoreBlasGeneral, nb, nb, X, nb, E, nb);
+    free(L);
+    return resid;
+}
+
+// L0^T L0 on the lower triangle.
+static bench_resid_t bench_dlauum_check(void *data) {
+    BENCH_CHECK
+    double *L = bench_dmalloc(2*tile);
+    double *R = &L[tile];
+    bench_dtri(CoreBlasLower, nb, d->A0, nb, L, nb);
+    coreblas_dgemm(CoreBlasTrans, CoreBlasNoTrans, nb, nb, nb,
+                   zone, L, nb, L, nb, 0.0, R, nb);
+    double resid = bench_dresid(CoreBlasLower, nb, nb, d->A, nb, R, nb);
+    free(L);
+    return resid;
+}
+
+// L A L^T = A0 on the lower triangle, where A is symmetric.
+static bench_resid_t bench_dsygst_check(void *data) {
+    BENCH_CHECK
+    double *L = bench_dmalloc(3*tile);
+    double *F = &L[tile];
+    double *X = &L[2*tile];
+    bench_dtri(CoreBlasLower, nb, d->L, nb, L, nb);
+    bench_dfull(1, nb, d->A, nb, F, nb);
+    coreblas_dgemm(CoreBlasNoTrans, CoreBlasNoTrans, nb, nb, nb,
+                   zone, L, nb, F, nb, 0.0, X, nb);
+    coreblas_dgemm(CoreBlasNoTrans, CoreBlasTrans, nb, nb, nb,
+                   zone, X, nb, L, nb, 0.0, F, nb);
+    double resid = bench_dresid(CoreBlasLower, nb, nb, F, nb, d->A0, nb);
+    free(L);
+    return resid;
+}
+
+//==============================================================================
+// LU
+// L U = P B0.
+static bench_resid_t bench_dgetrf_check(void *data) {
+    BENCH_CHECK
+    double *L = bench_dmalloc(4*tile);
+    double *U = &L[tile];
+    double *X = &L[2*tile];
+    double *R = &L[3*tile];
+    bench_dtri(CoreBlasLower, nb, d->B, nb, L, nb);
+    bench_dtri(CoreBlasUpper, nb, d->B, nb, U, nb);
+    for (int i = 0; i < nb; i++)
+        L[i + nb*i] = 1.0;
+    coreblas_dgemm(CoreBlasNoTrans, CoreBlasNoTrans, nb, nb, nb,
+                   zone, L, nb, U, nb, 0.0, X, nb);
+    memcpy(R, d->B0, tile*sizeof(double));
+    bench_dpivot(nb, d->ipiv, R, nb);
+    double resid = bench_dresid(CoreBlasGeneral, nb, nb, X, nb, R, nb);
+    free(L);
+    return resid;
+}
+
+static bench_resid_t bench_dgetrf_calu_check(void *data) {
+    return bench_dgetrf_check(data);
+}
+
+// The first entry of B0 of largest |re| + |im| in column major order.
+static bench_resid_t bench_idamax_tile_check(void *data) {
+    BENCH_CHECK
+    double r = -1.0;
+    for (size_t i = 0; i < tile; i++) {
+        double a = fabs(creal(d->B0[i])) + fabs(cimag(d->B0[i]));
+        if (a > r)
+            r = a;
+    }
+    return d->value[0] == r ? 0.0 : INFINITY;
+}
+
+static bench_resid_t bench_dgeswp_check(void *data) {
+    BENCH_CHECK
+    double *R = bench_dmalloc(tile);
+    memcpy(R, d->C0, tile*sizeof(double));
+    bench_dpivot(nb, d->ipiv, R, nb);
+    double resid = bench_dresid(CoreBlasGeneral, nb, nb, d->C, nb, R, nb);
+    free(R);
+    return resid;
+}
+
+static bench_resid_t bench_dgeswp_blocked_check(void *data) {
+    return bench_dgeswp_check(data);
+}
+
+//==============================================================================
+// QR and LQ
+// Q R = B0, with R the upper triangle of B.
+static bench_resid_t bench_dgeqrt_check(void *data) {
+    BENCH_CHECK
+    double *R = bench_dmalloc(tile);
+    bench_dtri(CoreBlasUpper, nb, d->B, nb, R, nb);
+    bench_dunm_ref(CoreBlasLeft, CoreBlasNoTrans, CoreBlasColumnwise,
+                   nb, nb, nb, ib, d->B, nb, d->T, ib, R, nb);
+    double resid = bench_dresid(CoreBlasGeneral, nb, nb, R, nb, d->B0, nb);
+    free(R);
+    return resid;
+}
+
+// L Q = B0, with L the lower triangle of B.
+static bench_resid_t bench_dgelqt_check(void *data) {
+    BENCH_CHECK
+    double *L = bench_dmalloc(tile);
+    bench_dtri(CoreBlasLower, nb, d->B, nb, L, nb);
+    bench_dunm_ref(CoreBlasRight, CoreBlasNoTrans, CoreBlasRowwise,
+                   nb, nb, nb, ib, d->B, nb, d->T, ib, L, nb);
+    double resid = bench_dresid(CoreBlasGeneral, nb, nb, L, nb, d->B0, nb);
+    free(L);
+    return resid;
+}
+
+// Rebuilds the pair (A0, B0) factored into the triangle uplo of A and the
+// reflectors in B, and compares it on the triangle of A0 and on B0, or its
+// triangle uplo for the tt kernels.
+static double bench_dts_fact_check(bench_ddata_t *d, coreblas_enum_t side,
+                                   coreblas_enum_t direct,
+                                   coreblas_enum_t storev,
+                                   coreblas_enum_t uplo, int tri)
+{
+    int nb = d->nb;
+    size_t tile = (size_t)nb*nb;
+    double *X1 = bench_dmalloc(2*tile);
+    double *X2 = &X1[tile];
+    bench_dtri(uplo, nb, d->A, nb, X1, nb);
+    memset(X2, 0, tile*sizeof(double));
+    bench_dts_ref(side, CoreBlasNoTrans, direct, storev, tri,
+                  nb, nb, X1, nb, nb, nb, X2, nb, nb, d->ib,
+                  d->B, nb, d->T, d->ib);
+    double resid1 = bench_dresid(uplo, nb, nb, X1, nb, d->A0, nb);
+    double resid2 = bench_dresid(tri ? uplo : CoreBlasGeneral, nb, nb,
+                                 X2, nb, d->B0, nb);
+    free(X1);
+    return fmax(resid1, resid2);
+}
+
+static bench_resid_t bench_dtsqrt_check(void *data) {
+    return bench_dts_fact_check((bench_ddata_t*)data, CoreBlasLeft,
+                                CoreBlasForward, CoreBlasColumnwise,
+                                CoreBlasUpper, 0);
+}
+
+static bench_resid_t bench_dtsqrt_rec_check(void *data) {
+    return bench_dtsqrt_check(data);
+}
+
+static bench_resid_t bench_dtslqt_check(void *data) {
+    return bench_dts_fact_check((bench_ddata_t*)data, CoreBlasRight,
+                                CoreBlasForward, CoreBlasRowwise,
+                                CoreBlasLower, 0);
+}
+
+static bench_resid_t bench_dtsqlt_check(void *data) {
+    return bench_dts_fact_check((bench_ddata_t*)data, CoreBlasLeft,
+                                CoreBlasBackward, CoreBlasColumnwise,
+                                CoreBlasLower, 0);
+}
+
+static bench_resid_t bench_dtsrqt_check(void *data) {
+    return bench_dts_fact_check((bench_ddata_t*)data, CoreBlasRight,
+                                CoreBlasBackward, CoreBlasRowwise,
+                                CoreBlasUpper, 0);
+}
+
+static bench_resid_t bench_dttqrt_check(void *data) {
+    return bench_dts_fact_check((bench_ddata_t*)data, CoreBlasLeft,
+                                CoreBlasForward, CoreBlasColumnwise,
+                                CoreBlasUpper, 1);
+}
+
+static bench_resid_t bench_dttqrt_rec_check(void *data) {
+    return bench_dttqrt_check(data);
+}
+
+static bench_resid_t bench_dttlqt_check(void *data) {
+    return bench_dts_fact_check((bench_ddata_t*)data, CoreBlasRight,
+                                CoreBlasForward, CoreBlasRowwise,
+                                CoreBlasLower, 1);
+}
+
+// op(Q) C0, with k reflectors of the geqrt or gelqt factorization.
+static double bench_dunm_check(bench_ddata_t *d, coreblas_enum_t storev,
+                               int k, const double *V,
+                               const double *T)
+{
+    int nb = d->nb;
+    size_t tile = (size_t)nb*nb;
+    double *R = bench_dmalloc(tile);
+    memcpy(R, d->C0, tile*sizeof(double));
+    bench_dunm_ref(CoreBlasLeft, CoreBlasTrans, storev,
+                   nb, nb, k, d->ib, V, nb, T, d->ib, R, nb);
+    double resid = bench_dresid(CoreBlasGeneral, nb, nb, d->C, nb, R, nb);
+    free(R);
+    return resid;
+}
+
+static bench_resid_t bench_dormqr_check(void *data) {
+    bench_ddata_t *d = (bench_ddata_t*)data;
+    return bench_dunm_check(d, CoreBlasColumnwise, d->nb, d->Vqr, d->Tqr);
+}
+
+static bench_resid_t bench_dormlq_check(void *data) {
+    bench_ddata_t *d = (bench_ddata_t*)data;
+    return bench_dunm_check(d, CoreBlasRowwise, d->nb, d->Vlq, d->Tlq);
+}
+
+// op(Q) applied to the first m1 rows of B0 over C0, compared with B and C.
+static double bench_dts_update_check(bench_ddata_t *d, int m1, int k,
+                                     coreblas_enum_t direct,
+                                     coreblas_enum_t storev, int tri,
+                                     const double *V,
+                                     const double *T,
+                                     const double *B,
+                                     const double *C)
+{
+    int nb = d->nb;
+    size_t tile = (size_t)nb*nb;
+    double *R1 = bench_dmalloc(2*tile);
+    double *R2 = &R1[tile];
+    memcpy(R1, d->B0, tile*sizeof(double));
+    memcpy(R2, d->C0, tile*sizeof(double));
+    bench_dts_ref(CoreBlasLeft, CoreBlasTrans, direct, storev, tri,
+                  m1, nb, R1, nb, nb, nb, R2, nb, k, d->ib, V, nb, T, d->ib);
+    double resid = fmax(
+        bench_dresid(CoreBlasGeneral, nb, nb, B, nb, R1, nb),
+        bench_dresid(CoreBlasGeneral, nb, nb, C, nb, R2, nb));
+    free(R1);
+    return resid;
+}
+
+static bench_resid_t bench_dtsmqr_check(void *data) {
+    bench_ddata_t *d = (bench_ddata_t*)data;
+    return bench_dts_update_check(d, d->nb, d->nb, CoreBlasForward,
+                                  CoreBlasColumnwise, 0, d->Vts, d->Tts,
+                                  d->B, d->C);
+}
+
+static bench_resid_t bench_dtsmlq_check(void *data) {
+    bench_ddata_t *d = (bench_ddata_t*)data;
+    return bench_dts_update_check(d, d->nb, d->nb, CoreBlasForward,
+                                  CoreBlasRowwise, 0, d->Vtsl, d->Ttsl,
+                                  d->B, d->C);
+}
+
+static bench_resid_t bench_dtsmql_check(void *data) {
+    bench_ddata_t *d = (bench_ddata_t*)data;
+    return bench_dts_update_check(d, d->nb, d->nb, CoreBlasBackward,
+                                  CoreBlasColumnwise, 0, d->Vtsb, d->Ttsb,
+                                  d->B, d->C);
+}
+
+static bench_resid_t bench_dtsmrq_check(void *data) {
+    bench_ddata_t *d = (bench_ddata_t*)data;
+    return bench_dts_update_check(d, d->nb, d->nb, CoreBlasBackward,
+                                  CoreBlasRowwise, 0, d->Vtsr, d->Ttsr,
+                                  d->B, d->C);
+}
+
+static bench_resid_t bench_dttmqr_check(void *data) {
+    bench_ddata_t *d = (bench_ddata_t*)data;
+    return bench_dts_update_check(d, d->nb, d->nb, CoreBlasForward,
+                                  CoreBlasColumnwise, 1, d->Vtt, d->Ttt,
+                                  d->B, d->C);
+}
+
+static bench_resid_t bench_dttmlq_check(void *data) {
+    bench_ddata_t *d = (bench_ddata_t*)data;
+    return bench_dts_update_check(d, d->nb, d->nb, CoreBlasForward,
+                                  CoreBlasRowwise, 1, d->Vttl, d->Tttl,
+                                  d->B, d->C);
+}
+
+static bench_resid_t bench_dparfb_check(void *data) {
+    bench_ddata_t *d = (bench_ddata_t*)data;
+    return bench_dts_update_check(d, d->ib, d->ib, CoreBlasForward,
+                                  CoreBlasColumnwise, 0, d->Vts, d->Tts,
+                                  d->B, d->C);
+}
+
+// W = B0(0:ib,:) + V(:,0:ib)^T C0.
+static bench_resid_t bench_dpamm_check(void *data) {
+    BENCH_CHECK
+    double *R = bench_dmalloc((size_t)ib*nb);
+    coreblas_dlacpy(CoreBlasGeneral, CoreBlasNoTrans, ib, nb,
+                    d->B0, nb, R, ib);
+    coreblas_dgemm(CoreBlasTrans, CoreBlasNoTrans, ib, nb, nb,
+                   zone, d->Vts, nb, d->C0, nb, zone, R, ib);
+    double resid = bench_dresid(CoreBlasGeneral, ib, nb, d->work, ib, R, ib);
+    free(R);
+    return resid;
+}
+
+// The first column of C0 + V^T B0.
+static bench_resid_t bench_dpemv_check(void *data) {
+    BENCH_CHECK
+    double *r = bench_dmalloc(nb);
+    for (int j = 0; j < nb; j++) {
+        r[j] = d->C0[j];
+        for (int i = 0; i < nb; i++)
+            r[j] += (d->Vts[i + nb*j])*d->B0[i];
+    }
+    double resid = bench_dresid(CoreBlasGeneral, nb, 1, d->C, nb, r, nb);
+    free(r);
+    return resid;
+}
+
+// Every side and trans for one storev/direct case, against LAPACKE larfb
+// with the same V and T.
+static double bench_dlarfb_gemm_cases(bench_ddata_t *d,
+                                      coreblas_enum_t direct,
+                                      coreblas_enum_t storev,
+                                      const double *V,
+                                      const double *T,
+                                      int ldt)
+{
+    int nb = d->nb;
+    int ib = d->ib;
+    size_t tile = (size_t)nb*nb;
+    coreblas_enum_t sides[] = { CoreBlasLeft, CoreBlasRight };
+    coreblas_enum_t transs[] = { CoreBlasNoTrans, CoreBlasTrans };
+    double *R = bench_dmalloc(tile);
+    double resid = 0.0;
+    for (int s = 0; s < 2; s++) {
+        for (int t = 0; t < 2; t++) {
+            memcpy(d->C, d->C0, tile*sizeof(double));
+            memcpy(R, d->C0, tile*sizeof(double));
+            coreblas_dlarfb_gemm(sides[s], transs[t], direct, storev,
+                                 nb, nb, ib, V, nb, T, ldt,
+                                 d->C, nb, d->work, nb);
+            bench_dlarfb(sides[s], transs[t], direct, storev,
+                         nb, nb, ib, V, nb, T, ldt, R, nb);
+            double r = bench_dresid(CoreBlasGeneral, nb, nb, d->C, nb, R, nb);
+            resid = r > resid ? r : resid;
+        }
+    }
+    free(R);
+    return resid;
+}
+
+static bench_resid_t bench_dlarfb_gemm_check(void *data) {
+    bench_ddata_t *d = (bench_ddata_t*)data;
+    double resid = bench_dunm_check(d, CoreBlasColumnwise, d->ib,
+                                    d->Vqr, d->Tqr);
+    double rcases = bench_dlarfb_gemm_cases(d, CoreBlasForward,
+                                            CoreBlasColumnwise,
+                                            d->Vqrx, d->Tqr, d->ib);
+    return rcases > resid ? rcases : resid;
+}
+
+static bench_resid_t bench_dlarfb_gemm_rowfwd_check(void *data) {
+    bench_ddata_t *d = (bench_ddata_t*)data;
+    return bench_dlarfb_gemm_cases(d, CoreBlasForward, CoreBlasRowwise,
+                                   d->Vlqx, d->Tlq, d->ib);
+}
+
+static bench_resid_t bench_dlarfb_gemm_colbwd_check(void *data) {
+    bench_ddata_t *d = (bench_ddata_t*)data;
+    return bench_dlarfb_gemm_cases(d, CoreBlasBackward, CoreBlasColumnwise,
+                                   d->Vcbx, d->B0, d->nb);
+}
+
+static bench_resid_t bench_dlarfb_gemm_rowbwd_check(void *data) {
+    bench_ddata_t *d = (bench_ddata_t*)data;
+    return bench_dlarfb_gemm_cases(d, CoreBlasBackward, CoreBlasRowwise,
+                                   d->Vrbx, d->B0, d->nb);
+}
+
+static bench_resid_t bench_dlarft_check(void *data) {
+    BENCH_CHECK
+    double *R = bench_dmalloc(tile);
+#ifdef COREBLAS_USE_64BIT_BLAS
+    LAPACKE_dlarft_work64_(LAPACK_COL_MAJOR, 'F', 'C', nb, nb,
+                           d->Vqr, nb, d->tauqr, R, nb);
+#else
+    LAPACKE_dlarft_work(LAPACK_COL_MAJOR, 'F', 'C', nb, nb,
+                        d->Vqr, nb, d->tauqr, R, nb);
+#endif
+    double resid = bench_dresid(CoreBlasUpper, nb, nb, d->C, nb, R, nb);
+    free(R);
+    return resid;
+}
+
+//==============================================================================
+// Batched kernels
+// The batch is not reset before the timed calls, which accumulate on it:
+// the checks reset it, repeat the call and compare every tile.
+static void bench_dreset_batch(bench_ddata_t *d)
+{
+    size_t tile = (size_t)d->nb*d->nb;
+    for (int i = 0; i < d->batch; i++) {
+        memcpy(d->Abp[i], d->B0, tile*sizeof(double));
+        memcpy(d->Cbp[i], d->C0, tile*sizeof(double));
+        memcpy(d->Dbp[i], d->B0, tile*sizeof(double));
+    }
+}
+
+static bench_resid_t bench_dgemm_batched_check(void *data) {
+    BENCH_CHECK
+    bench_dreset_batch(d);
+    if (bench_dgemm_batched_call(data) != 0)
+        return INFINITY;
+    double *R = bench_dmalloc(tile);
+    memcpy(R, d->C0, tile*sizeof(double));
+    coreblas_dgemm(CoreBlasNoTrans, CoreBlasNoTrans, nb, nb, nb,
+                   zmone, d->B0, nb, d->B0, nb, zone, R, nb);
+    double resid = 0.0;
+    for (int i = 0; i < d->batch; i++) {
+        resid = fmax(resid, bench_dresid(CoreBlasGeneral, nb, nb,
+                                         d->Cbp[i], nb, R, nb));
+    }
+    free(R);
+    return resid;
+}
+
+static bench_resid_t bench_dgeqrt_batched_check(void *data) {
+    BENCH_CHECK
+    bench_dreset_batch(d);
+    if (bench_dgeqrt_batched_call(data) != 0)
+        return INFINITY;
+    double *R = bench_dmalloc(tile);
+    double resid = 0.0;
+    for (int i = 0; i < d->batch; i++) {
+        bench_dtri(CoreBlasUpper, nb, d->Abp[i], nb, R, nb);
+        bench_dunm_ref(CoreBlasLeft, CoreBlasNoTrans, CoreBlasColumnwise,
+                       nb, nb, nb, ib, d->Abp[i], nb, d->Tbp[i], ib, R, nb);
+        resid = fmax(resid, bench_dresid(CoreBlasGeneral, nb, nb,
+                                         R, nb, d->B0, nb));
+    }
+    free(R);
+    return resid;
+}
+
+static bench_resid_t bench_dtsmqr_batched_check(void *data) {
+    BENCH_CHECK
+    bench_dreset_batch(d);
+    if (bench_dtsmqr_batched_call(data) != 0)
+        return INFINITY;
+    double resid = 0.0;
+    for (int i = 0; i < d->batch; i++) {
+        resid = fmax(resid, bench_dts_update_check(
+            d, nb, nb, CoreBlasForward, CoreBlasColumnwise, 0,
+            d->Vts, d->Tts, d->Dbp[i], d->Cbp[i]));
+    }
+    return resid;
+}
+
+static bench_resid_t bench_dtsmqr_row_check(void *data) {
+    BENCH_CHECK
+    bench_dreset_batch(d);
+    if (bench_dtsmqr_row_call(data) != 0)
+        return INFINITY;
+    double resid = 0.0;
+    for (int i = 0; i < d->batch; i++) {
+        resid = fmax(resid, bench_dts_update_check(
+            d, nb, nb, CoreBlasForward, CoreBlasColumnwise, 0,
+            d->Vts, d->Tts, d->Dbp[i], d->Cbp[i]));
+    }
+    return resid;
+}
+
+//==============================================================================
+// Two-sided and band reductions
+// P A0 P^T on the lower triangle.
+static bench_resid_t bench_dsyswp_check(void *data) {
+    BENCH_CHECK
+    double *R = bench_dmalloc(tile);
+    memcpy(R, d->A0, tile*sizeof(double));
+    for (int i = 0; i < nb; i++) {
+        int p = d->ipiv[i]-1;
+        for (int j = 0; p != i && j < nb; j++) {
+            double x = R[i + nb*j];
+            R[i + nb*j] = R[p + nb*j];
+            R[p + nb*j] = x;
+        }
+        for (int j = 0; p != i && j < nb; j++) {
+            double x = R[j + nb*i];
+            R[j + nb*i] = R[j + nb*p];
+            R[j + nb*p] = x;
+        }
+    }
+    double resid = bench_dresid(CoreBlasLower, nb, nb, d->A, nb, R, nb);
+    free(R);
+    return resid;
+}
+
+// Q^T A0 Q on the lower triangle.
+static bench_resid_t bench_dsyrfb_check(void *data) {
+    BENCH_CHECK
+    double *R = bench_dmalloc(tile);
+    memcpy(R, d->A0, tile*sizeof(double));
+    bench_dunm_ref(CoreBlasLeft, CoreBlasTrans, CoreBlasColumnwise,
+                   nb, nb, nb, ib, d->Vqr, nb, d->Tqr, ib, R, nb);
+    bench_dunm_ref(CoreBlasRight, CoreBlasNoTrans, CoreBlasColumnwise,
+                   nb, nb, nb, ib, d->Vqr, nb, d->Tqr, ib, R, nb);
+    double resid = bench_dresid(CoreBlasLower, nb, nb, d->A, nb, R, nb);
+    free(R);
+    return resid;
+}
+
+// The tsmqr update of (B0^T, C0), with B compared with the conjugate
+// transpose of the top tile.
+static bench_resid_t bench_dtsmqr_sytra1_check(void *data) {
+    BENCH_CHECK
+    double *R1 = bench_dmalloc(3*tile);
+    double *R2 = &R1[tile];
+    double *X1 = &R1[2*tile];
+    for (int j = 0; j < nb; j++) {
+        for (int i = 0; i < nb; i++) {
+            R1[i + nb*j] = (d->B0[j + nb*i]);
+            X1[i + nb*j] = (d->B[j + nb*i]);
+        }
+    }
+    memcpy(R2, d->C0, tile*sizeof(double));
+    bench_dts_ref(CoreBlasLeft, CoreBlasTrans, CoreBlasForward,
+                  CoreBlasColumnwise, 0, nb, nb, R1, nb, nb, nb, R2, nb,
+                  nb, ib, d->Vts, nb, d->Tts, ib);
+    double resid = fmax(
+        bench_dresid(CoreBlasGeneral, nb, nb, X1, nb, R1, nb),
+        bench_dresid(CoreBlasGeneral, nb, nb, d->C, nb, R2, nb));
+    free(R1);
+    return resid;
+}
+
+// Q^T M Q, where M is the symmetric matrix of the lower triangles of A0 and
+// B0 on the diagonal and C0 below.
+static bench_resid_t bench_dtsmqr_corner_check(void *data) {
+    BENCH_CHECK
+    int n2 = 2*nb;
+    double *M = bench_dmalloc(4*tile);
+    double *F = bench_dmalloc(tile);
+    bench_dfull(1, nb, d->A0, nb, F, nb);
+    coreblas_dlacpy(CoreBlasGeneral, CoreBlasNoTrans, nb, nb, F, nb, M, n2);
+    bench_dfull(1, nb, d->B0, nb, F, nb);
+    coreblas_dlacpy(CoreBlasGeneral, CoreBlasNoTrans, nb, nb,
+                    F, nb, &M[nb + n2*nb], n2);
+    for (int j = 0; j < nb; j++) {
+        for (int i = 0; i < nb; i++) {
+            M[(nb+i) + n2*j] = d->C0[i + nb*j];
+            M[j + n2*(nb+i)] = (d->C0[i + nb*j]);
+        }
+    }
+    bench_dts_ref(CoreBlasLeft, CoreBlasTrans, CoreBlasForward,
+                  CoreBlasColumnwise, 0, nb, n2, M, n2, nb, n2, &M[nb], n2,
+                  nb, ib, d->Vts, nb, d->Tts, ib);
+    bench_dts_ref(CoreBlasRight, CoreBlasNoTrans, CoreBlasForward,
+                  CoreBlasColumnwise, 0, n2, nb, M, n2, n2, nb, &M[n2*nb], n2,
+                  nb, ib, d->Vts, nb, d->Tts, ib);
+    double resid = fmax(fmax(
+        bench_dresid(CoreBlasLower, nb, nb, d->A, nb, M, n2),
+        bench_dresid(CoreBlasGeneral, nb, nb, d->C, nb, &M[nb], n2)),
+        bench_dresid(CoreBlasLower, nb, nb, d->B, nb, &M[nb + n2*nb], n2));
+    free(M);
+    free(F);
+    return resid;
+}
+
+// The chase is a orthogonal two-sided transformation of the band: it keeps the
+// Frobenius norms of the band and of its Gram matrix, and leaves the first
+// ncol columns and rows lower bidiagonal.
+static double bench_dband_check(bench_ddata_t *d,
+                                const double *band, int ncol)
+{
+    int nb = d->nb;
+    double *D = bench_dmalloc((size_t)nb*nb);
+    bench_dband_dense(d, band, D);
+    double off = 0.0;
+    for (int j = 0; j < nb; j++) {
+        for (int i = 0; i < nb; i++) {
+            if ((i < ncol || j < ncol) && i != j && i != j+1)
+                off += fabs(D[i + nb*j])*fabs(D[i + nb*j]);
+        }
+    }
+    free(D);
+    double fro, fro2;
+    bench_dband_norms(d, band, &fro, &fro2);
+    return fmax(fmax(
+        bench_dscaled(fabs(fro - d->band_fro), d->band_fro, nb),
+        bench_dscaled(fabs(fro2 - d->band_fro2), d->band_fro2, nb)),
+        bench_dscaled(sqrt(off), d->band_fro, nb));
+}
+
+// A task leaves a part of its update to the next ones: the first sweep is
+// completed from the task t on before the check.
+static double bench_dsweep_check(bench_ddata_t *d, int t)
+{
+    int ntask = coreblas_bulge_ntask(d->nb, d->bw, 0);
+    for (int s = t+1; s <= ntask; s++)
+        bench_dgbtype(d, s, d->band[t-1], d->vband[t-1]);
+    return bench_dband_check(d, d->band[t-1], 1);
+}
+
+static bench_resid_t bench_dgbtype1cb_check(void *data) {
+    return bench_dsweep_check((bench_ddata_t*)data, 1);
+}
+
+static bench_resid_t bench_dgbtype2cb_check(void *data) {
+    return bench_dsweep_check((bench_ddata_t*)data, 2);
+}
+
+static bench_resid_t bench_dgbtype3cb_check(void *data) {
+    return bench_dsweep_check((bench_ddata_t*)data, 3);
+}
+
+static bench_resid_t bench_dgbbrd_static_check(void *data) {
+    bench_ddata_t *d = (bench_ddata_t*)data;
+    return bench_dband_check(d, d->band[3], d->nb);
+}
+
+/******************************************************************************/
+static bench_flops_t bench_dnone_flops(int nb, int ib)
+{
+    return 0.0;
+}
+
+#define BENCH_ROUTINE(name, flops, check) \
+    { #name, bench_##name##_call, flops, check }
+
+static const bench_routine_t bench_droutines[] = {
+    // Level 3 BLAS
+    BENCH_ROUTINE(dgemm,   bench_dgemm_flops, bench_dgemm_check),
+    BENCH_ROUTINE(dgemm_batched, bench_dgemm_batched_flops,
+                  bench_dgemm_batched_check),
+#ifdef COMPLEX
+    BENCH_ROUTINE(dsymm,   bench_dsymm_flops, bench_dsymm_check),
+    BENCH_ROUTINE(dsyrk,   bench_dsyrk_flops, bench_dsyrk_check),
+    BENCH_ROUTINE(dsyr2k,  bench_dsyr2k_flops, bench_dsyr2k_check),
+#endif
+    BENCH_ROUTINE(dsymm,   bench_dsymm_flops, bench_dsymm_check),
+    BENCH_ROUTINE(dsyrk,   bench_dsyrk_flops, bench_dsyrk_check),
+    BENCH_ROUTINE(dsyr2k,  bench_dsyr2k_flops, bench_dsyr2k_check),
+    BENCH_ROUTINE(dtrmm,   bench_dtrmm_flops, bench_dtrmm_check),
+    BENCH_ROUTINE(dtrsm,   bench_dtrsm_flops, bench_dtrsm_check),
+
+    // Auxiliary
+    BENCH_ROUTINE(dgeadd,  bench_dgeadd_flops, bench_dgeadd_check),
+    BENCH_ROUTINE(dtradd,  bench_dtradd_flops, bench_dtradd_check),
+    BENCH_ROUTINE(dlacpy,  bench_dnone_flops, bench_dlacpy_check),
+    BENCH_ROUTINE(dlacpy_lapack2tile_band, bench_dnone_flops,
+                  bench_dlacpy_check),
+    BENCH_ROUTINE(dlacpy_tile2lapack_band, bench_dnone_flops,
+                  bench_dlacpy_check),
+    BENCH_ROUTINE(dlaset,  bench_dnone_flops, bench_dlaset_check),
+    BENCH_ROUTINE(dlascl,  bench_dlascl_flops, bench_dlascl_check),
+    BENCH_ROUTINE(dlange_one, bench_dnorm_flops, bench_dlange_one_check),
+    BENCH_ROUTINE(dlange_inf, bench_dnorm_flops, bench_dlange_inf_check),
+    BENCH_ROUTINE(dlange_fro, bench_dnorm_flops, bench_dlange_fro_check),
+    BENCH_ROUTINE(dlange_max, bench_dnorm_flops, bench_dlange_max_check),
+    BENCH_ROUTINE(dlange_aux_one, bench_dnorm_flops,
+                  bench_dlange_aux_one_check),
+    BENCH_ROUTINE(dlange_aux_inf, bench_dnorm_flops,
+                  bench_dlange_aux_inf_check),
+    BENCH_ROUTINE(dlantr_aux_inf, bench_dnorm_flops,
+                  bench_dlantr_aux_inf_check),
+    BENCH_ROUTINE(dlansy_aux, bench_dnorm_flops, bench_dlansy_aux_check),
+#ifdef COMPLEX
+    BENCH_ROUTINE(dlansy_one, bench_dnorm_flops, bench_dlansy_one_check),
+    BENCH_ROUTINE(dlansy_aux, bench_dnorm_flops, bench_dlansy_aux_check),
+    BENCH_ROUTINE(dsyssq,  bench_dnorm_flops, bench_dsyssq_check),
+#endif
+    BENCH_ROUTINE(dlansy_one, bench_dnorm_flops, bench_dlansy_one_check),
+    BENCH_ROUTINE(dlantr_one, bench_dnorm_flops, bench_dlantr_one_check),
+    BENCH_ROUTINE(dgessq,  bench_dnorm_flops, bench_dgessq_check),
+    BENCH_ROUTINE(dsyssq,  bench_dnorm_flops, bench_dsyssq_check),
+    BENCH_ROUTINE(dtrssq,  bench_dnorm_flops, bench_dtrssq_check),
+    BENCH_ROUTINE(dreduce_ssq, bench_dnorm_flops, bench_dreduce_ssq_check),
+    BENCH_ROUTINE(dreduce_one, bench_dnorm_flops, bench_dreduce_one_check),
+
+    // Cholesky and triangular
+    BENCH_ROUTINE(dpotrf,  bench_dpotrf_flops, bench_dpotrf_check),
+    BENCH_ROUTINE(dtrtri,  bench_dtrtri_flops, bench_dtrtri_check),
+    BENCH_ROUTINE(dlauum,  bench_dlauum_flops, bench_dlauum_check),
+    BENCH_ROUTINE(dsygst,  bench_dsygst_flops, bench_dsygst_check),
+
+    // LU
+    BENCH_ROUTINE(dgetrf,  bench_dgetrf_flops, bench_dgetrf_check),
+    BENCH_ROUTINE(dgetrf_calu, bench_dgetrf_flops, bench_dgetrf_calu_check),
+    BENCH_ROUTINE(idamax_tile, bench_dnorm_flops, bench_idamax_tile_check),
+    BENCH_ROUTINE(dgeswp,  bench_dnone_flops, bench_dgeswp_check),
+    BENCH_ROUTINE(dgeswp_blocked, bench_dnone_flops,
+                  bench_dgeswp_blocked_check),
+
+    // QR and LQ
+    BENCH_ROUTINE(dgeqrt,  bench_dgeqrt_flops, bench_dgeqrt_check),
+    BENCH_ROUTINE(dgeqrt_batched, bench_dgeqrt_batched_flops,
+                  bench_dgeqrt_batched_check),
+    BENCH_ROUTINE(dgelqt,  bench_dgelqt_flops, bench_dgelqt_check),
+    BENCH_ROUTINE(dtsqrt,  bench_dtsqrt_flops, bench_dtsqrt_check),
+    BENCH_ROUTINE(dtsqrt_rec, bench_dtsqrt_flops, bench_dtsqrt_rec_check),
+    BENCH_ROUTINE(dtslqt,  bench_dtsqrt_flops, bench_dtslqt_check),
+    BENCH_ROUTINE(dtsqlt,  bench_dtsqrt_flops, bench_dtsqlt_check),
+    BENCH_ROUTINE(dtsrqt,  bench_dtsqrt_flops, bench_dtsrqt_check),
+    BENCH_ROUTINE(dttqrt,  bench_dttqrt_flops, bench_dttqrt_check),
+    BENCH_ROUTINE(dttqrt_rec, bench_dttqrt_flops, bench_dttqrt_rec_check),
+    BENCH_ROUTINE(dttlqt,  bench_dttqrt_flops, bench_dttlqt_check),
+    BENCH_ROUTINE(dormqr,  bench_dormqr_flops, bench_dormqr_check),
+    BENCH_ROUTINE(dormlq,  bench_dormqr_flops, bench_dormlq_check),
+    BENCH_ROUTINE(dtsmqr,  bench_dtsmqr_flops, bench_dtsmqr_check),
+    BENCH_ROUTINE(dtsmqr_batched, bench_dtsmqr_batched_flops,
+                  bench_dtsmqr_batched_check),
+    BENCH_ROUTINE(dtsmqr_row, bench_dtsmqr_batched_flops,
+                  bench_dtsmqr_row_check),
+    BENCH_ROUTINE(dtsmlq,  bench_dtsmqr_flops, bench_dtsmlq_check),
+    BENCH_ROUTINE(dtsmql,  bench_dtsmqr_flops, bench_dtsmql_check),
+    BENCH_ROUTINE(dtsmrq,  bench_dtsmqr_flops, bench_dtsmrq_check),
+    BENCH_ROUTINE(dttmqr,  bench_dttmqr_flops, bench_dttmqr_check),
+    BENCH_ROUTINE(dttmlq,  bench_dttmqr_flops, bench_dttmlq_check),
+    BENCH_ROUTINE(dparfb,  bench_dparfb_flops, bench_dparfb_check),
+    BENCH_ROUTINE(dpamm,   bench_dpamm_flops, bench_dpamm_check),
+    BENCH_ROUTINE(dpemv,   bench_dpemv_flops, bench_dpemv_check),
+    BENCH_ROUTINE(dlarfb_gemm, bench_dlarfb_gemm_flops,
+                  bench_dlarfb_gemm_check),
+    BENCH_ROUTINE(dlarfb_gemm_rowfwd, bench_dlarfb_gemm_flops,
+                  bench_dlarfb_gemm_rowfwd_check),
+    BENCH_ROUTINE(dlarfb_gemm_colbwd, bench_dlarfb_gemm_flops,
+                  bench_dlarfb_gemm_colbwd_check),
+    BENCH_ROUTINE(dlarfb_gemm_rowbwd, bench_dlarfb_gemm_flops,
+                  bench_dlarfb_gemm_rowbwd_check),
+    BENCH_ROUTINE(dlarft,  bench_dlarft_flops, bench_dlarft_check),
+
+    // Two-sided and band reductions
+    BENCH_ROUTINE(dsyswp,  bench_dnone_flops, bench_dsyswp_check),
+    BENCH_ROUTINE(dsyrfb,  bench_dsyrfb_flops, bench_dsyrfb_check),
+    BENCH_ROUTINE(dtsmqr_sytra1, bench_dtsmqr_flops,
+                  bench_dtsmqr_sytra1_check),
+    BENCH_ROUTINE(dtsmqr_corner, bench_dtsmqr_corner_flops,
+                  bench_dtsmqr_corner_check),
+    BENCH_ROUTINE(dgbtype1cb, bench_dnone_flops, bench_dgbtype1cb_check),
+    BENCH_ROUTINE(dgbtype2cb, bench_dnone_flops, bench_dgbtype2cb_check),
+    BENCH_ROUTINE(dgbtype3cb, bench_dnone_flops, bench_dgbtype3cb_check),
+    BENCH_ROUTINE(dgbbrd_static, bench_dnone_flops,
+                  bench_dgbbrd_static_check),
+
+    { NULL, NULL, NULL, NULL }
+};
+
+/******************************************************************************/
+const bench_precision_t bench_d = {
+    bench_droutines,
+    bench_dcreate,
+    bench_dreset,
+    bench_ddestroy,
+};
@@ -0,0 +1,194 @@
+/**
+ *
+ * @file
+ *
+ *  COREBLAS is a software package provided by:
+ *  University of Tennessee, US,
+ *  University of Manchester, UK.
+ *
+ * @generated from bench/bench_zc.c, mixed zc -> ds, Fri Oct 16 03:37:07 2026
+ *
+ **/
+
+#include "bench.h"
+#include "flops.h"
+
+#include <coreblas.h>
+#include "core_lapack.h"
+
+#include <math.h>
+#include <stdlib.h>
+#include <string.h>
+
+#define REAL
+
+/******************************************************************************/
+typedef struct {
+    int nb;
+    double *A;
+    float *As;
+    double *B;     ///< right-hand sides of the residual
+    double *C;     ///< residual
+    double *R;     ///< reference residual
+    double *work;
+} bench_dsdata_t;
+
+/******************************************************************************/
+static void *bench_dscreate(int nb, int ib)
+{
+    bench_dsdata_t *d = (bench_dsdata_t*)calloc(1, sizeof(bench_dsdata_t));
+    if (d == NULL)
+        return NULL;
+
+    d->nb = nb;
+    d->A  = (double*)malloc(
+        (size_t)nb*nb*sizeof(double));
+    d->As = (float*)malloc(
+        (size_t)nb*nb*sizeof(float));
+    d->B  = (double*)malloc(
+        (size_t)nb*nb*sizeof(double));
+    d->C  = (double*)malloc(
+        (size_t)nb*nb*sizeof(double));
+    d->R  = (double*)malloc(
+        (size_t)nb*nb*sizeof(double));
+    d->work = (double*)malloc(
+        coreblas_dsgemm_lwork(nb, nb)*sizeof(double));
+    if (d->A == NULL || d->As == NULL || d->B == NULL || d->C == NULL ||
+        d->R == NULL || d->work == NULL) {
+        bench_ds.destroy(d);
+        return NULL;
+    }
+    for (size_t i = 0; i < (size_t)nb*nb; i++) {
+        d->A[i]  = (double)(i % 1021)/1021.0 - 0.5;
+        d->As[i] = (float)d->A[i];
+        d->B[i]  = (double)(i % 509)/509.0 - 0.5;
+        d->C[i]  = 0.0;
+    }
+
+    // Reference residual -As*B, with As converted exactly to double.
+    for (size_t i = 0; i < (size_t)nb*nb; i++)
+        d->R[i] = d->As[i];
+    coreblas_dgemm(CoreBlasNoTrans, CoreBlasNoTrans, nb, nb, nb,
+                   -1.0, d->R, nb, d->B, nb, 0.0, d->C, nb);
+    memcpy(d->R, d->C, (size_t)nb*nb*sizeof(double));
+    bench_ds.reset(d);
+    return d;
+}
+
+/******************************************************************************/
+static void bench_dsreset(void *data)
+{
+    bench_dsdata_t *d = (bench_dsdata_t*)data;
+    memset(d->C, 0, (size_t)d->nb*d->nb*sizeof(double));
+}
+
+/******************************************************************************/
+static void bench_dsdestroy(void *data)
+{
+    bench_dsdata_t *d = (bench_dsdata_t*)data;
+    if (d == NULL)
+        return;
+
+    free(d->A);
+    free(d->As);
+    free(d->B);
+    free(d->C);
+    free(d->R);
+    free(d->work);
+    free(d);
+}
+
+/******************************************************************************/
+static int bench_dlag2s_call(void *data)
+{
+    bench_dsdata_t *d = (bench_dsdata_t*)data;
+    return coreblas_dlag2s(d->nb, d->nb, d->A, d->nb, d->As, d->nb);
+}
+
+/******************************************************************************/
+static int bench_slag2d_call(void *data)
+{
+    bench_dsdata_t *d = (bench_dsdata_t*)data;
+    coreblas_slag2d(d->nb, d->nb, d->As, d->nb, d->A, d->nb);
+    return 0;
+}
+
+/******************************************************************************/
+// Residual C = C - As*B with the tile As stored in single precision.
+static int bench_dsgemm_call(void *data)
+{
+    bench_dsdata_t *d = (bench_dsdata_t*)data;
+    return coreblas_dsgemm(CoreBlasNoTrans, CoreBlasNoTrans, d->nb, d->nb, d->nb,
+                           -1.0, d->As, d->nb, d->B, d->nb,
+                            1.0, d->C, d->nb, d->work);
+}
+
+/******************************************************************************/
+// The conversions are exact: to nearest from double, and back.
+static bench_resid_t bench_dlag2s_check(void *data)
+{
+    bench_dsdata_t *d = (bench_dsdata_t*)data;
+    for (size_t i = 0; i < (size_t)d->nb*d->nb; i++) {
+        if (d->As[i] != (float)d->A[i])
+            return INFINITY;
+    }
+    return 0.0;
+}
+
+static bench_resid_t bench_slag2d_check(void *data)
+{
+    bench_dsdata_t *d = (bench_dsdata_t*)data;
+    for (size_t i = 0; i < (size_t)d->nb*d->nb; i++) {
+        if (d->A[i] != (double)d->As[i])
+            return INFINITY;
+    }
+    return 0.0;
+}
+
+// The product is computed in double precision.
+static bench_resid_t bench_dsgemm_check(void *data)
+{
+    bench_dsdata_t *d = (bench_dsdata_t*)data;
+    double err = 0.0;
+    double nrm = 0.0;
+    for (size_t i = 0; i < (size_t)d->nb*d->nb; i++) {
+        double e = cabs(d->C[i] - d->R[i]);
+        double r = cabs(d->R[i]);
+        err += e*e;
+        nrm += r*r;
+    }
+    double eps = LAPACKE_dlamch_work('e');
+    return sqrt(err)/(nrm > 0.0 ? sqrt(nrm) : 1.0)/(d->nb*eps);
+}
+
+/******************************************************************************/
+static bench_flops_t bench_dsnone_flops(int nb, int ib)
+{
+    return 0.0;
+}
+
+static bench_flops_t bench_dsgemm_flops(int nb, int ib)
+{
+    bench_flops_t fmuls = FMULS_GEMM(nb, nb, nb);
+    bench_flops_t fadds = FADDS_GEMM(nb, nb, nb);
+#ifdef COMPLEX
+    return 6.0*fmuls + 2.0*fadds;
+#else
+    return fmuls + fadds;
+#endif
+}
+
+static const bench_routine_t bench_dsroutines[] = {
+    { "dlag2s", bench_dlag2s_call, bench_dsnone_flops, bench_dlag2s_check },
+    { "slag2d", bench_slag2d_call, bench_dsnone_flops, bench_slag2d_check },
+    { "dsgemm", bench_dsgemm_call, bench_dsgemm_flops, bench_dsgemm_check },
+    { NULL, NULL, NULL, NULL }
+};
+
+/******************************************************************************/
+const bench_precision_t bench_ds = {
+    bench_dsroutines,
+    bench_dscreate,
+    bench_dsreset,
+    bench_dsdestroy,
+};
@@ -0,0 +1,2611 @@
+/**
+ *
+ * @file
+ *
+ *  COREBLAS is a software package provided by:
+ *  University of Tennessee, US,
+ *  University of Manchester, UK.
+ *
+ * @generated from bench/bench_z.c, normal z -> s, Fri Oct 16 03:37:07 2026
+ *
+ **/
+
+#include "bench.h"
+#include "flops.h"
+
+#include <coreblas.h>
+#include "core_lapack.h"
+#include "bulge.h"
+
+#include <math.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#define REAL
+
+/***************************************************************************//**
+ *  Tiles shared by all kernels of one precision. All tiles are nb-by-nb with
+ *  leading dimension nb; X0 are pristine copies the working tiles are reset
+ *  from before every timed call.
+ **/
+typedef struct {
+    int nb;
+    int ib;
+
+    float *A;   ///< symmetric positive definite
+    float *B;
+    float *C;
+    float *A0;
+    float *B0;
+    float *C0;
+    float *L;   ///< Cholesky factor of A0
+
+    // Reflectors and T factors produced once by the factorization kernels
+    // and consumed by the update kernels.
+    float *Vqr,  *Tqr;
+    float *Vqrx;   ///< Vqr with its unit triangle explicit
+    float *Vlqx;   ///< Vlq with its unit triangle explicit
+    float *Vcbx, *Vrbx;   ///< explicit backward V of larfb_gemm
+    float *Vlq,  *Tlq;
+    float *Vts,  *Tts;
+    float *Vtt,  *Ttt;
+    float *Vtsl, *Ttsl;
+    float *Vttl, *Tttl;
+    float *Vtsb, *Ttsb;
+    float *Vtsr, *Ttsr;
+
+    float *T;
+    float *tau;
+    float *tauqr;   ///< scalar factors of Vqr
+    int *ipiv;   ///< pivots of the LU factorization of B0
+    float *wcalu;
+    int *iwcalu;
+    int *iwork;
+    float *work;
+    float *dwork;
+    float value[2];
+
+    // Batch of independent tiles for the batched kernels.
+    int batch;
+    float *Ab, *Cb, *Db, *Tb;
+    float **Abp, **Cbp, **Dbp, **Tbp;
+    const float **Vp, **Tp;
+    coreblas_workspace_t wbatch;
+
+    // Lower band of order nb and width bw for the bulge chasing kernels, in
+    // the (3*bw+1)-by-nb storage of the gbtype kernels, with the reflectors
+    // VQ, TAUQ, VP, TAUP of length 2*nb each in vband. Copy i < 3 is worked
+    // on by task i+1 of the first sweep and reset from band0[i], vband0[i]:
+    // the band, the band after task 1, and after task 2. Copy 3 is worked on
+    // by gbbrd_static and reset from the band.
+    int bw;
+    int ldband;
+    float *band[4], *vband[4];
+    float *band0[3], *vband0[3];
+    int *iwband;
+    float band_fro;   ///< Frobenius norm of the band
+    float band_fro2;  ///< Frobenius norm of its Gram matrix
+} bench_sdata_t;
+
+/******************************************************************************/
+// Number of tiles of the batched kernels, about 256K elements per batch.
+static int bench_sbatch(int nb)
+{
+    int batch = (1 << 18)/(nb*nb);
+    return batch > 1 ? batch : 1;
+}
+
+/******************************************************************************/
+static bench_flops_t bench_sflops(bench_flops_t fmuls, bench_flops_t fadds)
+{
+#ifdef COMPLEX
+    return 6.0*fmuls + 2.0*fadds;
+#else
+    return fmuls + fadds;
+#endif
+}
+
+/******************************************************************************/
+static float bench_srand(unsigned long long *seed)
+{
+    // 64-bit linear congruential generator, uniform in [-0.5, 0.5)
+    *seed = *seed*6364136223846793005ULL + 1442695040888963407ULL;
+    return (float)(*seed >> 11)/9007199254740992.0 - 0.5;
+}
+
+/******************************************************************************/
+static void bench_sfill(int m, int n, float *A, int lda,
+                        unsigned long long *seed)
+{
+    for (int j = 0; j < n; j++) {
+        for (int i = 0; i < m; i++) {
+#ifdef COMPLEX
+            float re = bench_srand(seed);
+            float im = bench_srand(seed);
+            A[i + lda*j] = re + im*_Complex_I;
+#else
+            A[i + lda*j] = bench_srand(seed);
+#endif
+        }
+    }
+}
+
+/******************************************************************************/
+// LU factorization of one nb-by-nb tile by a single panel thread.
+static int bench_sgetrf_tile(float *A, int nb, int ib,
+                             int *ipiv)
+{
+    coreblas_desc_t desc;
+    coreblas_desc_general_init(CoreBlasRealFloat, A, nb, nb,
+                               nb, nb, 0, 0, nb, nb, &desc);
+
+    volatile int max_idx;
+    volatile float max_val;
+    volatile int info = 0;
+    coreblas_barrier_t barrier;
+    coreblas_barrier_init(&barrier);
+
+    coreblas_sgetrf(desc, ipiv, ib, 0, 1,
+                    &max_idx, &max_val, &info, &barrier);
+    return info;
+}
+
+/*******************************************************************************
+ *  References for the checks, computed with unblocked loops or with the
+ *  BLAS and LAPACK routines the kernels are meant to match.
+ **/
+static float *bench_smalloc(size_t size)
+{
+    float *A = (float*)malloc(
+        (size > 0 ? size : 1)*sizeof(float));
+    if (A == NULL) {
+        fprintf(stderr, "allocation failed in the check\n");
+        exit(EXIT_FAILURE);
+    }
+    return A;
+}
+
+/******************************************************************************/
+// Error relative to the reference, in units of nb times the machine epsilon.
+static float bench_sscaled(float err, float nrm, int nb)
+{
+    float eps = LAPACKE_slamch_work('e');
+    return err/(nrm > 0.0 ? nrm : 1.0)/(nb*eps);
+}
+
+/******************************************************************************/
+// Scaled Frobenius norm error of the uplo part of the m-by-n matrix X
+// against the reference R.
+static float bench_sresid(coreblas_enum_t uplo, int m, int n,
+                           const float *X, int ldx,
+                           const float *R, int ldr)
+{
+    float err = 0.0;
+    float nrm = 0.0;
+    for (int j = 0; j < n; j++) {
+        int ifirst = uplo == CoreBlasLower ? j : 0;
+        int ilast  = uplo == CoreBlasUpper && j+1 < m ? j+1 : m;
+        for (int i = ifirst; i < ilast; i++) {
+            float e = fabsf(X[i + (size_t)ldx*j] - R[i + (size_t)ldr*j]);
+            float r = fabsf(R[i + (size_t)ldr*j]);
+            err += e*e;
+            nrm += r*r;
+        }
+    }
+    return bench_sscaled(sqrtf(err), sqrtf(nrm), m > n ? m : n);
+}
+
+/******************************************************************************/
+// B = the uplo triangle of A, zero elsewhere.
+static void bench_stri(coreblas_enum_t uplo, int n,
+                       const float *A, int lda,
+                       float *B, int ldb)
+{
+    for (int j = 0; j < n; j++) {
+        for (int i = 0; i < n; i++) {
+            int in = uplo == CoreBlasLower ? i >= j : i <= j;
+            B[i + (size_t)ldb*j] = in ? A[i + (size_t)lda*j] : 0.0;
+        }
+    }
+}
+
+/******************************************************************************/
+// B = the full matrix of which A holds the lower triangle, symmetric if herm
+// and symmetric otherwise; the diagonal is copied as is.
+static void bench_sfull(int herm, int n,
+                        const float *A, int lda,
+                        float *B, int ldb)
+{
+    for (int j = 0; j < n; j++) {
+        B[j + (size_t)ldb*j] = A[j + (size_t)lda*j];
+        for (int i = j+1; i < n; i++) {
+            float a = A[i + (size_t)lda*j];
+            B[i + (size_t)ldb*j] = a;
+            B[j + (size_t)ldb*i] = herm ? (a) : a;
+        }
+    }
+}
+
+/******************************************************************************/
+// Applies the row interchanges of the 1-based pivots ipiv to the n rows of X.
+static void bench_spivot(int n, const int *ipiv,
+                         float *X, int ldx)
+{
+    for (int i = 0; i < n; i++) {
+        int p = ipiv[i]-1;
+        for (int j = 0; p != i && j < n; j++) {
+            float x = X[i + (size_t)ldx*j];
+            X[i + (size_t)ldx*j] = X[p + (size_t)ldx*j];
+            X[p + (size_t)ldx*j] = x;
+        }
+    }
+}
+
+/******************************************************************************/
+static void bench_slarfb(coreblas_enum_t side, coreblas_enum_t trans,
+                         coreblas_enum_t direct, coreblas_enum_t storev,
+                         int m, int n, int k,
+                         const float *V, int ldv,
+                         const float *T, int ldt,
+                               float *C, int ldc)
+{
+    int ldwork = side == CoreBlasLeft ? n : m;
+    float *work = bench_smalloc((size_t)ldwork*k);
+#ifdef COREBLAS_USE_64BIT_BLAS
+    LAPACKE_slarfb_work64_(LAPACK_COL_MAJOR,
+                           lapack_const(side), lapack_const(trans),
+                           lapack_const(direct), lapack_const(storev),
+                           m, n, k, V, ldv, T, ldt, C, ldc, work, ldwork);
+#else
+    LAPACKE_slarfb_work(LAPACK_COL_MAJOR,
+                        lapack_const(side), lapack_const(trans),
+                        lapack_const(direct), lapack_const(storev),
+                        m, n, k, V, ldv, T, ldt, C, ldc, work, ldwork);
+#endif
+    free(work);
+}
+
+/******************************************************************************/
+// V = the k reflectors of order n in A, columnwise (n-by-k) or rowwise
+// (k-by-n), with the unit triangle of larfb_gemm stored explicitly: in the
+// first k positions for forward and in the last k for backward reflectors.
+static void bench_slarfb_v(coreblas_enum_t direct, coreblas_enum_t storev,
+                           int n, int k,
+                           const float *A, int lda,
+                                 float *V, int ldv)
+{
+    int col = storev == CoreBlasColumnwise;
+    int off = direct == CoreBlasForward ? 0 : n-k;
+    for (int q = 0; q < k; q++) {
+        for (int p = 0; p < n; p++) {
+            size_t ij = col ? p + (size_t)ldv*q : q + (size_t)ldv*p;
+            int r = p-off;
+            V[ij] = A[col ? p + (size_t)lda*q : q + (size_t)lda*p];
+            if (r == q)
+                V[ij] = 1.0;
+            else if (r >= 0 && r < k &&
+                     (direct == CoreBlasForward ? r < q : r > q))
+                V[ij] = 0.0;
+        }
+    }
+}
+
+/******************************************************************************/
+// Order of the blocks of reflectors applied by op(Q), as in LAPACK: with
+// rowwise storage, op is swapped, since LAPACK applies the reflectors of
+// an LQ factorization with the transposed block reflector.
+static int bench_sascending(coreblas_enum_t side, coreblas_enum_t transt,
+                            coreblas_enum_t direct)
+{
+    int left = side == CoreBlasLeft;
+    int notran = transt == CoreBlasNoTrans;
+    return direct == CoreBlasForward ? left != notran : left == notran;
+}
+
+static coreblas_enum_t bench_stranst(coreblas_enum_t trans,
+                                     coreblas_enum_t storev)
+{
+    if (storev == CoreBlasColumnwise)
+        return trans;
+    return trans == CoreBlasNoTrans ? CoreBlasTrans : CoreBlasNoTrans;
+}
+
+/******************************************************************************/
+// C = op(Q) C or C op(Q), where Q is given by the k forward reflectors of a
+// geqrt (columnwise) or gelqt (rowwise) factorization with blocking ib.
+static void bench_sunm_ref(coreblas_enum_t side, coreblas_enum_t trans,
+                           coreblas_enum_t storev, int m, int n, int k,
+                           int ib,
+                           const float *V, int ldv,
+                           const float *T, int ldt,
+                                 float *C, int ldc)
+{
+    int left = side == CoreBlasLeft;
+    coreblas_enum_t transt = bench_stranst(trans, storev);
+    int ascend = bench_sascending(side, transt, CoreBlasForward);
+    int nblk = (k+ib-1)/ib;
+    for (int b = 0; b < nblk; b++) {
+        int i = (ascend ? b : nblk-1-b)*ib;
+        int kb = k-i < ib ? k-i : ib;
+        bench_slarfb(side, transt, CoreBlasForward, storev,
+                     left ? m-i : m, left ? n : n-i, kb,
+                     &V[i + (size_t)ldv*i], ldv, &T[(size_t)ldt*i], ldt,
+                     left ? &C[i] : &C[(size_t)ldc*i], ldc);
+    }
+}
+
+/******************************************************************************/
+// Element r of the stack of the kb rows (left) or columns (right) of A1
+// starting at i1 and the whole A2, in the order (A1; A2) for forward and
+// (A2; A1) for backward reflectors; c indexes the other dimension.
+static float *bench_sstack(int left, int forward, int kb,
+                                          int p2, int i1, int r, int c,
+                                          float *A1, int lda1,
+                                          float *A2, int lda2)
+{
+    int r1 = forward ? r : r-p2;
+    int r2 = forward ? r-kb : r;
+    if (r1 >= 0 && r1 < kb) {
+        return left ? &A1[(i1+r1) + (size_t)lda1*c]
+                    : &A1[c + (size_t)lda1*(i1+r1)];
+    }
+    return left ? &A2[r2 + (size_t)lda2*c] : &A2[c + (size_t)lda2*r2];
+}
+
+/******************************************************************************/
+// Applies op(Q) from the side to the pair (A1, A2), where Q is given by the
+// k reflectors of a ts (tri = 0) or tt (tri = 1) factorization with
+// blocking ib, stored in V and T as the factorization kernels leave them.
+// Each block is applied by larfb on an explicit copy of the stacked rows
+// or columns, with the unit part of the reflectors made explicit.
+static void bench_sts_ref(coreblas_enum_t side, coreblas_enum_t trans,
+                          coreblas_enum_t direct, coreblas_enum_t storev,
+                          int tri,
+                          int m1, int n1, float *A1, int lda1,
+                          int m2, int n2, float *A2, int lda2,
+                          int k, int ib,
+                          const float *V, int ldv,
+                          const float *T, int ldt)
+{
+    int left = side == CoreBlasLeft;
+    int forward = direct == CoreBlasForward;
+    int colwise = storev == CoreBlasColumnwise;
+    coreblas_enum_t transt = bench_stranst(trans, storev);
+    int ascend = bench_sascending(side, transt, direct);
+    int p2 = left ? m2 : n2;
+    int q  = left ? n1 : m1;
+    int off = forward ? 0 : (left ? m1 : n1) - k;
+
+    float *S  = bench_smalloc((size_t)(ib+p2)*q);
+    float *Vb = bench_smalloc((size_t)(ib+p2)*ib);
+    int nblk = (k+ib-1)/ib;
+    for (int b = 0; b < nblk; b++) {
+        int i = (ascend ? b : nblk-1-b)*ib;
+        int kb = k-i < ib ? k-i : ib;
+        int ls = kb + p2;
+        int lds = left ? ls : q;
+        int ldvb = colwise ? ls : kb;
+        for (int r = 0; r < ls; r++) {
+            for (int c = 0; c < q; c++) {
+                float *a = bench_sstack(
+                    left, forward, kb, p2, off+i, r, c, A1, lda1, A2, lda2);
+                S[left ? r + (size_t)lds*c : c + (size_t)lds*r] = *a;
+            }
+            for (int c = 0; c < kb; c++) {
+                int r1 = forward ? r : r-p2;
+                int r2 = forward ? r-kb : r;
+                float v;
+                if (r1 >= 0 && r1 < kb)
+                    v = r1 == c ? 1.0 : 0.0;
+                else if (tri && r2 > i+c)
+                    v = 0.0;
+                else
+                    v = colwise ? V[r2 + (size_t)ldv*(i+c)]
+                                : V[(i+c) + (size_t)ldv*r2];
+                Vb[colwise ? r + (size_t)ldvb*c : c + (size_t)ldvb*r] = v;
+            }
+        }
+        bench_slarfb(side, transt, direct, storev,
+                     left ? ls : q, left ? q : ls, kb,
+                     Vb, ldvb, &T[(size_t)ldt*i], ldt, S, lds);
+        for (int r = 0; r < ls; r++) {
+            for (int c = 0; c < q; c++) {
+                float *a = bench_sstack(
+                    left, forward, kb, p2, off+i, r, c, A1, lda1, A2, lda2);
+                *a = S[left ? r + (size_t)lds*c : c + (size_t)lds*r];
+            }
+        }
+    }
+    free(S);
+    free(Vb);
+}
+
+/******************************************************************************/
+// Task t of the first sweep of the chase of the band of the data.
+static void bench_sgbtype(bench_sdata_t *d, int t,
+                          float *band,
+                          float *vband)
+{
+    int nb = d->nb;
+    int st, ed;
+    coreblas_bulge_task(nb, d->bw, 0, t, &st, &ed);
+    float *VQ = vband;
+    float *TAUQ = &vband[2*nb];
+    float *VP = &vband[4*nb];
+    float *TAUP = &vband[6*nb];
+    if (t == 1) {
+        coreblas_sgbtype1cb(CoreBlasLower, nb, d->bw, band, d->ldband,
+                            VQ, TAUQ, VP, TAUP, st, ed, 0, 1, 0, d->work);
+    }
+    else if (t%2 == 0) {
+        coreblas_sgbtype2cb(CoreBlasLower, nb, d->bw, band, d->ldband,
+                            VQ, TAUQ, VP, TAUP, st, ed, 0, 1, 0, d->work);
+    }
+    else {
+        coreblas_sgbtype3cb(CoreBlasLower, nb, d->bw, band, d->ldband,
+                            VQ, TAUQ, VP, TAUP, st, ed, 0, 1, 0, d->work);
+    }
+}
+
+/******************************************************************************/
+// Expands the band storage into the dense nb-by-nb D.
+static void bench_sband_dense(const bench_sdata_t *d,
+                              const float *band,
+                              float *D)
+{
+    int nb = d->nb;
+    int bw = d->bw;
+    for (int j = 0; j < nb; j++) {
+        for (int i = 0; i < nb; i++) {
+            int r = bw + i - j;
+            D[i + (size_t)nb*j] = r >= 0 && r < d->ldband
+                                ? band[r + (size_t)d->ldband*j] : 0.0;
+        }
+    }
+}
+
+/******************************************************************************/
+// Unitary invariants of the band: the Frobenius norms of D and of D^T D.
+static void bench_sband_norms(const bench_sdata_t *d,
+                              const float *band,
+                              float *fro, float *fro2)
+{
+    int nb = d->nb;
+    float *D = bench_smalloc(2*(size_t)nb*nb);
+    float *G = &D[(size_t)nb*nb];
+    bench_sband_dense(d, band, D);
+    coreblas_sgemm(CoreBlasTrans, CoreBlasNoTrans, nb, nb, nb,
+                   1.0, D, nb, D, nb, 0.0, G, nb);
+    float s = 0.0;
+    float s2 = 0.0;
+    for (size_t i = 0; i < (size_t)nb*nb; i++) {
+        s  += fabsf(D[i])*fabsf(D[i]);
+        s2 += fabsf(G[i])*fabsf(G[i]);
+    }
+    *fro = sqrtf(s);
+    *fro2 = sqrtf(s2);
+    free(D);
+}
+
+/******************************************************************************/
+static void *bench_screate(int nb, int ib)
+{
+    bench_sdata_t *d = (bench_sdata_t*)calloc(1, sizeof(bench_sdata_t));
+    if (d == NULL)
+        return NULL;
+
+    size_t tile = (size_t)nb*nb;
+    d->nb = nb;
+    d->ib = ib;
+
+    float **tiles[] = {
+        &d->A, &d->B, &d->C, &d->A0, &d->B0, &d->C0, &d->L,
+        &d->Vqr, &d->Vlq, &d->Vts, &d->Vtt, &d->Vtsl, &d->Vttl,
+        &d->Vtsb, &d->Vtsr, &d->Vqrx, &d->Vlqx, &d->Vcbx, &d->Vrbx,
+    };
+    float **tfactors[] = {
+        &d->Tqr, &d->Tlq, &d->Tts, &d->Ttt, &d->Ttsl, &d->Tttl, &d->T,
+        &d->Ttsb, &d->Ttsr,
+    };
+    int ok = 1;
+    for (size_t i = 0; i < sizeof(tiles)/sizeof(tiles[0]); i++) {
+        *tiles[i] = (float*)malloc(
+            tile*sizeof(float));
+        ok = ok && *tiles[i] != NULL;
+    }
+    for (size_t i = 0; i < sizeof(tfactors)/sizeof(tfactors[0]); i++) {
+        *tfactors[i] = (float*)calloc(
+            (size_t)ib*nb, sizeof(float));
+        ok = ok && *tfactors[i] != NULL;
+    }
+    d->tau   = (float*)malloc(
+        (size_t)nb*sizeof(float));
+    d->tauqr = (float*)malloc(
+        (size_t)nb*sizeof(float));
+    d->work  = (float*)malloc(
+        4*tile*sizeof(float));
+    d->dwork = (float*)malloc(2*(size_t)nb*sizeof(float));
+    d->ipiv  = (int*)malloc((size_t)nb*sizeof(int));
+
+    coreblas_desc_t panel;
+    coreblas_desc_general_init(CoreBlasRealFloat, d->B, nb, nb,
+                               nb, nb, 0, 0, nb, nb, &panel);
+    d->wcalu  = (float*)malloc(
+        coreblas_sgetrf_calu_lwork(panel, 1)*sizeof(float));
+    d->iwcalu = (int*)malloc(coreblas_sgetrf_calu_liwork(panel, 1)*sizeof(int));
+    d->iwork  = (int*)malloc(
+        coreblas_sgeswp_blocked_liwork(1, nb)*sizeof(int));
+
+    int batch = bench_sbatch(nb);
+    d->batch = batch;
+    d->Ab  = (float*)malloc(
+        batch*tile*sizeof(float));
+    d->Cb  = (float*)malloc(
+        batch*tile*sizeof(float));
+    d->Db  = (float*)malloc(
+        batch*tile*sizeof(float));
+    d->Tb  = (float*)calloc(
+        batch*(size_t)ib*nb, sizeof(float));
+    d->Abp = (float**)malloc(
+        batch*sizeof(float*));
+    d->Cbp = (float**)malloc(
+        batch*sizeof(float*));
+    d->Dbp = (float**)malloc(
+        batch*sizeof(float*));
+    d->Tbp = (float**)malloc(
+        batch*sizeof(float*));
+    d->Vp  = (const float**)malloc(
+        batch*sizeof(float*));
+    d->Tp  = (const float**)malloc(
+        batch*sizeof(float*));
+    size_t lwbatch = coreblas_sgeqrt_batched_lwork(nb, nb, ib);
+    size_t lwtsmqr = coreblas_stsmqr_lwork(CoreBlasLeft, nb, nb, ib);
+    int wbatch = coreblas_workspace_create(
+        &d->wbatch, lwbatch > lwtsmqr ? lwbatch : lwtsmqr,
+        CoreBlasRealFloat);
+
+    // Task 3 of the first sweep exists from nb = bw+3 on.
+    int bw = nb-3 < ib ? nb-3 : ib;
+    bw = bw > 1 ? bw : 1;
+    d->bw = bw;
+    d->ldband = 3*bw+1;
+    size_t lband = (size_t)d->ldband*nb;
+    for (int i = 0; i < 4; i++) {
+        d->band[i]  = (float*)calloc(
+            lband, sizeof(float));
+        d->vband[i] = (float*)calloc(
+            8*(size_t)nb, sizeof(float));
+        ok = ok && d->band[i] != NULL && d->vband[i] != NULL;
+    }
+    for (int i = 0; i < 3; i++) {
+        d->band0[i]  = (float*)calloc(
+            lband, sizeof(float));
+        d->vband0[i] = (float*)calloc(
+            8*(size_t)nb, sizeof(float));
+        ok = ok && d->band0[i] != NULL && d->vband0[i] != NULL;
+    }
+    d->iwband = (int*)malloc(
+        coreblas_sgbbrd_static_liwork(nb, bw)*sizeof(int));
+
+    if (!ok || d->tau == NULL || d->tauqr == NULL || d->work == NULL ||
+        d->dwork == NULL ||
+        d->ipiv == NULL || d->wcalu == NULL || d->iwcalu == NULL ||
+        d->iwork == NULL || d->Ab == NULL || d->Cb == NULL ||
+        d->Db == NULL || d->Tb == NULL || d->Abp == NULL ||
+        d->Cbp == NULL || d->Dbp == NULL || d->Tbp == NULL ||
+        d->Vp == NULL || d->Tp == NULL || d->iwband == NULL ||
+        wbatch != CoreBlasSuccess) {
+        bench_s.destroy(d);
+        return NULL;
+    }
+
+    unsigned long long seed = 42;
+    bench_sfill(nb, nb, d->A0, nb, &seed);
+    bench_sfill(nb, nb, d->B0, nb, &seed);
+    bench_sfill(nb, nb, d->C0, nb, &seed);
+
+    // Make A0 symmetric and diagonally dominant, hence positive definite
+    // and well conditioned for the triangular solvers.
+    for (int j = 0; j < nb; j++) {
+        for (int i = j+1; i < nb; i++)
+            d->A0[j + nb*i] = (d->A0[i + nb*j]);
+        d->A0[j + nb*j] = creal(d->A0[j + nb*j]) + nb;
+    }
+    memcpy(d->L, d->A0, tile*sizeof(float));
+    coreblas_spotrf(CoreBlasLower, nb, d->L, nb);
+
+    // Factors consumed by the update kernels.
+    memcpy(d->Vqr, d->B0, tile*sizeof(float));
+    coreblas_sgeqrt(nb, nb, ib, d->Vqr, nb, d->Tqr, ib, d->tau, d->work);
+    for (int j = 0; j < nb; j++) {
+        d->tauqr[j] = d->Tqr[j%ib + ib*j];
+        for (int i = 0; i < nb; i++)
+            d->Vqrx[i + nb*j] = i > j ? d->Vqr[i + nb*j] : (i == j ? 1.0 : 0.0);
+    }
+    memcpy(d->Vlq, d->B0, tile*sizeof(float));
+    coreblas_sgelqt(nb, nb, ib, d->Vlq, nb, d->Tlq, ib, d->tau, d->work);
+    bench_slarfb_v(CoreBlasForward, CoreBlasRowwise, nb, ib,
+                   d->Vlq, nb, d->Vlqx, nb);
+    bench_slarfb_v(CoreBlasBackward, CoreBlasColumnwise, nb, ib,
+                   d->C0, nb, d->Vcbx, nb);
+    bench_slarfb_v(CoreBlasBackward, CoreBlasRowwise, nb, ib,
+                   d->C0, nb, d->Vrbx, nb);
+
+    memcpy(d->A, d->Vqr, tile*sizeof(float));
+    memcpy(d->Vts, d->C0, tile*sizeof(float));
+    coreblas_stsqrt(nb, nb, ib, d->A, nb, d->Vts, nb, d->Tts, ib,
+                    d->tau, d->work);
+    memcpy(d->A, d->Vqr, tile*sizeof(float));
+    memcpy(d->Vtt, d->Vqr, tile*sizeof(float));
+    coreblas_sttqrt(nb, nb, ib, d->A, nb, d->Vtt, nb, d->Ttt, ib,
+                    d->tau, d->work);
+
+    memcpy(d->A, d->Vlq, tile*sizeof(float));
+    memcpy(d->Vtsl, d->C0, tile*sizeof(float));
+    coreblas_stslqt(nb, nb, ib, d->A, nb, d->Vtsl, nb, d->Ttsl, ib,
+                    d->tau, d->work);
+    memcpy(d->A, d->Vlq, tile*sizeof(float));
+    memcpy(d->Vttl, d->Vlq, tile*sizeof(float));
+    coreblas_sttlqt(nb, nb, ib, d->A, nb, d->Vttl, nb, d->Tttl, ib,
+                    d->tau, d->work);
+
+    memcpy(d->A, d->Vlq, tile*sizeof(float));
+    memcpy(d->Vtsb, d->C0, tile*sizeof(float));
+    coreblas_stsqlt(nb, nb, ib, d->A, nb, d->Vtsb, nb, d->Ttsb, ib,
+                    d->tau, d->work);
+    memcpy(d->A, d->Vqr, tile*sizeof(float));
+    memcpy(d->Vtsr, d->C0, tile*sizeof(float));
+    coreblas_stsrqt(nb, nb, ib, d->A, nb, d->Vtsr, nb, d->Ttsr, ib,
+                    d->tau, d->work);
+
+    // Batch of copies of B0 and C0; all the pairs of the batched update
+    // share the reflectors of the ts factorization.
+    for (int i = 0; i < batch; i++) {
+        d->Abp[i] = &d->Ab[tile*i];
+        d->Cbp[i] = &d->Cb[tile*i];
+        d->Dbp[i] = &d->Db[tile*i];
+        d->Tbp[i] = &d->Tb[(size_t)ib*nb*i];
+        d->Vp[i] = d->Vts;
+        d->Tp[i] = d->Tts;
+        memcpy(d->Abp[i], d->B0, tile*sizeof(float));
+        memcpy(d->Cbp[i], d->C0, tile*sizeof(float));
+        memcpy(d->Dbp[i], d->B0, tile*sizeof(float));
+    }
+
+    // Pivots consumed by the row interchange kernel.
+    memcpy(d->A, d->B0, tile*sizeof(float));
+    bench_sgetrf_tile(d->A, nb, ib, d->ipiv);
+
+    // Band and its states after the first two tasks of the first sweep.
+    for (int j = 0; j < nb; j++)
+        bench_sfill(j+bw < nb ? bw+1 : nb-j, 1,
+                    &d->band0[0][bw + (size_t)d->ldband*j], d->ldband, &seed);
+    bench_sband_norms(d, d->band0[0], &d->band_fro, &d->band_fro2);
+    for (int t = 1; t < 3; t++) {
+        memcpy(d->band0[t], d->band0[t-1], lband*sizeof(float));
+        memcpy(d->vband0[t], d->vband0[t-1],
+               8*(size_t)nb*sizeof(float));
+        bench_sgbtype(d, t, d->band0[t], d->vband0[t]);
+    }
+
+    bench_s.reset(d);
+    return d;
+}
+
+/******************************************************************************/
+static void bench_sreset(void *data)
+{
+    bench_sdata_t *d = (bench_sdata_t*)data;
+    size_t size = (size_t)d->nb*d->nb*sizeof(float);
+    size_t lband = (size_t)d->ldband*d->nb*sizeof(float);
+    size_t lvband = 8*(size_t)d->nb*sizeof(float);
+    for (int i = 0; i < 4; i++) {
+        memcpy(d->band[i],  d->band0[i%3],  lband);
+        memcpy(d->vband[i], d->vband0[i%3], lvband);
+    }
+    memcpy(d->A, d->A0, size);
+    memcpy(d->B, d->B0, size);
+    memcpy(d->C, d->C0, size);
+}
+
+/******************************************************************************/
+static void bench_sdestroy(void *data)
+{
+    bench_sdata_t *d = (bench_sdata_t*)data;
+    if (d == NULL)
+        return;
+
+    free(d->A);    free(d->B);    free(d->C);
+    free(d->A0);   free(d->B0);   free(d->C0);   free(d->L);
+    free(d->Vqr);  free(d->Vlq);  free(d->Vts);  free(d->Vtt);
+    free(d->Vtsl); free(d->Vttl); free(d->Vtsb); free(d->Vtsr);
+    free(d->Vqrx); free(d->Vlqx); free(d->Vcbx); free(d->Vrbx);
+    free(d->Tqr);  free(d->Tlq);  free(d->Tts);  free(d->Ttt);
+    free(d->Ttsl); free(d->Tttl); free(d->Ttsb); free(d->Ttsr);
+    free(d->T);
+    free(d->tau);  free(d->tauqr); free(d->work); free(d->dwork);
+    free(d->ipiv);
+    free(d->wcalu); free(d->iwcalu); free(d->iwork);
+    free(d->Ab);   free(d->Cb);   free(d->Db);   free(d->Tb);
+    free(d->Abp);  free(d->Cbp);  free(d->Dbp);  free(d->Tbp);
+    free(d->Vp);   free(d->Tp);
+    for (int i = 0; i < 4; i++) {
+        free(d->band[i]);
+        free(d->vband[i]);
+    }
+    for (int i = 0; i < 3; i++) {
+        free(d->band0[i]);
+        free(d->vband0[i]);
+    }
+    free(d->iwband);
+    if (d->wbatch.spaces != NULL)
+        coreblas_workspace_destroy(&d->wbatch);
+    free(d);
+}
+
+/*******************************************************************************
+ *  Kernel calls.
+ **/
+#define BENCH_DATA bench_sdata_t *d = (bench_sdata_t*)data; int nb = d->nb; \
+                   int ib = d->ib; (void)nb; (void)ib;
+
+static const float zone  =  1.0;
+static const float zmone = -1.0;
+
+//==============================================================================
+// Level 3 BLAS
+static int bench_sgemm_call(void *data) {
+    BENCH_DATA
+    coreblas_sgemm(CoreBlasNoTrans, CoreBlasNoTrans, nb, nb, nb,
+                   zmone, d->A, nb, d->B, nb, zone, d->C, nb);
+    return 0;
+}
+static bench_flops_t bench_sgemm_flops(int nb, int ib) {
+    return bench_sflops(FMULS_GEMM(nb, nb, nb), FADDS_GEMM(nb, nb, nb));
+}
+
+static int bench_sgemm_batched_call(void *data) {
+    BENCH_DATA
+    return coreblas_sgemm_batched(
+        CoreBlasNoTrans, CoreBlasNoTrans, nb, nb, nb,
+        zmone, (const float * const *)d->Abp, nb,
+               (const float * const *)d->Dbp, nb,
+        zone, d->Cbp, nb, d->batch);
+}
+static bench_flops_t bench_sgemm_batched_flops(int nb, int ib) {
+    return bench_sbatch(nb)*bench_sgemm_flops(nb, ib);
+}
+
+#ifdef COMPLEX
+static int bench_ssymm_call(void *data) {
+    BENCH_DATA
+    coreblas_ssymm(CoreBlasLeft, CoreBlasLower, nb, nb,
+                   zmone, d->A, nb, d->B, nb, zone, d->C, nb);
+    return 0;
+}
+
+static int bench_ssyrk_call(void *data) {
+    BENCH_DATA
+    coreblas_ssyrk(CoreBlasLower, CoreBlasNoTrans, nb, nb,
+                   -1.0, d->B, nb, 1.0, d->A, nb);
+    return 0;
+}
+
+static int bench_ssyr2k_call(void *data) {
+    BENCH_DATA
+    coreblas_ssyr2k(CoreBlasLower, CoreBlasNoTrans, nb, nb,
+                    zmone, d->B, nb, d->C, nb, 1.0, d->A, nb);
+    return 0;
+}
+#endif
+
+static int bench_ssymm_call(void *data) {
+    BENCH_DATA
+    coreblas_ssymm(CoreBlasLeft, CoreBlasLower, nb, nb,
+                   zmone, d->A, nb, d->B, nb, zone, d->C, nb);
+    return 0;
+}
+static bench_flops_t bench_ssymm_flops(int nb, int ib) {
+    return bench_sflops(FMULS_SYMM(nb, nb), FADDS_SYMM(nb, nb));
+}
+
+static int bench_ssyrk_call(void *data) {
+    BENCH_DATA
+    coreblas_ssyrk(CoreBlasLower, CoreBlasNoTrans, nb, nb,
+                   zmone, d->B, nb, zone, d->A, nb);
+    return 0;
+}
+static bench_flops_t bench_ssyrk_flops(int nb, int ib) {
+    return bench_sflops(FMULS_SYRK(nb, nb), FADDS_SYRK(nb, nb));
+}
+
+static int bench_ssyr2k_call(void *data) {
+    BENCH_DATA
+    coreblas_ssyr2k(CoreBlasLower, CoreBlasNoTrans, nb, nb,
+                    zmone, d->B, nb, d->C, nb, zone, d->A, nb);
+    return 0;
+}
+static bench_flops_t bench_ssyr2k_flops(int nb, int ib) {
+    return bench_sflops(FMULS_SYR2K(nb, nb), FADDS_SYR2K(nb, nb));
+}
+
+static int bench_strmm_call(void *data) {
+    BENCH_DATA
+    coreblas_strmm(CoreBlasLeft, CoreBlasLower, CoreBlasNoTrans,
+                   CoreBlasNonUnit, nb, nb, zone, d->A, nb, d->B, nb);
+    return 0;
+}
+static bench_flops_t bench_strmm_flops(int nb, int ib) {
+    return bench_sflops(FMULS_TRMM(nb, nb), FADDS_TRMM(nb, nb));
+}
+
+static int bench_strsm_call(void *data) {
+    BENCH_DATA
+    coreblas_strsm(CoreBlasLeft, CoreBlasLower, CoreBlasNoTrans,
+                   CoreBlasNonUnit, nb, nb, zone, d->A, nb, d->B, nb);
+    return 0;
+}
+static bench_flops_t bench_strsm_flops(int nb, int ib) {
+    return bench_sflops(FMULS_TRSM(nb, nb), FADDS_TRSM(nb, nb));
+}
+
+//==============================================================================
+// Auxiliary
+static int bench_sgeadd_call(void *data) {
+    BENCH_DATA
+    return coreblas_sgeadd(CoreBlasNoTrans, nb, nb,
+                           zmone, d->B, nb, zone, d->C, nb);
+}
+static bench_flops_t bench_sgeadd_flops(int nb, int ib) {
+    return bench_sflops(2.0*nb*nb, (float)nb*nb);
+}
+
+static int bench_stradd_call(void *data) {
+    BENCH_DATA
+    return coreblas_stradd(CoreBlasLower, CoreBlasNoTrans, nb, nb,
+                           zmone, d->B, nb, zone, d->C, nb);
+}
+static bench_flops_t bench_stradd_flops(int nb, int ib) {
+    return bench_sflops((float)nb*(nb+1), 0.5*nb*(nb+1));
+}
+
+static int bench_slacpy_call(void *data) {
+    BENCH_DATA
+    coreblas_slacpy(CoreBlasGeneral, CoreBlasNoTrans, nb, nb,
+                    d->B, nb, d->C, nb);
+    return 0;
+}
+
+static int bench_slacpy_lapack2tile_band_call(void *data) {
+    BENCH_DATA
+    coreblas_slacpy_lapack2tile_band(CoreBlasGeneral, 0, 0, nb, nb, nb,
+                                     ib, ib, d->B, nb, d->C, nb);
+    return 0;
+}
+
+static int bench_slacpy_tile2lapack_band_call(void *data) {
+    BENCH_DATA
+    coreblas_slacpy_tile2lapack_band(CoreBlasGeneral, 0, 0, nb, nb, nb,
+                                     ib, ib, d->B, nb, d->C, nb);
+    return 0;
+}
+
+static int bench_slaset_call(void *data) {
+    BENCH_DATA
+    coreblas_slaset(CoreBlasGeneral, nb, nb, 0.0, 1.0, d->C, nb);
+    return 0;
+}
+
+static int bench_slascl_call(void *data) {
+    BENCH_DATA
+    coreblas_slascl(CoreBlasGeneral, 2.0, 3.0, nb, nb, d->C, nb);
+    return 0;
+}
+static bench_flops_t bench_slascl_flops(int nb, int ib) {
+    return bench_sflops((float)nb*nb, 0.0);
+}
+
+static bench_flops_t bench_snorm_flops(int nb, int ib) {
+    return bench_sflops((float)nb*nb, (float)nb*nb);
+}
+
+static int bench_slange_one_call(void *data) {
+    BENCH_DATA
+    coreblas_slange(CoreBlasOneNorm, nb, nb, d->B, nb, d->dwork, d->value);
+    return 0;
+}
+
+static int bench_slange_inf_call(void *data) {
+    BENCH_DATA
+    coreblas_slange(CoreBlasInfNorm, nb, nb, d->B, nb, d->dwork, d->value);
+    return 0;
+}
+
+static int bench_slange_fro_call(void *data) {
+    BENCH_DATA
+    coreblas_slange(CoreBlasFrobeniusNorm, nb, nb, d->B, nb,
+                    d->dwork, d->value);
+    return 0;
+}
+
+static int bench_slange_max_call(void *data) {
+    BENCH_DATA
+    coreblas_slange(CoreBlasMaxNorm, nb, nb, d->B, nb, d->dwork, d->value);
+    return 0;
+}
+
+// Column and row sums, as computed on every tile by the tile norms.
+static int bench_slange_aux_one_call(void *data) {
+    BENCH_DATA
+    coreblas_slange_aux(CoreBlasOneNorm, nb, nb, d->B, nb, d->dwork);
+    return 0;
+}
+
+static int bench_slange_aux_inf_call(void *data) {
+    BENCH_DATA
+    coreblas_slange_aux(CoreBlasInfNorm, nb, nb, d->B, nb, d->dwork);
+    return 0;
+}
+
+static int bench_slantr_aux_inf_call(void *data) {
+    BENCH_DATA
+    coreblas_slantr_aux(CoreBlasInfNorm, CoreBlasUpper, CoreBlasNonUnit,
+                        nb, nb, d->B, nb, d->dwork);
+    return 0;
+}
+
+static int bench_slansy_aux_call(void *data) {
+    BENCH_DATA
+    coreblas_slansy_aux(CoreBlasOneNorm, CoreBlasLower, nb, d->A, nb,
+                        d->dwork);
+    return 0;
+}
+
+#ifdef COMPLEX
+static int bench_slansy_one_call(void *data) {
+    BENCH_DATA
+    coreblas_slansy(CoreBlasOneNorm, CoreBlasLower, nb, d->A, nb,
+                    d->dwork, d->value);
+    return 0;
+}
+
+static int bench_slansy_aux_call(void *data) {
+    BENCH_DATA
+    coreblas_slansy_aux(CoreBlasOneNorm, CoreBlasLower, nb, d->A, nb,
+                        d->dwork);
+    return 0;
+}
+
+static int bench_ssyssq_call(void *data) {
+    BENCH_DATA
+    d->value[0] = 0.0;
+    d->value[1] = 1.0;
+    coreblas_ssyssq(CoreBlasLower, nb, d->A, nb, &d->value[0], &d->value[1]);
+    return 0;
+}
+#endif
+
+static int bench_slansy_one_call(void *data) {
+    BENCH_DATA
+    coreblas_slansy(CoreBlasOneNorm, CoreBlasLower, nb, d->A, nb,
+                    d->dwork, d->value);
+    return 0;
+}
+
+static int bench_slantr_one_call(void *data) {
+    BENCH_DATA
+    coreblas_slantr(CoreBlasOneNorm, CoreBlasLower, CoreBlasNonUnit, nb, nb,
+                    d->B, nb, d->dwork, d->value);
+    return 0;
+}
+
+static int bench_sgessq_call(void *data) {
+    BENCH_DATA
+    d->value[0] = 0.0;
+    d->value[1] = 1.0;
+    coreblas_sgessq(nb, nb, d->B, nb, &d->value[0], &d->value[1]);
+    return 0;
+}
+
+static int bench_ssyssq_call(void *data) {
+    BENCH_DATA
+    d->value[0] = 0.0;
+    d->value[1] = 1.0;
+    coreblas_ssyssq(CoreBlasLower, nb, d->A, nb, &d->value[0], &d->value[1]);
+    return 0;
+}
+
+// Reductions of the partial results of nb*nb tiles, read from the tile B.
+static int bench_sreduce_ssq_call(void *data) {
+    BENCH_DATA
+    const float *scale = (const float*)d->B;
+    int n = nb*nb/2;
+    coreblas_sreduce_ssq(n, scale, &scale[n], &d->value[0], &d->value[1]);
+    return 0;
+}
+
+static int bench_sreduce_one_call(void *data) {
+    BENCH_DATA
+    coreblas_sreduce_norm(CoreBlasOneNorm, nb, nb, (const float*)d->B, nb,
+                          d->value);
+    return 0;
+}
+
+static int bench_strssq_call(void *data) {
+    BENCH_DATA
+    d->value[0] = 0.0;
+    d->value[1] = 1.0;
+    coreblas_strssq(CoreBlasLower, CoreBlasNonUnit, nb, nb, d->B, nb,
+                    &d->value[0], &d->value[1]);
+    return 0;
+}
+
+//==============================================================================
+// Cholesky and triangular
+static int bench_spotrf_call(void *data) {
+    BENCH_DATA
+    return coreblas_spotrf(CoreBlasLower, nb, d->A, nb);
+}
+static bench_flops_t bench_spotrf_flops(int nb, int ib) {
+    return bench_sflops(FMULS_POTRF(nb), FADDS_POTRF(nb));
+}
+
+static int bench_strtri_call(void *data) {
+    BENCH_DATA
+    return coreblas_strtri(CoreBlasLower, CoreBlasNonUnit, nb, d->A, nb);
+}
+static bench_flops_t bench_strtri_flops(int nb, int ib) {
+    return bench_sflops(FMULS_TRTRI(nb), FADDS_TRTRI(nb));
+}
+
+static int bench_slauum_call(void *data) {
+    BENCH_DATA
+    return coreblas_slauum(CoreBlasLower, nb, d->A, nb);
+}
+static bench_flops_t bench_slauum_flops(int nb, int ib) {
+    return bench_sflops(FMULS_LAUUM(nb), FADDS_LAUUM(nb));
+}
+
+static int bench_ssygst_call(void *data) {
+    BENCH_DATA
+    return coreblas_ssygst(1, CoreBlasLower, nb, d->A, nb, d->L, nb);
+}
+static bench_flops_t bench_ssygst_flops(int nb, int ib) {
+    return bench_sflops(FMULS_SYGST(nb), FADDS_SYGST(nb));
+}
+
+//==============================================================================
+// LU
+static int bench_sgetrf_call(void *data) {
+    BENCH_DATA
+    return bench_sgetrf_tile(d->B, nb, ib, d->ipiv);
+}
+static bench_flops_t bench_sgetrf_flops(int nb, int ib) {
+    return bench_sflops(FMULS_GETRF(nb, nb), FADDS_GETRF(nb, nb));
+}
+
+static int bench_sgetrf_calu_call(void *data) {
+    BENCH_DATA
+    coreblas_desc_t desc;
+    coreblas_desc_general_init(CoreBlasRealFloat, d->B, nb, nb,
+                               nb, nb, 0, 0, nb, nb, &desc);
+
+    volatile int info = 0;
+    coreblas_barrier_t barrier;
+    coreblas_barrier_init(&barrier);
+
+    coreblas_sgetrf_calu(desc, d->ipiv, 0, 1, d->wcalu, d->iwcalu,
+                         &info, &barrier);
+    return info;
+}
+
+// Pivot search over the whole tile B.
+static int bench_isamax_tile_call(void *data) {
+    BENCH_DATA
+    int imax, jmax;
+    coreblas_isamax_tile(nb, nb, d->B, nb, &imax, &jmax, &d->value[0]);
+    return 0;
+}
+
+static int bench_sgeswp_call(void *data) {
+    BENCH_DATA
+    coreblas_desc_t desc;
+    coreblas_desc_general_init(CoreBlasRealFloat, d->C, nb, nb,
+                               nb, nb, 0, 0, nb, nb, &desc);
+    coreblas_sgeswp(CoreBlasRowwise, desc, 1, nb, d->ipiv, 1);
+    return 0;
+}
+
+static int bench_sgeswp_blocked_call(void *data) {
+    BENCH_DATA
+    coreblas_desc_t desc;
+    coreblas_desc_general_init(CoreBlasRealFloat, d->C, nb, nb,
+                               nb, nb, 0, 0, nb, nb, &desc);
+    coreblas_sgeswp_blocked(CoreBlasRowwise, desc, 1, nb, d->ipiv, 1,
+                            0, 1, d->work, d->iwork);
+    return 0;
+}
+
+//==============================================================================
+// QR and LQ
+static int bench_sgeqrt_call(void *data) {
+    BENCH_DATA
+    return coreblas_sgeqrt(nb, nb, ib, d->B, nb, d->T, ib, d->tau, d->work);
+}
+static bench_flops_t bench_sgeqrt_flops(int nb, int ib) {
+    return bench_sflops(FMULS_GEQRF(nb, nb), FADDS_GEQRF(nb, nb));
+}
+
+static int bench_sgeqrt_batched_call(void *data) {
+    BENCH_DATA
+    return coreblas_sgeqrt_batched(nb, nb, ib, d->Abp, nb, d->Tbp, ib,
+                                   &d->wbatch, d->batch);
+}
+static bench_flops_t bench_sgeqrt_batched_flops(int nb, int ib) {
+    return bench_sbatch(nb)*bench_sgeqrt_flops(nb, ib);
+}
+
+static int bench_sgelqt_call(void *data) {
+    BENCH_DATA
+    return coreblas_sgelqt(nb, nb, ib, d->B, nb, d->T, ib, d->tau, d->work);
+}
+static bench_flops_t bench_sgelqt_flops(int nb, int ib) {
+    return bench_sflops(FMULS_GELQF(nb, nb), FADDS_GELQF(nb, nb));
+}
+
+static int bench_stsqrt_call(void *data) {
+    BENCH_DATA
+    return coreblas_stsqrt(nb, nb, ib, d->A, nb, d->B, nb, d->T, ib,
+                           d->tau, d->work);
+}
+
+static int bench_stsqrt_rec_call(void *data) {
+    BENCH_DATA
+    return coreblas_stsqrt_rec(nb, nb, ib, d->A, nb, d->B, nb, d->T, ib,
+                               d->tau, d->work);
+}
+
+static int bench_stslqt_call(void *data) {
+    BENCH_DATA
+    return coreblas_stslqt(nb, nb, ib, d->A, nb, d->B, nb, d->T, ib,
+                           d->tau, d->work);
+}
+
+static int bench_stsqlt_call(void *data) {
+    BENCH_DATA
+    return coreblas_stsqlt(nb, nb, ib, d->A, nb, d->B, nb, d->T, ib,
+                           d->tau, d->work);
+}
+
+static int bench_stsrqt_call(void *data) {
+    BENCH_DATA
+    return coreblas_stsrqt(nb, nb, ib, d->A, nb, d->B, nb, d->T, ib,
+                           d->tau, d->work);
+}
+static bench_flops_t bench_stsqrt_flops(int nb, int ib) {
+    return bench_sflops(FMULS_TSQRT(nb, nb), FADDS_TSQRT(nb, nb));
+}
+
+static int bench_sttqrt_call(void *data) {
+    BENCH_DATA
+    return coreblas_sttqrt(nb, nb, ib, d->A, nb, d->B, nb, d->T, ib,
+                           d->tau, d->work);
+}
+
+static int bench_sttqrt_rec_call(void *data) {
+    BENCH_DATA
+    return coreblas_sttqrt_rec(nb, nb, ib, d->A, nb, d->B, nb, d->T, ib,
+                               d->tau, d->work);
+}
+
+static int bench_sttlqt_call(void *data) {
+    BENCH_DATA
+    return coreblas_sttlqt(nb, nb, ib, d->A, nb, d->B, nb, d->T, ib,
+                           d->tau, d->work);
+}
+static bench_flops_t bench_sttqrt_flops(int nb, int ib) {
+    return bench_sflops(FMULS_TTQRT(nb), FADDS_TTQRT(nb));
+}
+
+static int bench_sormqr_call(void *data) {
+    BENCH_DATA
+    return coreblas_sormqr(CoreBlasLeft, CoreBlasTrans, nb, nb, nb, ib,
+                           d->Vqr, nb, d->Tqr, ib, d->C, nb, d->work, nb);
+}
+
+static int bench_sormlq_call(void *data) {
+    BENCH_DATA
+    return coreblas_sormlq(CoreBlasLeft, CoreBlasTrans, nb, nb, nb, ib,
+                           d->Vlq, nb, d->Tlq, ib, d->C, nb, d->work, nb);
+}
+static bench_flops_t bench_sormqr_flops(int nb, int ib) {
+    return bench_sflops(FMULS_UNMQR(nb, nb, nb), FADDS_UNMQR(nb, nb, nb));
+}
+
+static int bench_stsmqr_call(void *data) {
+    BENCH_DATA
+    return coreblas_stsmqr(CoreBlasLeft, CoreBlasTrans,
+                           nb, nb, nb, nb, nb, ib,
+                           d->B, nb, d->C, nb, d->Vts, nb, d->Tts, ib,
+                           d->work, ib);
+}
+
+static int bench_stsmlq_call(void *data) {
+    BENCH_DATA
+    return coreblas_stsmlq(CoreBlasLeft, CoreBlasTrans,
+                           nb, nb, nb, nb, nb, ib,
+                           d->B, nb, d->C, nb, d->Vtsl, nb, d->Ttsl, ib,
+                           d->work, ib);
+}
+
+static int bench_stsmql_call(void *data) {
+    BENCH_DATA
+    return coreblas_stsmql(CoreBlasLeft, CoreBlasTrans,
+                           nb, nb, nb, nb, nb, ib,
+                           d->B, nb, d->C, nb, d->Vtsb, nb, d->Ttsb, ib,
+                           d->work, ib);
+}
+
+static int bench_stsmrq_call(void *data) {
+    BENCH_DATA
+    return coreblas_stsmrq(CoreBlasLeft, CoreBlasTrans,
+                           nb, nb, nb, nb, nb, ib,
+                           d->B, nb, d->C, nb, d->Vtsr, nb, d->Ttsr, ib,
+                           d->work, ib);
+}
+static bench_flops_t bench_stsmqr_flops(int nb, int ib) {
+    return bench_sflops(FMULS_TSMQR(nb, nb, nb), FADDS_TSMQR(nb, nb, nb));
+}
+
+static int bench_stsmqr_batched_call(void *data) {
+    BENCH_DATA
+    return coreblas_stsmqr_batched(CoreBlasLeft, CoreBlasTrans,
+                                   nb, nb, nb, nb, nb, ib,
+                                   d->Dbp, nb, d->Cbp, nb,
+                                   d->Vp, nb, d->Tp, ib,
+                                   &d->wbatch, d->batch);
+}
+static bench_flops_t bench_stsmqr_batched_flops(int nb, int ib) {
+    return bench_sbatch(nb)*bench_stsmqr_flops(nb, ib);
+}
+
+static int bench_stsmqr_row_call(void *data) {
+    BENCH_DATA
+    return coreblas_stsmqr_row(CoreBlasLeft, CoreBlasTrans,
+                               nb, nb, nb, nb, nb, ib,
+                               d->Dbp, nb, d->Cbp, nb,
+                               d->Vts, nb, d->Tts, ib,
+                               &d->wbatch, d->batch);
+}
+
+static int bench_sttmqr_call(void *data) {
+    BENCH_DATA
+    return coreblas_sttmqr(CoreBlasLeft, CoreBlasTrans,
+                           nb, nb, nb, nb, nb, ib,
+                           d->B, nb, d->C, nb, d->Vtt, nb, d->Ttt, ib,
+                           d->work, ib);
+}
+
+static int bench_sttmlq_call(void *data) {
+    BENCH_DATA
+    return coreblas_sttmlq(CoreBlasLeft, CoreBlasTrans,
+                           nb, nb, nb, nb, nb, ib,
+                           d->B, nb, d->C, nb, d->Vttl, nb, d->Tttl, ib,
+                           d->work, ib);
+}
+static bench_flops_t bench_sttmqr_flops(int nb, int ib) {
+    return bench_sflops(FMULS_TTMQR(nb, nb), FADDS_TTMQR(nb, nb));
+}
+
+// One ib-wide block of the ts update, as issued by coreblas_stsmqr.
+static int bench_sparfb_call(void *data) {
+    BENCH_DATA
+    return coreblas_sparfb(CoreBlasLeft, CoreBlasTrans,
+                           CoreBlasForward, CoreBlasColumnwise,
+                           ib, nb, nb, nb, ib, 0,
+                           d->B, nb, d->C, nb, d->Vts, nb, d->Tts, ib,
+                           d->work, ib);
+}
+static bench_flops_t bench_sparfb_flops(int nb, int ib) {
+    return bench_sflops(FMULS_TSMQR(nb, nb, ib), FADDS_TSMQR(nb, nb, ib));
+}
+
+static int bench_spamm_call(void *data) {
+    BENCH_DATA
+    return coreblas_spamm(CoreBlasW, CoreBlasLeft, CoreBlasColumnwise,
+                          ib, nb, nb, 0,
+                          d->B, nb, d->C, nb, d->Vts, nb, d->work, ib);
+}
+static bench_flops_t bench_spamm_flops(int nb, int ib) {
+    return bench_sflops(FMULS_GEMM(ib, nb, nb), FADDS_GEMM(ib, nb, nb));
+}
+
+static int bench_spemv_call(void *data) {
+    BENCH_DATA
+    return coreblas_spemv(CoreBlasConjTrans, CoreBlasColumnwise,
+                          nb, nb, 0, zone, d->Vts, nb, d->B, 1,
+                          zone, d->C, 1, d->work);
+}
+static bench_flops_t bench_spemv_flops(int nb, int ib) {
+    return bench_sflops((float)nb*nb, (float)nb*nb);
+}
+
+static int bench_slarfb_gemm_call(void *data) {
+    BENCH_DATA
+    return coreblas_slarfb_gemm(CoreBlasLeft, CoreBlasTrans,
+                                CoreBlasForward, CoreBlasColumnwise,
+                                nb, nb, ib, d->Vqrx, nb, d->Tqr, ib,
+                                d->C, nb, d->work, nb);
+}
+
+// The other storev/direct cases; backward T is lower triangular and taken
+// from B0, which is not a T factor of V but is valid for the check.
+static int bench_slarfb_gemm_rowfwd_call(void *data) {
+    BENCH_DATA
+    return coreblas_slarfb_gemm(CoreBlasRight, CoreBlasNoTrans,
+                                CoreBlasForward, CoreBlasRowwise,
+                                nb, nb, ib, d->Vlqx, nb, d->Tlq, ib,
+                                d->C, nb, d->work, nb);
+}
+
+static int bench_slarfb_gemm_colbwd_call(void *data) {
+    BENCH_DATA
+    return coreblas_slarfb_gemm(CoreBlasLeft, CoreBlasTrans,
+                                CoreBlasBackward, CoreBlasColumnwise,
+                                nb, nb, ib, d->Vcbx, nb, d->B0, nb,
+                                d->C, nb, d->work, nb);
+}
+
+static int bench_slarfb_gemm_rowbwd_call(void *data) {
+    BENCH_DATA
+    return coreblas_slarfb_gemm(CoreBlasRight, CoreBlasNoTrans,
+                                CoreBlasBackward, CoreBlasRowwise,
+                                nb, nb, ib, d->Vrbx, nb, d->B0, nb,
+                                d->C, nb, d->work, nb);
+}
+static bench_flops_t bench_slarfb_gemm_flops(int nb, int ib) {
+    return bench_sflops(FMULS_TSMQR(nb, nb, ib), FADDS_TSMQR(nb, nb, ib));
+}
+
+// T factor of all the reflectors of the geqrt factorization at once.
+static int bench_slarft_call(void *data) {
+    BENCH_DATA
+    return coreblas_slarft(CoreBlasColumnwise, nb, nb, d->Vqr, nb, d->tauqr,
+                           d->C, nb);
+}
+static bench_flops_t bench_slarft_flops(int nb, int ib) {
+    return bench_sflops(FMULS_GEMM(nb, nb, nb)/6.0, FADDS_GEMM(nb, nb, nb)/6.0);
+}
+
+//==============================================================================
+// Two-sided and band reductions
+static int bench_ssyswp_call(void *data) {
+    BENCH_DATA
+    coreblas_desc_t desc;
+    coreblas_desc_general_init(CoreBlasRealFloat, d->A, nb, nb,
+                               nb, nb, 0, 0, nb, nb, &desc);
+    coreblas_barrier_t barrier;
+    coreblas_barrier_init(&barrier);
+    coreblas_ssyswp(0, 1, CoreBlasLower, desc, 1, nb, d->ipiv, 1, &barrier);
+    return 0;
+}
+
+static int bench_ssyrfb_call(void *data) {
+    BENCH_DATA
+    return coreblas_ssyrfb(CoreBlasLower, nb, nb, ib, d->Vqr, nb, d->Tqr, ib,
+                           d->A, nb, d->work);
+}
+static bench_flops_t bench_ssyrfb_flops(int nb, int ib) {
+    return 2.0*bench_sormqr_flops(nb, ib);
+}
+
+// B holds the conjugate transpose of the top tile.
+static int bench_stsmqr_sytra1_call(void *data) {
+    BENCH_DATA
+    return coreblas_stsmqr_sytra1(CoreBlasLeft, CoreBlasTrans,
+                                  nb, nb, nb, nb, nb, ib,
+                                  d->B, nb, d->C, nb, d->Vts, nb, d->Tts, ib,
+                                  d->work, ib);
+}
+
+// The diagonal tiles A and B and the off-diagonal tile C of a symmetric
+// 2-by-2 block.
+static int bench_stsmqr_corner_call(void *data) {
+    BENCH_DATA
+    return coreblas_stsmqr_corner(nb, nb, nb, nb, nb, nb, nb, ib,
+                                  d->A, nb, d->C, nb, d->B, nb,
+                                  d->Vts, nb, d->Tts, ib, d->work);
+}
+static bench_flops_t bench_stsmqr_corner_flops(int nb, int ib) {
+    return 4.0*bench_stsmqr_flops(nb, ib);
+}
+
+// The first three tasks of the first sweep of the chase of the band,
+// each on the band as left by the previous one.
+static int bench_sgbtype1cb_call(void *data) {
+    BENCH_DATA
+    bench_sgbtype(d, 1, d->band[0], d->vband[0]);
+    return 0;
+}
+
+static int bench_sgbtype2cb_call(void *data) {
+    BENCH_DATA
+    bench_sgbtype(d, 2, d->band[1], d->vband[1]);
+    return 0;
+}
+
+static int bench_sgbtype3cb_call(void *data) {
+    BENCH_DATA
+    bench_sgbtype(d, 3, d->band[2], d->vband[2]);
+    return 0;
+}
+
+static int bench_sgbbrd_static_call(void *data) {
+    BENCH_DATA
+    float *vband = d->vband[3];
+    return coreblas_sgbbrd_static(CoreBlasLower, nb, d->bw, 1,
+                                  d->band[3], d->ldband,
+                                  vband, &vband[2*nb], &vband[4*nb],
+                                  &vband[6*nb], 0, &d->wbatch, d->iwband);
+}
+
+/*******************************************************************************
+ *  Checks of the result of the last call, made on reset data.
+ **/
+#define BENCH_CHECK bench_sdata_t *d = (bench_sdata_t*)data; int nb = d->nb; \
+                    int ib = d->ib; (void)ib; \
+                    size_t tile = (size_t)nb*nb; (void)tile;
+
+//==============================================================================
+// Level 3 BLAS
+// Freivalds' check against an unblocked product with a random vector, which
+// does not rely on the BLAS gemm the kernel calls.
+static bench_resid_t bench_sgemm_check(void *data) {
+    BENCH_CHECK
+    float *x = bench_smalloc(3*(size_t)nb);
+    float *y = &x[nb];
+    float *z = &x[2*nb];
+    unsigned long long seed = 7;
+    bench_sfill(nb, 1, x, nb, &seed);
+    float err = 0.0;
+    float nrm = 0.0;
+    for (int i = 0; i < nb; i++) {
+        y[i] = 0.0;
+        for (int l = 0; l < nb; l++)
+            y[i] += d->B0[i + nb*l]*x[l];
+    }
+    for (int i = 0; i < nb; i++) {
+        float r = 0.0;
+        z[i] = 0.0;
+        for (int l = 0; l < nb; l++) {
+            r += d->C0[i + nb*l]*x[l] - d->A0[i + nb*l]*y[l];
+            z[i] += d->C[i + nb*l]*x[l];
+        }
+        err += fabsf(z[i] - r)*fabsf(z[i] - r);
+        nrm += fabsf(r)*fabsf(r);
+    }
+    free(x);
+    return bench_sscaled(sqrtf(err), sqrtf(nrm), nb);
+}
+
+// R = C0 - op(A) B0, where A is the full matrix of the lower triangle of A0.
+static float bench_ssymm_ref_check(bench_sdata_t *d, int herm)
+{
+    int nb = d->nb;
+    size_t tile = (size_t)nb*nb;
+    float *F = bench_smalloc(2*tile);
+    float *R = &F[tile];
+    bench_sfull(herm, nb, d->A0, nb, F, nb);
+    memcpy(R, d->C0, tile*sizeof(float));
+    coreblas_sgemm(CoreBlasNoTrans, CoreBlasNoTrans, nb, nb, nb,
+                   zmone, F, nb, d->B0, nb, zone, R, nb);
+    float resid = bench_sresid(CoreBlasGeneral, nb, nb, d->C, nb, R, nb);
+    free(F);
+    return resid;
+}
+
+// R = A0 - X Y^T - Y X^T for rank 2 and A0 - X X^T for rank 1, with
+// ^T the transposition trans, compared on the lower triangle.
+static float bench_srank_ref_check(bench_sdata_t *d, coreblas_enum_t trans,
+                                    int rank2)
+{
+    int nb = d->nb;
+    size_t tile = (size_t)nb*nb;
+    float *R = bench_smalloc(tile);
+    memcpy(R, d->A0, tile*sizeof(float));
+    const float *Y = rank2 ? d->C0 : d->B0;
+    coreblas_sgemm(CoreBlasNoTrans, trans, nb, nb, nb,
+                   zmone, d->B0, nb, Y, nb, zone, R, nb);
+    if (rank2) {
+        coreblas_sgemm(CoreBlasNoTrans, trans, nb, nb, nb,
+                       zmone, d->C0, nb, d->B0, nb, zone, R, nb);
+    }
+    float resid = bench_sresid(CoreBlasLower, nb, nb, d->A, nb, R, nb);
+    free(R);
+    return resid;
+}
+
+#ifdef COMPLEX
+static bench_resid_t bench_ssymm_check(void *data) {
+    return bench_ssymm_ref_check((bench_sdata_t*)data, 1);
+}
+
+static bench_resid_t bench_ssyrk_check(void *data) {
+    return bench_srank_ref_check((bench_sdata_t*)data, CoreBlasConjTrans, 0);
+}
+
+static bench_resid_t bench_ssyr2k_check(void *data) {
+    return bench_srank_ref_check((bench_sdata_t*)data, CoreBlasConjTrans, 1);
+}
+#endif
+
+static bench_resid_t bench_ssymm_check(void *data) {
+    return bench_ssymm_ref_check((bench_sdata_t*)data, 0);
+}
+
+static bench_resid_t bench_ssyrk_check(void *data) {
+    return bench_srank_ref_check((bench_sdata_t*)data, CoreBlasTrans, 0);
+}
+
+static bench_resid_t bench_ssyr2k_check(void *data) {
+    return bench_srank_ref_check((bench_sdata_t*)data, CoreBlasTrans, 1);
+}
+
+static bench_resid_t bench_strmm_check(void *data) {
+    BENCH_CHECK
+    float *L = bench_smalloc(2*tile);
+    float *R = &L[tile];
+    bench_stri(CoreBlasLower, nb, d->A0, nb, L, nb);
+    coreblas_sgemm(CoreBlasNoTrans, CoreBlasNoTrans, nb, nb, nb,
+                   zone, L, nb, d->B0, nb, 0.0, R, nb);
+    float resid = bench_sresid(CoreBlasGeneral, nb, nb, d->B, nb, R, nb);
+    free(L);
+    return resid;
+}
+
+// The residual L B - B0 of the solution.
+static bench_resid_t bench_strsm_check(void *data) {
+    BENCH_CHECK
+    float *L = bench_smalloc(2*tile);
+    float *X = &L[tile];
+    bench_stri(CoreBlasLower, nb, d->A0, nb, L, nb);
+    coreblas_sgemm(CoreBlasNoTrans, CoreBlasNoTrans, nb, nb, nb,
+                   zone, L, nb, d->B, nb, 0.0, X, nb);
+    float resid = bench_sresid(CoreBlasGeneral, nb, nb, X, nb, d->B0, nb);
+    free(L);
+    return resid;
+}
+
+//==============================================================================
+// Auxiliary
+static bench_resid_t bench_sgeadd_check(void *data) {
+    BENCH_CHECK
+    float *R = bench_smalloc(tile);
+    for (size_t i = 0; i < tile; i++)
+        R[i] = d->C0[i] - d->B0[i];
+    float resid = bench_sresid(CoreBlasGeneral, nb, nb, d->C, nb, R, nb);
+    free(R);
+    return resid;
+}
+
+// The strictly upper triangle is left as is.
+static bench_resid_t bench_stradd_check(void *data) {
+    BENCH_CHECK
+    float *R = bench_smalloc(tile);
+    for (int j = 0; j < nb; j++)
+        for (int i = 0; i < nb; i++)
+            R[i + nb*j] = d->C0[i + nb*j] - (i >= j ? d->B0[i + nb*j] : 0.0);
+    float resid = bench_sresid(CoreBlasGeneral, nb, nb, d->C, nb, R, nb);
+    free(R);
+    return resid;
+}
+
+// The copies of B0 into C.
+static bench_resid_t bench_slacpy_check(void *data) {
+    BENCH_CHECK
+    return bench_sresid(CoreBlasGeneral, nb, nb, d->C, nb, d->B0, nb);
+}
+
+static bench_resid_t bench_slaset_check(void *data) {
+    BENCH_CHECK
+    float *R = bench_smalloc(tile);
+    for (int j = 0; j < nb; j++)
+        for (int i = 0; i < nb; i++)
+            R[i + nb*j] = i == j ? 1.0 : 0.0;
+    float resid = bench_sresid(CoreBlasGeneral, nb, nb, d->C, nb, R, nb);
+    free(R);
+    return resid;
+}
+
+static bench_resid_t bench_slascl_check(void *data) {
+    BENCH_CHECK
+    float *R = bench_smalloc(tile);
+    for (size_t i = 0; i < tile; i++)
+        R[i] = 1.5*d->C0[i];
+    float resid = bench_sresid(CoreBlasGeneral, nb, nb, d->C, nb, R, nb);
+    free(R);
+    return resid;
+}
+
+// Sums of the moduli of the columns (sum = 0) or rows (sum = 1) of the
+// uplo part of A, with the moduli of the mirrored entries for herm.
+static void bench_sabs_sums(int sum, coreblas_enum_t uplo, int herm, int nb,
+                            const float *A, float *s)
+{
+    for (int i = 0; i < nb; i++)
+        s[i] = 0.0;
+    for (int j = 0; j < nb; j++) {
+        for (int i = 0; i < nb; i++) {
+            int in = uplo == CoreBlasGeneral ||
+                     (uplo == CoreBlasLower ? i >= j : i <= j);
+            if (in) {
+                float a = fabsf(A[i + nb*j]);
+                s[sum ? i : j] += a;
+                if (herm && i != j)
+                    s[sum ? j : i] += a;
+            }
+        }
+    }
+}
+
+// Scaled error of the n values x against the reference r.
+static float bench_svalues(int n, const float *x, const float *r, int nb)
+{
+    float err = 0.0;
+    float nrm = 0.0;
+    for (int i = 0; i < n; i++) {
+        err = fmax(err, fabsf(x[i] - r[i]));
+        nrm = fmax(nrm, fabsf(r[i]));
+    }
+    return bench_sscaled(err, nrm, nb);
+}
+
+static float bench_ssums_check(bench_sdata_t *d, int sum,
+                                coreblas_enum_t uplo, int herm,
+                                const float *A,
+                                const float *x, int max)
+{
+    int nb = d->nb;
+    float *s = (float*)bench_smalloc(nb);
+    bench_sabs_sums(sum, uplo, herm, nb, A, s);
+    float r = 0.0;
+    for (int i = 0; i < nb; i++)
+        r = fmax(r, s[i]);
+    float resid = max ? bench_svalues(1, x, &r, nb)
+                       : bench_svalues(nb, x, s, nb);
+    free(s);
+    return resid;
+}
+
+static bench_resid_t bench_slange_one_check(void *data) {
+    bench_sdata_t *d = (bench_sdata_t*)data;
+    return bench_ssums_check(d, 0, CoreBlasGeneral, 0, d->B0, d->value, 1);
+}
+
+static bench_resid_t bench_slange_inf_check(void *data) {
+    bench_sdata_t *d = (bench_sdata_t*)data;
+    return bench_ssums_check(d, 1, CoreBlasGeneral, 0, d->B0, d->value, 1);
+}
+
+static bench_resid_t bench_slange_fro_check(void *data) {
+    BENCH_CHECK
+    float s = 0.0;
+    for (size_t i = 0; i < tile; i++)
+        s += fabsf(d->B0[i])*fabsf(d->B0[i]);
+    float r = sqrtf(s);
+    return bench_svalues(1, d->value, &r, nb);
+}
+
+static bench_resid_t bench_slange_max_check(void *data) {
+    BENCH_CHECK
+    float r = 0.0;
+    for (size_t i = 0; i < tile; i++)
+        r = fmax(r, fabsf(d->B0[i]));
+    return bench_svalues(1, d->value, &r, nb);
+}
+
+static bench_resid_t bench_slange_aux_one_check(void *data) {
+    bench_sdata_t *d = (bench_sdata_t*)data;
+    return bench_ssums_check(d, 0, CoreBlasGeneral, 0, d->B0, d->dwork, 0);
+}
+
+static bench_resid_t bench_slange_aux_inf_check(void *data) {
+    bench_sdata_t *d = (bench_sdata_t*)data;
+    return bench_ssums_check(d, 1, CoreBlasGeneral, 0, d->B0, d->dwork, 0);
+}
+
+static bench_resid_t bench_slantr_aux_inf_check(void *data) {
+    bench_sdata_t *d = (bench_sdata_t*)data;
+    return bench_ssums_check(d, 1, CoreBlasUpper, 0, d->B0, d->dwork, 0);
+}
+
+// Column sums of the symmetric (or symmetric) matrix of the lower triangle
+// of A0.
+static bench_resid_t bench_slansy_aux_check(void *data) {
+    bench_sdata_t *d = (bench_sdata_t*)data;
+    return bench_ssums_check(d, 0, CoreBlasLower, 1, d->A0, d->dwork, 0);
+}
+
+static bench_resid_t bench_slansy_one_check(void *data) {
+    bench_sdata_t *d = (bench_sdata_t*)data;
+    return bench_ssums_check(d, 0, CoreBlasLower, 1, d->A0, d->value, 1);
+}
+
+static bench_resid_t bench_slantr_one_check(void *data) {
+    bench_sdata_t *d = (bench_sdata_t*)data;
+    return bench_ssums_check(d, 0, CoreBlasLower, 0, d->B0, d->value, 1);
+}
+
+// Scaled sum of squares (value[0], value[1]) of the uplo part of A,
+// with the mirrored entries for herm.
+static float bench_sssq_check(bench_sdata_t *d, coreblas_enum_t uplo,
+                               int herm, const float *A)
+{
+    int nb = d->nb;
+    float s = 0.0;
+    for (int j = 0; j < nb; j++) {
+        for (int i = 0; i < nb; i++) {
+            int in = uplo == CoreBlasGeneral ||
+                     (uplo == CoreBlasLower ? i >= j : i <= j);
+            if (in) {
+                float a = fabsf(A[i + nb*j]);
+                s += (herm && i != j ? 2.0 : 1.0)*a*a;
+            }
+        }
+    }
+    float x = d->value[0]*d->value[0]*d->value[1];
+    return bench_svalues(1, &x, &s, nb);
+}
+
+#ifdef COMPLEX
+static bench_resid_t bench_slansy_one_check(void *data) {
+    return bench_slansy_one_check(data);
+}
+
+static bench_resid_t bench_slansy_aux_check(void *data) {
+    return bench_slansy_aux_check(data);
+}
+
+static bench_resid_t bench_ssyssq_check(void *data) {
+    bench_sdata_t *d = (bench_sdata_t*)data;
+    return bench_sssq_check(d, CoreBlasLower, 1, d->A0);
+}
+#endif
+
+static bench_resid_t bench_sgessq_check(void *data) {
+    bench_sdata_t *d = (bench_sdata_t*)data;
+    return bench_sssq_check(d, CoreBlasGeneral, 0, d->B0);
+}
+
+static bench_resid_t bench_ssyssq_check(void *data) {
+    bench_sdata_t *d = (bench_sdata_t*)data;
+    return bench_sssq_check(d, CoreBlasLower, 1, d->A0);
+}
+
+static bench_resid_t bench_strssq_check(void *data) {
+    bench_sdata_t *d = (bench_sdata_t*)data;
+    return bench_sssq_check(d, CoreBlasLower, 0, d->B0);
+}
+
+// The sum of the terms scale^2 sumsq, relative to the sum of their moduli,
+// as the partial results read from B0 may be negative.
+static bench_resid_t bench_sreduce_ssq_check(void *data) {
+    BENCH_CHECK
+    const float *scale = (const float*)d->B0;
+    int n = nb*nb/2;
+    float s = 0.0;
+    float a = 0.0;
+    for (int i = 0; i < n; i++) {
+        s += scale[i]*scale[i]*scale[n+i];
+        a += fabsf(scale[i]*scale[i]*scale[n+i]);
+    }
+    float x = d->value[0]*d->value[0]*d->value[1];
+
+    // An infinite scale factor gives an infinite norm and not a NaN, also
+    // when two of them are merged by the tree.
+    const float iscale[3] = {1.0, INFINITY, 2.0};
+    const float isumsq[3] = {1.0, 1.0, 3.0};
+    float tscale[100], tsumsq[100];
+    for (int i = 0; i < 100; i++) {
+        tscale[i] = 1.0;
+        tsumsq[i] = 1.0;
+    }
+    tscale[0] = tscale[99] = INFINITY;
+    float iscl, isum, inorm, tscl, tsum;
+    coreblas_sreduce_ssq(3, iscale, isumsq, &iscl, &isum);
+    coreblas_sgessq_aux(3, iscale, isumsq, &inorm);
+    coreblas_sreduce_ssq(100, tscale, tsumsq, &tscl, &tsum);
+    if (!(isinf(iscl) && isum == 1.0 && isinf(inorm) &&
+          isinf(tscl) && tsum == 1.0))
+        return INFINITY;
+
+    return bench_sscaled(fabsf(x - s), a, nb);
+}
+
+// The largest of the column sums of the nb-by-nb partial sums read from B0.
+static bench_resid_t bench_sreduce_one_check(void *data) {
+    BENCH_CHECK
+    const float *W = (const float*)d->B0;
+    float r = -INFINITY;
+    for (int j = 0; j < nb; j++) {
+        float s = 0.0;
+        for (int i = 0; i < nb; i++)
+            s += W[i + nb*j];
+        r = fmax(r, s);
+    }
+    return bench_svalues(1, d->value, &r, nb);
+}
+
+//==============================================================================
+// Cholesky and triangular
+// L L^T = A0 on the lower triangle.
+static bench_resid_t bench_spotrf_check(void *data) {
+    BENCH_CHECK
+    float *L = bench_smalloc(2*tile);
+    float *X = &L[tile];
+    bench_stri(CoreBlasLower, nb, d->A, nb, L, nb);
+    coreblas_sgemm(CoreBlasNoTrans, CoreBlasTrans, nb, nb, nb,
+                   zone, L, nb, L, nb, 0.0, X, nb);
+    float resid = bench_sresid(CoreBlasLower, nb, nb, X, nb, d->A0, nb);
+    free(L);
+    return resid;
+}
+
+// L0 inv(L0) = I.
+static bench_resid_t bench_strtri_check(void *data) {
+    BENCH_CHECK
+    float *L = bench_smalloc(4*tile);
+    float *Y = &L[tile];
+    float *X = &L[2*tile];
+    float *E = &L[3*tile];
+    bench_stri(CoreBlasLower, nb, d->A0, nb, L, nb);
+    bench_stri(CoreBlasLower, nb, d->A, nb, Y, nb);
+    coreblas_sgemm(CoreBlasNoTrans, CoreBlasNoTrans, nb, nb, nb,
+                   zone, L, nb, Y, nb, 0.0, X, nb);
+    for (int j = 0; j < nb; j++)
+        for (int i = 0; i < nb; i++)
+            E[i + nb*j] = i == j ? 1.0 : 0.0;
+    float resid = bench_sresid(CoreBlasGeneral, nb, nb, X, nb, E, nb);
+    free(L);
+    return resid;
+}
+
+// L0^T L0 on the lower triangle.
+static bench_resid_t bench_slauum_check(void *data) {
+    BENCH_CHECK
+    float *L = bench_smalloc(2*tile);
+    float *R = &L[tile];
+    bench_stri(CoreBlasLower, nb, d->A0, nb, L, nb);
+    coreblas_sgemm(CoreBlasTrans, CoreBlasNoTrans, nb, nb, nb,
+                   zone, L, nb, L, nb, 0.0, R, nb);
+    float resid = bench_sresid(CoreBlasLower, nb, nb, d->A, nb, R, nb);
+    free(L);
+    return resid;
+}
+
+// L A L^T = A0 on the lower triangle, where A is symmetric.
+static bench_resid_t bench_ssygst_check(void *data) {
+    BENCH_CHECK
+    float *L = bench_smalloc(3*tile);
+    float *F = &L[tile];
+    float *X = &L[2*tile];
+    bench_stri(CoreBlasLower, nb, d->L, nb, L, nb);
+    bench_sfull(1, nb, d->A, nb, F, nb);
+    coreblas_sgemm(CoreBlasNoTrans, CoreBlasNoTrans, nb, nb, nb,
+                   zone, L, nb, F, nb, 0.0, X, nb);
+    coreblas_sgemm(CoreBlasNoTrans, CoreBlasTrans, nb, nb, nb,
+                   zone, X, nb, L, nb, 0.0, F, nb);
+    float resid = bench_sresid(CoreBlasLower, nb, nb, F, nb, d->A0, nb);
+    free(L);
+    return resid;
+}
+
+//==============================================================================
+// LU
+// L U = P B0.
+static bench_resid_t bench_sgetrf_check(void *data) {
+    BENCH_CHECK
+    float *L = bench_smalloc(4*tile);
+    float *U = &L[tile];
+    float *X = &L[2*tile];
+    float *R = &L[3*tile];
+    bench_stri(CoreBlasLower, nb, d->B, nb, L, nb);
+    bench_stri(CoreBlasUpper, nb, d->B, nb, U, nb);
+    for (int i = 0; i < nb; i++)
+        L[i + nb*i] = 1.0;
+    coreblas_sgemm(CoreBlasNoTrans, CoreBlasNoTrans, nb, nb, nb,
+                   zone, L, nb, U, nb, 0.0, X, nb);
+    memcpy(R, d->B0, tile*sizeof(float));
+    bench_spivot(nb, d->ipiv, R, nb);
+    float resid = bench_sresid(CoreBlasGeneral, nb, nb, X, nb, R, nb);
+    free(L);
+    return resid;
+}
+
+static bench_resid_t bench_sgetrf_calu_check(void *data) {
+    return bench_sgetrf_check(data);
+}
+
+// The first entry of B0 of largest |re| + |im| in column major order.
+static bench_resid_t bench_isamax_tile_check(void *data) {
+    BENCH_CHECK
+    float r = -1.0;
+    for (size_t i = 0; i < tile; i++) {
+        float a = fabsf(creal(d->B0[i])) + fabsf(cimag(d->B0[i]));
+        if (a > r)
+            r = a;
+    }
+    return d->value[0] == r ? 0.0 : INFINITY;
+}
+
+static bench_resid_t bench_sgeswp_check(void *data) {
+    BENCH_CHECK
+    float *R = bench_smalloc(tile);
+    memcpy(R, d->C0, tile*sizeof(float));
+    bench_spivot(nb, d->ipiv, R, nb);
+    float resid = bench_sresid(CoreBlasGeneral, nb, nb, d->C, nb, R, nb);
+    free(R);
+    return resid;
+}
+
+static bench_resid_t bench_sgeswp_blocked_check(void *data) {
+    return bench_sgeswp_check(data);
+}
+
+//==============================================================================
+// QR and LQ
+// Q R = B0, with R the upper triangle of B.
+static bench_resid_t bench_sgeqrt_check(void *data) {
+    BENCH_CHECK
+    float *R = bench_smalloc(tile);
+    bench_stri(CoreBlasUpper, nb, d->B, nb, R, nb);
+    bench_sunm_ref(CoreBlasLeft, CoreBlasNoTrans, CoreBlasColumnwise,
+                   nb, nb, nb, ib, d->B, nb, d->T, ib, R, nb);
+    float resid = bench_sresid(CoreBlasGeneral, nb, nb, R, nb, d->B0, nb);
+    free(R);
+    return resid;
+}
+
+// L Q = B0, with L the lower triangle of B.
+static bench_resid_t bench_sgelqt_check(void *data) {
+    BENCH_CHECK
+    float *L = bench_smalloc(tile);
+    bench_stri(CoreBlasLower, nb, d->B, nb, L, nb);
+    bench_sunm_ref(CoreBlasRight, CoreBlasNoTrans, CoreBlasRowwise,
+                   nb, nb, nb, ib, d->B, nb, d->T, ib, L, nb);
+    float resid = bench_sresid(CoreBlasGeneral, nb, nb, L, nb, d->B0, nb);
+    free(L);
+    return resid;
+}
+
+// Rebuilds the pair (A0, B0) factored into the triangle uplo of A and the
+// reflectors in B, and compares it on the triangle of A0 and on B0, or its
+// triangle uplo for the tt kernels.
+static float bench_sts_fact_check(bench_sdata_t *d, coreblas_enum_t side,
+                                   coreblas_enum_t direct,
+                                   coreblas_enum_t storev,
+                                   coreblas_enum_t uplo, int tri)
+{
+    int nb = d->nb;
+    size_t tile = (size_t)nb*nb;
+    float *X1 = bench_smalloc(2*tile);
+    float *X2 = &X1[tile];
+    bench_stri(uplo, nb, d->A, nb, X1, nb);
+    memset(X2, 0, tile*sizeof(float));
+    bench_sts_ref(side, CoreBlasNoTrans, direct, storev, tri,
+                  nb, nb, X1, nb, nb, nb, X2, nb, nb, d->ib,
+                  d->B, nb, d->T, d->ib);
+    float resid1 = bench_sresid(uplo, nb, nb, X1, nb, d->A0, nb);
+    float resid2 = bench_sresid(tri ? uplo : CoreBlasGeneral, nb, nb,
+                                 X2, nb, d->B0, nb);
+    free(X1);
+    return fmax(resid1, resid2);
+}
+
+static bench_resid_t bench_stsqrt_check(void *data) {
+    return bench_sts_fact_check((bench_sdata_t*)data, CoreBlasLeft,
+                                CoreBlasForward, CoreBlasColumnwise,
+                                CoreBlasUpper, 0);
+}
+
+static bench_resid_t bench_stsqrt_rec_check(void *data) {
+    return bench_stsqrt_check(data);
+}
+
+static bench_resid_t bench_stslqt_check(void *data) {
+    return bench_sts_fact_check((bench_sdata_t*)data, CoreBlasRight,
+                                CoreBlasForward, CoreBlasRowwise,
+                                CoreBlasLower, 0);
+}
+
+static bench_resid_t bench_stsqlt_check(void *data) {
+    return bench_sts_fact_check((bench_sdata_t*)data, CoreBlasLeft,
+                                CoreBlasBackward, CoreBlasColumnwise,
+                                CoreBlasLower, 0);
+}
+
+static bench_resid_t bench_stsrqt_check(void *data) {
+    return bench_sts_fact_check((bench_sdata_t*)data, CoreBlasRight,
+                                CoreBlasBackward, CoreBlasRowwise,
+                                CoreBlasUpper, 0);
+}
+
+static bench_resid_t bench_sttqrt_check(void *data) {
+    return bench_sts_fact_check((bench_sdata_t*)data, CoreBlasLeft,
+                                CoreBlasForward, CoreBlasColumnwise,
+                                CoreBlasUpper, 1);
+}
+
+static bench_resid_t bench_sttqrt_rec_check(void *data) {
+    return bench_sttqrt_check(data);
+}
+
+static bench_resid_t bench_sttlqt_check(void *data) {
+    return bench_sts_fact_check((bench_sdata_t*)data, CoreBlasRight,
+                                CoreBlasForward, CoreBlasRowwise,
+                                CoreBlasLower, 1);
+}
+
+// op(Q) C0, with k reflectors of the geqrt or gelqt factorization.
+static float bench_sunm_check(bench_sdata_t *d, coreblas_enum_t storev,
+                               int k, const float *V,
+                               const float *T)
+{
+    int nb = d->nb;
+    size_t tile = (size_t)nb*nb;
+    float *R = bench_smalloc(tile);
+    memcpy(R, d->C0, tile*sizeof(float));
+    bench_sunm_ref(CoreBlasLeft, CoreBlasTrans, storev,
+                   nb, nb, k, d->ib, V, nb, T, d->ib, R, nb);
+    float resid = bench_sresid(CoreBlasGeneral, nb, nb, d->C, nb, R, nb);
+    free(R);
+    return resid;
+}
+
+static bench_resid_t bench_sormqr_check(void *data) {
+    bench_sdata_t *d = (bench_sdata_t*)data;
+    return bench_sunm_check(d, CoreBlasColumnwise, d->nb, d->Vqr, d->Tqr);
+}
+
+static bench_resid_t bench_sormlq_check(void *data) {
+    bench_sdata_t *d = (bench_sdata_t*)data;
+    return bench_sunm_check(d, CoreBlasRowwise, d->nb, d->Vlq, d->Tlq);
+}
+
+// op(Q) applied to the first m1 rows of B0 over C0, compared with B and C.
+static float bench_sts_update_check(bench_sdata_t *d, int m1, int k,
+                                     coreblas_enum_t direct,
+                                     coreblas_enum_t storev, int tri,
+                                     const float *V,
+                                     const float *T,
+                                     const float *B,
+                                     const float *C)
+{
+    int nb = d->nb;
+    size_t tile = (size_t)nb*nb;
+    float *R1 = bench_smalloc(2*tile);
+    float *R2 = &R1[tile];
+    memcpy(R1, d->B0, tile*sizeof(float));
+    memcpy(R2, d->C0, tile*sizeof(float));
+    bench_sts_ref(CoreBlasLeft, CoreBlasTrans, direct, storev, tri,
+                  m1, nb, R1, nb, nb, nb, R2, nb, k, d->ib, V, nb, T, d->ib);
+    float resid = fmax(
+        bench_sresid(CoreBlasGeneral, nb, nb, B, nb, R1, nb),
+        bench_sresid(CoreBlasGeneral, nb, nb, C, nb, R2, nb));
+    free(R1);
+    return resid;
+}
+
+static bench_resid_t bench_stsmqr_check(void *data) {
+    bench_sdata_t *d = (bench_sdata_t*)data;
+    return bench_sts_update_check(d, d->nb, d->nb, CoreBlasForward,
+                                  CoreBlasColumnwise, 0, d->Vts, d->Tts,
+                                  d->B, d->C);
+}
+
+static bench_resid_t bench_stsmlq_check(void *data) {
+    bench_sdata_t *d = (bench_sdata_t*)data;
+    return bench_sts_update_check(d, d->nb, d->nb, CoreBlasForward,
+                                  CoreBlasRowwise, 0, d->Vtsl, d->Ttsl,
+                                  d->B, d->C);
+}
+
+static bench_resid_t bench_stsmql_check(void *data) {
+    bench_sdata_t *d = (bench_sdata_t*)data;
+    return bench_sts_update_check(d, d->nb, d->nb, CoreBlasBackward,
+                                  CoreBlasColumnwise, 0, d->Vtsb, d->Ttsb,
+                                  d->B, d->C);
+}
+
+static bench_resid_t bench_stsmrq_check(void *data) {
+    bench_sdata_t *d = (bench_sdata_t*)data;
+    return bench_sts_update_check(d, d->nb, d->nb, CoreBlasBackward,
+                                  CoreBlasRowwise, 0, d->Vtsr, d->Ttsr,
+                                  d->B, d->C);
+}
+
+static bench_resid_t bench_sttmqr_check(void *data) {
+    bench_sdata_t *d = (bench_sdata_t*)data;
+    return bench_sts_update_check(d, d->nb, d->nb, CoreBlasForward,
+                                  CoreBlasColumnwise, 1, d->Vtt, d->Ttt,
+                                  d->B, d->C);
+}
+
+static bench_resid_t bench_sttmlq_check(void *data) {
+    bench_sdata_t *d = (bench_sdata_t*)data;
+    return bench_sts_update_check(d, d->nb, d->nb, CoreBlasForward,
+                                  CoreBlasRowwise, 1, d->Vttl, d->Tttl,
+                                  d->B, d->C);
+}
+
+static bench_resid_t bench_sparfb_check(void *data) {
+    bench_sdata_t *d = (bench_sdata_t*)data;
+    return bench_sts_update_check(d, d->ib, d->ib, CoreBlasForward,
+                                  CoreBlasColumnwise, 0, d->Vts, d->Tts,
+                                  d->B, d->C);
+}
+
+// W = B0(0:ib,:) + V(:,0:ib)^T C0.
+static bench_resid_t bench_spamm_check(void *data) {
+    BENCH_CHECK
+    float *R = bench_smalloc((size_t)ib*nb);
+    coreblas_slacpy(CoreBlasGeneral, CoreBlasNoTrans, ib, nb,
+                    d->B0, nb, R, ib);
+    coreblas_sgemm(CoreBlasTrans, CoreBlasNoTrans, ib, nb, nb,
+                   zone, d->Vts, nb, d->C0, nb, zone, R, ib);
+    float resid = bench_sresid(CoreBlasGeneral, ib, nb, d->work, ib, R, ib);
+    free(R);
+    return resid;
+}
+
+// The first column of C0 + V^T B0.
+static bench_resid_t bench_spemv_check(void *data) {
+    BENCH_CHECK
+    float *r = bench_smalloc(nb);
+    for (int j = 0; j < nb; j++) {
+        r[j] = d->C0[j];
+        for (int i = 0; i < nb; i++)
+            r[j] += (d->Vts[i + nb*j])*d->B0[i];
+    }
+    float resid = bench_sresid(CoreBlasGeneral, nb, 1, d->C, nb, r, nb);
+    free(r);
+    return resid;
+}
+
+// Every side and trans for one storev/direct case, against LAPACKE larfb
+// with the same V and T.
+static float bench_slarfb_gemm_cases(bench_sdata_t *d,
+                                      coreblas_enum_t direct,
+                                      coreblas_enum_t storev,
+                                      const float *V,
+                                      const float *T,
+                                      int ldt)
+{
+    int nb = d->nb;
+    int ib = d->ib;
+    size_t tile = (size_t)nb*nb;
+    coreblas_enum_t sides[] = { CoreBlasLeft, CoreBlasRight };
+    coreblas_enum_t transs[] = { CoreBlasNoTrans, CoreBlasTrans };
+    float *R = bench_smalloc(tile);
+    float resid = 0.0;
+    for (int s = 0; s < 2; s++) {
+        for (int t = 0; t < 2; t++) {
+            memcpy(d->C, d->C0, tile*sizeof(float));
+            memcpy(R, d->C0, tile*sizeof(float));
+            coreblas_slarfb_gemm(sides[s], transs[t], direct, storev,
+                                 nb, nb, ib, V, nb, T, ldt,
+                                 d->C, nb, d->work, nb);
+            bench_slarfb(sides[s], transs[t], direct, storev,
+                         nb, nb, ib, V, nb, T, ldt, R, nb);
+            float r = bench_sresid(CoreBlasGeneral, nb, nb, d->C, nb, R, nb);
+            resid = r > resid ? r : resid;
+        }
+    }
+    free(R);
+    return resid;
+}
+
+static bench_resid_t bench_slarfb_gemm_check(void *data) {
+    bench_sdata_t *d = (bench_sdata_t*)data;
+    float resid = bench_sunm_check(d, CoreBlasColumnwise, d->ib,
+                                    d->Vqr, d->Tqr);
+    float rcases = bench_slarfb_gemm_cases(d, CoreBlasForward,
+                                            CoreBlasColumnwise,
+                                            d->Vqrx, d->Tqr, d->ib);
+    return rcases > resid ? rcases : resid;
+}
+
+static bench_resid_t bench_slarfb_gemm_rowfwd_check(void *data) {
+    bench_sdata_t *d = (bench_sdata_t*)data;
+    return bench_slarfb_gemm_cases(d, CoreBlasForward, CoreBlasRowwise,
+                                   d->Vlqx, d->Tlq, d->ib);
+}
+
+static bench_resid_t bench_slarfb_gemm_colbwd_check(void *data) {
+    bench_sdata_t *d = (bench_sdata_t*)data;
+    return bench_slarfb_gemm_cases(d, CoreBlasBackward, CoreBlasColumnwise,
+                                   d->Vcbx, d->B0, d->nb);
+}
+
+static bench_resid_t bench_slarfb_gemm_rowbwd_check(void *data) {
+    bench_sdata_t *d = (bench_sdata_t*)data;
+    return bench_slarfb_gemm_cases(d, CoreBlasBackward, CoreBlasRowwise,
+                                   d->Vrbx, d->B0, d->nb);
+}
+
+static bench_resid_t bench_slarft_check(void *data) {
+    BENCH_CHECK
+    float *R = bench_smalloc(tile);
+#ifdef COREBLAS_USE_64BIT_BLAS
+    LAPACKE_slarft_work64_(LAPACK_COL_MAJOR, 'F', 'C', nb, nb,
+                           d->Vqr, nb, d->tauqr, R, nb);
+#else
+    LAPACKE_slarft_work(LAPACK_COL_MAJOR, 'F', 'C', nb, nb,
+                        d->Vqr, nb, d->tauqr, R, nb);
+#endif
+    float resid = bench_sresid(CoreBlasUpper, nb, nb, d->C, nb, R, nb);
+    free(R);
+    return resid;
+}
+
+//==============================================================================
+// Batched kernels
+// The batch is not reset before the timed calls, which accumulate on it:
+// the checks reset it, repeat the call and compare every tile.
+static void bench_sreset_batch(bench_sdata_t *d)
+{
+    size_t tile = (size_t)d->nb*d->nb;
+    for (int i = 0; i < d->batch; i++) {
+        memcpy(d->Abp[i], d->B0, tile*sizeof(float));
+        memcpy(d->Cbp[i], d->C0, tile*sizeof(float));
+        memcpy(d->Dbp[i], d->B0, tile*sizeof(float));
+    }
+}
+
+static bench_resid_t bench_sgemm_batched_check(void *data) {
+    BENCH_CHECK
+    bench_sreset_batch(d);
+    if (bench_sgemm_batched_call(data) != 0)
+        return INFINITY;
+    float *R = bench_smalloc(tile);
+    memcpy(R, d->C0, tile*sizeof(float));
+    coreblas_sgemm(CoreBlasNoTrans, CoreBlasNoTrans, nb, nb, nb,
+                   zmone, d->B0, nb, d->B0, nb, zone, R, nb);
+    float resid = 0.0;
+    for (int i = 0; i < d->batch; i++) {
+        resid = fmax(resid, bench_sresid(CoreBlasGeneral, nb, nb,
+                                         d->Cbp[i], nb, R, nb));
+    }
+    free(R);
+    return resid;
+}
+
+static bench_resid_t bench_sgeqrt_batched_check(void *data) {
+    BENCH_CHECK
+    bench_sreset_batch(d);
+    if (bench_sgeqrt_batched_call(data) != 0)
+        return INFINITY;
+    float *R = bench_smalloc(tile);
+    float resid = 0.0;
+    for (int i = 0; i < d->batch; i++) {
+        bench_stri(CoreBlasUpper, nb, d->Abp[i], nb, R, nb);
+        bench_sunm_ref(CoreBlasLeft, CoreBlasNoTrans, CoreBlasColumnwise,
+                       nb, nb, nb, ib, d->Abp[i], nb, d->Tbp[i], ib, R, nb);
+        resid = fmax(resid, bench_sresid(CoreBlasGeneral, nb, nb,
+                                         R, nb, d->B0, nb));
+    }
+    free(R);
+    return resid;
+}
+
+static bench_resid_t bench_stsmqr_batched_check(void *data) {
+    BENCH_CHECK
+    bench_sreset_batch(d);
+    if (bench_stsmqr_batched_call(data) != 0)
+        return INFINITY;
+    float resid = 0.0;
+    for (int i = 0; i < d->batch; i++) {
+        resid = fmax(resid, bench_sts_update_check(
+            d, nb, nb, CoreBlasForward, CoreBlasColumnwise, 0,
+            d->Vts, d->Tts, d->Dbp[i], d->Cbp[i]));
+    }
+    return resid;
+}
+
+static bench_resid_t bench_stsmqr_row_check(void *data) {
+    BENCH_CHECK
+    bench_sreset_batch(d);
+    if (bench_stsmqr_row_call(data) != 0)
+        return INFINITY;
+    float resid = 0.0;
+    for (int i = 0; i < d->batch; i++) {
+        resid = fmax(resid, bench_sts_update_check(
+            d, nb, nb, CoreBlasForward, CoreBlasColumnwise, 0,
+            d->Vts, d->Tts, d->Dbp[i], d->Cbp[i]));
+    }
+    return resid;
+}
+
+//==============================================================================
+// Two-sided and band reductions
+// P A0 P^T on the lower triangle.
+static bench_resid_t bench_ssyswp_check(void *data) {
+    BENCH_CHECK
+    float *R = bench_smalloc(tile);
+    memcpy(R, d->A0, tile*sizeof(float));
+    for (int i = 0; i < nb; i++) {
+        int p = d->ipiv[i]-1;
+        for (int j = 0; p != i && j < nb; j++) {
+            float x = R[i + nb*j];
+            R[i + nb*j] = R[p + nb*j];
+            R[p + nb*j] = x;
+        }
+        for (int j = 0; p != i && j < nb; j++) {
+            float x = R[j + nb*i];
+            R[j + nb*i] = R[j + nb*p];
+            R[j + nb*p] = x;
+        }
+    }
+    float resid = bench_sresid(CoreBlasLower, nb, nb, d->A, nb, R, nb);
+    free(R);
+    return resid;
+}
+
+// Q^T A0 Q on the lower triangle.
+static bench_resid_t bench_ssyrfb_check(void *data) {
+    BENCH_CHECK
+    float *R = bench_smalloc(tile);
+    memcpy(R, d->A0, tile*sizeof(float));
+    bench_sunm_ref(CoreBlasLeft, CoreBlasTrans, CoreBlasColumnwise,
+                   nb, nb, nb, ib, d->Vqr, nb, d->Tqr, ib, R, nb);
+    bench_sunm_ref(CoreBlasRight, CoreBlasNoTrans, CoreBlasColumnwise,
+                   nb, nb, nb, ib, d->Vqr, nb, d->Tqr, ib, R, nb);
+    float resid = bench_sresid(CoreBlasLower, nb, nb, d->A, nb, R, nb);
+    free(R);
+    return resid;
+}
+
+// The tsmqr update of (B0^T, C0), with B compared with the conjugate
+// transpose of the top tile.
+static bench_resid_t bench_stsmqr_sytra1_check(void *data) {
+    BENCH_CHECK
+    float *R1 = bench_smalloc(3*tile);
+    float *R2 = &R1[tile];
+    float *X1 = &R1[2*tile];
+    for (int j = 0; j < nb; j++) {
+        for (int i = 0; i < nb; i++) {
+            R1[i + nb*j] = (d->B0[j + nb*i]);
+            X1[i + nb*j] = (d->B[j + nb*i]);
+        }
+    }
+    memcpy(R2, d->C0, tile*sizeof(float));
+    bench_sts_ref(CoreBlasLeft, CoreBlasTrans, CoreBlasForward,
+                  CoreBlasColumnwise, 0, nb, nb, R1, nb, nb, nb, R2, nb,
+                  nb, ib, d->Vts, nb, d->Tts, ib);
+    float resid = fmax(
+        bench_sresid(CoreBlasGeneral, nb, nb, X1, nb, R1, nb),
+        bench_sresid(CoreBlasGeneral, nb, nb, d->C, nb, R2, nb));
+    free(R1);
+    return resid;
+}
+
+// Q^T M Q, where M is the symmetric matrix of the lower triangles of A0 and
+// B0 on the diagonal and C0 below.
+static bench_resid_t bench_stsmqr_corner_check(void *data) {
+    BENCH_CHECK
+    int n2 = 2*nb;
+    float *M = bench_smalloc(4*tile);
+    float *F = bench_smalloc(tile);
+    bench_sfull(1, nb, d->A0, nb, F, nb);
+    coreblas_slacpy(CoreBlasGeneral, CoreBlasNoTrans, nb, nb, F, nb, M, n2);
+    bench_sfull(1, nb, d->B0, nb, F, nb);
+    coreblas_slacpy(CoreBlasGeneral, CoreBlasNoTrans, nb, nb,
+                    F, nb, &M[nb + n2*nb], n2);
+    for (int j = 0; j < nb; j++) {
+        for (int i = 0; i < nb; i++) {
+            M[(nb+i) + n2*j] = d->C0[i + nb*j];
+            M[j + n2*(nb+i)] = (d->C0[i + nb*j]);
+        }
+    }
+    bench_sts_ref(CoreBlasLeft, CoreBlasTrans, CoreBlasForward,
+                  CoreBlasColumnwise, 0, nb, n2, M, n2, nb, n2, &M[nb], n2,
+                  nb, ib, d->Vts, nb, d->Tts, ib);
+    bench_sts_ref(CoreBlasRight, CoreBlasNoTrans, CoreBlasForward,
+                  CoreBlasColumnwise, 0, n2, nb, M, n2, n2, nb, &M[n2*nb], n2,
+                  nb, ib, d->Vts, nb, d->Tts, ib);
+    float resid = fmax(fmax(
+        bench_sresid(CoreBlasLower, nb, nb, d->A, nb, M, n2),
+        bench_sresid(CoreBlasGeneral, nb, nb, d->C, nb, &M[nb], n2)),
+        bench_sresid(CoreBlasLower, nb, nb, d->B, nb, &M[nb + n2*nb], n2));
+    free(M);
+    free(F);
+    return resid;
+}
+
+// The chase is a orthogonal two-sided transformation of the band: it keeps the
+// Frobenius norms of the band and of its Gram matrix, and leaves the first
+// ncol columns and rows lower bidiagonal.
+static float bench_sband_check(bench_sdata_t *d,
+                                const float *band, int ncol)
+{
+    int nb = d->nb;
+    float *D = bench_smalloc((size_t)nb*nb);
+    bench_sband_dense(d, band, D);
+    float off = 0.0;
+    for (int j = 0; j < nb; j++) {
+        for (int i = 0; i < nb; i++) {
+            if ((i < ncol || j < ncol) && i != j && i != j+1)
+                off += fabsf(D[i + nb*j])*fabsf(D[i + nb*j]);
+        }
+    }
+    free(D);
+    float fro, fro2;
+    bench_sband_norms(d, band, &fro, &fro2);
+    return fmax(fmax(
+        bench_sscaled(fabsf(fro - d->band_fro), d->band_fro, nb),
+        bench_sscaled(fabsf(fro2 - d->band_fro2), d->band_fro2, nb)),
+        bench_sscaled(sqrtf(off), d->band_fro, nb));
+}
+
+// A task leaves a part of its update to the next ones: the first sweep is
+// completed from the task t on before the check.
+static float bench_ssweep_check(bench_sdata_t *d, int t)
+{
+    int ntask = coreblas_bulge_ntask(d->nb, d->bw, 0);
+    for (int s = t+1; s <= ntask; s++)
+        bench_sgbtype(d, s, d->band[t-1], d->vband[t-1]);
+    return bench_sband_check(d, d->band[t-1], 1);
+}
+
+static bench_resid_t bench_sgbtype1cb_check(void *data) {
+    return bench_ssweep_check((bench_sdata_t*)data, 1);
+}
+
+static bench_resid_t bench_sgbtype2cb_check(void *data) {
+    return bench_ssweep_check((bench_sdata_t*)data, 2);
+}
+
+static bench_resid_t bench_sgbtype3cb_check(void *data) {
+    return bench_ssweep_check((bench_sdata_t*)data, 3);
+}
+
+static bench_resid_t bench_sgbbrd_static_check(void *data) {
+    bench_sdata_t *d = (bench_sdata_t*)data;
+    return bench_sband_check(d, d->band[3], d->nb);
+}
+
+/******************************************************************************/
+static bench_flops_t bench_snone_flops(int nb, int ib)
+{
+    return 0.0;
+}
+
+#define BENCH_ROUTINE(name, flops, check) \
+    { #name, bench_##name##_call, flops, check }
+
+static const bench_routine_t bench_sroutines[] = {
+    // Level 3 BLAS
+    BENCH_ROUTINE(sgemm,   bench_sgemm_flops, bench_sgemm_check),
+    BENCH_ROUTINE(sgemm_batched, bench_sgemm_batched_flops,
+                  bench_sgemm_batched_check),
+#ifdef COMPLEX
+    BENCH_ROUTINE(ssymm,   bench_ssymm_flops, bench_ssymm_check),
+    BENCH_ROUTINE(ssyrk,   bench_ssyrk_flops, bench_ssyrk_check),
+    BENCH_ROUTINE(ssyr2k,  bench_ssyr2k_flops, bench_ssyr2k_check),
+#endif
+    BENCH_ROUTINE(ssymm,   bench_ssymm_flops, bench_ssymm_check),
+    BENCH_ROUTINE(ssyrk,   bench_ssyrk_flops, bench_ssyrk_check),
+    BENCH_ROUTINE(ssyr2k,  bench_ssyr2k_flops, bench_ssyr2k_check),
+    BENCH_ROUTINE(strmm,   bench_strmm_flops, bench_strmm_check),
+    BENCH_ROUTINE(strsm,   bench_strsm_flops, bench_strsm_check),
+
+    // Auxiliary
+    BENCH_ROUTINE(sgeadd,  bench_sgeadd_flops, bench_sgeadd_check),
+    BENCH_ROUTINE(stradd,  bench_stradd_flops, bench_stradd_check),
+    BENCH_ROUTINE(slacpy,  bench_snone_flops, bench_slacpy_check),
+    BENCH_ROUTINE(slacpy_lapack2tile_band, bench_snone_flops,
+                  bench_slacpy_check),
+    BENCH_ROUTINE(slacpy_tile2lapack_band, bench_snone_flops,
+                  bench_slacpy_check),
+    BENCH_ROUTINE(slaset,  bench_snone_flops, bench_slaset_check),
+    BENCH_ROUTINE(slascl,  bench_slascl_flops, bench_slascl_check),
+    BENCH_ROUTINE(slange_one, bench_snorm_flops, bench_slange_one_check),
+    BENCH_ROUTINE(slange_inf, bench_snorm_flops, bench_slange_inf_check),
+    BENCH_ROUTINE(slange_fro, bench_snorm_flops, bench_slange_fro_check),
+    BENCH_ROUTINE(slange_max, bench_snorm_flops, bench_slange_max_check),
+    BENCH_ROUTINE(slange_aux_one, bench_snorm_flops,
+                  bench_slange_aux_one_check),
+    BENCH_ROUTINE(slange_aux_inf, bench_snorm_flops,
+                  bench_slange_aux_inf_check),
+    BENCH_ROUTINE(slantr_aux_inf, bench_snorm_flops,
+                  bench_slantr_aux_inf_check),
+    BENCH_ROUTINE(slansy_aux, bench_snorm_flops, bench_slansy_aux_check),
+#ifdef COMPLEX
+    BENCH_ROUTINE(slansy_one, bench_snorm_flops, bench_slansy_one_check),
+    BENCH_ROUTINE(slansy_aux, bench_snorm_flops, bench_slansy_aux_check),
+    BENCH_ROUTINE(ssyssq,  bench_snorm_flops, bench_ssyssq_check),
+#endif
+    BENCH_ROUTINE(slansy_one, bench_snorm_flops, bench_slansy_one_check),
+    BENCH_ROUTINE(slantr_one, bench_snorm_flops, bench_slantr_one_check),
+    BENCH_ROUTINE(sgessq,  bench_snorm_flops, bench_sgessq_check),
+    BENCH_ROUTINE(ssyssq,  bench_snorm_flops, bench_ssyssq_check),
+    BENCH_ROUTINE(strssq,  bench_snorm_flops, bench_strssq_check),
+    BENCH_ROUTINE(sreduce_ssq, bench_snorm_flops, bench_sreduce_ssq_check),
+    BENCH_ROUTINE(sreduce_one, bench_snorm_flops, bench_sreduce_one_check),
+
+    // Cholesky and triangular
+    BENCH_ROUTINE(spotrf,  bench_spotrf_flops, bench_spotrf_check),
+    BENCH_ROUTINE(strtri,  bench_strtri_flops, bench_strtri_check),
+    BENCH_ROUTINE(slauum,  bench_slauum_flops, bench_slauum_check),
+    BENCH_ROUTINE(ssygst,  bench_ssygst_flops, bench_ssygst_check),
+
+    // LU
+    BENCH_ROUTINE(sgetrf,  bench_sgetrf_flops, bench_sgetrf_check),
+    BENCH_ROUTINE(sgetrf_calu, bench_sgetrf_flops, bench_sgetrf_calu_check),
+    BENCH_ROUTINE(isamax_tile, bench_snorm_flops, bench_isamax_tile_check),
+    BENCH_ROUTINE(sgeswp,  bench_snone_flops, bench_sgeswp_check),
+    BENCH_ROUTINE(sgeswp_blocked, bench_snone_flops,
+                  bench_sgeswp_blocked_check),
+
+    // QR and LQ
+    BENCH_ROUTINE(sgeqrt,  bench_sgeqrt_flops, bench_sgeqrt_check),
+    BENCH_ROUTINE(sgeqrt_batched, bench_sgeqrt_batched_flops,
+                  bench_sgeqrt_batched_check),
+    BENCH_ROUTINE(sgelqt,  bench_sgelqt_flops, bench_sgelqt_check),
+    BENCH_ROUTINE(stsqrt,  bench_stsqrt_flops, bench_stsqrt_check),
+    BENCH_ROUTINE(stsqrt_rec, bench_stsqrt_flops, bench_stsqrt_rec_check),
+    BENCH_ROUTINE(stslqt,  bench_stsqrt_flops, bench_stslqt_check),
+    BENCH_ROUTINE(stsqlt,  bench_stsqrt_flops, bench_stsqlt_check),
+    BENCH_ROUTINE(stsrqt,  bench_stsqrt_flops, bench_stsrqt_check),
+    BENCH_ROUTINE(sttqrt,  bench_sttqrt_flops, bench_sttqrt_check),
+    BENCH_ROUTINE(sttqrt_rec, bench_sttqrt_flops, bench_sttqrt_rec_check),
+    BENCH_ROUTINE(sttlqt,  bench_sttqrt_flops, bench_sttlqt_check),
+    BENCH_ROUTINE(sormqr,  bench_sormqr_flops, bench_sormqr_check),
+    BENCH_ROUTINE(sormlq,  bench_sormqr_flops, bench_sormlq_check),
+    BENCH_ROUTINE(stsmqr,  bench_stsmqr_flops, bench_stsmqr_check),
+    BENCH_ROUTINE(stsmqr_batched, bench_stsmqr_batched_flops,
+                  bench_stsmqr_batched_check),
+    BENCH_ROUTINE(stsmqr_row, bench_stsmqr_batched_flops,
+                  bench_stsmqr_row_check),
+    BENCH_ROUTINE(stsmlq,  bench_stsmqr_flops, bench_stsmlq_check),
+    BENCH_ROUTINE(stsmql,  bench_stsmqr_flops, bench_stsmql_check),
+    BENCH_ROUTINE(stsmrq,  bench_stsmqr_flops, bench_stsmrq_check),
+    BENCH_ROUTINE(sttmqr,  bench_sttmqr_flops, bench_sttmqr_check),
+    BENCH_ROUTINE(sttmlq,  bench_sttmqr_flops, bench_sttmlq_check),
+    BENCH_ROUTINE(sparfb,  bench_sparfb_flops, bench_sparfb_check),
+    BENCH_ROUTINE(spamm,   bench_spamm_flops, bench_spamm_check),
+    BENCH_ROUTINE(spemv,   bench_spemv_flops, bench_spemv_check),
+    BENCH_ROUTINE(slarfb_gemm, bench_slarfb_gemm_flops,
+                  bench_slarfb_gemm_check),
+    BENCH_ROUTINE(slarfb_gemm_rowfwd, bench_slarfb_gemm_flops,
+                  bench_slarfb_gemm_rowfwd_check),
+    BENCH_ROUTINE(slarfb_gemm_colbwd, bench_slarfb_gemm_flops,
+                  bench_slarfb_gemm_colbwd_check),
+    BENCH_ROUTINE(slarfb_gemm_rowbwd, bench_slarfb_gemm_flops,
+                  bench_slarfb_gemm_rowbwd_check),
+    BENCH_ROUTINE(slarft,  bench_slarft_flops, bench_slarft_check),
+
+    // Two-sided and band reductions
+    BENCH_ROUTINE(ssyswp,  bench_snone_flops, bench_ssyswp_check),
+    BENCH_ROUTINE(ssyrfb,  bench_ssyrfb_flops, bench_ssyrfb_check),
+    BENCH_ROUTINE(stsmqr_sytra1, bench_stsmqr_flops,
+                  bench_stsmqr_sytra1_check),
+    BENCH_ROUTINE(stsmqr_corner, bench_stsmqr_corner_flops,
+                  bench_stsmqr_corner_check),
+    BENCH_ROUTINE(sgbtype1cb, bench_snone_flops, bench_sgbtype1cb_check),
+    BENCH_ROUTINE(sgbtype2cb, bench_snone_flops, bench_sgbtype2cb_check),
+    BENCH_ROUTINE(sgbtype3cb, bench_snone_flops, bench_sgbtype3cb_check),
+    BENCH_ROUTINE(sgbbrd_static, bench_snone_flops,
+                  bench_sgbbrd_static_check),
+
+    { NULL, NULL, NULL, NULL }
+};
+
+/******************************************************************************/
+const bench_precision_t bench_s = {
+    bench_sroutines,
+    bench_screate,
+    bench_sreset,
+    bench_sdestroy,
+};
@@ -0,0 +1,2611 @@
+/**
+ *
+ * @file
+ *
+ *  COREBLAS is a software package provided by:
+ *  University of Tennessee, US,
+ *  University of Manchester, UK.
+ *
+ * @precisions normal z -> s d c
+ *
+ **/
+
+#include "bench.h"
+#include "flops.h"
+
+#include <coreblas.h>
+#include "core_lapack.h"
+#include "bulge.h"
+
+#include <math.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#define COMPLEX
+
+/***************************************************************************//**
+ *  Tiles shared by all kernels of one precision. All tiles are nb-by-nb with
+ *  leading dimension nb; X0 are pristine copies the working tiles are reset
+ *  from before every timed call.
+ **/
+typedef struct {
+    int nb;
+    int ib;
+
+    coreblas_complex64_t *A;   ///< Hermitian positive definite
+    coreblas_complex64_t *B;
+    coreblas_complex64_t *C;
+    coreblas_complex64_t *A0;
+    coreblas_complex64_t *B0;
+    coreblas_complex64_t *C0;
+    coreblas_complex64_t *L;   ///< Cholesky factor of A0
+
+    // Reflectors and T factors produced once by the factorization kernels
+    // and consumed by the update kernels.
+    coreblas_complex64_t *Vqr,  *Tqr;
+    coreblas_complex64_t *Vqrx;   ///< Vqr with its unit triangle explicit
+    coreblas_complex64_t *Vlqx;   ///< Vlq with its unit triangle explicit
+    coreblas_complex64_t *Vcbx, *Vrbx;   ///< explicit backward V of larfb_gemm
+    coreblas_complex64_t *Vlq,  *Tlq;
+    coreblas_complex64_t *Vts,  *Tts;
+    coreblas_complex64_t *Vtt,  *Ttt;
+    coreblas_complex64_t *Vtsl, *Ttsl;
+    coreblas_complex64_t *Vttl, *Tttl;
+    coreblas_complex64_t *Vtsb, *Ttsb;
+    coreblas_complex64_t *Vtsr, *Ttsr;
+
+    coreblas_complex64_t *T;
+    coreblas_complex64_t *tau;
+    coreblas_complex64_t *tauqr;   ///< scalar factors of Vqr
+    int *ipiv;   ///< pivots of the LU factorization of B0
+    coreblas_complex64_t *wcalu;
+    int *iwcalu;
+    int *iwork;
+    coreblas_complex64_t *work;
+    double *dwork;
+    double value[2];
+
+    // Batch of independent tiles for the batched kernels.
+    int batch;
+    coreblas_complex64_t *Ab, *Cb, *Db, *Tb;
+    coreblas_complex64_t **Abp, **Cbp, **Dbp, **Tbp;
+    const coreblas_complex64_t **Vp, **Tp;
+    coreblas_workspace_t wbatch;
+
+    // Lower band of order nb and width bw for the bulge chasing kernels, in
+    // the (3*bw+1)-by-nb storage of the gbtype kernels, with the reflectors
+    // VQ, TAUQ, VP, TAUP of length 2*nb each in vband. Copy i < 3 is worked
+    // on by task i+1 of the first sweep and reset from band0[i], vband0[i]:
+    // the band, the band after task 1, and after task 2. Copy 3 is worked on
+    // by gbbrd_static and reset from the band.
+    int bw;
+    int ldband;
+    coreblas_complex64_t *band[4], *vband[4];
+    coreblas_complex64_t *band0[3], *vband0[3];
+    int *iwband;
+    double band_fro;   ///< Frobenius norm of the band
+    double band_fro2;  ///< Frobenius norm of its Gram matrix
+} bench_zdata_t;
+
+/******************************************************************************/
+// Number of tiles of the batched kernels, about 256K elements per batch.
+static int bench_zbatch(int nb)
+{
+    int batch = (1 << 18)/(nb*nb);
+    return batch > 1 ? batch : 1;
+}
+
+/******************************************************************************/
+static bench_flops_t bench_zflops(bench_flops_t fmuls, bench_flops_t fadds)
+{
+#ifdef COMPLEX
+    return 6.0*fmuls + 2.0*fadds;
+#else
+    return fmuls + fadds;
+#endif
+}
+
+/******************************************************************************/
+static double bench_zrand(unsigned long long *seed)
+{
+    // 64-bit linear congruential generator, uniform in [-0.5, 0.5)
+    *seed = *seed*6364136223846793005ULL + 1442695040888963407ULL;
+    return (double)(*seed >> 11)/9007199254740992.0 - 0.5;
+}
+
+/******************************************************************************/
+static void bench_zfill(int m, int n, coreblas_complex64_t *A, int lda,
+                        unsigned long long *seed)
+{
+    for (int j = 0; j < n; j++) {
+        for (int i = 0; i < m; i++) {
+#ifdef COMPLEX
+            double re = bench_zrand(seed);
+            double im = bench_zrand(seed);
+            A[i + lda*j] = re + im*_Complex_I;
+#else
+            A[i + lda*j] = bench_zrand(seed);
+#endif
+        }
+    }
+}
+
+/******************************************************************************/
+// LU factorization of one nb-by-nb tile by a single panel thread.
+static int bench_zgetrf_tile(coreblas_complex64_t *A, int nb, int ib,
+                             int *ipiv)
+{
+    coreblas_desc_t desc;
+    coreblas_desc_general_init(CoreBlasComplexDouble, A, nb, nb,
+                               nb, nb, 0, 0, nb, nb, &desc);
+
+    volatile int max_idx;
+    volatile coreblas_complex64_t max_val;
+    volatile int info = 0;
+    coreblas_barrier_t barrier;
+    coreblas_barrier_init(&barrier);
+
+    coreblas_zgetrf(desc, ipiv, ib, 0, 1,
+                    &max_idx, &max_val, &info, &barrier);
+    return info;
+}
+
+/*******************************************************************************
+ *  References for the checks, computed with unblocked loops or with the
+ *  BLAS and LAPACK routines the kernels are meant to match.
+ **/
+static coreblas_complex64_t *bench_zmalloc(size_t size)
+{
+    coreblas_complex64_t *A = (coreblas_complex64_t*)malloc(
+        (size > 0 ? size : 1)*sizeof(coreblas_complex64_t));
+    if (A == NULL) {
+        fprintf(stderr, "allocation failed in the check\n");
+        exit(EXIT_FAILURE);
+    }
+    return A;
+}
+
+/******************************************************************************/
+// Error relative to the reference, in units of nb times the machine epsilon.
+static double bench_zscaled(double err, double nrm, int nb)
+{
+    double eps = LAPACKE_dlamch_work('e');
+    return err/(nrm > 0.0 ? nrm : 1.0)/(nb*eps);
+}
+
+/******************************************************************************/
+// Scaled Frobenius norm error of the uplo part of the m-by-n matrix X
+// against the reference R.
+static double bench_zresid(coreblas_enum_t uplo, int m, int n,
+                           const coreblas_complex64_t *X, int ldx,
+                           const coreblas_complex64_t *R, int ldr)
+{
+    double err = 0.0;
+    double nrm = 0.0;
+    for (int j = 0; j < n; j++) {
+        int ifirst = uplo == CoreBlasLower ? j : 0;
+        int ilast  = uplo == CoreBlasUpper && j+1 < m ? j+1 : m;
+        for (int i = ifirst; i < ilast; i++) {
+            double e = cabs(X[i + (size_t)ldx*j] - R[i + (size_t)ldr*j]);
+            double r = cabs(R[i + (size_t)ldr*j]);
+            err += e*e;
+            nrm += r*r;
+        }
+    }
+    return bench_zscaled(sqrt(err), sqrt(nrm), m > n ? m : n);
+}
+
+/******************************************************************************/
+// B = the uplo triangle of A, zero elsewhere.
+static void bench_ztri(coreblas_enum_t uplo, int n,
+                       const coreblas_complex64_t *A, int lda,
+                       coreblas_complex64_t *B, int ldb)
+{
+    for (int j = 0; j < n; j++) {
+        for (int i = 0; i < n; i++) {
+            int in = uplo == CoreBlasLower ? i >= j : i <= j;
+            B[i + (size_t)ldb*j] = in ? A[i + (size_t)lda*j] : 0.0;
+        }
+    }
+}
+
+/******************************************************************************/
+// B = the full matrix of which A holds the lower triangle, Hermitian if herm
+// and symmetric otherwise; the diagonal is copied as is.
+static void bench_zfull(int herm, int n,
+                        const coreblas_complex64_t *A, int lda,
+                        coreblas_complex64_t *B, int ldb)
+{
+    for (int j = 0; j < n; j++) {
+        B[j + (size_t)ldb*j] = A[j + (size_t)lda*j];
+        for (int i = j+1; i < n; i++) {
+            coreblas_complex64_t a = A[i + (size_t)lda*j];
+            B[i + (size_t)ldb*j] = a;
+            B[j + (size_t)ldb*i] = herm ? conj(a) : a;
+        }
+    }
+}
+
+/******************************************************************************/
+// Applies the row interchanges of the 1-based pivots ipiv to the n rows of X.
+static void bench_zpivot(int n, const int *ipiv,
+                         coreblas_complex64_t *X, int ldx)
+{
+    for (int i = 0; i < n; i++) {
+        int p = ipiv[i]-1;
+        for (int j = 0; p != i && j < n; j++) {
+            coreblas_complex64_t x = X[i + (size_t)ldx*j];
+            X[i + (size_t)ldx*j] = X[p + (size_t)ldx*j];
+            X[p + (size_t)ldx*j] = x;
+        }
+    }
+}
+
+/******************************************************************************/
+static void bench_zlarfb(coreblas_enum_t side, coreblas_enum_t trans,
+                         coreblas_enum_t direct, coreblas_enum_t storev,
+                         int m, int n, int k,
+                         const coreblas_complex64_t *V, int ldv,
+                         const coreblas_complex64_t *T, int ldt,
+                               coreblas_complex64_t *C, int ldc)
+{
+    int ldwork = side == CoreBlasLeft ? n : m;
+    coreblas_complex64_t *work = bench_zmalloc((size_t)ldwork*k);
+#ifdef COREBLAS_USE_64BIT_BLAS
+    LAPACKE_zlarfb_work64_(LAPACK_COL_MAJOR,
+                           lapack_const(side), lapack_const(trans),
+                           lapack_const(direct), lapack_const(storev),
+                           m, n, k, V, ldv, T, ldt, C, ldc, work, ldwork);
+#else
+    LAPACKE_zlarfb_work(LAPACK_COL_MAJOR,
+                        lapack_const(side), lapack_const(trans),
+                        lapack_const(direct), lapack_const(storev),
+                        m, n, k, V, ldv, T, ldt, C, ldc, work, ldwork);
+#endif
+    free(work);
+}
+
+/******************************************************************************/
+// V = the k reflectors of order n in A, columnwise (n-by-k) or rowwise
+// (k-by-n), with the unit triangle of larfb_gemm stored explicitly: in the
+// first k positions for forward and in the last k for backward reflectors.
+static void bench_zlarfb_v(coreblas_enum_t direct, coreblas_enum_t storev,
+                           int n, int k,
+                           const coreblas_complex64_t *A, int lda,
+                                 coreblas_complex64_t *V, int ldv)
+{
+    int col = storev == CoreBlasColumnwise;
+    int off = direct == CoreBlasForward ? 0 : n-k;
+    for (int q = 0; q < k; q++) {
+        for (int p = 0; p < n; p++) {
+            size_t ij = col ? p + (size_t)ldv*q : q + (size_t)ldv*p;
+            int r = p-off;
+            V[ij] = A[col ? p + (size_t)lda*q : q + (size_t)lda*p];
+            if (r == q)
+                V[ij] = 1.0;
+            else if (r >= 0 && r < k &&
+                     (direct == CoreBlasForward ? r < q : r > q))
+                V[ij] = 0.0;
+        }
+    }
+}
+
+/******************************************************************************/
+// Order of the blocks of reflectors applied by op(Q), as in LAPACK: with
+// rowwise storage, op is swapped, since LAPACK applies the reflectors of
+// an LQ factorization with the transposed block reflector.
+static int bench_zascending(coreblas_enum_t side, coreblas_enum_t transt,
+                            coreblas_enum_t direct)
+{
+    int left = side == CoreBlasLeft;
+    int notran = transt == CoreBlasNoTrans;
+    return direct == CoreBlasForward ? left != notran : left == notran;
+}
+
+static coreblas_enum_t bench_ztranst(coreblas_enum_t trans,
+                                     coreblas_enum_t storev)
+{
+    if (storev == CoreBlasColumnwise)
+        return trans;
+    return trans == CoreBlasNoTrans ? CoreBlas_ConjTrans : CoreBlasNoTrans;
+}
+
+/******************************************************************************/
+// C = op(Q) C or C op(Q), where Q is given by the k forward reflectors of a
+// geqrt (columnwise) or gelqt (rowwise) factorization with blocking ib.
+static void bench_zunm_ref(coreblas_enum_t side, coreblas_enum_t trans,
+                           coreblas_enum_t storev, int m, int n, int k,
+                           int ib,
+                           const coreblas_complex64_t *V, int ldv,
+                           const coreblas_complex64_t *T, int ldt,
+                                 coreblas_complex64_t *C, int ldc)
+{
+    int left = side == CoreBlasLeft;
+    coreblas_enum_t transt = bench_ztranst(trans, storev);
+    int ascend = bench_zascending(side, transt, CoreBlasForward);
+    int nblk = (k+ib-1)/ib;
+    for (int b = 0; b < nblk; b++) {
+        int i = (ascend ? b : nblk-1-b)*ib;
+        int kb = k-i < ib ? k-i : ib;
+        bench_zlarfb(side, transt, CoreBlasForward, storev,
+                     left ? m-i : m, left ? n : n-i, kb,
+                     &V[i + (size_t)ldv*i], ldv, &T[(size_t)ldt*i], ldt,
+                     left ? &C[i] : &C[(size_t)ldc*i], ldc);
+    }
+}
+
+/******************************************************************************/
+// Element r of the stack of the kb rows (left) or columns (right) of A1
+// starting at i1 and the whole A2, in the order (A1; A2) for forward and
+// (A2; A1) for backward reflectors; c indexes the other dimension.
+static coreblas_complex64_t *bench_zstack(int left, int forward, int kb,
+                                          int p2, int i1, int r, int c,
+                                          coreblas_complex64_t *A1, int lda1,
+                                          coreblas_complex64_t *A2, int lda2)
+{
+    int r1 = forward ? r : r-p2;
+    int r2 = forward ? r-kb : r;
+    if (r1 >= 0 && r1 < kb) {
+        return left ? &A1[(i1+r1) + (size_t)lda1*c]
+                    : &A1[c + (size_t)lda1*(i1+r1)];
+    }
+    return left ? &A2[r2 + (size_t)lda2*c] : &A2[c + (size_t)lda2*r2];
+}
+
+/******************************************************************************/
+// Applies op(Q) from the side to the pair (A1, A2), where Q is given by the
+// k reflectors of a ts (tri = 0) or tt (tri = 1) factorization with
+// blocking ib, stored in V and T as the factorization kernels leave them.
+// Each block is applied by larfb on an explicit copy of the stacked rows
+// or columns, with the unit part of the reflectors made explicit.
+static void bench_zts_ref(coreblas_enum_t side, coreblas_enum_t trans,
+                          coreblas_enum_t direct, coreblas_enum_t storev,
+                          int tri,
+                          int m1, int n1, coreblas_complex64_t *A1, int lda1,
+                          int m2, int n2, coreblas_complex64_t *A2, int lda2,
+                          int k, int ib,
+                          const coreblas_complex64_t *V, int ldv,
+                          const coreblas_complex64_t *T, int ldt)
+{
+    int left = side == CoreBlasLeft;
+    int forward = direct == CoreBlasForward;
+    int colwise = storev == CoreBlasColumnwise;
+    coreblas_enum_t transt = bench_ztranst(trans, storev);
+    int ascend = bench_zascending(side, transt, direct);
+    int p2 = left ? m2 : n2;
+    int q  = left ? n1 : m1;
+    int off = forward ? 0 : (left ? m1 : n1) - k;
+
+    coreblas_complex64_t *S  = bench_zmalloc((size_t)(ib+p2)*q);
+    coreblas_complex64_t *Vb = bench_zmalloc((size_t)(ib+p2)*ib);
+    int nblk = (k+ib-1)/ib;
+    for (int b = 0; b < nblk; b++) {
+        int i = (ascend ? b : nblk-1-b)*ib;
+        int kb = k-i < ib ? k-i : ib;
+        int ls = kb + p2;
+        int lds = left ? ls : q;
+        int ldvb = colwise ? ls : kb;
+        for (int r = 0; r < ls; r++) {
+            for (int c = 0; c < q; c++) {
+                coreblas_complex64_t *a = bench_zstack(
+                    left, forward, kb, p2, off+i, r, c, A1, lda1, A2, lda2);
+                S[left ? r + (size_t)lds*c : c + (size_t)lds*r] = *a;
+            }
+            for (int c = 0; c < kb; c++) {
+                int r1 = forward ? r : r-p2;
+                int r2 = forward ? r-kb : r;
+                coreblas_complex64_t v;
+                if (r1 >= 0 && r1 < kb)
+                    v = r1 == c ? 1.0 : 0.0;
+                else if (tri && r2 > i+c)
+                    v = 0.0;
+                else
+                    v = colwise ? V[r2 + (size_t)ldv*(i+c)]
+                                : V[(i+c) + (size_t)ldv*r2];
+                Vb[colwise ? r + (size_t)ldvb*c : c + (size_t)ldvb*r] = v;
+            }
+        }
+        bench_zlarfb(side, transt, direct, storev,
+                     left ? ls : q, left ? q : ls, kb,
+                     Vb, ldvb, &T[(size_t)ldt*i], ldt, S, lds);
+        for (int r = 0; r < ls; r++) {
+            for (int c = 0; c < q; c++) {
+                coreblas_complex64_t *a = bench_zstack(
+                    left, forward, kb, p2, off+i, r, c, A1, lda1, A2, lda2);
+                *a = S[left ? r + (size_t)lds*c : c + (size_t)lds*r];
+            }
+        }
+    }
+    free(S);
+    free(Vb);
+}
+
+/******************************************************************************/
+// Task t of the first sweep of the chase of the band of the data.
+static void bench_zgbtype(bench_zdata_t *d, int t,
+                          coreblas_complex64_t *band,
+                          coreblas_complex64_t *vband)
+{
+    int nb = d->nb;
+    int st, ed;
+    coreblas_bulge_task(nb, d->bw, 0, t, &st, &ed);
+    coreblas_complex64_t *VQ = vband;
+    coreblas_complex64_t *TAUQ = &vband[2*nb];
+    coreblas_complex64_t *VP = &vband[4*nb];
+    coreblas_complex64_t *TAUP = &vband[6*nb];
+    if (t == 1) {
+        coreblas_zgbtype1cb(CoreBlasLower, nb, d->bw, band, d->ldband,
+                            VQ, TAUQ, VP, TAUP, st, ed, 0, 1, 0, d->work);
+    }
+    else if (t%2 == 0) {
+        coreblas_zgbtype2cb(CoreBlasLower, nb, d->bw, band, d->ldband,
+                            VQ, TAUQ, VP, TAUP, st, ed, 0, 1, 0, d->work);
+    }
+    else {
+        coreblas_zgbtype3cb(CoreBlasLower, nb, d->bw, band, d->ldband,
+                            VQ, TAUQ, VP, TAUP, st, ed, 0, 1, 0, d->work);
+    }
+}
+
+/******************************************************************************/
+// Expands the band storage into the dense nb-by-nb D.
+static void bench_zband_dense(const bench_zdata_t *d,
+                              const coreblas_complex64_t *band,
+                              coreblas_complex64_t *D)
+{
+    int nb = d->nb;
+    int bw = d->bw;
+    for (int j = 0; j < nb; j++) {
+        for (int i = 0; i < nb; i++) {
+            int r = bw + i - j;
+            D[i + (size_t)nb*j] = r >= 0 && r < d->ldband
+                                ? band[r + (size_t)d->ldband*j] : 0.0;
+        }
+    }
+}
+
+/******************************************************************************/
+// Unitary invariants of the band: the Frobenius norms of D and of D^H D.
+static void bench_zband_norms(const bench_zdata_t *d,
+                              const coreblas_complex64_t *band,
+                              double *fro, double *fro2)
+{
+    int nb = d->nb;
+    coreblas_complex64_t *D = bench_zmalloc(2*(size_t)nb*nb);
+    coreblas_complex64_t *G = &D[(size_t)nb*nb];
+    bench_zband_dense(d, band, D);
+    coreblas_zgemm(CoreBlas_ConjTrans, CoreBlasNoTrans, nb, nb, nb,
+                   1.0, D, nb, D, nb, 0.0, G, nb);
+    double s = 0.0;
+    double s2 = 0.0;
+    for (size_t i = 0; i < (size_t)nb*nb; i++) {
+        s  += cabs(D[i])*cabs(D[i]);
+        s2 += cabs(G[i])*cabs(G[i]);
+    }
+    *fro = sqrt(s);
+    *fro2 = sqrt(s2);
+    free(D);
+}
+
+/******************************************************************************/
+static void *bench_zcreate(int nb, int ib)
+{
+    bench_zdata_t *d = (bench_zdata_t*)calloc(1, sizeof(bench_zdata_t));
+    if (d == NULL)
+        return NULL;
+
+    size_t tile = (size_t)nb*nb;
+    d->nb = nb;
+    d->ib = ib;
+
+    coreblas_complex64_t **tiles[] = {
+        &d->A, &d->B, &d->C, &d->A0, &d->B0, &d->C0, &d->L,
+        &d->Vqr, &d->Vlq, &d->Vts, &d->Vtt, &d->Vtsl, &d->Vttl,
+        &d->Vtsb, &d->Vtsr, &d->Vqrx, &d->Vlqx, &d->Vcbx, &d->Vrbx,
+    };
+    coreblas_complex64_t **tfactors[] = {
+        &d->Tqr, &d->Tlq, &d->Tts, &d->Ttt, &d->Ttsl, &d->Tttl, &d->T,
+        &d->Ttsb, &d->Ttsr,
+    };
+    int ok = 1;
+    for (size_t i = 0; i < sizeof(tiles)/sizeof(tiles[0]); i++) {
+        *tiles[i] = (coreblas_complex64_t*)malloc(
+            tile*sizeof(coreblas_complex64_t));
+        ok = ok && *tiles[i] != NULL;
+    }
+    for (size_t i = 0; i < sizeof(tfactors)/sizeof(tfactors[0]); i++) {
+        *tfactors[i] = (coreblas_complex64_t*)calloc(
+            (size_t)ib*nb, sizeof(coreblas_complex64_t));
+        ok = ok && *tfactors[i] != NULL;
+    }
+    d->tau   = (coreblas_complex64_t*)malloc(
+        (size_t)nb*sizeof(coreblas_complex64_t));
+    d->tauqr = (coreblas_complex64_t*)malloc(
+        (size_t)nb*sizeof(coreblas_complex64_t));
+    d->work  = (coreblas_complex64_t*)malloc(
+        4*tile*sizeof(coreblas_complex64_t));
+    d->dwork = (double*)malloc(2*(size_t)nb*sizeof(double));
+    d->ipiv  = (int*)malloc((size_t)nb*sizeof(int));
+
+    coreblas_desc_t panel;
+    coreblas_desc_general_init(CoreBlasComplexDouble, d->B, nb, nb,
+                               nb, nb, 0, 0, nb, nb, &panel);
+    d->wcalu  = (coreblas_complex64_t*)malloc(
+        coreblas_zgetrf_calu_lwork(panel, 1)*sizeof(coreblas_complex64_t));
+    d->iwcalu = (int*)malloc(coreblas_zgetrf_calu_liwork(panel, 1)*sizeof(int));
+    d->iwork  = (int*)malloc(
+        coreblas_zgeswp_blocked_liwork(1, nb)*sizeof(int));
+
+    int batch = bench_zbatch(nb);
+    d->batch = batch;
+    d->Ab  = (coreblas_complex64_t*)malloc(
+        batch*tile*sizeof(coreblas_complex64_t));
+    d->Cb  = (coreblas_complex64_t*)malloc(
+        batch*tile*sizeof(coreblas_complex64_t));
+    d->Db  = (coreblas_complex64_t*)malloc(
+        batch*tile*sizeof(coreblas_complex64_t));
+    d->Tb  = (coreblas_complex64_t*)calloc(
+        batch*(size_t)ib*nb, sizeof(coreblas_complex64_t));
+    d->Abp = (coreblas_complex64_t**)malloc(
+        batch*sizeof(coreblas_complex64_t*));
+    d->Cbp = (coreblas_complex64_t**)malloc(
+        batch*sizeof(coreblas_complex64_t*));
+    d->Dbp = (coreblas_complex64_t**)malloc(
+        batch*sizeof(coreblas_complex64_t*));
+    d->Tbp = (coreblas_complex64_t**)malloc(
+        batch*sizeof(coreblas_complex64_t*));
+    d->Vp  = (const coreblas_complex64_t**)malloc(
+        batch*sizeof(coreblas_complex64_t*));
+    d->Tp  = (const coreblas_complex64_t**)malloc(
+        batch*sizeof(coreblas_complex64_t*));
+    size_t lwbatch = coreblas_zgeqrt_batched_lwork(nb, nb, ib);
+    size_t lwtsmqr = coreblas_ztsmqr_lwork(CoreBlasLeft, nb, nb, ib);
+    int wbatch = coreblas_workspace_create(
+        &d->wbatch, lwbatch > lwtsmqr ? lwbatch : lwtsmqr,
+        CoreBlasComplexDouble);
+
+    // Task 3 of the first sweep exists from nb = bw+3 on.
+    int bw = nb-3 < ib ? nb-3 : ib;
+    bw = bw > 1 ? bw : 1;
+    d->bw = bw;
+    d->ldband = 3*bw+1;
+    size_t lband = (size_t)d->ldband*nb;
+    for (int i = 0; i < 4; i++) {
+        d->band[i]  = (coreblas_complex64_t*)calloc(
+            lband, sizeof(coreblas_complex64_t));
+        d->vband[i] = (coreblas_complex64_t*)calloc(
+            8*(size_t)nb, sizeof(coreblas_complex64_t));
+        ok = ok && d->band[i] != NULL && d->vband[i] != NULL;
+    }
+    for (int i = 0; i < 3; i++) {
+        d->band0[i]  = (coreblas_complex64_t*)calloc(
+            lband, sizeof(coreblas_complex64_t));
+        d->vband0[i] = (coreblas_complex64_t*)calloc(
+            8*(size_t)nb, sizeof(coreblas_complex64_t));
+        ok = ok && d->band0[i] != NULL && d->vband0[i] != NULL;
+    }
+    d->iwband = (int*)malloc(
+        coreblas_zgbbrd_static_liwork(nb, bw)*sizeof(int));
+
+    if (!ok || d->tau == NULL || d->tauqr == NULL || d->work == NULL ||
+        d->dwork == NULL ||
+        d->ipiv == NULL || d->wcalu == NULL || d->iwcalu == NULL ||
+        d->iwork == NULL || d->Ab == NULL || d->Cb == NULL ||
+        d->Db == NULL || d->Tb == NULL || d->Abp == NULL ||
+        d->Cbp == NULL || d->Dbp == NULL || d->Tbp == NULL ||
+        d->Vp == NULL || d->Tp == NULL || d->iwband == NULL ||
+        wbatch != CoreBlasSuccess) {
+        bench_z.destroy(d);
+        return NULL;
+    }
+
+    unsigned long long seed = 42;
+    bench_zfill(nb, nb, d->A0, nb, &seed);
+    bench_zfill(nb, nb, d->B0, nb, &seed);
+    bench_zfill(nb, nb, d->C0, nb, &seed);
+
+    // Make A0 Hermitian and diagonally dominant, hence positive definite
+    // and well conditioned for the triangular solvers.
+    for (int j = 0; j < nb; j++) {
+        for (int i = j+1; i < nb; i++)
+            d->A0[j + nb*i] = conj(d->A0[i + nb*j]);
+        d->A0[j + nb*j] = creal(d->A0[j + nb*j]) + nb;
+    }
+    memcpy(d->L, d->A0, tile*sizeof(coreblas_complex64_t));
+    coreblas_zpotrf(CoreBlasLower, nb, d->L, nb);
+
+    // Factors consumed by the update kernels.
+    memcpy(d->Vqr, d->B0, tile*sizeof(coreblas_complex64_t));
+    coreblas_zgeqrt(nb, nb, ib, d->Vqr, nb, d->Tqr, ib, d->tau, d->work);
+    for (int j = 0; j < nb; j++) {
+        d->tauqr[j] = d->Tqr[j%ib + ib*j];
+        for (int i = 0; i < nb; i++)
+            d->Vqrx[i + nb*j] = i > j ? d->Vqr[i + nb*j] : (i == j ? 1.0 : 0.0);
+    }
+    memcpy(d->Vlq, d->B0, tile*sizeof(coreblas_complex64_t));
+    coreblas_zgelqt(nb, nb, ib, d->Vlq, nb, d->Tlq, ib, d->tau, d->work);
+    bench_zlarfb_v(CoreBlasForward, CoreBlasRowwise, nb, ib,
+                   d->Vlq, nb, d->Vlqx, nb);
+    bench_zlarfb_v(CoreBlasBackward, CoreBlasColumnwise, nb, ib,
+                   d->C0, nb, d->Vcbx, nb);
+    bench_zlarfb_v(CoreBlasBackward, CoreBlasRowwise, nb, ib,
+                   d->C0, nb, d->Vrbx, nb);
+
+    memcpy(d->A, d->Vqr, tile*sizeof(coreblas_complex64_t));
+    memcpy(d->Vts, d->C0, tile*sizeof(coreblas_complex64_t));
+    coreblas_ztsqrt(nb, nb, ib, d->A, nb, d->Vts, nb, d->Tts, ib,
+                    d->tau, d->work);
+    memcpy(d->A, d->Vqr, tile*sizeof(coreblas_complex64_t));
+    memcpy(d->Vtt, d->Vqr, tile*sizeof(coreblas_complex64_t));
+    coreblas_zttqrt(nb, nb, ib, d->A, nb, d->Vtt, nb, d->Ttt, ib,
+                    d->tau, d->work);
+
+    memcpy(d->A, d->Vlq, tile*sizeof(coreblas_complex64_t));
+    memcpy(d->Vtsl, d->C0, tile*sizeof(coreblas_complex64_t));
+    coreblas_ztslqt(nb, nb, ib, d->A, nb, d->Vtsl, nb, d->Ttsl, ib,
+                    d->tau, d->work);
+    memcpy(d->A, d->Vlq, tile*sizeof(coreblas_complex64_t));
+    memcpy(d->Vttl, d->Vlq, tile*sizeof(coreblas_complex64_t));
+    coreblas_zttlqt(nb, nb, ib, d->A, nb, d->Vttl, nb, d->Tttl, ib,
+                    d->tau, d->work);
+
+    memcpy(d->A, d->Vlq, tile*sizeof(coreblas_complex64_t));
+    memcpy(d->Vtsb, d->C0, tile*sizeof(coreblas_complex64_t));
+    coreblas_ztsqlt(nb, nb, ib, d->A, nb, d->Vtsb, nb, d->Ttsb, ib,
+                    d->tau, d->work);
+    memcpy(d->A, d->Vqr, tile*sizeof(coreblas_complex64_t));
+    memcpy(d->Vtsr, d->C0, tile*sizeof(coreblas_complex64_t));
+    coreblas_ztsrqt(nb, nb, ib, d->A, nb, d->Vtsr, nb, d->Ttsr, ib,
+                    d->tau, d->work);
+
+    // Batch of copies of B0 and C0; all the pairs of the batched update
+    // share the reflectors of the ts factorization.
+    for (int i = 0; i < batch; i++) {
+        d->Abp[i] = &d->Ab[tile*i];
+        d->Cbp[i] = &d->Cb[tile*i];
+        d->Dbp[i] = &d->Db[tile*i];
+        d->Tbp[i] = &d->Tb[(size_t)ib*nb*i];
+        d->Vp[i] = d->Vts;
+        d->Tp[i] = d->Tts;
+        memcpy(d->Abp[i], d->B0, tile*sizeof(coreblas_complex64_t));
+        memcpy(d->Cbp[i], d->C0, tile*sizeof(coreblas_complex64_t));
+        memcpy(d->Dbp[i], d->B0, tile*sizeof(coreblas_complex64_t));
+    }
+
+    // Pivots consumed by the row interchange kernel.
+    memcpy(d->A, d->B0, tile*sizeof(coreblas_complex64_t));
+    bench_zgetrf_tile(d->A, nb, ib, d->ipiv);
+
+    // Band and its states after the first two tasks of the first sweep.
+    for (int j = 0; j < nb; j++)
+        bench_zfill(j+bw < nb ? bw+1 : nb-j, 1,
+                    &d->band0[0][bw + (size_t)d->ldband*j], d->ldband, &seed);
+    bench_zband_norms(d, d->band0[0], &d->band_fro, &d->band_fro2);
+    for (int t = 1; t < 3; t++) {
+        memcpy(d->band0[t], d->band0[t-1], lband*sizeof(coreblas_complex64_t));
+        memcpy(d->vband0[t], d->vband0[t-1],
+               8*(size_t)nb*sizeof(coreblas_complex64_t));
+        bench_zgbtype(d, t, d->band0[t], d->vband0[t]);
+    }
+
+    bench_z.reset(d);
+    return d;
+}
+
+/******************************************************************************/
+static void bench_zreset(void *data)
+{
+    bench_zdata_t *d = (bench_zdata_t*)data;
+    size_t size = (size_t)d->nb*d->nb*sizeof(coreblas_complex64_t);
+    size_t lband = (size_t)d->ldband*d->nb*sizeof(coreblas_complex64_t);
+    size_t lvband = 8*(size_t)d->nb*sizeof(coreblas_complex64_t);
+    for (int i = 0; i < 4; i++) {
+        memcpy(d->band[i],  d->band0[i%3],  lband);
+        memcpy(d->vband[i], d->vband0[i%3], lvband);
+    }
+    memcpy(d->A, d->A0, size);
+    memcpy(d->B, d->B0, size);
+    memcpy(d->C, d->C0, size);
+}
+
+/******************************************************************************/
+static void bench_zdestroy(void *data)
+{
+    bench_zdata_t *d = (bench_zdata_t*)data;
+    if (d == NULL)
+        return;
+
+    free(d->A);    free(d->B);    free(d->C);
+    free(d->A0);   free(d->B0);   free(d->C0);   free(d->L);
+    free(d->Vqr);  free(d->Vlq);  free(d->Vts);  free(d->Vtt);
+    free(d->Vtsl); free(d->Vttl); free(d->Vtsb); free(d->Vtsr);
+    free(d->Vqrx); free(d->Vlqx); free(d->Vcbx); free(d->Vrbx);
+    free(d->Tqr);  free(d->Tlq);  free(d->Tts);  free(d->Ttt);
+    free(d->Ttsl); free(d->Tttl); free(d->Ttsb); free(d->Ttsr);
+    free(d->T);
+    free(d->tau);  free(d->tauqr); free(d->work); free(d->dwork);
+    free(d->ipiv);
+    free(d->wcalu); free(d->iwcalu); free(d->iwork);
+    free(d->Ab);   free(d->Cb);   free(d->Db);   free(d->Tb);
+    free(d->Abp);  free(d->Cbp);  free(d->Dbp);  free(d->Tbp);
+    free(d->Vp);   free(d->Tp);
+    for (int i = 0; i < 4; i++) {
+        free(d->band[i]);
+        free(d->vband[i]);
+    }
+    for (int i = 0; i < 3; i++) {
+        free(d->band0[i]);
+        free(d->vband0[i]);
+    }
+    free(d->iwband);
+    if (d->wbatch.spaces != NULL)
+        coreblas_workspace_destroy(&d->wbatch);
+    free(d);
+}
+
+/*******************************************************************************
+ *  Kernel calls.
+ **/
+#define BENCH_DATA bench_zdata_t *d = (bench_zdata_t*)data; int nb = d->nb; \
+                   int ib = d->ib; (void)nb; (void)ib;
+
+static const coreblas_complex64_t zone  =  1.0;
+static const coreblas_complex64_t zmone = -1.0;
+
+//==============================================================================
+// Level 3 BLAS
+static int bench_zgemm_call(void *data) {
+    BENCH_DATA
+    coreblas_zgemm(CoreBlasNoTrans, CoreBlasNoTrans, nb, nb, nb,
+                   zmone, d->A, nb, d->B, nb, zone, d->C, nb);
+    return 0;
+}
+static bench_flops_t bench_zgemm_flops(int nb, int ib) {
+    return bench_zflops(FMULS_GEMM(nb, nb, nb), FADDS_GEMM(nb, nb, nb));
+}
+
+static int bench_zgemm_batched_call(void *data) {
+    BENCH_DATA
+    return coreblas_zgemm_batched(
+        CoreBlasNoTrans, CoreBlasNoTrans, nb, nb, nb,
+        zmone, (const coreblas_complex64_t * const *)d->Abp, nb,
+               (const coreblas_complex64_t * const *)d->Dbp, nb,
+        zone, d->Cbp, nb, d->batch);
+}
+static bench_flops_t bench_zgemm_batched_flops(int nb, int ib) {
+    return bench_zbatch(nb)*bench_zgemm_flops(nb, ib);
+}
+
+#ifdef COMPLEX
+static int bench_zhemm_call(void *data) {
+    BENCH_DATA
+    coreblas_zhemm(CoreBlasLeft, CoreBlasLower, nb, nb,
+                   zmone, d->A, nb, d->B, nb, zone, d->C, nb);
+    return 0;
+}
+
+static int bench_zherk_call(void *data) {
+    BENCH_DATA
+    coreblas_zherk(CoreBlasLower, CoreBlasNoTrans, nb, nb,
+                   -1.0, d->B, nb, 1.0, d->A, nb);
+    return 0;
+}
+
+static int bench_zher2k_call(void *data) {
+    BENCH_DATA
+    coreblas_zher2k(CoreBlasLower, CoreBlasNoTrans, nb, nb,
+                    zmone, d->B, nb, d->C, nb, 1.0, d->A, nb);
+    return 0;
+}
+#endif
+
+static int bench_zsymm_call(void *data) {
+    BENCH_DATA
+    coreblas_zsymm(CoreBlasLeft, CoreBlasLower, nb, nb,
+                   zmone, d->A, nb, d->B, nb, zone, d->C, nb);
+    return 0;
+}
+static bench_flops_t bench_zsymm_flops(int nb, int ib) {
+    return bench_zflops(FMULS_SYMM(nb, nb), FADDS_SYMM(nb, nb));
+}
+
+static int bench_zsyrk_call(void *data) {
+    BENCH_DATA
+    coreblas_zsyrk(CoreBlasLower, CoreBlasNoTrans, nb, nb,
+                   zmone, d->B, nb, zone, d->A, nb);
+    return 0;
+}
+static bench_flops_t bench_zsyrk_flops(int nb, int ib) {
+    return bench_zflops(FMULS_SYRK(nb, nb), FADDS_SYRK(nb, nb));
+}
+
+static int bench_zsyr2k_call(void *data) {
+    BENCH_DATA
+    coreblas_zsyr2k(CoreBlasLower, CoreBlasNoTrans, nb, nb,
+                    zmone, d->B, nb, d->C, nb, zone, d->A, nb);
+    return 0;
+}
+static bench_flops_t bench_zsyr2k_flops(int nb, int ib) {
+    return bench_zflops(FMULS_SYR2K(nb, nb), FADDS_SYR2K(nb, nb));
+}
+
+static int bench_ztrmm_call(void *data) {
+    BENCH_DATA
+    coreblas_ztrmm(CoreBlasLeft, CoreBlasLower, CoreBlasNoTrans,
+                   CoreBlasNonUnit, nb, nb, zone, d->A, nb, d->B, nb);
+    return 0;
+}
+static bench_flops_t bench_ztrmm_flops(int nb, int ib) {
+    return bench_zflops(FMULS_TRMM(nb, nb), FADDS_TRMM(nb, nb));
+}
+
+static int bench_ztrsm_call(void *data) {
+    BENCH_DATA
+    coreblas_ztrsm(CoreBlasLeft, CoreBlasLower, CoreBlasNoTrans,
+                   CoreBlasNonUnit, nb, nb, zone, d->A, nb, d->B, nb);
+    return 0;
+}
+static bench_flops_t bench_ztrsm_flops(int nb, int ib) {
+    return bench_zflops(FMULS_TRSM(nb, nb), FADDS_TRSM(nb, nb));
+}
+
+//==============================================================================
+// Auxiliary
+static int bench_zgeadd_call(void *data) {
+    BENCH_DATA
+    return coreblas_zgeadd(CoreBlasNoTrans, nb, nb,
+                           zmone, d->B, nb, zone, d->C, nb);
+}
+static bench_flops_t bench_zgeadd_flops(int nb, int ib) {
+    return bench_zflops(2.0*nb*nb, (double)nb*nb);
+}
+
+static int bench_ztradd_call(void *data) {
+    BENCH_DATA
+    return coreblas_ztradd(CoreBlasLower, CoreBlasNoTrans, nb, nb,
+                           zmone, d->B, nb, zone, d->C, nb);
+}
+static bench_flops_t bench_ztradd_flops(int nb, int ib) {
+    return bench_zflops((double)nb*(nb+1), 0.5*nb*(nb+1));
+}
+
+static int bench_zlacpy_call(void *data) {
+    BENCH_DATA
+    coreblas_zlacpy(CoreBlasGeneral, CoreBlasNoTrans, nb, nb,
+                    d->B, nb, d->C, nb);
+    return 0;
+}
+
+static int bench_zlacpy_lapack2tile_band_call(void *data) {
+    BENCH_DATA
+    coreblas_zlacpy_lapack2tile_band(CoreBlasGeneral, 0, 0, nb, nb, nb,
+                                     ib, ib, d->B, nb, d->C, nb);
+    return 0;
+}
+
+static int bench_zlacpy_tile2lapack_band_call(void *data) {
+    BENCH_DATA
+    coreblas_zlacpy_tile2lapack_band(CoreBlasGeneral, 0, 0, nb, nb, nb,
+                                     ib, ib, d->B, nb, d->C, nb);
+    return 0;
+}
+
+static int bench_zlaset_call(void *data) {
+    BENCH_DATA
+    coreblas_zlaset(CoreBlasGeneral, nb, nb, 0.0, 1.0, d->C, nb);
+    return 0;
+}
+
+static int bench_zlascl_call(void *data) {
+    BENCH_DATA
+    coreblas_zlascl(CoreBlasGeneral, 2.0, 3.0, nb, nb, d->C, nb);
+    return 0;
+}
+static bench_flops_t bench_zlascl_flops(int nb, int ib) {
+    return bench_zflops((double)nb*nb, 0.0);
+}
+
+static bench_flops_t bench_znorm_flops(int nb, int ib) {
+    return bench_zflops((double)nb*nb, (double)nb*nb);
+}
+
+static int bench_zlange_one_call(void *data) {
+    BENCH_DATA
+    coreblas_zlange(CoreBlasOneNorm, nb, nb, d->B, nb, d->dwork, d->value);
+    return 0;
+}
+
+static int bench_zlange_inf_call(void *data) {
+    BENCH_DATA
+    coreblas_zlange(CoreBlasInfNorm, nb, nb, d->B, nb, d->dwork, d->value);
+    return 0;
+}
+
+static int bench_zlange_fro_call(void *data) {
+    BENCH_DATA
+    coreblas_zlange(CoreBlasFrobeniusNorm, nb, nb, d->B, nb,
+                    d->dwork, d->value);
+    return 0;
+}
+
+static int bench_zlange_max_call(void *data) {
+    BENCH_DATA
+    coreblas_zlange(CoreBlasMaxNorm, nb, nb, d->B, nb, d->dwork, d->value);
+    return 0;
+}
+
+// Column and row sums, as computed on every tile by the tile norms.
+static int bench_zlange_aux_one_call(void *data) {
+    BENCH_DATA
+    coreblas_zlange_aux(CoreBlasOneNorm, nb, nb, d->B, nb, d->dwork);
+    return 0;
+}
+
+static int bench_zlange_aux_inf_call(void *data) {
+    BENCH_DATA
+    coreblas_zlange_aux(CoreBlasInfNorm, nb, nb, d->B, nb, d->dwork);
+    return 0;
+}
+
+static int bench_zlantr_aux_inf_call(void *data) {
+    BENCH_DATA
+    coreblas_zlantr_aux(CoreBlasInfNorm, CoreBlasUpper, CoreBlasNonUnit,
+                        nb, nb, d->B, nb, d->dwork);
+    return 0;
+}
+
+static int bench_zlansy_aux_call(void *data) {
+    BENCH_DATA
+    coreblas_zlansy_aux(CoreBlasOneNorm, CoreBlasLower, nb, d->A, nb,
+                        d->dwork);
+    return 0;
+}
+
+#ifdef COMPLEX
+static int bench_zlanhe_one_call(void *data) {
+    BENCH_DATA
+    coreblas_zlanhe(CoreBlasOneNorm, CoreBlasLower, nb, d->A, nb,
+                    d->dwork, d->value);
+    return 0;
+}
+
+static int bench_zlanhe_aux_call(void *data) {
+    BENCH_DATA
+    coreblas_zlanhe_aux(CoreBlasOneNorm, CoreBlasLower, nb, d->A, nb,
+                        d->dwork);
+    return 0;
+}
+
+static int bench_zhessq_call(void *data) {
+    BENCH_DATA
+    d->value[0] = 0.0;
+    d->value[1] = 1.0;
+    coreblas_zhessq(CoreBlasLower, nb, d->A, nb, &d->value[0], &d->value[1]);
+    return 0;
+}
+#endif
+
+static int bench_zlansy_one_call(void *data) {
+    BENCH_DATA
+    coreblas_zlansy(CoreBlasOneNorm, CoreBlasLower, nb, d->A, nb,
+                    d->dwork, d->value);
+    return 0;
+}
+
+static int bench_zlantr_one_call(void *data) {
+    BENCH_DATA
+    coreblas_zlantr(CoreBlasOneNorm, CoreBlasLower, CoreBlasNonUnit, nb, nb,
+                    d->B, nb, d->dwork, d->value);
+    return 0;
+}
+
+static int bench_zgessq_call(void *data) {
+    BENCH_DATA
+    d->value[0] = 0.0;
+    d->value[1] = 1.0;
+    coreblas_zgessq(nb, nb, d->B, nb, &d->value[0], &d->value[1]);
+    return 0;
+}
+
+static int bench_zsyssq_call(void *data) {
+    BENCH_DATA
+    d->value[0] = 0.0;
+    d->value[1] = 1.0;
+    coreblas_zsyssq(CoreBlasLower, nb, d->A, nb, &d->value[0], &d->value[1]);
+    return 0;
+}
+
+// Reductions of the partial results of nb*nb tiles, read from the tile B.
+static int bench_zreduce_ssq_call(void *data) {
+    BENCH_DATA
+    const double *scale = (const double*)d->B;
+    int n = nb*nb/2;
+    coreblas_zreduce_ssq(n, scale, &scale[n], &d->value[0], &d->value[1]);
+    return 0;
+}
+
+static int bench_zreduce_one_call(void *data) {
+    BENCH_DATA
+    coreblas_zreduce_norm(CoreBlasOneNorm, nb, nb, (const double*)d->B, nb,
+                          d->value);
+    return 0;
+}
+
+static int bench_ztrssq_call(void *data) {
+    BENCH_DATA
+    d->value[0] = 0.0;
+    d->value[1] = 1.0;
+    coreblas_ztrssq(CoreBlasLower, CoreBlasNonUnit, nb, nb, d->B, nb,
+                    &d->value[0], &d->value[1]);
+    return 0;
+}
+
+//==============================================================================
+// Cholesky and triangular
+static int bench_zpotrf_call(void *data) {
+    BENCH_DATA
+    return coreblas_zpotrf(CoreBlasLower, nb, d->A, nb);
+}
+static bench_flops_t bench_zpotrf_flops(int nb, int ib) {
+    return bench_zflops(FMULS_POTRF(nb), FADDS_POTRF(nb));
+}
+
+static int bench_ztrtri_call(void *data) {
+    BENCH_DATA
+    return coreblas_ztrtri(CoreBlasLower, CoreBlasNonUnit, nb, d->A, nb);
+}
+static bench_flops_t bench_ztrtri_flops(int nb, int ib) {
+    return bench_zflops(FMULS_TRTRI(nb), FADDS_TRTRI(nb));
+}
+
+static int bench_zlauum_call(void *data) {
+    BENCH_DATA
+    return coreblas_zlauum(CoreBlasLower, nb, d->A, nb);
+}
+static bench_flops_t bench_zlauum_flops(int nb, int ib) {
+    return bench_zflops(FMULS_LAUUM(nb), FADDS_LAUUM(nb));
+}
+
+static int bench_zhegst_call(void *data) {
+    BENCH_DATA
+    return coreblas_zhegst(1, CoreBlasLower, nb, d->A, nb, d->L, nb);
+}
+static bench_flops_t bench_zhegst_flops(int nb, int ib) {
+    return bench_zflops(FMULS_SYGST(nb), FADDS_SYGST(nb));
+}
+
+//==============================================================================
+// LU
+static int bench_zgetrf_call(void *data) {
+    BENCH_DATA
+    return bench_zgetrf_tile(d->B, nb, ib, d->ipiv);
+}
+static bench_flops_t bench_zgetrf_flops(int nb, int ib) {
+    return bench_zflops(FMULS_GETRF(nb, nb), FADDS_GETRF(nb, nb));
+}
+
+static int bench_zgetrf_calu_call(void *data) {
+    BENCH_DATA
+    coreblas_desc_t desc;
+    coreblas_desc_general_init(CoreBlasComplexDouble, d->B, nb, nb,
+                               nb, nb, 0, 0, nb, nb, &desc);
+
+    volatile int info = 0;
+    coreblas_barrier_t barrier;
+    coreblas_barrier_init(&barrier);
+
+    coreblas_zgetrf_calu(desc, d->ipiv, 0, 1, d->wcalu, d->iwcalu,
+                         &info, &barrier);
+    return info;
+}
+
+// Pivot search over the whole tile B.
+static int bench_izamax_tile_call(void *data) {
+    BENCH_DATA
+    int imax, jmax;
+    coreblas_izamax_tile(nb, nb, d->B, nb, &imax, &jmax, &d->value[0]);
+    return 0;
+}
+
+static int bench_zgeswp_call(void *data) {
+    BENCH_DATA
+    coreblas_desc_t desc;
+    coreblas_desc_general_init(CoreBlasComplexDouble, d->C, nb, nb,
+                               nb, nb, 0, 0, nb, nb, &desc);
+    coreblas_zgeswp(CoreBlasRowwise, desc, 1, nb, d->ipiv, 1);
+    return 0;
+}
+
+static int bench_zgeswp_blocked_call(void *data) {
+    BENCH_DATA
+    coreblas_desc_t desc;
+    coreblas_desc_general_init(CoreBlasComplexDouble, d->C, nb, nb,
+                               nb, nb, 0, 0, nb, nb, &desc);
+    coreblas_zgeswp_blocked(CoreBlasRowwise, desc, 1, nb, d->ipiv, 1,
+                            0, 1, d->work, d->iwork);
+    return 0;
+}
+
+//==============================================================================
+// QR and LQ
+static int bench_zgeqrt_call(void *data) {
+    BENCH_DATA
+    return coreblas_zgeqrt(nb, nb, ib, d->B, nb, d->T, ib, d->tau, d->work);
+}
+static bench_flops_t bench_zgeqrt_flops(int nb, int ib) {
+    return bench_zflops(FMULS_GEQRF(nb, nb), FADDS_GEQRF(nb, nb));
+}
+
+static int bench_zgeqrt_batched_call(void *data) {
+    BENCH_DATA
+    return coreblas_zgeqrt_batched(nb, nb, ib, d->Abp, nb, d->Tbp, ib,
+                                   &d->wbatch, d->batch);
+}
+static bench_flops_t bench_zgeqrt_batched_flops(int nb, int ib) {
+    return bench_zbatch(nb)*bench_zgeqrt_flops(nb, ib);
+}
+
+static int bench_zgelqt_call(void *data) {
+    BENCH_DATA
+    return coreblas_zgelqt(nb, nb, ib, d->B, nb, d->T, ib, d->tau, d->work);
+}
+static bench_flops_t bench_zgelqt_flops(int nb, int ib) {
+    return bench_zflops(FMULS_GELQF(nb, nb), FADDS_GELQF(nb, nb));
+}
+
+static int bench_ztsqrt_call(void *data) {
+    BENCH_DATA
+    return coreblas_ztsqrt(nb, nb, ib, d->A, nb, d->B, nb, d->T, ib,
+                           d->tau, d->work);
+}
+
+static int bench_ztsqrt_rec_call(void *data) {
+    BENCH_DATA
+    return coreblas_ztsqrt_rec(nb, nb, ib, d->A, nb, d->B, nb, d->T, ib,
+                               d->tau, d->work);
+}
+
+static int bench_ztslqt_call(void *data) {
+    BENCH_DATA
+    return coreblas_ztslqt(nb, nb, ib, d->A, nb, d->B, nb, d->T, ib,
+                           d->tau, d->work);
+}
+
+static int bench_ztsqlt_call(void *data) {
+    BENCH_DATA
+    return coreblas_ztsqlt(nb, nb, ib, d->A, nb, d->B, nb, d->T, ib,
+                           d->tau, d->work);
+}
+
+static int bench_ztsrqt_call(void *data) {
+    BENCH_DATA
+    return coreblas_ztsrqt(nb, nb, ib, d->A, nb, d->B, nb, d->T, ib,
+                           d->tau, d->work);
+}
+static bench_flops_t bench_ztsqrt_flops(int nb, int ib) {
+    return bench_zflops(FMULS_TSQRT(nb, nb), FADDS_TSQRT(nb, nb));
+}
+
+static int bench_zttqrt_call(void *data) {
+    BENCH_DATA
+    return coreblas_zttqrt(nb, nb, ib, d->A, nb, d->B, nb, d->T, ib,
+                           d->tau, d->work);
+}
+
+static int bench_zttqrt_rec_call(void *data) {
+    BENCH_DATA
+    return coreblas_zttqrt_rec(nb, nb, ib, d->A, nb, d->B, nb, d->T, ib,
+                               d->tau, d->work);
+}
+
+static int bench_zttlqt_call(void *data) {
+    BENCH_DATA
+    return coreblas_zttlqt(nb, nb, ib, d->A, nb, d->B, nb, d->T, ib,
+                           d->tau, d->work);
+}
+static bench_flops_t bench_zttqrt_flops(int nb, int ib) {
+    return bench_zflops(FMULS_TTQRT(nb), FADDS_TTQRT(nb));
+}
+
+static int bench_zunmqr_call(void *data) {
+    BENCH_DATA
+    return coreblas_zunmqr(CoreBlasLeft, CoreBlas_ConjTrans, nb, nb, nb, ib,
+                           d->Vqr, nb, d->Tqr, ib, d->C, nb, d->work, nb);
+}
+
+static int bench_zunmlq_call(void *data) {
+    BENCH_DATA
+    return coreblas_zunmlq(CoreBlasLeft, CoreBlas_ConjTrans, nb, nb, nb, ib,
+                           d->Vlq, nb, d->Tlq, ib, d->C, nb, d->work, nb);
+}
+static bench_flops_t bench_zunmqr_flops(int nb, int ib) {
+    return bench_zflops(FMULS_UNMQR(nb, nb, nb), FADDS_UNMQR(nb, nb, nb));
+}
+
+static int bench_ztsmqr_call(void *data) {
+    BENCH_DATA
+    return coreblas_ztsmqr(CoreBlasLeft, CoreBlas_ConjTrans,
+                           nb, nb, nb, nb, nb, ib,
+                           d->B, nb, d->C, nb, d->Vts, nb, d->Tts, ib,
+                           d->work, ib);
+}
+
+static int bench_ztsmlq_call(void *data) {
+    BENCH_DATA
+    return coreblas_ztsmlq(CoreBlasLeft, CoreBlas_ConjTrans,
+                           nb, nb, nb, nb, nb, ib,
+                           d->B, nb, d->C, nb, d->Vtsl, nb, d->Ttsl, ib,
+                           d->work, ib);
+}
+
+static int bench_ztsmql_call(void *data) {
+    BENCH_DATA
+    return coreblas_ztsmql(CoreBlasLeft, CoreBlas_ConjTrans,
+                           nb, nb, nb, nb, nb, ib,
+                           d->B, nb, d->C, nb, d->Vtsb, nb, d->Ttsb, ib,
+                           d->work, ib);
+}
+
+static int bench_ztsmrq_call(void *data) {
+    BENCH_DATA
+    return coreblas_ztsmrq(CoreBlasLeft, CoreBlas_ConjTrans,
+                           nb, nb, nb, nb, nb, ib,
+                           d->B, nb, d->C, nb, d->Vtsr, nb, d->Ttsr, ib,
+                           d->work, ib);
+}
+static bench_flops_t bench_ztsmqr_flops(int nb, int ib) {
+    return bench_zflops(FMULS_TSMQR(nb, nb, nb), FADDS_TSMQR(nb, nb, nb));
+}
+
+static int bench_ztsmqr_batched_call(void *data) {
+    BENCH_DATA
+    return coreblas_ztsmqr_batched(CoreBlasLeft, CoreBlas_ConjTrans,
+                                   nb, nb, nb, nb, nb, ib,
+                                   d->Dbp, nb, d->Cbp, nb,
+                                   d->Vp, nb, d->Tp, ib,
+                                   &d->wbatch, d->batch);
+}
+static bench_flops_t bench_ztsmqr_batched_flops(int nb, int ib) {
+    return bench_zbatch(nb)*bench_ztsmqr_flops(nb, ib);
+}
+
+static int bench_ztsmqr_row_call(void *data) {
+    BENCH_DATA
+    return coreblas_ztsmqr_row(CoreBlasLeft, CoreBlas_ConjTrans,
+                               nb, nb, nb, nb, nb, ib,
+                               d->Dbp, nb, d->Cbp, nb,
+                               d->Vts, nb, d->Tts, ib,
+                               &d->wbatch, d->batch);
+}
+
+static int bench_zttmqr_call(void *data) {
+    BENCH_DATA
+    return coreblas_zttmqr(CoreBlasLeft, CoreBlas_ConjTrans,
+                           nb, nb, nb, nb, nb, ib,
+                           d->B, nb, d->C, nb, d->Vtt, nb, d->Ttt, ib,
+                           d->work, ib);
+}
+
+static int bench_zttmlq_call(void *data) {
+    BENCH_DATA
+    return coreblas_zttmlq(CoreBlasLeft, CoreBlas_ConjTrans,
+                           nb, nb, nb, nb, nb, ib,
+                           d->B, nb, d->C, nb, d->Vttl, nb, d->Tttl, ib,
+                           d->work, ib);
+}
+static bench_flops_t bench_zttmqr_flops(int nb, int ib) {
+    return bench_zflops(FMULS_TTMQR(nb, nb), FADDS_TTMQR(nb, nb));
+}
+
+// One ib-wide block of the ts update, as issued by coreblas_ztsmqr.
+static int bench_zparfb_call(void *data) {
+    BENCH_DATA
+    return coreblas_zparfb(CoreBlasLeft, CoreBlas_ConjTrans,
+                           CoreBlasForward, CoreBlasColumnwise,
+                           ib, nb, nb, nb, ib, 0,
+                           d->B, nb, d->C, nb, d->Vts, nb, d->Tts, ib,
+                           d->work, ib);
+}
+static bench_flops_t bench_zparfb_flops(int nb, int ib) {
+    return bench_zflops(FMULS_TSMQR(nb, nb, ib), FADDS_TSMQR(nb, nb, ib));
+}
+
+static int bench_zpamm_call(void *data) {
+    BENCH_DATA
+    return coreblas_zpamm(CoreBlasW, CoreBlasLeft, CoreBlasColumnwise,
+                          ib, nb, nb, 0,
+                          d->B, nb, d->C, nb, d->Vts, nb, d->work, ib);
+}
+static bench_flops_t bench_zpamm_flops(int nb, int ib) {
+    return bench_zflops(FMULS_GEMM(ib, nb, nb), FADDS_GEMM(ib, nb, nb));
+}
+
+static int bench_zpemv_call(void *data) {
+    BENCH_DATA
+    return coreblas_zpemv(CoreBlasConjTrans, CoreBlasColumnwise,
+                          nb, nb, 0, zone, d->Vts, nb, d->B, 1,
+                          zone, d->C, 1, d->work);
+}
+static bench_flops_t bench_zpemv_flops(int nb, int ib) {
+    return bench_zflops((double)nb*nb, (double)nb*nb);
+}
+
+static int bench_zlarfb_gemm_call(void *data) {
+    BENCH_DATA
+    return coreblas_zlarfb_gemm(CoreBlasLeft, CoreBlas_ConjTrans,
+                                CoreBlasForward, CoreBlasColumnwise,
+                                nb, nb, ib, d->Vqrx, nb, d->Tqr, ib,
+                                d->C, nb, d->work, nb);
+}
+
+// The other storev/direct cases; backward T is lower triangular and taken
+// from B0, which is not a T factor of V but is valid for the check.
+static int bench_zlarfb_gemm_rowfwd_call(void *data) {
+    BENCH_DATA
+    return coreblas_zlarfb_gemm(CoreBlasRight, CoreBlasNoTrans,
+                                CoreBlasForward, CoreBlasRowwise,
+                                nb, nb, ib, d->Vlqx, nb, d->Tlq, ib,
+                                d->C, nb, d->work, nb);
+}
+
+static int bench_zlarfb_gemm_colbwd_call(void *data) {
+    BENCH_DATA
+    return coreblas_zlarfb_gemm(CoreBlasLeft, CoreBlas_ConjTrans,
+                                CoreBlasBackward, CoreBlasColumnwise,
+                                nb, nb, ib, d->Vcbx, nb, d->B0, nb,
+                                d->C, nb, d->work, nb);
+}
+
+static int bench_zlarfb_gemm_rowbwd_call(void *data) {
+    BENCH_DATA
+    return coreblas_zlarfb_gemm(CoreBlasRight, CoreBlasNoTrans,
+                                CoreBlasBackward, CoreBlasRowwise,
+                                nb, nb, ib, d->Vrbx, nb, d->B0, nb,
+                                d->C, nb, d->work, nb);
+}
+static bench_flops_t bench_zlarfb_gemm_flops(int nb, int ib) {
+    return bench_zflops(FMULS_TSMQR(nb, nb, ib), FADDS_TSMQR(nb, nb, ib));
+}
+
+// T factor of all the reflectors of the geqrt factorization at once.
+static int bench_zlarft_call(void *data) {
+    BENCH_DATA
+    return coreblas_zlarft(CoreBlasColumnwise, nb, nb, d->Vqr, nb, d->tauqr,
+                           d->C, nb);
+}
+static bench_flops_t bench_zlarft_flops(int nb, int ib) {
+    return bench_zflops(FMULS_GEMM(nb, nb, nb)/6.0, FADDS_GEMM(nb, nb, nb)/6.0);
+}
+
+//==============================================================================
+// Two-sided and band reductions
+static int bench_zheswp_call(void *data) {
+    BENCH_DATA
+    coreblas_desc_t desc;
+    coreblas_desc_general_init(CoreBlasComplexDouble, d->A, nb, nb,
+                               nb, nb, 0, 0, nb, nb, &desc);
+    coreblas_barrier_t barrier;
+    coreblas_barrier_init(&barrier);
+    coreblas_zheswp(0, 1, CoreBlasLower, desc, 1, nb, d->ipiv, 1, &barrier);
+    return 0;
+}
+
+static int bench_zherfb_call(void *data) {
+    BENCH_DATA
+    return coreblas_zherfb(CoreBlasLower, nb, nb, ib, d->Vqr, nb, d->Tqr, ib,
+                           d->A, nb, d->work);
+}
+static bench_flops_t bench_zherfb_flops(int nb, int ib) {
+    return 2.0*bench_zunmqr_flops(nb, ib);
+}
+
+// B holds the conjugate transpose of the top tile.
+static int bench_ztsmqr_hetra1_call(void *data) {
+    BENCH_DATA
+    return coreblas_ztsmqr_hetra1(CoreBlasLeft, CoreBlas_ConjTrans,
+                                  nb, nb, nb, nb, nb, ib,
+                                  d->B, nb, d->C, nb, d->Vts, nb, d->Tts, ib,
+                                  d->work, ib);
+}
+
+// The diagonal tiles A and B and the off-diagonal tile C of a Hermitian
+// 2-by-2 block.
+static int bench_ztsmqr_corner_call(void *data) {
+    BENCH_DATA
+    return coreblas_ztsmqr_corner(nb, nb, nb, nb, nb, nb, nb, ib,
+                                  d->A, nb, d->C, nb, d->B, nb,
+                                  d->Vts, nb, d->Tts, ib, d->work);
+}
+static bench_flops_t bench_ztsmqr_corner_flops(int nb, int ib) {
+    return 4.0*bench_ztsmqr_flops(nb, ib);
+}
+
+// The first three tasks of the first sweep of the chase of the band,
+// each on the band as left by the previous one.
+static int bench_zgbtype1cb_call(void *data) {
+    BENCH_DATA
+    bench_zgbtype(d, 1, d->band[0], d->vband[0]);
+    return 0;
+}
+
+static int bench_zgbtype2cb_call(void *data) {
+    BENCH_DATA
+    bench_zgbtype(d, 2, d->band[1], d->vband[1]);
+    return 0;
+}
+
+static int bench_zgbtype3cb_call(void *data) {
+    BENCH_DATA
+    bench_zgbtype(d, 3, d->band[2], d->vband[2]);
+    return 0;
+}
+
+static int bench_zgbbrd_static_call(void *data) {
+    BENCH_DATA
+    coreblas_complex64_t *vband = d->vband[3];
+    return coreblas_zgbbrd_static(CoreBlasLower, nb, d->bw, 1,
+                                  d->band[3], d->ldband,
+                                  vband, &vband[2*nb], &vband[4*nb],
+                                  &vband[6*nb], 0, &d->wbatch, d->iwband);
+}
+
+/*******************************************************************************
+ *  Checks of the result of the last call, made on reset data.
+ **/
+#define BENCH_CHECK bench_zdata_t *d = (bench_zdata_t*)data; int nb = d->nb; \
+                    int ib = d->ib; (void)ib; \
+                    size_t tile = (size_t)nb*nb; (void)tile;
+
+//==============================================================================
+// Level 3 BLAS
+// Freivalds' check against an unblocked product with a random vector, which
+// does not rely on the BLAS gemm the kernel calls.
+static bench_resid_t bench_zgemm_check(void *data) {
+    BENCH_CHECK
+    coreblas_complex64_t *x = bench_zmalloc(3*(size_t)nb);
+    coreblas_complex64_t *y = &x[nb];
+    coreblas_complex64_t *z = &x[2*nb];
+    unsigned long long seed = 7;
+    bench_zfill(nb, 1, x, nb, &seed);
+    double err = 0.0;
+    double nrm = 0.0;
+    for (int i = 0; i < nb; i++) {
+        y[i] = 0.0;
+        for (int l = 0; l < nb; l++)
+            y[i] += d->B0[i + nb*l]*x[l];
+    }
+    for (int i = 0; i < nb; i++) {
+        coreblas_complex64_t r = 0.0;
+        z[i] = 0.0;
+        for (int l = 0; l < nb; l++) {
+            r += d->C0[i + nb*l]*x[l] - d->A0[i + nb*l]*y[l];
+            z[i] += d->C[i + nb*l]*x[l];
+        }
+        err += cabs(z[i] - r)*cabs(z[i] - r);
+        nrm += cabs(r)*cabs(r);
+    }
+    free(x);
+    return bench_zscaled(sqrt(err), sqrt(nrm), nb);
+}
+
+// R = C0 - op(A) B0, where A is the full matrix of the lower triangle of A0.
+static double bench_zsymm_ref_check(bench_zdata_t *d, int herm)
+{
+    int nb = d->nb;
+    size_t tile = (size_t)nb*nb;
+    coreblas_complex64_t *F = bench_zmalloc(2*tile);
+    coreblas_complex64_t *R = &F[tile];
+    bench_zfull(herm, nb, d->A0, nb, F, nb);
+    memcpy(R, d->C0, tile*sizeof(coreblas_complex64_t));
+    coreblas_zgemm(CoreBlasNoTrans, CoreBlasNoTrans, nb, nb, nb,
+                   zmone, F, nb, d->B0, nb, zone, R, nb);
+    double resid = bench_zresid(CoreBlasGeneral, nb, nb, d->C, nb, R, nb);
+    free(F);
+    return resid;
+}
+
+// R = A0 - X Y^T - Y X^T for rank 2 and A0 - X X^T for rank 1, with
+// ^T the transposition trans, compared on the lower triangle.
+static double bench_zrank_ref_check(bench_zdata_t *d, coreblas_enum_t trans,
+                                    int rank2)
+{
+    int nb = d->nb;
+    size_t tile = (size_t)nb*nb;
+    coreblas_complex64_t *R = bench_zmalloc(tile);
+    memcpy(R, d->A0, tile*sizeof(coreblas_complex64_t));
+    const coreblas_complex64_t *Y = rank2 ? d->C0 : d->B0;
+    coreblas_zgemm(CoreBlasNoTrans, trans, nb, nb, nb,
+                   zmone, d->B0, nb, Y, nb, zone, R, nb);
+    if (rank2) {
+        coreblas_zgemm(CoreBlasNoTrans, trans, nb, nb, nb,
+                       zmone, d->C0, nb, d->B0, nb, zone, R, nb);
+    }
+    double resid = bench_zresid(CoreBlasLower, nb, nb, d->A, nb, R, nb);
+    free(R);
+    return resid;
+}
+
+#ifdef COMPLEX
+static bench_resid_t bench_zhemm_check(void *data) {
+    return bench_zsymm_ref_check((bench_zdata_t*)data, 1);
+}
+
+static bench_resid_t bench_zherk_check(void *data) {
+    return bench_zrank_ref_check((bench_zdata_t*)data, CoreBlasConjTrans, 0);
+}
+
+static bench_resid_t bench_zher2k_check(void *data) {
+    return bench_zrank_ref_check((bench_zdata_t*)data, CoreBlasConjTrans, 1);
+}
+#endif
+
+static bench_resid_t bench_zsymm_check(void *data) {
+    return bench_zsymm_ref_check((bench_zdata_t*)data, 0);
+}
+
+static bench_resid_t bench_zsyrk_check(void *data) {
+    return bench_zrank_ref_check((bench_zdata_t*)data, CoreBlasTrans, 0);
+}
+
+static bench_resid_t bench_zsyr2k_check(void *data) {
+    return bench_zrank_ref_check((bench_zdata_t*)data, CoreBlasTrans, 1);
+}
+
+static bench_resid_t bench_ztrmm_check(void *data) {
+    BENCH_CHECK
+    coreblas_complex64_t *L = bench_zmalloc(2*tile);
+    coreblas_complex64_t *R = &L[tile];
+    bench_ztri(CoreBlasLower, nb, d->A0, nb, L, nb);
+    coreblas_zgemm(CoreBlasNoTrans, CoreBlasNoTrans, nb, nb, nb,
+                   zone, L, nb, d->B0, nb, 0.0, R, nb);
+    double resid = bench_zresid(CoreBlasGeneral, nb, nb, d->B, nb, R, nb);
+    free(L);
+    return resid;
+}
+
+// The residual L B - B0 of the solution.
+static bench_resid_t bench_ztrsm_check(void *data) {
+    BENCH_CHECK
+    coreblas_complex64_t *L = bench_zmalloc(2*tile);
+    coreblas_complex64_t *X = &L[tile];
+    bench_ztri(CoreBlasLower, nb, d->A0, nb, L, nb);
+    coreblas_zgemm(CoreBlasNoTrans, CoreBlasNoTrans, nb, nb, nb,
+                   zone, L, nb, d->B, nb, 0.0, X, nb);
+    double resid = bench_zresid(CoreBlasGeneral, nb, nb, X, nb, d->B0, nb);
+    free(L);
+    return resid;
+}
+
+//==============================================================================
+// Auxiliary
+static bench_resid_t bench_zgeadd_check(void *data) {
+    BENCH_CHECK
+    coreblas_complex64_t *R = bench_zmalloc(tile);
+    for (size_t i = 0; i < tile; i++)
+        R[i] = d->C0[i] - d->B0[i];
+    double resid = bench_zresid(CoreBlasGeneral, nb, nb, d->C, nb, R, nb);
+    free(R);
+    return resid;
+}
+
+// The strictly upper triangle is left as is.
+static bench_resid_t bench_ztradd_check(void *data) {
+    BENCH_CHECK
+    coreblas_complex64_t *R = bench_zmalloc(tile);
+    for (int j = 0; j < nb; j++)
+        for (int i = 0; i < nb; i++)
+            R[i + nb*j] = d->C0[i + nb*j] - (i >= j ? d->B0[i + nb*j] : 0.0);
+    double resid = bench_zresid(CoreBlasGeneral, nb, nb, d->C, nb, R, nb);
+    free(R);
+    return resid;
+}
+
+// The copies of B0 into C.
+static bench_resid_t bench_zlacpy_check(void *data) {
+    BENCH_CHECK
+    return bench_zresid(CoreBlasGeneral, nb, nb, d->C, nb, d->B0, nb);
+}
+
+static bench_resid_t bench_zlaset_check(void *data) {
+    BENCH_CHECK
+    coreblas_complex64_t *R = bench_zmalloc(tile);
+    for (int j = 0; j < nb; j++)
+        for (int i = 0; i < nb; i++)
+            R[i + nb*j] = i == j ? 1.0 : 0.0;
+    double resid = bench_zresid(CoreBlasGeneral, nb, nb, d->C, nb, R, nb);
+    free(R);
+    return resid;
+}
+
+static bench_resid_t bench_zlascl_check(void *data) {
+    BENCH_CHECK
+    coreblas_complex64_t *R = bench_zmalloc(tile);
+    for (size_t i = 0; i < tile; i++)
+        R[i] = 1.5*d->C0[i];
+    double resid = bench_zresid(CoreBlasGeneral, nb, nb, d->C, nb, R, nb);
+    free(R);
+    return resid;
+}
+
+// Sums of the moduli of the columns (sum = 0) or rows (sum = 1) of the
+// uplo part of A, with the moduli of the mirrored entries for herm.
+static void bench_zabs_sums(int sum, coreblas_enum_t uplo, int herm, int nb,
+                            const coreblas_complex64_t *A, double *s)
+{
+    for (int i = 0; i < nb; i++)
+        s[i] = 0.0;
+    for (int j = 0; j < nb; j++) {
+        for (int i = 0; i < nb; i++) {
+            int in = uplo == CoreBlasGeneral ||
+                     (uplo == CoreBlasLower ? i >= j : i <= j);
+            if (in) {
+                double a = cabs(A[i + nb*j]);
+                s[sum ? i : j] += a;
+                if (herm && i != j)
+                    s[sum ? j : i] += a;
+            }
+        }
+    }
+}
+
+// Scaled error of the n values x against the reference r.
+static double bench_zvalues(int n, const double *x, const double *r, int nb)
+{
+    double err = 0.0;
+    double nrm = 0.0;
+    for (int i = 0; i < n; i++) {
+        err = fmax(err, fabs(x[i] - r[i]));
+        nrm = fmax(nrm, fabs(r[i]));
+    }
+    return bench_zscaled(err, nrm, nb);
+}
+
+static double bench_zsums_check(bench_zdata_t *d, int sum,
+                                coreblas_enum_t uplo, int herm,
+                                const coreblas_complex64_t *A,
+                                const double *x, int max)
+{
+    int nb = d->nb;
+    double *s = (double*)bench_zmalloc(nb);
+    bench_zabs_sums(sum, uplo, herm, nb, A, s);
+    double r = 0.0;
+    for (int i = 0; i < nb; i++)
+        r = fmax(r, s[i]);
+    double resid = max ? bench_zvalues(1, x, &r, nb)
+                       : bench_zvalues(nb, x, s, nb);
+    free(s);
+    return resid;
+}
+
+static bench_resid_t bench_zlange_one_check(void *data) {
+    bench_zdata_t *d = (bench_zdata_t*)data;
+    return bench_zsums_check(d, 0, CoreBlasGeneral, 0, d->B0, d->value, 1);
+}
+
+static bench_resid_t bench_zlange_inf_check(void *data) {
+    bench_zdata_t *d = (bench_zdata_t*)data;
+    return bench_zsums_check(d, 1, CoreBlasGeneral, 0, d->B0, d->value, 1);
+}
+
+static bench_resid_t bench_zlange_fro_check(void *data) {
+    BENCH_CHECK
+    double s = 0.0;
+    for (size_t i = 0; i < tile; i++)
+        s += cabs(d->B0[i])*cabs(d->B0[i]);
+    double r = sqrt(s);
+    return bench_zvalues(1, d->value, &r, nb);
+}
+
+static bench_resid_t bench_zlange_max_check(void *data) {
+    BENCH_CHECK
+    double r = 0.0;
+    for (size_t i = 0; i < tile; i++)
+        r = fmax(r, cabs(d->B0[i]));
+    return bench_zvalues(1, d->value, &r, nb);
+}
+
+static bench_resid_t bench_zlange_aux_one_check(void *data) {
+    bench_zdata_t *d = (bench_zdata_t*)data;
+    return bench_zsums_check(d, 0, CoreBlasGeneral, 0, d->B0, d->dwork, 0);
+}
+
+static bench_resid_t bench_zlange_aux_inf_check(void *data) {
+    bench_zdata_t *d = (bench_zdata_t*)data;
+    return bench_zsums_check(d, 1, CoreBlasGeneral, 0, d->B0, d->dwork, 0);
+}
+
+static bench_resid_t bench_zlantr_aux_inf_check(void *data) {
+    bench_zdata_t *d = (bench_zdata_t*)data;
+    return bench_zsums_check(d, 1, CoreBlasUpper, 0, d->B0, d->dwork, 0);
+}
+
+// Column sums of the Hermitian (or symmetric) matrix of the lower triangle
+// of A0.
+static bench_resid_t bench_zlansy_aux_check(void *data) {
+    bench_zdata_t *d = (bench_zdata_t*)data;
+    return bench_zsums_check(d, 0, CoreBlasLower, 1, d->A0, d->dwork, 0);
+}
+
+static bench_resid_t bench_zlansy_one_check(void *data) {
+    bench_zdata_t *d = (bench_zdata_t*)data;
+    return bench_zsums_check(d, 0, CoreBlasLower, 1, d->A0, d->value, 1);
+}
+
+static bench_resid_t bench_zlantr_one_check(void *data) {
+    bench_zdata_t *d = (bench_zdata_t*)data;
+    return bench_zsums_check(d, 0, CoreBlasLower, 0, d->B0, d->value, 1);
+}
+
+// Scaled sum of squares (value[0], value[1]) of the uplo part of A,
+// with the mirrored entries for herm.
+static double bench_zssq_check(bench_zdata_t *d, coreblas_enum_t uplo,
+                               int herm, const coreblas_complex64_t *A)
+{
+    int nb = d->nb;
+    double s = 0.0;
+    for (int j = 0; j < nb; j++) {
+        for (int i = 0; i < nb; i++) {
+            int in = uplo == CoreBlasGeneral ||
+                     (uplo == CoreBlasLower ? i >= j : i <= j);
+            if (in) {
+                double a = cabs(A[i + nb*j]);
+                s += (herm && i != j ? 2.0 : 1.0)*a*a;
+            }
+        }
+    }
+    double x = d->value[0]*d->value[0]*d->value[1];
+    return bench_zvalues(1, &x, &s, nb);
+}
+
+#ifdef COMPLEX
+static bench_resid_t bench_zlanhe_one_check(void *data) {
+    return bench_zlansy_one_check(data);
+}
+
+static bench_resid_t bench_zlanhe_aux_check(void *data) {
+    return bench_zlansy_aux_check(data);
+}
+
+static bench_resid_t bench_zhessq_check(void *data) {
+    bench_zdata_t *d = (bench_zdata_t*)data;
+    return bench_zssq_check(d, CoreBlasLower, 1, d->A0);
+}
+#endif
+
+static bench_resid_t bench_zgessq_check(void *data) {
+    bench_zdata_t *d = (bench_zdata_t*)data;
+    return bench_zssq_check(d, CoreBlasGeneral, 0, d->B0);
+}
+
+static bench_resid_t bench_zsyssq_check(void *data) {
+    bench_zdata_t *d = (bench_zdata_t*)data;
+    return bench_zssq_check(d, CoreBlasLower, 1, d->A0);
+}
+
+static bench_resid_t bench_ztrssq_check(void *data) {
+    bench_zdata_t *d = (bench_zdata_t*)data;
+    return bench_zssq_check(d, CoreBlasLower, 0, d->B0);
+}
+
+// The sum of the terms scale^2 sumsq, relative to the sum of their moduli,
+// as the partial results read from B0 may be negative.
+static bench_resid_t bench_zreduce_ssq_check(void *data) {
+    BENCH_CHECK
+    const double *scale = (const double*)d->B0;
+    int n = nb*nb/2;
+    double s = 0.0;
+    double a = 0.0;
+    for (int i = 0; i < n; i++) {
+        s += scale[i]*scale[i]*scale[n+i];
+        a += fabs(scale[i]*scale[i]*scale[n+i]);
+    }
+    double x = d->value[0]*d->value[0]*d->value[1];
+
+    // An infinite scale factor gives an infinite norm and not a NaN, also
+    // when two of them are merged by the tree.
+    const double iscale[3] = {1.0, INFINITY, 2.0};
+    const double isumsq[3] = {1.0, 1.0, 3.0};
+    double tscale[100], tsumsq[100];
+    for (int i = 0; i < 100; i++) {
+        tscale[i] = 1.0;
+        tsumsq[i] = 1.0;
+    }
+    tscale[0] = tscale[99] = INFINITY;
+    double iscl, isum, inorm, tscl, tsum;
+    coreblas_zreduce_ssq(3, iscale, isumsq, &iscl, &isum);
+    coreblas_zgessq_aux(3, iscale, isumsq, &inorm);
+    coreblas_zreduce_ssq(100, tscale, tsumsq, &tscl, &tsum);
+    if (!(isinf(iscl) && isum == 1.0 && isinf(inorm) &&
+          isinf(tscl) && tsum == 1.0))
+        return INFINITY;
+
+    return bench_zscaled(fabs(x - s), a, nb);
+}
+
+// The largest of the column sums of the nb-by-nb partial sums read from B0.
+static bench_resid_t bench_zreduce_one_check(void *data) {
+    BENCH_CHECK
+    const double *W = (const double*)d->B0;
+    double r = -INFINITY;
+    for (int j = 0; j < nb; j++) {
+        double s = 0.0;
+        for (int i = 0; i < nb; i++)
+            s += W[i + nb*j];
+        r = fmax(r, s);
+    }
+    return bench_zvalues(1, d->value, &r, nb);
+}
+
+//==============================================================================
+// Cholesky and triangular
+// L L^H = A0 on the lower triangle.
+static bench_resid_t bench_zpotrf_check(void *data) {
+    BENCH_CHECK
+    coreblas_complex64_t *L = bench_zmalloc(2*tile);
+    coreblas_complex64_t *X = &L[tile];
+    bench_ztri(CoreBlasLower, nb, d->A, nb, L, nb);
+    coreblas_zgemm(CoreBlasNoTrans, CoreBlas_ConjTrans, nb, nb, nb,
+                   zone, L, nb, L, nb, 0.0, X, nb);
+    double resid = bench_zresid(CoreBlasLower, nb, nb, X, nb, d->A0, nb);
+    free(L);
+    return resid;
+}
+
+// L0 inv(L0) = I.
+static bench_resid_t bench_ztrtri_check(void *data) {
+    BENCH_CHECK
+    coreblas_complex64_t *L = bench_zmalloc(4*tile);
+    coreblas_complex64_t *Y = &L[tile];
+    coreblas_complex64_t *X = &L[2*tile];
+    coreblas_complex64_t *E = &L[3*tile];
+    bench_ztri(CoreBlasLower, nb, d->A0, nb, L, nb);
+    bench_ztri(CoreBlasLower, nb, d->A, nb, Y, nb);
+    coreblas_zgemm(CoreBlasNoTrans, CoreBlasNoTrans, nb, nb, nb,
+                   zone, L, nb, Y, nb, 0.0, X, nb);
+    for (int j = 0; j < nb; j++)
+        for (int i = 0; i < nb; i++)
+            E[i + nb*j] = i == j ? 1.0 : 0.0;
+    double resid = bench_zresid(CoreBlasGeneral, nb, nb, X, nb, E, nb);
+    free(L);
+    return resid;
+}
+
+// L0^H L0 on the lower triangle.
+static bench_resid_t bench_zlauum_check(void *data) {
+    BENCH_CHECK
+    coreblas_complex64_t *L = bench_zmalloc(2*tile);
+    coreblas_complex64_t *R = &L[tile];
+    bench_ztri(CoreBlasLower, nb, d->A0, nb, L, nb);
+    coreblas_zgemm(CoreBlas_ConjTrans, CoreBlasNoTrans, nb, nb, nb,
+                   zone, L, nb, L, nb, 0.0, R, nb);
+    double resid = bench_zresid(CoreBlasLower, nb, nb, d->A, nb, R, nb);
+    free(L);
+    return resid;
+}
+
+// L A L^H = A0 on the lower triangle, where A is Hermitian.
+static bench_resid_t bench_zhegst_check(void *data) {
+    BENCH_CHECK
+    coreblas_complex64_t *L = bench_zmalloc(3*tile);
+    coreblas_complex64_t *F = &L[tile];
+    coreblas_complex64_t *X = &L[2*tile];
+    bench_ztri(CoreBlasLower, nb, d->L, nb, L, nb);
+    bench_zfull(1, nb, d->A, nb, F, nb);
+    coreblas_zgemm(CoreBlasNoTrans, CoreBlasNoTrans, nb, nb, nb,
+                   zone, L, nb, F, nb, 0.0, X, nb);
+    coreblas_zgemm(CoreBlasNoTrans, CoreBlas_ConjTrans, nb, nb, nb,
+                   zone, X, nb, L, nb, 0.0, F, nb);
+    double resid = bench_zresid(CoreBlasLower, nb, nb, F, nb, d->A0, nb);
+    free(L);
+    return resid;
+}
+
+//==============================================================================
+// LU
+// L U = P B0.
+static bench_resid_t bench_zgetrf_check(void *data) {
+    BENCH_CHECK
+    coreblas_complex64_t *L = bench_zmalloc(4*tile);
+    coreblas_complex64_t *U = &L[tile];
+    coreblas_complex64_t *X = &L[2*tile];
+    coreblas_complex64_t *R = &L[3*tile];
+    bench_ztri(CoreBlasLower, nb, d->B, nb, L, nb);
+    bench_ztri(CoreBlasUpper, nb, d->B, nb, U, nb);
+    for (int i = 0; i < nb; i++)
+        L[i + nb*i] = 1.0;
+    coreblas_zgemm(CoreBlasNoTrans, CoreBlasNoTrans, nb, nb, nb,
+                   zone, L, nb, U, nb, 0.0, X, nb);
+    memcpy(R, d->B0, tile*sizeof(coreblas_complex64_t));
+    bench_zpivot(nb, d->ipiv, R, nb);
+    double resid = bench_zresid(CoreBlasGeneral, nb, nb, X, nb, R, nb);
+    free(L);
+    return resid;
+}
+
+static bench_resid_t bench_zgetrf_calu_check(void *data) {
+    return bench_zgetrf_check(data);
+}
+
+// The first entry of B0 of largest |re| + |im| in column major order.
+static bench_resid_t bench_izamax_tile_check(void *data) {
+    BENCH_CHECK
+    double r = -1.0;
+    for (size_t i = 0; i < tile; i++) {
+        double a = fabs(creal(d->B0[i])) + fabs(cimag(d->B0[i]));
+        if (a > r)
+            r = a;
+    }
+    return d->value[0] == r ? 0.0 : INFINITY;
+}
+
+static bench_resid_t bench_zgeswp_check(void *data) {
+    BENCH_CHECK
+    coreblas_complex64_t *R = bench_zmalloc(tile);
+    memcpy(R, d->C0, tile*sizeof(coreblas_complex64_t));
+    bench_zpivot(nb, d->ipiv, R, nb);
+    double resid = bench_zresid(CoreBlasGeneral, nb, nb, d->C, nb, R, nb);
+    free(R);
+    return resid;
+}
+
+static bench_resid_t bench_zgeswp_blocked_check(void *data) {
+    return bench_zgeswp_check(data);
+}
+
+//==============================================================================
+// QR and LQ
+// Q R = B0, with R the upper triangle of B.
+static bench_resid_t bench_zgeqrt_check(void *data) {
+    BENCH_CHECK
+    coreblas_complex64_t *R = bench_zmalloc(tile);
+    bench_ztri(CoreBlasUpper, nb, d->B, nb, R, nb);
+    bench_zunm_ref(CoreBlasLeft, CoreBlasNoTrans, CoreBlasColumnwise,
+                   nb, nb, nb, ib, d->B, nb, d->T, ib, R, nb);
+    double resid = bench_zresid(CoreBlasGeneral, nb, nb, R, nb, d->B0, nb);
+    free(R);
+    return resid;
+}
+
+// L Q = B0, with L the lower triangle of B.
+static bench_resid_t bench_zgelqt_check(void *data) {
+    BENCH_CHECK
+    coreblas_complex64_t *L = bench_zmalloc(tile);
+    bench_ztri(CoreBlasLower, nb, d->B, nb, L, nb);
+    bench_zunm_ref(CoreBlasRight, CoreBlasNoTrans, CoreBlasRowwise,
+                   nb, nb, nb, ib, d->B, nb, d->T, ib, L, nb);
+    double resid = bench_zresid(CoreBlasGeneral, nb, nb, L, nb, d->B0, nb);
+    free(L);
+    return resid;
+}
+
+// Rebuilds the pair (A0, B0) factored into the triangle uplo of A and the
+// reflectors in B, and compares it on the triangle of A0 and on B0, or its
+// triangle uplo for the tt kernels.
+static double bench_zts_fact_check(bench_zdata_t *d, coreblas_enum_t side,
+                                   coreblas_enum_t direct,
+                                   coreblas_enum_t storev,
+                                   coreblas_enum_t uplo, int tri)
+{
+    int nb = d->nb;
+    size_t tile = (size_t)nb*nb;
+    coreblas_complex64_t *X1 = bench_zmalloc(2*tile);
+    coreblas_complex64_t *X2 = &X1[tile];
+    bench_ztri(uplo, nb, d->A, nb, X1, nb);
+    memset(X2, 0, tile*sizeof(coreblas_complex64_t));
+    bench_zts_ref(side, CoreBlasNoTrans, direct, storev, tri,
+                  nb, nb, X1, nb, nb, nb, X2, nb, nb, d->ib,
+                  d->B, nb, d->T, d->ib);
+    double resid1 = bench_zresid(uplo, nb, nb, X1, nb, d->A0, nb);
+    double resid2 = bench_zresid(tri ? uplo : CoreBlasGeneral, nb, nb,
+                                 X2, nb, d->B0, nb);
+    free(X1);
+    return fmax(resid1, resid2);
+}
+
+static bench_resid_t bench_ztsqrt_check(void *data) {
+    return bench_zts_fact_check((bench_zdata_t*)data, CoreBlasLeft,
+                                CoreBlasForward, CoreBlasColumnwise,
+                                CoreBlasUpper, 0);
+}
+
+static bench_resid_t bench_ztsqrt_rec_check(void *data) {
+    return bench_ztsqrt_check(data);
+}
+
+static bench_resid_t bench_ztslqt_check(void *data) {
+    return bench_zts_fact_check((bench_zdata_t*)data, CoreBlasRight,
+                                CoreBlasForward, CoreBlasRowwise,
+                                CoreBlasLower, 0);
+}
+
+static bench_resid_t bench_ztsqlt_check(void *data) {
+    return bench_zts_fact_check((bench_zdata_t*)data, CoreBlasLeft,
+                                CoreBlasBackward, CoreBlasColumnwise,
+                                CoreBlasLower, 0);
+}
+
+static bench_resid_t bench_ztsrqt_check(void *data) {
+    return bench_zts_fact_check((bench_zdata_t*)data, CoreBlasRight,
+                                CoreBlasBackward, CoreBlasRowwise,
+                                CoreBlasUpper, 0);
+}
+
+static bench_resid_t bench_zttqrt_check(void *data) {
+    return bench_zts_fact_check((bench_zdata_t*)data, CoreBlasLeft,
+                                CoreBlasForward, CoreBlasColumnwise,
+                                CoreBlasUpper, 1);
+}
+
+static bench_resid_t bench_zttqrt_rec_check(void *data) {
+    return bench_zttqrt_check(data);
+}
+
+static bench_resid_t bench_zttlqt_check(void *data) {
+    return bench_zts_fact_check((bench_zdata_t*)data, CoreBlasRight,
+                                CoreBlasForward, CoreBlasRowwise,
+                                CoreBlasLower, 1);
+}
+
+// op(Q) C0, with k reflectors of the geqrt or gelqt factorization.
+static double bench_zunm_check(bench_zdata_t *d, coreblas_enum_t storev,
+                               int k, const coreblas_complex64_t *V,
+                               const coreblas_complex64_t *T)
+{
+    int nb = d->nb;
+    size_t tile = (size_t)nb*nb;
+    coreblas_complex64_t *R = bench_zmalloc(tile);
+    memcpy(R, d->C0, tile*sizeof(coreblas_complex64_t));
+    bench_zunm_ref(CoreBlasLeft, CoreBlas_ConjTrans, storev,
+                   nb, nb, k, d->ib, V, nb, T, d->ib, R, nb);
+    double resid = bench_zresid(CoreBlasGeneral, nb, nb, d->C, nb, R, nb);
+    free(R);
+    return resid;
+}
+
+static bench_resid_t bench_zunmqr_check(void *data) {
+    bench_zdata_t *d = (bench_zdata_t*)data;
+    return bench_zunm_check(d, CoreBlasColumnwise, d->nb, d->Vqr, d->Tqr);
+}
+
+static bench_resid_t bench_zunmlq_check(void *data) {
+    bench_zdata_t *d = (bench_zdata_t*)data;
+    return bench_zunm_check(d, CoreBlasRowwise, d->nb, d->Vlq, d->Tlq);
+}
+
+// op(Q) applied to the first m1 rows of B0 over C0, compared with B and C.
+static double bench_zts_update_check(bench_zdata_t *d, int m1, int k,
+                                     coreblas_enum_t direct,
+                                     coreblas_enum_t storev, int tri,
+                                     const coreblas_complex64_t *V,
+                                     const coreblas_complex64_t *T,
+                                     const coreblas_complex64_t *B,
+                                     const coreblas_complex64_t *C)
+{
+    int nb = d->nb;
+    size_t tile = (size_t)nb*nb;
+    coreblas_complex64_t *R1 = bench_zmalloc(2*tile);
+    coreblas_complex64_t *R2 = &R1[tile];
+    memcpy(R1, d->B0, tile*sizeof(coreblas_complex64_t));
+    memcpy(R2, d->C0, tile*sizeof(coreblas_complex64_t));
+    bench_zts_ref(CoreBlasLeft, CoreBlas_ConjTrans, direct, storev, tri,
+                  m1, nb, R1, nb, nb, nb, R2, nb, k, d->ib, V, nb, T, d->ib);
+    double resid = fmax(
+        bench_zresid(CoreBlasGeneral, nb, nb, B, nb, R1, nb),
+        bench_zresid(CoreBlasGeneral, nb, nb, C, nb, R2, nb));
+    free(R1);
+    return resid;
+}
+
+static bench_resid_t bench_ztsmqr_check(void *data) {
+    bench_zdata_t *d = (bench_zdata_t*)data;
+    return bench_zts_update_check(d, d->nb, d->nb, CoreBlasForward,
+                                  CoreBlasColumnwise, 0, d->Vts, d->Tts,
+                                  d->B, d->C);
+}
+
+static bench_resid_t bench_ztsmlq_check(void *data) {
+    bench_zdata_t *d = (bench_zdata_t*)data;
+    return bench_zts_update_check(d, d->nb, d->nb, CoreBlasForward,
+                                  CoreBlasRowwise, 0, d->Vtsl, d->Ttsl,
+                                  d->B, d->C);
+}
+
+static bench_resid_t bench_ztsmql_check(void *data) {
+    bench_zdata_t *d = (bench_zdata_t*)data;
+    return bench_zts_update_check(d, d->nb, d->nb, CoreBlasBackward,
+                                  CoreBlasColumnwise, 0, d->Vtsb, d->Ttsb,
+                                  d->B, d->C);
+}
+
+static bench_resid_t bench_ztsmrq_check(void *data) {
+    bench_zdata_t *d = (bench_zdata_t*)data;
+    return bench_zts_update_check(d, d->nb, d->nb, CoreBlasBackward,
+                                  CoreBlasRowwise, 0, d->Vtsr, d->Ttsr,
+                                  d->B, d->C);
+}
+
+static bench_resid_t bench_zttmqr_check(void *data) {
+    bench_zdata_t *d = (bench_zdata_t*)data;
+    return bench_zts_update_check(d, d->nb, d->nb, CoreBlasForward,
+                                  CoreBlasColumnwise, 1, d->Vtt, d->Ttt,
+                                  d->B, d->C);
+}
+
+static bench_resid_t bench_zttmlq_check(void *data) {
+    bench_zdata_t *d = (bench_zdata_t*)data;
+    return bench_zts_update_check(d, d->nb, d->nb, CoreBlasForward,
+                                  CoreBlasRowwise, 1, d->Vttl, d->Tttl,
+                                  d->B, d->C);
+}
+
+static bench_resid_t bench_zparfb_check(void *data) {
+    bench_zdata_t *d = (bench_zdata_t*)data;
+    return bench_zts_update_check(d, d->ib, d->ib, CoreBlasForward,
+                                  CoreBlasColumnwise, 0, d->Vts, d->Tts,
+                                  d->B, d->C);
+}
+
+// W = B0(0:ib,:) + V(:,0:ib)^H C0.
+static bench_resid_t bench_zpamm_check(void *data) {
+    BENCH_CHECK
+    coreblas_complex64_t *R = bench_zmalloc((size_t)ib*nb);
+    coreblas_zlacpy(CoreBlasGeneral, CoreBlasNoTrans, ib, nb,
+                    d->B0, nb, R, ib);
+    coreblas_zgemm(CoreBlas_ConjTrans, CoreBlasNoTrans, ib, nb, nb,
+                   zone, d->Vts, nb, d->C0, nb, zone, R, ib);
+    double resid = bench_zresid(CoreBlasGeneral, ib, nb, d->work, ib, R, ib);
+    free(R);
+    return resid;
+}
+
+// The first column of C0 + V^H B0.
+static bench_resid_t bench_zpemv_check(void *data) {
+    BENCH_CHECK
+    coreblas_complex64_t *r = bench_zmalloc(nb);
+    for (int j = 0; j < nb; j++) {
+        r[j] = d->C0[j];
+        for (int i = 0; i < nb; i++)
+            r[j] += conj(d->Vts[i + nb*j])*d->B0[i];
+    }
+    double resid = bench_zresid(CoreBlasGeneral, nb, 1, d->C, nb, r, nb);
+    free(r);
+    return resid;
+}
+
+// Every side and trans for one storev/direct case, against LAPACKE larfb
+// with the same V and T.
+static double bench_zlarfb_gemm_cases(bench_zdata_t *d,
+                                      coreblas_enum_t direct,
+                                      coreblas_enum_t storev,
+                                      const coreblas_complex64_t *V,
+                                      const coreblas_complex64_t *T,
+                                      int ldt)
+{
+    int nb = d->nb;
+    int ib = d->ib;
+    size_t tile = (size_t)nb*nb;
+    coreblas_enum_t sides[] = { CoreBlasLeft, CoreBlasRight };
+    coreblas_enum_t transs[] = { CoreBlasNoTrans, CoreBlas_ConjTrans };
+    coreblas_complex64_t *R = bench_zmalloc(tile);
+    double resid = 0.0;
+    for (int s = 0; s < 2; s++) {
+        for (int t = 0; t < 2; t++) {
+            memcpy(d->C, d->C0, tile*sizeof(coreblas_complex64_t));
+            memcpy(R, d->C0, tile*sizeof(coreblas_complex64_t));
+            coreblas_zlarfb_gemm(sides[s], transs[t], direct, storev,
+                                 nb, nb, ib, V, nb, T, ldt,
+                                 d->C, nb, d->work, nb);
+            bench_zlarfb(sides[s], transs[t], direct, storev,
+                         nb, nb, ib, V, nb, T, ldt, R, nb);
+            double r = bench_zresid(CoreBlasGeneral, nb, nb, d->C, nb, R, nb);
+            resid = r > resid ? r : resid;
+        }
+    }
+    free(R);
+    return resid;
+}
+
+static bench_resid_t bench_zlarfb_gemm_check(void *data) {
+    bench_zdata_t *d = (bench_zdata_t*)data;
+    double resid = bench_zunm_check(d, CoreBlasColumnwise, d->ib,
+                                    d->Vqr, d->Tqr);
+    double rcases = bench_zlarfb_gemm_cases(d, CoreBlasForward,
+                                            CoreBlasColumnwise,
+                                            d->Vqrx, d->Tqr, d->ib);
+    return rcases > resid ? rcases : resid;
+}
+
+static bench_resid_t bench_zlarfb_gemm_rowfwd_check(void *data) {
+    bench_zdata_t *d = (bench_zdata_t*)data;
+    return bench_zlarfb_gemm_cases(d, CoreBlasForward, CoreBlasRowwise,
+                                   d->Vlqx, d->Tlq, d->ib);
+}
+
+static bench_resid_t bench_zlarfb_gemm_colbwd_check(void *data) {
+    bench_zdata_t *d = (bench_zdata_t*)data;
+    return bench_zlarfb_gemm_cases(d, CoreBlasBackward, CoreBlasColumnwise,
+                                   d->Vcbx, d->B0, d->nb);
+}
+
+static bench_resid_t bench_zlarfb_gemm_rowbwd_check(void *data) {
+    bench_zdata_t *d = (bench_zdata_t*)data;
+    return bench_zlarfb_gemm_cases(d, CoreBlasBackward, CoreBlasRowwise,
+                                   d->Vrbx, d->B0, d->nb);
+}
+
+static bench_resid_t bench_zlarft_check(void *data) {
+    BENCH_CHECK
+    coreblas_complex64_t *R = bench_zmalloc(tile);
+#ifdef COREBLAS_USE_64BIT_BLAS
+    LAPACKE_zlarft_work64_(LAPACK_COL_MAJOR, 'F', 'C', nb, nb,
+                           d->Vqr, nb, d->tauqr, R, nb);
+#else
+    LAPACKE_zlarft_work(LAPACK_COL_MAJOR, 'F', 'C', nb, nb,
+                        d->Vqr, nb, d->tauqr, R, nb);
+#endif
+    double resid = bench_zresid(CoreBlasUpper, nb, nb, d->C, nb, R, nb);
+    free(R);
+    return resid;
+}
+
+//==============================================================================
+// Batched kernels
+// The batch is not reset before the timed calls, which accumulate on it:
+// the checks reset it, repeat the call and compare every tile.
+static void bench_zreset_batch(bench_zdata_t *d)
+{
+    size_t tile = (size_t)d->nb*d->nb;
+    for (int i = 0; i < d->batch; i++) {
+        memcpy(d->Abp[i], d->B0, tile*sizeof(coreblas_complex64_t));
+        memcpy(d->Cbp[i], d->C0, tile*sizeof(coreblas_complex64_t));
+        memcpy(d->Dbp[i], d->B0, tile*sizeof(coreblas_complex64_t));
+    }
+}
+
+static bench_resid_t bench_zgemm_batched_check(void *data) {
+    BENCH_CHECK
+    bench_zreset_batch(d);
+    if (bench_zgemm_batched_call(data) != 0)
+        return INFINITY;
+    coreblas_complex64_t *R = bench_zmalloc(tile);
+    memcpy(R, d->C0, tile*sizeof(coreblas_complex64_t));
+    coreblas_zgemm(CoreBlasNoTrans, CoreBlasNoTrans, nb, nb, nb,
+                   zmone, d->B0, nb, d->B0, nb, zone, R, nb);
+    double resid = 0.0;
+    for (int i = 0; i < d->batch; i++) {
+        resid = fmax(resid, bench_zresid(CoreBlasGeneral, nb, nb,
+                                         d->Cbp[i], nb, R, nb));
+    }
+    free(R);
+    return resid;
+}
+
+static bench_resid_t bench_zgeqrt_batched_check(void *data) {
+    BENCH_CHECK
+    bench_zreset_batch(d);
+    if (bench_zgeqrt_batched_call(data) != 0)
+        return INFINITY;
+    coreblas_complex64_t *R = bench_zmalloc(tile);
+    double resid = 0.0;
+    for (int i = 0; i < d->batch; i++) {
+        bench_ztri(CoreBlasUpper, nb, d->Abp[i], nb, R, nb);
+        bench_zunm_ref(CoreBlasLeft, CoreBlasNoTrans, CoreBlasColumnwise,
+                       nb, nb, nb, ib, d->Abp[i], nb, d->Tbp[i], ib, R, nb);
+        resid = fmax(resid, bench_zresid(CoreBlasGeneral, nb, nb,
+                                         R, nb, d->B0, nb));
+    }
+    free(R);
+    return resid;
+}
+
+static bench_resid_t bench_ztsmqr_batched_check(void *data) {
+    BENCH_CHECK
+    bench_zreset_batch(d);
+    if (bench_ztsmqr_batched_call(data) != 0)
+        return INFINITY;
+    double resid = 0.0;
+    for (int i = 0; i < d->batch; i++) {
+        resid = fmax(resid, bench_zts_update_check(
+            d, nb, nb, CoreBlasForward, CoreBlasColumnwise, 0,
+            d->Vts, d->Tts, d->Dbp[i], d->Cbp[i]));
+    }
+    return resid;
+}
+
+static bench_resid_t bench_ztsmqr_row_check(void *data) {
+    BENCH_CHECK
+    bench_zreset_batch(d);
+    if (bench_ztsmqr_row_call(data) != 0)
+        return INFINITY;
+    double resid = 0.0;
+    for (int i = 0; i < d->batch; i++) {
+        resid = fmax(resid, bench_zts_update_check(
+            d, nb, nb, CoreBlasForward, CoreBlasColumnwise, 0,
+            d->Vts, d->Tts, d->Dbp[i], d->Cbp[i]));
+    }
+    return resid;
+}
+
+//==============================================================================
+// Two-sided and band reductions
+// P A0 P^T on the lower triangle.
+static bench_resid_t bench_zheswp_check(void *data) {
+    BENCH_CHECK
+    coreblas_complex64_t *R = bench_zmalloc(tile);
+    memcpy(R, d->A0, tile*sizeof(coreblas_complex64_t));
+    for (int i = 0; i < nb; i++) {
+        int p = d->ipiv[i]-1;
+        for (int j = 0; p != i && j < nb; j++) {
+            coreblas_complex64_t x = R[i + nb*j];
+            R[i + nb*j] = R[p + nb*j];
+            R[p + nb*j] = x;
+        }
+        for (int j = 0; p != i && j < nb; j++) {
+            coreblas_complex64_t x = R[j + nb*i];
+            R[j + nb*i] = R[j + nb*p];
+            R[j + nb*p] = x;
+        }
+    }
+    double resid = bench_zresid(CoreBlasLower, nb, nb, d->A, nb, R, nb);
+    free(R);
+    return resid;
+}
+
+// Q^H A0 Q on the lower triangle.
+static bench_resid_t bench_zherfb_check(void *data) {
+    BENCH_CHECK
+    coreblas_complex64_t *R = bench_zmalloc(tile);
+    memcpy(R, d->A0, tile*sizeof(coreblas_complex64_t));
+    bench_zunm_ref(CoreBlasLeft, CoreBlas_ConjTrans, CoreBlasColumnwise,
+                   nb, nb, nb, ib, d->Vqr, nb, d->Tqr, ib, R, nb);
+    bench_zunm_ref(CoreBlasRight, CoreBlasNoTrans, CoreBlasColumnwise,
+                   nb, nb, nb, ib, d->Vqr, nb, d->Tqr, ib, R, nb);
+    double resid = bench_zresid(CoreBlasLower, nb, nb, d->A, nb, R, nb);
+    free(R);
+    return resid;
+}
+
+// The tsmqr update of (B0^H, C0), with B compared with the conjugate
+// transpose of the top tile.
+static bench_resid_t bench_ztsmqr_hetra1_check(void *data) {
+    BENCH_CHECK
+    coreblas_complex64_t *R1 = bench_zmalloc(3*tile);
+    coreblas_complex64_t *R2 = &R1[tile];
+    coreblas_complex64_t *X1 = &R1[2*tile];
+    for (int j = 0; j < nb; j++) {
+        for (int i = 0; i < nb; i++) {
+            R1[i + nb*j] = conj(d->B0[j + nb*i]);
+            X1[i + nb*j] = conj(d->B[j + nb*i]);
+        }
+    }
+    memcpy(R2, d->C0, tile*sizeof(coreblas_complex64_t));
+    bench_zts_ref(CoreBlasLeft, CoreBlas_ConjTrans, CoreBlasForward,
+                  CoreBlasColumnwise, 0, nb, nb, R1, nb, nb, nb, R2, nb,
+                  nb, ib, d->Vts, nb, d->Tts, ib);
+    double resid = fmax(
+        bench_zresid(CoreBlasGeneral, nb, nb, X1, nb, R1, nb),
+        bench_zresid(CoreBlasGeneral, nb, nb, d->C, nb, R2, nb));
+    free(R1);
+    return resid;
+}
+
+// Q^H M Q, where M is the Hermitian matrix of the lower triangles of A0 and
+// B0 on the diagonal and C0 below.
+static bench_resid_t bench_ztsmqr_corner_check(void *data) {
+    BENCH_CHECK
+    int n2 = 2*nb;
+    coreblas_complex64_t *M = bench_zmalloc(4*tile);
+    coreblas_complex64_t *F = bench_zmalloc(tile);
+    bench_zfull(1, nb, d->A0, nb, F, nb);
+    coreblas_zlacpy(CoreBlasGeneral, CoreBlasNoTrans, nb, nb, F, nb, M, n2);
+    bench_zfull(1, nb, d->B0, nb, F, nb);
+    coreblas_zlacpy(CoreBlasGeneral, CoreBlasNoTrans, nb, nb,
+                    F, nb, &M[nb + n2*nb], n2);
+    for (int j = 0; j < nb; j++) {
+        for (int i = 0; i < nb; i++) {
+            M[(nb+i) + n2*j] = d->C0[i + nb*j];
+            M[j + n2*(nb+i)] = conj(d->C0[i + nb*j]);
+        }
+    }
+    bench_zts_ref(CoreBlasLeft, CoreBlas_ConjTrans, CoreBlasForward,
+                  CoreBlasColumnwise, 0, nb, n2, M, n2, nb, n2, &M[nb], n2,
+                  nb, ib, d->Vts, nb, d->Tts, ib);
+    bench_zts_ref(CoreBlasRight, CoreBlasNoTrans, CoreBlasForward,
+                  CoreBlasColumnwise, 0, n2, nb, M, n2, n2, nb, &M[n2*nb], n2,
+                  nb, ib, d->Vts, nb, d->Tts, ib);
+    double resid = fmax(fmax(
+        bench_zresid(CoreBlasLower, nb, nb, d->A, nb, M, n2),
+        bench_zresid(CoreBlasGeneral, nb, nb, d->C, nb, &M[nb], n2)),
+        bench_zresid(CoreBlasLower, nb, nb, d->B, nb, &M[nb + n2*nb], n2));
+    free(M);
+    free(F);
+    return resid;
+}
+
+// The chase is a unitary two-sided transformation of the band: it keeps the
+// Frobenius norms of the band and of its Gram matrix, and leaves the first
+// ncol columns and rows lower bidiagonal.
+static double bench_zband_check(bench_zdata_t *d,
+                                const coreblas_complex64_t *band, int ncol)
+{
+    int nb = d->nb;
+    coreblas_complex64_t *D = bench_zmalloc((size_t)nb*nb);
+    bench_zband_dense(d, band, D);
+    double off = 0.0;
+    for (int j = 0; j < nb; j++) {
+        for (int i = 0; i < nb; i++) {
+            if ((i < ncol || j < ncol) && i != j && i != j+1)
+                off += cabs(D[i + nb*j])*cabs(D[i + nb*j]);
+        }
+    }
+    free(D);
+    double fro, fro2;
+    bench_zband_norms(d, band, &fro, &fro2);
+    return fmax(fmax(
+        bench_zscaled(fabs(fro - d->band_fro), d->band_fro, nb),
+        bench_zscaled(fabs(fro2 - d->band_fro2), d->band_fro2, nb)),
+        bench_zscaled(sqrt(off), d->band_fro, nb));
+}
+
+// A task leaves a part of its update to the next ones: the first sweep is
+// completed from the task t on before the check.
+static double bench_zsweep_check(bench_zdata_t *d, int t)
+{
+    int ntask = coreblas_bulge_ntask(d->nb, d->bw, 0);
+    for (int s = t+1; s <= ntask; s++)
+        bench_zgbtype(d, s, d->band[t-1], d->vband[t-1]);
+    return bench_zband_check(d, d->band[t-1], 1);
+}
+
+static bench_resid_t bench_zgbtype1cb_check(void *data) {
+    return bench_zsweep_check((bench_zdata_t*)data, 1);
+}
+
+static bench_resid_t bench_zgbtype2cb_check(void *data) {
+    return bench_zsweep_check((bench_zdata_t*)data, 2);
+}
+
+static bench_resid_t bench_zgbtype3cb_check(void *data) {
+    return bench_zsweep_check((bench_zdata_t*)data, 3);
+}
+
+static bench_resid_t bench_zgbbrd_static_check(void *data) {
+    bench_zdata_t *d = (bench_zdata_t*)data;
+    return bench_zband_check(d, d->band[3], d->nb);
+}
+
+/******************************************************************************/
+static bench_flops_t bench_znone_flops(int nb, int ib)
+{
+    return 0.0;
+}
+
+#define BENCH_ROUTINE(name, flops, check) \
+    { #name, bench_##name##_call, flops, check }
+
+static const bench_routine_t bench_zroutines[] = {
+    // Level 3 BLAS
+    BENCH_ROUTINE(zgemm,   bench_zgemm_flops, bench_zgemm_check),
+    BENCH_ROUTINE(zgemm_batched, bench_zgemm_batched_flops,
+                  bench_zgemm_batched_check),
+#ifdef COMPLEX
+    BENCH_ROUTINE(zhemm,   bench_zsymm_flops, bench_zhemm_check),
+    BENCH_ROUTINE(zherk,   bench_zsyrk_flops, bench_zherk_check),
+    BENCH_ROUTINE(zher2k,  bench_zsyr2k_flops, bench_zher2k_check),
+#endif
+    BENCH_ROUTINE(zsymm,   bench_zsymm_flops, bench_zsymm_check),
+    BENCH_ROUTINE(zsyrk,   bench_zsyrk_flops, bench_zsyrk_check),
+    BENCH_ROUTINE(zsyr2k,  bench_zsyr2k_flops, bench_zsyr2k_check),
+    BENCH_ROUTINE(ztrmm,   bench_ztrmm_flops, bench_ztrmm_check),
+    BENCH_ROUTINE(ztrsm,   bench_ztrsm_flops, bench_ztrsm_check),
+
+    // Auxiliary
+    BENCH_ROUTINE(zgeadd,  bench_zgeadd_flops, bench_zgeadd_check),
+    BENCH_ROUTINE(ztradd,  bench_ztradd_flops, bench_ztradd_check),
+    BENCH_ROUTINE(zlacpy,  bench_znone_flops, bench_zlacpy_check),
+    BENCH_ROUTINE(zlacpy_lapack2tile_band, bench_znone_flops,
+                  bench_zlacpy_check),
+    BENCH_ROUTINE(zlacpy_tile2lapack_band, bench_znone_flops,
+                  bench_zlacpy_check),
+    BENCH_ROUTINE(zlaset,  bench_znone_flops, bench_zlaset_check),
+    BENCH_ROUTINE(zlascl,  bench_zlascl_flops, bench_zlascl_check),
+    BENCH_ROUTINE(zlange_one, bench_znorm_flops, bench_zlange_one_check),
+    BENCH_ROUTINE(zlange_inf, bench_znorm_flops, bench_zlange_inf_check),
+    BENCH_ROUTINE(zlange_fro, bench_znorm_flops, bench_zlange_fro_check),
+    BENCH_ROUTINE(zlange_max, bench_znorm_flops, bench_zlange_max_check),
+    BENCH_ROUTINE(zlange_aux_one, bench_znorm_flops,
+                  bench_zlange_aux_one_check),
+    BENCH_ROUTINE(zlange_aux_inf, bench_znorm_flops,
+                  bench_zlange_aux_inf_check),
+    BENCH_ROUTINE(zlantr_aux_inf, bench_znorm_flops,
+                  bench_zlantr_aux_inf_check),
+    BENCH_ROUTINE(zlansy_aux, bench_znorm_flops, bench_zlansy_aux_check),
+#ifdef COMPLEX
+    BENCH_ROUTINE(zlanhe_one, bench_znorm_flops, bench_zlanhe_one_check),
+    BENCH_ROUTINE(zlanhe_aux, bench_znorm_flops, bench_zlanhe_aux_check),
+    BENCH_ROUTINE(zhessq,  bench_znorm_flops, bench_zhessq_check),
+#endif
+    BENCH_ROUTINE(zlansy_one, bench_znorm_flops, bench_zlansy_one_check),
+    BENCH_ROUTINE(zlantr_one, bench_znorm_flops, bench_zlantr_one_check),
+    BENCH_ROUTINE(zgessq,  bench_znorm_flops, bench_zgessq_check),
+    BENCH_ROUTINE(zsyssq,  bench_znorm_flops, bench_zsyssq_check),
+    BENCH_ROUTINE(ztrssq,  bench_znorm_flops, bench_ztrssq_check),
+    BENCH_ROUTINE(zreduce_ssq, bench_znorm_flops, bench_zreduce_ssq_check),
+    BENCH_ROUTINE(zreduce_one, bench_znorm_flops, bench_zreduce_one_check),
+
+    // Cholesky and triangular
+    BENCH_ROUTINE(zpotrf,  bench_zpotrf_flops, bench_zpotrf_check),
+    BENCH_ROUTINE(ztrtri,  bench_ztrtri_flops, bench_ztrtri_check),
+    BENCH_ROUTINE(zlauum,  bench_zlauum_flops, bench_zlauum_check),
+    BENCH_ROUTINE(zhegst,  bench_zhegst_flops, bench_zhegst_check),
+
+    // LU
+    BENCH_ROUTINE(zgetrf,  bench_zgetrf_flops, bench_zgetrf_check),
+    BENCH_ROUTINE(zgetrf_calu, bench_zgetrf_flops, bench_zgetrf_calu_check),
+    BENCH_ROUTINE(izamax_tile, bench_znorm_flops, bench_izamax_tile_check),
+    BENCH_ROUTINE(zgeswp,  bench_znone_flops, bench_zgeswp_check),
+    BENCH_ROUTINE(zgeswp_blocked, bench_znone_flops,
+                  bench_zgeswp_blocked_check),
+
+    // QR and LQ
+    BENCH_ROUTINE(zgeqrt,  bench_zgeqrt_flops, bench_zgeqrt_check),
+    BENCH_ROUTINE(zgeqrt_batched, bench_zgeqrt_batched_flops,
+                  bench_zgeqrt_batched_check),
+    BENCH_ROUTINE(zgelqt,  bench_zgelqt_flops, bench_zgelqt_check),
+    BENCH_ROUTINE(ztsqrt,  bench_ztsqrt_flops, bench_ztsqrt_check),
+    BENCH_ROUTINE(ztsqrt_rec, bench_ztsqrt_flops, bench_ztsqrt_rec_check),
+    BENCH_ROUTINE(ztslqt,  bench_ztsqrt_flops, bench_ztslqt_check),
+    BENCH_ROUTINE(ztsqlt,  bench_ztsqrt_flops, bench_ztsqlt_check),
+    BENCH_ROUTINE(ztsrqt,  bench_ztsqrt_flops, bench_ztsrqt_check),
+    BENCH_ROUTINE(zttqrt,  bench_zttqrt_flops, bench_zttqrt_check),
+    BENCH_ROUTINE(zttqrt_rec, bench_zttqrt_flops, bench_zttqrt_rec_check),
+    BENCH_ROUTINE(zttlqt,  bench_zttqrt_flops, bench_zttlqt_check),
+    BENCH_ROUTINE(zunmqr,  bench_zunmqr_flops, bench_zunmqr_check),
+    BENCH_ROUTINE(zunmlq,  bench_zunmqr_flops, bench_zunmlq_check),
+    BENCH_ROUTINE(ztsmqr,  bench_ztsmqr_flops, bench_ztsmqr_check),
+    BENCH_ROUTINE(ztsmqr_batched, bench_ztsmqr_batched_flops,
+                  bench_ztsmqr_batched_check),
+    BENCH_ROUTINE(ztsmqr_row, bench_ztsmqr_batched_flops,
+                  bench_ztsmqr_row_check),
+    BENCH_ROUTINE(ztsmlq,  bench_ztsmqr_flops, bench_ztsmlq_check),
+    BENCH_ROUTINE(ztsmql,  bench_ztsmqr_flops, bench_ztsmql_check),
+    BENCH_ROUTINE(ztsmrq,  bench_ztsmqr_flops, bench_ztsmrq_check),
+    BENCH_ROUTINE(zttmqr,  bench_zttmqr_flops, bench_zttmqr_check),
+    BENCH_ROUTINE(zttmlq,  bench_zttmqr_flops, bench_zttmlq_check),
+    BENCH_ROUTINE(zparfb,  bench_zparfb_flops, bench_zparfb_check),
+    BENCH_ROUTINE(zpamm,   bench_zpamm_flops, bench_zpamm_check),
+    BENCH_ROUTINE(zpemv,   bench_zpemv_flops, bench_zpemv_check),
+    BENCH_ROUTINE(zlarfb_gemm, bench_zlarfb_gemm_flops,
+                  bench_zlarfb_gemm_check),
+    BENCH_ROUTINE(zlarfb_gemm_rowfwd, bench_zlarfb_gemm_flops,
+                  bench_zlarfb_gemm_rowfwd_check),
+    BENCH_ROUTINE(zlarfb_gemm_colbwd, bench_zlarfb_gemm_flops,
+                  bench_zlarfb_gemm_colbwd_check),
+    BENCH_ROUTINE(zlarfb_gemm_rowbwd, bench_zlarfb_gemm_flops,
+                  bench_zlarfb_gemm_rowbwd_check),
+    BENCH_ROUTINE(zlarft,  bench_zlarft_flops, bench_zlarft_check),
+
+    // Two-sided and band reductions
+    BENCH_ROUTINE(zheswp,  bench_znone_flops, bench_zheswp_check),
+    BENCH_ROUTINE(zherfb,  bench_zherfb_flops, bench_zherfb_check),
+    BENCH_ROUTINE(ztsmqr_hetra1, bench_ztsmqr_flops,
+                  bench_ztsmqr_hetra1_check),
+    BENCH_ROUTINE(ztsmqr_corner, bench_ztsmqr_corner_flops,
+                  bench_ztsmqr_corner_check),
+    BENCH_ROUTINE(zgbtype1cb, bench_znone_flops, bench_zgbtype1cb_check),
+    BENCH_ROUTINE(zgbtype2cb, bench_znone_flops, bench_zgbtype2cb_check),
+    BENCH_ROUTINE(zgbtype3cb, bench_znone_flops, bench_zgbtype3cb_check),
+    BENCH_ROUTINE(zgbbrd_static, bench_znone_flops,
+                  bench_zgbbrd_static_check),
+
+    { NULL, NULL, NULL, NULL }
+};
+
+/******************************************************************************/
+const bench_precision_t bench_z = {
+    bench_zroutines,
+    bench_zcreate,
+    bench_zreset,
+    bench_zdestroy,
+};
@@ -0,0 +1,194 @@
+/**
+ *
+ * @file
+ *
+ *  COREBLAS is a software package provided by:
+ *  University of Tennessee, US,
+ *  University of Manchester, UK.
+ *
+ * @precisions mixed zc -> ds
+ *
+ **/
+
+#include "bench.h"
+#include "flops.h"
+
+#include <coreblas.h>
+#include "core_lapack.h"
+
+#include <math.h>
+#include <stdlib.h>
+#include <string.h>
+
+#define COMPLEX
+
+/******************************************************************************/
+typedef struct {
+    int nb;
+    coreblas_complex64_t *A;
+    coreblas_complex32_t *As;
+    coreblas_complex64_t *B;     ///< right-hand sides of the residual
+    coreblas_complex64_t *C;     ///< residual
+    coreblas_complex64_t *R;     ///< reference residual
+    coreblas_complex64_t *work;
+} bench_zcdata_t;
+
+/******************************************************************************/
+static void *bench_zccreate(int nb, int ib)
+{
+    bench_zcdata_t *d = (bench_zcdata_t*)calloc(1, sizeof(bench_zcdata_t));
+    if (d == NULL)
+        return NULL;
+
+    d->nb = nb;
+    d->A  = (coreblas_complex64_t*)malloc(
+        (size_t)nb*nb*sizeof(coreblas_complex64_t));
+    d->As = (coreblas_complex32_t*)malloc(
+        (size_t)nb*nb*sizeof(coreblas_complex32_t));
+    d->B  = (coreblas_complex64_t*)malloc(
+        (size_t)nb*nb*sizeof(coreblas_complex64_t));
+    d->C  = (coreblas_complex64_t*)malloc(
+        (size_t)nb*nb*sizeof(coreblas_complex64_t));
+    d->R  = (coreblas_complex64_t*)malloc(
+        (size_t)nb*nb*sizeof(coreblas_complex64_t));
+    d->work = (coreblas_complex64_t*)malloc(
+        coreblas_zcgemm_lwork(nb, nb)*sizeof(coreblas_complex64_t));
+    if (d->A == NULL || d->As == NULL || d->B == NULL || d->C == NULL ||
+        d->R == NULL || d->work == NULL) {
+        bench_zc.destroy(d);
+        return NULL;
+    }
+    for (size_t i = 0; i < (size_t)nb*nb; i++) {
+        d->A[i]  = (double)(i % 1021)/1021.0 - 0.5;
+        d->As[i] = (float)d->A[i];
+        d->B[i]  = (double)(i % 509)/509.0 - 0.5;
+        d->C[i]  = 0.0;
+    }
+
+    // Reference residual -As*B, with As converted exactly to double.
+    for (size_t i = 0; i < (size_t)nb*nb; i++)
+        d->R[i] = d->As[i];
+    coreblas_zgemm(CoreBlasNoTrans, CoreBlasNoTrans, nb, nb, nb,
+                   -1.0, d->R, nb, d->B, nb, 0.0, d->C, nb);
+    memcpy(d->R, d->C, (size_t)nb*nb*sizeof(coreblas_complex64_t));
+    bench_zc.reset(d);
+    return d;
+}
+
+/******************************************************************************/
+static void bench_zcreset(void *data)
+{
+    bench_zcdata_t *d = (bench_zcdata_t*)data;
+    memset(d->C, 0, (size_t)d->nb*d->nb*sizeof(coreblas_complex64_t));
+}
+
+/******************************************************************************/
+static void bench_zcdestroy(void *data)
+{
+    bench_zcdata_t *d = (bench_zcdata_t*)data;
+    if (d == NULL)
+        return;
+
+    free(d->A);
+    free(d->As);
+    free(d->B);
+    free(d->C);
+    free(d->R);
+    free(d->work);
+    free(d);
+}
+
+/******************************************************************************/
+static int bench_zlag2c_call(void *data)
+{
+    bench_zcdata_t *d = (bench_zcdata_t*)data;
+    return coreblas_zlag2c(d->nb, d->nb, d->A, d->nb, d->As, d->nb);
+}
+
+/******************************************************************************/
+static int bench_clag2z_call(void *data)
+{
+    bench_zcdata_t *d = (bench_zcdata_t*)data;
+    coreblas_clag2z(d->nb, d->nb, d->As, d->nb, d->A, d->nb);
+    return 0;
+}
+
+/******************************************************************************/
+// Residual C = C - As*B with the tile As stored in single precision.
+static int bench_zcgemm_call(void *data)
+{
+    bench_zcdata_t *d = (bench_zcdata_t*)data;
+    return coreblas_zcgemm(CoreBlasNoTrans, CoreBlasNoTrans, d->nb, d->nb, d->nb,
+                           -1.0, d->As, d->nb, d->B, d->nb,
+                            1.0, d->C, d->nb, d->work);
+}
+
+/******************************************************************************/
+// The conversions are exact: to nearest from double, and back.
+static bench_resid_t bench_zlag2c_check(void *data)
+{
+    bench_zcdata_t *d = (bench_zcdata_t*)data;
+    for (size_t i = 0; i < (size_t)d->nb*d->nb; i++) {
+        if (d->As[i] != (coreblas_complex32_t)d->A[i])
+            return INFINITY;
+    }
+    return 0.0;
+}
+
+static bench_resid_t bench_clag2z_check(void *data)
+{
+    bench_zcdata_t *d = (bench_zcdata_t*)data;
+    for (size_t i = 0; i < (size_t)d->nb*d->nb; i++) {
+        if (d->A[i] != (coreblas_complex64_t)d->As[i])
+            return INFINITY;
+    }
+    return 0.0;
+}
+
+// The product is computed in double precision.
+static bench_resid_t bench_zcgemm_check(void *data)
+{
+    bench_zcdata_t *d = (bench_zcdata_t*)data;
+    double err = 0.0;
+    double nrm = 0.0;
+    for (size_t i = 0; i < (size_t)d->nb*d->nb; i++) {
+        double e = cabs(d->C[i] - d->R[i]);
+        double r = cabs(d->R[i]);
+        err += e*e;
+        nrm += r*r;
+    }
+    double eps = LAPACKE_dlamch_work('e');
+    return sqrt(err)/(nrm > 0.0 ? sqrt(nrm) : 1.0)/(d->nb*eps);
+}
+
+/******************************************************************************/
+static bench_flops_t bench_zcnone_flops(int nb, int ib)
+{
+    return 0.0;
+}
+
+static bench_flops_t bench_zcgemm_flops(int nb, int ib)
+{
+    bench_flops_t fmuls = FMULS_GEMM(nb, nb, nb);
+    bench_flops_t fadds = FADDS_GEMM(nb, nb, nb);
+#ifdef COMPLEX
+    return 6.0*fmuls + 2.0*fadds;
+#else
+    return fmuls + fadds;
+#endif
+}
+
+static const bench_routine_t bench_zcroutines[] = {
+    { "zlag2c", bench_zlag2c_call, bench_zcnone_flops, bench_zlag2c_check },
+    { "clag2z", bench_clag2z_call, bench_zcnone_flops, bench_clag2z_check },
+    { "zcgemm", bench_zcgemm_call, bench_zcgemm_flops, bench_zcgemm_check },
+    { NULL, NULL, NULL, NULL }
+};
+
+/******************************************************************************/
+const bench_precision_t bench_zc = {
+    bench_zcroutines,
+    bench_zccreate,
+    bench_zcreset,
+    bench_zcdestroy,
+};
@@ -0,0 +1,105 @@
+/**
+ *
+ * @file
+ *
+ *  COREBLAS is a software package provided by:
+ *  University of Tennessee, US,
+ *  University of Manchester, UK.
+ *
+ *  Floating-point operation counts of the kernels, split into
+ *  multiplications and additions.
+ *  The LAPACK routines follow LAPACK Working Note 41; the tile kernels
+ *  count the useful operations on the structured tiles they touch
+ *  (triangular A2 and V in the tt kernels, identity block of V in the
+ *  ts kernels), excluding the formation of T.
+ *
+ *  Real flops:    fmuls + fadds.
+ *  Complex flops: 6*fmuls + 2*fadds.
+ *
+ **/
+#ifndef COREBLAS_FLOPS_H
+#define COREBLAS_FLOPS_H
+
+/******************************************************************************/
+// Level 3 BLAS
+#define FMULS_GEMM(m_, n_, k_) ((double)(m_) * (double)(n_) * (double)(k_))
+#define FADDS_GEMM(m_, n_, k_) ((double)(m_) * (double)(n_) * (double)(k_))
+
+#define FMULS_SYMM(m_, n_) FMULS_GEMM((m_), (m_), (n_))
+#define FADDS_SYMM(m_, n_) FADDS_GEMM((m_), (m_), (n_))
+
+#define FMULS_SYRK(k_, n_) (0.5 * (double)(k_) * (double)(n_) * ((n_)+1))
+#define FADDS_SYRK(k_, n_) (0.5 * (double)(k_) * (double)(n_) * ((n_)+1))
+
+#define FMULS_SYR2K(k_, n_) ((double)(k_) * (double)(n_) * (double)(n_))
+#define FADDS_SYR2K(k_, n_) ((double)(k_) * (double)(n_) * (double)(n_) + (n_))
+
+#define FMULS_TRMM(m_, n_) (0.5 * (double)(n_) * (double)(m_) * ((m_)+1))
+#define FADDS_TRMM(m_, n_) (0.5 * (double)(n_) * (double)(m_) * ((m_)-1))
+
+#define FMULS_TRSM FMULS_TRMM
+#define FADDS_TRSM FADDS_TRMM
+
+/******************************************************************************/
+// LAPACK
+#define FMULS_POTRF(n_) ((double)(n_) * (((1./6.) * (n_) + 0.5) * (n_) + (1./3.)))
+#define FADDS_POTRF(n_) ((double)(n_) * (((1./6.) * (n_)      ) * (n_) - (1./6.)))
+
+#define FMULS_TRTRI(n_) ((double)(n_) * ((n_) * ((1./6.) * (n_) + 0.5) + (1./3.)))
+#define FADDS_TRTRI(n_) ((double)(n_) * ((n_) * ((1./6.) * (n_) - 0.5) + (1./3.)))
+
+#define FMULS_LAUUM FMULS_POTRF
+#define FADDS_LAUUM FADDS_POTRF
+
+#define FMULS_SYGST(n_) (0.5 * (double)(n_) * (double)(n_) * (double)(n_))
+#define FADDS_SYGST(n_) (0.5 * (double)(n_) * (double)(n_) * (double)(n_))
+
+#define FMULS_GETRF(m_, n_) ( ((m_) < (n_)) \
+    ? (0.5 * (m_) * ((m_) * ((n_) - (1./3.) * (m_) - 1.) + (n_)) + (2./3.) * (m_)) \
+    : (0.5 * (n_) * ((n_) * ((m_) - (1./3.) * (n_) - 1.) + (m_)) + (2./3.) * (n_)) )
+#define FADDS_GETRF(m_, n_) ( ((m_) < (n_)) \
+    ? (0.5 * (m_) * ((m_) * ((n_) - (1./3.) * (m_)     ) - (n_)) + (1./6.) * (m_)) \
+    : (0.5 * (n_) * ((n_) * ((m_) - (1./3.) * (n_)     ) - (m_)) + (1./6.) * (n_)) )
+
+#define FMULS_GEQRF(m_, n_) ( ((m_) > (n_)) \
+    ? ((n_) * ((n_) * ( 0.5 - (1./3.) * (n_) + (m_)) +      (m_) + 23./6.)) \
+    : ((m_) * ((m_) * (-0.5 - (1./3.) * (m_) + (n_)) + 2. * (n_) + 23./6.)) )
+#define FADDS_GEQRF(m_, n_) ( ((m_) > (n_)) \
+    ? ((n_) * ((n_) * ( 0.5 - (1./3.) * (n_) + (m_))             +  5./6.)) \
+    : ((m_) * ((m_) * (-0.5 - (1./3.) * (m_) + (n_)) +      (n_) +  5./6.)) )
+
+#define FMULS_GELQF(m_, n_) ( ((m_) > (n_)) \
+    ? ((n_) * ((n_) * ( 0.5 - (1./3.) * (n_) + (m_)) +      (m_) + 29./6.)) \
+    : ((m_) * ((m_) * (-0.5 - (1./3.) * (m_) + (n_)) + 2. * (n_) + 29./6.)) )
+#define FADDS_GELQF(m_, n_) ( ((m_) > (n_)) \
+    ? ((n_) * ((n_) * ( 0.5 - (1./3.) * (n_) + (m_))             +  1./6.)) \
+    : ((m_) * ((m_) * (-0.5 - (1./3.) * (m_) + (n_)) +      (n_) +  1./6.)) )
+
+// Left side; the right side is obtained by swapping m_ and n_.
+#define FMULS_UNMQR(m_, n_, k_) \
+    (2. * (n_) * (m_) * (k_) - (n_) * (k_) * (k_) + 2. * (n_) * (k_))
+#define FADDS_UNMQR(m_, n_, k_) \
+    (2. * (n_) * (m_) * (k_) - (n_) * (k_) * (k_) +      (n_) * (k_))
+
+#define FMULS_UNMLQ FMULS_UNMQR
+#define FADDS_UNMLQ FADDS_UNMQR
+
+/******************************************************************************/
+// Tile kernels.
+// ts: n-by-n triangle on top of a full m-by-n tile.
+#define FMULS_TSQRT(m_, n_) ((double)(m_) * (n_) * (n_) + (double)(m_) * (n_))
+#define FADDS_TSQRT(m_, n_) ((double)(m_) * (n_) * (n_))
+
+// Left side, k reflectors applied to n columns of an m-by-n tile A2.
+#define FMULS_TSMQR(m_, n_, k_) (2. * (m_) * (n_) * (k_) + 0.5 * (n_) * (k_) * (k_))
+#define FADDS_TSMQR(m_, n_, k_) (2. * (m_) * (n_) * (k_) + 0.5 * (n_) * (k_) * (k_))
+
+// tt: n-by-n triangle on top of an n-by-n triangle.
+#define FMULS_TTQRT(n_) ((1./3.) * (n_) * (n_) * (n_) + (n_) * (n_))
+#define FADDS_TTQRT(n_) ((1./3.) * (n_) * (n_) * (n_))
+
+// Left side, k reflectors with triangular V applied to n columns.
+#define FMULS_TTMQR(n_, k_) ((double)(n_) * (k_) * (k_) + 0.5 * (n_) * (k_) * (k_))
+#define FADDS_TTMQR(n_, k_) ((double)(n_) * (k_) * (k_) + 0.5 * (n_) * (k_) * (k_))
+
+#endif // COREBLAS_FLOPS_H
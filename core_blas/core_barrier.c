@@ -0,0 +1,126 @@
+/**
+ *
+ * @file
+ *
+ *  COREBLAS is a software package provided by:
+ *  University of Tennessee, US,
+ *  University of Manchester, UK.
+ *
+ **/
+
+#include <coreblas.h>
+#include "coreblas_barrier.h"
+
+#include <sched.h>
+
+// Spinning backs off exponentially up to this many pause instructions
+// between two polls of the sense flag.
+#define COREBLAS_BARRIER_MAX_BACKOFF 32
+
+// After this many polls the waiting thread yields the processor, so that
+// an oversubscribed team still makes progress.
+#define COREBLAS_BARRIER_YIELD 128
+
+/******************************************************************************/
+static inline void coreblas_barrier_pause(void)
+{
+#if defined(__x86_64__) || defined(__i386__)
+    __builtin_ia32_pause();
+#elif defined(__aarch64__)
+    __asm__ __volatile__("yield");
+#elif defined(__powerpc64__)
+    __asm__ __volatile__("or 27,27,27");
+#endif
+}
+
+/***************************************************************************//**
+ *
+ * @ingroup core_barrier
+ *
+ *  Initializes the barrier. It must not be in use by any thread.
+ *
+ ******************************************************************************/
+void coreblas_barrier_init(coreblas_barrier_t *barrier)
+{
+    __atomic_store_n(&barrier->count, 0, __ATOMIC_RELAXED);
+    __atomic_store_n(&barrier->sense, 0, __ATOMIC_RELEASE);
+}
+
+/***************************************************************************//**
+ *
+ * @ingroup core_barrier
+ *
+ *  Blocks until size threads have called coreblas_barrier_wait() on the
+ *  barrier. Every thread reads the sense flag before arriving; the last one
+ *  to arrive resets the counter and flips the flag, releasing the others,
+ *  who spin on the flag with exponential backoff. The flag cannot flip
+ *  before all threads of the episode have read it, so no per-thread state
+ *  is needed and the barrier can be reused right away.
+ *  Memory written before the barrier is visible to all threads after it.
+ *
+ *******************************************************************************
+ *
+ * @param[in,out] barrier
+ *         The barrier, initialized with coreblas_barrier_init().
+ *
+ * @param[in] size
+ *         The number of threads synchronizing on the barrier.
+ *
+ ******************************************************************************/
+void coreblas_barrier_wait(coreblas_barrier_t *barrier, int size)
+{
+    int sense = __atomic_load_n(&barrier->sense, __ATOMIC_ACQUIRE);
+
+    if (__atomic_add_fetch(&barrier->count, 1, __ATOMIC_ACQ_REL) == size) {
+        __atomic_store_n(&barrier->count, 0, __ATOMIC_RELAXED);
+        __atomic_store_n(&barrier->sense, !sense, __ATOMIC_RELEASE);
+        return;
+    }
+
+    int backoff = 1;
+    long polls = 0;
+    while (__atomic_load_n(&barrier->sense, __ATOMIC_ACQUIRE) == sense) {
+        if (++polls >= COREBLAS_BARRIER_YIELD) {
+            sched_yield();
+            continue;
+        }
+        for (int i = 0; i < backoff; i++)
+            coreblas_barrier_pause();
+        if (backoff < COREBLAS_BARRIER_MAX_BACKOFF)
+            backoff *= 2;
+    }
+}
+
+/***************************************************************************//**
+ *
+ * @ingroup core_barrier
+ *
+ *  Blocks until the flag, e.g., an entry of a progress table written by
+ *  another thread with a release store, is at least value. Spins with the
+ *  same backoff as coreblas_barrier_wait(). Memory written by the writer
+ *  before storing the awaited value is visible after the return.
+ *
+ *******************************************************************************
+ *
+ * @param[in] flag
+ *         The flag, which only increases.
+ *
+ * @param[in] value
+ *         The value to wait for.
+ *
+ ******************************************************************************/
+void coreblas_barrier_wait_flag(volatile int *flag, int value)
+{
+    int backoff = 1;
+    long polls = 0;
+    while (__atomic_load_n(flag, __ATOMIC_ACQUIRE) < value) {
+        if (++polls >= COREBLAS_BARRIER_YIELD) {
+            sched_yield();
+            continue;
+        }
+        for (int i = 0; i < backoff; i++)
+            coreblas_barrier_pause();
+        if (backoff < COREBLAS_BARRIER_MAX_BACKOFF)
+            backoff *= 2;
+    }
+}
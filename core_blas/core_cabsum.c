@@ -0,0 +1,336 @@
+/**
+ *
+ * @file
+ *
+ *  COREBLAS is a software package provided by:
+ *  University of Tennessee, US,
+ *  University of Manchester, UK.
+ *
+ * @generated from core_blas/core_zabsum.c, normal z -> c, Fri Oct 16 03:36:55 2026
+ *
+ **/
+
+#include <coreblas.h>
+#include "coreblas_types.h"
+#include "coreblas_internal.h"
+
+#include <math.h>
+
+// This will be swapped during the automatic code generation.
+#undef REAL
+#define COMPLEX
+#define PRECISION_c
+
+#if defined(COMPLEX) && defined(__x86_64__) && defined(__GNUC__)
+#define COREBLAS_ABSUM_X86
+#include <immintrin.h>
+#endif
+
+// The modulus of a complex number is computed as sqrtf(re^2 + im^2) when
+// the larger of |re| and |im| is zero or lies in [SMALL, BIG], where the
+// squares can neither overflow nor underflow, and by cabsf() otherwise,
+// e.g., for infinities and NaNs.
+#if defined(PRECISION_z)
+#define COREBLAS_ABSUM_SMALL 0x1p-500
+#define COREBLAS_ABSUM_BIG   0x1p+500
+#elif defined(PRECISION_c)
+#define COREBLAS_ABSUM_SMALL 0x1p-60f
+#define COREBLAS_ABSUM_BIG   0x1p+60f
+#endif
+
+/******************************************************************************/
+static inline float core_cabsum_abs(coreblas_complex32_t x)
+{
+#ifdef COMPLEX
+    // Converted first, so that fabsf() is called on the precision's type.
+    float re = creal(x);
+    float im = cimag(x);
+    re = fabsf(re);
+    im = fabsf(im);
+    float big = re > im ? re : im;
+    if (big <= COREBLAS_ABSUM_BIG &&
+        (big >= COREBLAS_ABSUM_SMALL || big == 0.0)) {
+        return sqrtf(re*re + im*im);
+    }
+    return cabsf(x);
+#else
+    return fabsf(x);
+#endif
+}
+
+/******************************************************************************/
+static float core_cabsum_ref(int m, const coreblas_complex32_t *x,
+                              float *y, int wantsum)
+{
+    float sum = 0.0;
+    if (y == NULL) {
+        #pragma omp simd reduction(+:sum)
+        for (int i = 0; i < m; i++)
+            sum += core_cabsum_abs(x[i]);
+    }
+    else if (!wantsum) {
+        #pragma omp simd
+        for (int i = 0; i < m; i++)
+            y[i] += core_cabsum_abs(x[i]);
+    }
+    else {
+        #pragma omp simd reduction(+:sum)
+        for (int i = 0; i < m; i++) {
+            float a = core_cabsum_abs(x[i]);
+            y[i] += a;
+            sum += a;
+        }
+    }
+    return sum;
+}
+
+#ifdef COREBLAS_ABSUM_X86
+/******************************************************************************/
+// AVX2: the moduli of two registers of interleaved (re, im) pairs are
+// obtained with one horizontal add, which leaves them in the order
+// 0 2 1 3 of the 64-bit lanes, hence the permutation.
+// A step holding a component that is not zero and outside of
+// [SMALL, BIG], or a NaN, is done by core_cabsum_abs().
+__attribute__((target("avx2")))
+static float core_cabsum_avx2(int m, const coreblas_complex32_t *x,
+                               float *y, int wantsum)
+{
+    float sum = 0.0;
+    int i = 0;
+#if defined(PRECISION_z)
+    const float *px = (const float*)x;
+    const __m256d sign  = _mm256_set1_pd(-0.0);
+    const __m256d zero  = _mm256_setzero_pd();
+    const __m256d small = _mm256_set1_pd(COREBLAS_ABSUM_SMALL);
+    const __m256d big   = _mm256_set1_pd(COREBLAS_ABSUM_BIG);
+    __m256d vsum = zero;
+    for (; i+4 <= m; i += 4) {
+        __m256d x0 = _mm256_loadu_pd(&px[2*i]);
+        __m256d x1 = _mm256_loadu_pd(&px[2*i+4]);
+        __m256d a0 = _mm256_andnot_pd(sign, x0);
+        __m256d a1 = _mm256_andnot_pd(sign, x1);
+        __m256d u0 = _mm256_or_pd(
+            _mm256_cmp_pd(a0, big, _CMP_NLE_UQ),
+            _mm256_and_pd(_mm256_cmp_pd(a0, small, _CMP_LT_OQ),
+                          _mm256_cmp_pd(a0, zero,  _CMP_NEQ_OQ)));
+        __m256d u1 = _mm256_or_pd(
+            _mm256_cmp_pd(a1, big, _CMP_NLE_UQ),
+            _mm256_and_pd(_mm256_cmp_pd(a1, small, _CMP_LT_OQ),
+                          _mm256_cmp_pd(a1, zero,  _CMP_NEQ_OQ)));
+        if (_mm256_movemask_pd(_mm256_or_pd(u0, u1)) != 0) {
+            sum += core_cabsum_ref(4, &x[i], y != NULL ? &y[i] : NULL,
+                                   wantsum);
+            continue;
+        }
+        __m256d s = _mm256_hadd_pd(_mm256_mul_pd(x0, x0),
+                                   _mm256_mul_pd(x1, x1));
+        __m256d a = _mm256_sqrt_pd(_mm256_permute4x64_pd(s, 0xD8));
+        if (wantsum)
+            vsum = _mm256_add_pd(vsum, a);
+        if (y != NULL)
+            _mm256_storeu_pd(&y[i], _mm256_add_pd(_mm256_loadu_pd(&y[i]), a));
+    }
+    __m128d h = _mm_add_pd(_mm256_castpd256_pd128(vsum),
+                           _mm256_extractf128_pd(vsum, 1));
+    sum += _mm_cvtsd_f64(_mm_add_sd(h, _mm_unpackhi_pd(h, h)));
+#elif defined(PRECISION_c)
+    const float *px = (const float*)x;
+    const __m256 sign  = _mm256_set1_ps(-0.0f);
+    const __m256 zero  = _mm256_setzero_ps();
+    const __m256 small = _mm256_set1_ps(COREBLAS_ABSUM_SMALL);
+    const __m256 big   = _mm256_set1_ps(COREBLAS_ABSUM_BIG);
+    __m256 vsum = zero;
+    for (; i+8 <= m; i += 8) {
+        __m256 x0 = _mm256_loadu_ps(&px[2*i]);
+        __m256 x1 = _mm256_loadu_ps(&px[2*i+8]);
+        __m256 a0 = _mm256_andnot_ps(sign, x0);
+        __m256 a1 = _mm256_andnot_ps(sign, x1);
+        __m256 u0 = _mm256_or_ps(
+            _mm256_cmp_ps(a0, big, _CMP_NLE_UQ),
+            _mm256_and_ps(_mm256_cmp_ps(a0, small, _CMP_LT_OQ),
+                          _mm256_cmp_ps(a0, zero,  _CMP_NEQ_OQ)));
+        __m256 u1 = _mm256_or_ps(
+            _mm256_cmp_ps(a1, big, _CMP_NLE_UQ),
+            _mm256_and_ps(_mm256_cmp_ps(a1, small, _CMP_LT_OQ),
+                          _mm256_cmp_ps(a1, zero,  _CMP_NEQ_OQ)));
+        if (_mm256_movemask_ps(_mm256_or_ps(u0, u1)) != 0) {
+            sum += core_cabsum_ref(8, &x[i], y != NULL ? &y[i] : NULL,
+                                   wantsum);
+            continue;
+        }
+        // The horizontal add works within 128-bit halves: the pairs of
+        // moduli come out in the order 0 2 1 3.
+        __m256 s = _mm256_hadd_ps(_mm256_mul_ps(x0, x0),
+                                  _mm256_mul_ps(x1, x1));
+        s = _mm256_castpd_ps(
+                _mm256_permute4x64_pd(_mm256_castps_pd(s), 0xD8));
+        __m256 a = _mm256_sqrt_ps(s);
+        if (wantsum)
+            vsum = _mm256_add_ps(vsum, a);
+        if (y != NULL)
+            _mm256_storeu_ps(&y[i], _mm256_add_ps(_mm256_loadu_ps(&y[i]), a));
+    }
+    __m128 h = _mm_add_ps(_mm256_castps256_ps128(vsum),
+                          _mm256_extractf128_ps(vsum, 1));
+    h = _mm_add_ps(h, _mm_movehl_ps(h, h));
+    sum += _mm_cvtss_f32(_mm_add_ss(h, _mm_movehdup_ps(h)));
+#endif
+    return sum + core_cabsum_ref(m-i, &x[i], y != NULL ? &y[i] : NULL,
+                                 wantsum);
+}
+
+/******************************************************************************/
+// AVX-512: the real and imaginary parts of two registers are separated
+// with two permutations, which also allows the exact test on the larger
+// of |re| and |im| for every element.
+__attribute__((target("avx512f")))
+static float core_cabsum_avx512(int m, const coreblas_complex32_t *x,
+                                 float *y, int wantsum)
+{
+    float sum = 0.0;
+    int i = 0;
+#if defined(PRECISION_z)
+    const float *px = (const float*)x;
+    const __m512i ire = _mm512_set_epi64(14, 12, 10, 8, 6, 4, 2, 0);
+    const __m512i iim = _mm512_set_epi64(15, 13, 11, 9, 7, 5, 3, 1);
+    const __m512d zero  = _mm512_setzero_pd();
+    const __m512d small = _mm512_set1_pd(COREBLAS_ABSUM_SMALL);
+    const __m512d big   = _mm512_set1_pd(COREBLAS_ABSUM_BIG);
+    __m512d vsum = zero;
+    for (; i+8 <= m; i += 8) {
+        __m512d x0 = _mm512_loadu_pd(&px[2*i]);
+        __m512d x1 = _mm512_loadu_pd(&px[2*i+8]);
+        __m512d re = _mm512_permutex2var_pd(x0, ire, x1);
+        __m512d im = _mm512_permutex2var_pd(x0, iim, x1);
+        __m512d mx = _mm512_max_pd(_mm512_abs_pd(re), _mm512_abs_pd(im));
+        __mmask8 u =
+            _mm512_cmp_pd_mask(mx, big, _CMP_NLE_UQ) |
+            _mm512_mask_cmp_pd_mask(_mm512_cmp_pd_mask(mx, small, _CMP_LT_OQ),
+                                    mx, zero, _CMP_NEQ_OQ) |
+            _mm512_cmp_pd_mask(re, im, _CMP_UNORD_Q);
+        if (u != 0) {
+            sum += core_cabsum_ref(8, &x[i], y != NULL ? &y[i] : NULL,
+                                   wantsum);
+            continue;
+        }
+        __m512d a = _mm512_sqrt_pd(
+            _mm512_add_pd(_mm512_mul_pd(re, re), _mm512_mul_pd(im, im)));
+        if (wantsum)
+            vsum = _mm512_add_pd(vsum, a);
+        if (y != NULL)
+            _mm512_storeu_pd(&y[i], _mm512_add_pd(_mm512_loadu_pd(&y[i]), a));
+    }
+    sum += _mm512_reduce_add_pd(vsum);
+#elif defined(PRECISION_c)
+    const float *px = (const float*)x;
+    const __m512i ire = _mm512_set_epi32(30, 28, 26, 24, 22, 20, 18, 16,
+                                         14, 12, 10,  8,  6,  4,  2,  0);
+    const __m512i iim = _mm512_set_epi32(31, 29, 27, 25, 23, 21, 19, 17,
+                                         15, 13, 11,  9,  7,  5,  3,  1);
+    const __m512 zero  = _mm512_setzero_ps();
+    const __m512 small = _mm512_set1_ps(COREBLAS_ABSUM_SMALL);
+    const __m512 big   = _mm512_set1_ps(COREBLAS_ABSUM_BIG);
+    __m512 vsum = zero;
+    for (; i+16 <= m; i += 16) {
+        __m512 x0 = _mm512_loadu_ps(&px[2*i]);
+        __m512 x1 = _mm512_loadu_ps(&px[2*i+16]);
+        __m512 re = _mm512_permutex2var_ps(x0, ire, x1);
+        __m512 im = _mm512_permutex2var_ps(x0, iim, x1);
+        __m512 mx = _mm512_max_ps(_mm512_abs_ps(re), _mm512_abs_ps(im));
+        __mmask16 u =
+            _mm512_cmp_ps_mask(mx, big, _CMP_NLE_UQ) |
+            _mm512_mask_cmp_ps_mask(_mm512_cmp_ps_mask(mx, small, _CMP_LT_OQ),
+                                    mx, zero, _CMP_NEQ_OQ) |
+            _mm512_cmp_ps_mask(re, im, _CMP_UNORD_Q);
+        if (u != 0) {
+            sum += core_cabsum_ref(16, &x[i], y != NULL ? &y[i] : NULL,
+                                   wantsum);
+            continue;
+        }
+        __m512 a = _mm512_sqrt_ps(
+            _mm512_add_ps(_mm512_mul_ps(re, re), _mm512_mul_ps(im, im)));
+        if (wantsum)
+            vsum = _mm512_add_ps(vsum, a);
+        if (y != NULL)
+            _mm512_storeu_ps(&y[i], _mm512_add_ps(_mm512_loadu_ps(&y[i]), a));
+    }
+    sum += _mm512_reduce_add_ps(vsum);
+#endif
+    return sum + core_cabsum_ref(m-i, &x[i], y != NULL ? &y[i] : NULL,
+                                 wantsum);
+}
+#endif // COREBLAS_ABSUM_X86
+
+/******************************************************************************/
+static float core_cabsum(int m, const coreblas_complex32_t *x,
+                          float *y, int wantsum)
+{
+#ifdef COREBLAS_ABSUM_X86
+    if (__builtin_cpu_supports("avx512f"))
+        return core_cabsum_avx512(m, x, y, wantsum);
+    if (__builtin_cpu_supports("avx2"))
+        return core_cabsum_avx2(m, x, y, wantsum);
+#endif
+    return core_cabsum_ref(m, x, y, wantsum);
+}
+
+/***************************************************************************//**
+ *
+ * @ingroup core_lange
+ *
+ *  Returns the sum of the absolute values of the elements of the vector x
+ *  and, if y is not NULL, adds the absolute value of x_i to y_i.
+ *  Used by the one norms of coreblas_clange_aux and the other norm
+ *  kernels, column by column, and by the symmetric ones, which need
+ *  both; the infinity norms use coreblas_cabsum_add.
+ *
+ *  For complex vectors, the moduli are computed in vector registers, with
+ *  AVX-512 or AVX2 when the processor supports them and the code is built
+ *  for x86-64 with a GNU compatible compiler; the few elements for which
+ *  re^2 + im^2 could overflow or underflow go through cabsf().
+ *
+ *******************************************************************************
+ *
+ * @param[in] m
+ *          The length of the vectors x and y. m >= 0.
+ *
+ * @param[in] x
+ *          The vector x.
+ *
+ * @param[in,out] y
+ *          The vector y, or NULL.
+ *
+ *******************************************************************************
+ *
+ * @retval the sum of the absolute values of x_i.
+ *
+ ******************************************************************************/
+float coreblas_cabsum(int m, const coreblas_complex32_t *x, float *y)
+{
+    return core_cabsum(m, x, y, 1);
+}
+
+/***************************************************************************//**
+ *
+ * @ingroup core_lange
+ *
+ *  Adds the absolute value of x_i to y_i, without forming the sum of
+ *  coreblas_cabsum. Used by the infinity norms, which only need the
+ *  row sums.
+ *
+ *******************************************************************************
+ *
+ * @param[in] m
+ *          The length of the vectors x and y. m >= 0.
+ *
+ * @param[in] x
+ *          The vector x.
+ *
+ * @param[in,out] y
+ *          The vector y.
+ *
+ ******************************************************************************/
+void coreblas_cabsum_add(int m, const coreblas_complex32_t *x, float *y)
+{
+    core_cabsum(m, x, y, 0);
+}
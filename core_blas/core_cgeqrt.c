@@ -0,0 +1,435 @@
+/**
+ *
+ * @file
+ *
+ *  COREBLAS is a software package provided by:
+ *  University of Tennessee, US,
+ *  University of Manchester, UK.
+ *
+ * @generated from core_blas/core_zgeqrt.c, normal z -> c, Fri Oct 16 03:36:58 2026
+ *
+ **/
+
+#include <coreblas.h>
+#include "coreblas_types.h"
+#include "coreblas_internal.h"
+#include "core_lapack.h"
+
+// Panels of at most this many columns are factored one column at a time.
+#define COREBLAS_GEQRT_LEAF 8
+
+/******************************************************************************/
+// Applies H^H = (I - V T V^H)^H from the left to the m-by-n tile C,
+// where V is m-by-k unit lower trapezoidal and T is k-by-k upper triangular.
+// The k-by-n workspace W = V^H C is kept in work.
+static void core_cgeqrt_larfb(int m, int n, int k,
+                              const coreblas_complex32_t *V, int ldv,
+                              const coreblas_complex32_t *T, int ldt,
+                                    coreblas_complex32_t *C, int ldc,
+                                    coreblas_complex32_t *W)
+{
+    static coreblas_complex32_t zone  =  1.0;
+    static coreblas_complex32_t mzone = -1.0;
+
+    // W = V1^H C1
+    for (int j = 0; j < n; j++)
+        for (int i = 0; i < k; i++)
+            W[k*j+i] = C[ldc*j+i];
+
+#ifdef COREBLAS_USE_64BIT_BLAS
+    cblas_ctrmm64_(CblasColMajor,
+                   CblasLeft, CblasLower,
+                   (CBLAS_TRANSPOSE)CoreBlas_ConjTrans, CblasUnit,
+                   k, n,
+                   CBLAS_SADDR(zone), V, ldv,
+                                      W, k);
+#else
+    cblas_ctrmm(CblasColMajor,
+                CblasLeft, CblasLower,
+                (CBLAS_TRANSPOSE)CoreBlas_ConjTrans, CblasUnit,
+                k, n,
+                CBLAS_SADDR(zone), V, ldv,
+                                   W, k);
+#endif
+
+    // W += V2^H C2
+    if (m > k) {
+#ifdef COREBLAS_USE_64BIT_BLAS
+        cblas_cgemm64_(CblasColMajor,
+                       (CBLAS_TRANSPOSE)CoreBlas_ConjTrans, CblasNoTrans,
+                       k, n, m-k,
+                       CBLAS_SADDR(zone), &V[k], ldv,
+                                          &C[k], ldc,
+                       CBLAS_SADDR(zone), W,     k);
+#else
+        cblas_cgemm(CblasColMajor,
+                    (CBLAS_TRANSPOSE)CoreBlas_ConjTrans, CblasNoTrans,
+                    k, n, m-k,
+                    CBLAS_SADDR(zone), &V[k], ldv,
+                                       &C[k], ldc,
+                    CBLAS_SADDR(zone), W,     k);
+#endif
+    }
+
+    // W = T^H W
+#ifdef COREBLAS_USE_64BIT_BLAS
+    cblas_ctrmm64_(CblasColMajor,
+                   CblasLeft, CblasUpper,
+                   (CBLAS_TRANSPOSE)CoreBlas_ConjTrans, CblasNonUnit,
+                   k, n,
+                   CBLAS_SADDR(zone), T, ldt,
+                                      W, k);
+#else
+    cblas_ctrmm(CblasColMajor,
+                CblasLeft, CblasUpper,
+                (CBLAS_TRANSPOSE)CoreBlas_ConjTrans, CblasNonUnit,
+                k, n,
+                CBLAS_SADDR(zone), T, ldt,
+                                   W, k);
+#endif
+
+    // C2 -= V2 W
+    if (m > k) {
+#ifdef COREBLAS_USE_64BIT_BLAS
+        cblas_cgemm64_(CblasColMajor,
+                       CblasNoTrans, CblasNoTrans,
+                       m-k, n, k,
+                       CBLAS_SADDR(mzone), &V[k], ldv,
+                                           W,     k,
+                       CBLAS_SADDR(zone),  &C[k], ldc);
+#else
+        cblas_cgemm(CblasColMajor,
+                    CblasNoTrans, CblasNoTrans,
+                    m-k, n, k,
+                    CBLAS_SADDR(mzone), &V[k], ldv,
+                                        W,     k,
+                    CBLAS_SADDR(zone),  &C[k], ldc);
+#endif
+    }
+
+    // C1 -= V1 W
+#ifdef COREBLAS_USE_64BIT_BLAS
+    cblas_ctrmm64_(CblasColMajor,
+                   CblasLeft, CblasLower,
+                   CblasNoTrans, CblasUnit,
+                   k, n,
+                   CBLAS_SADDR(zone), V, ldv,
+                                      W, k);
+#else
+    cblas_ctrmm(CblasColMajor,
+                CblasLeft, CblasLower,
+                CblasNoTrans, CblasUnit,
+                k, n,
+                CBLAS_SADDR(zone), V, ldv,
+                                   W, k);
+#endif
+
+    for (int j = 0; j < n; j++)
+        for (int i = 0; i < k; i++)
+            C[ldc*j+i] -= W[k*j+i];
+}
+
+/******************************************************************************/
+// Factors the m-by-n panel A, m >= n, one column at a time and accumulates
+// the n-by-n triangular factor T column by column.
+static void core_cgeqrt_leaf(int m, int n,
+                             coreblas_complex32_t *A, int lda,
+                             coreblas_complex32_t *T, int ldt,
+                             coreblas_complex32_t *tau,
+                             coreblas_complex32_t *work)
+{
+    static coreblas_complex32_t zone  = 1.0;
+    static coreblas_complex32_t zzero = 0.0;
+
+    for (int j = 0; j < n; j++) {
+        // Generate elementary reflector H(j) to annihilate A(j+1:m, j).
+#ifdef COREBLAS_USE_64BIT_BLAS
+        LAPACKE_clarfg_work64_(m-j, &A[lda*j+j], &A[lda*j+imin(j+1, m-1)], 1,
+                               &tau[j]);
+#else
+        LAPACKE_clarfg_work(m-j, &A[lda*j+j], &A[lda*j+imin(j+1, m-1)], 1,
+                            &tau[j]);
+#endif
+        coreblas_complex32_t ajj = A[lda*j+j];
+        A[lda*j+j] = 1.0;
+
+        if (j+1 < n) {
+            // Apply H(j)^H to A(j:m, j+1:n) from the left.
+            coreblas_complex32_t alpha = -conjf(tau[j]);
+#ifdef COREBLAS_USE_64BIT_BLAS
+            cblas_cgemv64_(CblasColMajor, (CBLAS_TRANSPOSE)CoreBlas_ConjTrans,
+                           m-j, n-j-1,
+                           CBLAS_SADDR(zone),  &A[lda*(j+1)+j], lda,
+                                               &A[lda*j+j], 1,
+                           CBLAS_SADDR(zzero), work, 1);
+
+            cblas_cgerc64_(CblasColMajor,
+                           m-j, n-j-1,
+                           CBLAS_SADDR(alpha), &A[lda*j+j], 1,
+                                               work, 1,
+                                               &A[lda*(j+1)+j], lda);
+#else
+            cblas_cgemv(CblasColMajor, (CBLAS_TRANSPOSE)CoreBlas_ConjTrans,
+                        m-j, n-j-1,
+                        CBLAS_SADDR(zone),  &A[lda*(j+1)+j], lda,
+                                            &A[lda*j+j], 1,
+                        CBLAS_SADDR(zzero), work, 1);
+
+            cblas_cgerc(CblasColMajor,
+                        m-j, n-j-1,
+                        CBLAS_SADDR(alpha), &A[lda*j+j], 1,
+                                            work, 1,
+                                            &A[lda*(j+1)+j], lda);
+#endif
+        }
+
+        // T(0:j, j) = -tau(j) T(0:j, 0:j) V(j:m, 0:j)^H v(j)
+        if (j > 0) {
+            coreblas_complex32_t alpha = -tau[j];
+#ifdef COREBLAS_USE_64BIT_BLAS
+            cblas_cgemv64_(CblasColMajor, (CBLAS_TRANSPOSE)CoreBlas_ConjTrans,
+                           m-j, j,
+                           CBLAS_SADDR(alpha), &A[j], lda,
+                                               &A[lda*j+j], 1,
+                           CBLAS_SADDR(zzero), &T[ldt*j], 1);
+
+            cblas_ctrmv64_(CblasColMajor, CblasUpper,
+                           CblasNoTrans, CblasNonUnit,
+                           j,
+                           T, ldt,
+                           &T[ldt*j], 1);
+#else
+            cblas_cgemv(CblasColMajor, (CBLAS_TRANSPOSE)CoreBlas_ConjTrans,
+                        m-j, j,
+                        CBLAS_SADDR(alpha), &A[j], lda,
+                                            &A[lda*j+j], 1,
+                        CBLAS_SADDR(zzero), &T[ldt*j], 1);
+
+            cblas_ctrmv(CblasColMajor, CblasUpper,
+                        CblasNoTrans, CblasNonUnit,
+                        j,
+                        T, ldt,
+                        &T[ldt*j], 1);
+#endif
+        }
+        T[ldt*j+j] = tau[j];
+        A[lda*j+j] = ajj;
+    }
+}
+
+/******************************************************************************/
+// Recursive QR factorization of the m-by-n panel A, m >= n.
+// The panel is split in two halves of columns; the left half is factored
+// and applied to the right half, the right half is factored, and the
+// off-diagonal block of T is merged with level 3 operations by
+// coreblas_clarft_merge:
+//     T12 = -T11 (V1^H V2) T22.
+// T stays in the panel's n-by-n block, work holds at most n*n/4 elements.
+static void core_cgeqrt_rec(int m, int n,
+                            coreblas_complex32_t *A, int lda,
+                            coreblas_complex32_t *T, int ldt,
+                            coreblas_complex32_t *tau,
+                            coreblas_complex32_t *work)
+{
+    if (n <= COREBLAS_GEQRT_LEAF) {
+        core_cgeqrt_leaf(m, n, A, lda, T, ldt, tau, work);
+        return;
+    }
+
+    int n1 = n/2;
+    int n2 = n-n1;
+
+    coreblas_complex32_t *A12 = &A[lda*n1];
+    coreblas_complex32_t *A22 = &A[lda*n1+n1];
+    coreblas_complex32_t *T22 = &T[ldt*n1+n1];
+
+    core_cgeqrt_rec(m, n1, A, lda, T, ldt, tau, work);
+    core_cgeqrt_larfb(m, n2, n1, A, lda, T, ldt, A12, lda, work);
+    core_cgeqrt_rec(m-n1, n2, A22, lda, T22, ldt, &tau[n1], work);
+
+    // T12 = -T11 (V1^H V2) T22
+    coreblas_clarft_merge(CoreBlasColumnwise, m, n1, n2, A, lda, T, ldt);
+}
+
+/***************************************************************************//**
+ *
+ * @ingroup core_geqrt
+ *
+ *  Computes a QR factorization of an m-by-n tile A:
+ *  The factorization has the form
+ *    \f[
+ *        A = Q \times R
+ *    \f]
+ *  The tile Q is represented as a product of elementary reflectors
+ *    \f[
+ *        Q = H(1) H(2) ... H(k),
+ *    \f]
+ *  where \f$ k = min(m,n) \f$.
+ *
+ *  Each \f$ H(i) \f$ has the form
+ *    \f[
+ *        H(i) = I - \tau \times v \times v^H
+ *    \f]
+ *  where \f$ tau \f$ is a scalar, and \f$ v \f$ is a vector with
+ *  v(1:i-1) = 0 and v(i) = 1; v(i+1:m) is stored on exit in A(i+1:m,i),
+ *  and \f$ tau \f$ in tau(i).
+ *
+ *******************************************************************************
+ *
+ * @param[in] m
+ *          The number of rows of the tile A.  m >= 0.
+ *
+ * @param[in] n
+ *         The number of columns of the tile A.  n >= 0.
+ *
+ * @param[in] ib
+ *         The inner-blocking size.  ib >= 0.
+ *
+ * @param[in,out] A
+ *         On entry, the m-by-n tile A.
+ *         On exit, the elements on and above the diagonal of the array
+ *         contain the min(m,n)-by-n upper trapezoidal tile R (R is
+ *         upper triangular if m >= n); the elements below the diagonal,
+ *         with the array tau, represent the unitary tile Q as a
+ *         product of elementary reflectors (see Further Details).
+ *
+ * @param[in] lda
+ *         The leading dimension of the array A.  lda >= max(1,m).
+ *
+ * @param[out] T
+ *         The ib-by-n triangular factor T of the block reflector.
+ *         T is upper triangular by block (economic storage);
+ *         The rest of the array is not referenced.
+ *
+ * @param[in] ldt
+ *         The leading dimension of the array T. ldt >= ib.
+ *
+ * @param tau
+ *         Auxiliary workspace array of length n.
+ *
+ * @param work
+ *         Auxiliary workspace array of length ib*n.
+ *
+ *******************************************************************************
+ *
+ * @retval CoreBlasSuccess successful exit
+ * @retval < 0 if -i, the i-th argument had an illegal value
+ *
+ ******************************************************************************/
+__attribute__((weak))
+int coreblas_cgeqrt(int m, int n, int ib,
+                coreblas_complex32_t *A, int lda,
+                coreblas_complex32_t *T, int ldt,
+                coreblas_complex32_t *tau,
+                coreblas_complex32_t *work)
+{
+#ifndef COREBLAS_UNCHECKED
+    // Check input arguments.
+    if (m < 0) {
+        coreblas_error("illegal value of m");
+        return -1;
+    }
+    if (n < 0) {
+        coreblas_error("illegal value of n");
+        return -2;
+    }
+    if ((ib < 0) || ( (ib == 0) && (m > 0) && (n > 0) )) {
+        coreblas_error("illegal value of ib");
+        return -3;
+    }
+    if (A == NULL) {
+        coreblas_error("NULL A");
+        return -4;
+    }
+    if (lda < imax(1, m) && m > 0) {
+        coreblas_error("illegal value of lda");
+        return -5;
+    }
+    if (T == NULL) {
+        coreblas_error("NULL T");
+        return -6;
+    }
+    if (ldt < imax(1, ib) && ib > 0) {
+        coreblas_error("illegal value of ldt");
+        return -7;
+    }
+    if (tau == NULL) {
+        coreblas_error("NULL tau");
+        return -8;
+    }
+    if (work == NULL) {
+        coreblas_error("NULL work");
+        return -9;
+    }
+#endif
+
+    return coreblas_cgeqrt_nocheck(m, n, ib, A, lda, T, ldt, tau, work);
+}
+
+/***************************************************************************//**
+ *
+ * @ingroup core_geqrt
+ *
+ *  Same as coreblas_cgeqrt, without checking the arguments. Called by
+ *  coreblas_cgeqrt_batched and coreblas_cgeqrt_batched_strided once they
+ *  have checked their own.
+ *
+ ******************************************************************************/
+int coreblas_cgeqrt_nocheck(int m, int n, int ib,
+                coreblas_complex32_t *A, int lda,
+                coreblas_complex32_t *T, int ldt,
+                coreblas_complex32_t *tau,
+                coreblas_complex32_t *work)
+{
+    // quick return
+    if (m == 0 || n == 0 || ib == 0)
+        return CoreBlasSuccess;
+
+    int k = imin(m, n);
+    for (int i = 0; i < k; i += ib) {
+        int sb = imin(ib, k-i);
+
+        // Factor the panel A(i:m, i:i+sb) and build its T on the fly.
+        core_cgeqrt_rec(m-i, sb, &A[lda*i+i], lda, &T[ldt*i], ldt,
+                        &tau[i], work);
+
+        // Apply the block reflector to the trailing columns.
+        if (n > i+sb) {
+            core_cgeqrt_larfb(m-i, n-i-sb, sb,
+                              &A[lda*i+i], lda,
+                              &T[ldt*i], ldt,
+                              &A[lda*(i+sb)+i], lda,
+                              work);
+        }
+    }
+
+    return CoreBlasSuccess;
+}
+
+/***************************************************************************//**
+ *
+ * @ingroup core_geqrt
+ *
+ *  Returns the minimum length of the array work of coreblas_cgeqrt
+ *  for the given dimensions.
+ *
+ *******************************************************************************
+ *
+ * @param[in] m
+ *         The number of rows of the tile A.
+ *
+ * @param[in] n
+ *         The number of columns of the tile A.
+ *
+ * @param[in] ib
+ *         The inner-blocking size.
+ *
+ *******************************************************************************
+ *
+ * @retval the length of work, at least 1.
+ *
+ ******************************************************************************/
+size_t coreblas_cgeqrt_lwork(int m, int n, int ib)
+{
+    return imax(1, imin(ib, imin(m, n)))*(size_t)imax(0, n);
+}
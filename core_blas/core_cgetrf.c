@@ -0,0 +1,364 @@
+/**
+ *
+ * @file
+ *
+ *  COREBLAS is a software package provided by:
+ *  University of Tennessee, US,
+ *  University of Manchester, UK.
+ *
+ * @generated from core_blas/core_zgetrf.c, normal z -> c, Fri Oct 16 03:36:57 2026
+ *
+ **/
+
+#include <coreblas.h>
+#include "core_lapack.h"
+#include "coreblas_barrier.h"
+#include "coreblas_descriptor.h"
+#include "coreblas_internal.h"
+#include "coreblas_types.h"
+
+
+#include <assert.h>
+#include <math.h>
+
+#define A(m, n) (coreblas_complex32_t*)coreblas_tile_addr(A, m, n)
+
+// Panels of at most this many columns are factored one column at a time.
+#define COREBLAS_GETRF_LEAF 8
+
+/******************************************************************************/
+// Applies the interchanges of rows k0:k0+kn with rows ipiv[k0:k0+kn]-1
+// to the columns n0:n0+nn of the panel.
+static void core_cgetrf_laswp(coreblas_desc_t A, int n0, int nn,
+                              int k0, int kn, const int *ipiv)
+{
+    if (nn <= 0)
+        return;
+
+    for (int i = k0; i < k0+kn; i++) {
+        int p = ipiv[i]-1;
+        if (p != i) {
+            coreblas_complex32_t *ai = A(i/A.mb, 0);
+            coreblas_complex32_t *ap = A(p/A.mb, 0);
+            int ldai = coreblas_tile_mmain(A, i/A.mb);
+            int ldap = coreblas_tile_mmain(A, p/A.mb);
+#ifdef COREBLAS_USE_64BIT_BLAS
+            cblas_cswap64_(nn,
+                           &ai[i%A.mb+n0*ldai], ldai,
+                           &ap[p%A.mb+n0*ldap], ldap);
+#else
+            cblas_cswap(nn,
+                        &ai[i%A.mb+n0*ldai], ldai,
+                        &ap[p%A.mb+n0*ldap], ldap);
+#endif
+        }
+    }
+}
+
+/******************************************************************************/
+// Factors the columns j0:j0+nc of the panel one column at a time.
+// Each column takes two barriers: one after the local pivot searches, after
+// which every rank reduces the candidates in the same order, and one after
+// rank 0 has swapped the pivot row within the columns j0:j0+nc. Each rank
+// then scales and updates the rows of its own tiles.
+static void core_cgetrf_leaf(coreblas_desc_t A, int j0, int nc, int *ipiv,
+                             int rank, int size,
+                             volatile int *max_idx,
+                             volatile coreblas_complex32_t *max_val,
+                             volatile int *info, coreblas_barrier_t *barrier,
+                             float sfmin)
+{
+    coreblas_complex32_t *a0 = A(0, 0);
+    int lda0 = coreblas_tile_mmain(A, 0);
+    int mva0 = coreblas_tile_mview(A, 0);
+
+    for (int j = j0; j < j0+nc; j++) {
+        //==============
+        // pivot search
+        //==============
+        // Only rank 0 reads the diagonal, as tile 0 may still be
+        // updated by it. A rank without rows reports a zero candidate
+        // that loses all ties.
+        int idx = A.m;
+        coreblas_complex32_t val = 0.0;
+        float amax = 0.0;
+        if (rank == 0) {
+            idx = j;
+            val = a0[j+j*lda0];
+            amax = coreblas_scabs1(val);
+        }
+
+        for (int l = rank; l < A.mt; l += size) {
+            coreblas_complex32_t *al = A(l, 0);
+            int ldal = coreblas_tile_mmain(A, l);
+            int mval = coreblas_tile_mview(A, l);
+
+            int i0 = (l == 0 ? j+1 : 0);
+            float absa;
+            int i = coreblas_icamax_nonan(mval-i0, &al[i0+j*ldal], &absa);
+            if (absa > amax) {
+                amax = absa;
+                val = al[i0+i+j*ldal];
+                idx = A.mb*l+i0+i;
+            }
+        }
+        max_idx[rank] = idx;
+        max_val[rank] = val;
+        coreblas_barrier_wait(barrier, size);
+
+        // max reduction, the first row wins ties as in LAPACK
+        int jp = max_idx[0];
+        coreblas_complex32_t piv = max_val[0];
+        amax = coreblas_scabs1(piv);
+        for (int r = 1; r < size; r++) {
+            float absa = coreblas_scabs1(max_val[r]);
+            if (absa > amax || (absa == amax && max_idx[r] < jp)) {
+                amax = absa;
+                piv = max_val[r];
+                jp = max_idx[r];
+            }
+        }
+
+        if (rank == 0) {
+            ipiv[j] = jp+1;
+
+            // singularity check
+            if (piv == 0.0) {
+                if (*info == 0)
+                    *info = j+1;
+            }
+            else {
+                core_cgetrf_laswp(A, j0, nc, j, 1, ipiv);
+            }
+        }
+        coreblas_barrier_wait(barrier, size);
+
+        if (piv == 0.0)
+            continue;
+
+        //==========================================
+        // column scaling and update (own tiles)
+        //==========================================
+        coreblas_complex32_t scal = 1.0/piv;
+        coreblas_complex32_t zmone = -1.0;
+        int nj = j0+nc-j-1;
+        for (int l = rank; l < A.mt; l += size) {
+            coreblas_complex32_t *al = A(l, 0);
+            int ldal = coreblas_tile_mmain(A, l);
+            int i0 = (l == 0 ? j+1 : 0);
+            int mi = (l == 0 ? mva0 : coreblas_tile_mview(A, l))-i0;
+            if (mi <= 0)
+                continue;
+
+            if (cabsf(piv) >= sfmin) {
+#ifdef COREBLAS_USE_64BIT_BLAS
+                cblas_cscal64_(mi, CBLAS_SADDR(scal), &al[i0+j*ldal], 1);
+#else
+                cblas_cscal(mi, CBLAS_SADDR(scal), &al[i0+j*ldal], 1);
+#endif
+            }
+            else {
+                for (int i = i0; i < i0+mi; i++)
+                    al[i+j*ldal] /= piv;
+            }
+
+            if (nj > 0) {
+#ifdef COREBLAS_USE_64BIT_BLAS
+                cblas_cgeru64_(CblasColMajor,
+                               mi, nj,
+                               CBLAS_SADDR(zmone), &al[i0+j*ldal], 1,
+                                                   &a0[j+(j+1)*lda0], lda0,
+                                                   &al[i0+(j+1)*ldal], ldal);
+#else
+                cblas_cgeru(CblasColMajor,
+                            mi, nj,
+                            CBLAS_SADDR(zmone), &al[i0+j*ldal], 1,
+                                                &a0[j+(j+1)*lda0], lda0,
+                                                &al[i0+(j+1)*ldal], ldal);
+#endif
+            }
+        }
+    }
+}
+
+/******************************************************************************/
+// Recursive factorization of the columns j0:j0+nc of the panel.
+// The left half is factored, its interchanges and L11^{-1} are applied to
+// the top of the right half by rank 0, the rest of the right half is
+// updated with GEMM by every rank on its own tiles, the right half is
+// factored, and its interchanges are applied back to the left half.
+// Besides the leaves, each level takes a single barrier.
+static void core_cgetrf_rec(coreblas_desc_t A, int j0, int nc, int nleaf,
+                            int *ipiv, int rank, int size,
+                            volatile int *max_idx,
+                            volatile coreblas_complex32_t *max_val,
+                            volatile int *info, coreblas_barrier_t *barrier,
+                            float sfmin)
+{
+    if (nc <= nleaf) {
+        core_cgetrf_leaf(A, j0, nc, ipiv, rank, size,
+                         max_idx, max_val, info, barrier, sfmin);
+        return;
+    }
+
+    static coreblas_complex32_t zone  =  1.0;
+    static coreblas_complex32_t zmone = -1.0;
+
+    int n1 = nc/2;
+    int n2 = nc-n1;
+
+    coreblas_complex32_t *a0 = A(0, 0);
+    int lda0 = coreblas_tile_mmain(A, 0);
+    int mva0 = coreblas_tile_mview(A, 0);
+
+    core_cgetrf_rec(A, j0, n1, nleaf, ipiv, rank, size,
+                    max_idx, max_val, info, barrier, sfmin);
+
+    if (rank == 0) {
+        core_cgetrf_laswp(A, j0+n1, n2, j0, n1, ipiv);
+
+        // A12 = L11^{-1} A12
+#ifdef COREBLAS_USE_64BIT_BLAS
+        cblas_ctrsm64_(CblasColMajor,
+                       CblasLeft, CblasLower,
+                       CblasNoTrans, CblasUnit,
+                       n1, n2,
+                       CBLAS_SADDR(zone), &a0[j0+j0*lda0],      lda0,
+                                          &a0[j0+(j0+n1)*lda0], lda0);
+#else
+        cblas_ctrsm(CblasColMajor,
+                    CblasLeft, CblasLower,
+                    CblasNoTrans, CblasUnit,
+                    n1, n2,
+                    CBLAS_SADDR(zone), &a0[j0+j0*lda0],      lda0,
+                                       &a0[j0+(j0+n1)*lda0], lda0);
+#endif
+    }
+    coreblas_barrier_wait(barrier, size);
+
+    // A22 -= A21 A12
+    for (int l = rank; l < A.mt; l += size) {
+        coreblas_complex32_t *al = A(l, 0);
+        int ldal = coreblas_tile_mmain(A, l);
+        int i0 = (l == 0 ? j0+n1 : 0);
+        int mi = (l == 0 ? mva0 : coreblas_tile_mview(A, l))-i0;
+        if (mi <= 0)
+            continue;
+#ifdef COREBLAS_USE_64BIT_BLAS
+        cblas_cgemm64_(CblasColMajor,
+                       CblasNoTrans, CblasNoTrans,
+                       mi, n2, n1,
+                       CBLAS_SADDR(zmone), &al[i0+j0*ldal],      ldal,
+                                           &a0[j0+(j0+n1)*lda0], lda0,
+                       CBLAS_SADDR(zone),  &al[i0+(j0+n1)*ldal], ldal);
+#else
+        cblas_cgemm(CblasColMajor,
+                    CblasNoTrans, CblasNoTrans,
+                    mi, n2, n1,
+                    CBLAS_SADDR(zmone), &al[i0+j0*ldal],      ldal,
+                                        &a0[j0+(j0+n1)*lda0], lda0,
+                    CBLAS_SADDR(zone),  &al[i0+(j0+n1)*ldal], ldal);
+#endif
+    }
+
+    // Every rank only reads its own tiles until the first barrier
+    // of the right half, so no barrier is needed here.
+    core_cgetrf_rec(A, j0+n1, n2, nleaf, ipiv, rank, size,
+                    max_idx, max_val, info, barrier, sfmin);
+
+    // The last barrier of the right half has been passed by every rank,
+    // which from then on only touches the columns j0+n1:j0+nc.
+    if (rank == 0)
+        core_cgetrf_laswp(A, j0, n1, j0+n1, n2, ipiv);
+}
+
+/***************************************************************************//**
+ *
+ * @ingroup core_getrf
+ *
+ *  Computes the LU factorization with partial row pivoting of the tile
+ *  column panel A, using size threads. All threads call the routine with
+ *  the same arguments and their own rank.
+ *
+ *  The panel is factored recursively: the left half of the columns is
+ *  factored, the right half is updated with TRSM and GEMM, and then
+ *  factored itself. Panels of at most min(ib, 8) columns are factored one
+ *  column at a time with level 2 operations, taking two barriers per
+ *  column; each recursion level above takes one more barrier, and the
+ *  bulk of the flops is done in GEMM by every thread on its own tiles.
+ *  Tile l of the panel is owned by the thread of rank l % size.
+ *
+ *******************************************************************************
+ *
+ * @param[in,out] A
+ *         Descriptor of the m-by-n panel, one tile column wide, with n not
+ *         larger than the number of rows of its first tile.
+ *         On exit, the factors L and U; the unit diagonal of L is not stored.
+ *
+ * @param[out] ipiv
+ *         The pivot indices, dimension min(m,n); row i of the panel was
+ *         interchanged with row ipiv[i] (1-based).
+ *
+ * @param[in] ib
+ *         Upper bound on the width of the panels factored one column
+ *         at a time.
+ *
+ * @param[in] rank
+ *         The rank of the calling thread, 0 <= rank < size.
+ *
+ * @param[in] size
+ *         The number of threads.
+ *
+ * @param max_idx
+ *         Workspace shared by the threads, dimension size.
+ *
+ * @param max_val
+ *         Workspace shared by the threads, dimension size.
+ *
+ * @param[in,out] info
+ *         Shared by the threads, zero on entry. On exit, if info = i > 0,
+ *         U(i,i) is exactly zero: the factorization has been completed,
+ *         but U is singular.
+ *
+ * @param barrier
+ *         Barrier of the size threads, see coreblas_barrier_init().
+ *
+ ******************************************************************************/
+__attribute__((weak))
+void coreblas_cgetrf(coreblas_desc_t A, int *ipiv, int ib, int rank, int size,
+                 volatile int *max_idx, volatile coreblas_complex32_t *max_val,
+                 volatile int *info, coreblas_barrier_t *barrier)
+{
+    static coreblas_complex32_t zone = 1.0;
+
+    float sfmin = LAPACKE_slamch_work('S');
+    int minmn = imin(A.m, A.n);
+    int nleaf = imax(1, imin(ib, COREBLAS_GETRF_LEAF));
+
+    core_cgetrf_rec(A, 0, minmn, nleaf, ipiv, rank, size,
+                    max_idx, max_val, info, barrier, sfmin);
+
+    // Columns right of a wide panel.
+    if (rank == 0 && A.n > minmn) {
+        coreblas_complex32_t *a0 = A(0, 0);
+        int lda0 = coreblas_tile_mmain(A, 0);
+
+        core_cgetrf_laswp(A, minmn, A.n-minmn, 0, minmn, ipiv);
+#ifdef COREBLAS_USE_64BIT_BLAS
+        cblas_ctrsm64_(CblasColMajor,
+                       CblasLeft, CblasLower,
+                       CblasNoTrans, CblasUnit,
+                       minmn, A.n-minmn,
+                       CBLAS_SADDR(zone), a0,               lda0,
+                                          &a0[minmn*lda0], lda0);
+#else
+        cblas_ctrsm(CblasColMajor,
+                    CblasLeft, CblasLower,
+                    CblasNoTrans, CblasUnit,
+                    minmn, A.n-minmn,
+                    CBLAS_SADDR(zone), a0,               lda0,
+                                       &a0[minmn*lda0], lda0);
+#endif
+    }
+    coreblas_barrier_wait(barrier, size);
+}
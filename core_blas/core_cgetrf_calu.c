@@ -0,0 +1,366 @@
+/**
+ *
+ * @file
+ *
+ *  COREBLAS is a software package provided by:
+ *  University of Tennessee, US,
+ *  University of Manchester, UK.
+ *
+ * @generated from core_blas/core_zgetrf_calu.c, normal z -> c, Fri Oct 16 03:36:57 2026
+ *
+ **/
+
+#include <coreblas.h>
+#include "core_lapack.h"
+#include "coreblas_barrier.h"
+#include "coreblas_descriptor.h"
+#include "coreblas_internal.h"
+#include "coreblas_types.h"
+
+#include <string.h>
+
+#define A(m, n) (coreblas_complex32_t*)coreblas_tile_addr(A, m, n)
+
+/******************************************************************************/
+// Leading dimension of the per-thread factorization scratch: it holds
+// a whole tile or two stacked candidate sets.
+static inline int core_cgetrf_calu_lds(coreblas_desc_t A)
+{
+    return imax(1, imax(A.mb, 2*A.n));
+}
+
+/******************************************************************************/
+// Factors the m-by-n matrix S with partial pivoting and returns in sel
+// the indices of the first min(m,n) pivot rows, in pivot order.
+// perm is a workspace of m integers.
+static int core_cgetrf_calu_select(int m, int n,
+                                   coreblas_complex32_t *S, int lds,
+                                   int *perm, int *sel)
+{
+    int k = imin(m, n);
+    int *piv = sel;
+
+#ifdef COREBLAS_USE_64BIT_BLAS
+    LAPACKE_cgetrf_work64_(LAPACK_COL_MAJOR, m, n, S, lds, piv);
+#else
+    LAPACKE_cgetrf_work(LAPACK_COL_MAJOR, m, n, S, lds, piv);
+#endif
+
+    for (int i = 0; i < m; i++)
+        perm[i] = i;
+    for (int i = 0; i < k; i++) {
+        int p = piv[i]-1;
+        int tmp = perm[i];
+        perm[i] = perm[p];
+        perm[p] = tmp;
+    }
+    for (int i = 0; i < k; i++)
+        sel[i] = perm[i];
+
+    return k;
+}
+
+/***************************************************************************//**
+ *
+ * @ingroup core_getrf
+ *
+ *  Computes the LU factorization of the tile column panel A with
+ *  tournament pivoting (CALU), using size threads. All threads call the
+ *  routine with the same arguments and their own rank.
+ *
+ *  Every tile of the panel is factored independently with partial
+ *  pivoting by its owner, which selects min(mb,n) candidate pivot rows.
+ *  The candidate sets are then merged pairwise in a binary tree: at each
+ *  level the original values of two sets are stacked and factored with
+ *  partial pivoting and the n best rows are kept. The rows selected at
+ *  the root are moved to the top of the panel and factored without
+ *  pivoting, and the rest of the panel is computed by a triangular solve
+ *  on each tile. This takes ceil(log2(mt)) + 3 barriers in total instead
+ *  of a reduction per column, at the price of about twice the flops of
+ *  partial pivoting. The pivots are not those of partial pivoting, but
+ *  the factorization is stable in practice.
+ *  Tile l of the panel is owned by the thread of rank l % size.
+ *
+ *******************************************************************************
+ *
+ * @param[in,out] A
+ *         Descriptor of the m-by-n panel, one tile column wide, with n not
+ *         larger than the number of rows of its first tile.
+ *         On exit, the factors L and U; the unit diagonal of L is not stored.
+ *
+ * @param[out] ipiv
+ *         The pivot indices, dimension min(m,n); row i of the panel was
+ *         interchanged with row ipiv[i] (1-based), as in coreblas_cgetrf.
+ *
+ * @param[in] rank
+ *         The rank of the calling thread, 0 <= rank < size.
+ *
+ * @param[in] size
+ *         The number of threads.
+ *
+ * @param work
+ *         Workspace shared by the threads, of length
+ *         coreblas_cgetrf_calu_lwork(A, size).
+ *
+ * @param iwork
+ *         Workspace shared by the threads, of length
+ *         coreblas_cgetrf_calu_liwork(A, size).
+ *
+ * @param[in,out] info
+ *         Shared by the threads, zero on entry. On exit, if info = i > 0,
+ *         U(i,i) is exactly zero: the factorization has been completed,
+ *         but U is singular.
+ *
+ * @param barrier
+ *         Barrier of the size threads, see coreblas_barrier_init().
+ *
+ ******************************************************************************/
+__attribute__((weak))
+void coreblas_cgetrf_calu(coreblas_desc_t A, int *ipiv, int rank, int size,
+                          coreblas_complex32_t *work, int *iwork,
+                          volatile int *info, coreblas_barrier_t *barrier)
+{
+    static coreblas_complex32_t zone  =  1.0;
+    static coreblas_complex32_t zmone = -1.0;
+
+    int n = A.n;
+    int minmn = imin(A.m, A.n);
+    int lds = core_cgetrf_calu_lds(A);
+
+    // Candidate sets of the tiles: n rows of length n and their indices.
+    coreblas_complex32_t *C = work;
+    int *G = iwork;
+    // Scratch of this rank: factorization, new candidate set, indices.
+    coreblas_complex32_t *S = &work[(size_t)A.mt*n*n
+                                    + (size_t)rank*(lds+n)*n];
+    coreblas_complex32_t *R = &S[(size_t)lds*n];
+    int *perm = &iwork[(size_t)A.mt*n + (size_t)rank*(lds+n)];
+    int *sel  = &perm[lds];
+
+    //=======================================
+    // candidate rows of each tile (owners)
+    //=======================================
+    for (int l = rank; l < A.mt; l += size) {
+        coreblas_complex32_t *al = A(l, 0);
+        int ldal = coreblas_tile_mmain(A, l);
+        int mval = coreblas_tile_mview(A, l);
+        coreblas_complex32_t *Cl = &C[(size_t)l*n*n];
+
+        for (int j = 0; j < n; j++)
+            memcpy(&S[(size_t)lds*j], &al[(size_t)ldal*j],
+                   mval*sizeof(coreblas_complex32_t));
+
+        int k = core_cgetrf_calu_select(mval, n, S, lds, perm, sel);
+        for (int i = 0; i < k; i++) {
+            for (int j = 0; j < n; j++)
+                Cl[i+n*j] = al[sel[i]+ldal*j];
+            G[l*n+i] = A.mb*l+sel[i];
+        }
+    }
+
+    //======================
+    // tournament (tree)
+    //======================
+    for (int s = 1; s < A.mt; s *= 2) {
+        coreblas_barrier_wait(barrier, size);
+
+        for (int l = 2*s*rank; l+s < A.mt; l += 2*s*size) {
+            int r = l+s;
+            int k1 = imin(n, imin(A.m-A.mb*l, A.mb*s));
+            int k2 = imin(n, imin(A.m-A.mb*r, A.mb*s));
+            coreblas_complex32_t *Cl = &C[(size_t)l*n*n];
+            coreblas_complex32_t *Cr = &C[(size_t)r*n*n];
+
+            for (int j = 0; j < n; j++) {
+                memcpy(&S[(size_t)lds*j],    &Cl[(size_t)n*j],
+                       k1*sizeof(coreblas_complex32_t));
+                memcpy(&S[(size_t)lds*j+k1], &Cr[(size_t)n*j],
+                       k2*sizeof(coreblas_complex32_t));
+            }
+
+            int k = core_cgetrf_calu_select(k1+k2, n, S, lds, perm, sel);
+            for (int i = 0; i < k; i++) {
+                int p = sel[i];
+                for (int j = 0; j < n; j++)
+                    R[i+n*j] = p < k1 ? Cl[p+n*j] : Cr[p-k1+n*j];
+                sel[i] = p < k1 ? G[l*n+p] : G[r*n+p-k1];
+            }
+            for (int j = 0; j < n; j++)
+                memcpy(&Cl[(size_t)n*j], &R[(size_t)n*j],
+                       k*sizeof(coreblas_complex32_t));
+            memcpy(&G[l*n], sel, k*sizeof(int));
+        }
+    }
+    coreblas_barrier_wait(barrier, size);
+
+    //=========================================
+    // pivoting and factorization of the top
+    //=========================================
+    coreblas_complex32_t *a0 = A(0, 0);
+    int lda0 = coreblas_tile_mmain(A, 0);
+    int mva0 = coreblas_tile_mview(A, 0);
+
+    if (rank == 0) {
+        // Express the selected rows G[0:minmn] as a sequence of
+        // interchanges: the row selected i-th has been moved by the
+        // interchanges 0:i and is now at position ipiv[i]-1.
+        for (int i = 0; i < minmn; i++) {
+            int p = G[i];
+            for (int j = 0; j < i; j++) {
+                if (p == j)
+                    p = ipiv[j]-1;
+                else if (p == ipiv[j]-1)
+                    p = j;
+            }
+            ipiv[i] = p+1;
+        }
+
+        for (int i = 0; i < minmn; i++) {
+            int p = ipiv[i]-1;
+            if (p != i) {
+                coreblas_complex32_t *ap = A(p/A.mb, 0);
+                int ldap = coreblas_tile_mmain(A, p/A.mb);
+#ifdef COREBLAS_USE_64BIT_BLAS
+                cblas_cswap64_(n, &a0[i], lda0, &ap[p%A.mb], ldap);
+#else
+                cblas_cswap(n, &a0[i], lda0, &ap[p%A.mb], ldap);
+#endif
+            }
+        }
+
+        // LU without pivoting of the top minmn-by-n block.
+        for (int j = 0; j < minmn; j++) {
+            coreblas_complex32_t piv = a0[j+lda0*j];
+            if (piv == 0.0) {
+                if (*info == 0)
+                    *info = j+1;
+                continue;
+            }
+            coreblas_complex32_t scal = 1.0/piv;
+#ifdef COREBLAS_USE_64BIT_BLAS
+            cblas_cscal64_(minmn-j-1, CBLAS_SADDR(scal), &a0[j+1+lda0*j], 1);
+            cblas_cgeru64_(CblasColMajor,
+                           minmn-j-1, n-j-1,
+                           CBLAS_SADDR(zmone), &a0[j+1+lda0*j],     1,
+                                               &a0[j+lda0*(j+1)],   lda0,
+                                               &a0[j+1+lda0*(j+1)], lda0);
+#else
+            cblas_cscal(minmn-j-1, CBLAS_SADDR(scal), &a0[j+1+lda0*j], 1);
+            cblas_cgeru(CblasColMajor,
+                        minmn-j-1, n-j-1,
+                        CBLAS_SADDR(zmone), &a0[j+1+lda0*j],     1,
+                                            &a0[j+lda0*(j+1)],   lda0,
+                                            &a0[j+1+lda0*(j+1)], lda0);
+#endif
+        }
+    }
+    coreblas_barrier_wait(barrier, size);
+
+    //=================================
+    // L21 = A21 U11^{-1} (own tiles)
+    //=================================
+    for (int l = rank; l < A.mt; l += size) {
+        coreblas_complex32_t *al = A(l, 0);
+        int ldal = coreblas_tile_mmain(A, l);
+        int i0 = (l == 0 ? minmn : 0);
+        int mi = (l == 0 ? mva0 : coreblas_tile_mview(A, l))-i0;
+        if (mi <= 0)
+            continue;
+
+        if (*info == 0) {
+#ifdef COREBLAS_USE_64BIT_BLAS
+            cblas_ctrsm64_(CblasColMajor,
+                           CblasRight, CblasUpper,
+                           CblasNoTrans, CblasNonUnit,
+                           mi, minmn,
+                           CBLAS_SADDR(zone), a0,       lda0,
+                                              &al[i0], ldal);
+#else
+            cblas_ctrsm(CblasColMajor,
+                        CblasRight, CblasUpper,
+                        CblasNoTrans, CblasNonUnit,
+                        mi, minmn,
+                        CBLAS_SADDR(zone), a0,       lda0,
+                                           &al[i0], ldal);
+#endif
+        }
+        else {
+            // Singular U: columns with a zero pivot are left unscaled.
+            for (int j = 0; j < minmn; j++) {
+                coreblas_complex32_t piv = a0[j+lda0*j];
+                if (piv != 0.0) {
+                    coreblas_complex32_t scal = 1.0/piv;
+#ifdef COREBLAS_USE_64BIT_BLAS
+                    cblas_cscal64_(mi, CBLAS_SADDR(scal), &al[i0+ldal*j], 1);
+#else
+                    cblas_cscal(mi, CBLAS_SADDR(scal), &al[i0+ldal*j], 1);
+#endif
+                }
+#ifdef COREBLAS_USE_64BIT_BLAS
+                cblas_cgeru64_(CblasColMajor,
+                               mi, minmn-j-1,
+                               CBLAS_SADDR(zmone), &al[i0+ldal*j],     1,
+                                                   &a0[j+lda0*(j+1)],  lda0,
+                                                   &al[i0+ldal*(j+1)], ldal);
+#else
+                cblas_cgeru(CblasColMajor,
+                            mi, minmn-j-1,
+                            CBLAS_SADDR(zmone), &al[i0+ldal*j],     1,
+                                                &a0[j+lda0*(j+1)],  lda0,
+                                                &al[i0+ldal*(j+1)], ldal);
+#endif
+            }
+        }
+    }
+    coreblas_barrier_wait(barrier, size);
+}
+
+/***************************************************************************//**
+ *
+ * @ingroup core_getrf
+ *
+ *  Returns the minimum length of the array work of coreblas_cgetrf_calu.
+ *
+ *******************************************************************************
+ *
+ * @param[in] A
+ *         Descriptor of the panel.
+ *
+ * @param[in] size
+ *         The number of threads.
+ *
+ *******************************************************************************
+ *
+ * @retval the length of work, at least 1.
+ *
+ ******************************************************************************/
+size_t coreblas_cgetrf_calu_lwork(coreblas_desc_t A, int size)
+{
+    size_t lds = core_cgetrf_calu_lds(A);
+    return imax(1, A.n)*((size_t)A.mt*A.n + (size_t)size*(lds+A.n));
+}
+
+/***************************************************************************//**
+ *
+ * @ingroup core_getrf
+ *
+ *  Returns the minimum length of the array iwork of coreblas_cgetrf_calu.
+ *
+ *******************************************************************************
+ *
+ * @param[in] A
+ *         Descriptor of the panel.
+ *
+ * @param[in] size
+ *         The number of threads.
+ *
+ *******************************************************************************
+ *
+ * @retval the length of iwork, at least 1.
+ *
+ ******************************************************************************/
+size_t coreblas_cgetrf_calu_liwork(coreblas_desc_t A, int size)
+{
+    size_t lds = core_cgetrf_calu_lds(A);
+    return imax(1, A.mt*A.n) + (size_t)size*(lds+A.n);
+}
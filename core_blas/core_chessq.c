@@ -0,0 +1,55 @@
+/**
+ *
+ * @file
+ *
+ *  COREBLAS is a software package provided by:
+ *  University of Tennessee, US,
+ *  University of Manchester, UK.
+ *
+ * @generated from core_blas/core_zhessq.c, normal z -> c, Fri Oct 16 03:36:59 2026
+ *
+ **/
+
+#include <coreblas.h>
+#include "coreblas_types.h"
+#include "coreblas_internal.h"
+#include "core_lapack.h"
+
+#include <math.h>
+
+/******************************************************************************/
+__attribute__((weak))
+void coreblas_chessq(coreblas_enum_t uplo,
+                 int n,
+                 const coreblas_complex32_t *A, int lda,
+                 float *scale, float *sumsq)
+{
+    *scale = 0.0;
+    *sumsq = 1.0;
+
+    // The off-diagonal part is accumulated in one pass and counted twice.
+    float acc[3] = {0.0, 0.0, 0.0};
+    if (uplo == CoreBlasUpper) {
+        for (int j = 1; j < n; j++)
+            coreblas_cssq_update(j, &A[lda*j], acc);
+    }
+    else { // CoreBlasLower
+        for (int j = 0; j < n-1; j++)
+            coreblas_cssq_update(n-j-1, &A[lda*j+j+1], acc);
+    }
+    coreblas_cssq_finish(acc, scale, sumsq);
+    *sumsq *= 2.0;
+    for (int i = 0; i < n; i++) {
+        // diagonal is real, ignore imaginary part
+        if (creal(A[lda*i+i]) != 0.0) { // != propagates nan
+            float absa = fabsf(creal(A[lda*i+i]));
+            if (*scale < absa) {
+                *sumsq = 1.0 + *sumsq*((*scale/absa)*(*scale/absa));
+                *scale = absa;
+            }
+            else {
+                *sumsq = *sumsq + ((absa/(*scale))*(absa/(*scale)));
+            }
+        }
+    }
+}
\ No newline at end of file
@@ -11,14 +11,19 @@
  **/
 
 #include <coreblas.h>
-#include "core_lapack.h"
 #include "coreblas_types.h"
 
+// This will be swapped during the automatic code generation.
+#undef REAL
+#define COMPLEX
+
 /***************************************************************************//**
  *
  * @ingroup core_lag2
  *
  *  Converts m-by-n matrix A from single complex to double complex precision.
+ *  Every column is converted in one vectorized pass, the real and imaginary
+ *  parts as one real array.
  *
  *******************************************************************************
  *
@@ -50,9 +55,16 @@ void coreblas_clag2z(int m, int n,
                  coreblas_complex32_t *As, int ldas,
                  coreblas_complex64_t *A,  int lda)
 {
-#ifdef COREBLAS_USE_64BIT_BLAS
-    LAPACKE_clag2z64_(LAPACK_COL_MAJOR, m, n, As, ldas, A, lda);
+#ifdef COMPLEX
+    int mr = 2*m;
 #else
-    LAPACKE_clag2z_work(LAPACK_COL_MAJOR, m, n, As, ldas, A, lda);
+    int mr = m;
 #endif
+    for (int j = 0; j < n; j++) {
+        const float *as = (const float*)&As[(size_t)ldas*j];
+        double *a = (double*)&A[(size_t)lda*j];
+        #pragma omp simd
+        for (int i = 0; i < mr; i++)
+            a[i] = as[i];
+    }
 }
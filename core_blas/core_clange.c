@@ -0,0 +1,116 @@
+/**
+ *
+ * @file
+ *
+ *  COREBLAS is a software package provided by:
+ *  University of Tennessee, US,
+ *  University of Manchester, UK.
+ *
+ * @generated from core_blas/core_zlange.c, normal z -> c, Fri Oct 16 03:37:00 2026
+ *
+ **/
+
+#include <coreblas.h>
+#include "coreblas_types.h"
+#include "coreblas_internal.h"
+#include "core_lapack.h"
+
+#include <math.h>
+
+/***************************************************************************//**
+ *
+ * @ingroup core_lange
+ *
+ *  Calculates max, one, infinity or Frobenius norm of a given matrix.
+ *
+ *******************************************************************************
+ *
+ * @param[in] norm
+ *          - CoreBlasMaxNorm: Max norm
+ *          - CoreBlasOneNorm: One norm
+ *          - CoreBlasInfNorm: Infinity norm
+ *          - CoreBlasFrobeniusNorm: Frobenius norm
+ *
+ * @param[in] m
+ *          The number of rows of the matrix A. m >= 0. When m = 0,
+ *          the returned value is set to zero.
+ *
+ * @param[in] n
+ *          The number of columns of the matrix A. n >= 0. When n = 0,
+ *          the returned value is set to zero.
+ *
+ * @param[in] A
+ *          The m-by-n matrix A.
+ *
+ * @param[in] lda
+ *          The leading dimension of the array A. lda >= max(1,m).
+ *
+ * @param[in] work
+ *          The auxiliary work array.
+ *
+ * @param[out] value
+ *          The specified norm of the given matrix A
+ *
+ ******************************************************************************/
+__attribute__((weak))
+void coreblas_clange(coreblas_enum_t norm, int m, int n,
+                 const coreblas_complex32_t *A, int lda,
+                 float *work, float *value)
+{
+    #ifdef COREBLAS_USE_64BIT_BLAS
+        *value = LAPACKE_clange64_(LAPACK_COL_MAJOR,
+                                 lapack_const(norm),
+                                 m, n, A, lda);
+    #else
+        *value = LAPACKE_clange_work(LAPACK_COL_MAJOR,
+                                 lapack_const(norm),
+                                 m, n, A, lda, work);
+    #endif
+
+}
+/******************************************************************************/
+void coreblas_clange_aux(coreblas_enum_t norm, int m, int n,
+                         const coreblas_complex32_t *A, int lda,
+                         float *value)
+{
+    switch (norm) {
+    case CoreBlasOneNorm:
+        for (int j = 0; j < n; j++)
+            value[j] = coreblas_cabsum(m, &A[lda*j], NULL);
+        break;
+    case CoreBlasInfNorm:
+        for (int i = 0; i < m; i++)
+            value[i] = 0.0;
+        for (int j = 0; j < n; j++)
+            coreblas_cabsum_add(m, &A[lda*j], value);
+        break;
+    }
+}
+
+/***************************************************************************//**
+ *
+ * @ingroup core_lange
+ *
+ *  Returns the minimum length of the array work of coreblas_clange
+ *  for the given dimensions, in elements of type float.
+ *
+ *******************************************************************************
+ *
+ * @param[in] norm
+ *         The norm to compute.
+ *
+ * @param[in] m
+ *         The number of rows of the matrix A.
+ *
+ * @param[in] n
+ *         The number of columns of the matrix A.
+ *
+ *******************************************************************************
+ *
+ * @retval the length of work, at least 1.
+ *
+ ******************************************************************************/
+size_t coreblas_clange_lwork(coreblas_enum_t norm, int m, int n)
+{
+    return norm == CoreBlasInfNorm ? imax(1, m) : 1;
+}
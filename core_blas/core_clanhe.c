@@ -0,0 +1,94 @@
+/**
+ *
+ * @file
+ *
+ *  COREBLAS is a software package provided by:
+ *  University of Tennessee, US,
+ *  University of Manchester, UK.
+ *
+ * @generated from core_blas/core_zlanhe.c, normal z -> c, Fri Oct 16 03:37:00 2026
+ *
+ **/
+
+#include <coreblas.h>
+#include "coreblas_types.h"
+#include "coreblas_internal.h"
+#include "core_lapack.h"
+
+#include <math.h>
+
+/******************************************************************************/
+__attribute__((weak))
+void coreblas_clanhe(coreblas_enum_t norm, coreblas_enum_t uplo,
+                 int n,
+                 const coreblas_complex32_t *A, int lda,
+                 float *work, float *value)
+{
+    #ifdef COREBLAS_USE_64BIT_BLAS
+        *value = LAPACKE_clanhe64_(LAPACK_COL_MAJOR,
+                                 lapack_const(norm),
+                                 lapack_const(uplo),
+                                 n, A, lda);
+    #else
+        *value = LAPACKE_clanhe_work(LAPACK_COL_MAJOR,
+                                 lapack_const(norm),
+                                 lapack_const(uplo),
+                                 n, A, lda, work);
+    #endif
+
+}
+
+/******************************************************************************/
+void coreblas_clanhe_aux(coreblas_enum_t norm, coreblas_enum_t uplo,
+                         int n,
+                         const coreblas_complex32_t *A, int lda,
+                         float *value)
+{
+    switch (norm) {
+    case CoreBlasOneNorm:
+    case CoreBlasInfNorm:
+        // The elements off the diagonal count in their row and column.
+        for (int i = 0; i < n; i++)
+            value[i] = 0.0;
+        if (uplo == CoreBlasUpper) {
+            for (int j = 0; j < n; j++) {
+                value[j] += coreblas_cabsum(j, &A[lda*j], value);
+                value[j] += fabsf(creal(A[lda*j+j]));
+            }
+        }
+        else { // CoreBlasLower
+            for (int j = 0; j < n; j++) {
+                value[j] += fabsf(creal(A[lda*j+j]));
+                value[j] += coreblas_cabsum(n-j-1, &A[lda*j+j+1],
+                                            &value[j+1]);
+            }
+        }
+        break;
+    }
+}
+
+/***************************************************************************//**
+ *
+ * @ingroup core_lanhe
+ *
+ *  Returns the minimum length of the array work of coreblas_clanhe
+ *  for the given dimensions, in elements of type float.
+ *
+ *******************************************************************************
+ *
+ * @param[in] norm
+ *         The norm to compute.
+ *
+ * @param[in] n
+ *         The order of the matrix A.
+ *
+ *******************************************************************************
+ *
+ * @retval the length of work, at least 1.
+ *
+ ******************************************************************************/
+size_t coreblas_clanhe_lwork(coreblas_enum_t norm, int n)
+{
+    return (norm == CoreBlasOneNorm || norm == CoreBlasInfNorm) ?
+           imax(1, n) : 1;
+}
@@ -0,0 +1,154 @@
+/**
+ *
+ * @file
+ *
+ *  COREBLAS is a software package provided by:
+ *  University of Tennessee, US,
+ *  University of Manchester, UK.
+ *
+ * @generated from core_blas/core_zlantr.c, normal z -> c, Fri Oct 16 03:37:00 2026
+ *
+ **/
+
+#include <coreblas.h>
+#include "coreblas_types.h"
+#include "coreblas_internal.h"
+#include "core_lapack.h"
+
+#include <math.h>
+
+/******************************************************************************/
+__attribute__((weak))
+void coreblas_clantr(coreblas_enum_t norm, coreblas_enum_t uplo, coreblas_enum_t diag,
+                 int m, int n,
+                 const coreblas_complex32_t *A, int lda,
+                 float *work, float *value)
+{
+    // Due to a bug in LAPACKE < 3.6.1, this function always returns zero.
+    // *value = LAPACKE_clantr_work(LAPACK_COL_MAJOR,
+    //                              lapack_const(norm), lapack_const(uplo),
+    //                              lapack_const(diag),
+    //                              m, n, A, lda, work);
+
+    // Calling LAPACK directly instead.
+    char nrm = lapack_const(norm);
+    char upl = lapack_const(uplo);
+    char dia = lapack_const(diag);
+    
+    #ifdef COREBLAS_USE_64BIT_BLAS
+        *value = LAPACK_clantr64_(&nrm, &upl, &dia, &m, &n, A, &lda, work);
+    #else
+        *value = LAPACK_clantr(&nrm, &upl, &dia, &m, &n, A, &lda, work);
+
+    #endif
+}
+
+/******************************************************************************/
+void coreblas_clantr_aux(coreblas_enum_t norm, coreblas_enum_t uplo,
+                         coreblas_enum_t diag,
+                         int m, int n,
+                         const coreblas_complex32_t *A, int lda,
+                         float *value)
+{
+    switch (norm) {
+    case CoreBlasOneNorm:
+        if (uplo == CoreBlasUpper) {
+            if (diag == CoreBlasNonUnit) {
+                for (int j = 0; j < n; j++)
+                    value[j] = coreblas_cabsum(imin(j+1, m), &A[lda*j], NULL);
+            }
+            else { // CoreBlasUnit
+                int j;
+                for (j = 0; j < imin(n, m); j++)
+                    value[j] = 1.0 + coreblas_cabsum(j, &A[lda*j], NULL);
+                for (; j < n; j++)
+                    value[j] = coreblas_cabsum(m, &A[lda*j], NULL);
+            }
+        }
+        else { // CoreBlasLower
+            if (diag == CoreBlasNonUnit) {
+                int j;
+                for (j = 0; j < imin(n, m); j++)
+                    value[j] = coreblas_cabsum(m-j, &A[lda*j+j], NULL);
+                for (; j < n; j++)
+                    value[j] = 0.0;
+            }
+            else { // CoreBlasUnit
+                int j;
+                for (j = 0; j < imin(n, m); j++)
+                    value[j] = 1.0 + coreblas_cabsum(m-j-1, &A[lda*j+j+1],
+                                                     NULL);
+                for (; j < n; j++)
+                    value[j] = 0.0;
+            }
+        }
+        break;
+    case CoreBlasInfNorm:
+        if (uplo == CoreBlasUpper) {
+            if (diag == CoreBlasNonUnit) {
+                for (int i = 0; i < m; i++)
+                    value[i] = 0.0;
+                for (int j = 0; j < n; j++)
+                    coreblas_cabsum_add(imin(j+1, m), &A[lda*j], value);
+            }
+            else { // CoreBlasUnit
+                int i;
+                for (i = 0; i < imin(m, n); i++)
+                    value[i] = 1.0;
+                for (; i < m; i++)
+                    value[i] = 0.0;
+                int j;
+                for (j = 0; j < imin(n, m); j++)
+                    coreblas_cabsum_add(j, &A[lda*j], value);
+                for (; j < n; j++)
+                    coreblas_cabsum_add(m, &A[lda*j], value);
+            }
+        }
+        else { // CoreBlasLower
+            if (diag == CoreBlasNonUnit) {
+                for (int i = 0; i < m; i++)
+                    value[i] = 0.0;
+                for (int j = 0; j < imin(n, m); j++)
+                    coreblas_cabsum_add(m-j, &A[lda*j+j], &value[j]);
+            }
+            else { // CoreBlasUnit
+                int i;
+                for (i = 0; i < imin(m, n); i++)
+                    value[i] = 1.0;
+                for (; i < m; i++)
+                    value[i] = 0.0;
+                for (int j = 0; j < imin(n, m); j++)
+                    coreblas_cabsum_add(m-j-1, &A[lda*j+j+1], &value[j+1]);
+            }
+        }
+        break;
+    }
+}
+
+/***************************************************************************//**
+ *
+ * @ingroup core_lantr
+ *
+ *  Returns the minimum length of the array work of coreblas_clantr
+ *  for the given dimensions, in elements of type float.
+ *
+ *******************************************************************************
+ *
+ * @param[in] norm
+ *         The norm to compute.
+ *
+ * @param[in] m
+ *         The number of rows of the matrix A.
+ *
+ * @param[in] n
+ *         The number of columns of the matrix A.
+ *
+ *******************************************************************************
+ *
+ * @retval the length of work, at least 1.
+ *
+ ******************************************************************************/
+size_t coreblas_clantr_lwork(coreblas_enum_t norm, int m, int n)
+{
+    return norm == CoreBlasInfNorm ? imax(1, m) : 1;
+}
@@ -0,0 +1,371 @@
+/**
+ *
+ * @file
+ *
+ *  COREBLAS is a software package provided by:
+ *  University of Tennessee, US,
+ *  University of Manchester, UK.
+ *
+ * @generated from core_blas/core_ztsmqr_batched.c, normal z -> c, Fri Oct 16 03:36:56 2026
+ *
+ **/
+
+#include <coreblas.h>
+#include "coreblas_types.h"
+#include "coreblas_internal.h"
+#include "coreblas_workspace.h"
+
+#ifdef _OPENMP
+#include <omp.h>
+#endif
+
+/***************************************************************************//**
+ *
+ * @ingroup core_tsmqr
+ *
+ *  Applies, as coreblas_ctsmqr, the unitary matrices Q_i returned by
+ *  coreblas_ctsqrt to a batch of independent pairs of tiles A1_i and A2_i
+ *  of the same dimensions given by arrays of pointers.
+ *
+ *  The arguments are checked once for the whole batch and the pairs are
+ *  distributed statically among the threads of an OpenMP parallel region
+ *  of work->nthread threads; thread i uses work->spaces[i] as the work
+ *  array of coreblas_ctsmqr, with ldwork = ib on the left and ldwork = m1
+ *  on the right. A sequential BLAS should be used.
+ *
+ *******************************************************************************
+ *
+ * @param[in] side
+ *         - CoreBlasLeft  : apply Q_i or Q_i^H from the Left;
+ *         - CoreBlasRight : apply Q_i or Q_i^H from the Right.
+ *
+ * @param[in] trans
+ *         - CoreBlasNoTrans    : Apply Q_i;
+ *         - CoreBlas_ConjTrans : Apply Q_i^H.
+ *
+ * @param[in] m1
+ * @param[in] n1
+ * @param[in] m2
+ * @param[in] n2
+ * @param[in] k
+ * @param[in] ib
+ *         The dimensions, common to the batch, as in coreblas_ctsmqr.
+ *
+ * @param[in,out] A1
+ *         Array of batch pointers to the m1-by-n1 tiles A1_i.
+ *
+ * @param[in] lda1
+ *         The leading dimension of the tiles A1_i. lda1 >= max(1,m1).
+ *
+ * @param[in,out] A2
+ *         Array of batch pointers to the m2-by-n2 tiles A2_i.
+ *
+ * @param[in] lda2
+ *         The leading dimension of the tiles A2_i. lda2 >= max(1,m2).
+ *
+ * @param[in] V
+ *         Array of batch pointers to the reflectors V_i. The same
+ *         reflectors may be given for several pairs.
+ *
+ * @param[in] ldv
+ *         The leading dimension of the arrays V_i.
+ *         ldv >= max(1,m2) if side == CoreBlasLeft,
+ *         ldv >= max(1,n2) if side == CoreBlasRight.
+ *
+ * @param[in] T
+ *         Array of batch pointers to the ib-by-k triangular factors T_i.
+ *
+ * @param[in] ldt
+ *         The leading dimension of the arrays T_i. ldt >= ib.
+ *
+ * @param work
+ *         Per-thread workspace of type CoreBlasComplexFloat, with spaces
+ *         of at least coreblas_ctsmqr_lwork(side, m1, n1, ib) elements.
+ *
+ * @param[in] batch
+ *         The number of pairs. batch >= 0.
+ *
+ *******************************************************************************
+ *
+ * @retval CoreBlasSuccess successful exit
+ * @retval < 0 if -i, the i-th argument had an illegal value
+ *
+ ******************************************************************************/
+__attribute__((weak))
+int coreblas_ctsmqr_batched(coreblas_enum_t side, coreblas_enum_t trans,
+                int m1, int n1, int m2, int n2, int k, int ib,
+                coreblas_complex32_t * const *A1, int lda1,
+                coreblas_complex32_t * const *A2, int lda2,
+                const coreblas_complex32_t * const *V, int ldv,
+                const coreblas_complex32_t * const *T, int ldt,
+                coreblas_workspace_t *work, int batch)
+{
+#ifndef COREBLAS_UNCHECKED
+    // Check input arguments.
+    if (side != CoreBlasLeft && side != CoreBlasRight) {
+        coreblas_error("illegal value of side");
+        return -1;
+    }
+    if (trans != CoreBlasNoTrans && trans != CoreBlas_ConjTrans) {
+        coreblas_error("illegal value of trans");
+        return -2;
+    }
+    if (m1 < 0) {
+        coreblas_error("illegal value of m1");
+        return -3;
+    }
+    if (n1 < 0) {
+        coreblas_error("illegal value of n1");
+        return -4;
+    }
+    if (m2 < 0 || (m2 != m1 && side == CoreBlasRight)) {
+        coreblas_error("illegal value of m2");
+        return -5;
+    }
+    if (n2 < 0 || (n2 != n1 && side == CoreBlasLeft)) {
+        coreblas_error("illegal value of n2");
+        return -6;
+    }
+    if (k < 0 ||
+        (side == CoreBlasLeft  && k > m1) ||
+        (side == CoreBlasRight && k > n1)) {
+        coreblas_error("illegal value of k");
+        return -7;
+    }
+    if (ib < 0) {
+        coreblas_error("illegal value of ib");
+        return -8;
+    }
+    if (batch > 0 && A1 == NULL) {
+        coreblas_error("NULL A1");
+        return -9;
+    }
+    if (lda1 < imax(1, m1)) {
+        coreblas_error("illegal value of lda1");
+        return -10;
+    }
+    if (batch > 0 && A2 == NULL) {
+        coreblas_error("NULL A2");
+        return -11;
+    }
+    if (lda2 < imax(1, m2)) {
+        coreblas_error("illegal value of lda2");
+        return -12;
+    }
+    if (batch > 0 && V == NULL) {
+        coreblas_error("NULL V");
+        return -13;
+    }
+    if (ldv < imax(1, side == CoreBlasLeft ? m2 : n2)) {
+        coreblas_error("illegal value of ldv");
+        return -14;
+    }
+    if (batch > 0 && T == NULL) {
+        coreblas_error("NULL T");
+        return -15;
+    }
+    if (ldt < imax(1, ib)) {
+        coreblas_error("illegal value of ldt");
+        return -16;
+    }
+    if (work == NULL || work->spaces == NULL ||
+        work->dtyp != CoreBlasComplexFloat ||
+        work->lworkspace < coreblas_ctsmqr_lwork(side, m1, n1, ib)) {
+        coreblas_error("illegal value of work");
+        return -17;
+    }
+    if (batch < 0) {
+        coreblas_error("illegal value of batch");
+        return -18;
+    }
+#endif
+
+    // quick return
+    if (batch == 0)
+        return CoreBlasSuccess;
+
+    int ldwork = side == CoreBlasLeft ? imax(1, ib) : imax(1, m1);
+    int info = CoreBlasSuccess;
+    #pragma omp parallel num_threads(work->nthread)
+    {
+        int tid = 0;
+#ifdef _OPENMP
+        tid = omp_get_thread_num();
+#endif
+        coreblas_complex32_t *w = (coreblas_complex32_t*)work->spaces[tid];
+
+        #pragma omp for schedule(static)
+        for (int i = 0; i < batch; i++) {
+            int iinfo = coreblas_ctsmqr_nocheck(side, trans, m1, n1, m2, n2, k, ib,
+                                                A1[i], lda1, A2[i], lda2,
+                                                V[i], ldv, T[i], ldt,
+                                                w, ldwork);
+            if (iinfo != CoreBlasSuccess) {
+                #pragma omp atomic write
+                info = iinfo;
+            }
+        }
+    }
+    return info;
+}
+
+/***************************************************************************//**
+ *
+ * @ingroup core_tsmqr
+ *
+ *  Performs the same updates as coreblas_ctsmqr_batched on a batch of
+ *  tiles stored at a constant distance from each other: A1_i starts at
+ *  A1 + i*strideA1, A2_i at A2 + i*strideA2, V_i at V + i*strideV and
+ *  T_i at T + i*strideT. strideV = strideT = 0 applies the same Q to
+ *  every pair.
+ *
+ *******************************************************************************
+ *
+ * @param[in] strideA1
+ *         The distance between two consecutive A1_i. strideA1 >= lda1*n1.
+ *
+ * @param[in] strideA2
+ *         The distance between two consecutive A2_i. strideA2 >= lda2*n2.
+ *
+ * @param[in] strideV
+ *         The distance between two consecutive V_i.
+ *
+ * @param[in] strideT
+ *         The distance between two consecutive T_i.
+ *
+ *  The other arguments are those of coreblas_ctsmqr_batched.
+ *
+ *******************************************************************************
+ *
+ * @retval CoreBlasSuccess successful exit
+ * @retval < 0 if -i, the i-th argument had an illegal value
+ *
+ ******************************************************************************/
+__attribute__((weak))
+int coreblas_ctsmqr_batched_strided(coreblas_enum_t side,
+                coreblas_enum_t trans,
+                int m1, int n1, int m2, int n2, int k, int ib,
+                coreblas_complex32_t *A1, int lda1, size_t strideA1,
+                coreblas_complex32_t *A2, int lda2, size_t strideA2,
+                const coreblas_complex32_t *V, int ldv, size_t strideV,
+                const coreblas_complex32_t *T, int ldt, size_t strideT,
+                coreblas_workspace_t *work, int batch)
+{
+#ifndef COREBLAS_UNCHECKED
+    // Check input arguments.
+    if (side != CoreBlasLeft && side != CoreBlasRight) {
+        coreblas_error("illegal value of side");
+        return -1;
+    }
+    if (trans != CoreBlasNoTrans && trans != CoreBlas_ConjTrans) {
+        coreblas_error("illegal value of trans");
+        return -2;
+    }
+    if (m1 < 0) {
+        coreblas_error("illegal value of m1");
+        return -3;
+    }
+    if (n1 < 0) {
+        coreblas_error("illegal value of n1");
+        return -4;
+    }
+    if (m2 < 0 || (m2 != m1 && side == CoreBlasRight)) {
+        coreblas_error("illegal value of m2");
+        return -5;
+    }
+    if (n2 < 0 || (n2 != n1 && side == CoreBlasLeft)) {
+        coreblas_error("illegal value of n2");
+        return -6;
+    }
+    if (k < 0 ||
+        (side == CoreBlasLeft  && k > m1) ||
+        (side == CoreBlasRight && k > n1)) {
+        coreblas_error("illegal value of k");
+        return -7;
+    }
+    if (ib < 0) {
+        coreblas_error("illegal value of ib");
+        return -8;
+    }
+    if (batch > 0 && A1 == NULL) {
+        coreblas_error("NULL A1");
+        return -9;
+    }
+    if (lda1 < imax(1, m1)) {
+        coreblas_error("illegal value of lda1");
+        return -10;
+    }
+    if (batch > 1 && strideA1 < (size_t)lda1*n1) {
+        coreblas_error("illegal value of strideA1");
+        return -11;
+    }
+    if (batch > 0 && A2 == NULL) {
+        coreblas_error("NULL A2");
+        return -12;
+    }
+    if (lda2 < imax(1, m2)) {
+        coreblas_error("illegal value of lda2");
+        return -13;
+    }
+    if (batch > 1 && strideA2 < (size_t)lda2*n2) {
+        coreblas_error("illegal value of strideA2");
+        return -14;
+    }
+    if (batch > 0 && V == NULL) {
+        coreblas_error("NULL V");
+        return -15;
+    }
+    if (ldv < imax(1, side == CoreBlasLeft ? m2 : n2)) {
+        coreblas_error("illegal value of ldv");
+        return -16;
+    }
+    if (batch > 0 && T == NULL) {
+        coreblas_error("NULL T");
+        return -18;
+    }
+    if (ldt < imax(1, ib)) {
+        coreblas_error("illegal value of ldt");
+        return -19;
+    }
+    if (work == NULL || work->spaces == NULL ||
+        work->dtyp != CoreBlasComplexFloat ||
+        work->lworkspace < coreblas_ctsmqr_lwork(side, m1, n1, ib)) {
+        coreblas_error("illegal value of work");
+        return -21;
+    }
+    if (batch < 0) {
+        coreblas_error("illegal value of batch");
+        return -22;
+    }
+#endif
+
+    // quick return
+    if (batch == 0)
+        return CoreBlasSuccess;
+
+    int ldwork = side == CoreBlasLeft ? imax(1, ib) : imax(1, m1);
+    int info = CoreBlasSuccess;
+    #pragma omp parallel num_threads(work->nthread)
+    {
+        int tid = 0;
+#ifdef _OPENMP
+        tid = omp_get_thread_num();
+#endif
+        coreblas_complex32_t *w = (coreblas_complex32_t*)work->spaces[tid];
+
+        #pragma omp for schedule(static)
+        for (int i = 0; i < batch; i++) {
+            int iinfo = coreblas_ctsmqr_nocheck(side, trans, m1, n1, m2, n2, k, ib,
+                                                &A1[strideA1*i], lda1,
+                                                &A2[strideA2*i], lda2,
+                                                &V[strideV*i], ldv,
+                                                &T[strideT*i], ldt,
+                                                w, ldwork);
+            if (iinfo != CoreBlasSuccess) {
+                #pragma omp atomic write
+                info = iinfo;
+            }
+        }
+    }
+    return info;
+}
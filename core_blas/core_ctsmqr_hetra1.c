@@ -0,0 +1,98 @@
+/**
+ *
+ * @file
+ *
+ *  COREBLAS is a software package provided by:
+ *  University of Tennessee, US,
+ *  University of Manchester, UK.
+ *
+ * @generated from core_blas/core_ztsmqr_hetra1.c, normal z -> c, Fri Oct 16 03:37:03 2026
+ *
+ **/
+
+#include <coreblas.h>
+#include "coreblas_types.h"
+#include "coreblas_internal.h"
+
+#undef REAL
+#define COMPLEX
+
+/******************************************************************************/
+// In-place conjugate transposition of the n-by-n tile A.
+static void core_ctsmqr_conjtrans(int n, coreblas_complex32_t *A, int lda)
+{
+    for (int j = 0; j < n; j++) {
+        A[j + (size_t)lda*j] = conjf(A[j + (size_t)lda*j]);
+        for (int i = j+1; i < n; i++) {
+            coreblas_complex32_t a = A[i + (size_t)lda*j];
+            A[i + (size_t)lda*j] = conjf(A[j + (size_t)lda*i]);
+            A[j + (size_t)lda*i] = conjf(a);
+        }
+    }
+}
+
+/***************************************************************************//**
+ *
+ * @ingroup core_tsmqr
+ *
+ *  Applies, as coreblas_ctsmqr, the unitary matrix Q returned by
+ *  coreblas_ctsqrt to the pair of tiles ( A1^H, A2 ), where the square
+ *  tile A1 is stored as its conjugate transpose. In the reduction of a
+ *  Hermitian matrix to band form with the lower triangle stored, A1 is a
+ *  tile below the diagonal standing for the tile of the upper triangle
+ *  that the left update touches.
+ *
+ *  A1 is conjugate transposed in place before and after the update,
+ *  which costs O(m1^2) next to the O(m1^2 k) of the update.
+ *
+ *******************************************************************************
+ *
+ *  The arguments are those of coreblas_ctsmqr, with m1 = n1.
+ *
+ * @param[in,out] A1
+ *         On entry, the conjugate transpose of the m1-by-m1 tile A1.
+ *         On exit, the conjugate transpose of the updated tile.
+ *
+ *******************************************************************************
+ *
+ * @retval CoreBlasSuccess successful exit
+ * @retval < 0 if -i, the i-th argument had an illegal value
+ *
+ ******************************************************************************/
+__attribute__((weak))
+int coreblas_ctsmqr_hetra1(coreblas_enum_t side, coreblas_enum_t trans,
+                int m1, int n1, int m2, int n2, int k, int ib,
+                      coreblas_complex32_t *A1,   int lda1,
+                      coreblas_complex32_t *A2,   int lda2,
+                const coreblas_complex32_t *V,    int ldv,
+                const coreblas_complex32_t *T,    int ldt,
+                      coreblas_complex32_t *work, int ldwork)
+{
+#ifndef COREBLAS_UNCHECKED
+    // Check input arguments; the others are checked by coreblas_ctsmqr.
+    if (m1 < 0) {
+        coreblas_error("illegal value of m1");
+        return -3;
+    }
+    if (n1 != m1) {
+        coreblas_error("illegal value of n1");
+        return -4;
+    }
+    if (A1 == NULL) {
+        coreblas_error("NULL A1");
+        return -9;
+    }
+    if (lda1 < imax(1, m1)) {
+        coreblas_error("illegal value of lda1");
+        return -10;
+    }
+#endif
+
+    core_ctsmqr_conjtrans(m1, A1, lda1);
+    int info = coreblas_ctsmqr(side, trans, m1, n1, m2, n2, k, ib,
+                               A1, lda1, A2, lda2, V, ldv, T, ldt,
+                               work, ldwork);
+    core_ctsmqr_conjtrans(m1, A1, lda1);
+
+    return info;
+}
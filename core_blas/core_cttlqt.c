@@ -0,0 +1,300 @@
+/**
+ *
+ * @file
+ *
+ *  COREBLAS is a software package provided by:
+ *  University of Tennessee, US,
+ *  University of Manchester, UK.
+ *
+ * @generated from core_blas/core_zttlqt.c, normal z -> c, Fri Oct 16 03:37:05 2026
+ *
+ **/
+
+#include <coreblas.h>
+#include "coreblas_types.h"
+#include "coreblas_internal.h"
+#include "core_lapack.h"
+
+
+
+// This will be swapped during the automatic code generation.
+#undef REAL
+#define COMPLEX
+
+/***************************************************************************//**
+ *
+ * @ingroup core_ttlqt
+ *
+ *  Computes an LQ factorization of a rectangular matrix
+ *  formed by coupling side-by-side an m-by-m lower triangular tile A1
+ *  and an m-by-n lower triangular tile A2:
+ *
+ *    | A1 A2 | = L * Q
+ *
+ *
+ *******************************************************************************
+ *
+ * @param[in] m
+ *         The number of rows of the tile A1 and A2. m >= 0.
+ *         The number of columns of the tile A1.
+ *
+ * @param[in] n
+ *         The number of columns of the tile A2. n >= 0.
+ *
+ * @param[in] ib
+ *         The inner-blocking size.  ib >= 0.
+ *
+ * @param[in,out] A1
+ *         On entry, the m-by-m tile A1.
+ *         On exit, the elements on and below the diagonal of the array
+ *         contain the m-by-m lower trapezoidal tile L;
+ *         the elements above the diagonal are not referenced.
+ *
+ * @param[in] lda1
+ *         The leading dimension of the array A1.  lda1 >= max(1,m).
+ *
+ * @param[in,out] A2
+ *         On entry, the m-by-n lower triangular tile A2.
+ *         On exit, the elements on and below the diagonal of the array
+ *         with the matrix T represent
+ *         the unitary tile Q as a product of elementary reflectors.
+ *
+ * @param[in] lda2
+ *         The leading dimension of the array A2.  lda2 >= max(1,m).
+ *
+ * @param[out] T
+ *         The ib-by-m triangular factor T of the block reflector.
+ *         T is upper triangular by block (economic storage);
+ *         The rest of the array is not referenced.
+ *
+ * @param[in] ldt
+ *         The leading dimension of the array T. ldt >= ib.
+ *
+ * @param tau
+ *         Auxiliary workspace array of length m.
+ *
+ * @param work
+ *         Auxiliary workspace array of length ib*m.
+ *
+ *******************************************************************************
+ *
+ * @retval CoreBlasSuccess successful exit
+ * @retval < 0 if -i, the i-th argument had an illegal value
+ *
+ ******************************************************************************/
+__attribute__((weak))
+int coreblas_cttlqt(int m, int n, int ib,
+                coreblas_complex32_t *A1, int lda1,
+                coreblas_complex32_t *A2, int lda2,
+                coreblas_complex32_t *T,  int ldt,
+                coreblas_complex32_t *tau,
+                coreblas_complex32_t *work)
+{
+#ifndef COREBLAS_UNCHECKED
+    // Check input arguments.
+    if (m < 0) {
+        coreblas_error("illegal value of m");
+        return -1;
+    }
+    if (n < 0) {
+        coreblas_error("illegal value of n");
+        return -2;
+    }
+    if (ib < 0) {
+        coreblas_error("illegal value of ib");
+        return -3;
+    }
+    if (A1 == NULL) {
+        coreblas_error("NULL A1");
+        return -4;
+    }
+    if (lda1 < imax(1, m) && m > 0) {
+        coreblas_error("illegal value of lda1");
+        return -5;
+    }
+    if (A2 == NULL) {
+        coreblas_error("NULL A2");
+        return -6;
+    }
+    if (lda2 < imax(1, m) && m > 0) {
+        coreblas_error("illegal value of lda2");
+        return -7;
+    }
+    if (T == NULL) {
+        coreblas_error("NULL T");
+        return -8;
+    }
+    if (ldt < imax(1, ib) && ib > 0) {
+        coreblas_error("illegal value of ldt");
+        return -9;
+    }
+    if (tau == NULL) {
+        coreblas_error("NULL tau");
+        return -10;
+    }
+    if (work == NULL) {
+        coreblas_error("NULL work");
+        return -11;
+    }
+#endif
+
+    // quick return
+    if ((m == 0) || (n == 0) || (ib == 0))
+        return CoreBlasSuccess;
+
+    // TODO: Need to check why some cases require this to avoid
+    // uninitialized values
+    //core_claset(CoreBlasGeneral, ib, m, 0.0, 0.0, T, ldt);
+
+    for (int ii = 0; ii < m; ii += ib) {
+        int sb = imin(m-ii, ib);
+        for (int i = 0; i < sb; i++) {
+            int j  = ii + i;
+            int mi = sb-i-1;
+            int ni = imin( j + 1, n);
+
+            // Generate elementary reflector H(ii*ib+i) to annihilate
+            // A(ii*ib+i, ii*ib+i:m).
+#ifdef COMPLEX
+    #ifdef COREBLAS_USE_64BIT_BLAS
+        LAPACKE_clacgv64_(ni, &A2[j], lda2);
+        LAPACKE_clacgv64_(1, &A1[lda1*j+j], lda1);
+    #else
+        LAPACKE_clacgv_work(ni, &A2[j], lda2);
+        LAPACKE_clacgv_work(1, &A1[lda1*j+j], lda1);
+    #endif
+#endif
+
+#ifdef COREBLAS_USE_64BIT_BLAS
+        LAPACKE_clarfg_work64_(ni+1, &A1[lda1*j+j], &A2[j], lda2, &tau[j]);
+#else
+        LAPACKE_clarfg_work(ni+1, &A1[lda1*j+j], &A2[j], lda2, &tau[j]);
+#endif
+
+            coreblas_complex32_t alpha;
+            if (mi > 0) {
+                // Apply H(j-1) to A(j:ii+ib-1, j-1:m) from the right.
+            #ifdef COREBLAS_USE_64BIT_BLAS
+                cblas_ccopy64_(
+                    mi,
+                    &A1[lda1*j+(j+1)], 1,
+                    work, 1);
+
+                coreblas_complex32_t zone  = 1.0;
+                cblas_cgemv64_(
+                    CblasColMajor, (CBLAS_TRANSPOSE)CoreBlasNoTrans,
+                    mi, ni,
+                    CBLAS_SADDR(zone), &A2[j+1], lda2,
+                    &A2[j], lda2,
+                    CBLAS_SADDR(zone), work, 1);
+
+                alpha = -(tau[j]);
+                cblas_caxpy64_(
+                    mi, CBLAS_SADDR(alpha),
+                    work, 1,
+                    &A1[lda1*j+j+1], 1);
+
+                cblas_cgerc64_(
+                    CblasColMajor, mi, ni,
+                    CBLAS_SADDR(alpha), work, 1,
+                    &A2[j], lda2,
+                    &A2[j+1], lda2);
+            #else
+                cblas_ccopy(
+                    mi,
+                    &A1[lda1*j+(j+1)], 1,
+                    work, 1);
+
+                coreblas_complex32_t zone  = 1.0;
+                cblas_cgemv(
+                    CblasColMajor, (CBLAS_TRANSPOSE)CoreBlasNoTrans,
+                    mi, ni,
+                    CBLAS_SADDR(zone), &A2[j+1], lda2,
+                    &A2[j], lda2,
+                    CBLAS_SADDR(zone), work, 1);
+
+                alpha = -(tau[j]);
+                cblas_caxpy(
+                    mi, CBLAS_SADDR(alpha),
+                    work, 1,
+                    &A1[lda1*j+j+1], 1);
+
+                cblas_cgerc(
+                    CblasColMajor, mi, ni,
+                    CBLAS_SADDR(alpha), work, 1,
+                    &A2[j], lda2,
+                    &A2[j+1], lda2);
+            #endif
+
+            }
+
+#ifdef COMPLEX
+#ifdef COREBLAS_USE_64BIT_BLAS
+    LAPACKE_clacgv64_(ni, &A2[j], lda2 );
+    LAPACKE_clacgv64_(1, &A1[lda1*j+j], lda1 );
+#else
+    LAPACKE_clacgv_work(ni, &A2[j], lda2 );
+    LAPACKE_clacgv_work(1, &A1[lda1*j+j], lda1 );
+#endif
+
+#endif
+        }
+
+        // The reflectors of the block have ni columns, the last l of
+        // which form the lower trapezoid of A2.
+        int ni = imin(ii+sb, n);
+        int l  = imin(sb, imax(0, ni-ii));
+
+        // Calculate T.
+        coreblas_clarft_pent(CoreBlasRowwise, ni, sb, l,
+                             &A2[ii], lda2,
+                             &tau[ii],
+                             &T[ldt*ii], ldt);
+
+        // Apply Q to the rest of the matrix to the right.
+        if (m > ii+sb) {
+            int mi = m-(ii+sb);
+
+                coreblas_cparfb_nocheck(
+                    CoreBlasRight, CoreBlasNoTrans,
+                    CoreBlasForward, CoreBlasRowwise,
+                    mi, ib, mi, ni, sb, l,
+                    &A1[lda1*ii+ii+sb], lda1,
+                    &A2[ii+sb], lda2,
+                    &A2[ii], lda2,
+                    &T[ldt*ii], ldt,
+                    work, m);
+
+
+        }
+    }
+    return CoreBlasSuccess;
+}
+
+/***************************************************************************//**
+ *
+ * @ingroup core_ttlqt
+ *
+ *  Returns the minimum length of the array work of coreblas_cttlqt
+ *  for the given dimensions.
+ *
+ *******************************************************************************
+ *
+ * @param[in] m
+ *         The number of rows of the tiles A1 and A2.
+ *
+ * @param[in] n
+ *         The number of columns of the tile A2.
+ *
+ * @param[in] ib
+ *         The inner-blocking size.
+ *
+ *******************************************************************************
+ *
+ * @retval the length of work, at least 1.
+ *
+ ******************************************************************************/
+size_t coreblas_cttlqt_lwork(int m, int n, int ib)
+{
+    return imax(1, imin(ib, m))*(size_t)imax(1, m);
+}
@@ -0,0 +1,213 @@
+/**
+ *
+ * @file
+ *
+ *  COREBLAS is a software package provided by:
+ *  University of Tennessee, US,
+ *  University of Manchester, UK.
+ *
+ **/
+
+#include <coreblas.h>
+#include "coreblas_types.h"
+#include "coreblas_internal.h"
+#include "coreblas_descriptor.h"
+
+/***************************************************************************//**
+ *
+ * @ingroup core_descriptor
+ *
+ *  Initializes a descriptor of the m-by-n submatrix starting at (i, j)
+ *  of an lm-by-ln general matrix stored in tile layout in matrix.
+ *  The descriptor does not own the memory.
+ *
+ *******************************************************************************
+ *
+ * @param[in] precision
+ *         CoreBlasRealFloat, CoreBlasRealDouble, CoreBlasComplexFloat
+ *         or CoreBlasComplexDouble.
+ *
+ * @param[in] matrix
+ *         The matrix in tile layout, see coreblas_desc_t.
+ *
+ * @param[in] mb
+ *         The number of rows in a tile.
+ *
+ * @param[in] nb
+ *         The number of columns in a tile.
+ *
+ * @param[in] lm
+ *         The number of rows of the entire matrix.
+ *
+ * @param[in] ln
+ *         The number of columns of the entire matrix.
+ *
+ * @param[in] i
+ *         The row index to the beginning of the submatrix,
+ *         a multiple of mb.
+ *
+ * @param[in] j
+ *         The column index to the beginning of the submatrix,
+ *         a multiple of nb.
+ *
+ * @param[in] m
+ *         The number of rows of the submatrix.
+ *
+ * @param[in] n
+ *         The number of columns of the submatrix.
+ *
+ * @param[out] A
+ *         The descriptor.
+ *
+ *******************************************************************************
+ *
+ * @retval CoreBlasSuccess successful exit
+ * @retval CoreBlasErrorIllegalValue if the parameters are not consistent
+ *
+ ******************************************************************************/
+int coreblas_desc_general_init(coreblas_enum_t precision, void *matrix,
+                               int mb, int nb, int lm, int ln, int i, int j,
+                               int m, int n, coreblas_desc_t *A)
+{
+    // type and precision
+    A->type = CoreBlasGeneral;
+    A->uplo = CoreBlasGeneral;
+    A->precision = precision;
+
+    // pointer and offsets
+    A->matrix = matrix;
+    A->A21 = (size_t)(lm - lm%mb) * (ln - ln%nb);
+    A->A12 = (size_t)(     lm%mb) * (ln - ln%nb) + A->A21;
+    A->A22 = (size_t)(lm - lm%mb) * (     ln%nb) + A->A12;
+
+    // tile parameters
+    A->mb = mb;
+    A->nb = nb;
+
+    // main matrix parameters
+    A->gm = lm;
+    A->gn = ln;
+    A->gmt = (lm%mb == 0) ? (lm/mb) : (lm/mb+1);
+    A->gnt = (ln%nb == 0) ? (ln/nb) : (ln/nb+1);
+
+    // submatrix parameters
+    A->i = i;
+    A->j = j;
+    A->m = m;
+    A->n = n;
+    A->mt = (m == 0) ? 0 : (i+m-1)/mb - i/mb + 1;
+    A->nt = (n == 0) ? 0 : (j+n-1)/nb - j/nb + 1;
+
+    // band parameters
+    A->kl = m;
+    A->ku = n;
+    A->klt = A->mt;
+    A->kut = A->nt;
+
+    return coreblas_desc_check(*A);
+}
+
+/***************************************************************************//**
+ *
+ * @ingroup core_descriptor
+ *
+ *  Initializes a descriptor of a general band matrix with kl subdiagonals
+ *  and ku superdiagonals stored in tile layout in matrix, where only the
+ *  (klt+kut-1) tile rows per tile column that intersect the band are stored.
+ *  The descriptor does not own the memory.
+ *  See coreblas_desc_general_init() for the other parameters.
+ *
+ *******************************************************************************
+ *
+ * @retval CoreBlasSuccess successful exit
+ * @retval CoreBlasErrorIllegalValue if the parameters are not consistent
+ *
+ ******************************************************************************/
+int coreblas_desc_general_band_init(coreblas_enum_t precision,
+                                    coreblas_enum_t uplo, void *matrix,
+                                    int mb, int nb, int lm, int ln,
+                                    int i, int j, int m, int n, int kl, int ku,
+                                    coreblas_desc_t *A)
+{
+    int retval = coreblas_desc_general_init(precision, matrix, mb, nb,
+                                            lm, ln, i, j, m, n, A);
+    if (retval != CoreBlasSuccess)
+        return retval;
+
+    A->type = CoreBlasGeneralBand;
+    A->uplo = uplo;
+
+    // band parameters
+    A->kl = kl;
+    A->ku = ku;
+    A->klt = (kl+mb-1)/mb + 1;
+    A->kut = (ku+mb-1)/mb + 1;
+
+    return CoreBlasSuccess;
+}
+
+/***************************************************************************//**
+ *
+ * @ingroup core_descriptor
+ *
+ *  Checks the consistency of a descriptor.
+ *
+ *******************************************************************************
+ *
+ * @retval CoreBlasSuccess if the descriptor is valid
+ * @retval CoreBlasErrorIllegalValue otherwise
+ *
+ ******************************************************************************/
+int coreblas_desc_check(coreblas_desc_t A)
+{
+    if (coreblas_element_size(A.precision) == 0 ||
+        A.precision == CoreBlasByte || A.precision == CoreBlasInteger) {
+        coreblas_error("invalid matrix type");
+        return CoreBlasErrorIllegalValue;
+    }
+    if (A.matrix == NULL) {
+        coreblas_error("NULL matrix pointer");
+        return CoreBlasErrorIllegalValue;
+    }
+    if (A.mb <= 0 || A.nb <= 0) {
+        coreblas_error("negative tile dimension");
+        return CoreBlasErrorIllegalValue;
+    }
+    if (A.gm < 0 || A.gn < 0) {
+        coreblas_error("negative matrix dimension");
+        return CoreBlasErrorIllegalValue;
+    }
+    if (A.i < 0 || A.j < 0 || A.i%A.mb != 0 || A.j%A.nb != 0) {
+        coreblas_error("submatrix offset not on a tile boundary");
+        return CoreBlasErrorIllegalValue;
+    }
+    if (A.m < 0 || A.n < 0 || A.i+A.m > A.gm || A.j+A.n > A.gn) {
+        coreblas_error("submatrix out of range");
+        return CoreBlasErrorIllegalValue;
+    }
+    return CoreBlasSuccess;
+}
+
+/***************************************************************************//**
+ *
+ * @ingroup core_descriptor
+ *
+ *  Returns a descriptor of the m-by-n submatrix starting at (i, j) of the
+ *  submatrix described by A; i and j are relative to A and must be
+ *  multiples of the tile size.
+ *
+ ******************************************************************************/
+coreblas_desc_t coreblas_desc_view(coreblas_desc_t A, int i, int j,
+                                   int m, int n)
+{
+    coreblas_desc_t B = A;
+
+    B.i = A.i + i;
+    B.j = A.j + j;
+    B.m = m;
+    B.n = n;
+    B.mt = (m == 0) ? 0 : (B.i+m-1)/A.mb - B.i/A.mb + 1;
+    B.nt = (n == 0) ? 0 : (B.j+n-1)/A.nb - B.j/A.nb + 1;
+
+    return B;
+}
@@ -0,0 +1,266 @@
+/**
+ *
+ * @file
+ *
+ *  COREBLAS is a software package provided by:
+ *  University of Tennessee, US,
+ *  University of Manchester, UK.
+ *
+ * @generated from core_blas/core_zgbbrd_static.c, normal z -> d, Fri Oct 16 03:37:06 2026
+ *
+ **/
+
+#include <coreblas.h>
+#include "coreblas_types.h"
+#include "coreblas_internal.h"
+#include "coreblas_workspace.h"
+#include "coreblas_barrier.h"
+#include "bulge.h"
+
+#ifdef _OPENMP
+#include <omp.h>
+#endif
+
+// Number of consecutive sweeps chased together by one thread.
+#define COREBLAS_DGBBRD_GRSIZ 2
+
+/***************************************************************************//**
+ *
+ * @ingroup core_gbbrd
+ *
+ *  Reduces the band matrix A of width nb to bidiagonal form by bulge
+ *  chasing with coreblas_dgbtype1cb, coreblas_dgbtype2cb and
+ *  coreblas_dgbtype3cb, on work->nthread threads of an OpenMP parallel
+ *  region, as in the static pipeline of Haidar, Ltaief and Dongarra,
+ *  SC11.
+ *
+ *  The sweeps are split into groups of COREBLAS_DGBBRD_GRSIZ consecutive
+ *  sweeps, distributed cyclically among the threads. A thread chases the
+ *  sweeps of a group together, each trailing the previous one by
+ *  COREBLAS_BULGE_SHIFT tasks, so that consecutive kernels work on data
+ *  still in its cache; the first sweep of a group waits for the last one
+ *  of the previous group through the progress table iwork, where
+ *  iwork[t] is the last sweep whose task t is done.
+ *
+ *  The kernels and the data they touch do not depend on the number of
+ *  threads, so neither does the result.
+ *
+ *******************************************************************************
+ *
+ * @param[in] uplo
+ *          - CoreBlasUpper: upper band;
+ *          - CoreBlasLower: lower band.
+ *
+ * @param[in] n
+ *          The order of the matrix A. n >= 0.
+ *
+ * @param[in] nb
+ *          The width of the band. nb >= 1.
+ *
+ * @param[in] Vblksiz
+ *          The blocking of the stored reflectors, as in the gbtype
+ *          kernels. Vblksiz >= 1 if wantz != 0.
+ *
+ * @param[in,out] A
+ *          The band matrix in the (3*nb+1)-by-n storage of the gbtype
+ *          kernels. On exit, the bidiagonal matrix.
+ *
+ * @param[in] lda
+ *          The leading dimension of the array A. lda >= 3*nb+1.
+ *
+ * @param[out] VQ
+ * @param[out] TAUQ
+ * @param[out] VP
+ * @param[out] TAUP
+ *          The reflectors and their scalar factors, as in the gbtype
+ *          kernels.
+ *
+ * @param[in] wantz
+ *          Whether the reflectors are kept for the eigenvectors:
+ *          0 if not, and a positive value if they are. wantz >= 0.
+ *
+ * @param work
+ *          Per-thread workspace of type CoreBlasRealDouble, with spaces
+ *          of at least coreblas_dgbtype1cb_lwork(nb) elements.
+ *
+ * @param iwork
+ *          Progress table of length coreblas_dgbbrd_static_liwork(n, nb),
+ *          shared by the threads.
+ *
+ *******************************************************************************
+ *
+ * @retval CoreBlasSuccess successful exit
+ * @retval < 0 if -i, the i-th argument had an illegal value
+ *
+ ******************************************************************************/
+__attribute__((weak))
+int coreblas_dgbbrd_static(coreblas_enum_t uplo, int n, int nb, int Vblksiz,
+                double *A, int lda,
+                double *VQ, double *TAUQ,
+                double *VP, double *TAUP,
+                int wantz, coreblas_workspace_t *work, int *iwork)
+{
+#ifndef COREBLAS_UNCHECKED
+    // Check input arguments.
+    if (uplo != CoreBlasUpper && uplo != CoreBlasLower) {
+        coreblas_error("illegal value of uplo");
+        return -1;
+    }
+    if (n < 0) {
+        coreblas_error("illegal value of n");
+        return -2;
+    }
+    if (nb < 1) {
+        coreblas_error("illegal value of nb");
+        return -3;
+    }
+    if (wantz != 0 && Vblksiz < 1) {
+        coreblas_error("illegal value of Vblksiz");
+        return -4;
+    }
+    if (A == NULL) {
+        coreblas_error("NULL A");
+        return -5;
+    }
+    if (lda < 3*nb+1) {
+        coreblas_error("illegal value of lda");
+        return -6;
+    }
+    if (VQ == NULL) {
+        coreblas_error("NULL VQ");
+        return -7;
+    }
+    if (TAUQ == NULL) {
+        coreblas_error("NULL TAUQ");
+        return -8;
+    }
+    if (VP == NULL) {
+        coreblas_error("NULL VP");
+        return -9;
+    }
+    if (TAUP == NULL) {
+        coreblas_error("NULL TAUP");
+        return -10;
+    }
+    if (wantz < 0) {
+        coreblas_error("illegal value of wantz");
+        return -11;
+    }
+    if (work == NULL || work->spaces == NULL ||
+        work->dtyp != CoreBlasRealDouble ||
+        work->lworkspace < coreblas_dgbtype1cb_lwork(nb)) {
+        coreblas_error("illegal value of work");
+        return -12;
+    }
+    if (iwork == NULL) {
+        coreblas_error("NULL iwork");
+        return -13;
+    }
+#endif
+
+    // quick return
+    int nsweep = n-1;
+    if (nsweep <= 0)
+        return CoreBlasSuccess;
+
+    int ntask = coreblas_bulge_ntask(n, nb, 0);
+    for (int t = 0; t <= ntask; t++)
+        iwork[t] = -1;
+    volatile int *progress = iwork;
+    int ngroup = coreblas_ceildiv(nsweep, COREBLAS_DGBBRD_GRSIZ);
+
+    #pragma omp parallel num_threads(work->nthread)
+    {
+        int tid = 0;
+        int nth = 1;
+#ifdef _OPENMP
+        tid = omp_get_thread_num();
+        nth = omp_get_num_threads();
+#endif
+        double *w = (double*)work->spaces[tid];
+
+        for (int g = tid; g < ngroup; g += nth) {
+            int s0 = g*COREBLAS_DGBBRD_GRSIZ;
+            int gs = imin(COREBLAS_DGBBRD_GRSIZ, nsweep-s0);
+            int nt[COREBLAS_DGBBRD_GRSIZ+1];   // tasks of the sweeps s0-1:s0+gs
+            int next[COREBLAS_DGBBRD_GRSIZ];   // next task of each sweep
+            nt[0] = s0 > 0 ? coreblas_bulge_ntask(n, nb, s0-1) : 0;
+            for (int q = 0; q < gs; q++) {
+                nt[q+1] = coreblas_bulge_ntask(n, nb, s0+q);
+                next[q] = 1;
+            }
+
+            // In round r, the sweep s0+q runs its tasks up to
+            // (r-q+1)*COREBLAS_BULGE_SHIFT.
+            for (int r = 0, busy = 1; busy; r++) {
+                busy = 0;
+                for (int q = 0; q < gs; q++) {
+                    if (q > r) {
+                        busy = 1;
+                        continue;
+                    }
+                    int s = s0+q;
+                    int tlast = imin((r-q+1)*COREBLAS_BULGE_SHIFT, nt[q+1]);
+                    for (int t = next[q]; t <= tlast; t++) {
+                        // The sweep s-1 is done with the data of task t.
+                        if (s > 0) {
+                            coreblas_barrier_wait_flag(
+                                &progress[imin(t+COREBLAS_BULGE_SHIFT-1, nt[q])],
+                                s-1);
+                        }
+                        int st, ed;
+                        coreblas_bulge_task(n, nb, s, t, &st, &ed);
+                        if (t == 1) {
+                            coreblas_dgbtype1cb(uplo, n, nb, A, lda,
+                                                VQ, TAUQ, VP, TAUP,
+                                                st, ed, s, Vblksiz, wantz, w);
+                        }
+                        else if (t%2 == 0) {
+                            coreblas_dgbtype2cb(uplo, n, nb, A, lda,
+                                                VQ, TAUQ, VP, TAUP,
+                                                st, ed, s, Vblksiz, wantz, w);
+                        }
+                        else {
+                            coreblas_dgbtype3cb(uplo, n, nb, A, lda,
+                                                VQ, TAUQ, VP, TAUP,
+                                                st, ed, s, Vblksiz, wantz, w);
+                        }
+                        __atomic_store_n(&progress[t], s, __ATOMIC_RELEASE);
+                    }
+                    next[q] = imax(next[q], tlast+1);
+                    if (next[q] <= nt[q+1])
+                        busy = 1;
+                }
+            }
+        }
+    }
+    return CoreBlasSuccess;
+}
+
+/***************************************************************************//**
+ *
+ * @ingroup core_gbbrd
+ *
+ *  Returns the length of the progress table iwork of
+ *  coreblas_dgbbrd_static: one more than the number of tasks of the
+ *  first sweep.
+ *
+ *******************************************************************************
+ *
+ * @param[in] n
+ *          The order of the matrix A.
+ *
+ * @param[in] nb
+ *          The width of the band. nb >= 1.
+ *
+ *******************************************************************************
+ *
+ * @retval the length of iwork, at least 1.
+ *
+ ******************************************************************************/
+size_t coreblas_dgbbrd_static_liwork(int n, int nb)
+{
+    if (n < 2 || nb < 1)
+        return 1;
+    return coreblas_bulge_ntask(n, nb, 0) + 1;
+}
@@ -0,0 +1,45 @@
+/**
+ *
+ * @file
+ *
+ *  COREBLAS is a software package provided by:
+ *  University of Tennessee, US,
+ *  University of Manchester, UK.
+ *
+ * @generated from core_blas/core_zgessq.c, normal z -> d, Fri Oct 16 03:36:59 2026
+ *
+ **/
+
+#include <math.h>
+
+#include <coreblas.h>
+#include "coreblas_types.h"
+#include "coreblas_internal.h"
+#include "core_lapack.h"
+
+/******************************************************************************/
+__attribute__((weak))
+void coreblas_dgessq(int m, int n,
+                 const double *A, int lda,
+                 double *scale, double *sumsq)
+{
+    *scale = 0.0;
+    *sumsq = 1.0;
+
+    // The accumulators are combined once for the whole tile.
+    double acc[3] = {0.0, 0.0, 0.0};
+    for (int j = 0; j < n; j++)
+        coreblas_dssq_update(m, &A[lda*j], acc);
+
+    coreblas_dssq_finish(acc, scale, sumsq);
+}
+
+/******************************************************************************/
+void coreblas_dgessq_aux(int n,
+                         const double *scale, const double *sumsq,
+                         double *value)
+{
+    double scl, sum;
+    coreblas_dreduce_ssq(n, scale, sumsq, &scl, &sum);
+    *value = scl*sqrt(sum);
+}
\ No newline at end of file
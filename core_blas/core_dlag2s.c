@@ -0,0 +1,91 @@
+/**
+ *
+ * @file
+ *
+ *  COREBLAS is a software package provided by:
+ *  University of Tennessee, US,
+ *  University of Manchester, UK.
+ *
+ * @generated from core_blas/core_zlag2c.c, mixed zc -> ds, Fri Oct 16 03:37:07 2026
+ *
+ **/
+
+#include <coreblas.h>
+#include "coreblas_types.h"
+
+#include <float.h>
+#include <math.h>
+
+// This will be swapped during the automatic code generation.
+#undef REAL
+#define REAL
+
+/***************************************************************************//**
+ *
+ * @ingroup core_lag2
+ *
+ *  Converts m-by-n matrix A from double complex to single complex precision.
+ *
+ *  As LAPACK's dlag2s, checks that no real or imaginary part overflows in
+ *  single precision, so that a mixed precision solver can keep in double
+ *  precision the tiles that do not fit in single precision. Every column
+ *  is converted in one vectorized pass, the real and imaginary parts as
+ *  one real array.
+ *
+ *******************************************************************************
+ *
+ * @param[in] m
+ *          The number of rows of the matrix A.
+ *          m >= 0.
+ *
+ * @param[in] n
+ *          The number of columns of the matrix A.
+ *          n >= 0.
+ *
+ * @param[in] A
+ *          The lda-by-n matrix in double complex precision to convert.
+ *
+ * @param[in] lda
+ *          The leading dimension of the matrix A.
+ *          lda >= max(1,m).
+ *
+ * @param[out] As
+ *          On exit, the converted ldas-by-n matrix in single complex precision.
+ *
+ * @param[in] ldas
+ *          The leading dimension of the matrix As.
+ *          ldas >= max(1,m).
+ *
+ *******************************************************************************
+ *
+ * @retval 0 successful exit
+ * @retval 1 an element of A is larger than the overflow threshold of single
+ *           precision; As is then only partly converted.
+ *
+ ******************************************************************************/
+__attribute__((weak))
+int coreblas_dlag2s(int m, int n,
+                 double *A,  int lda,
+                 float *As, int ldas)
+{
+#ifdef COMPLEX
+    int mr = 2*m;
+#else
+    int mr = m;
+#endif
+    for (int j = 0; j < n; j++) {
+        const double *a = (const double*)&A[(size_t)lda*j];
+        float *as = (float*)&As[(size_t)ldas*j];
+        // A maximum vectorizes, unlike an integer flag next to doubles.
+        double amax = 0.0;
+        #pragma omp simd reduction(max:amax)
+        for (int i = 0; i < mr; i++) {
+            as[i] = (float)a[i];
+            double absa = fabs(a[i]);
+            amax = absa > amax ? absa : amax;
+        }
+        if (amax > FLT_MAX)
+            return 1;
+    }
+    return 0;
+}
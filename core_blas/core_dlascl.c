@@ -0,0 +1,43 @@
+/**
+ *
+ * @file
+ *
+ *  COREBLAS is a software package provided by:
+ *  University of Tennessee, US,
+ *  University of Manchester, UK.
+ *
+ * @generated from core_blas/core_zlascl.c, normal z -> d, Fri Oct 16 03:37:00 2026
+ *
+ **/
+
+#include <coreblas.h>
+#include "coreblas_types.h"
+#include "core_lapack.h"
+
+/******************************************************************************/
+__attribute__((weak))
+void coreblas_dlascl(coreblas_enum_t uplo,
+                 double cfrom, double cto,
+                 int m, int n,
+                 double *A, int lda)
+{
+    // LAPACKE_dlascl is not available in LAPACKE < 3.6.0
+    int kl;
+    int ku;
+    int info;
+    char type = lapack_const(uplo);
+    #ifdef COREBLAS_USE_64BIT_BLAS
+        LAPACK_dlascl_64(&type,
+                  &kl, &ku,
+                  &cfrom, &cto,
+                  &m, &n,
+                  A, &lda, &info);
+    #else
+        LAPACK_dlascl(&type,
+                  &kl, &ku,
+                  &cfrom, &cto,
+                  &m, &n,
+                  A, &lda, &info);
+    #endif
+
+}
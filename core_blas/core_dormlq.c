@@ -0,0 +1,285 @@
+/**
+ *
+ * @file
+ *
+ *  COREBLAS is a software package provided by:
+ *  University of Tennessee, US,
+ *  University of Manchester, UK.
+ *
+ * @generated from core_blas/core_zunmlq.c, normal z -> d, Fri Oct 16 03:37:05 2026
+ *
+ **/
+
+#include <coreblas.h>
+#include "coreblas_types.h"
+#include "coreblas_internal.h"
+#include "core_lapack.h"
+
+
+
+/***************************************************************************//**
+ *
+ * @ingroup core_unmlq
+ *
+ *  Overwrites the general complex m-by-n tile C with
+ *
+ *                                    side = CoreBlasLeft      side = CoreBlasRight
+ *    trans = CoreBlasNoTrans              Q * C                  C * Q
+ *    trans = CoreBlasTrans         Q^T * C                  C * Q^T
+ *
+ *  where Q is a orthogonal matrix defined as the product of k
+ *  elementary reflectors
+ *    \f[
+ *        Q = H(k) . . . H(2) H(1)
+ *    \f]
+ *  as returned by coreblas_dgelqt. Q is of order m if side = CoreBlasLeft
+ *  and of order n if side = CoreBlasRight.
+ *
+ *******************************************************************************
+ *
+ * @param[in] side
+ *         - CoreBlasLeft  : apply Q or Q^T from the Left;
+ *         - CoreBlasRight : apply Q or Q^T from the Right.
+ *
+ * @param[in] trans
+ *         - CoreBlasNoTrans    :  No transpose, apply Q;
+ *         - CoreBlasTrans :  Transpose, apply Q^T.
+ *
+ * @param[in] m
+ *         The number of rows of the tile C.  m >= 0.
+ *
+ * @param[in] n
+ *         The number of columns of the tile C.  n >= 0.
+ *
+ * @param[in] k
+ *         The number of elementary reflectors whose product defines
+ *         the matrix Q.
+ *         If side = CoreBlasLeft,  m >= k >= 0;
+ *         if side = CoreBlasRight, n >= k >= 0.
+ *
+ * @param[in] ib
+ *         The inner-blocking size. ib >= 0.
+ *
+ * @param[in] A
+ *         Dimension:  (lda,m) if SIDE = CoreBlasLeft,
+ *                     (lda,n) if SIDE = CoreBlasRight,
+ *         The i-th row must contain the vector which defines the
+ *         elementary reflector H(i), for i = 1,2,...,k, as returned by
+ *         coreblas_dgelqt in the first k rows of its array argument A.
+ *
+ * @param[in] lda
+ *         The leading dimension of the array A.  lda >= max(1,k).
+ *
+ * @param[in] T
+ *         The ib-by-k triangular factor T of the block reflector.
+ *         T is upper triangular by block (economic storage);
+ *         The rest of the array is not referenced.
+ *
+ * @param[in] ldt
+ *         The leading dimension of the array T. ldt >= ib.
+ *
+ * @param[in,out] C
+ *         On entry, the m-by-n tile C.
+ *         On exit, C is overwritten by Q*C or Q^T*C or C*Q^T or C*Q.
+ *
+ * @param[in] ldc
+ *         The leading dimension of the array C. ldc >= max(1,m).
+ *
+ * @param work
+ *         Auxiliary workspace array of length ldwork*ib + ib*ib:
+ *         the ldwork-by-ib product of C and V, followed by a copy of
+ *         the ib-by-ib triangle of V. The kernel does not allocate memory.
+ *
+ * @param[in] ldwork
+ *         The leading dimension of the array work.
+ *             ldwork >= max(1,n) if side == CoreBlasLeft
+ *             ldwork >= max(1,m) if side == CoreBlasRight
+ *
+ *******************************************************************************
+ *
+ * @retval CoreBlasSuccess successful exit
+ * @retval < 0 if -i, the i-th argument had an illegal value
+ *
+ ******************************************************************************/
+__attribute__((weak))
+int coreblas_dormlq(coreblas_enum_t side, coreblas_enum_t trans,
+                int m, int n, int k, int ib,
+                const double *A,    int lda,
+                const double *T,    int ldt,
+                      double *C,    int ldc,
+                      double *work, int ldwork)
+{
+#ifndef COREBLAS_UNCHECKED
+    // Check input arguments.
+    if ((side != CoreBlasLeft) && (side != CoreBlasRight)) {
+        coreblas_error("illegal value of side");
+        return -1;
+    }
+
+    int nq; // order of Q
+    int nw; // dimension of work
+
+    if (side == CoreBlasLeft) {
+        nq = m;
+        nw = n;
+    }
+    else {
+        nq = n;
+        nw = m;
+    }
+
+    if (trans != CoreBlasNoTrans && trans != CoreBlasTrans) {
+        coreblas_error("illegal value of trans");
+        return -2;
+    }
+    if (m < 0) {
+        coreblas_error("illegal value of m");
+        return -3;
+    }
+    if (n < 0) {
+        coreblas_error("illegal value of n");
+        return -4;
+    }
+    if (k < 0 || k > nq) {
+        coreblas_error("illegal value of k");
+        return -5;
+    }
+    if (ib < 0) {
+        coreblas_error("illegal value of ib");
+        return -6;
+    }
+    if (A == NULL) {
+        coreblas_error("NULL A");
+        return -7;
+    }
+    if ((lda < imax(1, k)) && (k > 0)) {
+        coreblas_error("illegal value of lda");
+        return -8;
+    }
+    if (T == NULL) {
+        coreblas_error("NULL T");
+        return -9;
+    }
+    if (ldt < imax(1, ib)) {
+        coreblas_error("illegal value of ldt");
+        return -10;
+    }
+    if (C == NULL) {
+        coreblas_error("NULL C");
+        return -11;
+    }
+    if ((ldc < imax(1, m)) && (m > 0)) {
+        coreblas_error("illegal value of ldc");
+        return -12;
+    }
+    if (work == NULL) {
+        coreblas_error("NULL work");
+        return -13;
+    }
+    if ((ldwork < imax(1, nw)) && (nw > 0)) {
+        coreblas_error("illegal value of ldwork");
+        return -14;
+    }
+#endif
+
+    // quick return
+    if (m == 0 || n == 0 || k == 0)
+        return CoreBlasSuccess;
+
+    int i1, i3;
+
+    if ((side == CoreBlasLeft  && trans == CoreBlasNoTrans) ||
+        (side == CoreBlasRight && trans != CoreBlasNoTrans)) {
+        i1 = 0;
+        i3 = ib;
+    }
+    else {
+        i1 = ((k-1)/ib)*ib;
+        i3 = -ib;
+    }
+
+    if (trans == CoreBlasNoTrans)
+        trans = CoreBlasTrans;
+    else
+        trans = CoreBlasNoTrans;
+
+    for (int i = i1; i > -1 && i < k; i += i3) {
+        int kb = imin(ib, k-i);
+        int ic = 0;
+        int jc = 0;
+        int ni = n;
+        int mi = m;
+
+        if (side == CoreBlasLeft) {
+            // H or H^T is applied to C(i:m,1:n).
+            mi = m - i;
+            ic = i;
+        }
+        else {
+            // H or H^T is applied to C(1:m,i:n).
+            ni = n - i;
+            jc = i;
+        }
+
+        // larfb_gemm_split multiplies by the leading kb-by-kb triangle V1
+        // of V with a gemm, so V1 is copied after W with its zeros and
+        // unit diagonal made explicit. The rest of V is read in place.
+        double *V1 = &work[(size_t)ldwork*ib];
+        for (int j = 0; j < kb; j++) {
+            for (int l = 0; l < j; l++)
+                V1[kb*j+l] = A[lda*(i+j)+(i+l)];
+            V1[kb*j+j] = 1.0;
+            for (int l = j+1; l < kb; l++)
+                V1[kb*j+l] = 0.0;
+        }
+
+        // Apply H or H^T.
+        coreblas_dlarfb_gemm_split(side, trans,
+                                   mi, ni, kb,
+                                   V1,                 kb,
+                                   &A[lda*(i+kb)+i],   lda,
+                                   &T[ldt*i],          ldt,
+                                   &C[ldc*jc+ic],      ldc,
+                                   work, ldwork);
+    }
+
+    return CoreBlasSuccess;
+}
+
+/***************************************************************************//**
+ *
+ * @ingroup core_unmlq
+ *
+ *  Returns the minimum length of the array work of coreblas_dormlq
+ *  for the given dimensions.
+ *  The leading dimension is ldwork = max(1,n) on the left
+ *  and ldwork = max(1,m) on the right.
+ *
+ *******************************************************************************
+ *
+ * @param[in] side
+ *         - CoreBlasLeft  : apply from the Left;
+ *         - CoreBlasRight : apply from the Right.
+ *
+ * @param[in] m
+ *         The number of rows of the tile C.
+ *
+ * @param[in] n
+ *         The number of columns of the tile C.
+ *
+ * @param[in] ib
+ *         The inner-blocking size.
+ *
+ *******************************************************************************
+ *
+ * @retval the length of work, at least 1.
+ *
+ ******************************************************************************/
+size_t coreblas_dormlq_lwork(coreblas_enum_t side, int m, int n, int ib)
+{
+    size_t sib = (size_t)imax(0, ib);
+    if (side == CoreBlasLeft)
+        return imax(1, n)*(size_t)imax(1, ib) + sib*sib;
+    else
+        return imax(1, m)*(size_t)imax(1, ib) + sib*sib;
+}
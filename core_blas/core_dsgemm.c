@@ -0,0 +1,230 @@
+/**
+ *
+ * @file
+ *
+ *  COREBLAS is a software package provided by:
+ *  University of Tennessee, US,
+ *  University of Manchester, UK.
+ *
+ * @generated from core_blas/core_zcgemm.c, mixed zc -> ds, Fri Oct 16 03:37:07 2026
+ *
+ **/
+
+#include <coreblas.h>
+#include "coreblas_types.h"
+#include "coreblas_internal.h"
+#include "core_lapack.h"
+
+// This will be swapped during the automatic code generation.
+#undef REAL
+#define REAL
+
+// Number of columns of op( As ) converted at a time; the converted block
+// stays in cache for the gemm that uses it.
+#define COREBLAS_DSGEMM_NB 64
+
+/***************************************************************************//**
+ *
+ * @ingroup core_gemm
+ *
+ *  Performs one of the matrix-matrix operations
+ *
+ *    \f[ C = \alpha [op( As )\times op( B )] + \beta C, \f]
+ *
+ *  in double complex precision, where the matrix As is stored in single
+ *  complex precision, e.g., the tile of a matrix factored in single
+ *  precision. With alpha = -1 and beta = 1, this is the residual
+ *  r = b - A x of a mixed precision iterative refinement, without keeping
+ *  a double precision copy of A.
+ *
+ *  op( As ) is converted to double complex precision COREBLAS_DSGEMM_NB
+ *  columns at a time into work, and every block is multiplied by the
+ *  matching rows of op( B ) while it is in cache.
+ *
+ *******************************************************************************
+ *
+ * @param[in] transa
+ *          - CoreBlasNoTrans:   As is not transposed,
+ *          - CoreBlasTrans:     As is transposed,
+ *          - CoreBlasConjTrans: As is conjugate transposed.
+ *
+ * @param[in] transb
+ *          - CoreBlasNoTrans:   B is not transposed,
+ *          - CoreBlasTrans:     B is transposed,
+ *          - CoreBlasConjTrans: B is conjugate transposed.
+ *
+ * @param[in] m
+ *          The number of rows of the matrix op( As ) and of the matrix C.
+ *          m >= 0.
+ *
+ * @param[in] n
+ *          The number of columns of the matrix op( B ) and of the matrix C.
+ *          n >= 0.
+ *
+ * @param[in] k
+ *          The number of columns of the matrix op( As ) and the number of
+ *          rows of the matrix op( B ). k >= 0.
+ *
+ * @param[in] alpha
+ *          The scalar alpha.
+ *
+ * @param[in] As
+ *          An ldas-by-ka matrix in single complex precision, where ka is k
+ *          when transa = CoreBlasNoTrans, and is m otherwise.
+ *
+ * @param[in] ldas
+ *          The leading dimension of the array As.
+ *          When transa = CoreBlasNoTrans, ldas >= max(1,m),
+ *          otherwise, ldas >= max(1,k).
+ *
+ * @param[in] B
+ *          An ldb-by-kb matrix, where kb is n when transb = CoreBlasNoTrans,
+ *          and is k otherwise.
+ *
+ * @param[in] ldb
+ *          The leading dimension of the array B.
+ *          When transb = CoreBlasNoTrans, ldb >= max(1,k),
+ *          otherwise, ldb >= max(1,n).
+ *
+ * @param[in] beta
+ *          The scalar beta.
+ *
+ * @param[in,out] C
+ *          An ldc-by-n matrix. On exit, the array is overwritten by the m-by-n
+ *          matrix ( alpha*op( As )*op( B ) + beta*C ).
+ *
+ * @param[in] ldc
+ *          The leading dimension of the array C. ldc >= max(1,m).
+ *
+ * @param work
+ *          Workspace of length coreblas_dsgemm_lwork(m, k).
+ *
+ *******************************************************************************
+ *
+ * @retval 0 successful exit
+ * @retval < 0 if -i, the i-th argument had an illegal value
+ *
+ ******************************************************************************/
+__attribute__((weak))
+int coreblas_dsgemm(coreblas_enum_t transa, coreblas_enum_t transb,
+                int m, int n, int k,
+                double alpha, const float *As, int ldas,
+                                          const double *B,  int ldb,
+                double beta,        double *C,  int ldc,
+                double *work)
+{
+#ifndef COREBLAS_UNCHECKED
+    // Check input arguments.
+    if (transa != CoreBlasNoTrans && transa != CoreBlasTrans &&
+        transa != CoreBlasConjTrans) {
+        coreblas_error("illegal value of transa");
+        return -1;
+    }
+    if (transb != CoreBlasNoTrans && transb != CoreBlasTrans &&
+        transb != CoreBlasConjTrans) {
+        coreblas_error("illegal value of transb");
+        return -2;
+    }
+    if (m < 0) {
+        coreblas_error("illegal value of m");
+        return -3;
+    }
+    if (n < 0) {
+        coreblas_error("illegal value of n");
+        return -4;
+    }
+    if (k < 0) {
+        coreblas_error("illegal value of k");
+        return -5;
+    }
+    if (As == NULL) {
+        coreblas_error("NULL As");
+        return -7;
+    }
+    if (ldas < imax(1, transa == CoreBlasNoTrans ? m : k)) {
+        coreblas_error("illegal value of ldas");
+        return -8;
+    }
+    if (B == NULL) {
+        coreblas_error("NULL B");
+        return -9;
+    }
+    if (ldb < imax(1, transb == CoreBlasNoTrans ? k : n)) {
+        coreblas_error("illegal value of ldb");
+        return -10;
+    }
+    if (C == NULL) {
+        coreblas_error("NULL C");
+        return -12;
+    }
+    if (ldc < imax(1, m)) {
+        coreblas_error("illegal value of ldc");
+        return -13;
+    }
+    if (work == NULL) {
+        coreblas_error("NULL work");
+        return -14;
+    }
+#endif
+
+    // quick return
+    if (m == 0 || n == 0)
+        return CoreBlasSuccess;
+
+    if (k == 0) {
+        coreblas_dgemm(transa, transb, m, n, k,
+                       alpha, NULL, ldas, NULL, ldb, beta, C, ldc);
+        return CoreBlasSuccess;
+    }
+
+    for (int l = 0; l < k; l += COREBLAS_DSGEMM_NB) {
+        int kb = imin(COREBLAS_DSGEMM_NB, k-l);
+        const double *Bl;
+        if (transb == CoreBlasNoTrans)
+            Bl = &B[l];
+        else
+            Bl = &B[(size_t)ldb*l];
+
+        // work holds the columns l:l+kb of As, or its rows if transposed.
+        if (transa == CoreBlasNoTrans) {
+            coreblas_slag2d(m, kb, (float*)&As[(size_t)ldas*l],
+                            ldas, work, m);
+            coreblas_dgemm(transa, transb, m, n, kb,
+                           alpha, work, m, Bl, ldb, beta, C, ldc);
+        }
+        else {
+            coreblas_slag2d(kb, m, (float*)&As[l],
+                            ldas, work, kb);
+            coreblas_dgemm(transa, transb, m, n, kb,
+                           alpha, work, kb, Bl, ldb, beta, C, ldc);
+        }
+        beta = 1.0;
+    }
+
+    return CoreBlasSuccess;
+}
+
+/***************************************************************************//**
+ *
+ * @ingroup core_gemm
+ *
+ *  Returns the minimum length of the array work of coreblas_dsgemm
+ *  for the given dimensions, in elements of type double.
+ *
+ *******************************************************************************
+ *
+ * @param[in] m
+ *          The number of rows of the matrix op( As ).
+ *
+ * @param[in] k
+ *          The number of columns of the matrix op( As ).
+ *
+ *******************************************************************************
+ *
+ * @retval the length of work, at least 1.
+ *
+ ******************************************************************************/
+size_t coreblas_dsgemm_lwork(int m, int k)
+{
+    return imax(1, m)*(size_t)imax(1, imin(COREBLAS_DSGEMM_NB, k));
+}
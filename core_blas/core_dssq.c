@@ -0,0 +1,297 @@
+/**
+ *
+ * @file
+ *
+ *  COREBLAS is a software package provided by:
+ *  University of Tennessee, US,
+ *  University of Manchester, UK.
+ *
+ * @generated from core_blas/core_zssq.c, normal z -> d, Fri Oct 16 03:36:55 2026
+ *
+ **/
+
+#include <coreblas.h>
+#include "coreblas_types.h"
+#include "coreblas_internal.h"
+
+#include <math.h>
+
+// This will be swapped during the automatic code generation.
+#undef REAL
+#define REAL
+#define DOUBLE
+
+#if defined(__x86_64__) && defined(__GNUC__)
+#define COREBLAS_SSQ_X86
+#include <immintrin.h>
+#endif
+
+// Blue's thresholds and scaling factors, as in LAPACK's xLASSQ: the squares
+// of the components in [TSML, TBIG] are accumulated as they are, those of
+// the smaller ones after scaling up by SSML and those of the bigger ones
+// after scaling down by SBIG, so that none of them underflows or overflows.
+#ifdef DOUBLE
+#define COREBLAS_SSQ_TSML 0x1p-511
+#define COREBLAS_SSQ_TBIG 0x1p+486
+#define COREBLAS_SSQ_SSML 0x1p+537
+#define COREBLAS_SSQ_SBIG 0x1p-538
+#else
+#define COREBLAS_SSQ_TSML 0x1p-63f
+#define COREBLAS_SSQ_TBIG 0x1p+52f
+#define COREBLAS_SSQ_SSML 0x1p+75f
+#define COREBLAS_SSQ_SBIG 0x1p-76f
+#endif
+
+/******************************************************************************/
+// Adds the squares of the len components p[i] to the accumulators.
+// The components are classified without branches, so that the loop is
+// vectorized, and each is squared only in its own accumulator, since the
+// underflow of the others would be slow. A NaN goes to the medium
+// accumulator, which propagates it.
+static void core_dssq_ref(int len, const double *p, double *acc)
+{
+    double asml = acc[0];
+    double amed = acc[1];
+    double abig = acc[2];
+
+    #pragma omp simd reduction(+:asml, amed, abig)
+    for (int i = 0; i < len; i++) {
+        double ax = fabs(p[i]);
+        int is_sml = ax < COREBLAS_SSQ_TSML;
+        int is_big = ax > COREBLAS_SSQ_TBIG;
+        double ys = (is_sml ? ax : 0.0)*COREBLAS_SSQ_SSML;
+        double yb = (is_big ? ax : 0.0)*COREBLAS_SSQ_SBIG;
+        double ym = is_sml || is_big ? 0.0 : ax;
+        asml += ys*ys;
+        amed += ym*ym;
+        abig += yb*yb;
+    }
+
+    acc[0] = asml;
+    acc[1] = amed;
+    acc[2] = abig;
+}
+
+#ifdef COREBLAS_SSQ_X86
+/******************************************************************************/
+// AVX2 and FMA: the same classification with comparison masks, on two registers
+// at a time, each with its own three accumulators, so that the additions
+// are not serialized on the latency of the adder as in the loop above.
+// The ordered comparisons are false for a NaN, which is thus added to
+// the medium accumulator.
+__attribute__((target("avx2,fma")))
+static void core_dssq_avx2(int len, const double *p, double *acc)
+{
+    int i = 0;
+#if defined(DOUBLE)
+    const __m256d sign = _mm256_set1_pd(-0.0);
+    const __m256d tsml = _mm256_set1_pd(COREBLAS_SSQ_TSML);
+    const __m256d tbig = _mm256_set1_pd(COREBLAS_SSQ_TBIG);
+    const __m256d ssml = _mm256_set1_pd(COREBLAS_SSQ_SSML);
+    const __m256d sbig = _mm256_set1_pd(COREBLAS_SSQ_SBIG);
+    __m256d asml[2], amed[2], abig[2];
+    for (int k = 0; k < 2; k++) {
+        asml[k] = _mm256_setzero_pd();
+        amed[k] = _mm256_setzero_pd();
+        abig[k] = _mm256_setzero_pd();
+    }
+    for (; i+8 <= len; i += 8) {
+        for (int k = 0; k < 2; k++) {
+            __m256d ax = _mm256_andnot_pd(sign, _mm256_loadu_pd(&p[i+4*k]));
+            __m256d is_sml = _mm256_cmp_pd(ax, tsml, _CMP_LT_OQ);
+            __m256d is_big = _mm256_cmp_pd(ax, tbig, _CMP_GT_OQ);
+            __m256d ys = _mm256_mul_pd(_mm256_and_pd(is_sml, ax), ssml);
+            __m256d yb = _mm256_mul_pd(_mm256_and_pd(is_big, ax), sbig);
+            __m256d ym = _mm256_andnot_pd(_mm256_or_pd(is_sml, is_big), ax);
+            asml[k] = _mm256_fmadd_pd(ys, ys, asml[k]);
+            amed[k] = _mm256_fmadd_pd(ym, ym, amed[k]);
+            abig[k] = _mm256_fmadd_pd(yb, yb, abig[k]);
+        }
+    }
+    double sum[3][4];
+    _mm256_storeu_pd(sum[0], _mm256_add_pd(asml[0], asml[1]));
+    _mm256_storeu_pd(sum[1], _mm256_add_pd(amed[0], amed[1]));
+    _mm256_storeu_pd(sum[2], _mm256_add_pd(abig[0], abig[1]));
+    for (int j = 0; j < 3; j++)
+        acc[j] += (sum[j][0] + sum[j][1]) + (sum[j][2] + sum[j][3]);
+#else
+    const __m256 sign = _mm256_set1_ps(-0.0f);
+    const __m256 tsml = _mm256_set1_ps(COREBLAS_SSQ_TSML);
+    const __m256 tbig = _mm256_set1_ps(COREBLAS_SSQ_TBIG);
+    const __m256 ssml = _mm256_set1_ps(COREBLAS_SSQ_SSML);
+    const __m256 sbig = _mm256_set1_ps(COREBLAS_SSQ_SBIG);
+    __m256 asml[2], amed[2], abig[2];
+    for (int k = 0; k < 2; k++) {
+        asml[k] = _mm256_setzero_ps();
+        amed[k] = _mm256_setzero_ps();
+        abig[k] = _mm256_setzero_ps();
+    }
+    for (; i+16 <= len; i += 16) {
+        for (int k = 0; k < 2; k++) {
+            __m256 ax = _mm256_andnot_ps(sign, _mm256_loadu_ps(&p[i+8*k]));
+            __m256 is_sml = _mm256_cmp_ps(ax, tsml, _CMP_LT_OQ);
+            __m256 is_big = _mm256_cmp_ps(ax, tbig, _CMP_GT_OQ);
+            __m256 ys = _mm256_mul_ps(_mm256_and_ps(is_sml, ax), ssml);
+            __m256 yb = _mm256_mul_ps(_mm256_and_ps(is_big, ax), sbig);
+            __m256 ym = _mm256_andnot_ps(_mm256_or_ps(is_sml, is_big), ax);
+            asml[k] = _mm256_fmadd_ps(ys, ys, asml[k]);
+            amed[k] = _mm256_fmadd_ps(ym, ym, amed[k]);
+            abig[k] = _mm256_fmadd_ps(yb, yb, abig[k]);
+        }
+    }
+    float sum[3][8];
+    _mm256_storeu_ps(sum[0], _mm256_add_ps(asml[0], asml[1]));
+    _mm256_storeu_ps(sum[1], _mm256_add_ps(amed[0], amed[1]));
+    _mm256_storeu_ps(sum[2], _mm256_add_ps(abig[0], abig[1]));
+    for (int j = 0; j < 3; j++)
+        acc[j] += ((sum[j][0] + sum[j][1]) + (sum[j][2] + sum[j][3])) +
+                  ((sum[j][4] + sum[j][5]) + (sum[j][6] + sum[j][7]));
+#endif
+    // The remainder is done by the SSE code, after clearing the upper
+    // halves of the registers to avoid the transition penalty.
+    _mm256_zeroupper();
+    core_dssq_ref(len-i, &p[i], acc);
+}
+#endif // COREBLAS_SSQ_X86
+
+/***************************************************************************//**
+ *
+ * @ingroup core_gessq
+ *
+ *  Adds the squares of the elements of the vector x (of their real and
+ *  imaginary parts in complex precisions) to the three accumulators of
+ *  Blue's algorithm.
+ *
+ *  A NaN goes to the medium accumulator, which propagates it.
+ *  The accumulators of several vectors, e.g., of all the columns of a
+ *  tile, are turned into a scaled sum of squares at once by
+ *  coreblas_dssq_finish.
+ *
+ *******************************************************************************
+ *
+ * @param[in] m
+ *          The length of the vector x. m >= 0.
+ *
+ * @param[in] x
+ *          The vector x.
+ *
+ * @param[in,out] acc
+ *          The sums of the squares of the small, medium and big
+ *          components, the first scaled by SSML^2 and the last by SBIG^2.
+ *          Zero on the first call.
+ *
+ ******************************************************************************/
+void coreblas_dssq_update(int m, const double *x, double *acc)
+{
+#ifdef COMPLEX
+    const double *p = (const double*)x;
+    int len = 2*m;
+#else
+    const double *p = x;
+    int len = m;
+#endif
+
+#ifdef COREBLAS_SSQ_X86
+    if (__builtin_cpu_supports("avx2") && __builtin_cpu_supports("fma")) {
+        core_dssq_avx2(len, p, acc);
+        return;
+    }
+#endif
+    core_dssq_ref(len, p, acc);
+}
+
+/***************************************************************************//**
+ *
+ * @ingroup core_gessq
+ *
+ *  Updates a scaled sum of squares with the accumulators of
+ *  coreblas_dssq_update, as LAPACK's xLASSQ:
+ *
+ *    scale_out^2 * sumsq_out = scale_in^2 * sumsq_in + sum of squares,
+ *
+ *  where the sum of squares is the one accumulated in acc. The scale and
+ *  sumsq are left unchanged when it is zero, so that the usual initial
+ *  values scale = 0, sumsq = 1 of an empty sum are kept.
+ *
+ *******************************************************************************
+ *
+ * @param[in] acc
+ *          The accumulators of coreblas_dssq_update.
+ *
+ * @param[in,out] scale
+ *          On entry, the scale factor of the initial sum of squares.
+ *          On exit, the scale factor of the sum of squares.
+ *
+ * @param[in,out] sumsq
+ *          On entry, the initial sum of squares, scaled by scale^2.
+ *          On exit, the sum of squares, scaled by scale^2.
+ *
+ ******************************************************************************/
+void coreblas_dssq_finish(const double *acc, double *scale, double *sumsq)
+{
+    double asml = acc[0];
+    double amed = acc[1];
+    double abig = acc[2];
+
+    // Nothing to add, or the sum of squares is already NaN.
+    if (asml == 0.0 && amed == 0.0 && abig == 0.0)
+        return;
+    if (isnan(*scale) || isnan(*sumsq))
+        return;
+
+    // Put the initial sum of squares in the right accumulator.
+    if (*scale > 0.0 && *sumsq > 0.0) {
+        double scl = *scale;
+        double ax = scl*sqrt(*sumsq);
+        if (ax > COREBLAS_SSQ_TBIG) {
+            if (scl > 1.0) {
+                scl *= COREBLAS_SSQ_SBIG;
+                abig += scl*(scl*(*sumsq));
+            }
+            else {
+                abig += scl*(scl*(COREBLAS_SSQ_SBIG*
+                                  (COREBLAS_SSQ_SBIG*(*sumsq))));
+            }
+        }
+        else if (ax < COREBLAS_SSQ_TSML) {
+            if (scl < 1.0) {
+                scl *= COREBLAS_SSQ_SSML;
+                asml += scl*(scl*(*sumsq));
+            }
+            else {
+                asml += scl*(scl*(COREBLAS_SSQ_SSML*
+                                  (COREBLAS_SSQ_SSML*(*sumsq))));
+            }
+        }
+        else {
+            amed += scl*(scl*(*sumsq));
+        }
+    }
+
+    // Combine the accumulators. The small squares do not matter next
+    // to a big one; "!(amed <= 0.0)" propagates a NaN.
+    if (abig > 0.0) {
+        if (!(amed <= 0.0))
+            abig += (amed*COREBLAS_SSQ_SBIG)*COREBLAS_SSQ_SBIG;
+        *scale = 1.0/COREBLAS_SSQ_SBIG;
+        *sumsq = abig;
+    }
+    else if (asml > 0.0) {
+        if (!(amed <= 0.0)) {
+            double ymed = sqrt(amed);
+            double ysml = sqrt(asml)/COREBLAS_SSQ_SSML;
+            double ymin = ysml > ymed ? ymed : ysml;
+            double ymax = ysml > ymed ? ysml : ymed;
+            *scale = 1.0;
+            *sumsq = ymax*ymax*(1.0 + (ymin/ymax)*(ymin/ymax));
+        }
+        else {
+            *scale = 1.0/COREBLAS_SSQ_SSML;
+            *sumsq = asml;
+        }
+    }
+    else {
+        *scale = 1.0;
+        *sumsq = amed;
+    }
+}
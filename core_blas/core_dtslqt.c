@@ -0,0 +1,283 @@
+/**
+ *
+ * @file
+ *
+ *  COREBLAS is a software package provided by:
+ *  University of Tennessee, US,
+ *  University of Manchester, UK.
+ *
+ * @generated from core_blas/core_ztslqt.c, normal z -> d, Fri Oct 16 03:37:03 2026
+ *
+ **/
+
+#include <coreblas.h>
+#include "coreblas_types.h"
+#include "coreblas_internal.h"
+#include "core_lapack.h"
+
+
+
+#undef REAL
+#define REAL
+
+/***************************************************************************//**
+ *
+ * @ingroup core_tslqt
+ *
+ *  Computes an LQ factorization of a rectangular matrix
+ *  formed by coupling side-by-side a complex m-by-m
+ *  lower triangular tile A1 and a complex m-by-n tile A2:
+ *
+ *    | A1 A2 | = L * Q
+ *
+ *  The tile Q is represented as a product of elementary reflectors
+ *
+ *    Q = H(k)^T . . . H(2)^T H(1)^T, where k = min(m,n).
+ *
+ *  Each H(i) has the form
+ *
+ *    H(i) = I - tau * v * v^T
+ *
+ *  where tau is a complex scalar, and v is a complex vector with
+ *  v(1:i-1) = 0 and v(i) = 1; v(i+1:n)^T is stored on exit in
+ *  A2(i,1:n), and tau in tau(i).
+ *
+ *******************************************************************************
+ *
+ * @param[in] m
+ *         The number of rows of the tile A1 and A2. m >= 0.
+ *         The number of columns of the tile A1.
+ *
+ * @param[in] n
+ *         The number of columns of the tile A2. n >= 0.
+ *
+ * @param[in] ib
+ *         The inner-blocking size.  ib >= 0.
+ *
+ * @param[in,out] A1
+ *         On entry, the m-by-m tile A1.
+ *         On exit, the elements on and below the diagonal of the array
+ *         contain the m-by-m lower trapezoidal tile L;
+ *         the elements above the diagonal are not referenced.
+ *
+ * @param[in] lda1
+ *         The leading dimension of the array A1. lda1 >= max(1,m).
+ *
+ * @param[in,out] A2
+ *         On entry, the m-by-n tile A2.
+ *         On exit, all the elements with the array tau, represent
+ *         the orthogonal tile Q as a product of elementary reflectors
+ *         (see Further Details).
+ *
+ * @param[in] lda2
+ *         The leading dimension of the tile A2. lda2 >= max(1,m).
+ *
+ * @param[out] T
+ *         The ib-by-m triangular factor T of the block reflector.
+ *         T is upper triangular by block (economic storage);
+ *         The rest of the array is not referenced.
+ *
+ * @param[in] ldt
+ *         The leading dimension of the array T. ldt >= ib.
+ *
+ * @param tau
+ *         Auxiliarry workspace array of length m.
+ *
+ * @param work
+ *         Auxiliary workspace array of length ib*m.
+ *
+ *******************************************************************************
+ *
+ * @retval CoreBlasSuccess successful exit
+ * @retval < 0 if -i, the i-th argument had an illegal value
+ *
+ ******************************************************************************/
+__attribute__((weak))
+int coreblas_dtslqt(int m, int n, int ib,
+                double *A1, int lda1,
+                double *A2, int lda2,
+                double *T,  int ldt,
+                double *tau,
+                double *work)
+{
+#ifndef COREBLAS_UNCHECKED
+    // Check input arguments.
+    if (m < 0) {
+        coreblas_error("illegal value of m");
+        return -1;
+    }
+    if (n < 0) {
+        coreblas_error("illegal value of n");
+        return -2;
+    }
+    if (ib < 0) {
+        coreblas_error("illegal value of ib");
+        return -3;
+    }
+    if (A1 == NULL) {
+        coreblas_error("NULL A1");
+        return -4;
+    }
+    if (lda1 < imax(1, m) && m > 0) {
+        coreblas_error("illegal value of lda1");
+        return -5;
+    }
+    if (A2 == NULL) {
+        coreblas_error("NULL A2");
+        return -6;
+    }
+    if (lda2 < imax(1, m) && m > 0) {
+        coreblas_error("illegal value of lda2");
+        return -7;
+    }
+    if (T == NULL) {
+        coreblas_error("NULL T");
+        return -8;
+    }
+    if (ldt < imax(1, ib) && ib > 0) {
+        coreblas_error("illegal value of ldt");
+        return -9;
+    }
+    if (tau == NULL) {
+        coreblas_error("NULL tau");
+        return -10;
+    }
+    if (work == NULL) {
+        coreblas_error("NULL work");
+        return -11;
+    }
+#endif
+
+    // quick return
+    if (m == 0 || n == 0 || ib == 0)
+        return CoreBlasSuccess;
+
+    static double zone  = 1.0;
+
+    for (int ii = 0; ii < m; ii += ib) {
+        int sb = imin(m-ii, ib);
+        for (int i = 0; i < sb; i++) {
+            // Generate elementary reflector H(ii*ib+i) to annihilate
+            // A(ii*ib+i,ii*ib+i:n).
+#ifdef COMPLEX
+     #ifdef COREBLAS_USE_64BIT_BLAS
+            LAPACKE_dlacgv64_(n, &A2[ii+i], lda2);
+            LAPACKE_dlacgv64_(1, &A1[lda1*(ii+i)+ii+i], lda1);
+     #else
+            LAPACKE_dlacgv_work(n, &A2[ii+i], lda2);
+            LAPACKE_dlacgv_work(1, &A1[lda1*(ii+i)+ii+i], lda1);
+     #endif
+
+#endif
+    #ifdef COREBLAS_USE_64BIT_BLAS
+            LAPACKE_dlarfg_work64_(n+1, &A1[lda1*(ii+i)+ii+i], &A2[ii+i], lda2,
+                                     &tau[ii+i]);
+    #else
+            LAPACKE_dlarfg_work(n+1, &A1[lda1*(ii+i)+ii+i], &A2[ii+i], lda2,
+                                &tau[ii+i]);
+    #endif
+
+
+            double alpha = -(tau[ii+i]);
+            if (ii+i+1 < m) {
+            #ifdef COREBLAS_USE_64BIT_BLAS
+                            // Apply H(ii+i-1) to A(ii+i:ii+ib-1, ii+i-1:n) from the right.
+                cblas_dcopy64_(sb-i-1,
+                            &A1[lda1*(ii+i)+(ii+i+1)], 1,
+                            work, 1);
+                cblas_dgemv64_(CblasColMajor, (CBLAS_TRANSPOSE)CoreBlasNoTrans,
+                            sb-i-1, n,
+                            (zone), &A2[ii+i+1], lda2,
+                            &A2[ii+i], lda2,
+                            (zone), work, 1);
+
+                cblas_daxpy64_(sb-i-1, (alpha), work, 1,
+                            &A1[lda1*(ii+i)+ii+i+1], 1);
+
+                cblas_dger64_(CblasColMajor,
+                            sb-i-1, n,
+                            (alpha), work, 1,
+                            &A2[ii+i], lda2,
+                            &A2[ii+i+1], lda2);
+            #else
+                            // Apply H(ii+i-1) to A(ii+i:ii+ib-1, ii+i-1:n) from the right.
+                cblas_dcopy(sb-i-1,
+                            &A1[lda1*(ii+i)+(ii+i+1)], 1,
+                            work, 1);
+                cblas_dgemv(CblasColMajor, (CBLAS_TRANSPOSE)CoreBlasNoTrans,
+                            sb-i-1, n,
+                            (zone), &A2[ii+i+1], lda2,
+                            &A2[ii+i], lda2,
+                            (zone), work, 1);
+
+                cblas_daxpy(sb-i-1, (alpha), work, 1,
+                            &A1[lda1*(ii+i)+ii+i+1], 1);
+
+                cblas_dger(CblasColMajor,
+                            sb-i-1, n,
+                            (alpha), work, 1,
+                            &A2[ii+i], lda2,
+                            &A2[ii+i+1], lda2);
+            #endif
+
+            }
+#ifdef COMPLEX
+    #ifdef COREBLAS_USE_64BIT_BLAS
+            LAPACKE_dlacgv64_(n, &A2[ii+i], lda2);
+            LAPACKE_dlacgv64_(1, &A1[lda1*(ii+i)+ii+i], lda1);
+    #else
+            LAPACKE_dlacgv_work(n, &A2[ii+i], lda2);
+            LAPACKE_dlacgv_work(1, &A1[lda1*(ii+i)+ii+i], lda1);
+    #endif
+
+#endif
+        }
+
+        // Calculate T.
+        coreblas_dlarft_pent(CoreBlasRowwise, n, sb, 0,
+                             &A2[ii], lda2,
+                             &tau[ii],
+                             &T[ldt*ii], ldt);
+
+        if (m > ii+sb) {
+            coreblas_dtsmlq_nocheck(CoreBlasRight, CoreBlasTrans,
+                                m-(ii+sb), sb, m-(ii+sb), n, ib, ib,
+                                &A1[lda1*ii+ii+sb], lda1,
+                                &A2[ii+sb], lda2,
+                                &A2[ii], lda2,
+                                &T[ldt*ii], ldt,
+                                work, lda1);
+
+        }
+    }
+
+    return CoreBlasSuccess;
+}
+
+/***************************************************************************//**
+ *
+ * @ingroup core_tslqt
+ *
+ *  Returns the minimum length of the array work of coreblas_dtslqt
+ *  for the given dimensions.
+ *
+ *******************************************************************************
+ *
+ * @param[in] m
+ *         The number of rows of the tiles A1 and A2.
+ *
+ * @param[in] n
+ *         The number of columns of the tile A2.
+ *
+ * @param[in] ib
+ *         The inner-blocking size.
+ *
+ *******************************************************************************
+ *
+ * @retval the length of work, at least 1.
+ *
+ ******************************************************************************/
+size_t coreblas_dtslqt_lwork(int m, int n, int ib)
+{
+    return imax(1, imin(ib, m))*(size_t)imax(1, m);
+}
@@ -0,0 +1,330 @@
+/**
+ *
+ * @file
+ *
+ *  COREBLAS is a software package provided by:
+ *  University of Tennessee, US,
+ *  University of Manchester, UK.
+ *
+ * @generated from core_blas/core_ztsqlt.c, normal z -> d, Fri Oct 16 03:37:04 2026
+ *
+ **/
+
+#include <coreblas.h>
+#include "coreblas_types.h"
+#include "coreblas_internal.h"
+#include "core_lapack.h"
+
+// This will be swapped during the automatic code generation.
+#undef REAL
+#define REAL
+
+/***************************************************************************//**
+ *
+ * @ingroup core_tsqlt
+ *
+ * Computes a QL factorization of a rectangular matrix
+ * formed by coupling an m-by-n tile A2
+ * on top of an n-by-n lower triangular tile A1:
+ *
+ *    | A2 | = Q * | 0 |
+ *    | A1 |       | L |
+ *
+ *  The columns are eliminated from the last to the first, one block of ib
+ *  columns at a time, and the block reflectors are stored backward
+ *  (CoreBlasBackward), so that they are applied by coreblas_dtsmql with
+ *  the same update as coreblas_dtsmqr.
+ *
+ *******************************************************************************
+ *
+ * @param[in] m
+ *         The number of rows of the tile A2. m >= 0.
+ *
+ * @param[in] n
+ *         The number of rows of the tile A1.
+ *         The number of columns of the tiles A1 and A2. n >= 0.
+ *
+ * @param[in] ib
+ *         The inner-blocking size.  ib >= 0.
+ *
+ * @param[in,out] A1
+ *         On entry, the n-by-n tile A1.
+ *         On exit, the elements on and below the diagonal of the array
+ *         contain the n-by-n lower triangular tile L;
+ *         the elements above the diagonal are not referenced.
+ *
+ * @param[in] lda1
+ *         The leading dimension of the array A1. lda1 >= max(1,n).
+ *
+ * @param[in,out] A2
+ *         On entry, the m-by-n tile A2.
+ *         On exit, all the elements with the array tau, represent
+ *         the orthogonal tile Q as a product of elementary reflectors
+ *         (see Further Details).
+ *
+ * @param[in] lda2
+ *         The leading dimension of the tile A2. lda2 >= max(1,m).
+ *
+ * @param[out] T
+ *         The ib-by-n triangular factor T of the block reflector.
+ *         T is lower triangular by block (economic storage);
+ *         The rest of the array is not referenced.
+ *
+ * @param[in] ldt
+ *         The leading dimension of the array T. ldt >= ib.
+ *
+ * @param tau
+ *         Auxiliary workspace array of length n.
+ *
+ * @param work
+ *         Auxiliary workspace array of length
+ *         coreblas_dtsqlt_lwork(m, n, ib).
+ *
+ *******************************************************************************
+ *
+ * @retval CoreBlasSuccess successful exit
+ * @retval < 0 if -i, the i-th argument had an illegal value
+ *
+ *******************************************************************************
+ *
+ * Further Details
+ * ===============
+ *
+ *  The matrix Q is represented as a product of elementary reflectors
+ *
+ *     Q = H(n) . . . H(2) H(1)
+ *
+ *  Each H(j) has the form
+ *
+ *     H(j) = I - tau * v * v^T
+ *
+ *  where tau is a scalar and v is a vector with v(m+j) = 1 and
+ *  v(m+1:m+n) = 0 elsewhere; v(1:m) is stored on exit in A2(1:m,j).
+ *
+ ******************************************************************************/
+__attribute__((weak))
+int coreblas_dtsqlt(int m, int n, int ib,
+                    double *A1, int lda1,
+                    double *A2, int lda2,
+                    double *T,  int ldt,
+                    double *tau,
+                    double *work)
+{
+#ifndef COREBLAS_UNCHECKED
+    // Check input arguments.
+    if (m < 0) {
+        coreblas_error("illegal value of m");
+        return -1;
+    }
+    if (n < 0) {
+        coreblas_error("illegal value of n");
+        return -2;
+    }
+    if (ib < 0) {
+        coreblas_error("illegal value of ib");
+        return -3;
+    }
+    if (A1 == NULL) {
+        coreblas_error("NULL A1");
+        return -4;
+    }
+    if (lda1 < imax(1, n) && n > 0) {
+        coreblas_error("illegal value of lda1");
+        return -5;
+    }
+    if (A2 == NULL) {
+        coreblas_error("NULL A2");
+        return -6;
+    }
+    if (lda2 < imax(1, m) && m > 0) {
+        coreblas_error("illegal value of lda2");
+        return -7;
+    }
+    if (T == NULL) {
+        coreblas_error("NULL T");
+        return -8;
+    }
+    if (ldt < imax(1, ib) && ib > 0) {
+        coreblas_error("illegal value of ldt");
+        return -9;
+    }
+    if (tau == NULL) {
+        coreblas_error("NULL tau");
+        return -10;
+    }
+    if (work == NULL) {
+        coreblas_error("NULL work");
+        return -11;
+    }
+#endif
+
+    // quick return
+    if (m == 0 || n == 0 || ib == 0)
+        return CoreBlasSuccess;
+
+    static double zone  = 1.0;
+    static double zzero = 0.0;
+
+    for (int ii = ((n-1)/ib)*ib; ii >= 0; ii -= ib) {
+        int sb = imin(n-ii, ib);
+        for (int i = sb-1; i >= 0; i--) {
+            int j = ii+i;
+
+            // Generate elementary reflector H(j) to annihilate A2(0:m, j).
+#ifdef COREBLAS_USE_64BIT_BLAS
+            LAPACKE_dlarfg_work64_(m+1, &A1[lda1*j+j], &A2[lda2*j], 1, &tau[j]);
+#else
+            LAPACKE_dlarfg_work(m+1, &A1[lda1*j+j], &A2[lda2*j], 1, &tau[j]);
+#endif
+
+            if (i > 0) {
+                // Apply H(j)^T to the columns ii:j-1 from the left.
+                double alpha = -(tau[j]);
+#ifdef COREBLAS_USE_64BIT_BLAS
+                cblas_dcopy64_(i, &A1[lda1*ii+j], lda1, work, 1);
+#else
+                cblas_dcopy(i, &A1[lda1*ii+j], lda1, work, 1);
+#endif
+
+#ifdef COMPLEX
+#ifdef COREBLAS_USE_64BIT_BLAS
+                LAPACKE_dlacgv64_(i, work, 1);
+#else
+                LAPACKE_dlacgv_work(i, work, 1);
+#endif
+#endif
+
+#ifdef COREBLAS_USE_64BIT_BLAS
+                cblas_dgemv64_(CblasColMajor,
+                               (CBLAS_TRANSPOSE)CoreBlasTrans,
+                               m, i,
+                               (zone), &A2[lda2*ii], lda2,
+                                                  &A2[lda2*j],  1,
+                               (zone), work, 1);
+#else
+                cblas_dgemv(CblasColMajor,
+                            (CBLAS_TRANSPOSE)CoreBlasTrans,
+                            m, i,
+                            (zone), &A2[lda2*ii], lda2,
+                                               &A2[lda2*j],  1,
+                            (zone), work, 1);
+#endif
+
+#ifdef COMPLEX
+#ifdef COREBLAS_USE_64BIT_BLAS
+                LAPACKE_dlacgv64_(i, work, 1);
+#else
+                LAPACKE_dlacgv_work(i, work, 1);
+#endif
+#endif
+
+#ifdef COREBLAS_USE_64BIT_BLAS
+                cblas_daxpy64_(i, (alpha), work, 1,
+                               &A1[lda1*ii+j], lda1);
+#else
+                cblas_daxpy(i, (alpha), work, 1,
+                            &A1[lda1*ii+j], lda1);
+#endif
+
+#ifdef COMPLEX
+#ifdef COREBLAS_USE_64BIT_BLAS
+                LAPACKE_dlacgv64_(i, work, 1);
+#else
+                LAPACKE_dlacgv_work(i, work, 1);
+#endif
+#endif
+
+#ifdef COREBLAS_USE_64BIT_BLAS
+                cblas_dger64_(CblasColMajor,
+                               m, i,
+                               (alpha), &A2[lda2*j], 1,
+                                                   work, 1,
+                                                   &A2[lda2*ii], lda2);
+#else
+                cblas_dger(CblasColMajor,
+                            m, i,
+                            (alpha), &A2[lda2*j], 1,
+                                                work, 1,
+                                                &A2[lda2*ii], lda2);
+#endif
+            }
+
+            // Calculate T.
+            // T(i+1:sb, i) = -tau * T(i+1:sb, i+1:sb) * V(:, i+1:sb)^T * V(:, i)
+            if (i < sb-1) {
+                double alpha = -tau[j];
+#ifdef COREBLAS_USE_64BIT_BLAS
+                cblas_dgemv64_(CblasColMajor,
+                               (CBLAS_TRANSPOSE)CoreBlasTrans,
+                               m, sb-i-1,
+                               (alpha), &A2[lda2*(j+1)], lda2,
+                                                   &A2[lda2*j], 1,
+                               (zzero), &T[ldt*j+i+1], 1);
+
+                cblas_dtrmv64_(CblasColMajor, (CBLAS_UPLO)CoreBlasLower,
+                               (CBLAS_TRANSPOSE)CoreBlasNoTrans,
+                               (CBLAS_DIAG)CoreBlasNonUnit,
+                               sb-i-1,
+                               &T[ldt*(j+1)+i+1], ldt,
+                               &T[ldt*j+i+1], 1);
+#else
+                cblas_dgemv(CblasColMajor,
+                            (CBLAS_TRANSPOSE)CoreBlasTrans,
+                            m, sb-i-1,
+                            (alpha), &A2[lda2*(j+1)], lda2,
+                                                &A2[lda2*j], 1,
+                            (zzero), &T[ldt*j+i+1], 1);
+
+                cblas_dtrmv(CblasColMajor, (CBLAS_UPLO)CoreBlasLower,
+                            (CBLAS_TRANSPOSE)CoreBlasNoTrans,
+                            (CBLAS_DIAG)CoreBlasNonUnit,
+                            sb-i-1,
+                            &T[ldt*(j+1)+i+1], ldt,
+                            &T[ldt*j+i+1], 1);
+#endif
+            }
+            T[ldt*j+i] = tau[j];
+        }
+
+        // Apply the block reflector to the columns on the left.
+        if (ii > 0) {
+            coreblas_dtsmql_nocheck(CoreBlasLeft, CoreBlasTrans,
+                                    sb, ii, m, ii, sb, ib,
+                                    &A1[ii], lda1,
+                                    A2, lda2,
+                                    &A2[lda2*ii], lda2,
+                                    &T[ldt*ii], ldt,
+                                    work, ib);
+        }
+    }
+
+    return CoreBlasSuccess;
+}
+
+/***************************************************************************//**
+ *
+ * @ingroup core_tsqlt
+ *
+ *  Returns the minimum length of the array work of coreblas_dtsqlt
+ *  for the given dimensions.
+ *
+ *******************************************************************************
+ *
+ * @param[in] m
+ *         The number of rows of the tile A2.
+ *
+ * @param[in] n
+ *         The number of columns of the tiles A1 and A2.
+ *
+ * @param[in] ib
+ *         The inner-blocking size.
+ *
+ *******************************************************************************
+ *
+ * @retval the length of work, at least 1.
+ *
+ ******************************************************************************/
+size_t coreblas_dtsqlt_lwork(int m, int n, int ib)
+{
+    return imax(1, imin(ib, n))*(size_t)imax(1, n);
+}
@@ -0,0 +1,331 @@
+/**
+ *
+ * @file
+ *
+ *  COREBLAS is a software package provided by:
+ *  University of Tennessee, US,
+ *  University of Manchester, UK.
+ *
+ * @generated from core_blas/core_ztsqrt_rec.c, normal z -> d, Fri Oct 16 03:37:04 2026
+ *
+ **/
+
+#include <coreblas.h>
+#include "coreblas_types.h"
+#include "coreblas_internal.h"
+#include "core_lapack.h"
+
+// Panels of at most this many columns are factored one column at a time.
+#define COREBLAS_TSQRT_LEAF 8
+
+/******************************************************************************/
+// Factors the n-by-n triangle A1 on top of the m-by-n tile A2 one column
+// at a time and accumulates the n-by-n triangular factor T column by column.
+static void core_dtsqrt_leaf(int m, int n,
+                             double *A1, int lda1,
+                             double *A2, int lda2,
+                             double *T,  int ldt,
+                             double *tau,
+                             double *work)
+{
+    static double zone  = 1.0;
+    static double zzero = 0.0;
+
+    for (int i = 0; i < n; i++) {
+        // Generate elementary reflector H(i) to annihilate A2(0:m, i).
+#ifdef COREBLAS_USE_64BIT_BLAS
+        LAPACKE_dlarfg_work64_(m+1, &A1[lda1*i+i], &A2[lda2*i], 1, &tau[i]);
+#else
+        LAPACKE_dlarfg_work(m+1, &A1[lda1*i+i], &A2[lda2*i], 1, &tau[i]);
+#endif
+
+        int ni = n-i-1;
+        if (ni > 0) {
+            // Apply H(i)^T to [ A1(i, i+1:n); A2(0:m, i+1:n) ] from the left.
+            // w = A1(i, i+1:n)^T + A2(0:m, i+1:n)^T v
+            double alpha = -(tau[i]);
+            for (int j = 0; j < ni; j++)
+                work[j] = (A1[lda1*(i+1+j)+i]);
+#ifdef COREBLAS_USE_64BIT_BLAS
+            cblas_dgemv64_(CblasColMajor, (CBLAS_TRANSPOSE)CoreBlasTrans,
+                           m, ni,
+                           (zone), &A2[lda2*(i+1)], lda2,
+                                              &A2[lda2*i], 1,
+                           (zone), work, 1);
+#else
+            cblas_dgemv(CblasColMajor, (CBLAS_TRANSPOSE)CoreBlasTrans,
+                        m, ni,
+                        (zone), &A2[lda2*(i+1)], lda2,
+                                           &A2[lda2*i], 1,
+                        (zone), work, 1);
+#endif
+            for (int j = 0; j < ni; j++)
+                A1[lda1*(i+1+j)+i] += alpha*(work[j]);
+#ifdef COREBLAS_USE_64BIT_BLAS
+            cblas_dger64_(CblasColMajor,
+                           m, ni,
+                           (alpha), &A2[lda2*i], 1,
+                                               work, 1,
+                                               &A2[lda2*(i+1)], lda2);
+#else
+            cblas_dger(CblasColMajor,
+                        m, ni,
+                        (alpha), &A2[lda2*i], 1,
+                                            work, 1,
+                                            &A2[lda2*(i+1)], lda2);
+#endif
+        }
+
+        // T(0:i, i) = -tau(i) T(0:i, 0:i) A2(0:m, 0:i)^T A2(0:m, i)
+        if (i > 0) {
+            double alpha = -tau[i];
+#ifdef COREBLAS_USE_64BIT_BLAS
+            cblas_dgemv64_(CblasColMajor, (CBLAS_TRANSPOSE)CoreBlasTrans,
+                           m, i,
+                           (alpha), A2, lda2,
+                                               &A2[lda2*i], 1,
+                           (zzero), &T[ldt*i], 1);
+
+            cblas_dtrmv64_(CblasColMajor, CblasUpper,
+                           CblasNoTrans, CblasNonUnit,
+                           i,
+                           T, ldt,
+                           &T[ldt*i], 1);
+#else
+            cblas_dgemv(CblasColMajor, (CBLAS_TRANSPOSE)CoreBlasTrans,
+                        m, i,
+                        (alpha), A2, lda2,
+                                            &A2[lda2*i], 1,
+                        (zzero), &T[ldt*i], 1);
+
+            cblas_dtrmv(CblasColMajor, CblasUpper,
+                        CblasNoTrans, CblasNonUnit,
+                        i,
+                        T, ldt,
+                        &T[ldt*i], 1);
+#endif
+        }
+        T[ldt*i+i] = tau[i];
+    }
+}
+
+/******************************************************************************/
+// Recursive ts QR factorization of the n-by-n triangle A1 on top of the
+// m-by-n tile A2. The left half of the columns is factored and applied
+// to the right half with dparfb, the right half is factored, and the
+// off-diagonal block of T is merged with level 3 operations by
+// coreblas_dlarft_pent_merge:
+//     T12 = -T11 (V1^T V2) T22,
+// where the identity parts of V1 and V2 do not overlap, so that
+// V1^T V2 = A2(:, 0:n1)^T A2(:, n1:n).
+static void core_dtsqrt_rec(int m, int n,
+                            double *A1, int lda1,
+                            double *A2, int lda2,
+                            double *T,  int ldt,
+                            double *tau,
+                            double *work)
+{
+    if (n <= COREBLAS_TSQRT_LEAF) {
+        core_dtsqrt_leaf(m, n, A1, lda1, A2, lda2, T, ldt, tau, work);
+        return;
+    }
+
+    int n1 = n/2;
+    int n2 = n-n1;
+
+    double *T22 = &T[ldt*n1+n1];
+
+    core_dtsqrt_rec(m, n1, A1, lda1, A2, lda2, T, ldt, tau, work);
+
+    coreblas_dparfb_nocheck(CoreBlasLeft, CoreBlasTrans,
+                            CoreBlasForward, CoreBlasColumnwise,
+                            n1, n2, m, n2, n1, 0,
+                            &A1[lda1*n1], lda1,
+                            &A2[lda2*n1], lda2,
+                            A2, lda2,
+                            T,  ldt,
+                            work, n1);
+
+    core_dtsqrt_rec(m, n2, &A1[lda1*n1+n1], lda1, &A2[lda2*n1], lda2,
+                    T22, ldt, &tau[n1], work);
+
+    // T12 = -T11 A2(:, 0:n1)^T A2(:, n1:n) T22
+    coreblas_dlarft_pent_merge(CoreBlasColumnwise, m, n1, n2, 0,
+                               A2, lda2, T, ldt);
+}
+
+/***************************************************************************//**
+ *
+ * @ingroup core_tsqrt
+ *
+ * Computes a QR factorization of a rectangular matrix
+ * formed by coupling an n-by-n upper triangular tile A1
+ * on top of an m-by-n tile A2:
+ *
+ *    | A1 | = Q * R
+ *    | A2 |
+ *
+ * Same as coreblas_dtsqrt, but each ib-wide panel is factored recursively
+ * (Elmroth-Gustavson), so that most of the panel operations are level 3
+ * BLAS. The output has the same layout as coreblas_dtsqrt and can be
+ * applied with coreblas_dtsmqr.
+ *
+ *******************************************************************************
+ *
+ * @param[in] m
+ *         The number of rows of the tile A2. m >= 0.
+ *
+ * @param[in] n
+ *         The number of rows of the tile A1.
+ *         The number of columns of the tiles A1 and A2. n >= 0.
+ *
+ * @param[in] ib
+ *         The inner-blocking size.  ib >= 0.
+ *
+ * @param[in,out] A1
+ *         On entry, the n-by-n tile A1.
+ *         On exit, the elements on and above the diagonal of the array
+ *         contain the n-by-n upper trapezoidal tile R;
+ *         the elements below the diagonal are not referenced.
+ *
+ * @param[in] lda1
+ *         The leading dimension of the array A1. lda1 >= max(1,n).
+ *
+ * @param[in,out] A2
+ *         On entry, the m-by-n tile A2.
+ *         On exit, all the elements with the array tau, represent
+ *         the orthogonal tile Q as a product of elementary reflectors.
+ *
+ * @param[in] lda2
+ *         The leading dimension of the tile A2. lda2 >= max(1,m).
+ *
+ * @param[out] T
+ *         The ib-by-n triangular factor T of the block reflector.
+ *         T is upper triangular by block (economic storage);
+ *         The rest of the array is not referenced.
+ *
+ * @param[in] ldt
+ *         The leading dimension of the array T. ldt >= ib.
+ *
+ * @param tau
+ *         Auxiliary workspace array of length n.
+ *
+ * @param work
+ *         Auxiliary workspace array of length ib*n.
+ *
+ *******************************************************************************
+ *
+ * @retval CoreBlasSuccess successful exit
+ * @retval < 0 if -i, the i-th argument had an illegal value
+ *
+ ******************************************************************************/
+__attribute__((weak))
+int coreblas_dtsqrt_rec(int m, int n, int ib,
+                        double *A1, int lda1,
+                        double *A2, int lda2,
+                        double *T,  int ldt,
+                        double *tau,
+                        double *work)
+{
+#ifndef COREBLAS_UNCHECKED
+    // Check input arguments.
+    if (m < 0) {
+        coreblas_error("illegal value of m");
+        return -1;
+    }
+    if (n < 0) {
+        coreblas_error("illegal value of n");
+        return -2;
+    }
+    if (ib < 0) {
+        coreblas_error("illegal value of ib");
+        return -3;
+    }
+    if (A1 == NULL) {
+        coreblas_error("NULL A1");
+        return -4;
+    }
+    if (lda1 < imax(1, n) && n > 0) {
+        coreblas_error("illegal value of lda1");
+        return -5;
+    }
+    if (A2 == NULL) {
+        coreblas_error("NULL A2");
+        return -6;
+    }
+    if (lda2 < imax(1, m) && m > 0) {
+        coreblas_error("illegal value of lda2");
+        return -7;
+    }
+    if (T == NULL) {
+        coreblas_error("NULL T");
+        return -8;
+    }
+    if (ldt < imax(1, ib) && ib > 0) {
+        coreblas_error("illegal value of ldt");
+        return -9;
+    }
+    if (tau == NULL) {
+        coreblas_error("NULL tau");
+        return -10;
+    }
+    if (work == NULL) {
+        coreblas_error("NULL work");
+        return -11;
+    }
+#endif
+
+    // quick return
+    if (m == 0 || n == 0 || ib == 0)
+        return CoreBlasSuccess;
+
+    for (int ii = 0; ii < n; ii += ib) {
+        int sb = imin(n-ii, ib);
+
+        core_dtsqrt_rec(m, sb,
+                        &A1[lda1*ii+ii], lda1,
+                        &A2[lda2*ii], lda2,
+                        &T[ldt*ii], ldt,
+                        &tau[ii], work);
+
+        if (n > ii+sb) {
+            coreblas_dtsmqr_nocheck(CoreBlasLeft, CoreBlasTrans,
+                                    sb, n-(ii+sb), m, n-(ii+sb), sb, sb,
+                                    &A1[lda1*(ii+sb)+ii], lda1,
+                                    &A2[lda2*(ii+sb)], lda2,
+                                    &A2[lda2*ii], lda2,
+                                    &T[ldt*ii], ldt,
+                                    work, sb);
+        }
+    }
+
+    return CoreBlasSuccess;
+}
+
+/***************************************************************************//**
+ *
+ * @ingroup core_tsqrt
+ *
+ *  Returns the minimum length of the array work of coreblas_dtsqrt_rec
+ *  for the given dimensions.
+ *
+ *******************************************************************************
+ *
+ * @param[in] m
+ *         The number of rows of the tile A2.
+ *
+ * @param[in] n
+ *         The number of columns of the tiles A1 and A2.
+ *
+ * @param[in] ib
+ *         The inner-blocking size.
+ *
+ *******************************************************************************
+ *
+ * @retval the length of work, at least 1.
+ *
+ ******************************************************************************/
+size_t coreblas_dtsqrt_rec_lwork(int m, int n, int ib)
+{
+    return imax(1, imin(ib, n))*(size_t)imax(1, n);
+}
@@ -0,0 +1,308 @@
+/**
+ *
+ * @file
+ *
+ *  COREBLAS is a software package provided by:
+ *  University of Tennessee, US,
+ *  University of Manchester, UK.
+ *
+ * @generated from core_blas/core_zttqrt.c, normal z -> d, Fri Oct 16 03:37:05 2026
+ *
+ **/
+
+#include <coreblas.h>
+#include "coreblas_types.h"
+#include "coreblas_internal.h"
+#include "core_lapack.h"
+
+
+
+// This will be swapped during the automatic code generation.
+#undef REAL
+#define REAL
+
+/***************************************************************************//**
+ *
+ * @ingroup core_ttqrt
+ *
+ * Computes a QR factorization of a rectangular matrix
+ * formed by coupling an n-by-n upper triangular tile A1
+ * on top of an m-by-n upper triangular tile A2:
+ *
+ *    | A1 | = Q * R
+ *    | A2 |
+ *
+ *******************************************************************************
+ *
+ * @param[in] m
+ *         The number of columns of the tile A2. m >= 0.
+ *
+ * @param[in] n
+ *         The number of rows of the tile A1.
+ *         The number of columns of the tiles A1 and A2. n >= 0.
+ *
+ * @param[in] ib
+ *         The inner-blocking size.  ib >= 0.
+ *
+ * @param[in,out] A1
+ *         On entry, the n-by-n tile A1.
+ *         On exit, the elements on and above the diagonal of the array
+ *         contain the n-by-n upper trapezoidal tile R;
+ *         the elements below the diagonal are not referenced.
+ *
+ * @param[in] lda1
+ *         The leading dimension of the array A1. lda1 >= max(1,n).
+ *
+ * @param[in,out] A2
+ *         On entry, the m-by-n upper triangular tile A2.
+ *         On exit, the elements on and above the diagonal of the array
+ *         with the matrix T represent
+ *         the orthogonal tile Q as a product of elementary reflectors
+ *
+ * @param[in] lda2
+ *         The leading dimension of the tile A2. lda2 >= max(1,m).
+ *
+ * @param[out] T
+ *         The ib-by-n triangular factor T of the block reflector.
+ *         T is upper triangular by block (economic storage);
+ *         The rest of the array is not referenced.
+ *
+ * @param[in] ldt
+ *         The leading dimension of the array T. ldt >= ib.
+ *
+ * @param tau
+ *         Auxiliary workspace array of length n.
+ *
+ * @param work
+ *         Auxiliary workspace array of length ib*n.
+ *
+ *******************************************************************************
+ *
+ * @retval CoreBlasSuccess successful exit
+ * @retval < 0 if -i, the i-th argument had an illegal value
+ *
+ ******************************************************************************/
+__attribute__((weak))
+int coreblas_dttqrt(int m, int n, int ib,
+                double *A1, int lda1,
+                double *A2, int lda2,
+                double *T,  int ldt,
+                double *tau,
+                double *work)
+{
+#ifndef COREBLAS_UNCHECKED
+    // Check input arguments.
+    if (m < 0) {
+        coreblas_error("illegal value of m");
+        return -1;
+    }
+    if (n < 0) {
+        coreblas_error("illegal value of n");
+        return -2;
+    }
+    if (ib < 0) {
+        coreblas_error("illegal value of ib");
+        return -3;
+    }
+    if (A1 == NULL) {
+        coreblas_error("NULL A1");
+        return -4;
+    }
+    if (lda1 < imax(1, m) && m > 0) {
+        coreblas_error("illegal value of lda1");
+        return -5;
+    }
+    if (A2 == NULL) {
+        coreblas_error("NULL A2");
+        return -6;
+    }
+    if (lda2 < imax(1, m) && m > 0) {
+        coreblas_error("illegal value of lda2");
+        return -7;
+    }
+    if (T == NULL) {
+        coreblas_error("NULL T");
+        return -8;
+    }
+    if (ldt < imax(1, ib) && ib > 0) {
+        coreblas_error("illegal value of ldt");
+        return -9;
+    }
+    if (tau == NULL) {
+        coreblas_error("NULL tau");
+        return -10;
+    }
+    if (work == NULL) {
+        coreblas_error("NULL work");
+        return -11;
+    }
+#endif
+
+    // quick return
+    if ((m == 0) || (n == 0) || (ib == 0))
+        return CoreBlasSuccess;
+
+    // TODO: Need to check why some cases require this to avoid
+    // uninitialized values
+    //core_dlaset(CoreBlasGeneral, ib, n, 0.0, 0.0, T, ldt);
+
+    for (int ii = 0; ii < n; ii += ib) {
+        int sb = imin(n-ii, ib);
+        for (int i = 0; i < sb; i++) {
+            int j  = ii + i;
+            int mi = imin(j+1, m);
+            int ni = sb-i-1;
+    #ifdef COREBLAS_USE_64BIT_BLAS
+                // Generate elementary reflector H(j) to annihilate A2(1:mi, j).
+        LAPACKE_dlarfg_work64_(
+                    mi+1, &A1[lda1*j+j], &A2[lda2*j], 1, &tau[j]);
+    #else
+                // Generate elementary reflector H(j) to annihilate A2(1:mi, j).
+        LAPACKE_dlarfg_work(
+                    mi+1, &A1[lda1*j+j], &A2[lda2*j], 1, &tau[j]);
+    #endif
+
+
+            if (ni > 0) {
+            #ifdef COREBLAS_USE_64BIT_BLAS
+                            // Apply H(j-1) to A(j:m, j+1:ii+ib) from the left.
+                cblas_dcopy64_(
+                    ni,
+                    &A1[lda1*(j+1)+j], lda1,
+                    work, 1);
+            #else
+                            // Apply H(j-1) to A(j:m, j+1:ii+ib) from the left.
+                cblas_dcopy(
+                    ni,
+                    &A1[lda1*(j+1)+j], lda1,
+                    work, 1);
+            #endif
+
+#ifdef COMPLEX
+    #ifdef COREBLAS_USE_64BIT_BLAS
+        LAPACKE_dlacgv_work64_(ni, work, 1);
+    #else
+        LAPACKE_dlacgv_work(ni, work, 1);
+    #endif
+                
+#endif
+                double zone  = 1.0;
+#ifdef COREBLAS_USE_64BIT_BLAS
+        cblas_dgemv64_(
+            CblasColMajor, (CBLAS_TRANSPOSE)CoreBlasTrans,
+            mi, ni,
+            (zone), &A2[lda2*(j+1)], lda2,
+            &A2[lda2*j],     1,
+            (zone), work,            1);
+#else
+        cblas_dgemv(
+            CblasColMajor, (CBLAS_TRANSPOSE)CoreBlasTrans,
+            mi, ni,
+            (zone), &A2[lda2*(j+1)], lda2,
+            &A2[lda2*j],     1,
+            (zone), work,            1);
+#endif
+
+#ifdef COMPLEX
+    #ifdef COREBLAS_USE_64BIT_BLAS
+        LAPACKE_dlacgv_work64_(ni, work, 1);
+    #else
+        LAPACKE_dlacgv_work(ni, work, 1);
+    #endif               
+#endif
+                double alpha = -(tau[j]);
+    #ifdef COREBLAS_USE_64BIT_BLAS
+        cblas_daxpy64_(
+            ni, (alpha),
+            work, 1,
+            &A1[lda1*(j+1)+j], lda1);
+    #else
+        cblas_daxpy(
+            ni, (alpha),
+            work, 1,
+            &A1[lda1*(j+1)+j], lda1);
+    #endif
+
+#ifdef COMPLEX
+    #ifdef COREBLAS_USE_64BIT_BLAS
+        LAPACKE_dlacgv_work64_(ni, work, 1);
+    #else
+        LAPACKE_dlacgv_work(ni, work, 1);
+    #endif               
+#endif
+
+    #ifdef COREBLAS_USE_64BIT_BLAS
+        cblas_dger64_(
+                CblasColMajor, mi, ni,
+                (alpha), &A2[lda2*j], 1,
+                work, 1,
+                &A2[lda2*(j+1)], lda2);
+    #else
+        cblas_dger(
+                CblasColMajor, mi, ni,
+                (alpha), &A2[lda2*j], 1,
+                work, 1,
+                &A2[lda2*(j+1)], lda2);
+    #endif
+
+            }
+        }
+
+        // The reflectors of the block have mi rows, the last l of which
+        // form the upper trapezoid of A2.
+        int mi = imin(ii+sb, m);
+        int l  = imin(sb, imax(0, mi-ii));
+
+        // Calculate T.
+        coreblas_dlarft_pent(CoreBlasColumnwise, mi, sb, l,
+                             &A2[lda2*ii], lda2,
+                             &tau[ii],
+                             &T[ldt*ii], ldt);
+
+        // Apply Q^T to the rest of the matrix from the left.
+        if (n > ii+sb) {
+            int ni = n-(ii+sb);
+
+    coreblas_dparfb_nocheck(
+        CoreBlasLeft, CoreBlasTrans,
+        CoreBlasForward, CoreBlasColumnwise,
+        ib, ni, mi, ni, sb, l,             //replaced sb by ib
+        &A1[lda1*(ii+sb)+ii], lda1,
+        &A2[lda2*(ii+sb)], lda2,
+        &A2[lda2*ii], lda2,
+        &T[ldt*ii], ldt,
+        work, sb);
+
+        }
+    }
+
+    return CoreBlasSuccess;
+}
+
+/***************************************************************************//**
+ *
+ * @ingroup core_ttqrt
+ *
+ *  Returns the minimum length of the array work of coreblas_dttqrt
+ *  for the given dimensions.
+ *
+ *******************************************************************************
+ *
+ * @param[in] m
+ *         The number of rows of the tile A2.
+ *
+ * @param[in] n
+ *         The number of columns of the tiles A1 and A2.
+ *
+ * @param[in] ib
+ *         The inner-blocking size.
+ *
+ *******************************************************************************
+ *
+ * @retval the length of work, at least 1.
+ *
+ ******************************************************************************/
+size_t coreblas_dttqrt_lwork(int m, int n, int ib)
+{
+    return imax(1, imin(ib, n))*(size_t)imax(1, n);
+}
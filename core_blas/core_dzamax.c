@@ -12,10 +12,276 @@
 
 #include <coreblas.h>
 #include "coreblas_types.h"
+#include "coreblas_internal.h"
 #include "core_lapack.h"
 
 #include <math.h>
 
+// This will be swapped during the automatic code generation.
+#undef REAL
+#define COMPLEX
+#define PRECISION_z
+
+#if defined(__x86_64__) && defined(__GNUC__)
+#define COREBLAS_AMAX_X86
+#include <immintrin.h>
+#endif
+
+/******************************************************************************/
+// The absolute value of LAPACK's izamax: |re| + |im|.
+static inline double core_dzamax_abs(coreblas_complex64_t a)
+{
+#ifdef COMPLEX
+    return fabs(creal(a)) + fabs(cimag(a));
+#else
+    return fabs(a);
+#endif
+}
+
+/******************************************************************************/
+// Scalar search of x[i0:m] for an element larger than *amax.
+static inline void core_izamax_ref(int i0, int m, const coreblas_complex64_t *x,
+                                   int *ip, double *amax)
+{
+    for (int i = i0; i < m; i++) {
+        double absa = core_dzamax_abs(x[i]);
+        if (absa > *amax) {
+            *amax = absa;
+            *ip = i;
+        }
+    }
+}
+
+#ifdef COREBLAS_AMAX_X86
+/******************************************************************************/
+// AVX2: every lane keeps the first of its largest elements and its index,
+// with a compare and two blends. Two sets of registers are updated in turn
+// to halve the chain of dependencies. The lanes are merged at the end,
+// the smallest index winning the ties. Returns the number of elements
+// searched; the rest is left to core_izamax_ref().
+// In complex precisions, one horizontal add yields the absolute values
+// of two registers of (re, im) pairs, in the lane order of lidx0.
+__attribute__((target("avx2")))
+static int core_izamax_avx2(int m, const coreblas_complex64_t *x,
+                            int *ip, double *amax)
+{
+    int i = 0;
+#if defined(PRECISION_z) || defined(PRECISION_d)
+    const double *px = (const double*)x;
+    const __m256d sign = _mm256_set1_pd(-0.0);
+#if defined(PRECISION_z)
+    const __m256d lidx0 = _mm256_setr_pd(0.0, 2.0, 1.0, 3.0);
+#else
+    const __m256d lidx0 = _mm256_setr_pd(0.0, 1.0, 2.0, 3.0);
+#endif
+    const __m256d step = _mm256_set1_pd(8.0);
+    __m256d vmax[2], vidx[2], idx[2];
+    for (int k = 0; k < 2; k++) {
+        vmax[k] = _mm256_set1_pd(-1.0);
+        vidx[k] = _mm256_setzero_pd();
+        idx[k] = _mm256_add_pd(lidx0, _mm256_set1_pd(4.0*k));
+    }
+    for (; i+8 <= m; i += 8) {
+        for (int k = 0; k < 2; k++) {
+#if defined(PRECISION_z)
+            __m256d x0 = _mm256_loadu_pd(&px[2*(i+4*k)]);
+            __m256d x1 = _mm256_loadu_pd(&px[2*(i+4*k)+4]);
+            __m256d a = _mm256_hadd_pd(_mm256_andnot_pd(sign, x0),
+                                       _mm256_andnot_pd(sign, x1));
+#else
+            __m256d a = _mm256_andnot_pd(sign, _mm256_loadu_pd(&px[i+4*k]));
+#endif
+            __m256d gt = _mm256_cmp_pd(a, vmax[k], _CMP_GT_OQ);
+            vmax[k] = _mm256_blendv_pd(vmax[k], a, gt);
+            vidx[k] = _mm256_blendv_pd(vidx[k], idx[k], gt);
+            idx[k] = _mm256_add_pd(idx[k], step);
+        }
+    }
+    double lmax[8], lidx[8];
+    for (int k = 0; k < 2; k++) {
+        _mm256_storeu_pd(&lmax[4*k], vmax[k]);
+        _mm256_storeu_pd(&lidx[4*k], vidx[k]);
+    }
+    for (int l = 0; l < 8; l++) {
+        if (lmax[l] > *amax || (lmax[l] == *amax && (int)lidx[l] < *ip)) {
+            *amax = lmax[l];
+            *ip = (int)lidx[l];
+        }
+    }
+#else
+    // The indices are exact in single precision below 2^24.
+    if (m >= (1 << 24))
+        return 0;
+
+    const float *px = (const float*)x;
+    const __m256 sign = _mm256_set1_ps(-0.0f);
+#if defined(PRECISION_c)
+    const __m256 lidx0 = _mm256_setr_ps(0.0f, 1.0f, 4.0f, 5.0f,
+                                        2.0f, 3.0f, 6.0f, 7.0f);
+#else
+    const __m256 lidx0 = _mm256_setr_ps(0.0f, 1.0f, 2.0f, 3.0f,
+                                        4.0f, 5.0f, 6.0f, 7.0f);
+#endif
+    const __m256 step = _mm256_set1_ps(16.0f);
+    __m256 vmax[2], vidx[2], idx[2];
+    for (int k = 0; k < 2; k++) {
+        vmax[k] = _mm256_set1_ps(-1.0f);
+        vidx[k] = _mm256_setzero_ps();
+        idx[k] = _mm256_add_ps(lidx0, _mm256_set1_ps(8.0f*k));
+    }
+    for (; i+16 <= m; i += 16) {
+        for (int k = 0; k < 2; k++) {
+#if defined(PRECISION_c)
+            __m256 x0 = _mm256_loadu_ps(&px[2*(i+8*k)]);
+            __m256 x1 = _mm256_loadu_ps(&px[2*(i+8*k)+8]);
+            __m256 a = _mm256_hadd_ps(_mm256_andnot_ps(sign, x0),
+                                      _mm256_andnot_ps(sign, x1));
+#else
+            __m256 a = _mm256_andnot_ps(sign, _mm256_loadu_ps(&px[i+8*k]));
+#endif
+            __m256 gt = _mm256_cmp_ps(a, vmax[k], _CMP_GT_OQ);
+            vmax[k] = _mm256_blendv_ps(vmax[k], a, gt);
+            vidx[k] = _mm256_blendv_ps(vidx[k], idx[k], gt);
+            idx[k] = _mm256_add_ps(idx[k], step);
+        }
+    }
+    float lmax[16], lidx[16];
+    for (int k = 0; k < 2; k++) {
+        _mm256_storeu_ps(&lmax[8*k], vmax[k]);
+        _mm256_storeu_ps(&lidx[8*k], vidx[k]);
+    }
+    for (int l = 0; l < 16; l++) {
+        if (lmax[l] > *amax || (lmax[l] == *amax && (int)lidx[l] < *ip)) {
+            *amax = lmax[l];
+            *ip = (int)lidx[l];
+        }
+    }
+#endif
+    return i;
+}
+#endif // COREBLAS_AMAX_X86
+
+/******************************************************************************/
+// Returns the index of the first of the largest elements of x, skipping
+// all NaNs, and sets *amax to its absolute value; returns -1 and sets
+// *amax to -1 if there is none. Used by the pivot search of getrf.
+int coreblas_izamax_nonan(int m, const coreblas_complex64_t *x, double *amax)
+{
+    int ip = -1;
+    int i = 0;
+    *amax = -1.0;
+#ifdef COREBLAS_AMAX_X86
+    if (__builtin_cpu_supports("avx2"))
+        i = core_izamax_avx2(m, x, &ip, amax);
+#endif
+    core_izamax_ref(i, m, x, &ip, amax);
+    return ip;
+}
+
+/***************************************************************************//**
+ *
+ * @ingroup core_amax
+ *
+ *  Finds the first element of largest absolute value |re| + |im| of the
+ *  vector x, e.g., a tile column, as LAPACK's izamax, and returns both
+ *  its index and its absolute value, so that a pivot search does not
+ *  compute the absolute values twice.
+ *
+ *  With AVX2, every vector lane keeps its own maximum and index, and the
+ *  lanes are merged at the end. As in the reference izamax, NaNs are
+ *  skipped unless x[0] is one.
+ *
+ *******************************************************************************
+ *
+ * @param[in] m
+ *          The length of the vector x. m >= 0.
+ *
+ * @param[in] x
+ *          The vector x.
+ *
+ * @param[out] value
+ *          The largest absolute value, zero if m = 0.
+ *
+ *******************************************************************************
+ *
+ * @retval the 0-based index of the element, -1 if m = 0.
+ *
+ ******************************************************************************/
+__attribute__((weak))
+int coreblas_izamax(int m, const coreblas_complex64_t *x, double *value)
+{
+    if (m <= 0) {
+        *value = 0.0;
+        return -1;
+    }
+
+    *value = core_dzamax_abs(x[0]);
+    if (isnan(*value))
+        return 0;
+
+    return coreblas_izamax_nonan(m, x, value);
+}
+
+/***************************************************************************//**
+ *
+ * @ingroup core_amax
+ *
+ *  Finds the first element, in column-major order, of largest absolute
+ *  value |re| + |im| of the m-by-n tile A, searching each column as
+ *  coreblas_izamax. NaNs are skipped unless A(0,0) is one.
+ *
+ *******************************************************************************
+ *
+ * @param[in] m
+ *          The number of rows of the tile A. m >= 0.
+ *
+ * @param[in] n
+ *          The number of columns of the tile A. n >= 0.
+ *
+ * @param[in] A
+ *          The m-by-n tile.
+ *
+ * @param[in] lda
+ *          The leading dimension of the array A. lda >= max(1,m).
+ *
+ * @param[out] imax
+ *          The row of the element, -1 if the tile is empty.
+ *
+ * @param[out] jmax
+ *          The column of the element, -1 if the tile is empty.
+ *
+ * @param[out] value
+ *          The largest absolute value, zero if the tile is empty.
+ *
+ ******************************************************************************/
+__attribute__((weak))
+void coreblas_izamax_tile(int m, int n,
+                          const coreblas_complex64_t *A, int lda,
+                          int *imax, int *jmax, double *value)
+{
+    *imax = -1;
+    *jmax = -1;
+    *value = 0.0;
+    if (m <= 0 || n <= 0)
+        return;
+
+    *imax = 0;
+    *jmax = 0;
+    *value = core_dzamax_abs(A[0]);
+    if (isnan(*value))
+        return;
+
+    for (int j = 0; j < n; j++) {
+        double absa;
+        int i = coreblas_izamax_nonan(m, &A[(size_t)lda*j], &absa);
+        if (absa > *value) {
+            *imax = i;
+            *jmax = j;
+            *value = absa;
+        }
+    }
+}
+
 /******************************************************************************/
 void coreblas_kernel_dzamax(int colrow, int m, int n,
                      const coreblas_complex64_t *A, int lda,
@@ -23,25 +289,17 @@ void coreblas_kernel_dzamax(int colrow, int m, int n,
 {
     switch (colrow) {
     case CoreBlasColumnwise:
-
-        for (int j = 0; j < n; j++) {
-            values[j] = coreblas_dcabs1(A[lda*j]);
-            for (int i = 1; i < m; i++) {
-                double tmp = coreblas_dcabs1(A[lda*j+i]);
-                if (tmp > values[j])
-                    values[j] = tmp;
-            }
-        }
+        for (int j = 0; j < n; j++)
+            coreblas_izamax(m, &A[lda*j], &values[j]);
         break;
     case CoreBlasRowwise:
- 
         for (int i = 0; i < m; i++)
-            values[i] = coreblas_dcabs1(A[i]);
+            values[i] = core_dzamax_abs(A[i]);
         for (int j = 1; j < n; j++) {
+            #pragma omp simd
             for (int i = 0; i < m; i++) {
-                double tmp = coreblas_dcabs1(A[lda*j+i]);
-                if (tmp > values[i])
-                    values[i] = tmp;
+                double tmp = core_dzamax_abs(A[lda*j+i]);
+                values[i] = tmp > values[i] ? tmp : values[i];
             }
         }
         break;
@@ -0,0 +1,216 @@
+/**
+ *
+ * @file
+ *
+ *  COREBLAS is a software package provided by:
+ *  University of Tennessee, US,
+ *  University of Manchester, UK.
+ *
+ * @generated from core_blas/core_zgelqt.c, normal z -> s, Fri Oct 16 03:36:58 2026
+ *
+ **/
+
+#include <coreblas.h>
+#include "coreblas_types.h"
+#include "coreblas_internal.h"
+#include "core_lapack.h"
+
+
+
+/***************************************************************************//**
+ *
+ * @ingroup core_gelqt
+ *
+ *  Computes the LQ factorization of an m-by-n tile A:
+ *  The factorization has the form
+ *    \f[
+ *        A = L \times Q
+ *    \f]
+ *  The tile Q is represented as a product of elementary reflectors
+ *    \f[
+ *        Q = H(k)^T . . . H(2)^T H(1)^T,
+ *    \f]
+ *  where \f$ k = min(m,n) \f$.
+ *
+ *  Each \f$ H(i) \f$ has the form
+ *    \f[
+ *        H(i) = I - \tau \times v \times v^T
+ *    \f]
+ *  where \f$ tau \f$ is a scalar, and \f$ v \f$ is a vector with
+ *  v(1:i-1) = 0 and v(i) = 1; v(i+1:n)^T is stored on exit in A(i,i+1:n),
+ *  and \f$ tau \f$ in tau(i).
+ *
+ *******************************************************************************
+ *
+ * @param[in] m
+ *          The number of rows of the tile A.  m >= 0.
+ *
+ * @param[in] n
+ *         The number of columns of the tile A.  n >= 0.
+ *
+ * @param[in] ib
+ *         The inner-blocking size.  ib >= 0.
+ *
+ * @param[in,out] A
+ *         On entry, the m-by-n tile A.
+ *         On exit, the elements on and below the diagonal of the array
+ *         contain the m-by-min(m,n) lower trapezoidal tile L (L is
+ *         lower triangular if m <= n); the elements above the diagonal,
+ *         with the array tau, represent the orthogonal tile Q as a
+ *         product of elementary reflectors (see Further Details).
+ *
+ * @param[in] lda
+ *         The leading dimension of the array A.  lda >= max(1,m).
+ *
+ * @param[out] T
+ *         The ib-by-m triangular factor T of the block reflector.
+ *         T is upper triangular by block (economic storage);
+ *         The rest of the array is not referenced.
+ *
+ * @param[in] ldt
+ *         The leading dimension of the array T. ldt >= ib.
+ *
+ * @param tau
+ *         Auxiliarry workspace array of length m.
+ *
+ * @param work
+ *         Auxiliary workspace array of length ib*m.
+ *
+ * @param[in] lwork
+ *         Size of the array work. Should be at least ib*m.
+ *
+ *******************************************************************************
+ *
+ * @retval CoreBlasSuccess successful exit
+ * @retval < 0 if -i, the i-th argument had an illegal value
+ *
+ ******************************************************************************/
+__attribute__((weak))
+int coreblas_sgelqt(int m, int n, int ib,
+                float *A, int lda,
+                float *T, int ldt,
+                float *tau,
+                float *work)
+{
+#ifndef COREBLAS_UNCHECKED
+    // Check input arguments.
+    if (m < 0) {
+        coreblas_error("illegal value of m");
+        return -1;
+    }
+    if (n < 0) {
+        coreblas_error("illegal value of n");
+        return -2;
+    }
+    if ((ib < 0) || ( (ib == 0) && ((m > 0) && (n > 0)) )) {
+        coreblas_error("illegal value of ib");
+        return -3;
+    }
+    if (A == NULL) {
+        coreblas_error("NULL A");
+        return -4;
+    }
+    if (lda < imax(1, m) && m > 0) {
+        coreblas_error("illegal value of lda");
+        return -5;
+    }
+    if (T == NULL) {
+        coreblas_error("NULL T");
+        return -6;
+    }
+    if (ldt < imax(1,ib) && ib > 0) {
+        coreblas_error("illegal value of ldt");
+        return -7;
+    }
+    if (tau == NULL) {
+        coreblas_error("NULL tau");
+        return -8;
+    }
+    if (work == NULL) {
+        coreblas_error("NULL work");
+        return -9;
+    }
+#endif
+
+    // quick return
+    if (m == 0 || n == 0 || ib == 0)
+        return CoreBlasSuccess;
+
+    int k = imin(m, n);
+    for (int i = 0; i < k; i += ib) {
+        int sb = imin(ib, k-i);
+        #ifdef COREBLAS_USE_64BIT_BLAS
+            LAPACKE_sgelq264_(LAPACK_COL_MAJOR,
+                        sb, n-i,
+                        &A[lda*i+i], lda,
+                        &tau[i]);
+        #else
+            LAPACKE_sgelq2_work(LAPACK_COL_MAJOR,
+                        sb, n-i,
+                        &A[lda*i+i], lda,
+                        &tau[i], work);
+        #endif
+
+        coreblas_slarft(CoreBlasRowwise, n-i, sb,
+                        &A[lda*i+i], lda,
+                        &tau[i],
+                        &T[ldt*i], ldt);
+
+        if (m > i+sb) {
+            // larfb_gemm multiplies by the whole sb-by-(n-i) block of V,
+            // so its diagonal is set to one and the L factor below it
+            // to zero, and both are restored after the update.
+            float *V = &A[lda*i+i];
+            float *L = &work[(size_t)(m-i-sb)*sb];
+            for (int j = 0; j < sb; j++) {
+                for (int l = j; l < sb; l++) {
+                    L[sb*j+l] = V[lda*j+l];
+                    V[lda*j+l] = 0.0;
+                }
+                V[lda*j+j] = 1.0;
+            }
+
+            coreblas_slarfb_gemm(CoreBlasRight, CoreBlasNoTrans,
+                                 CoreBlasForward, CoreBlasRowwise,
+                                 m-i-sb, n-i, sb,
+                                 V,                lda,
+                                 &T[ldt*i],        ldt,
+                                 &A[lda*i+(i+sb)], lda,
+                                 work, m-i-sb);
+
+            for (int j = 0; j < sb; j++)
+                for (int l = j; l < sb; l++)
+                    V[lda*j+l] = L[sb*j+l];
+        }
+    }
+
+    return CoreBlasSuccess;
+}
+
+/***************************************************************************//**
+ *
+ * @ingroup core_gelqt
+ *
+ *  Returns the minimum length of the array work of coreblas_sgelqt
+ *  for the given dimensions.
+ *
+ *******************************************************************************
+ *
+ * @param[in] m
+ *         The number of rows of the tile A.
+ *
+ * @param[in] n
+ *         The number of columns of the tile A.
+ *
+ * @param[in] ib
+ *         The inner-blocking size.
+ *
+ *******************************************************************************
+ *
+ * @retval the length of work, at least 1.
+ *
+ ******************************************************************************/
+size_t coreblas_sgelqt_lwork(int m, int n, int ib)
+{
+    return imax(1, imin(ib, imin(m, n)))*(size_t)imax(1, m);
+}
@@ -0,0 +1,310 @@
+/**
+ *
+ * @file
+ *
+ *  COREBLAS is a software package provided by:
+ *  University of Tennessee, US,
+ *  University of Manchester, UK.
+ *
+ * @generated from core_blas/core_zgemm_batched.c, normal z -> s, Fri Oct 16 03:36:56 2026
+ *
+ **/
+
+#include <coreblas.h>
+#include "coreblas_types.h"
+#include "coreblas_internal.h"
+#include "core_lapack.h"
+
+/***************************************************************************//**
+ *
+ * @ingroup core_gemm
+ *
+ *  Performs the matrix-matrix operations
+ *
+ *    \f[ C_i = \alpha [op( A_i )\times op( B_i )] + \beta C_i, \f]
+ *
+ *  for i = 0:batch-1, as coreblas_sgemm, on a batch of independent tiles
+ *  of the same dimensions given by arrays of pointers.
+ *
+ *  The arguments are checked once for the whole batch and the products
+ *  are distributed statically among the threads of an OpenMP parallel
+ *  region, so that a batch of small tiles is not bound by the cost of
+ *  the individual calls. A sequential BLAS should be used.
+ *
+ *******************************************************************************
+ *
+ * @param[in] transa
+ *          - CoreBlasNoTrans:   A_i is not transposed,
+ *          - CoreBlasTrans:     A_i is transposed,
+ *          - CoreBlasConjTrans: A_i is conjugate transposed.
+ *
+ * @param[in] transb
+ *          - CoreBlasNoTrans:   B_i is not transposed,
+ *          - CoreBlasTrans:     B_i is transposed,
+ *          - CoreBlasConjTrans: B_i is conjugate transposed.
+ *
+ * @param[in] m
+ *          The number of rows of the matrices op( A_i ) and C_i. m >= 0.
+ *
+ * @param[in] n
+ *          The number of columns of the matrices op( B_i ) and C_i. n >= 0.
+ *
+ * @param[in] k
+ *          The number of columns of the matrices op( A_i ) and the number
+ *          of rows of the matrices op( B_i ). k >= 0.
+ *
+ * @param[in] alpha
+ *          The scalar alpha.
+ *
+ * @param[in] A
+ *          Array of batch pointers to the lda-by-ka matrices A_i, where ka
+ *          is k when transa = CoreBlasNoTrans, and is m otherwise.
+ *
+ * @param[in] lda
+ *          The leading dimension of the arrays A_i.
+ *          When transa = CoreBlasNoTrans, lda >= max(1,m),
+ *          otherwise, lda >= max(1,k).
+ *
+ * @param[in] B
+ *          Array of batch pointers to the ldb-by-kb matrices B_i, where kb
+ *          is n when transb = CoreBlasNoTrans, and is k otherwise.
+ *
+ * @param[in] ldb
+ *          The leading dimension of the arrays B_i.
+ *          When transb = CoreBlasNoTrans, ldb >= max(1,k),
+ *          otherwise, ldb >= max(1,n).
+ *
+ * @param[in] beta
+ *          The scalar beta.
+ *
+ * @param[in,out] C
+ *          Array of batch pointers to the ldc-by-n matrices C_i.
+ *
+ * @param[in] ldc
+ *          The leading dimension of the arrays C_i. ldc >= max(1,m).
+ *
+ * @param[in] batch
+ *          The number of products. batch >= 0.
+ *
+ *******************************************************************************
+ *
+ * @retval CoreBlasSuccess successful exit
+ * @retval < 0 if -i, the i-th argument had an illegal value
+ *
+ ******************************************************************************/
+__attribute__((weak))
+int coreblas_sgemm_batched(coreblas_enum_t transa, coreblas_enum_t transb,
+                int m, int n, int k,
+                float alpha,
+                const float * const *A, int lda,
+                const float * const *B, int ldb,
+                float beta,
+                float * const *C, int ldc,
+                int batch)
+{
+#ifndef COREBLAS_UNCHECKED
+    // Check input arguments.
+    if (transa != CoreBlasNoTrans &&
+        transa != CoreBlasTrans &&
+        transa != CoreBlasTrans) {
+        coreblas_error("illegal value of transa");
+        return -1;
+    }
+    if (transb != CoreBlasNoTrans &&
+        transb != CoreBlasTrans &&
+        transb != CoreBlasTrans) {
+        coreblas_error("illegal value of transb");
+        return -2;
+    }
+    if (m < 0) {
+        coreblas_error("illegal value of m");
+        return -3;
+    }
+    if (n < 0) {
+        coreblas_error("illegal value of n");
+        return -4;
+    }
+    if (k < 0) {
+        coreblas_error("illegal value of k");
+        return -5;
+    }
+    if (batch > 0 && A == NULL) {
+        coreblas_error("NULL A");
+        return -7;
+    }
+    if (lda < imax(1, transa == CoreBlasNoTrans ? m : k)) {
+        coreblas_error("illegal value of lda");
+        return -8;
+    }
+    if (batch > 0 && B == NULL) {
+        coreblas_error("NULL B");
+        return -9;
+    }
+    if (ldb < imax(1, transb == CoreBlasNoTrans ? k : n)) {
+        coreblas_error("illegal value of ldb");
+        return -10;
+    }
+    if (batch > 0 && C == NULL) {
+        coreblas_error("NULL C");
+        return -12;
+    }
+    if (ldc < imax(1, m)) {
+        coreblas_error("illegal value of ldc");
+        return -13;
+    }
+    if (batch < 0) {
+        coreblas_error("illegal value of batch");
+        return -14;
+    }
+#endif
+
+    // quick return
+    if (m == 0 || n == 0 || batch == 0)
+        return CoreBlasSuccess;
+
+    #pragma omp parallel for schedule(static)
+    for (int i = 0; i < batch; i++) {
+#ifdef COREBLAS_USE_64BIT_BLAS
+        cblas_sgemm64_(CblasColMajor,
+                       (CBLAS_TRANSPOSE)transa, (CBLAS_TRANSPOSE)transb,
+                       m, n, k,
+                       (alpha), A[i], lda,
+                                           B[i], ldb,
+                       (beta),  C[i], ldc);
+#else
+        cblas_sgemm(CblasColMajor,
+                    (CBLAS_TRANSPOSE)transa, (CBLAS_TRANSPOSE)transb,
+                    m, n, k,
+                    (alpha), A[i], lda,
+                                        B[i], ldb,
+                    (beta),  C[i], ldc);
+#endif
+    }
+
+    return CoreBlasSuccess;
+}
+
+/***************************************************************************//**
+ *
+ * @ingroup core_gemm
+ *
+ *  Performs the same operations as coreblas_sgemm_batched on a batch of
+ *  tiles stored at a constant distance from each other: A_i starts at
+ *  A + i*strideA, B_i at B + i*strideB and C_i at C + i*strideC.
+ *
+ *******************************************************************************
+ *
+ * @param[in] strideA
+ *          The distance between two consecutive A_i.
+ *
+ * @param[in] strideB
+ *          The distance between two consecutive B_i.
+ *
+ * @param[in] strideC
+ *          The distance between two consecutive C_i.
+ *          strideC >= ldc*n, so that the C_i do not overlap.
+ *
+ *  The other arguments are those of coreblas_sgemm_batched.
+ *
+ *******************************************************************************
+ *
+ * @retval CoreBlasSuccess successful exit
+ * @retval < 0 if -i, the i-th argument had an illegal value
+ *
+ ******************************************************************************/
+__attribute__((weak))
+int coreblas_sgemm_batched_strided(coreblas_enum_t transa,
+                coreblas_enum_t transb,
+                int m, int n, int k,
+                float alpha,
+                const float *A, int lda, size_t strideA,
+                const float *B, int ldb, size_t strideB,
+                float beta,
+                float *C, int ldc, size_t strideC,
+                int batch)
+{
+#ifndef COREBLAS_UNCHECKED
+    // Check input arguments.
+    if (transa != CoreBlasNoTrans &&
+        transa != CoreBlasTrans &&
+        transa != CoreBlasTrans) {
+        coreblas_error("illegal value of transa");
+        return -1;
+    }
+    if (transb != CoreBlasNoTrans &&
+        transb != CoreBlasTrans &&
+        transb != CoreBlasTrans) {
+        coreblas_error("illegal value of transb");
+        return -2;
+    }
+    if (m < 0) {
+        coreblas_error("illegal value of m");
+        return -3;
+    }
+    if (n < 0) {
+        coreblas_error("illegal value of n");
+        return -4;
+    }
+    if (k < 0) {
+        coreblas_error("illegal value of k");
+        return -5;
+    }
+    if (batch > 0 && A == NULL) {
+        coreblas_error("NULL A");
+        return -7;
+    }
+    if (lda < imax(1, transa == CoreBlasNoTrans ? m : k)) {
+        coreblas_error("illegal value of lda");
+        return -8;
+    }
+    if (batch > 0 && B == NULL) {
+        coreblas_error("NULL B");
+        return -10;
+    }
+    if (ldb < imax(1, transb == CoreBlasNoTrans ? k : n)) {
+        coreblas_error("illegal value of ldb");
+        return -11;
+    }
+    if (batch > 0 && C == NULL) {
+        coreblas_error("NULL C");
+        return -14;
+    }
+    if (ldc < imax(1, m)) {
+        coreblas_error("illegal value of ldc");
+        return -15;
+    }
+    if (batch > 1 && strideC < (size_t)ldc*n) {
+        coreblas_error("illegal value of strideC");
+        return -16;
+    }
+    if (batch < 0) {
+        coreblas_error("illegal value of batch");
+        return -17;
+    }
+#endif
+
+    // quick return
+    if (m == 0 || n == 0 || batch == 0)
+        return CoreBlasSuccess;
+
+    #pragma omp parallel for schedule(static)
+    for (int i = 0; i < batch; i++) {
+#ifdef COREBLAS_USE_64BIT_BLAS
+        cblas_sgemm64_(CblasColMajor,
+                       (CBLAS_TRANSPOSE)transa, (CBLAS_TRANSPOSE)transb,
+                       m, n, k,
+                       (alpha), &A[strideA*i], lda,
+                                           &B[strideB*i], ldb,
+                       (beta),  &C[strideC*i], ldc);
+#else
+        cblas_sgemm(CblasColMajor,
+                    (CBLAS_TRANSPOSE)transa, (CBLAS_TRANSPOSE)transb,
+                    m, n, k,
+                    (alpha), &A[strideA*i], lda,
+                                        &B[strideB*i], ldb,
+                    (beta),  &C[strideC*i], ldc);
+#endif
+    }
+
+    return CoreBlasSuccess;
+}
@@ -0,0 +1,45 @@
+/**
+ *
+ * @file
+ *
+ *  COREBLAS is a software package provided by:
+ *  University of Tennessee, US,
+ *  University of Manchester, UK.
+ *
+ * @generated from core_blas/core_zgessq.c, normal z -> s, Fri Oct 16 03:36:59 2026
+ *
+ **/
+
+#include <math.h>
+
+#include <coreblas.h>
+#include "coreblas_types.h"
+#include "coreblas_internal.h"
+#include "core_lapack.h"
+
+/******************************************************************************/
+__attribute__((weak))
+void coreblas_sgessq(int m, int n,
+                 const float *A, int lda,
+                 float *scale, float *sumsq)
+{
+    *scale = 0.0;
+    *sumsq = 1.0;
+
+    // The accumulators are combined once for the whole tile.
+    float acc[3] = {0.0, 0.0, 0.0};
+    for (int j = 0; j < n; j++)
+        coreblas_sssq_update(m, &A[lda*j], acc);
+
+    coreblas_sssq_finish(acc, scale, sumsq);
+}
+
+/******************************************************************************/
+void coreblas_sgessq_aux(int n,
+                         const float *scale, const float *sumsq,
+                         float *value)
+{
+    float scl, sum;
+    coreblas_sreduce_ssq(n, scale, sumsq, &scl, &sum);
+    *value = scl*sqrtf(sum);
+}
\ No newline at end of file
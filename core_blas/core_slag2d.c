@@ -0,0 +1,70 @@
+/**
+ *
+ * @file
+ *
+ *  COREBLAS is a software package provided by:
+ *  University of Tennessee, US,
+ *  University of Manchester, UK.
+ *
+ * @generated from core_blas/core_clag2z.c, mixed zc -> ds, Fri Oct 16 03:37:07 2026
+ *
+ **/
+
+#include <coreblas.h>
+#include "coreblas_types.h"
+
+// This will be swapped during the automatic code generation.
+#undef REAL
+#define REAL
+
+/***************************************************************************//**
+ *
+ * @ingroup core_lag2
+ *
+ *  Converts m-by-n matrix A from single complex to double complex precision.
+ *  Every column is converted in one vectorized pass, the real and imaginary
+ *  parts as one real array.
+ *
+ *******************************************************************************
+ *
+ * @param[in] m
+ *          The number of rows of the matrix As.
+ *          m >= 0.
+ *
+ * @param[in] n
+ *          The number of columns of the matrix As.
+ *          n >= 0.
+ *
+ * @param[in] As
+ *          The ldas-by-n matrix in single complex precision to convert.
+ *
+ * @param[in] ldas
+ *          The leading dimension of the matrix As.
+ *          ldas >= max(1,m).
+ *
+ * @param[out] A
+ *          On exit, the converted lda-by-n matrix in double complex precision.
+ *
+ * @param[in] lda
+ *          The leading dimension of the matrix A.
+ *          lda >= max(1,m).
+ *
+ ******************************************************************************/
+__attribute__((weak))
+void coreblas_slag2d(int m, int n,
+                 float *As, int ldas,
+                 double *A,  int lda)
+{
+#ifdef COMPLEX
+    int mr = 2*m;
+#else
+    int mr = m;
+#endif
+    for (int j = 0; j < n; j++) {
+        const float *as = (const float*)&As[(size_t)ldas*j];
+        double *a = (double*)&A[(size_t)lda*j];
+        #pragma omp simd
+        for (int i = 0; i < mr; i++)
+            a[i] = as[i];
+    }
+}
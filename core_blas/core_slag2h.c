@@ -0,0 +1,378 @@
+/**
+ *
+ * @file
+ *
+ *  COREBLAS is a software package provided by:
+ *  University of Tennessee, US,
+ *  University of Manchester, UK.
+ *
+ **/
+
+#include <coreblas.h>
+#include "coreblas_types.h"
+#include "coreblas_half.h"
+
+#include <math.h>
+#include <string.h>
+
+#if defined(__x86_64__) && defined(__GNUC__)
+#define COREBLAS_HALF_X86
+#include <immintrin.h>
+#endif
+
+// Largest finite numbers of the half precision formats.
+#define COREBLAS_HALF_MAX     65504.0f
+#define COREBLAS_BFLOAT16_MAX 0x1.fep+127f
+
+/******************************************************************************/
+static inline uint32_t core_half_bits(float x)
+{
+    uint32_t u;
+    memcpy(&u, &x, sizeof(u));
+    return u;
+}
+
+static inline float core_half_float(uint32_t u)
+{
+    float x;
+    memcpy(&x, &u, sizeof(x));
+    return x;
+}
+
+/******************************************************************************/
+// Rounds x to the nearest binary16, ties to even, without branches.
+// Scaling |x| by 2^112 and back by 2^-110 turns the numbers too large for
+// binary16 into infinity. Adding a power of two of the exponent of x, but
+// at least 2^-14, leaves in the float the bits of the binary16 significand,
+// rounded by the hardware. NaNs become the quiet NaN 0x7e00.
+static inline coreblas_half_t core_half_from_float(float x)
+{
+    uint32_t w = core_half_bits(x);
+    uint32_t w2 = w + w;
+    uint32_t sign = w & 0x80000000u;
+    uint32_t bias = w2 & 0xff000000u;
+    bias = bias < 0x71000000u ? 0x71000000u : bias;
+
+    float base = (fabsf(x)*0x1.0p+112f)*0x1.0p-110f;
+    base = core_half_float((bias >> 1) + 0x07800000u) + base;
+    uint32_t b = core_half_bits(base);
+    uint32_t nonsign = ((b >> 13) & 0x00007c00u) + (b & 0x00000fffu);
+    return (coreblas_half_t)((sign >> 16) |
+                             (w2 > 0xff000000u ? 0x7e00u : nonsign));
+}
+
+/******************************************************************************/
+// Exact conversion from binary16. Normal numbers, infinities and NaNs get
+// their exponent rebiased and are scaled by 2^-112; subnormal numbers are
+// the difference of 0.5 and 0.5 plus their significand.
+static inline float core_half_to_float(coreblas_half_t h)
+{
+    uint32_t w = (uint32_t)h << 16;
+    uint32_t w2 = w + w;
+    uint32_t sign = w & 0x80000000u;
+
+    uint32_t normal = core_half_bits(
+        core_half_float((w2 >> 4) + (0xe0u << 23))*0x1.0p-112f);
+    uint32_t subnormal = core_half_bits(
+        core_half_float((w2 >> 17) | (126u << 23)) - 0.5f);
+    // A mask rather than a conditional, which GCC does not vectorize.
+    uint32_t mask = -(uint32_t)(w2 < (1u << 27));
+    return core_half_float(sign | (subnormal & mask) | (normal & ~mask));
+}
+
+/******************************************************************************/
+// Rounds x to the nearest bfloat16, ties to even. NaNs are kept quiet
+// rather than rounded, possibly to infinity.
+static inline coreblas_bfloat16_t core_bfloat16_from_float(float x)
+{
+    uint32_t u = core_half_bits(x);
+    uint32_t r = (u + 0x7fffu + ((u >> 16) & 1u)) >> 16;
+    uint32_t q = (u >> 16) | 0x0040u;
+    return (coreblas_bfloat16_t)((u & 0x7fffffffu) > 0x7f800000u ? q : r);
+}
+
+static inline float core_bfloat16_to_float(coreblas_bfloat16_t b)
+{
+    return core_half_float((uint32_t)b << 16);
+}
+
+#ifdef COREBLAS_HALF_X86
+/******************************************************************************/
+// F16C: eight conversions per instruction, with the rounding mode of
+// core_half_from_float(). Return the number of elements converted; the
+// rest is left to the portable loops.
+__attribute__((target("avx,f16c")))
+static int core_slag2h_f16c(int m, const float *a, coreblas_half_t *ah,
+                            int *overflow)
+{
+    const __m256 sign = _mm256_set1_ps(-0.0f);
+    const __m256 hmax = _mm256_set1_ps(COREBLAS_HALF_MAX);
+    __m256 over = _mm256_setzero_ps();
+    int i = 0;
+    for (; i+8 <= m; i += 8) {
+        __m256 x = _mm256_loadu_ps(&a[i]);
+        _mm_storeu_si128((__m128i*)&ah[i],
+                         _mm256_cvtps_ph(x, _MM_FROUND_TO_NEAREST_INT));
+        over = _mm256_or_ps(over, _mm256_cmp_ps(_mm256_andnot_ps(sign, x),
+                                                hmax, _CMP_GT_OQ));
+    }
+    *overflow |= !_mm256_testz_ps(over, over);
+    _mm256_zeroupper();
+    return i;
+}
+
+__attribute__((target("avx,f16c")))
+static int core_hlag2s_f16c(int m, const coreblas_half_t *ah, float *a)
+{
+    int i = 0;
+    for (; i+8 <= m; i += 8) {
+        __m128i h = _mm_loadu_si128((const __m128i*)&ah[i]);
+        _mm256_storeu_ps(&a[i], _mm256_cvtph_ps(h));
+    }
+    _mm256_zeroupper();
+    return i;
+}
+
+static int core_half_f16c(void)
+{
+    return __builtin_cpu_supports("avx") && __builtin_cpu_supports("f16c");
+}
+#endif // COREBLAS_HALF_X86
+
+/***************************************************************************//**
+ *
+ * @ingroup core_lag2
+ *
+ *  Converts m-by-n matrix A from single precision to half precision
+ *  (IEEE binary16), rounding to nearest, e.g., to store a tile in half
+ *  precision and compute with it in single precision. Uses the F16C
+ *  instructions when available and a vectorized bit manipulation otherwise.
+ *
+ *  As LAPACK's dlag2s, checks that no element overflows in half precision.
+ *  A complex matrix is converted as a 2m-by-n real matrix with twice the
+ *  leading dimensions.
+ *
+ *******************************************************************************
+ *
+ * @param[in] m
+ *          The number of rows of the matrix A.
+ *          m >= 0.
+ *
+ * @param[in] n
+ *          The number of columns of the matrix A.
+ *          n >= 0.
+ *
+ * @param[in] A
+ *          The lda-by-n matrix in single precision to convert.
+ *
+ * @param[in] lda
+ *          The leading dimension of the matrix A.
+ *          lda >= max(1,m).
+ *
+ * @param[out] Ah
+ *          On exit, the converted ldah-by-n matrix in half precision.
+ *
+ * @param[in] ldah
+ *          The leading dimension of the matrix Ah.
+ *          ldah >= max(1,m).
+ *
+ *******************************************************************************
+ *
+ * @retval 0 successful exit
+ * @retval 1 an element of A is larger than the largest finite number of
+ *           half precision, 65504; Ah is then only partly converted.
+ *
+ ******************************************************************************/
+__attribute__((weak))
+int coreblas_slag2h(int m, int n,
+                    const float *A, int lda,
+                    coreblas_half_t *Ah, int ldah)
+{
+    int f16c = 0;
+#ifdef COREBLAS_HALF_X86
+    f16c = core_half_f16c();
+#endif
+    for (int j = 0; j < n; j++) {
+        const float *a = &A[(size_t)lda*j];
+        coreblas_half_t *ah = &Ah[(size_t)ldah*j];
+        int overflow = 0;
+        int i0 = 0;
+#ifdef COREBLAS_HALF_X86
+        if (f16c)
+            i0 = core_slag2h_f16c(m, a, ah, &overflow);
+#endif
+        #pragma omp simd reduction(|:overflow)
+        for (int i = i0; i < m; i++) {
+            ah[i] = core_half_from_float(a[i]);
+            overflow |= fabsf(a[i]) > COREBLAS_HALF_MAX;
+        }
+        if (overflow)
+            return 1;
+    }
+    return 0;
+}
+
+/***************************************************************************//**
+ *
+ * @ingroup core_lag2
+ *
+ *  Converts m-by-n matrix Ah from half precision (IEEE binary16) to single
+ *  precision, which is exact. Uses the F16C instructions when available.
+ *
+ *******************************************************************************
+ *
+ * @param[in] m
+ *          The number of rows of the matrix Ah.
+ *          m >= 0.
+ *
+ * @param[in] n
+ *          The number of columns of the matrix Ah.
+ *          n >= 0.
+ *
+ * @param[in] Ah
+ *          The ldah-by-n matrix in half precision to convert.
+ *
+ * @param[in] ldah
+ *          The leading dimension of the matrix Ah.
+ *          ldah >= max(1,m).
+ *
+ * @param[out] A
+ *          On exit, the converted lda-by-n matrix in single precision.
+ *
+ * @param[in] lda
+ *          The leading dimension of the matrix A.
+ *          lda >= max(1,m).
+ *
+ ******************************************************************************/
+__attribute__((weak))
+void coreblas_hlag2s(int m, int n,
+                     const coreblas_half_t *Ah, int ldah,
+                     float *A, int lda)
+{
+    int f16c = 0;
+#ifdef COREBLAS_HALF_X86
+    f16c = core_half_f16c();
+#endif
+    for (int j = 0; j < n; j++) {
+        const coreblas_half_t *ah = &Ah[(size_t)ldah*j];
+        float *a = &A[(size_t)lda*j];
+        int i0 = 0;
+#ifdef COREBLAS_HALF_X86
+        if (f16c)
+            i0 = core_hlag2s_f16c(m, ah, a);
+#endif
+        #pragma omp simd
+        for (int i = i0; i < m; i++)
+            a[i] = core_half_to_float(ah[i]);
+    }
+}
+
+/***************************************************************************//**
+ *
+ * @ingroup core_lag2
+ *
+ *  Converts m-by-n matrix A from single precision to bfloat16, rounding to
+ *  nearest. bfloat16 keeps the exponent range of single precision with an
+ *  8-bit significand, so only the numbers above its largest finite number,
+ *  about 3.39e38, overflow.
+ *
+ *  As LAPACK's dlag2s, checks that no element overflows in bfloat16.
+ *  A complex matrix is converted as a 2m-by-n real matrix with twice the
+ *  leading dimensions.
+ *
+ *******************************************************************************
+ *
+ * @param[in] m
+ *          The number of rows of the matrix A.
+ *          m >= 0.
+ *
+ * @param[in] n
+ *          The number of columns of the matrix A.
+ *          n >= 0.
+ *
+ * @param[in] A
+ *          The lda-by-n matrix in single precision to convert.
+ *
+ * @param[in] lda
+ *          The leading dimension of the matrix A.
+ *          lda >= max(1,m).
+ *
+ * @param[out] Ab
+ *          On exit, the converted ldab-by-n matrix in bfloat16.
+ *
+ * @param[in] ldab
+ *          The leading dimension of the matrix Ab.
+ *          ldab >= max(1,m).
+ *
+ *******************************************************************************
+ *
+ * @retval 0 successful exit
+ * @retval 1 an element of A is larger than the largest finite bfloat16;
+ *           Ab is then only partly converted.
+ *
+ ******************************************************************************/
+__attribute__((weak))
+int coreblas_slag2b(int m, int n,
+                    const float *A, int lda,
+                    coreblas_bfloat16_t *Ab, int ldab)
+{
+    for (int j = 0; j < n; j++) {
+        const float *a = &A[(size_t)lda*j];
+        coreblas_bfloat16_t *ab = &Ab[(size_t)ldab*j];
+        int overflow = 0;
+        #pragma omp simd reduction(|:overflow)
+        for (int i = 0; i < m; i++) {
+            ab[i] = core_bfloat16_from_float(a[i]);
+            overflow |= fabsf(a[i]) > COREBLAS_BFLOAT16_MAX;
+        }
+        if (overflow)
+            return 1;
+    }
+    return 0;
+}
+
+/***************************************************************************//**
+ *
+ * @ingroup core_lag2
+ *
+ *  Converts m-by-n matrix Ab from bfloat16 to single precision, which is
+ *  exact.
+ *
+ *******************************************************************************
+ *
+ * @param[in] m
+ *          The number of rows of the matrix Ab.
+ *          m >= 0.
+ *
+ * @param[in] n
+ *          The number of columns of the matrix Ab.
+ *          n >= 0.
+ *
+ * @param[in] Ab
+ *          The ldab-by-n matrix in bfloat16 to convert.
+ *
+ * @param[in] ldab
+ *          The leading dimension of the matrix Ab.
+ *          ldab >= max(1,m).
+ *
+ * @param[out] A
+ *          On exit, the converted lda-by-n matrix in single precision.
+ *
+ * @param[in] lda
+ *          The leading dimension of the matrix A.
+ *          lda >= max(1,m).
+ *
+ ******************************************************************************/
+__attribute__((weak))
+void coreblas_blag2s(int m, int n,
+                     const coreblas_bfloat16_t *Ab, int ldab,
+                     float *A, int lda)
+{
+    for (int j = 0; j < n; j++) {
+        const coreblas_bfloat16_t *ab = &Ab[(size_t)ldab*j];
+        float *a = &A[(size_t)lda*j];
+        #pragma omp simd
+        for (int i = 0; i < m; i++)
+            a[i] = core_bfloat16_to_float(ab[i]);
+    }
+}
@@ -0,0 +1,94 @@
+/**
+ *
+ * @file
+ *
+ *  COREBLAS is a software package provided by:
+ *  University of Tennessee, US,
+ *  University of Manchester, UK.
+ *
+ * @generated from core_blas/core_zlansy.c, normal z -> s, Fri Oct 16 03:37:00 2026
+ *
+ **/
+
+#include <coreblas.h>
+#include "coreblas_types.h"
+#include "coreblas_internal.h"
+#include "core_lapack.h"
+
+#include <math.h>
+
+/******************************************************************************/
+__attribute__((weak))
+void coreblas_slansy(coreblas_enum_t norm, coreblas_enum_t uplo,
+                 int n,
+                 const float *A, int lda,
+                 float *work, float *value)
+{
+    #ifdef COREBLAS_USE_64BIT_BLAS
+        *value = LAPACKE_slansy64_(LAPACK_COL_MAJOR,
+                                 lapack_const(norm),
+                                 lapack_const(uplo),
+                                 n, A, lda);
+    #else
+        *value = LAPACKE_slansy_work(LAPACK_COL_MAJOR,
+                                 lapack_const(norm),
+                                 lapack_const(uplo),
+                                 n, A, lda, work);
+    #endif
+
+}
+
+/******************************************************************************/
+void coreblas_slansy_aux(coreblas_enum_t norm, coreblas_enum_t uplo,
+                         int n,
+                         const float *A, int lda,
+                         float *value)
+{
+    switch (norm) {
+    case CoreBlasOneNorm:
+    case CoreBlasInfNorm:
+        // The elements off the diagonal count in their row and column.
+        for (int i = 0; i < n; i++)
+            value[i] = 0.0;
+        if (uplo == CoreBlasUpper) {
+            for (int j = 0; j < n; j++) {
+                value[j] += coreblas_sabsum(j, &A[lda*j], value);
+                value[j] += fabsf(A[lda*j+j]);
+            }
+        }
+        else { // CoreBlasLower
+            for (int j = 0; j < n; j++) {
+                value[j] += fabsf(A[lda*j+j]);
+                value[j] += coreblas_sabsum(n-j-1, &A[lda*j+j+1],
+                                            &value[j+1]);
+            }
+        }
+        break;
+    }
+}
+
+/***************************************************************************//**
+ *
+ * @ingroup core_lansy
+ *
+ *  Returns the minimum length of the array work of coreblas_slansy
+ *  for the given dimensions, in elements of type float.
+ *
+ *******************************************************************************
+ *
+ * @param[in] norm
+ *         The norm to compute.
+ *
+ * @param[in] n
+ *         The order of the matrix A.
+ *
+ *******************************************************************************
+ *
+ * @retval the length of work, at least 1.
+ *
+ ******************************************************************************/
+size_t coreblas_slansy_lwork(coreblas_enum_t norm, int n)
+{
+    return (norm == CoreBlasOneNorm || norm == CoreBlasInfNorm) ?
+           imax(1, n) : 1;
+}
@@ -0,0 +1,436 @@
+/**
+ *
+ * @file
+ *
+ *  coreblas is a software package provided by:
+ *  University of Tennessee, US,
+ *  University of Manchester, UK.
+ *
+ * @generated from core_blas/core_zlarfb_gemm.c, normal z -> s, Fri Oct 16 03:37:06 2026
+ *
+ **/
+
+#include "coreblas.h"
+#include "coreblas_types.h"
+#include "coreblas_internal.h"
+#include "core_lapack.h"
+
+/***************************************************************************//**
+ *
+ * @ingroup CORE_coreblas_Complex64_t
+ *
+ *  CORE_slarfb_gemm applies a complex block reflector H or its transpose H'
+ *  to a complex M-by-N matrix C, from either the left or the right.
+ *  this kernel is similar to the lapack slarfb but it do a full gemm on the
+ *  triangular Vs assuming that the zeros and the unit diagonal of Vs are
+ *  stored explicitly. It is also based on the fact that a gemm on a small
+ *  block of k reflectors is faster than a trmm on the triangular (k,k) +
+ *  gemm below. Every case is computed as W = C op(V), W = W op(T),
+ *  C = C - op(V) W.
+ *
+ *  The triangular block of V must then hold:
+ *  - Columnwise/Forward:  a unit lower triangle in its first K rows,
+ *  - Columnwise/Backward: a unit upper triangle in its last K rows,
+ *  - Rowwise/Forward:     a unit upper triangle in its first K columns,
+ *  - Rowwise/Backward:    a unit lower triangle in its last K columns,
+ *  with zeros on the other side of the diagonal.
+ *
+ *******************************************************************************
+ *
+ * @param[in] side
+ *         @arg CoreBlasLeft  : apply Q or Q**H from the Left;
+ *         @arg CoreBlasRight : apply Q or Q**H from the Right.
+ *
+ * @param[in] trans
+ *         @arg CoreBlasNoTrans   : No transpose, apply Q;
+ *         @arg CoreBlasConjTrans : ConjTranspose, apply Q**H.
+ *
+ * @param[in] direct
+ *         Indicates how H is formed from a product of elementary
+ *         reflectors
+ *         @arg CoreBlasForward  : H = H(1) H(2) . . . H(k) (Forward)
+ *         @arg CoreBlasBackward : H = H(k) . . . H(2) H(1) (Backward)
+ *
+ * @param[in] storev
+ *         Indicates how the vectors which define the elementary
+ *         reflectors are stored:
+ *         @arg CoreBlasColumnwise
+ *         @arg CoreBlasRowwise
+ *
+ * @param[in] M
+ *         The number of rows of the matrix C.
+ *
+ * @param[in] N
+ *         The number of columns of the matrix C.
+ *
+ * @param[in] K
+ *          The order of the matrix T (= the number of elementary
+ *          reflectors whose product defines the block reflector).
+ *
+ * @param[in] V
+ *          COMPLEX*16 array, dimension
+ *              (LDV,K) if storev = 'C'
+ *              (LDV,M) if storev = 'R' and side = 'L'
+ *              (LDV,N) if storev = 'R' and side = 'R'
+ *          The matrix V. See further details.
+ *
+ * @param[in] LDV
+ *         The leading dimension of the array V.
+ *         If storev = 'C' and side = 'L', LDV >= max(1,M);
+ *         if storev = 'C' and side = 'R', LDV >= max(1,N);
+ *         if storev = 'R', LDV >= K.
+ *
+ * @param[in] T
+ *         The triangular K-by-K matrix T in the representation of the
+ *         block reflector.
+ *         T is upper triangular if direct = CoreBlasForward and lower
+ *         triangular if direct = CoreBlasBackward.
+ *         The rest of the array is not referenced.
+ *
+ * @param[in] LDT
+ *         The leading dimension of the array T. LDT >= K.
+ *
+ * @param[in,out] C
+ *         COMPLEX*16 array, dimension (LDC,N)
+ *         On entry, the M-by-N matrix C.
+ *         On exit, C is overwritten by H*C or H'*C or C*H or C*H'.
+ *
+ * @param[in] LDC
+ *         The leading dimension of the array C. LDC >= max(1,M).
+ *
+ * @param[in,out] WORK
+ *         (workspace) COMPLEX*16 array, dimension (LDWORK,K).
+ *
+ * @param[in] LDWORK
+ *         The dimension of the array WORK.
+ *         If side = CoreBlasLeft,  LDWORK >= max(1,N);
+ *         if side = CoreBlasRight, LDWORK >= max(1,M).
+ *
+ *******************************************************************************
+ *
+ * @return
+ *          \retval coreblas_SUCCESS successful exit
+ *          \retval <0 if -i, the i-th argument had an illegal value
+ *
+ ******************************************************************************/
+#if defined(coreblas_HAVE_WEAK)
+#pragma weak CORE_slarfb_gemm = PCORE_slarfb_gemm
+#define CORE_slarfb_gemm PCORE_slarfb_gemm
+#endif
+int coreblas_slarfb_gemm(coreblas_enum_t side, coreblas_enum_t trans, int direct, int storev,
+                     int M, int N, int K,
+                     const float *V, int LDV,
+                     const float *T, int LDT,
+                     float *C, int LDC,
+                     float *WORK, int LDWORK)
+{
+    static float zzero =  0.0;
+    static float zone  =  1.0;
+    static float mzone = -1.0;
+
+    // Quick return //
+    if ((M == 0) || (N == 0) || (K == 0) )
+        return CoreBlasSuccess;
+
+    /* For Left case, switch the trans. noswitch for right case */
+    if( side == CoreBlasLeft){
+        if ( trans == CoreBlasNoTrans) {
+            trans = CoreBlasConjTrans;
+        }
+        else {
+            trans = CoreBlasNoTrans;
+        }
+    }
+
+    // T is upper triangular for a forward product of reflectors
+    // and lower triangular for a backward one.
+    coreblas_enum_t uplo = (direct == CoreBlasForward) ? CoreBlasUpper
+                                                       : CoreBlasLower;
+
+    // main code //
+    if (storev == CoreBlasColumnwise) {
+        /*
+         * Let  V =  ( V1 )    Forward:  first K rows are unit lower triangular
+         *           ( V2 )    Backward: last K rows are unit upper triangular
+         */
+        if (side == CoreBlasLeft) {
+            /*
+             * Columnwise / Left
+             * Form  H * C  or  H' * C
+             *
+             * W := C' * V    (stored in WORK)
+             */
+            coreblas_sgemm(CoreBlasTrans, CoreBlasNoTrans,
+                           N, K, M,
+                           zone,  C, LDC,
+                                  V, LDV,
+                           zzero, WORK, LDWORK);
+            /*
+             * W := W * T'  or  W * T
+             */
+            coreblas_strmm(CoreBlasRight, uplo, trans, CoreBlasNonUnit,
+                           N, K,
+                           zone, T, LDT, WORK, LDWORK);
+            /*
+             * C := C - V * W'
+             */
+            coreblas_sgemm(CoreBlasNoTrans, CoreBlasTrans,
+                           M, N, K,
+                           mzone, V, LDV,
+                                  WORK, LDWORK,
+                           zone,  C, LDC);
+        }
+        else {
+            /*
+             * Columnwise / Right
+             * Form  C * H  or  C * H'
+             *
+             * W := C * V
+             */
+            coreblas_sgemm(CoreBlasNoTrans, CoreBlasNoTrans,
+                           M, K, N,
+                           zone,  C, LDC,
+                                  V, LDV,
+                           zzero, WORK, LDWORK);
+            /*
+             * W := W * T  or  W * T'
+             */
+            coreblas_strmm(CoreBlasRight, uplo, trans, CoreBlasNonUnit,
+                           M, K,
+                           zone, T, LDT, WORK, LDWORK);
+            /*
+             * C := C - W * V'
+             */
+            coreblas_sgemm(CoreBlasNoTrans, CoreBlasTrans,
+                           M, N, K,
+                           mzone, WORK, LDWORK,
+                                  V, LDV,
+                           zone,  C, LDC);
+        }
+    }
+    else {
+        /*
+         * Let  V =  ( V1  V2 )    Forward:  first K columns are unit upper
+         *                                   triangular
+         *                         Backward: last K columns are unit lower
+         *                                   triangular
+         */
+        if (side == CoreBlasLeft) {
+            /*
+             * Rowwise / Left
+             * Form  H * C  or  H' * C
+             *
+             * W := C' * V'    (stored in WORK)
+             */
+            coreblas_sgemm(CoreBlasTrans, CoreBlasTrans,
+                           N, K, M,
+                           zone,  C, LDC,
+                                  V, LDV,
+                           zzero, WORK, LDWORK);
+            /*
+             * W := W * T'  or  W * T
+             */
+            coreblas_strmm(CoreBlasRight, uplo, trans, CoreBlasNonUnit,
+                           N, K,
+                           zone, T, LDT, WORK, LDWORK);
+            /*
+             * C := C - V' * W'
+             */
+            coreblas_sgemm(CoreBlasTrans, CoreBlasTrans,
+                           M, N, K,
+                           mzone, V, LDV,
+                                  WORK, LDWORK,
+                           zone,  C, LDC);
+        }
+        else {
+            /*
+             * Rowwise / Right
+             * Form  C * H  or  C * H'
+             *
+             * W := C * V'
+             */
+            coreblas_sgemm(CoreBlasNoTrans, CoreBlasTrans,
+                           M, K, N,
+                           zone,  C, LDC,
+                                  V, LDV,
+                           zzero, WORK, LDWORK);
+            /*
+             * W := W * T  or  W * T'
+             */
+            coreblas_strmm(CoreBlasRight, uplo, trans, CoreBlasNonUnit,
+                           M, K,
+                           zone, T, LDT, WORK, LDWORK);
+            /*
+             * C := C - W * V
+             */
+            coreblas_sgemm(CoreBlasNoTrans, CoreBlasNoTrans,
+                           M, N, K,
+                           mzone, WORK, LDWORK,
+                                  V, LDV,
+                           zone,  C, LDC);
+        }
+    }
+    return CoreBlasSuccess;
+}
+
+/***************************************************************************//**
+ *
+ * @ingroup CORE_coreblas_Complex64_t
+ *
+ *  Same as coreblas_slarfb_gemm for direct = CoreBlasForward and
+ *  storev = CoreBlasRowwise, but with V = ( V1  V2 ) passed as two blocks:
+ *  the K-by-K unit upper triangle V1, with its zeros and unit diagonal
+ *  stored explicitly, and the rest V2 of the K rows. This lets coreblas_sormlq
+ *  copy only V1 and read V2 in place from its tile. Every product is a gemm.
+ *
+ ******************************************************************************/
+int coreblas_slarfb_gemm_split(coreblas_enum_t side, coreblas_enum_t trans,
+                     int M, int N, int K,
+                     const float *V1, int LDV1,
+                     const float *V2, int LDV2,
+                     const float *T, int LDT,
+                     float *C, int LDC,
+                     float *WORK, int LDWORK)
+{
+    static float zzero =  0.0;
+    static float zone  =  1.0;
+    static float mzone = -1.0;
+
+    // Quick return //
+    if ((M == 0) || (N == 0) || (K == 0) )
+        return CoreBlasSuccess;
+
+    /* For Left case, switch the trans. noswitch for right case */
+    if( side == CoreBlasLeft){
+        if ( trans == CoreBlasNoTrans) {
+            trans = CoreBlasConjTrans;
+        }
+        else {
+            trans = CoreBlasNoTrans;
+        }
+    }
+
+    if (side == CoreBlasLeft) {
+        /*
+         * Rowwise / Left
+         * Form  H * C  or  H' * C  where  C = ( C1 )
+         *                                     ( C2 )
+         *
+         * W := C1' * V1' + C2' * V2'    (stored in WORK)
+         */
+        coreblas_sgemm(CoreBlasTrans, CoreBlasTrans,
+                       N, K, K,
+                       zone,  C, LDC,
+                              V1, LDV1,
+                       zzero, WORK, LDWORK);
+        if (M > K) {
+            coreblas_sgemm(CoreBlasTrans, CoreBlasTrans,
+                           N, K, M-K,
+                           zone, &C[K], LDC,
+                                 V2, LDV2,
+                           zone, WORK, LDWORK);
+        }
+        /*
+         * W := W * T'  or  W * T
+         */
+        coreblas_strmm(CoreBlasRight, CoreBlasUpper, trans, CoreBlasNonUnit,
+                       N, K,
+                       zone, T, LDT, WORK, LDWORK);
+        /*
+         * C1 := C1 - V1' * W'
+         * C2 := C2 - V2' * W'
+         */
+        coreblas_sgemm(CoreBlasTrans, CoreBlasTrans,
+                       K, N, K,
+                       mzone, V1, LDV1,
+                              WORK, LDWORK,
+                       zone,  C, LDC);
+        if (M > K) {
+            coreblas_sgemm(CoreBlasTrans, CoreBlasTrans,
+                           M-K, N, K,
+                           mzone, V2, LDV2,
+                                  WORK, LDWORK,
+                           zone,  &C[K], LDC);
+        }
+    }
+    else {
+        /*
+         * Rowwise / Right
+         * Form  C * H  or  C * H'  where  C = ( C1  C2 )
+         *
+         * W := C1 * V1' + C2 * V2'    (stored in WORK)
+         */
+        coreblas_sgemm(CoreBlasNoTrans, CoreBlasTrans,
+                       M, K, K,
+                       zone,  C, LDC,
+                              V1, LDV1,
+                       zzero, WORK, LDWORK);
+        if (N > K) {
+            coreblas_sgemm(CoreBlasNoTrans, CoreBlasTrans,
+                           M, K, N-K,
+                           zone, &C[LDC*K], LDC,
+                                 V2, LDV2,
+                           zone, WORK, LDWORK);
+        }
+        /*
+         * W := W * T  or  W * T'
+         */
+        coreblas_strmm(CoreBlasRight, CoreBlasUpper, trans, CoreBlasNonUnit,
+                       M, K,
+                       zone, T, LDT, WORK, LDWORK);
+        /*
+         * C1 := C1 - W * V1
+         * C2 := C2 - W * V2
+         */
+        coreblas_sgemm(CoreBlasNoTrans, CoreBlasNoTrans,
+                       M, K, K,
+                       mzone, WORK, LDWORK,
+                              V1, LDV1,
+                       zone,  C, LDC);
+        if (N > K) {
+            coreblas_sgemm(CoreBlasNoTrans, CoreBlasNoTrans,
+                           M, N-K, K,
+                           mzone, WORK, LDWORK,
+                                  V2, LDV2,
+                           zone,  &C[LDC*K], LDC);
+        }
+    }
+    return CoreBlasSuccess;
+}
+
+/***************************************************************************//**
+ *
+ * @ingroup CORE_coreblas_Complex64_t
+ *
+ *  Returns the minimum length of the array work of coreblas_slarfb_gemm
+ *  for the given dimensions.
+ *  The leading dimension is LDWORK = max(1,N) on the left
+ *  and LDWORK = max(1,M) on the right.
+ *
+ *******************************************************************************
+ *
+ * @param[in] side
+ *         - CoreBlasLeft  : apply from the Left;
+ *         - CoreBlasRight : apply from the Right.
+ *
+ * @param[in] M
+ *         The number of rows of the matrix C.
+ *
+ * @param[in] N
+ *         The number of columns of the matrix C.
+ *
+ * @param[in] K
+ *         The order of the matrix T.
+ *
+ *******************************************************************************
+ *
+ * @retval the length of work, at least 1.
+ *
+ ******************************************************************************/
+size_t coreblas_slarfb_gemm_lwork(coreblas_enum_t side, int M, int N, int K)
+{
+    if (side == CoreBlasLeft)
+        return imax(1, N)*(size_t)imax(1, K);
+    else
+        return imax(1, M)*(size_t)imax(1, K);
+}
@@ -0,0 +1,547 @@
+/**
+ *
+ * @file
+ *
+ *  COREBLAS is a software package provided by:
+ *  University of Tennessee, US,
+ *  University of Manchester, UK.
+ *
+ * @generated from core_blas/core_zlarft.c, normal z -> s, Fri Oct 16 03:37:06 2026
+ *
+ **/
+
+#include <coreblas.h>
+#include "coreblas_types.h"
+#include "coreblas_internal.h"
+#include "core_lapack.h"
+
+// This will be swapped during the automatic code generation.
+#undef REAL
+#define REAL
+
+// Number of reflectors below which T is built column by column: the
+// products of the recursion would be too small for BLAS calls to pay off.
+#define COREBLAS_LARFT_LEAF 4
+
+/******************************************************************************/
+// Builds T column by column, as LAPACK's slarft, with the products
+// S(0:j, j) of the reflectors first stored in T:
+//     T(0:j, j) = -tau(j) T(0:j, 0:j) S(0:j, j),
+// where S(i, j) = v(i)^T v(j) only runs over the nonzero elements of v(i):
+// below the unit diagonal of the unit case (l < 0), and over the
+// m-l+min(i+1, l) leading elements of the pentagonal case.
+static inline float core_slarft_dotc(
+    int n, const float *x, int incx,
+           const float *y, int incy)
+{
+    // x^T y without the complex multiplications of C99, which GCC
+    // does not vectorize.
+#ifdef COMPLEX
+    const float *dx = (const float*)x;
+    const float *dy = (const float*)y;
+    float re = 0.0;
+    float im = 0.0;
+    #pragma omp simd reduction(+:re, im)
+    for (int r = 0; r < n; r++) {
+        float xr = dx[2*incx*r], xi = dx[2*incx*r+1];
+        float yr = dy[2*incy*r], yi = dy[2*incy*r+1];
+        re += xr*yr + xi*yi;
+        im += xr*yi - xi*yr;
+    }
+    return re + im*I;
+#else
+    float dot = 0.0;
+    #pragma omp simd reduction(+:dot)
+    for (int r = 0; r < n; r++)
+        dot += x[incx*r]*y[incy*r];
+    return dot;
+#endif
+}
+
+static void core_slarft_leaf(coreblas_enum_t storev, int m, int k, int l,
+                             const float *V, int ldv,
+                             const float *tau,
+                                   float *T, int ldt)
+{
+    for (int j = 0; j < k; j++) {
+        for (int i = 0; i < j; i++) {
+            if (storev == CoreBlasColumnwise) {
+                if (l < 0)
+                    T[ldt*j+i] = (V[ldv*i+j]) +
+                        core_slarft_dotc(m-j-1, &V[ldv*i+j+1], 1,
+                                                &V[ldv*j+j+1], 1);
+                else
+                    T[ldt*j+i] =
+                        core_slarft_dotc(m-l+imin(i+1, l), &V[ldv*i], 1,
+                                                           &V[ldv*j], 1);
+            }
+            else {
+                if (l < 0)
+                    T[ldt*j+i] = V[ldv*j+i] + (
+                        core_slarft_dotc(m-j-1, &V[ldv*(j+1)+i], ldv,
+                                                &V[ldv*(j+1)+j], ldv));
+                else
+                    T[ldt*j+i] = (
+                        core_slarft_dotc(m-l+imin(i+1, l), &V[i], ldv,
+                                                           &V[j], ldv));
+            }
+        }
+        for (int i = 0; i < j; i++) {
+            float tij = 0.0;
+            for (int p = i; p < j; p++)
+                tij += T[ldt*p+i]*T[ldt*j+p];
+            T[ldt*j+i] = -tau[j]*tij;
+        }
+        T[ldt*j+j] = tau[j];
+    }
+}
+
+/******************************************************************************/
+// The k reflectors are split in two halves, T11 and T22 are built
+// recursively, and the off-diagonal block is merged with level 3
+// operations:
+//     T12 = -T11 (V1^T V2) T22,
+// where V1^T V2 is left in T12 by the caller. Rowwise, V1 V2^T is used.
+static void core_slarft_scale(int k1, int k2,
+                              float *T, int ldt)
+{
+    static float zone  =  1.0;
+    static float mzone = -1.0;
+
+    float *T12 = &T[ldt*k1];
+    float *T22 = &T[ldt*k1+k1];
+
+    coreblas_strmm(CoreBlasLeft, CoreBlasUpper, CoreBlasNoTrans,
+                   CoreBlasNonUnit,
+                   k1, k2,
+                   mzone, T,   ldt,
+                          T12, ldt);
+
+    coreblas_strmm(CoreBlasRight, CoreBlasUpper, CoreBlasNoTrans,
+                   CoreBlasNonUnit,
+                   k1, k2,
+                   zone, T22, ldt,
+                         T12, ldt);
+}
+
+/***************************************************************************//**
+ *
+ * @ingroup core_geqrt
+ *
+ *  Forms the off-diagonal block T12 of the upper triangular factor T of
+ *  the k1+k2 reflectors of V, as coreblas_slarft, from the factors T11
+ *  and T22 of the first k1 and last k2 reflectors, already in T:
+ *      T12 = -T11 (V1^T V2) T22.
+ *  Used by the recursion of coreblas_slarft and by the recursive panels
+ *  of geqrt, which build T as they factor. The arguments are those of
+ *  coreblas_slarft with k = k1+k2.
+ *
+ ******************************************************************************/
+void coreblas_slarft_merge(coreblas_enum_t storev, int n, int k1, int k2,
+                           const float *V, int ldv,
+                                 float *T, int ldt)
+{
+    static float zone  = 1.0;
+
+    int k = k1+k2;
+    float *T12 = &T[ldt*k1];
+
+    if (storev == CoreBlasColumnwise) {
+        // T12 = V(k1:k, 0:k1)^T V(k1:k, k1:k)
+        for (int j = 0; j < k2; j++)
+            for (int i = 0; i < k1; i++)
+                T12[ldt*j+i] = (V[ldv*i+k1+j]);
+
+        coreblas_strmm(CoreBlasRight, CoreBlasLower, CoreBlasNoTrans,
+                       CoreBlasUnit,
+                       k1, k2,
+                       zone, &V[ldv*k1+k1], ldv,
+                             T12,           ldt);
+
+        // T12 += V(k:n, 0:k1)^T V(k:n, k1:k)
+        if (n > k) {
+            coreblas_sgemm(CoreBlasTrans, CoreBlasNoTrans,
+                           k1, k2, n-k,
+                           zone, &V[k],        ldv,
+                                 &V[ldv*k1+k], ldv,
+                           zone, T12,          ldt);
+        }
+    }
+    else {
+        // T12 = V(0:k1, k1:k) V(k1:k, k1:k)^T
+        for (int j = 0; j < k2; j++)
+            for (int i = 0; i < k1; i++)
+                T12[ldt*j+i] = V[ldv*(k1+j)+i];
+
+        coreblas_strmm(CoreBlasRight, CoreBlasUpper, CoreBlasTrans,
+                       CoreBlasUnit,
+                       k1, k2,
+                       zone, &V[ldv*k1+k1], ldv,
+                             T12,           ldt);
+
+        // T12 += V(0:k1, k:n) V(k1:k, k:n)^T
+        if (n > k) {
+            coreblas_sgemm(CoreBlasNoTrans, CoreBlasTrans,
+                           k1, k2, n-k,
+                           zone, &V[ldv*k],    ldv,
+                                 &V[ldv*k+k1], ldv,
+                           zone, T12,          ldt);
+        }
+    }
+
+    core_slarft_scale(k1, k2, T, ldt);
+}
+
+/***************************************************************************//**
+ *
+ * @ingroup core_tsqrt
+ *
+ *  Forms the off-diagonal block T12 of the factor T of the k1+k2
+ *  reflectors of the pentagonal V, as coreblas_slarft_pent, from the
+ *  factors T11 and T22 already in T. Used by the recursion of
+ *  coreblas_slarft_pent and by the recursive panels of tsqrt and ttqrt.
+ *  The arguments are those of coreblas_slarft_pent with k = k1+k2.
+ *
+ ******************************************************************************/
+void coreblas_slarft_pent_merge(coreblas_enum_t storev,
+                                int m, int k1, int k2, int l,
+                                const float *V, int ldv,
+                                      float *T, int ldt)
+{
+    static float zone  = 1.0;
+    static float zzero = 0.0;
+
+    // V1 is made of the mf full rows (columns) on top of the first l1
+    // rows (columns) of the trapezoid, along which V2 is full.
+    int mf = m-l;
+    int l1 = imin(k1, l);
+    float *T12 = &T[ldt*k1];
+    const float *V2 =
+        storev == CoreBlasColumnwise ? &V[ldv*k1] : &V[k1];
+
+    float beta = zzero;
+    if (storev == CoreBlasColumnwise) {
+        // T12 = V1(mf:mf+l1, :)^T V2(mf:mf+l1, :)
+        if (l1 > 0) {
+            for (int j = 0; j < k2; j++)
+                for (int i = 0; i < l1; i++)
+                    T12[ldt*j+i] = V2[ldv*j+mf+i];
+
+            coreblas_strmm(CoreBlasLeft, CoreBlasUpper, CoreBlasTrans,
+                           CoreBlasNonUnit,
+                           l1, k2,
+                           zone, &V[mf], ldv,
+                                 T12,    ldt);
+
+            coreblas_sgemm(CoreBlasTrans, CoreBlasNoTrans,
+                           k1-l1, k2, l1,
+                           zone,  &V[ldv*l1+mf], ldv,
+                                  &V2[mf],       ldv,
+                           zzero, &T12[l1],      ldt);
+            beta = zone;
+        }
+
+        // T12 += V1(0:mf, :)^T V2(0:mf, :)
+        coreblas_sgemm(CoreBlasTrans, CoreBlasNoTrans,
+                       k1, k2, mf,
+                       zone, V,   ldv,
+                             V2,  ldv,
+                       beta, T12, ldt);
+    }
+    else {
+        // T12 = V1(:, mf:mf+l1) V2(:, mf:mf+l1)^T
+        if (l1 > 0) {
+            for (int j = 0; j < k2; j++)
+                for (int i = 0; i < l1; i++)
+                    T12[ldt*j+i] = (V2[ldv*(mf+i)+j]);
+
+            coreblas_strmm(CoreBlasLeft, CoreBlasLower, CoreBlasNoTrans,
+                           CoreBlasNonUnit,
+                           l1, k2,
+                           zone, &V[ldv*mf], ldv,
+                                 T12,        ldt);
+
+            coreblas_sgemm(CoreBlasNoTrans, CoreBlasTrans,
+                           k1-l1, k2, l1,
+                           zone,  &V[ldv*mf+l1], ldv,
+                                  &V2[ldv*mf],   ldv,
+                           zzero, &T12[l1],      ldt);
+            beta = zone;
+        }
+
+        // T12 += V1(:, 0:mf) V2(:, 0:mf)^T
+        coreblas_sgemm(CoreBlasNoTrans, CoreBlasTrans,
+                       k1, k2, mf,
+                       zone, V,   ldv,
+                             V2,  ldv,
+                       beta, T12, ldt);
+    }
+
+    core_slarft_scale(k1, k2, T, ldt);
+}
+
+/******************************************************************************/
+static void core_slarft_rec(coreblas_enum_t storev, int n, int k,
+                            const float *V, int ldv,
+                            const float *tau,
+                                  float *T, int ldt)
+{
+    if (k <= COREBLAS_LARFT_LEAF) {
+        core_slarft_leaf(storev, n, k, -1, V, ldv, tau, T, ldt);
+        return;
+    }
+
+    int k1 = k/2;
+    int k2 = k-k1;
+
+    core_slarft_rec(storev, n, k1, V, ldv, tau, T, ldt);
+    core_slarft_rec(storev, n-k1, k2, &V[ldv*k1+k1], ldv, &tau[k1],
+                    &T[ldt*k1+k1], ldt);
+
+    coreblas_slarft_merge(storev, n, k1, k2, V, ldv, T, ldt);
+}
+
+/******************************************************************************/
+static void core_slarft_pent_rec(coreblas_enum_t storev, int m, int k, int l,
+                                 const float *V, int ldv,
+                                 const float *tau,
+                                       float *T, int ldt)
+{
+    if (k <= COREBLAS_LARFT_LEAF) {
+        core_slarft_leaf(storev, m, k, l, V, ldv, tau, T, ldt);
+        return;
+    }
+
+    // V1 is made of the m-l full rows (columns) on top of the first
+    // min(k1, l) rows (columns) of the trapezoid, along which V2 is full.
+    int k1 = k/2;
+    int k2 = k-k1;
+    int l1 = imin(k1, l);
+    const float *V2 =
+        storev == CoreBlasColumnwise ? &V[ldv*k1] : &V[k1];
+
+    core_slarft_pent_rec(storev, m-l+l1, k1, l1, V, ldv, tau, T, ldt);
+    core_slarft_pent_rec(storev, m, k2, imax(0, l-k1), V2, ldv, &tau[k1],
+                         &T[ldt*k1+k1], ldt);
+
+    coreblas_slarft_pent_merge(storev, m, k1, k2, l, V, ldv, T, ldt);
+}
+
+/***************************************************************************//**
+ *
+ * @ingroup core_geqrt
+ *
+ *  Forms the k-by-k upper triangular factor T of the block reflector
+ *  H = H(1) H(2) . . . H(k) = I - V T V^T (I - V^T T V rowwise), as
+ *  LAPACK's slarft with direct = 'F', e.g., for an inner block of
+ *  geqrt or gelqt.
+ *
+ *  Instead of one column of T at a time with gemv and trmv, the
+ *  reflectors are split recursively in halves, and the two factors are
+ *  merged with gemm and trmm:
+ *
+ *      T = ( T11  -T11 (V1^T V2) T22 )
+ *          (  0          T22         ).
+ *
+ *******************************************************************************
+ *
+ * @param[in] storev
+ *         - CoreBlasColumnwise: V is n-by-k, the reflectors are its
+ *           columns, and its leading k-by-k block is unit lower
+ *           triangular;
+ *         - CoreBlasRowwise: V is k-by-n, the reflectors are its rows,
+ *           and its leading k-by-k block is unit upper triangular.
+ *         The unit diagonal and the elements on the other side of it
+ *         are not referenced.
+ *
+ * @param[in] n
+ *         The order of the block reflector H. n >= k.
+ *
+ * @param[in] k
+ *         The number of elementary reflectors. k >= 0.
+ *
+ * @param[in] V
+ *         The matrix of the reflectors.
+ *
+ * @param[in] ldv
+ *         The leading dimension of the array V.
+ *         ldv >= max(1,n) columnwise and ldv >= max(1,k) rowwise.
+ *
+ * @param[in] tau
+ *         The k scalar factors of the reflectors.
+ *
+ * @param[out] T
+ *         The k-by-k upper triangular factor T.
+ *         The strictly lower part of the array is not referenced.
+ *
+ * @param[in] ldt
+ *         The leading dimension of the array T. ldt >= max(1,k).
+ *
+ *******************************************************************************
+ *
+ * @retval CoreBlasSuccess successful exit
+ * @retval < 0 if -i, the i-th argument had an illegal value
+ *
+ ******************************************************************************/
+__attribute__((weak))
+int coreblas_slarft(coreblas_enum_t storev, int n, int k,
+                    const float *V, int ldv,
+                    const float *tau,
+                          float *T, int ldt)
+{
+#ifndef COREBLAS_UNCHECKED
+    // Check input arguments.
+    if (storev != CoreBlasColumnwise && storev != CoreBlasRowwise) {
+        coreblas_error("illegal value of storev");
+        return -1;
+    }
+    if (k < 0) {
+        coreblas_error("illegal value of k");
+        return -3;
+    }
+    if (n < k) {
+        coreblas_error("illegal value of n");
+        return -2;
+    }
+    if (V == NULL) {
+        coreblas_error("NULL V");
+        return -4;
+    }
+    if (ldv < imax(1, storev == CoreBlasColumnwise ? n : k)) {
+        coreblas_error("illegal value of ldv");
+        return -5;
+    }
+    if (tau == NULL) {
+        coreblas_error("NULL tau");
+        return -6;
+    }
+    if (T == NULL) {
+        coreblas_error("NULL T");
+        return -7;
+    }
+    if (ldt < imax(1, k)) {
+        coreblas_error("illegal value of ldt");
+        return -8;
+    }
+#endif
+
+    // quick return
+    if (k == 0)
+        return CoreBlasSuccess;
+
+    core_slarft_rec(storev, n, k, V, ldv, tau, T, ldt);
+
+    return CoreBlasSuccess;
+}
+
+/***************************************************************************//**
+ *
+ * @ingroup core_tsqrt
+ *
+ *  Forms the k-by-k upper triangular factor T of the block reflector
+ *  H = I - W T W^T of the triangle-on-top-of-pentagon kernels (tsqrt,
+ *  ttqrt, and tslqt, ttlqt rowwise), where
+ *
+ *      W = ( I )    or rowwise    W = ( I  V ),
+ *          ( V )
+ *
+ *  as in LAPACK's ztpqrt2. Only V is referenced. The reflectors are
+ *  split recursively as in coreblas_slarft; the identity blocks of W do
+ *  not contribute to the off-diagonal blocks of T.
+ *
+ *******************************************************************************
+ *
+ * @param[in] storev
+ *         - CoreBlasColumnwise: V is m-by-k;
+ *         - CoreBlasRowwise: V is k-by-m.
+ *
+ * @param[in] m
+ *         The number of rows of V columnwise, of columns rowwise. m >= l.
+ *
+ * @param[in] k
+ *         The number of elementary reflectors. k >= 0.
+ *
+ * @param[in] l
+ *         The number of rows (columns) of the trapezoidal part of V:
+ *         columnwise, its last l rows are upper trapezoidal; rowwise, its
+ *         last l columns are lower trapezoidal; the other elements of
+ *         these rows (columns) are not referenced. l = 0 for the ts
+ *         kernels. 0 <= l <= min(m,k).
+ *
+ * @param[in] V
+ *         The pentagonal matrix V.
+ *
+ * @param[in] ldv
+ *         The leading dimension of the array V.
+ *         ldv >= max(1,m) columnwise and ldv >= max(1,k) rowwise.
+ *
+ * @param[in] tau
+ *         The k scalar factors of the reflectors.
+ *
+ * @param[out] T
+ *         The k-by-k upper triangular factor T.
+ *         The strictly lower part of the array is not referenced.
+ *
+ * @param[in] ldt
+ *         The leading dimension of the array T. ldt >= max(1,k).
+ *
+ *******************************************************************************
+ *
+ * @retval CoreBlasSuccess successful exit
+ * @retval < 0 if -i, the i-th argument had an illegal value
+ *
+ ******************************************************************************/
+__attribute__((weak))
+int coreblas_slarft_pent(coreblas_enum_t storev, int m, int k, int l,
+                         const float *V, int ldv,
+                         const float *tau,
+                               float *T, int ldt)
+{
+#ifndef COREBLAS_UNCHECKED
+    // Check input arguments.
+    if (storev != CoreBlasColumnwise && storev != CoreBlasRowwise) {
+        coreblas_error("illegal value of storev");
+        return -1;
+    }
+    if (m < 0) {
+        coreblas_error("illegal value of m");
+        return -2;
+    }
+    if (k < 0) {
+        coreblas_error("illegal value of k");
+        return -3;
+    }
+    if (l < 0 || l > imin(m, k)) {
+        coreblas_error("illegal value of l");
+        return -4;
+    }
+    if (V == NULL) {
+        coreblas_error("NULL V");
+        return -5;
+    }
+    if (ldv < imax(1, storev == CoreBlasColumnwise ? m : k)) {
+        coreblas_error("illegal value of ldv");
+        return -6;
+    }
+    if (tau == NULL) {
+        coreblas_error("NULL tau");
+        return -7;
+    }
+    if (T == NULL) {
+        coreblas_error("NULL T");
+        return -8;
+    }
+    if (ldt < imax(1, k)) {
+        coreblas_error("illegal value of ldt");
+        return -9;
+    }
+#endif
+
+    // quick return
+    if (k == 0)
+        return CoreBlasSuccess;
+
+    core_slarft_pent_rec(storev, m, k, l, V, ldv, tau, T, ldt);
+
+    return CoreBlasSuccess;
+}
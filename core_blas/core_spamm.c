@@ -0,0 +1,1194 @@
+/**
+ *
+ * @file
+ *
+ *  COREBLAS is a software package provided by:
+ *  University of Tennessee, US,
+ *  University of Manchester, UK.
+ *
+ * @generated from core_blas/core_zpamm.c, normal z -> s, Fri Oct 16 03:37:01 2026
+ *
+ **/
+
+#include <coreblas.h>
+#include "coreblas_types.h"
+#include "coreblas_internal.h"
+#include "core_lapack.h"
+
+static inline int coreblas_spamm_a2(coreblas_enum_t side, coreblas_enum_t trans,
+                                coreblas_enum_t uplo,
+                                int m, int n, int k, int l, int vi2, int vi3,
+                                      float *A2, int lda2,
+                                const float *V,  int ldv,
+                                      float *W,  int ldw);
+
+static inline int coreblas_spamm_w(coreblas_enum_t side, coreblas_enum_t trans,
+                               coreblas_enum_t uplo,
+                               int m, int n, int k, int l, int vi2, int vi3,
+                               const float *A1, int lda1,
+                                     float *A2, int lda2,
+                               const float *V,  int ldv,
+                                     float *W,  int ldw);
+
+static inline int coreblas_spamm_a2_backward(
+                                coreblas_enum_t side, coreblas_enum_t trans,
+                                coreblas_enum_t uplo,
+                                int m, int n, int k, int l, int vi1, int vi2,
+                                      float *A2, int lda2,
+                                const float *V,  int ldv,
+                                      float *W,  int ldw);
+
+static inline int coreblas_spamm_w_backward(
+                               coreblas_enum_t side, coreblas_enum_t trans,
+                               coreblas_enum_t uplo,
+                               int m, int n, int k, int l, int vi1, int vi2,
+                               const float *A1, int lda1,
+                                     float *A2, int lda2,
+                               const float *V,  int ldv,
+                                     float *W,  int ldw);
+
+/***************************************************************************//**
+ *
+ * @ingroup core_pamm
+ *
+ *  Performs one of the matrix-matrix operations
+ *
+ *                    CoreBlasLeft                CoreBlasRight
+ *     OP CoreBlasW  :  W  = A1 + op(V) * A2  or  W  = A1 + A2 * op(V)
+ *     OP CoreBlasA2 :  A2 = A2 - op(V) * W   or  A2 = A2 - W * op(V)
+ *
+ *  where  op( V ) is one of
+ *
+ *     op( V ) = V   or   op( V ) = V^T
+ *
+ *  A1, A2 and W are general matrices, and V is:
+ *
+ *        l = k: rectangle + triangle
+ *        l < k: rectangle + trapezoid
+ *        l = 0: rectangle
+ *
+ *  Size of V, both rowwise and columnwise, is:
+ *
+ *         ----------------------
+ *          side   trans    size
+ *         ----------------------
+ *          left     N     M x K
+ *                   T     K x M
+ *          right    N     K x N
+ *                   T     N x K
+ *         ----------------------
+ *
+ *  CoreBlasLeft (columnwise and rowwise):
+ *
+ *              |    K    |                 |         M         |
+ *           _  __________   _              _______________        _
+ *              |    |    |                 |             | \
+ *     V:       |    |    |           V^T:  |_____________|___\    K
+ *              |    |    | M-L             |                  |
+ *           M  |    |    |                 |__________________|   _
+ *              |____|    |  _
+ *              \    |    |                 |    M - L    | L  |
+ *                \  |    |  L
+ *           _      \|____|  _
+ *
+ *
+ *  CoreBlasRight (columnwise and rowwise):
+ *
+ *          |         K         |                   |    N    |
+ *          _______________        _             _  __________   _
+ *          |             | \                       |    |    |
+ *    V^T:  |_____________|___\    N        V:      |    |    |
+ *          |                  |                    |    |    | K-L
+ *          |__________________|   _             K  |    |    |
+ *                                                  |____|    |  _
+ *          |    K - L    | L  |                    \    |    |
+ *                                                    \  |    |  L
+ *                                               _      \|____|  _
+ *
+ *  For CoreBlasBackward, V is stored as for CoreBlasForward, reversed in
+ *  both dimensions: the triangle lies in the first L rows of A2's side and
+ *  the last L reflectors, e.g., on the left and columnwise:
+ *
+ *              |    K    |
+ *           _  __________   _
+ *              |    |\   |  L
+ *     V:       |    |  \ |
+ *              |    |    \  _
+ *           M  |    |    |
+ *              |    |    |  M-L
+ *           _  |____|____|  _
+ *
+ *              | K-L | L |
+ *
+ *  Arguments
+ *  ==========
+ *
+ * @param[in] op
+ *
+ *         OP specifies which operation to perform:
+ *
+ *         - CoreBlasW  : W  = A1 + op(V) * A2  or  W  = A1 + A2 * op(V)
+ *         - CoreBlasA2 : A2 = A2 - op(V) * W   or  A2 = A2 - W * op(V)
+ *
+ * @param[in] side
+ *
+ *         SIDE specifies whether  op( V ) multiplies A2
+ *         or W from the left or right as follows:
+ *
+ *         - CoreBlasLeft  : multiply op( V ) from the left
+ *                            OP CoreBlasW  :  W  = A1 + op(V) * A2
+ *                            OP CoreBlasA2 :  A2 = A2 - op(V) * W
+ *
+ *         - CoreBlasRight : multiply op( V ) from the right
+ *                            OP CoreBlasW  :  W  = A1 + A2 * op(V)
+ *                            OP CoreBlasA2 :  A2 = A2 - W * op(V)
+ *
+ * @param[in] direct
+ *
+ *         Indicates how the block reflector is formed and hence where the
+ *         triangle of V lies:
+ *
+ *         - CoreBlasForward
+ *         - CoreBlasBackward
+ *
+ * @param[in] storev
+ *
+ *         Indicates how the vectors which define the elementary
+ *         reflectors are stored in V:
+ *
+ *         - CoreBlasColumnwise
+ *         - CoreBlasRowwise
+ *
+ * @param[in] m
+ *         The number of rows of the A1, A2 and W
+ *         If SIDE is CoreBlasLeft, the number of rows of op( V )
+ *
+ * @param[in] n
+ *         The number of columns of the A1, A2 and W
+ *         If SIDE is CoreBlasRight, the number of columns of op( V )
+ *
+ * @param[in] k
+ *         If SIDE is CoreBlasLeft, the number of columns of op( V )
+ *         If SIDE is CoreBlasRight, the number of rows of op( V )
+ *
+ * @param[in] l
+ *         The size of the triangular part of V
+ *
+ * @param[in] A1
+ *         On entry, the m-by-n tile A1.
+ *
+ * @param[in] lda1
+ *         The leading dimension of the array A1. lda1 >= max(1,m).
+ *
+ * @param[in,out] A2
+ *         On entry, the m-by-n tile A2.
+ *         On exit, if OP is CoreBlasA2 A2 is overwritten
+ *
+ * @param[in] lda2
+ *         The leading dimension of the tile A2. lda2 >= max(1,m).
+ *
+ * @param[in] V
+ *         The matrix V as described above.
+ *         If SIDE is CoreBlasLeft : op( V ) is m-by-k
+ *         If SIDE is CoreBlasRight: op( V ) is k-by-n
+ *
+ * @param[in] ldv
+ *         The leading dimension of the array V.
+ *
+ * @param[in,out] W
+ *         On entry, the m-by-n matrix W.
+ *         On exit, W is overwritten either if OP is CoreBlasA2 or CoreBlasW.
+ *         If OP is CoreBlasA2, W is an input and is used as a workspace.
+ *
+ * @param[in] ldw
+ *         The leading dimension of array W.
+ *
+ *******************************************************************************
+ *
+ * @retval CoreBlasSuccess successful exit
+ * @retval < 0 if -i, the i-th argument had an illegal value
+ *
+ ******************************************************************************/
+__attribute__((weak))
+int coreblas_spamm_direct(coreblas_enum_t op, coreblas_enum_t side,
+               coreblas_enum_t direct, coreblas_enum_t storev,
+               int m, int n, int k, int l,
+               const float *A1, int lda1,
+                     float *A2, int lda2,
+               const float *V,  int ldv,
+                     float *W,  int ldw)
+{
+#ifndef COREBLAS_UNCHECKED
+    // Check input arguments.
+    if ((op != CoreBlasW) && (op != CoreBlasA2)) {
+        coreblas_error("illegal value of op");
+        return -1;
+    }
+    if ((side != CoreBlasLeft) && (side != CoreBlasRight)) {
+        coreblas_error("illegal value of side");
+        return -2;
+    }
+    if ((direct != CoreBlasForward) && (direct != CoreBlasBackward)) {
+        coreblas_error("illegal value of direct");
+        return -3;
+    }
+    if ((storev != CoreBlasColumnwise) && (storev != CoreBlasRowwise)) {
+        coreblas_error("illegal value of storev");
+        return -4;
+    }
+    if (m < 0) {
+        coreblas_error("illegal value of m");
+        return -5;
+    }
+    if (n < 0) {
+        coreblas_error("illegal value of n");
+        return -6;
+    }
+    if (k < 0) {
+        coreblas_error("illegal value of k");
+        return -7;
+    }
+    if (l < 0) {
+        coreblas_error("illegal value of l");
+        return -8;
+    }
+    if (A1 == NULL) {
+        coreblas_error("NULL A1");
+        return -9;
+    }
+    if (lda1 < 0) {
+        coreblas_error("illegal value of lda1");
+        return -10;
+    }
+    if (A2 == NULL) {
+        coreblas_error("NULL A2");
+        return -11;
+    }
+    if (lda2 < 0) {
+        coreblas_error("illegal value of lda2");
+        return -12;
+    }
+    if (V == NULL) {
+        coreblas_error("NULL V");
+        return -13;
+    }
+    if (ldv < 0) {
+        coreblas_error("illegal value of ldv");
+        return -14;
+    }
+    if (W == NULL) {
+        coreblas_error("NULL W");
+        return -15;
+    }
+    if (ldw < 0) {
+        coreblas_error("illegal value of ldw");
+        return -16;
+    }
+#endif
+
+    return coreblas_spamm_nocheck(op, side,
+                                  direct, storev,
+                                  m, n, k, l,
+                                  A1, lda1,
+                                  A2, lda2,
+                                  V, ldv,
+                                  W, ldw);
+}
+
+/***************************************************************************//**
+ *
+ * @ingroup core_pamm
+ *
+ *  Same as coreblas_spamm_direct with direct = CoreBlasForward: the
+ *  triangle of V lies in the last L rows (columns) of A2's side.
+ *  The arguments are those of coreblas_spamm_direct without direct,
+ *  and are numbered accordingly in the returned value.
+ *
+ ******************************************************************************/
+__attribute__((weak))
+int coreblas_spamm(coreblas_enum_t op, coreblas_enum_t side,
+               coreblas_enum_t storev,
+               int m, int n, int k, int l,
+               const float *A1, int lda1,
+                     float *A2, int lda2,
+               const float *V,  int ldv,
+                     float *W,  int ldw)
+{
+    int info = coreblas_spamm_direct(op, side,
+                                     CoreBlasForward, storev,
+                                     m, n, k, l,
+                                     A1, lda1,
+                                     A2, lda2,
+                                     V, ldv,
+                                     W, ldw);
+
+    // Arguments after side are one place earlier than in
+    // coreblas_spamm_direct.
+    return info < -2 ? info+1 : info;
+}
+
+/***************************************************************************//**
+ *
+ * @ingroup core_pamm
+ *
+ *  Same as coreblas_spamm_direct, without checking the arguments. Called by
+ *  coreblas_sparfb once they have checked their own.
+ *
+ ******************************************************************************/
+int coreblas_spamm_nocheck(coreblas_enum_t op, coreblas_enum_t side,
+               coreblas_enum_t direct, coreblas_enum_t storev,
+               int m, int n, int k, int l,
+               const float *A1, int lda1,
+                     float *A2, int lda2,
+               const float *V,  int ldv,
+                     float *W,  int ldw)
+{
+    // quick return
+    if (m == 0 || n == 0 || k == 0)
+        return CoreBlasSuccess;
+
+    // TRANS is set as:
+    //
+    //        -------------------------------------
+    //         side   direct     CoreBlasW  CoreBlasA2
+    //        -------------------------------------
+    //         left   colwise       T        N
+    //                rowwise       N        T
+    //         right  colwise       N        T
+    //                rowwise       T        N
+    //        -------------------------------------
+
+    coreblas_enum_t uplo;
+    coreblas_enum_t trans;
+    int vi2, vi3;
+
+    //===================
+    // CoreBlasColumnwise
+    //===================
+    if (storev == CoreBlasColumnwise) {
+        uplo = CoreBlasUpper;
+        if (side == CoreBlasLeft) {
+            trans = op == CoreBlasA2 ? CoreBlasNoTrans : CoreBlasTrans;
+            vi2 = trans == CoreBlasNoTrans ? m - l : k - l;
+        }
+        else {
+            trans = op == CoreBlasW ? CoreBlasNoTrans : CoreBlasTrans;
+            vi2 = trans == CoreBlasNoTrans ? k - l : n - l;
+        }
+        vi3 = ldv * l;
+    }
+    //================
+    // CoreBlasRowwise
+    //================
+    else {
+        uplo = CoreBlasLower;
+        if (side == CoreBlasLeft) {
+            trans = op == CoreBlasW ? CoreBlasNoTrans : CoreBlasTrans;
+            vi2 = trans == CoreBlasNoTrans ? k - l : m - l;
+        }
+        else {
+            trans = op == CoreBlasA2 ? CoreBlasNoTrans : CoreBlasTrans;
+            vi2 = trans == CoreBlasNoTrans ? n - l : k - l;
+        }
+        vi2 *= ldv;
+        vi3  = l;
+    }
+
+    //=================
+    // CoreBlasBackward
+    //=================
+    if (direct == CoreBlasBackward) {
+        // The triangle is the transpose of the forward one. It holds the
+        // first l rows (columns) of A2 against the last l reflectors, next
+        // to the rectangle at vi1; the other reflectors start at V.
+        uplo = uplo == CoreBlasUpper ? CoreBlasLower : CoreBlasUpper;
+        int kr;
+        if (side == CoreBlasLeft)
+            kr = op == CoreBlasW ? m : k;
+        else
+            kr = op == CoreBlasW ? n : k;
+
+        int vi1;
+        if (storev == CoreBlasColumnwise) {
+            vi2 = ldv*(kr-l);
+            vi1 = vi2 + l;
+        }
+        else {
+            vi2 = kr-l;
+            vi1 = vi2 + ldv*l;
+        }
+
+        if (op == CoreBlasW) {
+            return coreblas_spamm_w_backward(side, trans, uplo,
+                                             m, n, k, l, vi1, vi2,
+                                             A1, lda1,
+                                             A2, lda2,
+                                             V,  ldv,
+                                             W,  ldw);
+        }
+        else {
+            return coreblas_spamm_a2_backward(side, trans, uplo,
+                                              m, n, k, l, vi1, vi2,
+                                              A2, lda2,
+                                              V,  ldv,
+                                              W,  ldw);
+        }
+    }
+
+    if (op == CoreBlasW) {
+        coreblas_spamm_w(side, trans, uplo,
+                     m, n, k, l, vi2, vi3,
+                     A1, lda1,
+                     A2, lda2,
+                     V, ldv,
+                     W, ldw);
+    }
+    else if (op == CoreBlasA2) {
+        coreblas_spamm_a2(side, trans, uplo,
+                      m, n, k, l, vi2, vi3,
+                      A2, lda2,
+                      V,  ldv,
+                      W,  ldw);
+    }
+
+    return CoreBlasSuccess;
+}
+
+/******************************************************************************/
+static inline int coreblas_spamm_w(
+        coreblas_enum_t side, coreblas_enum_t trans, coreblas_enum_t uplo,
+        int m, int n, int k, int l, int vi2, int vi3,
+        const float *A1, int lda1,
+              float *A2, int lda2,
+        const float *V,  int ldv,
+              float *W,  int ldw)
+{
+    // W = A1 + op(V) * A2  or  W = A1 + A2 * op(V)
+
+    float zone  = 1.0;
+    float zzero = 0.0;
+
+    //=============
+    // CoreBlasLeft
+    //=============
+    if (side == CoreBlasLeft) {
+        if ((trans == CoreBlasTrans && uplo == CoreBlasUpper) ||
+            (trans == CoreBlasNoTrans && uplo == CoreBlasLower)) {
+            // W = A1 + V^T * A2
+
+            // W = A2_2
+            #ifdef COREBLAS_USE_64BIT_BLAS
+                 LAPACKE_slacpy_work64_(LAPACK_COL_MAJOR,
+                            lapack_const(CoreBlasGeneral),
+                            l, n,
+                            &A2[k-l], lda2,
+                            W,       ldw);
+            #else
+                 LAPACKE_slacpy_work(LAPACK_COL_MAJOR,
+                            lapack_const(CoreBlasGeneral),
+                            l, n,
+                            &A2[k-l], lda2,
+                            W,       ldw);
+            #endif 
+
+
+            // W = V_2^T * W + V_1^T * A2_1 (ge+tr, top L rows of V^T)
+            if (l > 0) {
+                // W = V_2^T * W
+            #ifdef COREBLAS_USE_64BIT_BLAS
+                cblas_strmm64_(CblasColMajor,
+                            CblasLeft, (CBLAS_UPLO)uplo,
+                            (CBLAS_TRANSPOSE)trans, CblasNonUnit,
+                            l, n,
+                            (zone), &V[vi2], ldv,
+                                                W,      ldw);
+            #else
+                cblas_strmm(CblasColMajor,
+                            CblasLeft, (CBLAS_UPLO)uplo,
+                            (CBLAS_TRANSPOSE)trans, CblasNonUnit,
+                            l, n,
+                            (zone), &V[vi2], ldv,
+                                                W,      ldw);
+            #endif 
+
+
+                // W = W + V_1^T * A2_1
+                if (k > l) {
+                #ifdef COREBLAS_USE_64BIT_BLAS
+                    cblas_sgemm64_(CblasColMajor,
+                                (CBLAS_TRANSPOSE)trans, CblasNoTrans,
+                                l, n, k-l,
+                                (zone), V,  ldv,
+                                                   A2, lda2,
+                                (zone), W,  ldw);
+
+                #else
+                    cblas_sgemm(CblasColMajor,
+                                (CBLAS_TRANSPOSE)trans, CblasNoTrans,
+                                l, n, k-l,
+                                (zone), V,  ldv,
+                                                   A2, lda2,
+                                (zone), W,  ldw);
+                #endif 
+
+                }
+            }
+
+            // W_2 = V_3^T * A2: (ge, bottom M-L rows of V^T)
+            if (m > l) {
+            #ifdef COREBLAS_USE_64BIT_BLAS
+                cblas_sgemm64_(CblasColMajor,
+                            (CBLAS_TRANSPOSE)trans, CblasNoTrans,
+                            (m-l), n, k,
+                            (zone),  &V[vi3], ldv,
+                                                 A2,     lda2,
+                            (zzero), &W[l],   ldw);
+            #else
+                cblas_sgemm(CblasColMajor,
+                            (CBLAS_TRANSPOSE)trans, CblasNoTrans,
+                            (m-l), n, k,
+                            (zone),  &V[vi3], ldv,
+                                                 A2,     lda2,
+                            (zzero), &W[l],   ldw);
+            #endif 
+
+            }
+
+            // W = A1 + W
+            for (int j = 0; j < n; j++) {
+            #ifdef COREBLAS_USE_64BIT_BLAS
+                cblas_saxpy64_(m, (zone),
+                            &A1[lda1*j], 1,
+                            &W[ldw*j], 1);
+            #else
+                cblas_saxpy(m, (zone),
+                            &A1[lda1*j], 1,
+                            &W[ldw*j], 1);
+            #endif 
+
+            }
+        }
+        else {
+            coreblas_error(
+                "Left Upper/NoTrans & Lower/[Conj]Trans not implemented");
+            return CoreBlasErrorNotSupported;
+        }
+    }
+    //==============
+    // CoreBlasRight
+    //==============
+    else {
+        if ((trans == CoreBlasTrans && uplo == CoreBlasUpper) ||
+            (trans == CoreBlasNoTrans && uplo == CoreBlasLower)) {
+            coreblas_error(
+                "Right Upper/[Conj]Trans & Lower/NoTrans not implemented");
+            return CoreBlasErrorNotSupported;
+        }
+        else {
+            // W = A1 + A2 * V
+            if (l > 0) {
+                // W = A2_2
+                #ifdef COREBLAS_USE_64BIT_BLAS
+                    LAPACKE_slacpy_work64_(LAPACK_COL_MAJOR,
+                                lapack_const(CoreBlasGeneral),
+                                m, l,
+                                &A2[lda2*(k-l)], lda2,
+                                W,              ldw);
+                #else
+                    LAPACKE_slacpy_work(LAPACK_COL_MAJOR,
+                                lapack_const(CoreBlasGeneral),
+                                m, l,
+                                &A2[lda2*(k-l)], lda2,
+                                W,              ldw);
+                #endif 
+
+                // W = W * V_2 --> W = A2_2 * V_2
+                #ifdef COREBLAS_USE_64BIT_BLAS
+                    cblas_strmm64_(CblasColMajor,
+                            CblasRight, (CBLAS_UPLO)uplo,
+                            (CBLAS_TRANSPOSE)trans, CblasNonUnit,
+                            m, l,
+                            (zone), &V[vi2], ldv,
+                                                W,      ldw);
+                #else
+                    cblas_strmm(CblasColMajor,
+                            CblasRight, (CBLAS_UPLO)uplo,
+                            (CBLAS_TRANSPOSE)trans, CblasNonUnit,
+                            m, l,
+                            (zone), &V[vi2], ldv,
+                                                W,      ldw);
+                #endif 
+
+
+                // W = W + A2_1 * V_1
+                if (k > l) {
+                #ifdef COREBLAS_USE_64BIT_BLAS
+                        cblas_sgemm64_(CblasColMajor,
+                                CblasNoTrans, (CBLAS_TRANSPOSE)trans,
+                                m, l, k-l,
+                                (zone), A2, lda2,
+                                                   V,  ldv,
+                                (zone), W,  ldw);
+                #else
+                        cblas_sgemm(CblasColMajor,
+                                CblasNoTrans, (CBLAS_TRANSPOSE)trans,
+                                m, l, k-l,
+                                (zone), A2, lda2,
+                                                   V,  ldv,
+                                (zone), W,  ldw);
+                #endif 
+                }
+            }
+
+            // W = W + A2 * V_3
+            if (n > l) {
+            #ifdef COREBLAS_USE_64BIT_BLAS
+                    cblas_sgemm64_(CblasColMajor,
+                            CblasNoTrans, (CBLAS_TRANSPOSE)trans,
+                            m, n-l, k,
+                            (zone),   A2,       lda2,
+                                                &V[vi3],   ldv,
+                            (zzero), &W[ldw*l], ldw);
+            #else
+                    cblas_sgemm(CblasColMajor,
+                            CblasNoTrans, (CBLAS_TRANSPOSE)trans,
+                            m, n-l, k,
+                            (zone),   A2,       lda2,
+                                                &V[vi3],   ldv,
+                            (zzero), &W[ldw*l], ldw);
+            #endif 
+
+            }
+
+            // W = A1 + W
+            for (int j = 0; j < n; j++) {
+            #ifdef COREBLAS_USE_64BIT_BLAS
+                    cblas_saxpy64_(m, (zone),
+                            &A1[lda1*j], 1,
+                            &W[ldw*j],   1);
+            #else
+                    cblas_saxpy(m, (zone),
+                            &A1[lda1*j], 1,
+                            &W[ldw*j],   1);
+            #endif 
+
+            }
+        }
+    }
+
+    return CoreBlasSuccess;
+}
+
+/******************************************************************************/
+static inline int coreblas_spamm_a2(
+        coreblas_enum_t side, coreblas_enum_t trans, coreblas_enum_t uplo,
+        int m, int n, int k, int l, int vi2, int vi3,
+              float *A2, int lda2,
+        const float *V,  int ldv,
+              float *W,  int ldw)
+{
+    // A2 = A2 + op(V) * W  or  A2 = A2 + W * op(V)
+
+    float zone  =  1.0;
+    float zmone = -1.0;
+
+    //=============
+    // CoreBlasLeft
+    //=============
+    if (side == CoreBlasLeft) {
+        if ((trans == CoreBlasTrans && uplo == CoreBlasUpper) ||
+            (trans == CoreBlasNoTrans && uplo == CoreBlasLower)) {
+            coreblas_error(
+                "Left Upper/[Conj]Trans & Lower/NoTrans not implemented");
+            return CoreBlasErrorNotSupported;
+        }
+        else {
+            // A2 = A2 - V * W
+
+            // A2_1 = A2_1 - V_1  * W_1
+            if (m > l) {
+            #ifdef COREBLAS_USE_64BIT_BLAS
+                cblas_sgemm64_(CblasColMajor,
+                            (CBLAS_TRANSPOSE)trans, CblasNoTrans,
+                            m-l, n, l,
+                            (zmone), V,  ldv,
+                                                W,  ldw,
+                            (zone),  A2, lda2);
+            #else
+                cblas_sgemm(CblasColMajor,
+                            (CBLAS_TRANSPOSE)trans, CblasNoTrans,
+                            m-l, n, l,
+                            (zmone), V,  ldv,
+                                                W,  ldw,
+                            (zone),  A2, lda2);
+            #endif 
+
+            }
+
+            // W_1 = V_2 * W_1
+            #ifdef COREBLAS_USE_64BIT_BLAS
+                cblas_strmm64_(CblasColMajor,
+                        CblasLeft, (CBLAS_UPLO)uplo,
+                        (CBLAS_TRANSPOSE)trans, CblasNonUnit,
+                        l, n,
+                        (zone), &V[vi2], ldv,
+                                            W,      ldw);
+            #else
+                cblas_strmm(CblasColMajor,
+                        CblasLeft, (CBLAS_UPLO)uplo,
+                        (CBLAS_TRANSPOSE)trans, CblasNonUnit,
+                        l, n,
+                        (zone), &V[vi2], ldv,
+                                            W,      ldw);
+            #endif 
+
+
+            // A2_2 = A2_2 - W_1
+            for (int j = 0; j < n; j++) {
+            #ifdef COREBLAS_USE_64BIT_BLAS
+                cblas_saxpy64_(l, (zmone),
+                            &W[ldw*j], 1,
+                            &A2[lda2*j+(m-l)], 1);
+            #else
+                cblas_saxpy(l, (zmone),
+                            &W[ldw*j], 1,
+                            &A2[lda2*j+(m-l)], 1);
+            #endif 
+
+            }
+
+            // A2 = A2 - V_3  * W_2
+            if (k > l) {
+                    #ifdef COREBLAS_USE_64BIT_BLAS
+                        cblas_sgemm64_(CblasColMajor,
+                            (CBLAS_TRANSPOSE)trans, CblasNoTrans,
+                            m, n, (k-l),
+                            (zmone), &V[vi3], ldv,
+                                                &W[l],   ldw,
+                            (zone),   A2,     lda2);
+                    #else
+                        cblas_sgemm(CblasColMajor,
+                            (CBLAS_TRANSPOSE)trans, CblasNoTrans,
+                            m, n, (k-l),
+                            (zmone), &V[vi3], ldv,
+                                                &W[l],   ldw,
+                            (zone),   A2,     lda2);
+                    #endif 
+
+            }
+        }
+    }
+    //==============
+    // CoreBlasRight
+    //==============
+    else {
+        if ((trans == CoreBlasTrans && uplo == CoreBlasUpper) ||
+            (trans == CoreBlasNoTrans && uplo == CoreBlasLower)) {
+            // A2 = A2 - W * V^T
+
+            // A2 = A2 - W_2 * V_3^T
+            if (k > l) {
+            #ifdef COREBLAS_USE_64BIT_BLAS
+                cblas_sgemm64_(CblasColMajor,
+                            CblasNoTrans, (CBLAS_TRANSPOSE)trans,
+                            m, n, k-l,
+                            (zmone), &W[ldw*l], ldw,
+                                                &V[vi3],   ldv,
+                            (zone),   A2,       lda2);
+            #else
+                cblas_sgemm(CblasColMajor,
+                            CblasNoTrans, (CBLAS_TRANSPOSE)trans,
+                            m, n, k-l,
+                            (zmone), &W[ldw*l], ldw,
+                                                &V[vi3],   ldv,
+                            (zone),   A2,       lda2);
+            #endif 
+
+            }
+
+            // A2_1 = A2_1 - W_1 * V_1^T
+            if (n > l) {
+            #ifdef COREBLAS_USE_64BIT_BLAS
+                cblas_sgemm64_(CblasColMajor,
+                            CblasNoTrans, (CBLAS_TRANSPOSE)trans,
+                            m, n-l, l,
+                            (zmone), W,  ldw,
+                                                V,  ldv,
+                            (zone),  A2, lda2);
+            #else
+                cblas_sgemm(CblasColMajor,
+                            CblasNoTrans, (CBLAS_TRANSPOSE)trans,
+                            m, n-l, l,
+                            (zmone), W,  ldw,
+                                                V,  ldv,
+                            (zone),  A2, lda2);
+            #endif 
+
+            }
+
+            // A2_2 =  A2_2 -  W_1 * V_2^T
+            if (l > 0) {
+            #ifdef COREBLAS_USE_64BIT_BLAS
+                cblas_strmm64_(CblasColMajor,
+                            CblasRight, (CBLAS_UPLO)uplo,
+                            (CBLAS_TRANSPOSE)trans, CblasNonUnit,
+                            m, l,
+                            (zmone), &V[vi2], ldv,
+                                                 W,      ldw);
+            #else
+                cblas_strmm(CblasColMajor,
+                            CblasRight, (CBLAS_UPLO)uplo,
+                            (CBLAS_TRANSPOSE)trans, CblasNonUnit,
+                            m, l,
+                            (zmone), &V[vi2], ldv,
+                                                 W,      ldw);
+            #endif 
+
+
+                for (int j = 0; j < l; j++) {
+                #ifdef COREBLAS_USE_64BIT_BLAS
+                    cblas_saxpy64_(m, (zone),
+                                &W[ldw*j], 1,
+                                &A2[lda2*(n-l+j)], 1);
+                #else
+                    cblas_saxpy(m, (zone),
+                                &W[ldw*j], 1,
+                                &A2[lda2*(n-l+j)], 1);
+                #endif 
+
+                }
+            }
+        }
+        else {
+            coreblas_error(
+                "Right Upper/NoTrans & Lower/[Conj]Trans not implemented");
+            return CoreBlasErrorNotSupported;
+        }
+    }
+
+    return CoreBlasSuccess;
+}
+
+/******************************************************************************/
+static inline int coreblas_spamm_w_backward(
+        coreblas_enum_t side, coreblas_enum_t trans, coreblas_enum_t uplo,
+        int m, int n, int k, int l, int vi1, int vi2,
+        const float *A1, int lda1,
+              float *A2, int lda2,
+        const float *V,  int ldv,
+              float *W,  int ldw)
+{
+    // W = A1 + op(V) * A2  or  W = A1 + A2 * op(V)
+
+    float zone  = 1.0;
+    float zzero = 0.0;
+
+    //=============
+    // CoreBlasLeft
+    //=============
+    if (side == CoreBlasLeft) {
+        if (l > 0) {
+            // W_2 = A2_1 (first L rows of A2)
+#ifdef COREBLAS_USE_64BIT_BLAS
+            LAPACKE_slacpy_work64_(LAPACK_COL_MAJOR,
+                                   lapack_const(CoreBlasGeneral),
+                                   l, n,
+                                   A2,      lda2,
+                                   &W[m-l], ldw);
+#else
+            LAPACKE_slacpy_work(LAPACK_COL_MAJOR,
+                                lapack_const(CoreBlasGeneral),
+                                l, n,
+                                A2,      lda2,
+                                &W[m-l], ldw);
+#endif
+
+            // W_2 = V_2 * W_2 (triangle)
+#ifdef COREBLAS_USE_64BIT_BLAS
+            cblas_strmm64_(CblasColMajor,
+                           CblasLeft, (CBLAS_UPLO)uplo,
+                           (CBLAS_TRANSPOSE)trans, CblasNonUnit,
+                           l, n,
+                           (zone), &V[vi2], ldv,
+                                              &W[m-l], ldw);
+#else
+            cblas_strmm(CblasColMajor,
+                        CblasLeft, (CBLAS_UPLO)uplo,
+                        (CBLAS_TRANSPOSE)trans, CblasNonUnit,
+                        l, n,
+                        (zone), &V[vi2], ldv,
+                                           &W[m-l], ldw);
+#endif
+
+            // W_2 = W_2 + V_1 * A2_2 (rectangle next to the triangle)
+            if (k > l) {
+#ifdef COREBLAS_USE_64BIT_BLAS
+                cblas_sgemm64_(CblasColMajor,
+                               (CBLAS_TRANSPOSE)trans, CblasNoTrans,
+                               l, n, k-l,
+                               (zone), &V[vi1], ldv,
+                                                  &A2[l],  lda2,
+                               (zone), &W[m-l], ldw);
+#else
+                cblas_sgemm(CblasColMajor,
+                            (CBLAS_TRANSPOSE)trans, CblasNoTrans,
+                            l, n, k-l,
+                            (zone), &V[vi1], ldv,
+                                               &A2[l],  lda2,
+                            (zone), &W[m-l], ldw);
+#endif
+            }
+        }
+
+        // W_1 = V_3 * A2 (first M-L reflectors)
+        if (m > l) {
+#ifdef COREBLAS_USE_64BIT_BLAS
+            cblas_sgemm64_(CblasColMajor,
+                           (CBLAS_TRANSPOSE)trans, CblasNoTrans,
+                           m-l, n, k,
+                           (zone),  V,  ldv,
+                                               A2, lda2,
+                           (zzero), W,  ldw);
+#else
+            cblas_sgemm(CblasColMajor,
+                        (CBLAS_TRANSPOSE)trans, CblasNoTrans,
+                        m-l, n, k,
+                        (zone),  V,  ldv,
+                                            A2, lda2,
+                        (zzero), W,  ldw);
+#endif
+        }
+    }
+    //==============
+    // CoreBlasRight
+    //==============
+    else {
+        if (l > 0) {
+            // W_2 = A2_1 (first L columns of A2)
+#ifdef COREBLAS_USE_64BIT_BLAS
+            LAPACKE_slacpy_work64_(LAPACK_COL_MAJOR,
+                                   lapack_const(CoreBlasGeneral),
+                                   m, l,
+                                   A2,            lda2,
+                                   &W[ldw*(n-l)], ldw);
+#else
+            LAPACKE_slacpy_work(LAPACK_COL_MAJOR,
+                                lapack_const(CoreBlasGeneral),
+                                m, l,
+                                A2,            lda2,
+                                &W[ldw*(n-l)], ldw);
+#endif
+
+            // W_2 = W_2 * V_2 (triangle)
+#ifdef COREBLAS_USE_64BIT_BLAS
+            cblas_strmm64_(CblasColMajor,
+                           CblasRight, (CBLAS_UPLO)uplo,
+                           (CBLAS_TRANSPOSE)trans, CblasNonUnit,
+                           m, l,
+                           (zone), &V[vi2],       ldv,
+                                              &W[ldw*(n-l)], ldw);
+#else
+            cblas_strmm(CblasColMajor,
+                        CblasRight, (CBLAS_UPLO)uplo,
+                        (CBLAS_TRANSPOSE)trans, CblasNonUnit,
+                        m, l,
+                        (zone), &V[vi2],       ldv,
+                                           &W[ldw*(n-l)], ldw);
+#endif
+
+            // W_2 = W_2 + A2_2 * V_1 (rectangle next to the triangle)
+            if (k > l) {
+#ifdef COREBLAS_USE_64BIT_BLAS
+                cblas_sgemm64_(CblasColMajor,
+                               CblasNoTrans, (CBLAS_TRANSPOSE)trans,
+                               m, l, k-l,
+                               (zone), &A2[lda2*l],   lda2,
+                                                  &V[vi1],       ldv,
+                               (zone), &W[ldw*(n-l)], ldw);
+#else
+                cblas_sgemm(CblasColMajor,
+                            CblasNoTrans, (CBLAS_TRANSPOSE)trans,
+                            m, l, k-l,
+                            (zone), &A2[lda2*l],   lda2,
+                                               &V[vi1],       ldv,
+                            (zone), &W[ldw*(n-l)], ldw);
+#endif
+            }
+        }
+
+        // W_1 = A2 * V_3 (first N-L reflectors)
+        if (n > l) {
+#ifdef COREBLAS_USE_64BIT_BLAS
+            cblas_sgemm64_(CblasColMajor,
+                           CblasNoTrans, (CBLAS_TRANSPOSE)trans,
+                           m, n-l, k,
+                           (zone),  A2, lda2,
+                                               V,  ldv,
+                           (zzero), W,  ldw);
+#else
+            cblas_sgemm(CblasColMajor,
+                        CblasNoTrans, (CBLAS_TRANSPOSE)trans,
+                        m, n-l, k,
+                        (zone),  A2, lda2,
+                                            V,  ldv,
+                        (zzero), W,  ldw);
+#endif
+        }
+    }
+
+    // W = A1 + W
+    for (int j = 0; j < n; j++)
+        for (int i = 0; i < m; i++)
+            W[ldw*j+i] += A1[lda1*j+i];
+
+    return CoreBlasSuccess;
+}
+
+/******************************************************************************/
+static inline int coreblas_spamm_a2_backward(
+        coreblas_enum_t side, coreblas_enum_t trans, coreblas_enum_t uplo,
+        int m, int n, int k, int l, int vi1, int vi2,
+              float *A2, int lda2,
+        const float *V,  int ldv,
+              float *W,  int ldw)
+{
+    // A2 = A2 - op(V) * W  or  A2 = A2 - W * op(V)
+
+    float zone  =  1.0;
+    float zmone = -1.0;
+
+    //=============
+    // CoreBlasLeft
+    //=============
+    if (side == CoreBlasLeft) {
+        // A2_2 = A2_2 - V_1 * W_2 (rectangle next to the triangle)
+        if (l > 0 && m > l) {
+#ifdef COREBLAS_USE_64BIT_BLAS
+            cblas_sgemm64_(CblasColMajor,
+                           (CBLAS_TRANSPOSE)trans, CblasNoTrans,
+                           m-l, n, l,
+                           (zmone), &V[vi1], ldv,
+                                               &W[k-l], ldw,
+                           (zone),  &A2[l],  lda2);
+#else
+            cblas_sgemm(CblasColMajor,
+                        (CBLAS_TRANSPOSE)trans, CblasNoTrans,
+                        m-l, n, l,
+                        (zmone), &V[vi1], ldv,
+                                            &W[k-l], ldw,
+                        (zone),  &A2[l],  lda2);
+#endif
+        }
+
+        // A2 = A2 - V_3 * W_1 (first K-L reflectors)
+        if (k > l) {
+#ifdef COREBLAS_USE_64BIT_BLAS
+            cblas_sgemm64_(CblasColMajor,
+                           (CBLAS_TRANSPOSE)trans, CblasNoTrans,
+                           m, n, k-l,
+                           (zmone), V,  ldv,
+                                               W,  ldw,
+                           (zone),  A2, lda2);
+#else
+            cblas_sgemm(CblasColMajor,
+                        (CBLAS_TRANSPOSE)trans, CblasNoTrans,
+                        m, n, k-l,
+                        (zmone), V,  ldv,
+                                            W,  ldw,
+                        (zone),  A2, lda2);
+#endif
+        }
+
+        if (l > 0) {
+            // W_2 = V_2 * W_2 (triangle)
+#ifdef COREBLAS_USE_64BIT_BLAS
+            cblas_strmm64_(CblasColMajor,
+                           CblasLeft, (CBLAS_UPLO)uplo,
+                           (CBLAS_TRANSPOSE)trans, CblasNonUnit,
+                           l, n,
+                           (zone), &V[vi2], ldv,
+                                              &W[k-l], ldw);
+#else
+            cblas_strmm(CblasColMajor,
+                        CblasLeft, (CBLAS_UPLO)uplo,
+                        (CBLAS_TRANSPOSE)trans, CblasNonUnit,
+                        l, n,
+                        (zone), &V[vi2], ldv,
+                                           &W[k-l], ldw);
+#endif
+
+            // A2_1 = A2_1 - W_2
+            for (int j = 0; j < n; j++)
+                for (int i = 0; i < l; i++)
+                    A2[lda2*j+i] -= W[ldw*j+(k-l)+i];
+        }
+    }
+    //==============
+    // CoreBlasRight
+    //==============
+    else {
+        // A2_2 = A2_2 - W_2 * V_1 (rectangle next to the triangle)
+        if (l > 0 && n > l) {
+#ifdef COREBLAS_USE_64BIT_BLAS
+            cblas_sgemm64_(CblasColMajor,
+                           CblasNoTrans, (CBLAS_TRANSPOSE)trans,
+                           m, n-l, l,
+                           (zmone), &W[ldw*(k-l)], ldw,
+                                               &V[vi1],       ldv,
+                           (zone),  &A2[lda2*l],   lda2);
+#else
+            cblas_sgemm(CblasColMajor,
+                        CblasNoTrans, (CBLAS_TRANSPOSE)trans,
+                        m, n-l, l,
+                        (zmone), &W[ldw*(k-l)], ldw,
+                                            &V[vi1],       ldv,
+                        (zone),  &A2[lda2*l],   lda2);
+#endif
+        }
+
+        // A2 = A2 - W_1 * V_3 (first K-L reflectors)
+        if (k > l) {
+#ifdef COREBLAS_USE_64BIT_BLAS
+            cblas_sgemm64_(CblasColMajor,
+                           CblasNoTrans, (CBLAS_TRANSPOSE)trans,
+                           m, n, k-l,
+                           (zmone), W,  ldw,
+                                               V,  ldv,
+                           (zone),  A2, lda2);
+#else
+            cblas_sgemm(CblasColMajor,
+                        CblasNoTrans, (CBLAS_TRANSPOSE)trans,
+                        m, n, k-l,
+                        (zmone), W,  ldw,
+                                            V,  ldv,
+                        (zone),  A2, lda2);
+#endif
+        }
+
+        if (l > 0) {
+            // W_2 = W_2 * V_2 (triangle)
+#ifdef COREBLAS_USE_64BIT_BLAS
+            cblas_strmm64_(CblasColMajor,
+                           CblasRight, (CBLAS_UPLO)uplo,
+                           (CBLAS_TRANSPOSE)trans, CblasNonUnit,
+                           m, l,
+                           (zone), &V[vi2],       ldv,
+                                              &W[ldw*(k-l)], ldw);
+#else
+            cblas_strmm(CblasColMajor,
+                        CblasRight, (CBLAS_UPLO)uplo,
+                        (CBLAS_TRANSPOSE)trans, CblasNonUnit,
+                        m, l,
+                        (zone), &V[vi2],       ldv,
+                                           &W[ldw*(k-l)], ldw);
+#endif
+
+            // A2_1 = A2_1 - W_2
+            for (int j = 0; j < l; j++)
+                for (int i = 0; i < m; i++)
+                    A2[lda2*j+i] -= W[ldw*(k-l+j)+i];
+        }
+    }
+
+    return CoreBlasSuccess;
+}
@@ -0,0 +1,269 @@
+/**
+ *
+ * @file
+ *
+ *  COREBLAS is a software package provided by:
+ *  University of Tennessee, US,
+ *  University of Manchester, UK.
+ *
+ * @generated from core_blas/core_zreduce.c, normal z -> s, Fri Oct 16 03:36:55 2026
+ *
+ **/
+
+#include <coreblas.h>
+#include "coreblas_types.h"
+
+#include <math.h>
+
+// The partials are reduced by a binary tree whose shape depends only on
+// their number: halves are split until at most COREBLAS_REDUCE_LEAF
+// partials remain, which are reduced in order. The result is thus the
+// same for any number of threads. Threads are used from
+// COREBLAS_REDUCE_PARALLEL partials on.
+#define COREBLAS_REDUCE_LEAF     32
+#define COREBLAS_REDUCE_PARALLEL 16384
+
+/******************************************************************************/
+// Adds the scaled sum of squares (s2, q2) to (*s1, *q1),
+// as coreblas_sgessq_aux. An infinite *s1 is left as it is, since
+// merging a second one would give Inf/Inf.
+static inline void core_sreduce_ssq_add(float s2, float q2,
+                                        float *s1, float *q1)
+{
+    if (*s1 < s2) {
+        *q1 = q2 + *q1*((*s1/s2)*(*s1/s2));
+        *s1 = s2;
+    }
+    else if (*s1 > 0.0 && !isinf(*s1)) {
+        *q1 = *q1 + q2*((s2/(*s1))*(s2/(*s1)));
+    }
+}
+
+/******************************************************************************/
+// The leaves are scaled by their largest scale factor in two vectorized
+// passes, instead of updating the scale factor pair by pair.
+static void core_sreduce_ssq_seq(int n,
+                                 const float *scale, const float *sumsq,
+                                 float *scl, float *sum)
+{
+    if (n <= COREBLAS_REDUCE_LEAF) {
+        float smax = 0.0;
+        #pragma omp simd reduction(max:smax)
+        for (int i = 0; i < n; i++)
+            smax = scale[i] > smax ? scale[i] : smax;
+
+        *scl = smax;
+        *sum = 1.0;
+        if (isinf(smax)) {
+            // The norm is infinite; scaling by 1/smax = 0 would give
+            // 0*Inf = NaN.
+            return;
+        }
+        if (smax > 0.0) {
+            float rmax = 1.0/smax;
+            float q = 0.0;
+            if (isinf(rmax)) {
+                // smax is subnormal.
+                for (int i = 0; i < n; i++)
+                    q += sumsq[i]*((scale[i]/smax)*(scale[i]/smax));
+            }
+            else {
+                #pragma omp simd reduction(+:q)
+                for (int i = 0; i < n; i++)
+                    q += sumsq[i]*((scale[i]*rmax)*(scale[i]*rmax));
+            }
+            *sum = q;
+        }
+        return;
+    }
+
+    int h = n/2;
+    float scl2, sum2;
+    core_sreduce_ssq_seq(h, scale, sumsq, scl, sum);
+    core_sreduce_ssq_seq(n-h, &scale[h], &sumsq[h], &scl2, &sum2);
+    core_sreduce_ssq_add(scl2, sum2, scl, sum);
+}
+
+/******************************************************************************/
+// The same tree, with the upper subtrees reduced by OpenMP tasks.
+static void core_sreduce_ssq_par(int n,
+                                 const float *scale, const float *sumsq,
+                                 float *scl, float *sum)
+{
+    if (n < COREBLAS_REDUCE_PARALLEL/4) {
+        core_sreduce_ssq_seq(n, scale, sumsq, scl, sum);
+        return;
+    }
+
+    int h = n/2;
+    float scl2, sum2;
+    #pragma omp task shared(scl2, sum2)
+    core_sreduce_ssq_par(n-h, &scale[h], &sumsq[h], &scl2, &sum2);
+
+    core_sreduce_ssq_par(h, scale, sumsq, scl, sum);
+
+    #pragma omp taskwait
+    core_sreduce_ssq_add(scl2, sum2, scl, sum);
+}
+
+/******************************************************************************/
+// Pairwise sum of the n elements x[incx*i].
+static float core_sreduce_sum(int n, const float *x, int incx)
+{
+    if (n <= COREBLAS_REDUCE_LEAF) {
+        float sum = 0.0;
+        for (int i = 0; i < n; i++)
+            sum += x[(size_t)incx*i];
+        return sum;
+    }
+
+    int h = n/2;
+    return core_sreduce_sum(h, x, incx) +
+           core_sreduce_sum(n-h, &x[(size_t)incx*h], incx);
+}
+
+/******************************************************************************/
+// Maximum that propagates a NaN.
+static inline float core_sreduce_max(float a, float b)
+{
+    return isnan(b) || b > a ? b : a;
+}
+
+/***************************************************************************//**
+ *
+ * @ingroup core_lange
+ *
+ *  Reduces n scaled sums of squares, e.g., those computed by
+ *  coreblas_sgessq on the tiles of a matrix, into one:
+ *
+ *    scl^2 * sum = sum_i scale[i]^2 * sumsq[i].
+ *
+ *  If a scale factor is infinite, scl is infinite and sum is 1.
+ *
+ *  The pairs are merged by a pairwise tree, which does not depend on the
+ *  number of threads, so that the result is reproducible. From
+ *  COREBLAS_REDUCE_PARALLEL pairs on, the subtrees are reduced by the
+ *  tasks of an OpenMP parallel region.
+ *
+ *******************************************************************************
+ *
+ * @param[in] n
+ *          The number of pairs. n >= 0.
+ *
+ * @param[in] scale
+ *          The array of the n scale factors.
+ *
+ * @param[in] sumsq
+ *          The array of the n sums of squares.
+ *
+ * @param[out] scl
+ *          The scale factor of the reduced sum of squares.
+ *
+ * @param[out] sum
+ *          The reduced sum of squares, scaled by scl^2.
+ *
+ ******************************************************************************/
+__attribute__((weak))
+void coreblas_sreduce_ssq(int n, const float *scale, const float *sumsq,
+                          float *scl, float *sum)
+{
+    if (n < COREBLAS_REDUCE_PARALLEL) {
+        core_sreduce_ssq_seq(n, scale, sumsq, scl, sum);
+        return;
+    }
+
+    #pragma omp parallel
+    #pragma omp single
+    core_sreduce_ssq_par(n, scale, sumsq, scl, sum);
+}
+
+/***************************************************************************//**
+ *
+ * @ingroup core_lange
+ *
+ *  Reduces the partial results of a norm computed tile by tile into the
+ *  norm of the whole matrix:
+ *
+ *  - CoreBlasMaxNorm: W holds the largest moduli of the tiles; returns
+ *    the largest element of W.
+ *  - CoreBlasOneNorm: the column W(:, j) holds the sums of the moduli of
+ *    column j in each tile row, e.g., as computed by coreblas_slange_aux;
+ *    returns the largest sum of a column of W.
+ *  - CoreBlasInfNorm: the row W(i, :) holds the sums of the moduli of
+ *    row i in each tile column; returns the largest sum of a row of W.
+ *
+ *  The sums are computed by a pairwise tree, which does not depend on the
+ *  number of threads, so that the result is reproducible. From
+ *  COREBLAS_REDUCE_PARALLEL partials on, the sums are distributed among
+ *  the threads of an OpenMP parallel region. A NaN is propagated.
+ *
+ *******************************************************************************
+ *
+ * @param[in] norm
+ *          - CoreBlasMaxNorm: max norm,
+ *          - CoreBlasOneNorm: one norm,
+ *          - CoreBlasInfNorm: infinity norm.
+ *
+ * @param[in] m
+ *          The number of rows of the array W. m >= 0.
+ *
+ * @param[in] n
+ *          The number of columns of the array W. n >= 0.
+ *
+ * @param[in] W
+ *          The m-by-n array of the partial results.
+ *
+ * @param[in] ldw
+ *          The leading dimension of the array W. ldw >= max(1,m).
+ *
+ * @param[out] value
+ *          The norm.
+ *
+ ******************************************************************************/
+__attribute__((weak))
+void coreblas_sreduce_norm(coreblas_enum_t norm, int m, int n,
+                           const float *W, int ldw, float *value)
+{
+    int par = (size_t)m*n >= COREBLAS_REDUCE_PARALLEL;
+    float vmax = 0.0;
+
+    switch (norm) {
+    case CoreBlasMaxNorm:
+        #pragma omp parallel if (par)
+        {
+            float tmax = 0.0;
+            #pragma omp for schedule(static) nowait
+            for (int j = 0; j < n; j++)
+                for (int i = 0; i < m; i++)
+                    tmax = core_sreduce_max(tmax, W[(size_t)ldw*j+i]);
+            #pragma omp critical
+            vmax = core_sreduce_max(vmax, tmax);
+        }
+        break;
+    case CoreBlasOneNorm:
+        #pragma omp parallel if (par)
+        {
+            float tmax = 0.0;
+            #pragma omp for schedule(static) nowait
+            for (int j = 0; j < n; j++)
+                tmax = core_sreduce_max(
+                    tmax, core_sreduce_sum(m, &W[(size_t)ldw*j], 1));
+            #pragma omp critical
+            vmax = core_sreduce_max(vmax, tmax);
+        }
+        break;
+    case CoreBlasInfNorm:
+        #pragma omp parallel if (par)
+        {
+            float tmax = 0.0;
+            #pragma omp for schedule(static) nowait
+            for (int i = 0; i < m; i++)
+                tmax = core_sreduce_max(
+                    tmax, core_sreduce_sum(n, &W[i], ldw));
+            #pragma omp critical
+            vmax = core_sreduce_max(vmax, tmax);
+        }
+        break;
+    }
+    *value = vmax;
+}
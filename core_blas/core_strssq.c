@@ -0,0 +1,61 @@
+/**
+ *
+ * @file
+ *
+ *  COREBLAS is a software package provided by:
+ *  University of Tennessee, US,
+ *  University of Manchester, UK.
+ *
+ * @generated from core_blas/core_ztrssq.c, normal z -> s, Fri Oct 16 03:37:02 2026
+ *
+ **/
+
+#include <coreblas.h>
+#include "coreblas_types.h"
+#include "coreblas_internal.h"
+#include "core_lapack.h"
+
+#include <math.h>
+
+/******************************************************************************/
+__attribute__((weak))
+void coreblas_strssq(coreblas_enum_t uplo, coreblas_enum_t diag,
+                 int m, int n,
+                 const float *A, int lda,
+                 float *scale, float *sumsq)
+{
+    *scale = 0.0;
+    *sumsq = 1.0;
+
+    // The whole trapezoid is accumulated in one pass, the unit diagonal
+    // going to the medium accumulator.
+    float acc[3] = {0.0, 0.0, 0.0};
+    if (uplo == CoreBlasUpper) {
+        if (diag == CoreBlasNonUnit) {
+            for (int j = 0; j < n; j++)
+                coreblas_sssq_update(imin(j+1, m), &A[lda*j], acc);
+        }
+        else { // CoreBlasUnit
+            int j;
+            for (j = 0; j < imin(n, m); j++) {
+                acc[1] += 1.0;
+                coreblas_sssq_update(j, &A[lda*j], acc);
+            }
+            for (; j < n; j++)
+                coreblas_sssq_update(m, &A[lda*j], acc);
+        }
+    }
+    else { // CoreBlasLower
+        if (diag == CoreBlasNonUnit) {
+            for (int j = 0; j < imin(n, m); j++)
+                coreblas_sssq_update(m-j, &A[lda*j+j], acc);
+        }
+        else { // CoreBlasUnit
+            for (int j = 0; j < imin(n, m); j++) {
+                acc[1] += 1.0;
+                coreblas_sssq_update(m-j-1, &A[lda*j+j+1], acc);
+            }
+        }
+    }
+    coreblas_sssq_finish(acc, scale, sumsq);
+}
\ No newline at end of file
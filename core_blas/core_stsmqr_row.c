@@ -0,0 +1,255 @@
+/**
+ *
+ * @file
+ *
+ *  COREBLAS is a software package provided by:
+ *  University of Tennessee, US,
+ *  University of Manchester, UK.
+ *
+ * @generated from core_blas/core_ztsmqr_row.c, normal z -> s, Fri Oct 16 03:36:56 2026
+ *
+ **/
+
+#include <coreblas.h>
+#include "coreblas_types.h"
+#include "coreblas_internal.h"
+#include "coreblas_workspace.h"
+
+#ifdef _OPENMP
+#include <omp.h>
+#endif
+
+/***************************************************************************//**
+ *
+ * @ingroup core_tsmqr
+ *
+ *  Applies, as coreblas_stsmqr, the same orthogonal matrix Q returned by
+ *  coreblas_stsqrt to ntile pairs of tiles A1_j and A2_j of the same
+ *  dimensions given by arrays of pointers, e.g., to the tiles of a
+ *  trailing tile row (side = CoreBlasLeft) or tile column
+ *  (side = CoreBlasRight) of a tile QR factorization.
+ *
+ *  Instead of applying Q to one pair after the other, every block of ib
+ *  reflectors of V, with its block of T, is applied to all the pairs of
+ *  a thread before moving to the next block, so that V and T are read
+ *  from memory once per thread instead of once per pair. The result is
+ *  the same as ntile calls to coreblas_stsmqr.
+ *
+ *  The pairs are split into contiguous ranges among the threads of an
+ *  OpenMP parallel region of work->nthread threads; thread i uses
+ *  work->spaces[i] as the work array of coreblas_stsmqr, with
+ *  ldwork = ib on the left and ldwork = m1 on the right. A sequential
+ *  BLAS should be used.
+ *
+ *******************************************************************************
+ *
+ * @param[in] side
+ *         - CoreBlasLeft  : apply Q or Q^T from the Left;
+ *         - CoreBlasRight : apply Q or Q^T from the Right.
+ *
+ * @param[in] trans
+ *         - CoreBlasNoTrans    : Apply Q;
+ *         - CoreBlasTrans : Apply Q^T.
+ *
+ * @param[in] m1
+ * @param[in] n1
+ * @param[in] m2
+ * @param[in] n2
+ * @param[in] k
+ * @param[in] ib
+ *         The dimensions, common to all the pairs, as in coreblas_stsmqr.
+ *         A last tile of a different size is updated by a separate call.
+ *
+ * @param[in,out] A1
+ *         Array of ntile pointers to the m1-by-n1 tiles A1_j.
+ *
+ * @param[in] lda1
+ *         The leading dimension of the tiles A1_j. lda1 >= max(1,m1).
+ *
+ * @param[in,out] A2
+ *         Array of ntile pointers to the m2-by-n2 tiles A2_j.
+ *
+ * @param[in] lda2
+ *         The leading dimension of the tiles A2_j. lda2 >= max(1,m2).
+ *
+ * @param[in] V
+ *         The reflectors, as returned by coreblas_stsqrt in A2.
+ *
+ * @param[in] ldv
+ *         The leading dimension of the array V.
+ *         ldv >= max(1,m2) if side == CoreBlasLeft,
+ *         ldv >= max(1,n2) if side == CoreBlasRight.
+ *
+ * @param[in] T
+ *         The ib-by-k triangular factor T of the block reflector.
+ *
+ * @param[in] ldt
+ *         The leading dimension of the array T. ldt >= ib.
+ *
+ * @param work
+ *         Per-thread workspace of type CoreBlasRealFloat, with spaces
+ *         of at least coreblas_stsmqr_lwork(side, m1, n1, ib) elements.
+ *
+ * @param[in] ntile
+ *         The number of pairs. ntile >= 0.
+ *
+ *******************************************************************************
+ *
+ * @retval CoreBlasSuccess successful exit
+ * @retval < 0 if -i, the i-th argument had an illegal value
+ *
+ ******************************************************************************/
+__attribute__((weak))
+int coreblas_stsmqr_row(coreblas_enum_t side, coreblas_enum_t trans,
+                int m1, int n1, int m2, int n2, int k, int ib,
+                float * const *A1, int lda1,
+                float * const *A2, int lda2,
+                const float *V, int ldv,
+                const float *T, int ldt,
+                coreblas_workspace_t *work, int ntile)
+{
+#ifndef COREBLAS_UNCHECKED
+    // Check input arguments.
+    if (side != CoreBlasLeft && side != CoreBlasRight) {
+        coreblas_error("illegal value of side");
+        return -1;
+    }
+    if (trans != CoreBlasNoTrans && trans != CoreBlasTrans) {
+        coreblas_error("illegal value of trans");
+        return -2;
+    }
+    if (m1 < 0) {
+        coreblas_error("illegal value of m1");
+        return -3;
+    }
+    if (n1 < 0) {
+        coreblas_error("illegal value of n1");
+        return -4;
+    }
+    if (m2 < 0 || (m2 != m1 && side == CoreBlasRight)) {
+        coreblas_error("illegal value of m2");
+        return -5;
+    }
+    if (n2 < 0 || (n2 != n1 && side == CoreBlasLeft)) {
+        coreblas_error("illegal value of n2");
+        return -6;
+    }
+    if (k < 0 ||
+        (side == CoreBlasLeft  && k > m1) ||
+        (side == CoreBlasRight && k > n1)) {
+        coreblas_error("illegal value of k");
+        return -7;
+    }
+    if (ib < 0) {
+        coreblas_error("illegal value of ib");
+        return -8;
+    }
+    if (ntile > 0 && A1 == NULL) {
+        coreblas_error("NULL A1");
+        return -9;
+    }
+    if (lda1 < imax(1, m1)) {
+        coreblas_error("illegal value of lda1");
+        return -10;
+    }
+    if (ntile > 0 && A2 == NULL) {
+        coreblas_error("NULL A2");
+        return -11;
+    }
+    if (lda2 < imax(1, m2)) {
+        coreblas_error("illegal value of lda2");
+        return -12;
+    }
+    if (ntile > 0 && V == NULL) {
+        coreblas_error("NULL V");
+        return -13;
+    }
+    if (ldv < imax(1, side == CoreBlasLeft ? m2 : n2)) {
+        coreblas_error("illegal value of ldv");
+        return -14;
+    }
+    if (ntile > 0 && T == NULL) {
+        coreblas_error("NULL T");
+        return -15;
+    }
+    if (ldt < imax(1, ib)) {
+        coreblas_error("illegal value of ldt");
+        return -16;
+    }
+    if (work == NULL || work->spaces == NULL ||
+        work->dtyp != CoreBlasRealFloat ||
+        work->lworkspace < coreblas_stsmqr_lwork(side, m1, n1, ib)) {
+        coreblas_error("illegal value of work");
+        return -17;
+    }
+    if (ntile < 0) {
+        coreblas_error("illegal value of ntile");
+        return -18;
+    }
+#endif
+
+    // quick return
+    if (ntile == 0 ||
+        m1 == 0 || n1 == 0 || m2 == 0 || n2 == 0 || k == 0 || ib == 0)
+        return CoreBlasSuccess;
+
+    // Same order of the blocks of reflectors as coreblas_stsmqr.
+    int i1, i3;
+    if ((side == CoreBlasLeft  && trans != CoreBlasNoTrans) ||
+        (side == CoreBlasRight && trans == CoreBlasNoTrans)) {
+        i1 = 0;
+        i3 = ib;
+    }
+    else {
+        i1 = ((k-1)/ib)*ib;
+        i3 = -ib;
+    }
+
+    int ldwork = side == CoreBlasLeft ? ib : m1;
+    #pragma omp parallel num_threads(work->nthread)
+    {
+        int tid = 0;
+        int nth = 1;
+#ifdef _OPENMP
+        tid = omp_get_thread_num();
+        nth = omp_get_num_threads();
+#endif
+        float *w = (float*)work->spaces[tid];
+
+        // Contiguous range of pairs of this thread.
+        int jfirst = (int)((long long)ntile*tid/nth);
+        int jlast  = (int)((long long)ntile*(tid+1)/nth);
+
+        for (int i = i1; i > -1 && i < k; i += i3) {
+            int kb = imin(ib, k-i);
+            int ic = 0;
+            int jc = 0;
+            int mi = m1;
+            int ni = n1;
+
+            if (side == CoreBlasLeft) {
+                // H or H^T is applied to C(i:m,1:n).
+                mi = m1 - i;
+                ic = i;
+            }
+            else {
+                // H or H^T is applied to C(1:m,i:n).
+                ni = n1 - i;
+                jc = i;
+            }
+
+            // The block of V and T stays in cache across the pairs.
+            for (int j = jfirst; j < jlast; j++) {
+                coreblas_sparfb_nocheck(side, trans,
+                                        CoreBlasForward, CoreBlasColumnwise,
+                                        mi, ni, m2, n2, kb, 0,
+                                        &A1[j][(size_t)lda1*jc+ic], lda1,
+                                        A2[j], lda2,
+                                        &V[(size_t)ldv*i], ldv,
+                                        &T[(size_t)ldt*i], ldt,
+                                        w, ldwork);
+            }
+        }
+    }
+    return CoreBlasSuccess;
+}
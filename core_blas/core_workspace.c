@@ -0,0 +1,228 @@
+/**
+ *
+ * @file
+ *
+ *  COREBLAS is a software package provided by:
+ *  University of Tennessee, US,
+ *  University of Manchester, UK.
+ *
+ **/
+
+#define _POSIX_C_SOURCE 200112L
+
+#include <coreblas.h>
+#include "coreblas_types.h"
+#include "coreblas_internal.h"
+#include "coreblas_workspace.h"
+
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+
+#ifdef _OPENMP
+#include <omp.h>
+#endif
+
+// Spaces are padded to whole cache lines, so that no two threads
+// share a line even if the page size is unknown.
+#define COREBLAS_CACHE_LINE 64
+
+/***************************************************************************//**
+ *
+ * @ingroup core_workspace
+ *
+ *  Allocates one workspace of lworkspace elements for each thread of the
+ *  OpenMP team. Each space is aligned to a page, its size is rounded up
+ *  to whole pages, and it is allocated and zeroed by the thread that owns
+ *  it, so that under a first-touch policy its pages are placed on that
+ *  thread's NUMA node. Thread i must use spaces[i], where i is its
+ *  omp_get_thread_num() in a team of the same size. If the team that
+ *  allocates is smaller, the remaining spaces are allocated by the calling
+ *  thread.
+ *  Without OpenMP, a single space is created.
+ *
+ *******************************************************************************
+ *
+ * @param[out] workspace
+ *         The workspace to initialize.
+ *
+ * @param[in] lworkspace
+ *         The number of elements of each thread's space,
+ *         see coreblas_workspace_lwork().
+ *
+ * @param[in] dtyp
+ *         The element type: CoreBlasByte, CoreBlasInteger,
+ *         CoreBlasRealFloat, CoreBlasRealDouble, CoreBlasComplexFloat
+ *         or CoreBlasComplexDouble.
+ *
+ *******************************************************************************
+ *
+ * @retval CoreBlasSuccess successful exit
+ * @retval CoreBlasErrorIllegalValue if dtyp is not a valid type
+ * @retval CoreBlasErrorOutOfMemory if an allocation failed
+ *
+ ******************************************************************************/
+int coreblas_workspace_create(coreblas_workspace_t *workspace,
+                              size_t lworkspace,
+                              coreblas_enum_t dtyp)
+{
+    if (workspace == NULL) {
+        coreblas_error("NULL workspace");
+        return CoreBlasErrorNullParameter;
+    }
+    size_t elsize = coreblas_element_size(dtyp);
+    if (elsize == 0) {
+        coreblas_error("illegal value of dtyp");
+        return CoreBlasErrorIllegalValue;
+    }
+
+    workspace->spaces = NULL;
+    workspace->lworkspace = lworkspace;
+    workspace->dtyp = dtyp;
+    workspace->nthread = 1;
+#ifdef _OPENMP
+    workspace->nthread = omp_get_max_threads();
+#endif
+
+    workspace->spaces = (void**)calloc(workspace->nthread, sizeof(void*));
+    if (workspace->spaces == NULL) {
+        coreblas_error("malloc() failed");
+        return CoreBlasErrorOutOfMemory;
+    }
+
+    long page = sysconf(_SC_PAGESIZE);
+    size_t align = page > COREBLAS_CACHE_LINE ?
+                   (size_t)page : COREBLAS_CACHE_LINE;
+    size_t size = lworkspace*elsize;
+    size = (size+align-1)/align*align;
+    if (size == 0)
+        size = align;
+
+    // Each thread allocates and touches its own space.
+    int info = CoreBlasSuccess;
+    #pragma omp parallel num_threads(workspace->nthread)
+    {
+        int tid = 0;
+#ifdef _OPENMP
+        tid = omp_get_thread_num();
+#endif
+        void *space = NULL;
+        if (posix_memalign(&space, align, size) != 0) {
+            #pragma omp atomic write
+            info = CoreBlasErrorOutOfMemory;
+        }
+        else {
+            memset(space, 0, size);
+            workspace->spaces[tid] = space;
+        }
+    }
+    // The team may be smaller than requested, in a nested region or with
+    // dynamic adjustment; the calling thread allocates the missing spaces.
+    for (int tid = 0; tid < workspace->nthread && info == CoreBlasSuccess;
+         tid++) {
+        if (workspace->spaces[tid] != NULL)
+            continue;
+        void *space = NULL;
+        if (posix_memalign(&space, align, size) != 0) {
+            info = CoreBlasErrorOutOfMemory;
+        }
+        else {
+            memset(space, 0, size);
+            workspace->spaces[tid] = space;
+        }
+    }
+    if (info != CoreBlasSuccess) {
+        coreblas_error("malloc() failed");
+        coreblas_workspace_destroy(workspace);
+    }
+    return info;
+}
+
+/***************************************************************************//**
+ *
+ * @ingroup core_workspace
+ *
+ *  Releases the spaces allocated by coreblas_workspace_create().
+ *
+ *******************************************************************************
+ *
+ * @param[in,out] workspace
+ *         The workspace to release.
+ *
+ *******************************************************************************
+ *
+ * @retval CoreBlasSuccess successful exit
+ *
+ ******************************************************************************/
+int coreblas_workspace_destroy(coreblas_workspace_t *workspace)
+{
+    if (workspace == NULL) {
+        coreblas_error("NULL workspace");
+        return CoreBlasErrorNullParameter;
+    }
+    if (workspace->spaces != NULL) {
+        for (int i = 0; i < workspace->nthread; i++)
+            free(workspace->spaces[i]);
+        free(workspace->spaces);
+        workspace->spaces = NULL;
+    }
+    workspace->nthread = 0;
+    workspace->lworkspace = 0;
+    return CoreBlasSuccess;
+}
+
+/***************************************************************************//**
+ *
+ * @ingroup core_workspace
+ *
+ *  Returns the number of elements of workspace needed by one call of
+ *  a kernel on nb-by-nb tiles with inner-blocking size ib, so that
+ *  a single coreblas_workspace_t can be sized at startup, e.g., with
+ *  the maximum over the kernels in use.
+ *
+ *  - CoreBlasWorkGeqrt: ib*nb for work followed by nb for tau;
+ *  - CoreBlasWorkTsmqr: (nb + ib)*ib, for ldwork = ib on the left
+ *    and ldwork = nb on the right, followed by the ib-by-ib triangle
+ *    of V copied by unmlq;
+ *  - CoreBlasWorkParfb: ib*nb;
+ *  - CoreBlasWorkPemv: nb;
+ *  - CoreBlasWorkGbtypecb: nb;
+ *  - CoreBlasWorkHerfb: (3*nb + ib)*nb, for the three tiles of
+ *    tsmqr_corner followed by the work of tsmqr; herfb needs less.
+ *
+ *******************************************************************************
+ *
+ * @param[in] kernel
+ *         One of the CoreBlasWork constants.
+ *
+ * @param[in] nb
+ *         The tile size. nb >= 0.
+ *
+ * @param[in] ib
+ *         The inner-blocking size. ib >= 0.
+ *
+ *******************************************************************************
+ *
+ * @retval the number of elements, or 0 for an illegal argument.
+ *
+ ******************************************************************************/
+size_t coreblas_workspace_lwork(coreblas_enum_t kernel, int nb, int ib)
+{
+    if (nb < 0 || ib < 0)
+        return 0;
+
+    size_t snb = (size_t)nb;
+    size_t sib = (size_t)imin(ib, nb);
+
+    switch (kernel) {
+    case CoreBlasWorkGeqrt:    return sib*snb + snb;
+    case CoreBlasWorkTsmqr:    return (snb + sib)*sib;
+    case CoreBlasWorkParfb:    return sib*snb;
+    case CoreBlasWorkPemv:     return snb;
+    case CoreBlasWorkGbtypecb: return snb;
+    case CoreBlasWorkHerfb:    return (3*snb + sib)*snb;
+    default:
+        coreblas_error("illegal value of kernel");
+        return 0;
+    }
+}
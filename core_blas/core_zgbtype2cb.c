@@ -183,7 +183,7 @@ void coreblas_zgbtype2cb (coreblas_enum_t uplo, int n, int nb,
             // Eliminate the row  at st 
             ctmp = conj(*AU(st, J1));
             #ifdef COREBLAS_USE_64BIT_BLAS
-                LAPACKE_zlarfg64_(len, &ctmp, VP(vpos+1), 1, TAUP(taupos) );
+                LAPACKE_zlarfg_work64_(len, &ctmp, VP(vpos+1), 1, TAUP(taupos) );
             #else
                 LAPACKE_zlarfg_work(len, &ctmp, VP(vpos+1), 1, TAUP(taupos) );
             #endif
@@ -241,7 +241,7 @@ void coreblas_zgbtype2cb (coreblas_enum_t uplo, int n, int nb,
             memset(AL(J1+1, st), 0, (len-1)*sizeof(coreblas_complex64_t));
             #ifdef COREBLAS_USE_64BIT_BLAS
                 // Eliminate the col  at st 
-                LAPACKE_zlarfg64_(len, AL(J1, st), VQ(vpos+1), 1, TAUQ(taupos) );
+                LAPACKE_zlarfg_work64_(len, AL(J1, st), VQ(vpos+1), 1, TAUQ(taupos) );
             #else
                 // Eliminate the col  at st 
                 LAPACKE_zlarfg_work(len, AL(J1, st), VQ(vpos+1), 1, TAUQ(taupos) );
@@ -274,3 +274,25 @@ void coreblas_zgbtype2cb (coreblas_enum_t uplo, int n, int nb,
 #undef VP
 #undef TAUQ
 #undef TAUP
+
+/***************************************************************************//**
+ *
+ * @ingroup core_zgbtype2cb
+ *
+ *  Returns the minimum length of the array work of coreblas_zgbtype2cb
+ *  for the given dimensions.
+ *
+ *******************************************************************************
+ *
+ * @param[in] nb
+ *         The band width.
+ *
+ *******************************************************************************
+ *
+ * @retval the length of work, at least 1.
+ *
+ ******************************************************************************/
+size_t coreblas_zgbtype2cb_lwork(int nb)
+{
+    return imax(1, nb);
+}
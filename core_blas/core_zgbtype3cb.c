@@ -160,7 +160,7 @@ void coreblas_zgbtype3cb(coreblas_enum_t uplo, int n, int nb,
         memcpy( VQ(vpos+1), AU(st+1, st), (len-1)*sizeof(coreblas_complex64_t) );
         memset( AU(st+1, st), 0, (len-1)*sizeof(coreblas_complex64_t) );
         #ifdef COREBLAS_USE_64BIT_BLAS
-            LAPACKE_zlarfg64_(len, AU(st, st), VQ(vpos+1), 1, TAUQ(taupos) );
+            LAPACKE_zlarfg_work64_(len, AU(st, st), VQ(vpos+1), 1, TAUQ(taupos) );
         #else
             LAPACKE_zlarfg_work(len, AU(st, st), VQ(vpos+1), 1, TAUQ(taupos) );
         #endif
@@ -196,7 +196,7 @@ void coreblas_zgbtype3cb(coreblas_enum_t uplo, int n, int nb,
         }
         ctmp = conj(*AL(st, st));
         #ifdef COREBLAS_USE_64BIT_BLAS
-            LAPACKE_zlarfg64_(len, &ctmp, VP(vpos+1), 1, TAUP(taupos) );
+            LAPACKE_zlarfg_work64_(len, &ctmp, VP(vpos+1), 1, TAUP(taupos) );
         #else
             LAPACKE_zlarfg_work(len, &ctmp, VP(vpos+1), 1, TAUP(taupos) );
         #endif
@@ -221,4 +221,26 @@ void coreblas_zgbtype3cb(coreblas_enum_t uplo, int n, int nb,
 #undef VQ
 #undef VP
 #undef TAUQ
-#undef TAUP
\ No newline at end of file
+#undef TAUP
+
+/***************************************************************************//**
+ *
+ * @ingroup core_zgbtype3cb
+ *
+ *  Returns the minimum length of the array work of coreblas_zgbtype3cb
+ *  for the given dimensions.
+ *
+ *******************************************************************************
+ *
+ * @param[in] nb
+ *         The band width.
+ *
+ *******************************************************************************
+ *
+ * @retval the length of work, at least 1.
+ *
+ ******************************************************************************/
+size_t coreblas_zgbtype3cb_lwork(int nb)
+{
+    return imax(1, nb);
+}
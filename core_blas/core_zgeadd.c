@@ -77,6 +77,7 @@ int coreblas_zgeadd(coreblas_enum_t transa,
                 coreblas_complex64_t alpha, const coreblas_complex64_t *A, int lda,
                 coreblas_complex64_t beta,        coreblas_complex64_t *B, int ldb)
 {
+#ifndef COREBLAS_UNCHECKED
     // Check input arguments.
     if ((transa != CoreBlasNoTrans) &&
         (transa != CoreBlasTrans)   &&
@@ -109,6 +110,7 @@ int coreblas_zgeadd(coreblas_enum_t transa,
         coreblas_error("illegal value of ldb");
         return -9;
     }
+#endif
 
     // quick return
     if (m == 0 || n == 0 || (alpha == 0.0 && beta == 1.0))
@@ -92,6 +92,7 @@ int coreblas_zgelqt(int m, int n, int ib,
                 coreblas_complex64_t *tau,
                 coreblas_complex64_t *work)
 {
+#ifndef COREBLAS_UNCHECKED
     // Check input arguments.
     if (m < 0) {
         coreblas_error("illegal value of m");
@@ -129,6 +130,7 @@ int coreblas_zgelqt(int m, int n, int ib,
         coreblas_error("NULL work");
         return -9;
     }
+#endif
 
     // quick return
     if (m == 0 || n == 0 || ib == 0)
@@ -149,51 +151,66 @@ int coreblas_zgelqt(int m, int n, int ib,
                         &tau[i], work);
         #endif
 
-        #ifdef COREBLAS_USE_64BIT_BLAS
-            LAPACKE_zlarft64_(LAPACK_COL_MAJOR,
-                        lapack_const(CoreBlasForward),
-                        lapack_const(CoreBlasRowwise),
-                        n-i, sb,
+        coreblas_zlarft(CoreBlasRowwise, n-i, sb,
                         &A[lda*i+i], lda,
                         &tau[i],
                         &T[ldt*i], ldt);
-        #else
-            LAPACKE_zlarft_work(LAPACK_COL_MAJOR,
-                       lapack_const(CoreBlasForward),
-                       lapack_const(CoreBlasRowwise),
-                       n-i, sb,
-                       &A[lda*i+i], lda,
-                       &tau[i],
-                       &T[ldt*i], ldt);
-        #endif
-
 
         if (m > i+sb) {
-        #ifdef COREBLAS_USE_64BIT_BLAS
-            LAPACKE_zlarfb64_(LAPACK_COL_MAJOR,
-                    lapack_const(CoreBlasRight),
-                    lapack_const(CoreBlasNoTrans),
-                    lapack_const(CoreBlasForward),
-                    lapack_const(CoreBlasRowwise),
-                    m-i-sb, n-i, sb,
-                    &A[lda*i+i],      lda,
-                    &T[ldt*i],        ldt,
-                    &A[lda*i+(i+sb)], lda);
-        #else
-            LAPACKE_zlarfb_work(LAPACK_COL_MAJOR,
-                    lapack_const(CoreBlasRight),
-                    lapack_const(CoreBlasNoTrans),
-                    lapack_const(CoreBlasForward),
-                    lapack_const(CoreBlasRowwise),
-                    m-i-sb, n-i, sb,
-                    &A[lda*i+i],      lda,
-                    &T[ldt*i],        ldt,
-                    &A[lda*i+(i+sb)], lda,
-                    work, m-i-sb);
-        #endif
+            // larfb_gemm multiplies by the whole sb-by-(n-i) block of V,
+            // so its diagonal is set to one and the L factor below it
+            // to zero, and both are restored after the update.
+            coreblas_complex64_t *V = &A[lda*i+i];
+            coreblas_complex64_t *L = &work[(size_t)(m-i-sb)*sb];
+            for (int j = 0; j < sb; j++) {
+                for (int l = j; l < sb; l++) {
+                    L[sb*j+l] = V[lda*j+l];
+                    V[lda*j+l] = 0.0;
+                }
+                V[lda*j+j] = 1.0;
+            }
 
+            coreblas_zlarfb_gemm(CoreBlasRight, CoreBlasNoTrans,
+                                 CoreBlasForward, CoreBlasRowwise,
+                                 m-i-sb, n-i, sb,
+                                 V,                lda,
+                                 &T[ldt*i],        ldt,
+                                 &A[lda*i+(i+sb)], lda,
+                                 work, m-i-sb);
+
+            for (int j = 0; j < sb; j++)
+                for (int l = j; l < sb; l++)
+                    V[lda*j+l] = L[sb*j+l];
         }
     }
 
     return CoreBlasSuccess;
-}
\ No newline at end of file
+}
+
+/***************************************************************************//**
+ *
+ * @ingroup core_gelqt
+ *
+ *  Returns the minimum length of the array work of coreblas_zgelqt
+ *  for the given dimensions.
+ *
+ *******************************************************************************
+ *
+ * @param[in] m
+ *         The number of rows of the tile A.
+ *
+ * @param[in] n
+ *         The number of columns of the tile A.
+ *
+ * @param[in] ib
+ *         The inner-blocking size.
+ *
+ *******************************************************************************
+ *
+ * @retval the length of work, at least 1.
+ *
+ ******************************************************************************/
+size_t coreblas_zgelqt_lwork(int m, int n, int ib)
+{
+    return imax(1, imin(ib, imin(m, n)))*(size_t)imax(1, m);
+}
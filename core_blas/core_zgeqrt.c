@@ -15,7 +15,241 @@
 #include "coreblas_internal.h"
 #include "core_lapack.h"
 
+// Panels of at most this many columns are factored one column at a time.
+#define COREBLAS_GEQRT_LEAF 8
 
+/******************************************************************************/
+// Applies H^H = (I - V T V^H)^H from the left to the m-by-n tile C,
+// where V is m-by-k unit lower trapezoidal and T is k-by-k upper triangular.
+// The k-by-n workspace W = V^H C is kept in work.
+static void core_zgeqrt_larfb(int m, int n, int k,
+                              const coreblas_complex64_t *V, int ldv,
+                              const coreblas_complex64_t *T, int ldt,
+                                    coreblas_complex64_t *C, int ldc,
+                                    coreblas_complex64_t *W)
+{
+    static coreblas_complex64_t zone  =  1.0;
+    static coreblas_complex64_t mzone = -1.0;
+
+    // W = V1^H C1
+    for (int j = 0; j < n; j++)
+        for (int i = 0; i < k; i++)
+            W[k*j+i] = C[ldc*j+i];
+
+#ifdef COREBLAS_USE_64BIT_BLAS
+    cblas_ztrmm64_(CblasColMajor,
+                   CblasLeft, CblasLower,
+                   (CBLAS_TRANSPOSE)CoreBlas_ConjTrans, CblasUnit,
+                   k, n,
+                   CBLAS_SADDR(zone), V, ldv,
+                                      W, k);
+#else
+    cblas_ztrmm(CblasColMajor,
+                CblasLeft, CblasLower,
+                (CBLAS_TRANSPOSE)CoreBlas_ConjTrans, CblasUnit,
+                k, n,
+                CBLAS_SADDR(zone), V, ldv,
+                                   W, k);
+#endif
+
+    // W += V2^H C2
+    if (m > k) {
+#ifdef COREBLAS_USE_64BIT_BLAS
+        cblas_zgemm64_(CblasColMajor,
+                       (CBLAS_TRANSPOSE)CoreBlas_ConjTrans, CblasNoTrans,
+                       k, n, m-k,
+                       CBLAS_SADDR(zone), &V[k], ldv,
+                                          &C[k], ldc,
+                       CBLAS_SADDR(zone), W,     k);
+#else
+        cblas_zgemm(CblasColMajor,
+                    (CBLAS_TRANSPOSE)CoreBlas_ConjTrans, CblasNoTrans,
+                    k, n, m-k,
+                    CBLAS_SADDR(zone), &V[k], ldv,
+                                       &C[k], ldc,
+                    CBLAS_SADDR(zone), W,     k);
+#endif
+    }
+
+    // W = T^H W
+#ifdef COREBLAS_USE_64BIT_BLAS
+    cblas_ztrmm64_(CblasColMajor,
+                   CblasLeft, CblasUpper,
+                   (CBLAS_TRANSPOSE)CoreBlas_ConjTrans, CblasNonUnit,
+                   k, n,
+                   CBLAS_SADDR(zone), T, ldt,
+                                      W, k);
+#else
+    cblas_ztrmm(CblasColMajor,
+                CblasLeft, CblasUpper,
+                (CBLAS_TRANSPOSE)CoreBlas_ConjTrans, CblasNonUnit,
+                k, n,
+                CBLAS_SADDR(zone), T, ldt,
+                                   W, k);
+#endif
+
+    // C2 -= V2 W
+    if (m > k) {
+#ifdef COREBLAS_USE_64BIT_BLAS
+        cblas_zgemm64_(CblasColMajor,
+                       CblasNoTrans, CblasNoTrans,
+                       m-k, n, k,
+                       CBLAS_SADDR(mzone), &V[k], ldv,
+                                           W,     k,
+                       CBLAS_SADDR(zone),  &C[k], ldc);
+#else
+        cblas_zgemm(CblasColMajor,
+                    CblasNoTrans, CblasNoTrans,
+                    m-k, n, k,
+                    CBLAS_SADDR(mzone), &V[k], ldv,
+                                        W,     k,
+                    CBLAS_SADDR(zone),  &C[k], ldc);
+#endif
+    }
+
+    // C1 -= V1 W
+#ifdef COREBLAS_USE_64BIT_BLAS
+    cblas_ztrmm64_(CblasColMajor,
+                   CblasLeft, CblasLower,
+                   CblasNoTrans, CblasUnit,
+                   k, n,
+                   CBLAS_SADDR(zone), V, ldv,
+                                      W, k);
+#else
+    cblas_ztrmm(CblasColMajor,
+                CblasLeft, CblasLower,
+                CblasNoTrans, CblasUnit,
+                k, n,
+                CBLAS_SADDR(zone), V, ldv,
+                                   W, k);
+#endif
+
+    for (int j = 0; j < n; j++)
+        for (int i = 0; i < k; i++)
+            C[ldc*j+i] -= W[k*j+i];
+}
+
+/******************************************************************************/
+// Factors the m-by-n panel A, m >= n, one column at a time and accumulates
+// the n-by-n triangular factor T column by column.
+static void core_zgeqrt_leaf(int m, int n,
+                             coreblas_complex64_t *A, int lda,
+                             coreblas_complex64_t *T, int ldt,
+                             coreblas_complex64_t *tau,
+                             coreblas_complex64_t *work)
+{
+    static coreblas_complex64_t zone  = 1.0;
+    static coreblas_complex64_t zzero = 0.0;
+
+    for (int j = 0; j < n; j++) {
+        // Generate elementary reflector H(j) to annihilate A(j+1:m, j).
+#ifdef COREBLAS_USE_64BIT_BLAS
+        LAPACKE_zlarfg_work64_(m-j, &A[lda*j+j], &A[lda*j+imin(j+1, m-1)], 1,
+                               &tau[j]);
+#else
+        LAPACKE_zlarfg_work(m-j, &A[lda*j+j], &A[lda*j+imin(j+1, m-1)], 1,
+                            &tau[j]);
+#endif
+        coreblas_complex64_t ajj = A[lda*j+j];
+        A[lda*j+j] = 1.0;
+
+        if (j+1 < n) {
+            // Apply H(j)^H to A(j:m, j+1:n) from the left.
+            coreblas_complex64_t alpha = -conj(tau[j]);
+#ifdef COREBLAS_USE_64BIT_BLAS
+            cblas_zgemv64_(CblasColMajor, (CBLAS_TRANSPOSE)CoreBlas_ConjTrans,
+                           m-j, n-j-1,
+                           CBLAS_SADDR(zone),  &A[lda*(j+1)+j], lda,
+                                               &A[lda*j+j], 1,
+                           CBLAS_SADDR(zzero), work, 1);
+
+            cblas_zgerc64_(CblasColMajor,
+                           m-j, n-j-1,
+                           CBLAS_SADDR(alpha), &A[lda*j+j], 1,
+                                               work, 1,
+                                               &A[lda*(j+1)+j], lda);
+#else
+            cblas_zgemv(CblasColMajor, (CBLAS_TRANSPOSE)CoreBlas_ConjTrans,
+                        m-j, n-j-1,
+                        CBLAS_SADDR(zone),  &A[lda*(j+1)+j], lda,
+                                            &A[lda*j+j], 1,
+                        CBLAS_SADDR(zzero), work, 1);
+
+            cblas_zgerc(CblasColMajor,
+                        m-j, n-j-1,
+                        CBLAS_SADDR(alpha), &A[lda*j+j], 1,
+                                            work, 1,
+                                            &A[lda*(j+1)+j], lda);
+#endif
+        }
+
+        // T(0:j, j) = -tau(j) T(0:j, 0:j) V(j:m, 0:j)^H v(j)
+        if (j > 0) {
+            coreblas_complex64_t alpha = -tau[j];
+#ifdef COREBLAS_USE_64BIT_BLAS
+            cblas_zgemv64_(CblasColMajor, (CBLAS_TRANSPOSE)CoreBlas_ConjTrans,
+                           m-j, j,
+                           CBLAS_SADDR(alpha), &A[j], lda,
+                                               &A[lda*j+j], 1,
+                           CBLAS_SADDR(zzero), &T[ldt*j], 1);
+
+            cblas_ztrmv64_(CblasColMajor, CblasUpper,
+                           CblasNoTrans, CblasNonUnit,
+                           j,
+                           T, ldt,
+                           &T[ldt*j], 1);
+#else
+            cblas_zgemv(CblasColMajor, (CBLAS_TRANSPOSE)CoreBlas_ConjTrans,
+                        m-j, j,
+                        CBLAS_SADDR(alpha), &A[j], lda,
+                                            &A[lda*j+j], 1,
+                        CBLAS_SADDR(zzero), &T[ldt*j], 1);
+
+            cblas_ztrmv(CblasColMajor, CblasUpper,
+                        CblasNoTrans, CblasNonUnit,
+                        j,
+                        T, ldt,
+                        &T[ldt*j], 1);
+#endif
+        }
+        T[ldt*j+j] = tau[j];
+        A[lda*j+j] = ajj;
+    }
+}
+
+/******************************************************************************/
+// Recursive QR factorization of the m-by-n panel A, m >= n.
+// The panel is split in two halves of columns; the left half is factored
+// and applied to the right half, the right half is factored, and the
+// off-diagonal block of T is merged with level 3 operations by
+// coreblas_zlarft_merge:
+//     T12 = -T11 (V1^H V2) T22.
+// T stays in the panel's n-by-n block, work holds at most n*n/4 elements.
+static void core_zgeqrt_rec(int m, int n,
+                            coreblas_complex64_t *A, int lda,
+                            coreblas_complex64_t *T, int ldt,
+                            coreblas_complex64_t *tau,
+                            coreblas_complex64_t *work)
+{
+    if (n <= COREBLAS_GEQRT_LEAF) {
+        core_zgeqrt_leaf(m, n, A, lda, T, ldt, tau, work);
+        return;
+    }
+
+    int n1 = n/2;
+    int n2 = n-n1;
+
+    coreblas_complex64_t *A12 = &A[lda*n1];
+    coreblas_complex64_t *A22 = &A[lda*n1+n1];
+    coreblas_complex64_t *T22 = &T[ldt*n1+n1];
+
+    core_zgeqrt_rec(m, n1, A, lda, T, ldt, tau, work);
+    core_zgeqrt_larfb(m, n2, n1, A, lda, T, ldt, A12, lda, work);
+    core_zgeqrt_rec(m-n1, n2, A22, lda, T22, ldt, &tau[n1], work);
+
+    // T12 = -T11 (V1^H V2) T22
+    coreblas_zlarft_merge(CoreBlasColumnwise, m, n1, n2, A, lda, T, ldt);
+}
 
 /***************************************************************************//**
  *
@@ -76,9 +310,6 @@
  * @param work
  *         Auxiliary workspace array of length ib*n.
  *
- * @param[in] lwork
- *         Size of the array work. Should be at least ib*n.
- *
  *******************************************************************************
  *
  * @retval CoreBlasSuccess successful exit
@@ -92,6 +323,7 @@ int coreblas_zgeqrt(int m, int n, int ib,
                 coreblas_complex64_t *tau,
                 coreblas_complex64_t *work)
 {
+#ifndef COREBLAS_UNCHECKED
     // Check input arguments.
     if (m < 0) {
         coreblas_error("illegal value of m");
@@ -129,7 +361,26 @@ int coreblas_zgeqrt(int m, int n, int ib,
         coreblas_error("NULL work");
         return -9;
     }
+#endif
 
+    return coreblas_zgeqrt_nocheck(m, n, ib, A, lda, T, ldt, tau, work);
+}
+
+/***************************************************************************//**
+ *
+ * @ingroup core_geqrt
+ *
+ *  Same as coreblas_zgeqrt, without checking the arguments. Called by
+ *  coreblas_zgeqrt_batched and coreblas_zgeqrt_batched_strided once they
+ *  have checked their own.
+ *
+ ******************************************************************************/
+int coreblas_zgeqrt_nocheck(int m, int n, int ib,
+                coreblas_complex64_t *A, int lda,
+                coreblas_complex64_t *T, int ldt,
+                coreblas_complex64_t *tau,
+                coreblas_complex64_t *work)
+{
     // quick return
     if (m == 0 || n == 0 || ib == 0)
         return CoreBlasSuccess;
@@ -137,63 +388,48 @@ int coreblas_zgeqrt(int m, int n, int ib,
     int k = imin(m, n);
     for (int i = 0; i < k; i += ib) {
         int sb = imin(ib, k-i);
-        #ifdef COREBLAS_USE_64BIT_BLAS
-            LAPACKE_zgeqr264_(LAPACK_COL_MAJOR,
-                        m-i, sb,
-                        &A[lda*i+i], lda,
-                        &tau[i]);
-        #else
-            LAPACKE_zgeqr2_work(LAPACK_COL_MAJOR,
-                        m-i, sb,
-                        &A[lda*i+i], lda,
-                        &tau[i], work);
-        #endif 
-
-        #ifdef COREBLAS_USE_64BIT_BLAS
-            LAPACKE_zlarft64_(LAPACK_COL_MAJOR,
-                       lapack_const(CoreBlasForward),
-                       lapack_const(CoreBlasColumnwise),
-                       m-i, sb,
-                       &A[lda*i+i], lda,
-                       &tau[i],
-                       &T[ldt*i], ldt);
-        #else
-            LAPACKE_zlarft_work(LAPACK_COL_MAJOR,
-                        lapack_const(CoreBlasForward),
-                        lapack_const(CoreBlasColumnwise),
-                        m-i, sb,
-                        &A[lda*i+i], lda,
-                        &tau[i],
-                        &T[ldt*i], ldt);
-        #endif 
 
+        // Factor the panel A(i:m, i:i+sb) and build its T on the fly.
+        core_zgeqrt_rec(m-i, sb, &A[lda*i+i], lda, &T[ldt*i], ldt,
+                        &tau[i], work);
 
+        // Apply the block reflector to the trailing columns.
         if (n > i+sb) {
-        #ifdef COREBLAS_USE_64BIT_BLAS
-            LAPACKE_zlarfb64_(LAPACK_COL_MAJOR,
-                                lapack_const(CoreBlasLeft),
-                                lapack_const(CoreBlas_ConjTrans),
-                                lapack_const(CoreBlasForward),
-                                lapack_const(CoreBlasColumnwise),
-                                m-i, n-i-sb, sb,
-                                &A[lda*i+i],      lda,
-                                &T[ldt*i],        ldt,
-                                &A[lda*(i+sb)+i], lda);
-        #else
-            LAPACKE_zlarfb_work(LAPACK_COL_MAJOR,
-                                lapack_const(CoreBlasLeft),
-                                lapack_const(CoreBlas_ConjTrans),
-                                lapack_const(CoreBlasForward),
-                                lapack_const(CoreBlasColumnwise),
-                                m-i, n-i-sb, sb,
-                                &A[lda*i+i],      lda,
-                                &T[ldt*i],        ldt,
-                                &A[lda*(i+sb)+i], lda,
-                                work, n-i-sb);
-        #endif 
-
+            core_zgeqrt_larfb(m-i, n-i-sb, sb,
+                              &A[lda*i+i], lda,
+                              &T[ldt*i], ldt,
+                              &A[lda*(i+sb)+i], lda,
+                              work);
         }
     }
 
     return CoreBlasSuccess;
-}
\ No newline at end of file
+}
+
+/***************************************************************************//**
+ *
+ * @ingroup core_geqrt
+ *
+ *  Returns the minimum length of the array work of coreblas_zgeqrt
+ *  for the given dimensions.
+ *
+ *******************************************************************************
+ *
+ * @param[in] m
+ *         The number of rows of the tile A.
+ *
+ * @param[in] n
+ *         The number of columns of the tile A.
+ *
+ * @param[in] ib
+ *         The inner-blocking size.
+ *
+ *******************************************************************************
+ *
+ * @retval the length of work, at least 1.
+ *
+ ******************************************************************************/
+size_t coreblas_zgeqrt_lwork(int m, int n, int ib)
+{
+    return imax(1, imin(ib, imin(m, n)))*(size_t)imax(0, n);
+}
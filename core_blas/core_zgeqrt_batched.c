@@ -0,0 +1,285 @@
+/**
+ *
+ * @file
+ *
+ *  COREBLAS is a software package provided by:
+ *  University of Tennessee, US,
+ *  University of Manchester, UK.
+ *
+ * @precisions normal z -> c d s
+ *
+ **/
+
+#include <coreblas.h>
+#include "coreblas_types.h"
+#include "coreblas_internal.h"
+#include "coreblas_workspace.h"
+
+#ifdef _OPENMP
+#include <omp.h>
+#endif
+
+/***************************************************************************//**
+ *
+ * @ingroup core_geqrt
+ *
+ *  Computes the QR factorizations A_i = Q_i R_i, as coreblas_zgeqrt, of a
+ *  batch of independent m-by-n tiles given by arrays of pointers.
+ *
+ *  The arguments are checked once for the whole batch and the tiles are
+ *  distributed statically among the threads of an OpenMP parallel region
+ *  of work->nthread threads; thread i takes tau and the work array of
+ *  coreblas_zgeqrt from work->spaces[i]. A sequential BLAS should be used.
+ *
+ *******************************************************************************
+ *
+ * @param[in] m
+ *         The number of rows of the tiles A_i.  m >= 0.
+ *
+ * @param[in] n
+ *         The number of columns of the tiles A_i.  n >= 0.
+ *
+ * @param[in] ib
+ *         The inner-blocking size.  ib >= 0.
+ *
+ * @param[in,out] A
+ *         Array of batch pointers to the m-by-n tiles A_i, overwritten
+ *         as by coreblas_zgeqrt.
+ *
+ * @param[in] lda
+ *         The leading dimension of the tiles A_i. lda >= max(1,m).
+ *
+ * @param[out] T
+ *         Array of batch pointers to the ib-by-n triangular factors T_i.
+ *
+ * @param[in] ldt
+ *         The leading dimension of the arrays T_i. ldt >= ib.
+ *
+ * @param work
+ *         Per-thread workspace of type CoreBlasComplexDouble, with spaces
+ *         of at least coreblas_zgeqrt_batched_lwork(m, n, ib) elements.
+ *
+ * @param[in] batch
+ *         The number of tiles. batch >= 0.
+ *
+ *******************************************************************************
+ *
+ * @retval CoreBlasSuccess successful exit
+ * @retval < 0 if -i, the i-th argument had an illegal value
+ *
+ ******************************************************************************/
+__attribute__((weak))
+int coreblas_zgeqrt_batched(int m, int n, int ib,
+                            coreblas_complex64_t * const *A, int lda,
+                            coreblas_complex64_t * const *T, int ldt,
+                            coreblas_workspace_t *work, int batch)
+{
+#ifndef COREBLAS_UNCHECKED
+    // Check input arguments.
+    if (m < 0) {
+        coreblas_error("illegal value of m");
+        return -1;
+    }
+    if (n < 0) {
+        coreblas_error("illegal value of n");
+        return -2;
+    }
+    if ((ib < 0) || ( (ib == 0) && (m > 0) && (n > 0) )) {
+        coreblas_error("illegal value of ib");
+        return -3;
+    }
+    if (batch > 0 && A == NULL) {
+        coreblas_error("NULL A");
+        return -4;
+    }
+    if (lda < imax(1, m)) {
+        coreblas_error("illegal value of lda");
+        return -5;
+    }
+    if (batch > 0 && T == NULL) {
+        coreblas_error("NULL T");
+        return -6;
+    }
+    if (ldt < imax(1, ib)) {
+        coreblas_error("illegal value of ldt");
+        return -7;
+    }
+    if (work == NULL || work->spaces == NULL ||
+        work->dtyp != CoreBlasComplexDouble ||
+        work->lworkspace < coreblas_zgeqrt_batched_lwork(m, n, ib)) {
+        coreblas_error("illegal value of work");
+        return -8;
+    }
+    if (batch < 0) {
+        coreblas_error("illegal value of batch");
+        return -9;
+    }
+#endif
+
+    // quick return
+    if (batch == 0)
+        return CoreBlasSuccess;
+
+    int info = CoreBlasSuccess;
+    #pragma omp parallel num_threads(work->nthread)
+    {
+        int tid = 0;
+#ifdef _OPENMP
+        tid = omp_get_thread_num();
+#endif
+        coreblas_complex64_t *tau = (coreblas_complex64_t*)work->spaces[tid];
+        coreblas_complex64_t *w = &tau[n];
+
+        #pragma omp for schedule(static)
+        for (int i = 0; i < batch; i++) {
+            int iinfo = coreblas_zgeqrt_nocheck(m, n, ib, A[i], lda, T[i], ldt,
+                                                tau, w);
+            if (iinfo != CoreBlasSuccess) {
+                #pragma omp atomic write
+                info = iinfo;
+            }
+        }
+    }
+    return info;
+}
+
+/***************************************************************************//**
+ *
+ * @ingroup core_geqrt
+ *
+ *  Computes the same factorizations as coreblas_zgeqrt_batched on a batch
+ *  of tiles stored at a constant distance from each other: A_i starts at
+ *  A + i*strideA and T_i at T + i*strideT.
+ *
+ *******************************************************************************
+ *
+ * @param[in] strideA
+ *         The distance between two consecutive A_i. strideA >= lda*n.
+ *
+ * @param[in] strideT
+ *         The distance between two consecutive T_i. strideT >= ldt*n.
+ *
+ *  The other arguments are those of coreblas_zgeqrt_batched.
+ *
+ *******************************************************************************
+ *
+ * @retval CoreBlasSuccess successful exit
+ * @retval < 0 if -i, the i-th argument had an illegal value
+ *
+ ******************************************************************************/
+__attribute__((weak))
+int coreblas_zgeqrt_batched_strided(int m, int n, int ib,
+                                    coreblas_complex64_t *A, int lda,
+                                    size_t strideA,
+                                    coreblas_complex64_t *T, int ldt,
+                                    size_t strideT,
+                                    coreblas_workspace_t *work, int batch)
+{
+#ifndef COREBLAS_UNCHECKED
+    // Check input arguments.
+    if (m < 0) {
+        coreblas_error("illegal value of m");
+        return -1;
+    }
+    if (n < 0) {
+        coreblas_error("illegal value of n");
+        return -2;
+    }
+    if ((ib < 0) || ( (ib == 0) && (m > 0) && (n > 0) )) {
+        coreblas_error("illegal value of ib");
+        return -3;
+    }
+    if (batch > 0 && A == NULL) {
+        coreblas_error("NULL A");
+        return -4;
+    }
+    if (lda < imax(1, m)) {
+        coreblas_error("illegal value of lda");
+        return -5;
+    }
+    if (batch > 1 && strideA < (size_t)lda*n) {
+        coreblas_error("illegal value of strideA");
+        return -6;
+    }
+    if (batch > 0 && T == NULL) {
+        coreblas_error("NULL T");
+        return -7;
+    }
+    if (ldt < imax(1, ib)) {
+        coreblas_error("illegal value of ldt");
+        return -8;
+    }
+    if (batch > 1 && strideT < (size_t)ldt*n) {
+        coreblas_error("illegal value of strideT");
+        return -9;
+    }
+    if (work == NULL || work->spaces == NULL ||
+        work->dtyp != CoreBlasComplexDouble ||
+        work->lworkspace < coreblas_zgeqrt_batched_lwork(m, n, ib)) {
+        coreblas_error("illegal value of work");
+        return -10;
+    }
+    if (batch < 0) {
+        coreblas_error("illegal value of batch");
+        return -11;
+    }
+#endif
+
+    // quick return
+    if (batch == 0)
+        return CoreBlasSuccess;
+
+    int info = CoreBlasSuccess;
+    #pragma omp parallel num_threads(work->nthread)
+    {
+        int tid = 0;
+#ifdef _OPENMP
+        tid = omp_get_thread_num();
+#endif
+        coreblas_complex64_t *tau = (coreblas_complex64_t*)work->spaces[tid];
+        coreblas_complex64_t *w = &tau[n];
+
+        #pragma omp for schedule(static)
+        for (int i = 0; i < batch; i++) {
+            int iinfo = coreblas_zgeqrt_nocheck(m, n, ib,
+                                                &A[strideA*i], lda,
+                                                &T[strideT*i], ldt,
+                                                tau, w);
+            if (iinfo != CoreBlasSuccess) {
+                #pragma omp atomic write
+                info = iinfo;
+            }
+        }
+    }
+    return info;
+}
+
+/***************************************************************************//**
+ *
+ * @ingroup core_geqrt
+ *
+ *  Returns the minimum length of each thread's space of the workspace of
+ *  coreblas_zgeqrt_batched: tau followed by the work array of
+ *  coreblas_zgeqrt.
+ *
+ *******************************************************************************
+ *
+ * @param[in] m
+ *         The number of rows of the tiles.
+ *
+ * @param[in] n
+ *         The number of columns of the tiles.
+ *
+ * @param[in] ib
+ *         The inner-blocking size.
+ *
+ *******************************************************************************
+ *
+ * @retval the length of each space, at least 1.
+ *
+ ******************************************************************************/
+size_t coreblas_zgeqrt_batched_lwork(int m, int n, int ib)
+{
+    size_t lwork = imax(0, n) + coreblas_zgeqrt_lwork(m, n, ib);
+    return lwork > 0 ? lwork : 1;
+}
@@ -14,6 +14,7 @@
 
 #include <coreblas.h>
 #include "coreblas_types.h"
+#include "coreblas_internal.h"
 #include "core_lapack.h"
 
 /******************************************************************************/
@@ -24,15 +25,13 @@ void coreblas_zgessq(int m, int n,
 {
     *scale = 0.0;
     *sumsq = 1.0;
-    int ione = 1;
-    for (int j = 0; j < n; j++) {
-        // TODO: Inline this operation.
-        #ifdef COREBLAS_USE_64BIT_BLAS
-            LAPACK_zlassq64_(&m, &A[j*lda], &ione, scale, sumsq);
-        #else
-            LAPACK_zlassq(&m, &A[j*lda], &ione, scale, sumsq);
-        #endif 
-    }
+
+    // The accumulators are combined once for the whole tile.
+    double acc[3] = {0.0, 0.0, 0.0};
+    for (int j = 0; j < n; j++)
+        coreblas_zssq_update(m, &A[lda*j], acc);
+
+    coreblas_zssq_finish(acc, scale, sumsq);
 }
 
 /******************************************************************************/
@@ -40,17 +39,7 @@ void coreblas_zgessq_aux(int n,
                          const double *scale, const double *sumsq,
                          double *value)
 {
-
-    double scl = 0.0;
-    double sum = 1.0;
-    for (int i = 0; i < n; i++) {
-        if (scl < scale[i]) {
-            sum = sumsq[i] + sum*((scl/scale[i])*(scl/scale[i]));
-            scl = scale[i];
-        }
-        else if (scl > 0.) {
-            sum = sum + sumsq[i]*(scale[i]/scl)*(scale[i]/scl);
-        }
-    }
+    double scl, sum;
+    coreblas_zreduce_ssq(n, scale, sumsq, &scl, &sum);
     *value = scl*sqrt(sum);
 }
\ No newline at end of file
@@ -0,0 +1,325 @@
+/**
+ *
+ * @file
+ *
+ *  COREBLAS is a software package provided by:
+ *  University of Tennessee, US,
+ *  University of Manchester, UK.
+ *
+ * @precisions normal z -> c d s
+ *
+ **/
+
+#include <coreblas.h>
+#include "coreblas_descriptor.h"
+#include "coreblas_internal.h"
+#include "coreblas_types.h"
+#include "core_lapack.h"
+
+#define A(m, n) (coreblas_complex64_t*)coreblas_tile_addr(A, m, n)
+
+/******************************************************************************/
+// Size of the hash table of the rows outside of k1:k2, a power of two
+// at least twice the number of interchanges.
+static inline int core_zgeswp_blocked_nhash(int k1, int k2)
+{
+    int nhash = 1;
+    while (nhash < 2*(k2-k1+1))
+        nhash *= 2;
+    return nhash;
+}
+
+/******************************************************************************/
+// Returns the position of row r in the list rows[0:nrows]. The rows
+// k1-1:k2-1 take the first k2-k1+1 positions; the others are appended
+// on first use and found again through the hash table.
+// A new row holds its own content.
+static int core_zgeswp_blocked_find(int r, int k1, int k2,
+                                    int *rows, int *src, int *nrows,
+                                    int *hash, int nhash)
+{
+    if (r >= k1-1 && r <= k2-1)
+        return r-(k1-1);
+
+    unsigned h = ((unsigned)r*2654435761u) & (nhash-1);
+    while (hash[h] >= 0) {
+        if (rows[hash[h]] == r)
+            return hash[h];
+        h = (h+1) & (nhash-1);
+    }
+    hash[h] = *nrows;
+    rows[*nrows] = r;
+    src[*nrows] = r;
+    return (*nrows)++;
+}
+
+/******************************************************************************/
+// Sorts the pairs (src[t], rows[t]) by increasing src in place.
+static void core_zgeswp_blocked_sort(int n, int *src, int *rows)
+{
+    // heap sort
+    for (int end = n, start = n/2-1; end > 1; ) {
+        int root;
+        if (start >= 0) {
+            root = start--;
+        }
+        else {
+            end--;
+            int t = src[0];  src[0] = src[end];   src[end] = t;
+            t = rows[0];     rows[0] = rows[end]; rows[end] = t;
+            root = 0;
+        }
+        for (int child; (child = 2*root+1) < end; root = child) {
+            if (child+1 < end && src[child+1] > src[child])
+                child++;
+            if (src[root] >= src[child])
+                break;
+            int t = src[root]; src[root] = src[child];   src[child] = t;
+            t = rows[root];    rows[root] = rows[child]; rows[child] = t;
+        }
+    }
+}
+
+/******************************************************************************/
+// Computes the net effect of the interchanges k1:k2 of ipiv: on exit,
+// row rows[t] must receive the original content of row src[t], for
+// t = 0:nmove, ordered by source row, so that the gathers walk each
+// column of a tile column forward. Returns nmove.
+static int core_zgeswp_blocked_map(int k1, int k2, const int *ipiv, int incx,
+                                   int *iwork)
+{
+    int nk = k2-k1+1;
+    int nhash = core_zgeswp_blocked_nhash(k1, k2);
+    int *rows = iwork;
+    int *src  = &iwork[2*nk];
+    int *hash = &iwork[4*nk];
+
+    for (int t = 0; t < nk; t++) {
+        rows[t] = k1-1+t;
+        src[t] = k1-1+t;
+    }
+    for (int h = 0; h < nhash; h++)
+        hash[h] = -1;
+
+    int nrows = nk;
+    int first = incx > 0 ? k1-1 : k2-1;
+    int last  = incx > 0 ? k2-1 : k1-1;
+    for (int i = first; incx > 0 ? i <= last : i >= last; i += incx) {
+        int p = ipiv[i]-1;
+        if (p != i) {
+            int ti = core_zgeswp_blocked_find(i, k1, k2, rows, src, &nrows,
+                                              hash, nhash);
+            int tp = core_zgeswp_blocked_find(p, k1, k2, rows, src, &nrows,
+                                              hash, nhash);
+            int tmp = src[ti];
+            src[ti] = src[tp];
+            src[tp] = tmp;
+        }
+    }
+
+    // Keep only the rows that change.
+    int nmove = 0;
+    for (int t = 0; t < nrows; t++) {
+        if (src[t] != rows[t]) {
+            rows[nmove] = rows[t];
+            src[nmove] = src[t];
+            nmove++;
+        }
+    }
+    core_zgeswp_blocked_sort(nmove, src, rows);
+    return nmove;
+}
+
+/***************************************************************************//**
+ *
+ * @ingroup core_geswp
+ *
+ *  Performs a series of row or column interchanges on the tile matrix A,
+ *  as coreblas_zgeswp, one tile row or column at a time.
+ *
+ *  For row interchanges, the net permutation of the interchanges k1:k2 is
+ *  computed first. Then, for each tile column, the rows that change are
+ *  gathered column by column into a contiguous buffer and scattered back
+ *  to their destinations, so that every column of the tile column is
+ *  traversed once, instead of once per interchange with a stride of a
+ *  whole row. For column interchanges, which swap contiguous columns,
+ *  the interchanges are applied one tile row at a time.
+ *
+ *  The tile columns (tile rows for column interchanges) are distributed
+ *  cyclically among size threads; tile column n is processed by the
+ *  thread of rank n % size. All threads call the routine with the same
+ *  arguments and their own rank and private workspaces; no
+ *  synchronization is needed.
+ *
+ *******************************************************************************
+ *
+ * @param[in] colrow
+ *         - CoreBlasRowwise:    interchange rows;
+ *         - CoreBlasColumnwise: interchange columns.
+ *
+ * @param[in,out] A
+ *         Descriptor of the tile matrix; the indices of ipiv are
+ *         relative to it.
+ *
+ * @param[in] k1
+ *         The first element of ipiv for which an interchange will
+ *         be done (1-based).
+ *
+ * @param[in] k2
+ *         The last element of ipiv for which an interchange will
+ *         be done (1-based).
+ *
+ * @param[in] ipiv
+ *         The pivot indices; only the elements k1:k2 are accessed.
+ *
+ * @param[in] incx
+ *         1 to apply the interchanges in increasing order, -1 to apply
+ *         them in decreasing order.
+ *
+ * @param[in] rank
+ *         The rank of the calling thread, 0 <= rank < size.
+ *
+ * @param[in] size
+ *         The number of threads.
+ *
+ * @param work
+ *         Private workspace of the calling thread, of length
+ *         coreblas_zgeswp_blocked_lwork(A, k1, k2).
+ *
+ * @param iwork
+ *         Private workspace of the calling thread, of length
+ *         coreblas_zgeswp_blocked_liwork(k1, k2).
+ *
+ ******************************************************************************/
+__attribute__((weak))
+void coreblas_zgeswp_blocked(coreblas_enum_t colrow, coreblas_desc_t A,
+                             int k1, int k2, const int *ipiv, int incx,
+                             int rank, int size,
+                             coreblas_complex64_t *work, int *iwork)
+{
+    if (k2 < k1)
+        return;
+
+    //================
+    // CoreBlasRowwise
+    //================
+    if (colrow == CoreBlasRowwise) {
+        int nk = k2-k1+1;
+        int *rows = iwork;
+        int *src  = &iwork[2*nk];
+        int *slot = &iwork[4*nk];
+        int nmove = core_zgeswp_blocked_map(k1, k2, ipiv, incx, iwork);
+        if (nmove == 0)
+            return;
+
+        // Gathers are done in the order of src, into consecutive slots.
+        // Scatters are done in the order of rows, from slot[t].
+        for (int t = 0; t < nmove; t++)
+            slot[t] = t;
+        core_zgeswp_blocked_sort(nmove, rows, slot);
+
+        for (int n = rank; n < A.nt; n += size) {
+            int nvan = coreblas_tile_nview(A, n);
+
+            // gather, one tile row at a time
+            for (int t0 = 0, t1; t0 < nmove; t0 = t1) {
+                int m = src[t0]/A.mb;
+                for (t1 = t0+1; t1 < nmove && src[t1]/A.mb == m; t1++);
+                coreblas_complex64_t *a = A(m, n);
+                int lda = coreblas_tile_mmain(A, m);
+                int base = m*A.mb;
+                for (int j = 0; j < nvan; j++)
+                    for (int t = t0; t < t1; t++)
+                        work[t+nmove*j] = a[src[t]-base+lda*j];
+            }
+            // scatter, one tile row at a time
+            for (int t0 = 0, t1; t0 < nmove; t0 = t1) {
+                int m = rows[t0]/A.mb;
+                for (t1 = t0+1; t1 < nmove && rows[t1]/A.mb == m; t1++);
+                coreblas_complex64_t *a = A(m, n);
+                int lda = coreblas_tile_mmain(A, m);
+                int base = m*A.mb;
+                for (int j = 0; j < nvan; j++)
+                    for (int t = t0; t < t1; t++)
+                        a[rows[t]-base+lda*j] = work[slot[t]+nmove*j];
+            }
+        }
+    }
+    //===================
+    // CoreBlasColumnwise
+    //===================
+    else {
+        int first = incx > 0 ? k1-1 : k2-1;
+        int last  = incx > 0 ? k2-1 : k1-1;
+        for (int m = rank; m < A.mt; m += size) {
+            int mvam = coreblas_tile_mview(A, m);
+            int ldam = coreblas_tile_mmain(A, m);
+
+            for (int i = first; incx > 0 ? i <= last : i >= last; i += incx) {
+                int p = ipiv[i]-1;
+                if (p != i) {
+#ifdef COREBLAS_USE_64BIT_BLAS
+                    cblas_zswap64_(mvam,
+                                   A(m, i/A.nb) + (i%A.nb)*ldam, 1,
+                                   A(m, p/A.nb) + (p%A.nb)*ldam, 1);
+#else
+                    cblas_zswap(mvam,
+                                A(m, i/A.nb) + (i%A.nb)*ldam, 1,
+                                A(m, p/A.nb) + (p%A.nb)*ldam, 1);
+#endif
+                }
+            }
+        }
+    }
+}
+
+/***************************************************************************//**
+ *
+ * @ingroup core_geswp
+ *
+ *  Returns the minimum length of the array work of coreblas_zgeswp_blocked.
+ *
+ *******************************************************************************
+ *
+ * @param[in] A
+ *         Descriptor of the tile matrix.
+ *
+ * @param[in] k1
+ *         The first interchange.
+ *
+ * @param[in] k2
+ *         The last interchange.
+ *
+ *******************************************************************************
+ *
+ * @retval the length of work, at least 1.
+ *
+ ******************************************************************************/
+size_t coreblas_zgeswp_blocked_lwork(coreblas_desc_t A, int k1, int k2)
+{
+    return imax(1, 2*(k2-k1+1))*(size_t)imax(1, A.nb);
+}
+
+/***************************************************************************//**
+ *
+ * @ingroup core_geswp
+ *
+ *  Returns the minimum length of the array iwork of coreblas_zgeswp_blocked.
+ *
+ *******************************************************************************
+ *
+ * @param[in] k1
+ *         The first interchange.
+ *
+ * @param[in] k2
+ *         The last interchange.
+ *
+ *******************************************************************************
+ *
+ * @retval the length of iwork, at least 1.
+ *
+ ******************************************************************************/
+size_t coreblas_zgeswp_blocked_liwork(int k1, int k2)
+{
+    return imax(1, 4*(k2-k1+1) + core_zgeswp_blocked_nhash(k1, k2));
+}
@@ -23,216 +23,342 @@
 
 #define A(m, n) (coreblas_complex64_t*)coreblas_tile_addr(A, m, n)
 
+// Panels of at most this many columns are factored one column at a time.
+#define COREBLAS_GETRF_LEAF 8
+
 /******************************************************************************/
-__attribute__((weak))
-void coreblas_zgetrf(coreblas_desc_t A, int *ipiv, int ib, int rank, int size,
-                 volatile int *max_idx, volatile coreblas_complex64_t *max_val,
-                 volatile int *info, coreblas_barrier_t *barrier)
+// Applies the interchanges of rows k0:k0+kn with rows ipiv[k0:k0+kn]-1
+// to the columns n0:n0+nn of the panel.
+static void core_zgetrf_laswp(coreblas_desc_t A, int n0, int nn,
+                              int k0, int kn, const int *ipiv)
 {
-    double sfmin = LAPACKE_dlamch_work('S');
-    for (int k = 0; k < imin(A.m, A.n); k += ib) {
-        int kb = imin(imin(A.m, A.n)-k, ib);
+    if (nn <= 0)
+        return;
 
-        coreblas_complex64_t *a0 = A(0, 0);
-        int lda0 = coreblas_tile_mmain(A, 0);
-        int mva0 = coreblas_tile_mview(A, 0);
-        int nva0 = coreblas_tile_nview(A, 0);
-
-        //======================
-        // panel factorization
-        //======================
-        for (int j = k; j < k+kb; j++) {
-            // pivot search
-            max_idx[rank] = 0;
-            max_val[rank] = a0[j+j*lda0];
-
-            for (int l = rank; l < A.mt; l += size) {
-                coreblas_complex64_t *al = A(l, 0);
-                int ldal = coreblas_tile_mmain(A, l);
-                int mval = coreblas_tile_mview(A, l);
-
-                if (l == 0) {
-                    for (int i = 1; i < mva0-j; i++)
-                        if (coreblas_dcabs1(a0[j+i+j*lda0]) >
-                            coreblas_dcabs1(max_val[rank])) {
-
-                            max_val[rank] = a0[j+i+j*lda0];
-                            max_idx[rank] = i;
-                        }
-                }
-                else {
-                    for (int i = 0; i < mval; i++)
-                        if (coreblas_dcabs1(al[i+j*ldal]) >
-                            coreblas_dcabs1(max_val[rank])) {
-
-                            max_val[rank] = al[i+j*ldal];
-                            max_idx[rank] = A.mb*l+i-j;
-                        }
-                }
-            }
+    for (int i = k0; i < k0+kn; i++) {
+        int p = ipiv[i]-1;
+        if (p != i) {
+            coreblas_complex64_t *ai = A(i/A.mb, 0);
+            coreblas_complex64_t *ap = A(p/A.mb, 0);
+            int ldai = coreblas_tile_mmain(A, i/A.mb);
+            int ldap = coreblas_tile_mmain(A, p/A.mb);
+#ifdef COREBLAS_USE_64BIT_BLAS
+            cblas_zswap64_(nn,
+                           &ai[i%A.mb+n0*ldai], ldai,
+                           &ap[p%A.mb+n0*ldap], ldap);
+#else
+            cblas_zswap(nn,
+                        &ai[i%A.mb+n0*ldai], ldai,
+                        &ap[p%A.mb+n0*ldap], ldap);
+#endif
+        }
+    }
+}
 
-            coreblas_barrier_wait(barrier, size);
-            if (rank == 0)
-            {
-                // max reduction
-                for (int i = 1; i < size; i++) {
-                    if (coreblas_dcabs1(max_val[i]) >
-                        coreblas_dcabs1(max_val[0])) {
-                        max_val[0] = max_val[i];
-                        max_idx[0] = max_idx[i];
-                    }
-                }
-
-                // pivot adjustment
-                int jp = j+max_idx[0];
-                ipiv[j] = jp-k+1;
-
-                // singularity check
-                if (*info == 0 && max_val[0] == 0.0) {
-                    *info = j+1;
-                }
-                else {
-                    // pivot swap
-                    if (jp != j) {
-                        coreblas_complex64_t *ap = A(jp/A.mb, 0);
-                        int ldap = coreblas_tile_mmain(A, jp/A.mb);
-
-                        cblas_zswap(kb,
-                                    &a0[j+k*lda0], lda0,
-                                    &ap[jp%A.mb+k*ldap], ldap);
-                    }
-                }
+/******************************************************************************/
+// Factors the columns j0:j0+nc of the panel one column at a time.
+// Each column takes two barriers: one after the local pivot searches, after
+// which every rank reduces the candidates in the same order, and one after
+// rank 0 has swapped the pivot row within the columns j0:j0+nc. Each rank
+// then scales and updates the rows of its own tiles.
+static void core_zgetrf_leaf(coreblas_desc_t A, int j0, int nc, int *ipiv,
+                             int rank, int size,
+                             volatile int *max_idx,
+                             volatile coreblas_complex64_t *max_val,
+                             volatile int *info, coreblas_barrier_t *barrier,
+                             double sfmin)
+{
+    coreblas_complex64_t *a0 = A(0, 0);
+    int lda0 = coreblas_tile_mmain(A, 0);
+    int mva0 = coreblas_tile_mview(A, 0);
+
+    for (int j = j0; j < j0+nc; j++) {
+        //==============
+        // pivot search
+        //==============
+        // Only rank 0 reads the diagonal, as tile 0 may still be
+        // updated by it. A rank without rows reports a zero candidate
+        // that loses all ties.
+        int idx = A.m;
+        coreblas_complex64_t val = 0.0;
+        double amax = 0.0;
+        if (rank == 0) {
+            idx = j;
+            val = a0[j+j*lda0];
+            amax = coreblas_dcabs1(val);
+        }
+
+        for (int l = rank; l < A.mt; l += size) {
+            coreblas_complex64_t *al = A(l, 0);
+            int ldal = coreblas_tile_mmain(A, l);
+            int mval = coreblas_tile_mview(A, l);
+
+            int i0 = (l == 0 ? j+1 : 0);
+            double absa;
+            int i = coreblas_izamax_nonan(mval-i0, &al[i0+j*ldal], &absa);
+            if (absa > amax) {
+                amax = absa;
+                val = al[i0+i+j*ldal];
+                idx = A.mb*l+i0+i;
             }
-            coreblas_barrier_wait(barrier, size);
-
-            // column scaling and trailing update (all ranks)
-            for (int l = rank; l < A.mt; l += size) {
-                coreblas_complex64_t *al = A(l, 0);
-                int ldal = coreblas_tile_mmain(A, l);
-                int mval = coreblas_tile_mview(A, l);
-
-                if (*info == 0) {
-                    // column scaling
-                    if (cabs(a0[j+j*lda0]) >= sfmin) {
-                        if (l == 0) {
-                            for (int i = 1; i < mva0-j; i++)
-                                a0[j+i+j*lda0] /= a0[j+j*lda0];
-                        }
-                        else {
-                            for (int i = 0; i < mval; i++)
-                                al[i+j*ldal] /= a0[j+j*lda0];
-                        }
-                    }
-                    else {
-                        coreblas_complex64_t scal = 1.0/a0[j+j*lda0];
-                        if (l == 0)
-                            cblas_zscal(mva0-j-1, CBLAS_SADDR(scal),
-                                        &a0[j+1+j*lda0], 1);
-                        else
-                            cblas_zscal(mval, CBLAS_SADDR(scal),
-                                        &al[j*ldal], 1);
-                    }
-                }
-
-                // trailing update
-                coreblas_complex64_t zmone = -1.0;
-                if (l == 0) {
-                    cblas_zgeru(CblasColMajor,
-                                mva0-j-1, k+kb-j-1,
-                                CBLAS_SADDR(zmone), &a0[j+1+j*lda0], 1,
-                                                    &a0[j+(j+1)*lda0], lda0,
-                                                    &a0[j+1+(j+1)*lda0], lda0);
-                }
-                else {
-                    cblas_zgeru(CblasColMajor,
-                                mval, k+kb-j-1,
-                                CBLAS_SADDR(zmone), &al[+j*ldal], 1,
-                                                    &a0[j+(j+1)*lda0], lda0,
-                                                    &al[+(j+1)*ldal], ldal);
-                }
+        }
+        max_idx[rank] = idx;
+        max_val[rank] = val;
+        coreblas_barrier_wait(barrier, size);
+
+        // max reduction, the first row wins ties as in LAPACK
+        int jp = max_idx[0];
+        coreblas_complex64_t piv = max_val[0];
+        amax = coreblas_dcabs1(piv);
+        for (int r = 1; r < size; r++) {
+            double absa = coreblas_dcabs1(max_val[r]);
+            if (absa > amax || (absa == amax && max_idx[r] < jp)) {
+                amax = absa;
+                piv = max_val[r];
+                jp = max_idx[r];
             }
-            coreblas_barrier_wait(barrier, size);
         }
 
-        //===================================
-        // right pivoting and trsm (rank 0)
-        //===================================
-        coreblas_barrier_wait(barrier, size);
         if (rank == 0) {
-            // pivot adjustment
-            for (int i = k+1; i <= imin(A.m, k+kb); i++)
-                ipiv[i-1] += k;
-
-            // right pivoting
-            for (int i = k; i < k+kb; i++) {
-                coreblas_complex64_t *ap = A((ipiv[i]-1)/A.mb, 0);
-                int ldap = coreblas_tile_mmain(A, (ipiv[i]-1)/A.mb);
-
-                cblas_zswap(nva0-k-kb,
-                            &a0[i+(k+kb)*lda0], lda0,
-                            &ap[(ipiv[i]-1)%A.mb+(k+kb)*ldap], ldap);
+            ipiv[j] = jp+1;
+
+            // singularity check
+            if (piv == 0.0) {
+                if (*info == 0)
+                    *info = j+1;
+            }
+            else {
+                core_zgetrf_laswp(A, j0, nc, j, 1, ipiv);
             }
-            // trsm
-            coreblas_complex64_t zone = 1.0;
-            cblas_ztrsm(CblasColMajor,
-                        CblasLeft, CblasLower,
-                        CblasNoTrans, CblasUnit,
-                        kb,
-                        nva0-k-kb,
-                        CBLAS_SADDR(zone), &a0[k+k*lda0], lda0,
-                                           &a0[k+(k+kb)*lda0], lda0);
         }
         coreblas_barrier_wait(barrier, size);
 
-        //===================
-        // gemm (all ranks)
-        //===================
-        coreblas_complex64_t zone = 1.0;
+        if (piv == 0.0)
+            continue;
+
+        //==========================================
+        // column scaling and update (own tiles)
+        //==========================================
+        coreblas_complex64_t scal = 1.0/piv;
         coreblas_complex64_t zmone = -1.0;
-        for (int i = rank; i < A.mt; i += size) {
-            coreblas_complex64_t *ai = A(i, 0);
-            int mvai = coreblas_tile_mview(A, i);
-            int ldai = coreblas_tile_mmain(A, i);
-
-            if (i == 0) {
-                cblas_zgemm(CblasColMajor,
-                            CblasNoTrans, CblasNoTrans,
-                            mva0-k-kb,
-                            nva0-k-kb,
-                            kb,
-                            CBLAS_SADDR(zmone), &a0[k+kb+k*lda0], lda0,
-                                                &a0[k+(k+kb)*lda0], lda0,
-                            CBLAS_SADDR(zone),  &a0[(k+kb)+(k+kb)*lda0], lda0);
+        int nj = j0+nc-j-1;
+        for (int l = rank; l < A.mt; l += size) {
+            coreblas_complex64_t *al = A(l, 0);
+            int ldal = coreblas_tile_mmain(A, l);
+            int i0 = (l == 0 ? j+1 : 0);
+            int mi = (l == 0 ? mva0 : coreblas_tile_mview(A, l))-i0;
+            if (mi <= 0)
+                continue;
+
+            if (cabs(piv) >= sfmin) {
+#ifdef COREBLAS_USE_64BIT_BLAS
+                cblas_zscal64_(mi, CBLAS_SADDR(scal), &al[i0+j*ldal], 1);
+#else
+                cblas_zscal(mi, CBLAS_SADDR(scal), &al[i0+j*ldal], 1);
+#endif
             }
             else {
-                cblas_zgemm(CblasColMajor,
-                            CblasNoTrans, CblasNoTrans,
-                            mvai,
-                            nva0-k-kb,
-                            kb,
-                            CBLAS_SADDR(zmone), &ai[k*ldai], ldai,
-                                                &a0[k+(k+kb)*lda0], lda0,
-                            CBLAS_SADDR(zone),  &ai[(k+kb)*ldai], ldai);
+                for (int i = i0; i < i0+mi; i++)
+                    al[i+j*ldal] /= piv;
             }
-        }
-        coreblas_barrier_wait(barrier, size);
-    }
 
-    //============================
-    // left pivoting (all ranks)
-    //============================
-    for (int k = ib; k < imin(A.m, A.n); k += ib) {
-        if (k%ib == rank) {
-            for (int i = k; i < imin(A.m, A.n); i++) {
-                coreblas_complex64_t *ai = A(i/A.mb, 0);
-                coreblas_complex64_t *ap = A((ipiv[i]-1)/A.mb, 0);
-                int ldai = coreblas_tile_mmain(A, (i/A.mb));
-                int ldap = coreblas_tile_mmain(A, (ipiv[i]-1)/A.mb);
-
-                cblas_zswap(ib,
-                            &ai[i%A.mb+(k-ib)*ldai], ldai,
-                            &ap[(ipiv[i]-1)%A.mb+(k-ib)*ldap], ldap);
+            if (nj > 0) {
+#ifdef COREBLAS_USE_64BIT_BLAS
+                cblas_zgeru64_(CblasColMajor,
+                               mi, nj,
+                               CBLAS_SADDR(zmone), &al[i0+j*ldal], 1,
+                                                   &a0[j+(j+1)*lda0], lda0,
+                                                   &al[i0+(j+1)*ldal], ldal);
+#else
+                cblas_zgeru(CblasColMajor,
+                            mi, nj,
+                            CBLAS_SADDR(zmone), &al[i0+j*ldal], 1,
+                                                &a0[j+(j+1)*lda0], lda0,
+                                                &al[i0+(j+1)*ldal], ldal);
+#endif
             }
         }
     }
 }
+
+/******************************************************************************/
+// Recursive factorization of the columns j0:j0+nc of the panel.
+// The left half is factored, its interchanges and L11^{-1} are applied to
+// the top of the right half by rank 0, the rest of the right half is
+// updated with GEMM by every rank on its own tiles, the right half is
+// factored, and its interchanges are applied back to the left half.
+// Besides the leaves, each level takes a single barrier.
+static void core_zgetrf_rec(coreblas_desc_t A, int j0, int nc, int nleaf,
+                            int *ipiv, int rank, int size,
+                            volatile int *max_idx,
+                            volatile coreblas_complex64_t *max_val,
+                            volatile int *info, coreblas_barrier_t *barrier,
+                            double sfmin)
+{
+    if (nc <= nleaf) {
+        core_zgetrf_leaf(A, j0, nc, ipiv, rank, size,
+                         max_idx, max_val, info, barrier, sfmin);
+        return;
+    }
+
+    static coreblas_complex64_t zone  =  1.0;
+    static coreblas_complex64_t zmone = -1.0;
+
+    int n1 = nc/2;
+    int n2 = nc-n1;
+
+    coreblas_complex64_t *a0 = A(0, 0);
+    int lda0 = coreblas_tile_mmain(A, 0);
+    int mva0 = coreblas_tile_mview(A, 0);
+
+    core_zgetrf_rec(A, j0, n1, nleaf, ipiv, rank, size,
+                    max_idx, max_val, info, barrier, sfmin);
+
+    if (rank == 0) {
+        core_zgetrf_laswp(A, j0+n1, n2, j0, n1, ipiv);
+
+        // A12 = L11^{-1} A12
+#ifdef COREBLAS_USE_64BIT_BLAS
+        cblas_ztrsm64_(CblasColMajor,
+                       CblasLeft, CblasLower,
+                       CblasNoTrans, CblasUnit,
+                       n1, n2,
+                       CBLAS_SADDR(zone), &a0[j0+j0*lda0],      lda0,
+                                          &a0[j0+(j0+n1)*lda0], lda0);
+#else
+        cblas_ztrsm(CblasColMajor,
+                    CblasLeft, CblasLower,
+                    CblasNoTrans, CblasUnit,
+                    n1, n2,
+                    CBLAS_SADDR(zone), &a0[j0+j0*lda0],      lda0,
+                                       &a0[j0+(j0+n1)*lda0], lda0);
+#endif
+    }
+    coreblas_barrier_wait(barrier, size);
+
+    // A22 -= A21 A12
+    for (int l = rank; l < A.mt; l += size) {
+        coreblas_complex64_t *al = A(l, 0);
+        int ldal = coreblas_tile_mmain(A, l);
+        int i0 = (l == 0 ? j0+n1 : 0);
+        int mi = (l == 0 ? mva0 : coreblas_tile_mview(A, l))-i0;
+        if (mi <= 0)
+            continue;
+#ifdef COREBLAS_USE_64BIT_BLAS
+        cblas_zgemm64_(CblasColMajor,
+                       CblasNoTrans, CblasNoTrans,
+                       mi, n2, n1,
+                       CBLAS_SADDR(zmone), &al[i0+j0*ldal],      ldal,
+                                           &a0[j0+(j0+n1)*lda0], lda0,
+                       CBLAS_SADDR(zone),  &al[i0+(j0+n1)*ldal], ldal);
+#else
+        cblas_zgemm(CblasColMajor,
+                    CblasNoTrans, CblasNoTrans,
+                    mi, n2, n1,
+                    CBLAS_SADDR(zmone), &al[i0+j0*ldal],      ldal,
+                                        &a0[j0+(j0+n1)*lda0], lda0,
+                    CBLAS_SADDR(zone),  &al[i0+(j0+n1)*ldal], ldal);
+#endif
+    }
+
+    // Every rank only reads its own tiles until the first barrier
+    // of the right half, so no barrier is needed here.
+    core_zgetrf_rec(A, j0+n1, n2, nleaf, ipiv, rank, size,
+                    max_idx, max_val, info, barrier, sfmin);
+
+    // The last barrier of the right half has been passed by every rank,
+    // which from then on only touches the columns j0+n1:j0+nc.
+    if (rank == 0)
+        core_zgetrf_laswp(A, j0, n1, j0+n1, n2, ipiv);
+}
+
+/***************************************************************************//**
+ *
+ * @ingroup core_getrf
+ *
+ *  Computes the LU factorization with partial row pivoting of the tile
+ *  column panel A, using size threads. All threads call the routine with
+ *  the same arguments and their own rank.
+ *
+ *  The panel is factored recursively: the left half of the columns is
+ *  factored, the right half is updated with TRSM and GEMM, and then
+ *  factored itself. Panels of at most min(ib, 8) columns are factored one
+ *  column at a time with level 2 operations, taking two barriers per
+ *  column; each recursion level above takes one more barrier, and the
+ *  bulk of the flops is done in GEMM by every thread on its own tiles.
+ *  Tile l of the panel is owned by the thread of rank l % size.
+ *
+ *******************************************************************************
+ *
+ * @param[in,out] A
+ *         Descriptor of the m-by-n panel, one tile column wide, with n not
+ *         larger than the number of rows of its first tile.
+ *         On exit, the factors L and U; the unit diagonal of L is not stored.
+ *
+ * @param[out] ipiv
+ *         The pivot indices, dimension min(m,n); row i of the panel was
+ *         interchanged with row ipiv[i] (1-based).
+ *
+ * @param[in] ib
+ *         Upper bound on the width of the panels factored one column
+ *         at a time.
+ *
+ * @param[in] rank
+ *         The rank of the calling thread, 0 <= rank < size.
+ *
+ * @param[in] size
+ *         The number of threads.
+ *
+ * @param max_idx
+ *         Workspace shared by the threads, dimension size.
+ *
+ * @param max_val
+ *         Workspace shared by the threads, dimension size.
+ *
+ * @param[in,out] info
+ *         Shared by the threads, zero on entry. On exit, if info = i > 0,
+ *         U(i,i) is exactly zero: the factorization has been completed,
+ *         but U is singular.
+ *
+ * @param barrier
+ *         Barrier of the size threads, see coreblas_barrier_init().
+ *
+ ******************************************************************************/
+__attribute__((weak))
+void coreblas_zgetrf(coreblas_desc_t A, int *ipiv, int ib, int rank, int size,
+                 volatile int *max_idx, volatile coreblas_complex64_t *max_val,
+                 volatile int *info, coreblas_barrier_t *barrier)
+{
+    static coreblas_complex64_t zone = 1.0;
+
+    double sfmin = LAPACKE_dlamch_work('S');
+    int minmn = imin(A.m, A.n);
+    int nleaf = imax(1, imin(ib, COREBLAS_GETRF_LEAF));
+
+    core_zgetrf_rec(A, 0, minmn, nleaf, ipiv, rank, size,
+                    max_idx, max_val, info, barrier, sfmin);
+
+    // Columns right of a wide panel.
+    if (rank == 0 && A.n > minmn) {
+        coreblas_complex64_t *a0 = A(0, 0);
+        int lda0 = coreblas_tile_mmain(A, 0);
+
+        core_zgetrf_laswp(A, minmn, A.n-minmn, 0, minmn, ipiv);
+#ifdef COREBLAS_USE_64BIT_BLAS
+        cblas_ztrsm64_(CblasColMajor,
+                       CblasLeft, CblasLower,
+                       CblasNoTrans, CblasUnit,
+                       minmn, A.n-minmn,
+                       CBLAS_SADDR(zone), a0,               lda0,
+                                          &a0[minmn*lda0], lda0);
+#else
+        cblas_ztrsm(CblasColMajor,
+                    CblasLeft, CblasLower,
+                    CblasNoTrans, CblasUnit,
+                    minmn, A.n-minmn,
+                    CBLAS_SADDR(zone), a0,               lda0,
+                                       &a0[minmn*lda0], lda0);
+#endif
+    }
+    coreblas_barrier_wait(barrier, size);
+}
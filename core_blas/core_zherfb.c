@@ -0,0 +1,292 @@
+/**
+ *
+ * @file
+ *
+ *  COREBLAS is a software package provided by:
+ *  University of Tennessee, US,
+ *  University of Manchester, UK.
+ *
+ * @precisions normal z -> c d s
+ *
+ **/
+
+#include <coreblas.h>
+#include "coreblas_types.h"
+#include "coreblas_internal.h"
+
+#undef REAL
+#define COMPLEX
+
+/***************************************************************************//**
+ *
+ * @ingroup core_herfb
+ *
+ *  Overwrites the Hermitian n-by-n diagonal tile C with
+ *
+ *    uplo = CoreBlasLower:  Q^H * C * Q,
+ *    uplo = CoreBlasUpper:  Q * C * Q^H,
+ *
+ *  where Q is the unitary matrix returned by coreblas_zgeqrt (lower) or
+ *  coreblas_zgelqt (upper) in the first k columns (rows) of A. This is
+ *  the update of the diagonal tile in the reduction of a Hermitian matrix
+ *  to band form.
+ *
+ *  Only the uplo triangle of C is referenced and updated. Every block
+ *  H = I - V T V^H of ib reflectors is applied to the trailing diagonal
+ *  block C22 it acts on as
+ *
+ *    X = C22 V T,  W = X - 1/2 V (T^H V^H X),  C22 = C22 - V W^H - W V^H,
+ *
+ *  with one hemm and one her2k, i.e., about half the operations of
+ *  applying H from the left and then from the right to the full block,
+ *  and from one side only to the rows left of (columns above) C22.
+ *
+ *******************************************************************************
+ *
+ * @param[in] uplo
+ *         - CoreBlasLower : the lower triangle of C is stored and the
+ *                           reflectors are those of coreblas_zgeqrt;
+ *         - CoreBlasUpper : the upper triangle of C is stored and the
+ *                           reflectors are those of coreblas_zgelqt.
+ *
+ * @param[in] n
+ *         The order of the tile C. n >= 0.
+ *
+ * @param[in] k
+ *         The number of elementary reflectors whose product defines
+ *         the matrix Q. n >= k >= 0.
+ *
+ * @param[in] ib
+ *         The inner-blocking size. ib >= 0.
+ *
+ * @param[in] A
+ *         If uplo = CoreBlasLower, the n-by-k array whose i-th column
+ *         contains below the diagonal the vector which defines the
+ *         elementary reflector H(i), as returned by coreblas_zgeqrt.
+ *         If uplo = CoreBlasUpper, the k-by-n array whose i-th row
+ *         contains the vector right of the diagonal, as returned by
+ *         coreblas_zgelqt.
+ *
+ * @param[in] lda
+ *         The leading dimension of the array A.
+ *         If uplo = CoreBlasLower, lda >= max(1,n);
+ *         if uplo = CoreBlasUpper, lda >= max(1,k).
+ *
+ * @param[in] T
+ *         The ib-by-k triangular factor T of the block reflector.
+ *         T is upper triangular by block (economic storage);
+ *         The rest of the array is not referenced.
+ *
+ * @param[in] ldt
+ *         The leading dimension of the array T. ldt >= ib.
+ *
+ * @param[in,out] C
+ *         On entry, the uplo triangle of the Hermitian tile C.
+ *         On exit, the uplo triangle of Q^H*C*Q or Q*C*Q^H.
+ *
+ * @param[in] ldc
+ *         The leading dimension of the array C. ldc >= max(1,n).
+ *
+ * @param work
+ *         Workspace of length coreblas_zherfb_lwork(n, ib).
+ *         The kernel does not allocate memory.
+ *
+ *******************************************************************************
+ *
+ * @retval CoreBlasSuccess successful exit
+ * @retval < 0 if -i, the i-th argument had an illegal value
+ *
+ ******************************************************************************/
+__attribute__((weak))
+int coreblas_zherfb(coreblas_enum_t uplo, int n, int k, int ib,
+                const coreblas_complex64_t *A,    int lda,
+                const coreblas_complex64_t *T,    int ldt,
+                      coreblas_complex64_t *C,    int ldc,
+                      coreblas_complex64_t *work)
+{
+#ifndef COREBLAS_UNCHECKED
+    // Check input arguments.
+    if (uplo != CoreBlasLower && uplo != CoreBlasUpper) {
+        coreblas_error("illegal value of uplo");
+        return -1;
+    }
+    if (n < 0) {
+        coreblas_error("illegal value of n");
+        return -2;
+    }
+    if (k < 0 || k > n) {
+        coreblas_error("illegal value of k");
+        return -3;
+    }
+    if (ib < 0) {
+        coreblas_error("illegal value of ib");
+        return -4;
+    }
+    if (A == NULL) {
+        coreblas_error("NULL A");
+        return -5;
+    }
+    if (lda < imax(1, uplo == CoreBlasLower ? n : k)) {
+        coreblas_error("illegal value of lda");
+        return -6;
+    }
+    if (T == NULL) {
+        coreblas_error("NULL T");
+        return -7;
+    }
+    if (ldt < imax(1, ib)) {
+        coreblas_error("illegal value of ldt");
+        return -8;
+    }
+    if (C == NULL) {
+        coreblas_error("NULL C");
+        return -9;
+    }
+    if (ldc < imax(1, n)) {
+        coreblas_error("illegal value of ldc");
+        return -10;
+    }
+    if (work == NULL) {
+        coreblas_error("NULL work");
+        return -11;
+    }
+#endif
+
+    // quick return
+    if (n == 0 || k == 0 || ib == 0)
+        return CoreBlasSuccess;
+
+    coreblas_complex64_t zzero = 0.0;
+    coreblas_complex64_t zone  = 1.0;
+    coreblas_complex64_t mzone = -1.0;
+    coreblas_complex64_t mhalf = -0.5;
+
+    // The blocks are applied first to last, as Q^H C Q = ... H_2^H H_1^H C
+    // H_1 H_2 ... with H_i = I - V_i T_i V_i^H; for the rows of gelqt,
+    // V_i is the conjugate transpose of the rows and Q^H plays this role.
+    coreblas_complex64_t *V = work;
+    coreblas_complex64_t *X = &work[(size_t)n*ib];
+    coreblas_complex64_t *M = &work[2*(size_t)n*ib];
+    for (int i = 0; i < k; i += ib) {
+        int kb = imin(ib, k-i);
+        int nn = n-i;
+
+        // V is the nn-by-kb unit lower trapezoid of the block,
+        // with its zeros and ones explicit.
+        for (int j = 0; j < kb; j++) {
+            for (int l = 0; l < j; l++)
+                V[l + (size_t)nn*j] = zzero;
+            V[j + (size_t)nn*j] = zone;
+            if (uplo == CoreBlasLower) {
+                for (int l = j+1; l < nn; l++)
+                    V[l + (size_t)nn*j] = A[(i+l) + (size_t)lda*(i+j)];
+            }
+            else {
+                for (int l = j+1; l < nn; l++)
+                    V[l + (size_t)nn*j] = conj(A[(i+j) + (size_t)lda*(i+l)]);
+            }
+        }
+        coreblas_complex64_t *C22 = &C[(size_t)ldc*i+i];
+        const coreblas_complex64_t *Ti = &T[(size_t)ldt*i];
+
+        // The block of the stored triangle left of (above) C22 is only
+        // multiplied from one side: C21 = H^H C21 or C12 = C12 H.
+        if (i > 0) {
+            if (uplo == CoreBlasLower) {
+                coreblas_complex64_t *C21 = &C[i];
+                coreblas_zgemm(CoreBlasConjTrans, CoreBlasNoTrans,
+                               kb, i, nn,
+                               zone, V,   nn,
+                                     C21, ldc,
+                               zzero, X,  kb);
+                coreblas_ztrmm(CoreBlasLeft, CoreBlasUpper,
+                               CoreBlasConjTrans, CoreBlasNonUnit,
+                               kb, i, zone, Ti, ldt, X, kb);
+                coreblas_zgemm(CoreBlasNoTrans, CoreBlasNoTrans,
+                               nn, i, kb,
+                               mzone, V,   nn,
+                                      X,   kb,
+                               zone,  C21, ldc);
+            }
+            else {
+                coreblas_complex64_t *C12 = &C[(size_t)ldc*i];
+                coreblas_zgemm(CoreBlasNoTrans, CoreBlasNoTrans,
+                               i, kb, nn,
+                               zone, C12, ldc,
+                                     V,   nn,
+                               zzero, X,  i);
+                coreblas_ztrmm(CoreBlasRight, CoreBlasUpper,
+                               CoreBlasNoTrans, CoreBlasNonUnit,
+                               i, kb, zone, Ti, ldt, X, i);
+                coreblas_zgemm(CoreBlasNoTrans, CoreBlasConjTrans,
+                               i, nn, kb,
+                               mzone, X,   i,
+                                      V,   nn,
+                               zone,  C12, ldc);
+            }
+        }
+
+        // X = C V T
+        coreblas_zhemm(CoreBlasLeft, uplo, nn, kb,
+                       zone, C22, ldc,
+                             V,   nn,
+                       zzero, X,  nn);
+        coreblas_ztrmm(CoreBlasRight, CoreBlasUpper,
+                       CoreBlasNoTrans, CoreBlasNonUnit,
+                       nn, kb, zone, Ti, ldt, X, nn);
+
+        // M = T^H V^H X
+        coreblas_zgemm(CoreBlasConjTrans, CoreBlasNoTrans,
+                       kb, kb, nn,
+                       zone, V, nn,
+                             X, nn,
+                       zzero, M, kb);
+        coreblas_ztrmm(CoreBlasLeft, CoreBlasUpper,
+                       CoreBlasConjTrans, CoreBlasNonUnit,
+                       kb, kb, zone, Ti, ldt, M, kb);
+
+        // W = X - 1/2 V M, in X
+        coreblas_zgemm(CoreBlasNoTrans, CoreBlasNoTrans,
+                       nn, kb, kb,
+                       mhalf, V, nn,
+                              M, kb,
+                       zone,  X, nn);
+
+        // C = C - V W^H - W V^H
+        coreblas_zher2k(uplo, CoreBlasNoTrans,
+                        nn, kb,
+                        mzone, V, nn,
+                               X, nn,
+                        1.0,   C22, ldc);
+    }
+
+    return CoreBlasSuccess;
+}
+
+/***************************************************************************//**
+ *
+ * @ingroup core_herfb
+ *
+ *  Returns the minimum length of the array work of coreblas_zherfb
+ *  for the given dimensions: the explicit reflectors and the product
+ *  C V T, both n-by-ib, followed by ib-by-ib elements.
+ *
+ *******************************************************************************
+ *
+ * @param[in] n
+ *         The order of the tile C.
+ *
+ * @param[in] ib
+ *         The inner-blocking size.
+ *
+ *******************************************************************************
+ *
+ * @retval the length of work, at least 1.
+ *
+ ******************************************************************************/
+size_t coreblas_zherfb_lwork(int n, int ib)
+{
+    size_t sn  = (size_t)imax(1, n);
+    size_t sib = (size_t)imax(1, ib);
+    return 2*sn*sib + sib*sib;
+}
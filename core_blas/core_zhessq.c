@@ -12,6 +12,7 @@
 
 #include <coreblas.h>
 #include "coreblas_types.h"
+#include "coreblas_internal.h"
 #include "core_lapack.h"
 
 #include <math.h>
@@ -25,28 +26,18 @@ void coreblas_zhessq(coreblas_enum_t uplo,
 {
     *scale = 0.0;
     *sumsq = 1.0;
-    int ione = 1;
+
+    // The off-diagonal part is accumulated in one pass and counted twice.
+    double acc[3] = {0.0, 0.0, 0.0};
     if (uplo == CoreBlasUpper) {
         for (int j = 1; j < n; j++)
-            // TODO: Inline this operation.
-            #ifdef COREBLAS_USE_64BIT_BLAS
-                LAPACK_zlassq64_(&j, &A[lda*j], &ione, scale, sumsq);
-            #else
-                LAPACK_zlassq(&j, &A[lda*j], &ione, scale, sumsq);
-            #endif
-            
+            coreblas_zssq_update(j, &A[lda*j], acc);
     }
     else { // CoreBlasLower
-        for (int j = 0; j < n-1; j++) {
-            int len = n-j-1;
-            // TODO: Inline this operation.
-            #ifdef COREBLAS_USE_64BIT_BLAS
-                LAPACK_zlassq64_(&len, &A[lda*j+j+1], &ione, scale, sumsq);
-            #else
-                LAPACK_zlassq(&len, &A[lda*j+j+1], &ione, scale, sumsq);
-            #endif
-        }
+        for (int j = 0; j < n-1; j++)
+            coreblas_zssq_update(n-j-1, &A[lda*j+j+1], acc);
     }
+    coreblas_zssq_finish(acc, scale, sumsq);
     *sumsq *= 2.0;
     for (int i = 0; i < n; i++) {
         // diagonal is real, ignore imaginary part
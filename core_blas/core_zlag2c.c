@@ -11,15 +11,27 @@
  **/
 
 #include <coreblas.h>
-#include "core_lapack.h"
 #include "coreblas_types.h"
 
+#include <float.h>
+#include <math.h>
+
+// This will be swapped during the automatic code generation.
+#undef REAL
+#define COMPLEX
+
 /***************************************************************************//**
  *
  * @ingroup core_lag2
  *
  *  Converts m-by-n matrix A from double complex to single complex precision.
  *
+ *  As LAPACK's zlag2c, checks that no real or imaginary part overflows in
+ *  single precision, so that a mixed precision solver can keep in double
+ *  precision the tiles that do not fit in single precision. Every column
+ *  is converted in one vectorized pass, the real and imaginary parts as
+ *  one real array.
+ *
  *******************************************************************************
  *
  * @param[in] m
@@ -44,18 +56,36 @@
  *          The leading dimension of the matrix As.
  *          ldas >= max(1,m).
  *
+ *******************************************************************************
+ *
+ * @retval 0 successful exit
+ * @retval 1 an element of A is larger than the overflow threshold of single
+ *           precision; As is then only partly converted.
+ *
  ******************************************************************************/
 __attribute__((weak))
 int coreblas_zlag2c(int m, int n,
                  coreblas_complex64_t *A,  int lda,
                  coreblas_complex32_t *As, int ldas)
 {
-    int info;
-    #ifdef COREBLAS_USE_64BIT_BLAS
-        info = LAPACKE_zlag2c64_(LAPACK_COL_MAJOR, m, n, A, lda, As, ldas);
-    #else
-        info = LAPACKE_zlag2c_work(LAPACK_COL_MAJOR, m, n, A, lda, As, ldas);
-    #endif
-
-    return info;
-}
\ No newline at end of file
+#ifdef COMPLEX
+    int mr = 2*m;
+#else
+    int mr = m;
+#endif
+    for (int j = 0; j < n; j++) {
+        const double *a = (const double*)&A[(size_t)lda*j];
+        float *as = (float*)&As[(size_t)ldas*j];
+        // A maximum vectorizes, unlike an integer flag next to doubles.
+        double amax = 0.0;
+        #pragma omp simd reduction(max:amax)
+        for (int i = 0; i < mr; i++) {
+            as[i] = (float)a[i];
+            double absa = fabs(a[i]);
+            amax = absa > amax ? absa : amax;
+        }
+        if (amax > FLT_MAX)
+            return 1;
+    }
+    return 0;
+}
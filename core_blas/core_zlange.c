@@ -12,6 +12,7 @@
 
 #include <coreblas.h>
 #include "coreblas_types.h"
+#include "coreblas_internal.h"
 #include "core_lapack.h"
 
 #include <math.h>
@@ -74,22 +75,42 @@ void coreblas_zlange_aux(coreblas_enum_t norm, int m, int n,
 {
     switch (norm) {
     case CoreBlasOneNorm:
-        for (int j = 0; j < n; j++) {
-            value[j] = cabs(A[lda*j]);
-            for (int i = 1; i < m; i++) {
-                value[j] += cabs(A[lda*j+i]);
-            }
-        }
+        for (int j = 0; j < n; j++)
+            value[j] = coreblas_zabsum(m, &A[lda*j], NULL);
         break;
     case CoreBlasInfNorm:
         for (int i = 0; i < m; i++)
             value[i] = 0.0;
-        for (int j = 0; j < n; j++) {
-            for (int i = 0; i < m; i++) {
-                value[i] += cabs(A[lda*j+i]);
-            }
-        }
-
+        for (int j = 0; j < n; j++)
+            coreblas_zabsum_add(m, &A[lda*j], value);
         break;
     }
-}
\ No newline at end of file
+}
+
+/***************************************************************************//**
+ *
+ * @ingroup core_lange
+ *
+ *  Returns the minimum length of the array work of coreblas_zlange
+ *  for the given dimensions, in elements of type double.
+ *
+ *******************************************************************************
+ *
+ * @param[in] norm
+ *         The norm to compute.
+ *
+ * @param[in] m
+ *         The number of rows of the matrix A.
+ *
+ * @param[in] n
+ *         The number of columns of the matrix A.
+ *
+ *******************************************************************************
+ *
+ * @retval the length of work, at least 1.
+ *
+ ******************************************************************************/
+size_t coreblas_zlange_lwork(coreblas_enum_t norm, int m, int n)
+{
+    return norm == CoreBlasInfNorm ? imax(1, m) : 1;
+}
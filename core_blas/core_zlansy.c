@@ -12,6 +12,7 @@
 
 #include <coreblas.h>
 #include "coreblas_types.h"
+#include "coreblas_internal.h"
 #include "core_lapack.h"
 
 #include <math.h>
@@ -46,28 +47,48 @@ void coreblas_zlansy_aux(coreblas_enum_t norm, coreblas_enum_t uplo,
     switch (norm) {
     case CoreBlasOneNorm:
     case CoreBlasInfNorm:
+        // The elements off the diagonal count in their row and column.
+        for (int i = 0; i < n; i++)
+            value[i] = 0.0;
         if (uplo == CoreBlasUpper) {
-            for (int i = 0; i < n; i++)
-                value[i] = 0.0;
             for (int j = 0; j < n; j++) {
-                for (int i = 0; i < j; i++) {
-                    value[i] += cabs(A[lda*j+i]);
-                    value[j] += cabs(A[lda*j+i]);
-                }
+                value[j] += coreblas_zabsum(j, &A[lda*j], value);
                 value[j] += cabs(A[lda*j+j]);
             }
         }
         else { // CoreBlasLower
-            for (int i = 0; i < n; i++)
-                value[i] = 0.0;
             for (int j = 0; j < n; j++) {
                 value[j] += cabs(A[lda*j+j]);
-                for (int i = j+1; i < n; i++) {
-                    value[i] += cabs(A[lda*j+i]);
-                    value[j] += cabs(A[lda*j+i]);
-                }
+                value[j] += coreblas_zabsum(n-j-1, &A[lda*j+j+1],
+                                            &value[j+1]);
             }
         }
         break;
     }
-}
\ No newline at end of file
+}
+
+/***************************************************************************//**
+ *
+ * @ingroup core_lansy
+ *
+ *  Returns the minimum length of the array work of coreblas_zlansy
+ *  for the given dimensions, in elements of type double.
+ *
+ *******************************************************************************
+ *
+ * @param[in] norm
+ *         The norm to compute.
+ *
+ * @param[in] n
+ *         The order of the matrix A.
+ *
+ *******************************************************************************
+ *
+ * @retval the length of work, at least 1.
+ *
+ ******************************************************************************/
+size_t coreblas_zlansy_lwork(coreblas_enum_t norm, int n)
+{
+    return (norm == CoreBlasOneNorm || norm == CoreBlasInfNorm) ?
+           imax(1, n) : 1;
+}
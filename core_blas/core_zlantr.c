@@ -54,49 +54,30 @@ void coreblas_zlantr_aux(coreblas_enum_t norm, coreblas_enum_t uplo,
     case CoreBlasOneNorm:
         if (uplo == CoreBlasUpper) {
             if (diag == CoreBlasNonUnit) {
-                for (int j = 0; j < n; j++) {
-                    value[j] = cabs(A[lda*j]);
-                    for (int i = 1; i < imin(j+1, m); i++) {
-                        value[j] += cabs(A[lda*j+i]);
-                    }
-                }
+                for (int j = 0; j < n; j++)
+                    value[j] = coreblas_zabsum(imin(j+1, m), &A[lda*j], NULL);
             }
             else { // CoreBlasUnit
                 int j;
-                for (j = 0; j < imin(n, m); j++) {
-                    value[j] = 1.0;
-                    for (int i = 0; i < j; i++) {
-                        value[j] += cabs(A[lda*j+i]);
-                    }
-                }
-                for (; j < n; j++) {
-                    value[j] = cabs(A[lda*j]);
-                    for (int i = 1; i < m; i++) {
-                        value[j] += cabs(A[lda*j+i]);
-                    }
-                }
+                for (j = 0; j < imin(n, m); j++)
+                    value[j] = 1.0 + coreblas_zabsum(j, &A[lda*j], NULL);
+                for (; j < n; j++)
+                    value[j] = coreblas_zabsum(m, &A[lda*j], NULL);
             }
         }
         else { // CoreBlasLower
             if (diag == CoreBlasNonUnit) {
                 int j;
-                for (j = 0; j < imin(n, m); j++) {
-                    value[j] = cabs(A[lda*j+j]);
-                    for (int i = j+1; i < m; i++) {
-                        value[j] += cabs(A[lda*j+i]);
-                    }
-                }
+                for (j = 0; j < imin(n, m); j++)
+                    value[j] = coreblas_zabsum(m-j, &A[lda*j+j], NULL);
                 for (; j < n; j++)
                     value[j] = 0.0;
             }
             else { // CoreBlasUnit
                 int j;
-                for (j = 0; j < imin(n, m); j++) {
-                    value[j] = 1.0;
-                    for (int i = j+1; i < m; i++) {
-                        value[j] += cabs(A[lda*j+i]);
-                    }
-                }
+                for (j = 0; j < imin(n, m); j++)
+                    value[j] = 1.0 + coreblas_zabsum(m-j-1, &A[lda*j+j+1],
+                                                     NULL);
                 for (; j < n; j++)
                     value[j] = 0.0;
             }
@@ -107,11 +88,8 @@ void coreblas_zlantr_aux(coreblas_enum_t norm, coreblas_enum_t uplo,
             if (diag == CoreBlasNonUnit) {
                 for (int i = 0; i < m; i++)
                     value[i] = 0.0;
-                for (int j = 0; j < n; j++) {
-                    for (int i = 0; i < imin(j+1, m); i++) {
-                        value[i] += cabs(A[lda*j+i]);
-                    }
-                }
+                for (int j = 0; j < n; j++)
+                    coreblas_zabsum_add(imin(j+1, m), &A[lda*j], value);
             }
             else { // CoreBlasUnit
                 int i;
@@ -120,27 +98,18 @@ void coreblas_zlantr_aux(coreblas_enum_t norm, coreblas_enum_t uplo,
                 for (; i < m; i++)
                     value[i] = 0.0;
                 int j;
-                for (j = 0; j < imin(n, m); j++) {
-                    for (i = 0; i < j; i++) {
-                        value[i] += cabs(A[lda*j+i]);
-                    }
-                }
-                for (; j < n; j++) {
-                    for (i = 0; i < m; i++) {
-                        value[i] += cabs(A[lda*j+i]);
-                    }
-                }
+                for (j = 0; j < imin(n, m); j++)
+                    coreblas_zabsum_add(j, &A[lda*j], value);
+                for (; j < n; j++)
+                    coreblas_zabsum_add(m, &A[lda*j], value);
             }
         }
         else { // CoreBlasLower
             if (diag == CoreBlasNonUnit) {
                 for (int i = 0; i < m; i++)
                     value[i] = 0.0;
-                for (int j = 0; j < imin(n, m); j++) {
-                    for (int i = j; i < m; i++) {
-                        value[i] += cabs(A[lda*j+i]);
-                    }
-                }
+                for (int j = 0; j < imin(n, m); j++)
+                    coreblas_zabsum_add(m-j, &A[lda*j+j], &value[j]);
             }
             else { // CoreBlasUnit
                 int i;
@@ -148,13 +117,38 @@ void coreblas_zlantr_aux(coreblas_enum_t norm, coreblas_enum_t uplo,
                     value[i] = 1.0;
                 for (; i < m; i++)
                     value[i] = 0.0;
-                for (int j = 0; j < imin(n, m); j++) {
-                    for (i = j+1; i < m; i++) {
-                        value[i] += cabs(A[lda*j+i]);
-                    }
-                }
+                for (int j = 0; j < imin(n, m); j++)
+                    coreblas_zabsum_add(m-j-1, &A[lda*j+j+1], &value[j+1]);
             }
         }
         break;
     }
 }
+
+/***************************************************************************//**
+ *
+ * @ingroup core_lantr
+ *
+ *  Returns the minimum length of the array work of coreblas_zlantr
+ *  for the given dimensions, in elements of type double.
+ *
+ *******************************************************************************
+ *
+ * @param[in] norm
+ *         The norm to compute.
+ *
+ * @param[in] m
+ *         The number of rows of the matrix A.
+ *
+ * @param[in] n
+ *         The number of columns of the matrix A.
+ *
+ *******************************************************************************
+ *
+ * @retval the length of work, at least 1.
+ *
+ ******************************************************************************/
+size_t coreblas_zlantr_lwork(coreblas_enum_t norm, int m, int n)
+{
+    return norm == CoreBlasInfNorm ? imax(1, m) : 1;
+}
@@ -12,6 +12,7 @@
 
 #include "coreblas.h"
 #include "coreblas_types.h"
+#include "coreblas_internal.h"
 #include "core_lapack.h"
 
 /***************************************************************************//**
@@ -21,12 +22,18 @@
  *  CORE_zlarfb_gemm applies a complex block reflector H or its transpose H'
  *  to a complex M-by-N matrix C, from either the left or the right.
  *  this kernel is similar to the lapack zlarfb but it do a full gemm on the
- *  triangular Vs assuming that the upper part of Vs is zero and ones are on
- *  the diagonal. It is also based on the fact that a gemm on a small block of
- *  k reflectors is faster than a trmm on the triangular (k,k) + gemm below.
+ *  triangular Vs assuming that the zeros and the unit diagonal of Vs are
+ *  stored explicitly. It is also based on the fact that a gemm on a small
+ *  block of k reflectors is faster than a trmm on the triangular (k,k) +
+ *  gemm below. Every case is computed as W = C op(V), W = W op(T),
+ *  C = C - op(V) W.
  *
- *  NOTE THAT:
- *  Only Columnwise/Forward cases are treated here.
+ *  The triangular block of V must then hold:
+ *  - Columnwise/Forward:  a unit lower triangle in its first K rows,
+ *  - Columnwise/Backward: a unit upper triangle in its last K rows,
+ *  - Rowwise/Forward:     a unit upper triangle in its first K columns,
+ *  - Rowwise/Backward:    a unit lower triangle in its last K columns,
+ *  with zeros on the other side of the diagonal.
  *
  *******************************************************************************
  *
@@ -76,7 +83,8 @@
  * @param[in] T
  *         The triangular K-by-K matrix T in the representation of the
  *         block reflector.
- *         T is upper triangular by block (economic storage);
+ *         T is upper triangular if direct = CoreBlasForward and lower
+ *         triangular if direct = CoreBlasBackward.
  *         The rest of the array is not referenced.
  *
  * @param[in] LDT
@@ -134,132 +142,295 @@ int coreblas_zlarfb_gemm(coreblas_enum_t side, coreblas_enum_t trans, int direct
         }
     }
 
+    // T is upper triangular for a forward product of reflectors
+    // and lower triangular for a backward one.
+    coreblas_enum_t uplo = (direct == CoreBlasForward) ? CoreBlasUpper
+                                                       : CoreBlasLower;
+
     // main code //
-    if (storev == CoreBlasColumnwise )
-    {
-        if ( direct == CoreBlasForward )
-        {
+    if (storev == CoreBlasColumnwise) {
+        /*
+         * Let  V =  ( V1 )    Forward:  first K rows are unit lower triangular
+         *           ( V2 )    Backward: last K rows are unit upper triangular
+         */
+        if (side == CoreBlasLeft) {
+            /*
+             * Columnwise / Left
+             * Form  H * C  or  H' * C
+             *
+             * W := C' * V    (stored in WORK)
+             */
+            coreblas_zgemm(CoreBlas_ConjTrans, CoreBlasNoTrans,
+                           N, K, M,
+                           zone,  C, LDC,
+                                  V, LDV,
+                           zzero, WORK, LDWORK);
+            /*
+             * W := W * T'  or  W * T
+             */
+            coreblas_ztrmm(CoreBlasRight, uplo, trans, CoreBlasNonUnit,
+                           N, K,
+                           zone, T, LDT, WORK, LDWORK);
             /*
-             * Let  V =  ( V1 )    (first K rows are unit Lower triangular)
-             *           ( V2 )
+             * C := C - V * W'
              */
-            if ( side == CoreBlasLeft )
-            {
-                /*
-                 * Columnwise / Forward / Left
-                 */
-                /*
-                 * Form  H * C  or  H' * C  where  C = ( C1 )
-                 *                                     ( C2 )
-                 *
-                 * W := C' * V    (stored in WORK)
-                 */
-                #ifdef COREBLAS_USE_64BIT_BLAS
-                        cblas_zgemm64_(
-                            CblasColMajor, CblasConjTrans, CblasNoTrans,
-                            N, K, M,
-                            CBLAS_SADDR(zone), C, LDC,
-                            V, LDV,
-                            CBLAS_SADDR(zzero), WORK, LDWORK );
-                        /*
-                         * W := W * T'  or  W * T
-                         */
-                        cblas_ztrmm64_(
-                            CblasColMajor, CblasRight, CblasUpper,
-                            (CBLAS_TRANSPOSE)trans, CblasNonUnit, N, K,
-                            CBLAS_SADDR(zone), T, LDT, WORK, LDWORK );
-                        /*
-                         * C := C - V * W'
-                         */
-                        cblas_zgemm64_(
-                            CblasColMajor, CblasNoTrans, CblasConjTrans,
-                            M, N, K,
-                            CBLAS_SADDR(mzone), V, LDV,
-                            WORK, LDWORK,
-                            CBLAS_SADDR(zone), C, LDC);
-                #else
-                        cblas_zgemm(
-                            CblasColMajor, CblasConjTrans, CblasNoTrans,
-                            N, K, M,
-                            CBLAS_SADDR(zone), C, LDC,
-                            V, LDV,
-                            CBLAS_SADDR(zzero), WORK, LDWORK );
-                        /*
-                         * W := W * T'  or  W * T
-                         */
-                        cblas_ztrmm(
-                            CblasColMajor, CblasRight, CblasUpper,
-                            (CBLAS_TRANSPOSE)trans, CblasNonUnit, N, K,
-                            CBLAS_SADDR(zone), T, LDT, WORK, LDWORK );
-                        /*
-                         * C := C - V * W'
-                         */
-                        cblas_zgemm(
-                            CblasColMajor, CblasNoTrans, CblasConjTrans,
-                            M, N, K,
-                            CBLAS_SADDR(mzone), V, LDV,
-                            WORK, LDWORK,
-                            CBLAS_SADDR(zone), C, LDC);
-                #endif
-            }
-            else {
-                /*
-                 * Columnwise / Forward / Right
-                 */
-                /*
-                 * Form  C * H  or  C * H'  where  C = ( C1  C2 )
-                 * W := C * V
-                 */
-                #ifdef COREBLAS_USE_64BIT_BLAS
-                #else
-                #endif
-                cblas_zgemm(
-                    CblasColMajor, CblasNoTrans, CblasNoTrans,
-                    M, K, N,
-                    CBLAS_SADDR(zone), C, LDC,
-                    V, LDV,
-                    CBLAS_SADDR(zzero), WORK, LDWORK);
-                /*
-                 * W := W * T  or  W * T'
-                 */
-                cblas_ztrmm(
-                    CblasColMajor, CblasRight, CblasUpper,
-                    (CBLAS_TRANSPOSE)trans, CblasNonUnit, M, K,
-                    CBLAS_SADDR(zone), T, LDT, WORK, LDWORK );
-                /*
-                 * C := C - W * V'
-                 */
-                cblas_zgemm(
-                    CblasColMajor, CblasNoTrans, CblasConjTrans,
-                    M, N, K,
-                    CBLAS_SADDR(mzone), WORK, LDWORK,
-                    V, LDV,
-                    CBLAS_SADDR(zone), C, LDC);
-            }
+            coreblas_zgemm(CoreBlasNoTrans, CoreBlas_ConjTrans,
+                           M, N, K,
+                           mzone, V, LDV,
+                                  WORK, LDWORK,
+                           zone,  C, LDC);
         }
         else {
             /*
-             * Columnwise / Backward / Left or Right
+             * Columnwise / Right
+             * Form  C * H  or  C * H'
+             *
+             * W := C * V
              */
-            //coreblas_error(3, "Not implemented (ColMajor / Backward / Left or Right)");
-            return CoreBlasErrorNotSupported;
+            coreblas_zgemm(CoreBlasNoTrans, CoreBlasNoTrans,
+                           M, K, N,
+                           zone,  C, LDC,
+                                  V, LDV,
+                           zzero, WORK, LDWORK);
+            /*
+             * W := W * T  or  W * T'
+             */
+            coreblas_ztrmm(CoreBlasRight, uplo, trans, CoreBlasNonUnit,
+                           M, K,
+                           zone, T, LDT, WORK, LDWORK);
+            /*
+             * C := C - W * V'
+             */
+            coreblas_zgemm(CoreBlasNoTrans, CoreBlas_ConjTrans,
+                           M, N, K,
+                           mzone, WORK, LDWORK,
+                                  V, LDV,
+                           zone,  C, LDC);
         }
     }
     else {
-        if (direct == CoreBlasForward) {
+        /*
+         * Let  V =  ( V1  V2 )    Forward:  first K columns are unit upper
+         *                                   triangular
+         *                         Backward: last K columns are unit lower
+         *                                   triangular
+         */
+        if (side == CoreBlasLeft) {
+            /*
+             * Rowwise / Left
+             * Form  H * C  or  H' * C
+             *
+             * W := C' * V'    (stored in WORK)
+             */
+            coreblas_zgemm(CoreBlas_ConjTrans, CoreBlas_ConjTrans,
+                           N, K, M,
+                           zone,  C, LDC,
+                                  V, LDV,
+                           zzero, WORK, LDWORK);
+            /*
+             * W := W * T'  or  W * T
+             */
+            coreblas_ztrmm(CoreBlasRight, uplo, trans, CoreBlasNonUnit,
+                           N, K,
+                           zone, T, LDT, WORK, LDWORK);
             /*
-             * Rowwise / Forward / Left or Right
+             * C := C - V' * W'
              */
-            //coreblas_error(3, "Not implemented (RowMajor / Backward / Left or Right)");
-            return CoreBlasErrorNotSupported;;
+            coreblas_zgemm(CoreBlas_ConjTrans, CoreBlas_ConjTrans,
+                           M, N, K,
+                           mzone, V, LDV,
+                                  WORK, LDWORK,
+                           zone,  C, LDC);
         }
         else {
             /*
-             * Rowwise / Backward / Left or Right
+             * Rowwise / Right
+             * Form  C * H  or  C * H'
+             *
+             * W := C * V'
+             */
+            coreblas_zgemm(CoreBlasNoTrans, CoreBlas_ConjTrans,
+                           M, K, N,
+                           zone,  C, LDC,
+                                  V, LDV,
+                           zzero, WORK, LDWORK);
+            /*
+             * W := W * T  or  W * T'
              */
-            //coreblas_error(3, "Not implemented (RowMajor / Backward / Left or Right)");
-            return CoreBlasErrorNotSupported;
+            coreblas_ztrmm(CoreBlasRight, uplo, trans, CoreBlasNonUnit,
+                           M, K,
+                           zone, T, LDT, WORK, LDWORK);
+            /*
+             * C := C - W * V
+             */
+            coreblas_zgemm(CoreBlasNoTrans, CoreBlasNoTrans,
+                           M, N, K,
+                           mzone, WORK, LDWORK,
+                                  V, LDV,
+                           zone,  C, LDC);
+        }
+    }
+    return CoreBlasSuccess;
+}
+
+/***************************************************************************//**
+ *
+ * @ingroup CORE_coreblas_Complex64_t
+ *
+ *  Same as coreblas_zlarfb_gemm for direct = CoreBlasForward and
+ *  storev = CoreBlasRowwise, but with V = ( V1  V2 ) passed as two blocks:
+ *  the K-by-K unit upper triangle V1, with its zeros and unit diagonal
+ *  stored explicitly, and the rest V2 of the K rows. This lets coreblas_zunmlq
+ *  copy only V1 and read V2 in place from its tile. Every product is a gemm.
+ *
+ ******************************************************************************/
+int coreblas_zlarfb_gemm_split(coreblas_enum_t side, coreblas_enum_t trans,
+                     int M, int N, int K,
+                     const coreblas_complex64_t *V1, int LDV1,
+                     const coreblas_complex64_t *V2, int LDV2,
+                     const coreblas_complex64_t *T, int LDT,
+                     coreblas_complex64_t *C, int LDC,
+                     coreblas_complex64_t *WORK, int LDWORK)
+{
+    static coreblas_complex64_t zzero =  0.0;
+    static coreblas_complex64_t zone  =  1.0;
+    static coreblas_complex64_t mzone = -1.0;
+
+    // Quick return //
+    if ((M == 0) || (N == 0) || (K == 0) )
+        return CoreBlasSuccess;
+
+    /* For Left case, switch the trans. noswitch for right case */
+    if( side == CoreBlasLeft){
+        if ( trans == CoreBlasNoTrans) {
+            trans = CoreBlasConjTrans;
+        }
+        else {
+            trans = CoreBlasNoTrans;
+        }
+    }
+
+    if (side == CoreBlasLeft) {
+        /*
+         * Rowwise / Left
+         * Form  H * C  or  H' * C  where  C = ( C1 )
+         *                                     ( C2 )
+         *
+         * W := C1' * V1' + C2' * V2'    (stored in WORK)
+         */
+        coreblas_zgemm(CoreBlas_ConjTrans, CoreBlas_ConjTrans,
+                       N, K, K,
+                       zone,  C, LDC,
+                              V1, LDV1,
+                       zzero, WORK, LDWORK);
+        if (M > K) {
+            coreblas_zgemm(CoreBlas_ConjTrans, CoreBlas_ConjTrans,
+                           N, K, M-K,
+                           zone, &C[K], LDC,
+                                 V2, LDV2,
+                           zone, WORK, LDWORK);
+        }
+        /*
+         * W := W * T'  or  W * T
+         */
+        coreblas_ztrmm(CoreBlasRight, CoreBlasUpper, trans, CoreBlasNonUnit,
+                       N, K,
+                       zone, T, LDT, WORK, LDWORK);
+        /*
+         * C1 := C1 - V1' * W'
+         * C2 := C2 - V2' * W'
+         */
+        coreblas_zgemm(CoreBlas_ConjTrans, CoreBlas_ConjTrans,
+                       K, N, K,
+                       mzone, V1, LDV1,
+                              WORK, LDWORK,
+                       zone,  C, LDC);
+        if (M > K) {
+            coreblas_zgemm(CoreBlas_ConjTrans, CoreBlas_ConjTrans,
+                           M-K, N, K,
+                           mzone, V2, LDV2,
+                                  WORK, LDWORK,
+                           zone,  &C[K], LDC);
+        }
+    }
+    else {
+        /*
+         * Rowwise / Right
+         * Form  C * H  or  C * H'  where  C = ( C1  C2 )
+         *
+         * W := C1 * V1' + C2 * V2'    (stored in WORK)
+         */
+        coreblas_zgemm(CoreBlasNoTrans, CoreBlas_ConjTrans,
+                       M, K, K,
+                       zone,  C, LDC,
+                              V1, LDV1,
+                       zzero, WORK, LDWORK);
+        if (N > K) {
+            coreblas_zgemm(CoreBlasNoTrans, CoreBlas_ConjTrans,
+                           M, K, N-K,
+                           zone, &C[LDC*K], LDC,
+                                 V2, LDV2,
+                           zone, WORK, LDWORK);
+        }
+        /*
+         * W := W * T  or  W * T'
+         */
+        coreblas_ztrmm(CoreBlasRight, CoreBlasUpper, trans, CoreBlasNonUnit,
+                       M, K,
+                       zone, T, LDT, WORK, LDWORK);
+        /*
+         * C1 := C1 - W * V1
+         * C2 := C2 - W * V2
+         */
+        coreblas_zgemm(CoreBlasNoTrans, CoreBlasNoTrans,
+                       M, K, K,
+                       mzone, WORK, LDWORK,
+                              V1, LDV1,
+                       zone,  C, LDC);
+        if (N > K) {
+            coreblas_zgemm(CoreBlasNoTrans, CoreBlasNoTrans,
+                           M, N-K, K,
+                           mzone, WORK, LDWORK,
+                                  V2, LDV2,
+                           zone,  &C[LDC*K], LDC);
         }
     }
     return CoreBlasSuccess;
 }
+
+/***************************************************************************//**
+ *
+ * @ingroup CORE_coreblas_Complex64_t
+ *
+ *  Returns the minimum length of the array work of coreblas_zlarfb_gemm
+ *  for the given dimensions.
+ *  The leading dimension is LDWORK = max(1,N) on the left
+ *  and LDWORK = max(1,M) on the right.
+ *
+ *******************************************************************************
+ *
+ * @param[in] side
+ *         - CoreBlasLeft  : apply from the Left;
+ *         - CoreBlasRight : apply from the Right.
+ *
+ * @param[in] M
+ *         The number of rows of the matrix C.
+ *
+ * @param[in] N
+ *         The number of columns of the matrix C.
+ *
+ * @param[in] K
+ *         The order of the matrix T.
+ *
+ *******************************************************************************
+ *
+ * @retval the length of work, at least 1.
+ *
+ ******************************************************************************/
+size_t coreblas_zlarfb_gemm_lwork(coreblas_enum_t side, int M, int N, int K)
+{
+    if (side == CoreBlasLeft)
+        return imax(1, N)*(size_t)imax(1, K);
+    else
+        return imax(1, M)*(size_t)imax(1, K);
+}
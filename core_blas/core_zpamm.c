@@ -30,6 +30,23 @@ static inline int coreblas_zpamm_w(coreblas_enum_t side, coreblas_enum_t trans,
                                const coreblas_complex64_t *V,  int ldv,
                                      coreblas_complex64_t *W,  int ldw);
 
+static inline int coreblas_zpamm_a2_backward(
+                                coreblas_enum_t side, coreblas_enum_t trans,
+                                coreblas_enum_t uplo,
+                                int m, int n, int k, int l, int vi1, int vi2,
+                                      coreblas_complex64_t *A2, int lda2,
+                                const coreblas_complex64_t *V,  int ldv,
+                                      coreblas_complex64_t *W,  int ldw);
+
+static inline int coreblas_zpamm_w_backward(
+                               coreblas_enum_t side, coreblas_enum_t trans,
+                               coreblas_enum_t uplo,
+                               int m, int n, int k, int l, int vi1, int vi2,
+                               const coreblas_complex64_t *A1, int lda1,
+                                     coreblas_complex64_t *A2, int lda2,
+                               const coreblas_complex64_t *V,  int ldv,
+                                     coreblas_complex64_t *W,  int ldw);
+
 /***************************************************************************//**
  *
  * @ingroup core_pamm
@@ -88,6 +105,21 @@ static inline int coreblas_zpamm_w(coreblas_enum_t side, coreblas_enum_t trans,
  *                                                    \  |    |  L
  *                                               _      \|____|  _
  *
+ *  For CoreBlasBackward, V is stored as for CoreBlasForward, reversed in
+ *  both dimensions: the triangle lies in the first L rows of A2's side and
+ *  the last L reflectors, e.g., on the left and columnwise:
+ *
+ *              |    K    |
+ *           _  __________   _
+ *              |    |\   |  L
+ *     V:       |    |  \ |
+ *              |    |    \  _
+ *           M  |    |    |
+ *              |    |    |  M-L
+ *           _  |____|____|  _
+ *
+ *              | K-L | L |
+ *
  *  Arguments
  *  ==========
  *
@@ -111,6 +143,14 @@ static inline int coreblas_zpamm_w(coreblas_enum_t side, coreblas_enum_t trans,
  *                            OP CoreBlasW  :  W  = A1 + A2 * op(V)
  *                            OP CoreBlasA2 :  A2 = A2 - W * op(V)
  *
+ * @param[in] direct
+ *
+ *         Indicates how the block reflector is formed and hence where the
+ *         triangle of V lies:
+ *
+ *         - CoreBlasForward
+ *         - CoreBlasBackward
+ *
  * @param[in] storev
  *
  *         Indicates how the vectors which define the elementary
@@ -170,13 +210,15 @@ static inline int coreblas_zpamm_w(coreblas_enum_t side, coreblas_enum_t trans,
  *
  ******************************************************************************/
 __attribute__((weak))
-int coreblas_zpamm(coreblas_enum_t op, coreblas_enum_t side, coreblas_enum_t storev,
+int coreblas_zpamm_direct(coreblas_enum_t op, coreblas_enum_t side,
+               coreblas_enum_t direct, coreblas_enum_t storev,
                int m, int n, int k, int l,
                const coreblas_complex64_t *A1, int lda1,
                      coreblas_complex64_t *A2, int lda2,
                const coreblas_complex64_t *V,  int ldv,
                      coreblas_complex64_t *W,  int ldw)
 {
+#ifndef COREBLAS_UNCHECKED
     // Check input arguments.
     if ((op != CoreBlasW) && (op != CoreBlasA2)) {
         coreblas_error("illegal value of op");
@@ -186,59 +228,121 @@ int coreblas_zpamm(coreblas_enum_t op, coreblas_enum_t side, coreblas_enum_t sto
         coreblas_error("illegal value of side");
         return -2;
     }
+    if ((direct != CoreBlasForward) && (direct != CoreBlasBackward)) {
+        coreblas_error("illegal value of direct");
+        return -3;
+    }
     if ((storev != CoreBlasColumnwise) && (storev != CoreBlasRowwise)) {
         coreblas_error("illegal value of storev");
-        return -3;
+        return -4;
     }
     if (m < 0) {
         coreblas_error("illegal value of m");
-        return -4;
+        return -5;
     }
     if (n < 0) {
         coreblas_error("illegal value of n");
-        return -5;
+        return -6;
     }
     if (k < 0) {
         coreblas_error("illegal value of k");
-        return -6;
+        return -7;
     }
     if (l < 0) {
         coreblas_error("illegal value of l");
-        return -7;
+        return -8;
     }
     if (A1 == NULL) {
         coreblas_error("NULL A1");
-        return -8;
+        return -9;
     }
     if (lda1 < 0) {
         coreblas_error("illegal value of lda1");
-        return -9;
+        return -10;
     }
     if (A2 == NULL) {
         coreblas_error("NULL A2");
-        return -10;
+        return -11;
     }
     if (lda2 < 0) {
         coreblas_error("illegal value of lda2");
-        return -11;
+        return -12;
     }
     if (V == NULL) {
         coreblas_error("NULL V");
-        return -12;
+        return -13;
     }
     if (ldv < 0) {
         coreblas_error("illegal value of ldv");
-        return -13;
+        return -14;
     }
     if (W == NULL) {
         coreblas_error("NULL W");
-        return -14;
+        return -15;
     }
     if (ldw < 0) {
         coreblas_error("illegal value of ldw");
-        return -15;
+        return -16;
     }
+#endif
+
+    return coreblas_zpamm_nocheck(op, side,
+                                  direct, storev,
+                                  m, n, k, l,
+                                  A1, lda1,
+                                  A2, lda2,
+                                  V, ldv,
+                                  W, ldw);
+}
 
+/***************************************************************************//**
+ *
+ * @ingroup core_pamm
+ *
+ *  Same as coreblas_zpamm_direct with direct = CoreBlasForward: the
+ *  triangle of V lies in the last L rows (columns) of A2's side.
+ *  The arguments are those of coreblas_zpamm_direct without direct,
+ *  and are numbered accordingly in the returned value.
+ *
+ ******************************************************************************/
+__attribute__((weak))
+int coreblas_zpamm(coreblas_enum_t op, coreblas_enum_t side,
+               coreblas_enum_t storev,
+               int m, int n, int k, int l,
+               const coreblas_complex64_t *A1, int lda1,
+                     coreblas_complex64_t *A2, int lda2,
+               const coreblas_complex64_t *V,  int ldv,
+                     coreblas_complex64_t *W,  int ldw)
+{
+    int info = coreblas_zpamm_direct(op, side,
+                                     CoreBlasForward, storev,
+                                     m, n, k, l,
+                                     A1, lda1,
+                                     A2, lda2,
+                                     V, ldv,
+                                     W, ldw);
+
+    // Arguments after side are one place earlier than in
+    // coreblas_zpamm_direct.
+    return info < -2 ? info+1 : info;
+}
+
+/***************************************************************************//**
+ *
+ * @ingroup core_pamm
+ *
+ *  Same as coreblas_zpamm_direct, without checking the arguments. Called by
+ *  coreblas_zparfb once they have checked their own.
+ *
+ ******************************************************************************/
+int coreblas_zpamm_nocheck(coreblas_enum_t op, coreblas_enum_t side,
+               coreblas_enum_t direct, coreblas_enum_t storev,
+               int m, int n, int k, int l,
+               const coreblas_complex64_t *A1, int lda1,
+                     coreblas_complex64_t *A2, int lda2,
+               const coreblas_complex64_t *V,  int ldv,
+                     coreblas_complex64_t *W,  int ldw)
+{
     // quick return
     if (m == 0 || n == 0 || k == 0)
         return CoreBlasSuccess;
@@ -290,6 +394,47 @@ int coreblas_zpamm(coreblas_enum_t op, coreblas_enum_t side, coreblas_enum_t sto
         vi3  = l;
     }
 
+    //=================
+    // CoreBlasBackward
+    //=================
+    if (direct == CoreBlasBackward) {
+        // The triangle is the transpose of the forward one. It holds the
+        // first l rows (columns) of A2 against the last l reflectors, next
+        // to the rectangle at vi1; the other reflectors start at V.
+        uplo = uplo == CoreBlasUpper ? CoreBlasLower : CoreBlasUpper;
+        int kr;
+        if (side == CoreBlasLeft)
+            kr = op == CoreBlasW ? m : k;
+        else
+            kr = op == CoreBlasW ? n : k;
+
+        int vi1;
+        if (storev == CoreBlasColumnwise) {
+            vi2 = ldv*(kr-l);
+            vi1 = vi2 + l;
+        }
+        else {
+            vi2 = kr-l;
+            vi1 = vi2 + ldv*l;
+        }
+
+        if (op == CoreBlasW) {
+            return coreblas_zpamm_w_backward(side, trans, uplo,
+                                             m, n, k, l, vi1, vi2,
+                                             A1, lda1,
+                                             A2, lda2,
+                                             V,  ldv,
+                                             W,  ldw);
+        }
+        else {
+            return coreblas_zpamm_a2_backward(side, trans, uplo,
+                                              m, n, k, l, vi1, vi2,
+                                              A2, lda2,
+                                              V,  ldv,
+                                              W,  ldw);
+        }
+    }
+
     if (op == CoreBlasW) {
         coreblas_zpamm_w(side, trans, uplo,
                      m, n, k, l, vi2, vi3,
@@ -333,13 +478,13 @@ static inline int coreblas_zpamm_w(
 
             // W = A2_2
             #ifdef COREBLAS_USE_64BIT_BLAS
-                 LAPACKE_zlacpy64_(LAPACK_COL_MAJOR,
+                 LAPACKE_zlacpy_work64_(LAPACK_COL_MAJOR,
                             lapack_const(CoreBlasGeneral),
                             l, n,
                             &A2[k-l], lda2,
                             W,       ldw);
             #else
-                 LAPACKE_zlacpy(LAPACK_COL_MAJOR,
+                 LAPACKE_zlacpy_work(LAPACK_COL_MAJOR,
                             lapack_const(CoreBlasGeneral),
                             l, n,
                             &A2[k-l], lda2,
@@ -444,13 +589,13 @@ static inline int coreblas_zpamm_w(
             if (l > 0) {
                 // W = A2_2
                 #ifdef COREBLAS_USE_64BIT_BLAS
-                    LAPACKE_zlacpy64_(LAPACK_COL_MAJOR,
+                    LAPACKE_zlacpy_work64_(LAPACK_COL_MAJOR,
                                 lapack_const(CoreBlasGeneral),
                                 m, l,
                                 &A2[lda2*(k-l)], lda2,
                                 W,              ldw);
                 #else
-                    LAPACKE_zlacpy(LAPACK_COL_MAJOR,
+                    LAPACKE_zlacpy_work(LAPACK_COL_MAJOR,
                                 lapack_const(CoreBlasGeneral),
                                 m, l,
                                 &A2[lda2*(k-l)], lda2,
@@ -722,4 +867,328 @@ static inline int coreblas_zpamm_a2(
     }
 
     return CoreBlasSuccess;
-}
\ No newline at end of file
+}
+
+/******************************************************************************/
+static inline int coreblas_zpamm_w_backward(
+        coreblas_enum_t side, coreblas_enum_t trans, coreblas_enum_t uplo,
+        int m, int n, int k, int l, int vi1, int vi2,
+        const coreblas_complex64_t *A1, int lda1,
+              coreblas_complex64_t *A2, int lda2,
+        const coreblas_complex64_t *V,  int ldv,
+              coreblas_complex64_t *W,  int ldw)
+{
+    // W = A1 + op(V) * A2  or  W = A1 + A2 * op(V)
+
+    coreblas_complex64_t zone  = 1.0;
+    coreblas_complex64_t zzero = 0.0;
+
+    //=============
+    // CoreBlasLeft
+    //=============
+    if (side == CoreBlasLeft) {
+        if (l > 0) {
+            // W_2 = A2_1 (first L rows of A2)
+#ifdef COREBLAS_USE_64BIT_BLAS
+            LAPACKE_zlacpy_work64_(LAPACK_COL_MAJOR,
+                                   lapack_const(CoreBlasGeneral),
+                                   l, n,
+                                   A2,      lda2,
+                                   &W[m-l], ldw);
+#else
+            LAPACKE_zlacpy_work(LAPACK_COL_MAJOR,
+                                lapack_const(CoreBlasGeneral),
+                                l, n,
+                                A2,      lda2,
+                                &W[m-l], ldw);
+#endif
+
+            // W_2 = V_2 * W_2 (triangle)
+#ifdef COREBLAS_USE_64BIT_BLAS
+            cblas_ztrmm64_(CblasColMajor,
+                           CblasLeft, (CBLAS_UPLO)uplo,
+                           (CBLAS_TRANSPOSE)trans, CblasNonUnit,
+                           l, n,
+                           CBLAS_SADDR(zone), &V[vi2], ldv,
+                                              &W[m-l], ldw);
+#else
+            cblas_ztrmm(CblasColMajor,
+                        CblasLeft, (CBLAS_UPLO)uplo,
+                        (CBLAS_TRANSPOSE)trans, CblasNonUnit,
+                        l, n,
+                        CBLAS_SADDR(zone), &V[vi2], ldv,
+                                           &W[m-l], ldw);
+#endif
+
+            // W_2 = W_2 + V_1 * A2_2 (rectangle next to the triangle)
+            if (k > l) {
+#ifdef COREBLAS_USE_64BIT_BLAS
+                cblas_zgemm64_(CblasColMajor,
+                               (CBLAS_TRANSPOSE)trans, CblasNoTrans,
+                               l, n, k-l,
+                               CBLAS_SADDR(zone), &V[vi1], ldv,
+                                                  &A2[l],  lda2,
+                               CBLAS_SADDR(zone), &W[m-l], ldw);
+#else
+                cblas_zgemm(CblasColMajor,
+                            (CBLAS_TRANSPOSE)trans, CblasNoTrans,
+                            l, n, k-l,
+                            CBLAS_SADDR(zone), &V[vi1], ldv,
+                                               &A2[l],  lda2,
+                            CBLAS_SADDR(zone), &W[m-l], ldw);
+#endif
+            }
+        }
+
+        // W_1 = V_3 * A2 (first M-L reflectors)
+        if (m > l) {
+#ifdef COREBLAS_USE_64BIT_BLAS
+            cblas_zgemm64_(CblasColMajor,
+                           (CBLAS_TRANSPOSE)trans, CblasNoTrans,
+                           m-l, n, k,
+                           CBLAS_SADDR(zone),  V,  ldv,
+                                               A2, lda2,
+                           CBLAS_SADDR(zzero), W,  ldw);
+#else
+            cblas_zgemm(CblasColMajor,
+                        (CBLAS_TRANSPOSE)trans, CblasNoTrans,
+                        m-l, n, k,
+                        CBLAS_SADDR(zone),  V,  ldv,
+                                            A2, lda2,
+                        CBLAS_SADDR(zzero), W,  ldw);
+#endif
+        }
+    }
+    //==============
+    // CoreBlasRight
+    //==============
+    else {
+        if (l > 0) {
+            // W_2 = A2_1 (first L columns of A2)
+#ifdef COREBLAS_USE_64BIT_BLAS
+            LAPACKE_zlacpy_work64_(LAPACK_COL_MAJOR,
+                                   lapack_const(CoreBlasGeneral),
+                                   m, l,
+                                   A2,            lda2,
+                                   &W[ldw*(n-l)], ldw);
+#else
+            LAPACKE_zlacpy_work(LAPACK_COL_MAJOR,
+                                lapack_const(CoreBlasGeneral),
+                                m, l,
+                                A2,            lda2,
+                                &W[ldw*(n-l)], ldw);
+#endif
+
+            // W_2 = W_2 * V_2 (triangle)
+#ifdef COREBLAS_USE_64BIT_BLAS
+            cblas_ztrmm64_(CblasColMajor,
+                           CblasRight, (CBLAS_UPLO)uplo,
+                           (CBLAS_TRANSPOSE)trans, CblasNonUnit,
+                           m, l,
+                           CBLAS_SADDR(zone), &V[vi2],       ldv,
+                                              &W[ldw*(n-l)], ldw);
+#else
+            cblas_ztrmm(CblasColMajor,
+                        CblasRight, (CBLAS_UPLO)uplo,
+                        (CBLAS_TRANSPOSE)trans, CblasNonUnit,
+                        m, l,
+                        CBLAS_SADDR(zone), &V[vi2],       ldv,
+                                           &W[ldw*(n-l)], ldw);
+#endif
+
+            // W_2 = W_2 + A2_2 * V_1 (rectangle next to the triangle)
+            if (k > l) {
+#ifdef COREBLAS_USE_64BIT_BLAS
+                cblas_zgemm64_(CblasColMajor,
+                               CblasNoTrans, (CBLAS_TRANSPOSE)trans,
+                               m, l, k-l,
+                               CBLAS_SADDR(zone), &A2[lda2*l],   lda2,
+                                                  &V[vi1],       ldv,
+                               CBLAS_SADDR(zone), &W[ldw*(n-l)], ldw);
+#else
+                cblas_zgemm(CblasColMajor,
+                            CblasNoTrans, (CBLAS_TRANSPOSE)trans,
+                            m, l, k-l,
+                            CBLAS_SADDR(zone), &A2[lda2*l],   lda2,
+                                               &V[vi1],       ldv,
+                            CBLAS_SADDR(zone), &W[ldw*(n-l)], ldw);
+#endif
+            }
+        }
+
+        // W_1 = A2 * V_3 (first N-L reflectors)
+        if (n > l) {
+#ifdef COREBLAS_USE_64BIT_BLAS
+            cblas_zgemm64_(CblasColMajor,
+                           CblasNoTrans, (CBLAS_TRANSPOSE)trans,
+                           m, n-l, k,
+                           CBLAS_SADDR(zone),  A2, lda2,
+                                               V,  ldv,
+                           CBLAS_SADDR(zzero), W,  ldw);
+#else
+            cblas_zgemm(CblasColMajor,
+                        CblasNoTrans, (CBLAS_TRANSPOSE)trans,
+                        m, n-l, k,
+                        CBLAS_SADDR(zone),  A2, lda2,
+                                            V,  ldv,
+                        CBLAS_SADDR(zzero), W,  ldw);
+#endif
+        }
+    }
+
+    // W = A1 + W
+    for (int j = 0; j < n; j++)
+        for (int i = 0; i < m; i++)
+            W[ldw*j+i] += A1[lda1*j+i];
+
+    return CoreBlasSuccess;
+}
+
+/******************************************************************************/
+static inline int coreblas_zpamm_a2_backward(
+        coreblas_enum_t side, coreblas_enum_t trans, coreblas_enum_t uplo,
+        int m, int n, int k, int l, int vi1, int vi2,
+              coreblas_complex64_t *A2, int lda2,
+        const coreblas_complex64_t *V,  int ldv,
+              coreblas_complex64_t *W,  int ldw)
+{
+    // A2 = A2 - op(V) * W  or  A2 = A2 - W * op(V)
+
+    coreblas_complex64_t zone  =  1.0;
+    coreblas_complex64_t zmone = -1.0;
+
+    //=============
+    // CoreBlasLeft
+    //=============
+    if (side == CoreBlasLeft) {
+        // A2_2 = A2_2 - V_1 * W_2 (rectangle next to the triangle)
+        if (l > 0 && m > l) {
+#ifdef COREBLAS_USE_64BIT_BLAS
+            cblas_zgemm64_(CblasColMajor,
+                           (CBLAS_TRANSPOSE)trans, CblasNoTrans,
+                           m-l, n, l,
+                           CBLAS_SADDR(zmone), &V[vi1], ldv,
+                                               &W[k-l], ldw,
+                           CBLAS_SADDR(zone),  &A2[l],  lda2);
+#else
+            cblas_zgemm(CblasColMajor,
+                        (CBLAS_TRANSPOSE)trans, CblasNoTrans,
+                        m-l, n, l,
+                        CBLAS_SADDR(zmone), &V[vi1], ldv,
+                                            &W[k-l], ldw,
+                        CBLAS_SADDR(zone),  &A2[l],  lda2);
+#endif
+        }
+
+        // A2 = A2 - V_3 * W_1 (first K-L reflectors)
+        if (k > l) {
+#ifdef COREBLAS_USE_64BIT_BLAS
+            cblas_zgemm64_(CblasColMajor,
+                           (CBLAS_TRANSPOSE)trans, CblasNoTrans,
+                           m, n, k-l,
+                           CBLAS_SADDR(zmone), V,  ldv,
+                                               W,  ldw,
+                           CBLAS_SADDR(zone),  A2, lda2);
+#else
+            cblas_zgemm(CblasColMajor,
+                        (CBLAS_TRANSPOSE)trans, CblasNoTrans,
+                        m, n, k-l,
+                        CBLAS_SADDR(zmone), V,  ldv,
+                                            W,  ldw,
+                        CBLAS_SADDR(zone),  A2, lda2);
+#endif
+        }
+
+        if (l > 0) {
+            // W_2 = V_2 * W_2 (triangle)
+#ifdef COREBLAS_USE_64BIT_BLAS
+            cblas_ztrmm64_(CblasColMajor,
+                           CblasLeft, (CBLAS_UPLO)uplo,
+                           (CBLAS_TRANSPOSE)trans, CblasNonUnit,
+                           l, n,
+                           CBLAS_SADDR(zone), &V[vi2], ldv,
+                                              &W[k-l], ldw);
+#else
+            cblas_ztrmm(CblasColMajor,
+                        CblasLeft, (CBLAS_UPLO)uplo,
+                        (CBLAS_TRANSPOSE)trans, CblasNonUnit,
+                        l, n,
+                        CBLAS_SADDR(zone), &V[vi2], ldv,
+                                           &W[k-l], ldw);
+#endif
+
+            // A2_1 = A2_1 - W_2
+            for (int j = 0; j < n; j++)
+                for (int i = 0; i < l; i++)
+                    A2[lda2*j+i] -= W[ldw*j+(k-l)+i];
+        }
+    }
+    //==============
+    // CoreBlasRight
+    //==============
+    else {
+        // A2_2 = A2_2 - W_2 * V_1 (rectangle next to the triangle)
+        if (l > 0 && n > l) {
+#ifdef COREBLAS_USE_64BIT_BLAS
+            cblas_zgemm64_(CblasColMajor,
+                           CblasNoTrans, (CBLAS_TRANSPOSE)trans,
+                           m, n-l, l,
+                           CBLAS_SADDR(zmone), &W[ldw*(k-l)], ldw,
+                                               &V[vi1],       ldv,
+                           CBLAS_SADDR(zone),  &A2[lda2*l],   lda2);
+#else
+            cblas_zgemm(CblasColMajor,
+                        CblasNoTrans, (CBLAS_TRANSPOSE)trans,
+                        m, n-l, l,
+                        CBLAS_SADDR(zmone), &W[ldw*(k-l)], ldw,
+                                            &V[vi1],       ldv,
+                        CBLAS_SADDR(zone),  &A2[lda2*l],   lda2);
+#endif
+        }
+
+        // A2 = A2 - W_1 * V_3 (first K-L reflectors)
+        if (k > l) {
+#ifdef COREBLAS_USE_64BIT_BLAS
+            cblas_zgemm64_(CblasColMajor,
+                           CblasNoTrans, (CBLAS_TRANSPOSE)trans,
+                           m, n, k-l,
+                           CBLAS_SADDR(zmone), W,  ldw,
+                                               V,  ldv,
+                           CBLAS_SADDR(zone),  A2, lda2);
+#else
+            cblas_zgemm(CblasColMajor,
+                        CblasNoTrans, (CBLAS_TRANSPOSE)trans,
+                        m, n, k-l,
+                        CBLAS_SADDR(zmone), W,  ldw,
+                                            V,  ldv,
+                        CBLAS_SADDR(zone),  A2, lda2);
+#endif
+        }
+
+        if (l > 0) {
+            // W_2 = W_2 * V_2 (triangle)
+#ifdef COREBLAS_USE_64BIT_BLAS
+            cblas_ztrmm64_(CblasColMajor,
+                           CblasRight, (CBLAS_UPLO)uplo,
+                           (CBLAS_TRANSPOSE)trans, CblasNonUnit,
+                           m, l,
+                           CBLAS_SADDR(zone), &V[vi2],       ldv,
+                                              &W[ldw*(k-l)], ldw);
+#else
+            cblas_ztrmm(CblasColMajor,
+                        CblasRight, (CBLAS_UPLO)uplo,
+                        (CBLAS_TRANSPOSE)trans, CblasNonUnit,
+                        m, l,
+                        CBLAS_SADDR(zone), &V[vi2],       ldv,
+                                           &W[ldw*(k-l)], ldw);
+#endif
+
+            // A2_1 = A2_1 - W_2
+            for (int j = 0; j < l; j++)
+                for (int i = 0; i < m; i++)
+                    A2[lda2*j+i] -= W[ldw*(k-l+j)+i];
+        }
+    }
+
+    return CoreBlasSuccess;
+}
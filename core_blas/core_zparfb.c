@@ -38,6 +38,9 @@
  *
  *         | L |  K-L  |
  *
+ *  For CoreBlasBackward, V is reversed in both dimensions, see
+ *  coreblas_zpamm_direct, and T is lower triangular.
+ *
  *******************************************************************************
  *
  * @param[in] side
@@ -108,7 +111,8 @@
  * @param[out] T
  *         The triangular k-by-k matrix T in the representation of the
  *         block reflector.
- *         T is upper triangular by block (economic storage);
+ *         T is upper (CoreBlasForward) or lower (CoreBlasBackward)
+ *         triangular by block (economic storage);
  *         The rest of the array is not referenced.
  *
  * @param[in] ldt
@@ -135,6 +139,7 @@ int coreblas_zparfb(coreblas_enum_t side, coreblas_enum_t trans,
                 const coreblas_complex64_t *T,    int ldt,
                       coreblas_complex64_t *work, int ldwork)
 {
+#ifndef COREBLAS_UNCHECKED
     // Check input arguments.
     if (side != CoreBlasLeft && side != CoreBlasRight) {
         coreblas_error("illegal value of side");
@@ -217,7 +222,36 @@ int coreblas_zparfb(coreblas_enum_t side, coreblas_enum_t trans,
         coreblas_error("illegal value of ldwork");
         return -20;
     }
+#endif
+
+    return coreblas_zparfb_nocheck(side, trans,
+                                   direct, storev,
+                                   m1, n1, m2, n2, k, l,
+                                   A1, lda1,
+                                   A2, lda2,
+                                   V, ldv,
+                                   T, ldt,
+                                   work, ldwork);
+}
 
+/***************************************************************************//**
+ *
+ * @ingroup core_parfb
+ *
+ *  Same as coreblas_zparfb, without checking the arguments. Called by
+ *  coreblas_ztsmqr, coreblas_zttmqr and the other
+ *  tile update kernels once they have checked their own.
+ *
+ ******************************************************************************/
+int coreblas_zparfb_nocheck(coreblas_enum_t side, coreblas_enum_t trans,
+                coreblas_enum_t direct, coreblas_enum_t storev,
+                int m1, int n1, int m2, int n2, int k, int l,
+                      coreblas_complex64_t *A1,   int lda1,
+                      coreblas_complex64_t *A2,   int lda2,
+                const coreblas_complex64_t *V,    int ldv,
+                const coreblas_complex64_t *T,    int ldt,
+                      coreblas_complex64_t *work, int ldwork)
+{
     // quick return
     if (m1 == 0 || n1 == 0 || m2 == 0 || n2 == 0 || k == 0)
         return CoreBlasSuccess;
@@ -225,124 +259,153 @@ int coreblas_zparfb(coreblas_enum_t side, coreblas_enum_t trans,
     coreblas_complex64_t zone  =  1.0;
     coreblas_complex64_t zmone = -1.0;
 
-    if (direct == CoreBlasForward) {
-        //=============================
-        // CoreBlasForward / CoreBlasLeft
-        //=============================
-        if (side == CoreBlasLeft) {
-            // Form  H * A  or  H^H * A  where  A = ( A1 )
-            //                                      ( A2 )
-
-            // W = A1 + op(V) * A2
-            coreblas_zpamm(CoreBlasW, CoreBlasLeft, storev,
-                       k, n1, m2, l,
-                       A1,   lda1,
-                       A2,   lda2,
-                       V,    ldv,
-                       work, ldwork);
-        #ifdef COREBLAS_USE_64BIT_BLAS
-                    // W = op(T) * W
-            cblas_ztrmm64_(CblasColMajor,
-                        CblasLeft, CblasUpper,
-                        (CBLAS_TRANSPOSE)trans, CblasNonUnit,
-                        k, n2,
-                        CBLAS_SADDR(zone), T,    ldt,
-                                           work, ldwork);
-        #else
-                    // W = op(T) * W
-            cblas_ztrmm(CblasColMajor,
-                        CblasLeft, CblasUpper,
-                        (CBLAS_TRANSPOSE)trans, CblasNonUnit,
-                        k, n2,
-                        CBLAS_SADDR(zone), T,    ldt,
-                                           work, ldwork);
-        #endif 
+    // T is upper triangular for CoreBlasForward
+    // and lower triangular for CoreBlasBackward.
+    coreblas_enum_t uplo = direct == CoreBlasForward ? CoreBlasUpper
+                                                     : CoreBlasLower;
 
+    //=============
+    // CoreBlasLeft
+    //=============
+    if (side == CoreBlasLeft) {
+        // Form  H * A  or  H^H * A  where  A = ( A1 )
+        //                                      ( A2 )
 
-            // A1 = A1 - W
-            for (int j = 0; j < n1; j++) {
-            #ifdef COREBLAS_USE_64BIT_BLAS
-                    cblas_zaxpy64_(k, CBLAS_SADDR(zmone),
-                            &work[ldwork*j], 1,
-                            &A1[lda1*j], 1);
-            #else
-                    cblas_zaxpy(k, CBLAS_SADDR(zmone),
-                            &work[ldwork*j], 1,
-                            &A1[lda1*j], 1);
-            #endif 
+        // W = A1 + op(V) * A2
+        coreblas_zpamm_nocheck(CoreBlasW, CoreBlasLeft, direct, storev,
+                               k, n1, m2, l,
+                               A1,   lda1,
+                               A2,   lda2,
+                               V,    ldv,
+                               work, ldwork);
 
-            }
+        // W = op(T) * W
+#ifdef COREBLAS_USE_64BIT_BLAS
+        cblas_ztrmm64_(CblasColMajor,
+                       CblasLeft, (CBLAS_UPLO)uplo,
+                       (CBLAS_TRANSPOSE)trans, CblasNonUnit,
+                       k, n1,
+                       CBLAS_SADDR(zone), T,    ldt,
+                                          work, ldwork);
+#else
+        cblas_ztrmm(CblasColMajor,
+                    CblasLeft, (CBLAS_UPLO)uplo,
+                    (CBLAS_TRANSPOSE)trans, CblasNonUnit,
+                    k, n1,
+                    CBLAS_SADDR(zone), T,    ldt,
+                                       work, ldwork);
+#endif
 
-            // A2 = A2 - op(V) * W
-            // W = V * W, A2 = A2 - W
-            coreblas_zpamm(CoreBlasA2, CoreBlasLeft, storev,
-                       m2, n2, k, l,
-                       A1,   lda1,
-                       A2,   lda2,
-                       V,    ldv,
-                       work, ldwork);
+        // A1 = A1 - W
+        for (int j = 0; j < n1; j++) {
+#ifdef COREBLAS_USE_64BIT_BLAS
+            cblas_zaxpy64_(k, CBLAS_SADDR(zmone),
+                           &work[ldwork*j], 1,
+                           &A1[lda1*j], 1);
+#else
+            cblas_zaxpy(k, CBLAS_SADDR(zmone),
+                        &work[ldwork*j], 1,
+                        &A1[lda1*j], 1);
+#endif
         }
-        //==============================
-        // CoreBlasForward / CoreBlasRight
-        //==============================
-        else {
-            // Form  H * A  or  H^H * A  where A  = ( A1 A2 )
-
-            // W = A1 + A2 * op(V)
-            coreblas_zpamm(CoreBlasW, CoreBlasRight, storev,
-                       m1, k, n2, l,
-                       A1,   lda1,
-                       A2,   lda2,
-                       V,    ldv,
-                       work, ldwork);
- 
-        #ifdef COREBLAS_USE_64BIT_BLAS
-                    // W = W * op(T)
-            cblas_ztrmm64_(CblasColMajor,
-                        CblasRight, CblasUpper,
-                        (CBLAS_TRANSPOSE)trans, CblasNonUnit,
-                        m2, k,
-                        CBLAS_SADDR(zone), T,    ldt,
-                                           work, ldwork);
-        #else
-                    // W = W * op(T)
-            cblas_ztrmm(CblasColMajor,
-                        CblasRight, CblasUpper,
-                        (CBLAS_TRANSPOSE)trans, CblasNonUnit,
-                        m2, k,
-                        CBLAS_SADDR(zone), T,    ldt,
-                                           work, ldwork);
-        #endif
 
+        // A2 = A2 - op(V) * W
+        coreblas_zpamm_nocheck(CoreBlasA2, CoreBlasLeft, direct, storev,
+                               m2, n2, k, l,
+                               A1,   lda1,
+                               A2,   lda2,
+                               V,    ldv,
+                               work, ldwork);
+    }
+    //==============
+    // CoreBlasRight
+    //==============
+    else {
+        // Form  H * A  or  H^H * A  where A  = ( A1 A2 )
 
-            // A1 = A1 - W
-            for (int j = 0; j < k; j++) {
-            #ifdef COREBLAS_USE_64BIT_BLAS
-                    cblas_zaxpy64_(m1, CBLAS_SADDR(zmone),
-                            &work[ldwork*j], 1,
-                            &A1[lda1*j], 1);
-            #else
-                    cblas_zaxpy(m1, CBLAS_SADDR(zmone),
-                            &work[ldwork*j], 1,
-                            &A1[lda1*j], 1);
-            #endif 
+        // W = A1 + A2 * op(V)
+        coreblas_zpamm_nocheck(CoreBlasW, CoreBlasRight, direct, storev,
+                               m1, k, n2, l,
+                               A1,   lda1,
+                               A2,   lda2,
+                               V,    ldv,
+                               work, ldwork);
 
-            }
+        // W = W * op(T)
+#ifdef COREBLAS_USE_64BIT_BLAS
+        cblas_ztrmm64_(CblasColMajor,
+                       CblasRight, (CBLAS_UPLO)uplo,
+                       (CBLAS_TRANSPOSE)trans, CblasNonUnit,
+                       m1, k,
+                       CBLAS_SADDR(zone), T,    ldt,
+                                          work, ldwork);
+#else
+        cblas_ztrmm(CblasColMajor,
+                    CblasRight, (CBLAS_UPLO)uplo,
+                    (CBLAS_TRANSPOSE)trans, CblasNonUnit,
+                    m1, k,
+                    CBLAS_SADDR(zone), T,    ldt,
+                                       work, ldwork);
+#endif
 
-            // A2 = A2 - W * op(V)
-            // W = W * V^H, A2 = A2 - W
-            coreblas_zpamm(CoreBlasA2, CoreBlasRight, storev,
-                       m2, n2, k, l,
-                       A1,   lda1,
-                       A2,   lda2,
-                       V,    ldv,
-                       work, ldwork);
+        // A1 = A1 - W
+        for (int j = 0; j < k; j++) {
+#ifdef COREBLAS_USE_64BIT_BLAS
+            cblas_zaxpy64_(m1, CBLAS_SADDR(zmone),
+                           &work[ldwork*j], 1,
+                           &A1[lda1*j], 1);
+#else
+            cblas_zaxpy(m1, CBLAS_SADDR(zmone),
+                        &work[ldwork*j], 1,
+                        &A1[lda1*j], 1);
+#endif
         }
-    }
-    else {
-        coreblas_error("Backward / Left or Right not implemented");
-        return CoreBlasErrorNotSupported;
+
+        // A2 = A2 - W * op(V)
+        coreblas_zpamm_nocheck(CoreBlasA2, CoreBlasRight, direct, storev,
+                               m2, n2, k, l,
+                               A1,   lda1,
+                               A2,   lda2,
+                               V,    ldv,
+                               work, ldwork);
     }
 
     return CoreBlasSuccess;
-}
\ No newline at end of file
+}
+
+/***************************************************************************//**
+ *
+ * @ingroup core_parfb
+ *
+ *  Returns the minimum length of the array work of coreblas_zparfb
+ *  for the given dimensions.
+ *  The leading dimension is ldwork = max(1,k) on the left
+ *  and ldwork = max(1,m1) on the right.
+ *
+ *******************************************************************************
+ *
+ * @param[in] side
+ *         - CoreBlasLeft  : apply from the Left;
+ *         - CoreBlasRight : apply from the Right.
+ *
+ * @param[in] m1
+ *         The number of rows of the tile A1.
+ *
+ * @param[in] n1
+ *         The number of columns of the tile A1.
+ *
+ * @param[in] k
+ *         The order of the matrix T.
+ *
+ *******************************************************************************
+ *
+ * @retval the length of work, at least 1.
+ *
+ ******************************************************************************/
+size_t coreblas_zparfb_lwork(coreblas_enum_t side, int m1, int n1, int k)
+{
+    if (side == CoreBlasLeft)
+        return imax(1, k)*(size_t)imax(1, n1);
+    else
+        return imax(1, m1)*(size_t)imax(1, k);
+}
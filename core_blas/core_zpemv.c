@@ -118,6 +118,7 @@ int coreblas_zpemv(coreblas_enum_t trans, int storev,
                coreblas_complex64_t *Y, int incy,
                coreblas_complex64_t *work)
 {
+#ifndef COREBLAS_UNCHECKED
     // Check input arguments.
     if ((trans != CoreBlasNoTrans) &&
         (trans != CoreBlasTrans)   &&
@@ -158,6 +159,7 @@ int coreblas_zpemv(coreblas_enum_t trans, int storev,
         coreblas_error("Illegal value of incy");
         return -13;
     }
+#endif
 
     // quick return
     if ((m == 0) || (n == 0))
@@ -368,3 +370,31 @@ int coreblas_zpemv(coreblas_enum_t trans, int storev,
 
     return CoreBlasSuccess;
 }
+
+/***************************************************************************//**
+ *
+ * @ingroup core_pemv
+ *
+ *  Returns the minimum length of the array work of coreblas_zpemv
+ *  for the given dimensions.
+ *
+ *******************************************************************************
+ *
+ * @param[in] m
+ *         The number of rows of the matrix A.
+ *
+ * @param[in] n
+ *         The number of columns of the matrix A.
+ *
+ * @param[in] l
+ *         The order of the triangular part of A.
+ *
+ *******************************************************************************
+ *
+ * @retval the length of work, at least 1.
+ *
+ ******************************************************************************/
+size_t coreblas_zpemv_lwork(int m, int n, int l)
+{
+    return imax(1, l);
+}
@@ -83,6 +83,7 @@ int coreblas_ztradd(coreblas_enum_t uplo, coreblas_enum_t transa,
                 coreblas_complex64_t alpha, const coreblas_complex64_t *A, int lda,
                 coreblas_complex64_t beta,        coreblas_complex64_t *B, int ldb)
 {
+#ifndef COREBLAS_UNCHECKED
     // Check input arguments
     if ((uplo != CoreBlasUpper) &&
         (uplo != CoreBlasLower)) {
@@ -125,6 +126,7 @@ int coreblas_ztradd(coreblas_enum_t uplo, coreblas_enum_t transa,
         coreblas_error("illegal value of ldb");
         return -10;
     }
+#endif
 
     // quick return
     if (m == 0 || n == 0 || (alpha == 0.0 && beta == 1.0))
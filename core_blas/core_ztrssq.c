@@ -17,23 +17,6 @@
 
 #include <math.h>
 
-/******************************************************************************/
-// This computation also shows up in coreblas_zsyssq() and can be factored out.
-// LAPACK does real and imag components separately in zlassq.
-static inline void ssq(coreblas_complex64_t value, double *scale, double *sumsq)
-{
-    double absa = cabs(value);
-    if (absa != 0.0) { // != propagates nan
-        if (*scale < absa) {
-            *sumsq = 1.0 + *sumsq*((*scale/absa)*(*scale/absa));
-            *scale = absa;
-        }
-        else {
-            *sumsq = *sumsq + ((absa/(*scale))*(absa/(*scale)));
-        }
-    }
-}
-
 /******************************************************************************/
 __attribute__((weak))
 void coreblas_ztrssq(coreblas_enum_t uplo, coreblas_enum_t diag,
@@ -43,48 +26,36 @@ void coreblas_ztrssq(coreblas_enum_t uplo, coreblas_enum_t diag,
 {
     *scale = 0.0;
     *sumsq = 1.0;
-    
+
+    // The whole trapezoid is accumulated in one pass, the unit diagonal
+    // going to the medium accumulator.
+    double acc[3] = {0.0, 0.0, 0.0};
     if (uplo == CoreBlasUpper) {
         if (diag == CoreBlasNonUnit) {
-            for (int j = 0; j < n; j++) {
-                ssq(A[lda*j], scale, sumsq);
-                for (int i = 1; i < imin(j+1, m); i++) {
-                    ssq(A[lda*j+i], scale, sumsq);
-                }
-            }
+            for (int j = 0; j < n; j++)
+                coreblas_zssq_update(imin(j+1, m), &A[lda*j], acc);
         }
         else { // CoreBlasUnit
             int j;
             for (j = 0; j < imin(n, m); j++) {
-                ssq(1.0, scale, sumsq);
-                for (int i = 0; i < j; i++) {
-                    ssq(A[lda*j+i], scale, sumsq);
-                }
-            }
-            for (; j < n; j++) {
-                ssq(A[lda*j], scale, sumsq);
-                for (int i = 1; i < m; i++) {
-                    ssq(A[lda*j+i], scale, sumsq);
-                }
+                acc[1] += 1.0;
+                coreblas_zssq_update(j, &A[lda*j], acc);
             }
+            for (; j < n; j++)
+                coreblas_zssq_update(m, &A[lda*j], acc);
         }
     }
     else { // CoreBlasLower
         if (diag == CoreBlasNonUnit) {
-            for (int j = 0; j < imin(n, m); j++) {
-                ssq(A[lda*j+j], scale, sumsq);
-                for (int i = j+1; i < m; i++) {
-                    ssq(A[lda*j+i], scale, sumsq);
-                }
-            }
+            for (int j = 0; j < imin(n, m); j++)
+                coreblas_zssq_update(m-j, &A[lda*j+j], acc);
         }
         else { // CoreBlasUnit
             for (int j = 0; j < imin(n, m); j++) {
-                ssq(1.0, scale, sumsq);
-                for (int i = j+1; i < m; i++) {
-                    ssq(A[lda*j+i], scale, sumsq);
-                }
+                acc[1] += 1.0;
+                coreblas_zssq_update(m-j-1, &A[lda*j+j+1], acc);
             }
         }
     }
+    coreblas_zssq_finish(acc, scale, sumsq);
 }
\ No newline at end of file
@@ -100,6 +100,7 @@ int coreblas_ztslqt(int m, int n, int ib,
                 coreblas_complex64_t *tau,
                 coreblas_complex64_t *work)
 {
+#ifndef COREBLAS_UNCHECKED
     // Check input arguments.
     if (m < 0) {
         coreblas_error("illegal value of m");
@@ -145,13 +146,13 @@ int coreblas_ztslqt(int m, int n, int ib,
         coreblas_error("NULL work");
         return -11;
     }
+#endif
 
     // quick return
     if (m == 0 || n == 0 || ib == 0)
         return CoreBlasSuccess;
 
     static coreblas_complex64_t zone  = 1.0;
-    static coreblas_complex64_t zzero = 0.0;
 
     for (int ii = 0; ii < m; ii += ib) {
         int sb = imin(m-ii, ib);
@@ -169,8 +170,8 @@ int coreblas_ztslqt(int m, int n, int ib,
 
 #endif
     #ifdef COREBLAS_USE_64BIT_BLAS
-            LAPACKE_zlarfg64_(n+1, &A1[lda1*(ii+i)+ii+i], &A2[ii+i], lda2,
-                                &tau[ii+i]);
+            LAPACKE_zlarfg_work64_(n+1, &A1[lda1*(ii+i)+ii+i], &A2[ii+i], lda2,
+                                     &tau[ii+i]);
     #else
             LAPACKE_zlarfg_work(n+1, &A1[lda1*(ii+i)+ii+i], &A2[ii+i], lda2,
                                 &tau[ii+i]);
@@ -220,22 +221,6 @@ int coreblas_ztslqt(int m, int n, int ib,
             #endif
 
             }
-            #ifdef COREBLAS_USE_64BIT_BLAS
-                // Calculate T.
-                cblas_zgemv64_(CblasColMajor, (CBLAS_TRANSPOSE)CoreBlasNoTrans,
-                        i, n,
-                        CBLAS_SADDR(alpha), &A2[ii], lda2,
-                                            &A2[ii+i], lda2,
-                        CBLAS_SADDR(zzero), &T[ldt*(ii+i)], 1);
-            #else
-                // Calculate T.
-                cblas_zgemv(CblasColMajor, (CBLAS_TRANSPOSE)CoreBlasNoTrans,
-                        i, n,
-                        CBLAS_SADDR(alpha), &A2[ii], lda2,
-                                            &A2[ii+i], lda2,
-                        CBLAS_SADDR(zzero), &T[ldt*(ii+i)], 1);
-            #endif
-
 #ifdef COMPLEX
     #ifdef COREBLAS_USE_64BIT_BLAS
             LAPACKE_zlacgv64_(n, &A2[ii+i], lda2);
@@ -246,48 +231,53 @@ int coreblas_ztslqt(int m, int n, int ib,
     #endif
 
 #endif
-    #ifdef COREBLAS_USE_64BIT_BLAS
-            cblas_ztrmv64_(
-                CblasColMajor,
-                (CBLAS_UPLO)CoreBlasUpper,
-                (CBLAS_TRANSPOSE)CoreBlasNoTrans, (CBLAS_DIAG)CoreBlasNonUnit,
-                i,
-                &T[ldt*ii], ldt,
-                &T[ldt*(ii+i)], 1);
-    #else
-            cblas_ztrmv(
-                CblasColMajor,
-                (CBLAS_UPLO)CoreBlasUpper,
-                (CBLAS_TRANSPOSE)CoreBlasNoTrans, (CBLAS_DIAG)CoreBlasNonUnit,
-                i,
-                &T[ldt*ii], ldt,
-                &T[ldt*(ii+i)], 1);    
-    #endif
+        }
 
+        // Calculate T.
+        coreblas_zlarft_pent(CoreBlasRowwise, n, sb, 0,
+                             &A2[ii], lda2,
+                             &tau[ii],
+                             &T[ldt*ii], ldt);
 
-            T[ldt*(ii+i)+i] = tau[ii+i];
-        }
         if (m > ii+sb) {
-#ifdef COREBLAS_USE_64BIT_BLAS
-            coreblas_ztsmlq64_(CoreBlasRight, CoreBlas_ConjTrans,
-                        m-(ii+sb), sb, m-(ii+sb), n, ib, ib,
-                        &A1[lda1*ii+ii+sb], lda1,
-                        &A2[ii+sb], lda2,
-                        &A2[ii], lda2,
-                        &T[ldt*ii], ldt,
-                        work, lda1);
-#else
-            coreblas_ztsmlq(CoreBlasRight, CoreBlas_ConjTrans,
-                        m-(ii+sb), sb, m-(ii+sb), n, ib, ib,
-                        &A1[lda1*ii+ii+sb], lda1,
-                        &A2[ii+sb], lda2,
-                        &A2[ii], lda2,
-                        &T[ldt*ii], ldt,
-                        work, lda1);
-#endif
+            coreblas_ztsmlq_nocheck(CoreBlasRight, CoreBlas_ConjTrans,
+                                m-(ii+sb), sb, m-(ii+sb), n, ib, ib,
+                                &A1[lda1*ii+ii+sb], lda1,
+                                &A2[ii+sb], lda2,
+                                &A2[ii], lda2,
+                                &T[ldt*ii], ldt,
+                                work, lda1);
 
         }
     }
 
     return CoreBlasSuccess;
-}
\ No newline at end of file
+}
+
+/***************************************************************************//**
+ *
+ * @ingroup core_tslqt
+ *
+ *  Returns the minimum length of the array work of coreblas_ztslqt
+ *  for the given dimensions.
+ *
+ *******************************************************************************
+ *
+ * @param[in] m
+ *         The number of rows of the tiles A1 and A2.
+ *
+ * @param[in] n
+ *         The number of columns of the tile A2.
+ *
+ * @param[in] ib
+ *         The inner-blocking size.
+ *
+ *******************************************************************************
+ *
+ * @retval the length of work, at least 1.
+ *
+ ******************************************************************************/
+size_t coreblas_ztslqt_lwork(int m, int n, int ib)
+{
+    return imax(1, imin(ib, m))*(size_t)imax(1, m);
+}
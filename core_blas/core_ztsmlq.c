@@ -124,6 +124,7 @@ int coreblas_ztsmlq(coreblas_enum_t side, coreblas_enum_t trans,
                 const coreblas_complex64_t *T,    int ldt,
                       coreblas_complex64_t *work, int ldwork)
 {
+#ifndef COREBLAS_UNCHECKED
     // Check input arguments.
     if (side != CoreBlasLeft && side != CoreBlasRight) {
         coreblas_error("illegal value of side");
@@ -199,7 +200,33 @@ int coreblas_ztsmlq(coreblas_enum_t side, coreblas_enum_t trans,
         coreblas_error("illegal value of ldwork");
         return -18;
     }
+#endif
 
+    return coreblas_ztsmlq_nocheck(side, trans,
+                                   m1, n1, m2, n2, k, ib,
+                                   A1, lda1,
+                                   A2, lda2,
+                                   V, ldv,
+                                   T, ldt,
+                                   work, ldwork);
+}
+
+/***************************************************************************//**
+ *
+ * @ingroup core_tsmlq
+ *
+ *  Same as coreblas_ztsmlq, without checking the arguments. Called by
+ *  coreblas_ztslqt once they have checked their own.
+ *
+ ******************************************************************************/
+int coreblas_ztsmlq_nocheck(coreblas_enum_t side, coreblas_enum_t trans,
+                int m1, int n1, int m2, int n2, int k, int ib,
+                      coreblas_complex64_t *A1,   int lda1,
+                      coreblas_complex64_t *A2,   int lda2,
+                const coreblas_complex64_t *V,    int ldv,
+                const coreblas_complex64_t *T,    int ldt,
+                      coreblas_complex64_t *work, int ldwork)
+{
     // quick return
     if (m1 == 0 || n1 == 0 || m2 == 0 || n2 == 0 || k == 0  || ib == 0)
         return CoreBlasSuccess;
@@ -239,15 +266,52 @@ int coreblas_ztsmlq(coreblas_enum_t side, coreblas_enum_t trans,
         }
 
         // Apply H or H^H.
-        coreblas_zparfb(side, trans, CoreBlasForward, CoreBlasRowwise,
-                    mi, ni, m2, n2, kb, 0,
-                    &A1[lda1*jc+ic], lda1,
-                    A2, lda2,
-                    &V[i], ldv,
-                    &T[ldt*i], ldt,
-                    work, ldwork);
+        coreblas_zparfb_nocheck(side, trans, CoreBlasForward, CoreBlasRowwise,
+                            mi, ni, m2, n2, kb, 0,
+                            &A1[lda1*jc+ic], lda1,
+                            A2, lda2,
+                            &V[i], ldv,
+                            &T[ldt*i], ldt,
+                            work, ldwork);
 
     }
 
     return CoreBlasSuccess;
-}
\ No newline at end of file
+}
+
+/***************************************************************************//**
+ *
+ * @ingroup core_tsmlq
+ *
+ *  Returns the minimum length of the array work of coreblas_ztsmlq
+ *  for the given dimensions.
+ *  The leading dimension is ldwork = max(1,ib) on the left
+ *  and ldwork = max(1,n1) on the right.
+ *
+ *******************************************************************************
+ *
+ * @param[in] side
+ *         - CoreBlasLeft  : apply from the Left;
+ *         - CoreBlasRight : apply from the Right.
+ *
+ * @param[in] m1
+ *         The number of rows of the tile A1.
+ *
+ * @param[in] n1
+ *         The number of columns of the tile A1.
+ *
+ * @param[in] ib
+ *         The inner-blocking size.
+ *
+ *******************************************************************************
+ *
+ * @retval the length of work, at least 1.
+ *
+ ******************************************************************************/
+size_t coreblas_ztsmlq_lwork(coreblas_enum_t side, int m1, int n1, int ib)
+{
+    if (side == CoreBlasLeft)
+        return imax(1, ib)*(size_t)imax(1, m1);
+    else
+        return imax(1, n1)*(size_t)imax(1, ib);
+}
@@ -124,6 +124,7 @@ int coreblas_ztsmqr(coreblas_enum_t side, coreblas_enum_t trans,
                 const coreblas_complex64_t *T,    int ldt,
                       coreblas_complex64_t *work, int ldwork)
 {
+#ifndef COREBLAS_UNCHECKED
     // Check input arguments.
     if (side != CoreBlasLeft && side != CoreBlasRight) {
         coreblas_error("illegal value of side");
@@ -199,7 +200,33 @@ int coreblas_ztsmqr(coreblas_enum_t side, coreblas_enum_t trans,
         coreblas_error("illegal value of ldwork");
         return -18;
     }
+#endif
 
+    return coreblas_ztsmqr_nocheck(side, trans,
+                                   m1, n1, m2, n2, k, ib,
+                                   A1, lda1,
+                                   A2, lda2,
+                                   V, ldv,
+                                   T, ldt,
+                                   work, ldwork);
+}
+
+/***************************************************************************//**
+ *
+ * @ingroup core_tsmqr
+ *
+ *  Same as coreblas_ztsmqr, without checking the arguments. Called by
+ *  coreblas_ztsqrt and coreblas_ztsqrt_rec once they have checked their own.
+ *
+ ******************************************************************************/
+int coreblas_ztsmqr_nocheck(coreblas_enum_t side, coreblas_enum_t trans,
+                int m1, int n1, int m2, int n2, int k, int ib,
+                      coreblas_complex64_t *A1,   int lda1,
+                      coreblas_complex64_t *A2,   int lda2,
+                const coreblas_complex64_t *V,    int ldv,
+                const coreblas_complex64_t *T,    int ldt,
+                      coreblas_complex64_t *work, int ldwork)
+{
     // quick return
     if (m1 == 0 || n1 == 0 || m2 == 0 || n2 == 0 || k == 0 || ib == 0)
         return CoreBlasSuccess;
@@ -235,16 +262,53 @@ int coreblas_ztsmqr(coreblas_enum_t side, coreblas_enum_t trans,
         }
 
         // Apply H or H^H (NOTE: coreblas_zparfb used to be core_ztsrfb).
-        coreblas_zparfb(side, trans, CoreBlasForward, CoreBlasColumnwise,
-                    mi, ni, m2, n2, kb, 0,
-                    &A1[lda1*jc+ic], lda1,
-                    A2, lda2,
-                    &V[ldv*i], ldv,
-                    &T[ldt*i], ldt,
-                    work, ldwork);
+        coreblas_zparfb_nocheck(side, trans, CoreBlasForward, CoreBlasColumnwise,
+                            mi, ni, m2, n2, kb, 0,
+                            &A1[lda1*jc+ic], lda1,
+                            A2, lda2,
+                            &V[ldv*i], ldv,
+                            &T[ldt*i], ldt,
+                            work, ldwork);
 
 
     }
 
     return CoreBlasSuccess;
-}
\ No newline at end of file
+}
+
+/***************************************************************************//**
+ *
+ * @ingroup core_tsmqr
+ *
+ *  Returns the minimum length of the array work of coreblas_ztsmqr
+ *  for the given dimensions.
+ *  The leading dimension is ldwork = max(1,ib) on the left
+ *  and ldwork = max(1,m1) on the right.
+ *
+ *******************************************************************************
+ *
+ * @param[in] side
+ *         - CoreBlasLeft  : apply from the Left;
+ *         - CoreBlasRight : apply from the Right.
+ *
+ * @param[in] m1
+ *         The number of rows of the tile A1.
+ *
+ * @param[in] n1
+ *         The number of columns of the tile A1.
+ *
+ * @param[in] ib
+ *         The inner-blocking size.
+ *
+ *******************************************************************************
+ *
+ * @retval the length of work, at least 1.
+ *
+ ******************************************************************************/
+size_t coreblas_ztsmqr_lwork(coreblas_enum_t side, int m1, int n1, int ib)
+{
+    if (side == CoreBlasLeft)
+        return imax(1, ib)*(size_t)imax(1, n1);
+    else
+        return imax(1, m1)*(size_t)imax(1, ib);
+}
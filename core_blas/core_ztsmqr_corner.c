@@ -0,0 +1,293 @@
+/**
+ *
+ * @file
+ *
+ *  COREBLAS is a software package provided by:
+ *  University of Tennessee, US,
+ *  University of Manchester, UK.
+ *
+ * @precisions normal z -> c d s
+ *
+ **/
+
+#include <coreblas.h>
+#include "coreblas_types.h"
+#include "coreblas_internal.h"
+
+#undef REAL
+#define COMPLEX
+
+/******************************************************************************/
+// Copies the lower triangle of the n-by-n Hermitian tile A
+// into the full tile B.
+static void core_ztsmqr_rebuild(int n, const coreblas_complex64_t *A, int lda,
+                                coreblas_complex64_t *B, int ldb)
+{
+    for (int j = 0; j < n; j++) {
+        B[j + (size_t)ldb*j] = A[j + (size_t)lda*j];
+        for (int i = j+1; i < n; i++) {
+            B[i + (size_t)ldb*j] = A[i + (size_t)lda*j];
+            B[j + (size_t)ldb*i] = conj(A[i + (size_t)lda*j]);
+        }
+    }
+}
+
+/***************************************************************************//**
+ *
+ * @ingroup core_tsmqr
+ *
+ *  Applies the unitary matrix Q returned by coreblas_ztsqrt from both
+ *  sides to the Hermitian matrix
+ *
+ *    | A1  A2^H |
+ *    | A2  A3   |,
+ *
+ *  i.e., overwrites it with Q^H * [ A1 A2^H; A2 A3 ] * Q, where the
+ *  square tiles A1 and A3 are diagonal tiles of which only the lower
+ *  triangle is referenced and updated. This is the corner update of the
+ *  reduction of a Hermitian matrix to band form by tile QR factorizations
+ *  of the columns below the band.
+ *
+ *  The matrix is rebuilt in work as the full tiles A1, A2^H and A3, and
+ *  Q is applied with coreblas_ztsmqr on the left to the tile columns
+ *  ( A1; A2 ) and ( A2^H; A3 ), then on the right to the tile rows
+ *  ( A1 A2^H ) and ( A2 A3 ).
+ *
+ *******************************************************************************
+ *
+ * @param[in] m1
+ *         The order of the tile A1. m1 >= 0.
+ *
+ * @param[in] n1
+ *         The number of columns of A1 and A2. n1 = m1.
+ *
+ * @param[in] m2
+ *         The number of rows of A2. m2 >= 0.
+ *
+ * @param[in] n2
+ *         The number of columns of A2. n2 = m1.
+ *
+ * @param[in] m3
+ *         The order of the tile A3. m3 = m2.
+ *
+ * @param[in] n3
+ *         The number of columns of A3. n3 = m2.
+ *
+ * @param[in] k
+ *         The number of elementary reflectors whose product defines
+ *         the matrix Q. m1 >= k >= 0.
+ *
+ * @param[in] ib
+ *         The inner-blocking size. ib >= 0.
+ *
+ * @param[in,out] A1
+ *         On entry, the lower triangle of the m1-by-m1 tile A1.
+ *         On exit, the lower triangle of the updated tile.
+ *
+ * @param[in] lda1
+ *         The leading dimension of the array A1. lda1 >= max(1,m1).
+ *
+ * @param[in,out] A2
+ *         On entry, the m2-by-n2 tile A2. On exit, the updated tile.
+ *
+ * @param[in] lda2
+ *         The leading dimension of the array A2. lda2 >= max(1,m2).
+ *
+ * @param[in,out] A3
+ *         On entry, the lower triangle of the m3-by-m3 tile A3.
+ *         On exit, the lower triangle of the updated tile.
+ *
+ * @param[in] lda3
+ *         The leading dimension of the array A3. lda3 >= max(1,m3).
+ *
+ * @param[in] V
+ *         The m2-by-k reflectors, as returned by coreblas_ztsqrt in A2.
+ *
+ * @param[in] ldv
+ *         The leading dimension of the array V. ldv >= max(1,m2).
+ *
+ * @param[in] T
+ *         The ib-by-k triangular factor T of the block reflector.
+ *
+ * @param[in] ldt
+ *         The leading dimension of the array T. ldt >= ib.
+ *
+ * @param work
+ *         Workspace of length coreblas_ztsmqr_corner_lwork(m1, m2, ib).
+ *         The kernel does not allocate memory.
+ *
+ *******************************************************************************
+ *
+ * @retval CoreBlasSuccess successful exit
+ * @retval < 0 if -i, the i-th argument had an illegal value
+ *
+ ******************************************************************************/
+__attribute__((weak))
+int coreblas_ztsmqr_corner(int m1, int n1, int m2, int n2, int m3, int n3,
+                int k, int ib,
+                      coreblas_complex64_t *A1,   int lda1,
+                      coreblas_complex64_t *A2,   int lda2,
+                      coreblas_complex64_t *A3,   int lda3,
+                const coreblas_complex64_t *V,    int ldv,
+                const coreblas_complex64_t *T,    int ldt,
+                      coreblas_complex64_t *work)
+{
+#ifndef COREBLAS_UNCHECKED
+    // Check input arguments.
+    if (m1 < 0) {
+        coreblas_error("illegal value of m1");
+        return -1;
+    }
+    if (n1 != m1) {
+        coreblas_error("illegal value of n1");
+        return -2;
+    }
+    if (m2 < 0) {
+        coreblas_error("illegal value of m2");
+        return -3;
+    }
+    if (n2 != m1) {
+        coreblas_error("illegal value of n2");
+        return -4;
+    }
+    if (m3 != m2) {
+        coreblas_error("illegal value of m3");
+        return -5;
+    }
+    if (n3 != m2) {
+        coreblas_error("illegal value of n3");
+        return -6;
+    }
+    if (k < 0 || k > m1) {
+        coreblas_error("illegal value of k");
+        return -7;
+    }
+    if (ib < 0) {
+        coreblas_error("illegal value of ib");
+        return -8;
+    }
+    if (A1 == NULL) {
+        coreblas_error("NULL A1");
+        return -9;
+    }
+    if (lda1 < imax(1, m1)) {
+        coreblas_error("illegal value of lda1");
+        return -10;
+    }
+    if (A2 == NULL) {
+        coreblas_error("NULL A2");
+        return -11;
+    }
+    if (lda2 < imax(1, m2)) {
+        coreblas_error("illegal value of lda2");
+        return -12;
+    }
+    if (A3 == NULL) {
+        coreblas_error("NULL A3");
+        return -13;
+    }
+    if (lda3 < imax(1, m3)) {
+        coreblas_error("illegal value of lda3");
+        return -14;
+    }
+    if (V == NULL) {
+        coreblas_error("NULL V");
+        return -15;
+    }
+    if (ldv < imax(1, m2)) {
+        coreblas_error("illegal value of ldv");
+        return -16;
+    }
+    if (T == NULL) {
+        coreblas_error("NULL T");
+        return -17;
+    }
+    if (ldt < imax(1, ib)) {
+        coreblas_error("illegal value of ldt");
+        return -18;
+    }
+    if (work == NULL) {
+        coreblas_error("NULL work");
+        return -19;
+    }
+#endif
+
+    // quick return
+    if (m1 == 0 || m2 == 0 || k == 0 || ib == 0)
+        return CoreBlasSuccess;
+
+    // work holds the full tiles A1, A2^H and A3, then the work
+    // of coreblas_ztsmqr.
+    int ld = imax(m1, m2);
+    size_t tile = (size_t)ld*ld;
+    coreblas_complex64_t *W1 = work;
+    coreblas_complex64_t *W2 = &work[tile];
+    coreblas_complex64_t *W3 = &work[2*tile];
+    coreblas_complex64_t *W4 = &work[3*tile];
+
+    core_ztsmqr_rebuild(m1, A1, lda1, W1, ld);
+    for (int j = 0; j < n2; j++)
+        for (int i = 0; i < m2; i++)
+            W2[j + (size_t)ld*i] = conj(A2[i + (size_t)lda2*j]);
+    core_ztsmqr_rebuild(m3, A3, lda3, W3, ld);
+
+    // Left application on ( A1; A2 ) and ( A2^H; A3 ).
+    coreblas_ztsmqr_nocheck(CoreBlasLeft, CoreBlas_ConjTrans,
+                            m1, n1, m2, n2, k, ib,
+                            W1, ld, A2, lda2, V, ldv, T, ldt,
+                            W4, ib);
+    coreblas_ztsmqr_nocheck(CoreBlasLeft, CoreBlas_ConjTrans,
+                            n2, m2, m3, n3, k, ib,
+                            W2, ld, W3, ld, V, ldv, T, ldt,
+                            W4, ib);
+
+    // Right application on ( A1 A2^H ) and ( A2 A3 ).
+    coreblas_ztsmqr_nocheck(CoreBlasRight, CoreBlasNoTrans,
+                            m1, n1, n2, m2, k, ib,
+                            W1, ld, W2, ld, V, ldv, T, ldt,
+                            W4, m1);
+    coreblas_ztsmqr_nocheck(CoreBlasRight, CoreBlasNoTrans,
+                            m2, n2, m3, n3, k, ib,
+                            A2, lda2, W3, ld, V, ldv, T, ldt,
+                            W4, m2);
+
+    // Copy back the lower triangles of A1 and A3.
+    for (int j = 0; j < m1; j++)
+        for (int i = j; i < m1; i++)
+            A1[i + (size_t)lda1*j] = W1[i + (size_t)ld*j];
+    for (int j = 0; j < m3; j++)
+        for (int i = j; i < m3; i++)
+            A3[i + (size_t)lda3*j] = W3[i + (size_t)ld*j];
+
+    return CoreBlasSuccess;
+}
+
+/***************************************************************************//**
+ *
+ * @ingroup core_tsmqr
+ *
+ *  Returns the minimum length of the array work of coreblas_ztsmqr_corner
+ *  for the given dimensions: three ld-by-ld tiles followed by ld*ib
+ *  elements, with ld = max(m1,m2).
+ *
+ *******************************************************************************
+ *
+ * @param[in] m1
+ *         The order of the tile A1.
+ *
+ * @param[in] m2
+ *         The order of the tile A3.
+ *
+ * @param[in] ib
+ *         The inner-blocking size.
+ *
+ *******************************************************************************
+ *
+ * @retval the length of work, at least 1.
+ *
+ ******************************************************************************/
+size_t coreblas_ztsmqr_corner_lwork(int m1, int m2, int ib)
+{
+    size_t ld = (size_t)imax(1, imax(m1, m2));
+    return ld*(3*ld + (size_t)imax(1, ib));
+}
@@ -90,6 +90,7 @@ int coreblas_ztsqrt(int m, int n, int ib,
                 coreblas_complex64_t *tau,
                 coreblas_complex64_t *work)
 {
+#ifndef COREBLAS_UNCHECKED
     // Check input arguments.
     if (m < 0) {
         coreblas_error("illegal value of m");
@@ -135,13 +136,13 @@ int coreblas_ztsqrt(int m, int n, int ib,
         coreblas_error("NULL work");
         return -11;
     }
+#endif
 
     // quick return
     if (m == 0 || n == 0 || ib == 0)
         return CoreBlasSuccess;
 
     static coreblas_complex64_t zone  = 1.0;
-    static coreblas_complex64_t zzero = 0.0;
 
     for (int ii = 0; ii < n; ii += ib) {
         int sb = imin(n-ii, ib);
@@ -149,7 +150,7 @@ int coreblas_ztsqrt(int m, int n, int ib,
             // Generate elementary reflector H( II*IB+I ) to annihilate
             // A( II*IB+I:M, II*IB+I ).
             #ifdef COREBLAS_USE_64BIT_BLAS
-                LAPACKE_zlarfg64_(m+1, &A1[lda1*(ii+i)+ii+i], &A2[lda2*(ii+i)], 1,&tau[ii+i]);
+                LAPACKE_zlarfg_work64_(m+1, &A1[lda1*(ii+i)+ii+i], &A2[lda2*(ii+i)], 1,&tau[ii+i]);
             #else
                 LAPACKE_zlarfg_work(m+1, &A1[lda1*(ii+i)+ii+i], &A2[lda2*(ii+i)], 1,&tau[ii+i]);
             #endif
@@ -226,51 +227,54 @@ int coreblas_ztsqrt(int m, int n, int ib,
 #endif
 
             }
-            // Calculate T.
-            coreblas_complex64_t alpha = -tau[ii+i];
-            #ifdef COREBLAS_USE_64BIT_BLAS
-                cblas_zgemv64_(CblasColMajor, (CBLAS_TRANSPOSE)CoreBlas_ConjTrans,
-                            m, i,
-                            CBLAS_SADDR(alpha), &A2[lda2*ii], lda2,
-                            &A2[lda2*(ii+i)], 1,
-                            CBLAS_SADDR(zzero), &T[ldt*(ii+i)], 1);
-    
-                cblas_ztrmv64_(CblasColMajor, (CBLAS_UPLO)CoreBlasUpper,
-                            (CBLAS_TRANSPOSE)CoreBlasNoTrans,
-                            (CBLAS_DIAG)CoreBlasNonUnit,
-                            i,
-                            &T[ldt*ii], ldt,
-                            &T[ldt*(ii+i)], 1);
+        }
 
-            #else
-                cblas_zgemv(CblasColMajor, (CBLAS_TRANSPOSE)CoreBlas_ConjTrans,
-                            m, i,
-                            CBLAS_SADDR(alpha), &A2[lda2*ii], lda2,
-                            &A2[lda2*(ii+i)], 1,
-                            CBLAS_SADDR(zzero), &T[ldt*(ii+i)], 1);
-    
-                cblas_ztrmv(CblasColMajor, (CBLAS_UPLO)CoreBlasUpper,
-                            (CBLAS_TRANSPOSE)CoreBlasNoTrans,
-                            (CBLAS_DIAG)CoreBlasNonUnit,
-                            i,
-                            &T[ldt*ii], ldt,
-                            &T[ldt*(ii+i)], 1);
-            #endif
+        // Calculate T.
+        coreblas_zlarft_pent(CoreBlasColumnwise, m, sb, 0,
+                             &A2[lda2*ii], lda2,
+                             &tau[ii],
+                             &T[ldt*ii], ldt);
 
-            T[ldt*(ii+i)+i] = tau[ii+i];
-        }
         if (n > ii+sb) {
 
-        coreblas_ztsmqr(CoreBlasLeft, CoreBlas_ConjTrans,
-                        sb, n-(ii+sb), m, n-(ii+sb), ib, ib,
-                        &A1[lda1*(ii+sb)+ii], lda1,
-                        &A2[lda2*(ii+sb)], lda2,
-                        &A2[lda2*ii], lda2,
-                        &T[ldt*ii], ldt,
-                        work, sb);
+        coreblas_ztsmqr_nocheck(CoreBlasLeft, CoreBlas_ConjTrans,
+                                sb, n-(ii+sb), m, n-(ii+sb), ib, ib,
+                                &A1[lda1*(ii+sb)+ii], lda1,
+                                &A2[lda2*(ii+sb)], lda2,
+                                &A2[lda2*ii], lda2,
+                                &T[ldt*ii], ldt,
+                                work, sb);
 
         }
     }
 
     return CoreBlasSuccess;
-}
\ No newline at end of file
+}
+
+/***************************************************************************//**
+ *
+ * @ingroup core_tsqrt
+ *
+ *  Returns the minimum length of the array work of coreblas_ztsqrt
+ *  for the given dimensions.
+ *
+ *******************************************************************************
+ *
+ * @param[in] m
+ *         The number of rows of the tile A2.
+ *
+ * @param[in] n
+ *         The number of columns of the tiles A1 and A2.
+ *
+ * @param[in] ib
+ *         The inner-blocking size.
+ *
+ *******************************************************************************
+ *
+ * @retval the length of work, at least 1.
+ *
+ ******************************************************************************/
+size_t coreblas_ztsqrt_lwork(int m, int n, int ib)
+{
+    return imax(1, imin(ib, n))*(size_t)imax(1, n);
+}
@@ -0,0 +1,323 @@
+/**
+ *
+ * @file
+ *
+ *  COREBLAS is a software package provided by:
+ *  University of Tennessee, US,
+ *  University of Manchester, UK.
+ *
+ * @precisions normal z -> c d s
+ *
+ **/
+
+#include <coreblas.h>
+#include "coreblas_types.h"
+#include "coreblas_internal.h"
+#include "core_lapack.h"
+
+// This will be swapped during the automatic code generation.
+#undef REAL
+#define COMPLEX
+
+/***************************************************************************//**
+ *
+ * @ingroup core_tsrqt
+ *
+ * Computes an RQ factorization of a rectangular matrix
+ * formed by coupling an m-by-n tile A2
+ * on the left of an m-by-m upper triangular tile A1:
+ *
+ *    | A2 A1 | = | 0 R | * Q
+ *
+ *  The rows are eliminated from the last to the first, one block of ib
+ *  rows at a time, and the block reflectors are stored backward
+ *  (CoreBlasBackward) and rowwise, so that they are applied by
+ *  coreblas_ztsmrq with the same update as coreblas_ztsmlq.
+ *
+ *******************************************************************************
+ *
+ * @param[in] m
+ *         The number of rows of the tiles A1 and A2.
+ *         The number of columns of the tile A1. m >= 0.
+ *
+ * @param[in] n
+ *         The number of columns of the tile A2. n >= 0.
+ *
+ * @param[in] ib
+ *         The inner-blocking size.  ib >= 0.
+ *
+ * @param[in,out] A1
+ *         On entry, the m-by-m tile A1.
+ *         On exit, the elements on and above the diagonal of the array
+ *         contain the m-by-m upper triangular tile R;
+ *         the elements below the diagonal are not referenced.
+ *
+ * @param[in] lda1
+ *         The leading dimension of the array A1. lda1 >= max(1,m).
+ *
+ * @param[in,out] A2
+ *         On entry, the m-by-n tile A2.
+ *         On exit, all the elements with the array tau, represent
+ *         the unitary tile Q as a product of elementary reflectors
+ *         (see Further Details).
+ *
+ * @param[in] lda2
+ *         The leading dimension of the tile A2. lda2 >= max(1,m).
+ *
+ * @param[out] T
+ *         The ib-by-m triangular factor T of the block reflector.
+ *         T is lower triangular by block (economic storage);
+ *         The rest of the array is not referenced.
+ *
+ * @param[in] ldt
+ *         The leading dimension of the array T. ldt >= ib.
+ *
+ * @param tau
+ *         Auxiliary workspace array of length m.
+ *
+ * @param work
+ *         Auxiliary workspace array of length
+ *         coreblas_ztsrqt_lwork(m, n, ib).
+ *
+ *******************************************************************************
+ *
+ * @retval CoreBlasSuccess successful exit
+ * @retval < 0 if -i, the i-th argument had an illegal value
+ *
+ *******************************************************************************
+ *
+ * Further Details
+ * ===============
+ *
+ *  The matrix Q is represented as a product of elementary reflectors
+ *
+ *     Q = H(1)^H H(2)^H . . . H(m)^H
+ *
+ *  Each H(i) has the form
+ *
+ *     H(i) = I - tau * v * v^H
+ *
+ *  where tau is a scalar and v is a vector with v(n+i) = 1 and
+ *  v(n+1:n+m) = 0 elsewhere; conj(v(1:n)) is stored on exit in A2(i,1:n).
+ *
+ ******************************************************************************/
+__attribute__((weak))
+int coreblas_ztsrqt(int m, int n, int ib,
+                    coreblas_complex64_t *A1, int lda1,
+                    coreblas_complex64_t *A2, int lda2,
+                    coreblas_complex64_t *T,  int ldt,
+                    coreblas_complex64_t *tau,
+                    coreblas_complex64_t *work)
+{
+#ifndef COREBLAS_UNCHECKED
+    // Check input arguments.
+    if (m < 0) {
+        coreblas_error("illegal value of m");
+        return -1;
+    }
+    if (n < 0) {
+        coreblas_error("illegal value of n");
+        return -2;
+    }
+    if (ib < 0) {
+        coreblas_error("illegal value of ib");
+        return -3;
+    }
+    if (A1 == NULL) {
+        coreblas_error("NULL A1");
+        return -4;
+    }
+    if (lda1 < imax(1, m) && m > 0) {
+        coreblas_error("illegal value of lda1");
+        return -5;
+    }
+    if (A2 == NULL) {
+        coreblas_error("NULL A2");
+        return -6;
+    }
+    if (lda2 < imax(1, m) && m > 0) {
+        coreblas_error("illegal value of lda2");
+        return -7;
+    }
+    if (T == NULL) {
+        coreblas_error("NULL T");
+        return -8;
+    }
+    if (ldt < imax(1, ib) && ib > 0) {
+        coreblas_error("illegal value of ldt");
+        return -9;
+    }
+    if (tau == NULL) {
+        coreblas_error("NULL tau");
+        return -10;
+    }
+    if (work == NULL) {
+        coreblas_error("NULL work");
+        return -11;
+    }
+#endif
+
+    // quick return
+    if (m == 0 || n == 0 || ib == 0)
+        return CoreBlasSuccess;
+
+    static coreblas_complex64_t zone  = 1.0;
+    static coreblas_complex64_t zzero = 0.0;
+
+    for (int ii = ((m-1)/ib)*ib; ii >= 0; ii -= ib) {
+        int sb = imin(m-ii, ib);
+        for (int i = sb-1; i >= 0; i--) {
+            int j = ii+i;
+
+            // Generate elementary reflector H(j) to annihilate A2(j, 0:n).
+#ifdef COMPLEX
+#ifdef COREBLAS_USE_64BIT_BLAS
+            LAPACKE_zlacgv64_(n, &A2[j], lda2);
+            LAPACKE_zlacgv64_(1, &A1[lda1*j+j], lda1);
+#else
+            LAPACKE_zlacgv_work(n, &A2[j], lda2);
+            LAPACKE_zlacgv_work(1, &A1[lda1*j+j], lda1);
+#endif
+#endif
+
+#ifdef COREBLAS_USE_64BIT_BLAS
+            LAPACKE_zlarfg_work64_(n+1, &A1[lda1*j+j], &A2[j], lda2, &tau[j]);
+#else
+            LAPACKE_zlarfg_work(n+1, &A1[lda1*j+j], &A2[j], lda2, &tau[j]);
+#endif
+
+            coreblas_complex64_t alpha = -tau[j];
+            if (i > 0) {
+                // Apply H(j) to the rows ii:j-1 from the right.
+#ifdef COREBLAS_USE_64BIT_BLAS
+                cblas_zcopy64_(i, &A1[lda1*j+ii], 1, work, 1);
+
+                cblas_zgemv64_(CblasColMajor,
+                               (CBLAS_TRANSPOSE)CoreBlasNoTrans,
+                               i, n,
+                               CBLAS_SADDR(zone), &A2[ii], lda2,
+                                                  &A2[j],  lda2,
+                               CBLAS_SADDR(zone), work, 1);
+
+                cblas_zaxpy64_(i, CBLAS_SADDR(alpha), work, 1,
+                               &A1[lda1*j+ii], 1);
+
+                cblas_zgerc64_(CblasColMajor,
+                               i, n,
+                               CBLAS_SADDR(alpha), work, 1,
+                                                   &A2[j],  lda2,
+                                                   &A2[ii], lda2);
+#else
+                cblas_zcopy(i, &A1[lda1*j+ii], 1, work, 1);
+
+                cblas_zgemv(CblasColMajor,
+                            (CBLAS_TRANSPOSE)CoreBlasNoTrans,
+                            i, n,
+                            CBLAS_SADDR(zone), &A2[ii], lda2,
+                                               &A2[j],  lda2,
+                            CBLAS_SADDR(zone), work, 1);
+
+                cblas_zaxpy(i, CBLAS_SADDR(alpha), work, 1,
+                            &A1[lda1*j+ii], 1);
+
+                cblas_zgerc(CblasColMajor,
+                            i, n,
+                            CBLAS_SADDR(alpha), work, 1,
+                                                &A2[j],  lda2,
+                                                &A2[ii], lda2);
+#endif
+            }
+
+            // Calculate T.
+            // T(i+1:sb, i) = -tau * V(i+1:sb, :) * V(i, :)^H
+            if (i < sb-1) {
+#ifdef COREBLAS_USE_64BIT_BLAS
+                cblas_zgemv64_(CblasColMajor,
+                               (CBLAS_TRANSPOSE)CoreBlasNoTrans,
+                               sb-i-1, n,
+                               CBLAS_SADDR(alpha), &A2[j+1], lda2,
+                                                   &A2[j],   lda2,
+                               CBLAS_SADDR(zzero), &T[ldt*j+i+1], 1);
+#else
+                cblas_zgemv(CblasColMajor,
+                            (CBLAS_TRANSPOSE)CoreBlasNoTrans,
+                            sb-i-1, n,
+                            CBLAS_SADDR(alpha), &A2[j+1], lda2,
+                                                &A2[j],   lda2,
+                            CBLAS_SADDR(zzero), &T[ldt*j+i+1], 1);
+#endif
+            }
+
+#ifdef COMPLEX
+#ifdef COREBLAS_USE_64BIT_BLAS
+            LAPACKE_zlacgv64_(n, &A2[j], lda2);
+            LAPACKE_zlacgv64_(1, &A1[lda1*j+j], lda1);
+#else
+            LAPACKE_zlacgv_work(n, &A2[j], lda2);
+            LAPACKE_zlacgv_work(1, &A1[lda1*j+j], lda1);
+#endif
+#endif
+
+            // T(i+1:sb, i) = T(i+1:sb, i+1:sb) * T(i+1:sb, i)
+            if (i < sb-1) {
+#ifdef COREBLAS_USE_64BIT_BLAS
+                cblas_ztrmv64_(CblasColMajor, (CBLAS_UPLO)CoreBlasLower,
+                               (CBLAS_TRANSPOSE)CoreBlasNoTrans,
+                               (CBLAS_DIAG)CoreBlasNonUnit,
+                               sb-i-1,
+                               &T[ldt*(j+1)+i+1], ldt,
+                               &T[ldt*j+i+1], 1);
+#else
+                cblas_ztrmv(CblasColMajor, (CBLAS_UPLO)CoreBlasLower,
+                            (CBLAS_TRANSPOSE)CoreBlasNoTrans,
+                            (CBLAS_DIAG)CoreBlasNonUnit,
+                            sb-i-1,
+                            &T[ldt*(j+1)+i+1], ldt,
+                            &T[ldt*j+i+1], 1);
+#endif
+            }
+            T[ldt*j+i] = tau[j];
+        }
+
+        // Apply the block reflector to the rows above.
+        if (ii > 0) {
+            coreblas_ztsmrq_nocheck(CoreBlasRight, CoreBlas_ConjTrans,
+                                    ii, sb, ii, n, sb, ib,
+                                    &A1[lda1*ii], lda1,
+                                    A2, lda2,
+                                    &A2[ii], lda2,
+                                    &T[ldt*ii], ldt,
+                                    work, ii);
+        }
+    }
+
+    return CoreBlasSuccess;
+}
+
+/***************************************************************************//**
+ *
+ * @ingroup core_tsrqt
+ *
+ *  Returns the minimum length of the array work of coreblas_ztsrqt
+ *  for the given dimensions.
+ *
+ *******************************************************************************
+ *
+ * @param[in] m
+ *         The number of rows of the tiles A1 and A2.
+ *
+ * @param[in] n
+ *         The number of columns of the tile A2.
+ *
+ * @param[in] ib
+ *         The inner-blocking size.
+ *
+ *******************************************************************************
+ *
+ * @retval the length of work, at least 1.
+ *
+ ******************************************************************************/
+size_t coreblas_ztsrqt_lwork(int m, int n, int ib)
+{
+    return imax(1, imin(ib, m))*(size_t)imax(1, m);
+}
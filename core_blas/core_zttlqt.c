@@ -90,6 +90,7 @@ int coreblas_zttlqt(int m, int n, int ib,
                 coreblas_complex64_t *tau,
                 coreblas_complex64_t *work)
 {
+#ifndef COREBLAS_UNCHECKED
     // Check input arguments.
     if (m < 0) {
         coreblas_error("illegal value of m");
@@ -135,6 +136,7 @@ int coreblas_zttlqt(int m, int n, int ib,
         coreblas_error("NULL work");
         return -11;
     }
+#endif
 
     // quick return
     if ((m == 0) || (n == 0) || (ib == 0))
@@ -164,7 +166,7 @@ int coreblas_zttlqt(int m, int n, int ib,
 #endif
 
 #ifdef COREBLAS_USE_64BIT_BLAS
-        LAPACKE_zlarfg64_(ni+1, &A1[lda1*j+j], &A2[j], lda2, &tau[j]);
+        LAPACKE_zlarfg_work64_(ni+1, &A1[lda1*j+j], &A2[j], lda2, &tau[j]);
 #else
         LAPACKE_zlarfg_work(ni+1, &A1[lda1*j+j], &A2[j], lda2, &tau[j]);
 #endif
@@ -226,46 +228,6 @@ int coreblas_zttlqt(int m, int n, int ib,
 
             }
 
-            // Calculate T.
-            if (i > 0 ) {
-                int l = imin(i, imax(0, n-ii));
-                alpha = -(tau[j]);
-                #ifdef COREBLAS_USE_64BIT_BLAS
-                    coreblas_zpemv64_(
-                        CoreBlasNoTrans, CoreBlasRowwise,
-                        i, imin(j, n), l,
-                        alpha, &A2[ii], lda2,
-                        &A2[j], lda2,
-                        0.0, &T[ldt*j], 1,
-                        work);
-
-                    // T(0:i-1, j) = T(0:i-1, ii:j-1) * T(0:i-1, j)
-                    cblas_ztrmv64_(
-                        CblasColMajor, (CBLAS_UPLO)CoreBlasUpper,
-                        (CBLAS_TRANSPOSE)CoreBlasNoTrans,
-                        (CBLAS_DIAG)CoreBlasNonUnit,
-                        i, &T[ldt*ii], ldt,
-                        &T[ldt*j], 1);
-                #else
-                    coreblas_zpemv(
-                        CoreBlasNoTrans, CoreBlasRowwise,
-                        i, imin(j, n), l,
-                        alpha, &A2[ii], lda2,
-                        &A2[j], lda2,
-                        0.0, &T[ldt*j], 1,
-                        work);
-
-                    // T(0:i-1, j) = T(0:i-1, ii:j-1) * T(0:i-1, j)
-                    cblas_ztrmv(
-                        CblasColMajor, (CBLAS_UPLO)CoreBlasUpper,
-                        (CBLAS_TRANSPOSE)CoreBlasNoTrans,
-                        (CBLAS_DIAG)CoreBlasNonUnit,
-                        i, &T[ldt*ii], ldt,
-                        &T[ldt*j], 1);
-                #endif
-
-            }
-
 #ifdef COMPLEX
 #ifdef COREBLAS_USE_64BIT_BLAS
     LAPACKE_zlacgv64_(ni, &A2[j], lda2 );
@@ -276,16 +238,24 @@ int coreblas_zttlqt(int m, int n, int ib,
 #endif
 
 #endif
-            T[ldt*j+i] = tau[j];
         }
 
+        // The reflectors of the block have ni columns, the last l of
+        // which form the lower trapezoid of A2.
+        int ni = imin(ii+sb, n);
+        int l  = imin(sb, imax(0, ni-ii));
+
+        // Calculate T.
+        coreblas_zlarft_pent(CoreBlasRowwise, ni, sb, l,
+                             &A2[ii], lda2,
+                             &tau[ii],
+                             &T[ldt*ii], ldt);
+
         // Apply Q to the rest of the matrix to the right.
         if (m > ii+sb) {
             int mi = m-(ii+sb);
-            int ni = imin(ii+sb, n);
-            int l  = imin(sb, imax(0, ni-ii));
 
-                coreblas_zparfb(
+                coreblas_zparfb_nocheck(
                     CoreBlasRight, CoreBlasNoTrans,
                     CoreBlasForward, CoreBlasRowwise,
                     mi, ib, mi, ni, sb, l,
@@ -300,3 +270,31 @@ int coreblas_zttlqt(int m, int n, int ib,
     }
     return CoreBlasSuccess;
 }
+
+/***************************************************************************//**
+ *
+ * @ingroup core_ttlqt
+ *
+ *  Returns the minimum length of the array work of coreblas_zttlqt
+ *  for the given dimensions.
+ *
+ *******************************************************************************
+ *
+ * @param[in] m
+ *         The number of rows of the tiles A1 and A2.
+ *
+ * @param[in] n
+ *         The number of columns of the tile A2.
+ *
+ * @param[in] ib
+ *         The inner-blocking size.
+ *
+ *******************************************************************************
+ *
+ * @retval the length of work, at least 1.
+ *
+ ******************************************************************************/
+size_t coreblas_zttlqt_lwork(int m, int n, int ib)
+{
+    return imax(1, imin(ib, m))*(size_t)imax(1, m);
+}
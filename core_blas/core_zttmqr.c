@@ -38,6 +38,13 @@
  *
  *  as returned by coreblas_zttqrt.
  *
+ *  V is upper triangular: the block of reflectors i:i+kb-1 is applied to
+ *  the first i+kb rows (columns on the right) of A2 only, through
+ *  coreblas_zparfb with l = kb, so that coreblas_zpamm multiplies the
+ *  last kb of them by the triangular part of V with trmm and the others
+ *  by its rectangular part with gemm. The update costs about half of
+ *  that of coreblas_ztsmqr.
+ *
  *******************************************************************************
  *
  * @param[in] side
@@ -124,6 +131,7 @@ int coreblas_zttmqr(coreblas_enum_t side, coreblas_enum_t trans,
                 const coreblas_complex64_t *T,    int ldt,
                       coreblas_complex64_t *work, int ldwork)
 {
+#ifndef COREBLAS_UNCHECKED
     // Check input arguments.
     if ((side != CoreBlasLeft) && (side != CoreBlasRight)) {
         coreblas_error("illegal value of side");
@@ -200,6 +208,7 @@ int coreblas_zttmqr(coreblas_enum_t side, coreblas_enum_t trans,
         coreblas_error("Illegal value of ldwork");
         return -18;
     }
+#endif
 
     // quick return
     if (m1 == 0 || n1 == 0 || m2 == 0 || n2 == 0 || k == 0 || ib == 0)
@@ -241,15 +250,53 @@ int coreblas_zttmqr(coreblas_enum_t side, coreblas_enum_t trans,
             l  = imin(kb, imax(0, n2-i));
         }
 
-                // Apply H or H^H (NOTE: coreblas_zparfb used to be core_zttrfb).
-            coreblas_zparfb(side, trans, CoreBlasForward, CoreBlasColumnwise,
-                    mi, ni, mi2, ni2, kb, l,
-                    &A1[lda1*jc+ic], lda1,
-                    A2, lda2,
-                    &V[ldv*i], ldv,
-                    &T[ldt*i], ldt,
-                    work, ldwork);
+        // Apply H or H^H (NOTE: coreblas_zparfb used to be core_zttrfb).
+        coreblas_zparfb_nocheck(side, trans,
+                                CoreBlasForward, CoreBlasColumnwise,
+                                mi, ni, mi2, ni2, kb, l,
+                                &A1[lda1*jc+ic], lda1,
+                                A2, lda2,
+                                &V[ldv*i], ldv,
+                                &T[ldt*i], ldt,
+                                work, ldwork);
     }
 
     return CoreBlasSuccess;
-}
\ No newline at end of file
+}
+
+/***************************************************************************//**
+ *
+ * @ingroup core_ttmqr
+ *
+ *  Returns the minimum length of the array work of coreblas_zttmqr
+ *  for the given dimensions.
+ *  The leading dimension is ldwork = max(1,ib) on the left
+ *  and ldwork = max(1,m1) on the right.
+ *
+ *******************************************************************************
+ *
+ * @param[in] side
+ *         - CoreBlasLeft  : apply from the Left;
+ *         - CoreBlasRight : apply from the Right.
+ *
+ * @param[in] m1
+ *         The number of rows of the tile A1.
+ *
+ * @param[in] n1
+ *         The number of columns of the tile A1.
+ *
+ * @param[in] ib
+ *         The inner-blocking size.
+ *
+ *******************************************************************************
+ *
+ * @retval the length of work, at least 1.
+ *
+ ******************************************************************************/
+size_t coreblas_zttmqr_lwork(coreblas_enum_t side, int m1, int n1, int ib)
+{
+    if (side == CoreBlasLeft)
+        return imax(1, ib)*(size_t)imax(1, n1);
+    else
+        return imax(1, m1)*(size_t)imax(1, ib);
+}
@@ -90,6 +90,7 @@ int coreblas_zttqrt(int m, int n, int ib,
                 coreblas_complex64_t *tau,
                 coreblas_complex64_t *work)
 {
+#ifndef COREBLAS_UNCHECKED
     // Check input arguments.
     if (m < 0) {
         coreblas_error("illegal value of m");
@@ -135,6 +136,7 @@ int coreblas_zttqrt(int m, int n, int ib,
         coreblas_error("NULL work");
         return -11;
     }
+#endif
 
     // quick return
     if ((m == 0) || (n == 0) || (ib == 0))
@@ -152,11 +154,11 @@ int coreblas_zttqrt(int m, int n, int ib,
             int ni = sb-i-1;
     #ifdef COREBLAS_USE_64BIT_BLAS
                 // Generate elementary reflector H(j) to annihilate A2(1:mi, j).
-        LAPACKE_zlarfg64_(
+        LAPACKE_zlarfg_work64_(
                     mi+1, &A1[lda1*j+j], &A2[lda2*j], 1, &tau[j]);
     #else
                 // Generate elementary reflector H(j) to annihilate A2(1:mi, j).
-        LAPACKE_zlarfg(
+        LAPACKE_zlarfg_work(
                     mi+1, &A1[lda1*j+j], &A2[lda2*j], 1, &tau[j]);
     #endif
 
@@ -178,9 +180,9 @@ int coreblas_zttqrt(int m, int n, int ib,
 
 #ifdef COMPLEX
     #ifdef COREBLAS_USE_64BIT_BLAS
-        LAPACKE_zlacgv64_(ni, work, 1);
+        LAPACKE_zlacgv_work64_(ni, work, 1);
     #else
-        LAPACKE_zlacgv(ni, work, 1);
+        LAPACKE_zlacgv_work(ni, work, 1);
     #endif
                 
 #endif
@@ -203,9 +205,9 @@ int coreblas_zttqrt(int m, int n, int ib,
 
 #ifdef COMPLEX
     #ifdef COREBLAS_USE_64BIT_BLAS
-        LAPACKE_zlacgv64_(ni, work, 1);
+        LAPACKE_zlacgv_work64_(ni, work, 1);
     #else
-        LAPACKE_zlacgv(ni, work, 1);
+        LAPACKE_zlacgv_work(ni, work, 1);
     #endif               
 #endif
                 coreblas_complex64_t alpha = -conj(tau[j]);
@@ -223,9 +225,9 @@ int coreblas_zttqrt(int m, int n, int ib,
 
 #ifdef COMPLEX
     #ifdef COREBLAS_USE_64BIT_BLAS
-        LAPACKE_zlacgv64_(ni, work, 1);
+        LAPACKE_zlacgv_work64_(ni, work, 1);
     #else
-        LAPACKE_zlacgv(ni, work, 1);
+        LAPACKE_zlacgv_work(ni, work, 1);
     #endif               
 #endif
 
@@ -244,48 +246,24 @@ int coreblas_zttqrt(int m, int n, int ib,
     #endif
 
             }
+        }
 
-            // Calculate T.
-            // T(0:i-1, j) = alpha * A2(0:m-1, ii:j-1)^H * A2(0:m-1, j)
-            if (i > 0) {
-                int l = imin(i, imax(0, m-ii));
-                coreblas_complex64_t alpha = -(tau[j]);
-            coreblas_zpemv(
-                CoreBlas_ConjTrans, CoreBlasColumnwise,
-                imin(j, m), i, l,
-                alpha, &A2[lda2*ii], lda2,
-                       &A2[lda2*j],  1,
-                0.0, &T[ldt*j],    1,
-                work);
-    #ifdef COREBLAS_USE_64BIT_BLAS
-         // T(0:i-1, j) = T(0:i-1, ii:j-1) * T(0:i-1, j)
-        cblas_ztrmv64_(
-                CblasColMajor, (CBLAS_UPLO)CoreBlasUpper,
-                (CBLAS_TRANSPOSE)CoreBlasNoTrans,
-                (CBLAS_DIAG)CoreBlasNonUnit,
-                i, &T[ldt*ii], ldt,
-                   &T[ldt*j], 1);
-    #else
-         // T(0:i-1, j) = T(0:i-1, ii:j-1) * T(0:i-1, j)
-        cblas_ztrmv(
-                CblasColMajor, (CBLAS_UPLO)CoreBlasUpper,
-                (CBLAS_TRANSPOSE)CoreBlasNoTrans,
-                (CBLAS_DIAG)CoreBlasNonUnit,
-                i, &T[ldt*ii], ldt,
-                   &T[ldt*j], 1);
-    #endif
+        // The reflectors of the block have mi rows, the last l of which
+        // form the upper trapezoid of A2.
+        int mi = imin(ii+sb, m);
+        int l  = imin(sb, imax(0, mi-ii));
 
-            }
-            T[ldt*j+i] = tau[j];
-        }
+        // Calculate T.
+        coreblas_zlarft_pent(CoreBlasColumnwise, mi, sb, l,
+                             &A2[lda2*ii], lda2,
+                             &tau[ii],
+                             &T[ldt*ii], ldt);
 
         // Apply Q^H to the rest of the matrix from the left.
         if (n > ii+sb) {
-            int mi = imin(ii+sb, m);
             int ni = n-(ii+sb);
-            int l  = imin(sb, imax(0, mi-ii));
 
-    coreblas_zparfb(
+    coreblas_zparfb_nocheck(
         CoreBlasLeft, CoreBlas_ConjTrans,
         CoreBlasForward, CoreBlasColumnwise,
         ib, ni, mi, ni, sb, l,             //replaced sb by ib
@@ -299,4 +277,32 @@ int coreblas_zttqrt(int m, int n, int ib,
     }
 
     return CoreBlasSuccess;
-}
\ No newline at end of file
+}
+
+/***************************************************************************//**
+ *
+ * @ingroup core_ttqrt
+ *
+ *  Returns the minimum length of the array work of coreblas_zttqrt
+ *  for the given dimensions.
+ *
+ *******************************************************************************
+ *
+ * @param[in] m
+ *         The number of rows of the tile A2.
+ *
+ * @param[in] n
+ *         The number of columns of the tiles A1 and A2.
+ *
+ * @param[in] ib
+ *         The inner-blocking size.
+ *
+ *******************************************************************************
+ *
+ * @retval the length of work, at least 1.
+ *
+ ******************************************************************************/
+size_t coreblas_zttqrt_lwork(int m, int n, int ib)
+{
+    return imax(1, imin(ib, n))*(size_t)imax(1, n);
+}
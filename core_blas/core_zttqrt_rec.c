@@ -0,0 +1,343 @@
+/**
+ *
+ * @file
+ *
+ *  COREBLAS is a software package provided by:
+ *  University of Tennessee, US,
+ *  University of Manchester, UK.
+ *
+ * @precisions normal z -> c d s
+ *
+ **/
+
+#include <coreblas.h>
+#include "coreblas_types.h"
+#include "coreblas_internal.h"
+#include "core_lapack.h"
+
+// Panels of at most this many columns are factored one column at a time.
+#define COREBLAS_TTQRT_LEAF 8
+
+/******************************************************************************/
+// Factors the n-by-n triangle A1 on top of the columns j0:j0+n of the
+// m-by-n upper triangular tile A2 one column at a time and accumulates
+// the n-by-n triangular factor T column by column.
+// A2 points to column j0; its column i has imin(j0+i+1, m) rows.
+static void core_zttqrt_leaf(int m, int j0, int n,
+                             coreblas_complex64_t *A1, int lda1,
+                             coreblas_complex64_t *A2, int lda2,
+                             coreblas_complex64_t *T,  int ldt,
+                             coreblas_complex64_t *tau,
+                             coreblas_complex64_t *work)
+{
+    static coreblas_complex64_t zone = 1.0;
+
+    for (int i = 0; i < n; i++) {
+        int mi = imin(j0+i+1, m);
+
+        // Generate elementary reflector H(i) to annihilate A2(0:mi, i).
+#ifdef COREBLAS_USE_64BIT_BLAS
+        LAPACKE_zlarfg_work64_(mi+1, &A1[lda1*i+i], &A2[lda2*i], 1, &tau[i]);
+#else
+        LAPACKE_zlarfg_work(mi+1, &A1[lda1*i+i], &A2[lda2*i], 1, &tau[i]);
+#endif
+
+        int ni = n-i-1;
+        if (ni > 0) {
+            // Apply H(i)^H to [ A1(i, i+1:n); A2(0:mi, i+1:n) ] from the left.
+            // w = A1(i, i+1:n)^H + A2(0:mi, i+1:n)^H v
+            coreblas_complex64_t alpha = -conj(tau[i]);
+            for (int j = 0; j < ni; j++)
+                work[j] = conj(A1[lda1*(i+1+j)+i]);
+#ifdef COREBLAS_USE_64BIT_BLAS
+            cblas_zgemv64_(CblasColMajor, (CBLAS_TRANSPOSE)CoreBlas_ConjTrans,
+                           mi, ni,
+                           CBLAS_SADDR(zone), &A2[lda2*(i+1)], lda2,
+                                              &A2[lda2*i], 1,
+                           CBLAS_SADDR(zone), work, 1);
+#else
+            cblas_zgemv(CblasColMajor, (CBLAS_TRANSPOSE)CoreBlas_ConjTrans,
+                        mi, ni,
+                        CBLAS_SADDR(zone), &A2[lda2*(i+1)], lda2,
+                                           &A2[lda2*i], 1,
+                        CBLAS_SADDR(zone), work, 1);
+#endif
+            for (int j = 0; j < ni; j++)
+                A1[lda1*(i+1+j)+i] += alpha*conj(work[j]);
+#ifdef COREBLAS_USE_64BIT_BLAS
+            cblas_zgerc64_(CblasColMajor,
+                           mi, ni,
+                           CBLAS_SADDR(alpha), &A2[lda2*i], 1,
+                                               work, 1,
+                                               &A2[lda2*(i+1)], lda2);
+#else
+            cblas_zgerc(CblasColMajor,
+                        mi, ni,
+                        CBLAS_SADDR(alpha), &A2[lda2*i], 1,
+                                            work, 1,
+                                            &A2[lda2*(i+1)], lda2);
+#endif
+        }
+
+        // T(0:i, i) = -tau(i) T(0:i, 0:i) A2(0:mi, 0:i)^H A2(0:mi, i)
+        if (i > 0) {
+            int l = imin(i, imax(0, m-j0));
+            coreblas_zpemv(CoreBlas_ConjTrans, CoreBlasColumnwise,
+                           imin(j0+i, m), i, l,
+                           -tau[i], A2, lda2,
+                                    &A2[lda2*i], 1,
+                           0.0,     &T[ldt*i], 1,
+                           work);
+#ifdef COREBLAS_USE_64BIT_BLAS
+            cblas_ztrmv64_(CblasColMajor, CblasUpper,
+                           CblasNoTrans, CblasNonUnit,
+                           i,
+                           T, ldt,
+                           &T[ldt*i], 1);
+#else
+            cblas_ztrmv(CblasColMajor, CblasUpper,
+                        CblasNoTrans, CblasNonUnit,
+                        i,
+                        T, ldt,
+                        &T[ldt*i], 1);
+#endif
+        }
+        T[ldt*i+i] = tau[i];
+    }
+}
+
+/******************************************************************************/
+// Recursive tt QR factorization of the n-by-n triangle A1 on top of the
+// columns j0:j0+n of the m-by-n upper triangular tile A2.
+// The left half of the columns is factored and applied to the right half
+// with zparfb, the right half is factored, and the off-diagonal block
+// of T is merged with level 3 operations by coreblas_zlarft_pent_merge:
+//     T12 = -T11 (V1^H V2) T22.
+// V1 is pentagonal: mf = min(j0, m) full rows on top of an l-by-n1
+// upper trapezoid, so V1^H V2 is a GEMM on the full rows plus
+// a TRMM/GEMM on the trapezoid.
+static void core_zttqrt_rec(int m, int j0, int n,
+                            coreblas_complex64_t *A1, int lda1,
+                            coreblas_complex64_t *A2, int lda2,
+                            coreblas_complex64_t *T,  int ldt,
+                            coreblas_complex64_t *tau,
+                            coreblas_complex64_t *work)
+{
+    if (n <= COREBLAS_TTQRT_LEAF) {
+        core_zttqrt_leaf(m, j0, n, A1, lda1, A2, lda2, T, ldt, tau, work);
+        return;
+    }
+
+    int n1 = n/2;
+    int n2 = n-n1;
+    int mf = imin(j0, m);
+    int m1 = imin(j0+n1, m);
+    int l  = m1-mf;
+
+    coreblas_complex64_t *T22 = &T[ldt*n1+n1];
+    coreblas_complex64_t *V2  = &A2[lda2*n1];
+
+    core_zttqrt_rec(m, j0, n1, A1, lda1, A2, lda2, T, ldt, tau, work);
+
+    coreblas_zparfb_nocheck(CoreBlasLeft, CoreBlas_ConjTrans,
+                            CoreBlasForward, CoreBlasColumnwise,
+                            n1, n2, m1, n2, n1, l,
+                            &A1[lda1*n1], lda1,
+                            V2, lda2,
+                            A2, lda2,
+                            T,  ldt,
+                            work, n1);
+
+    core_zttqrt_rec(m, j0+n1, n2, &A1[lda1*n1+n1], lda1, V2, lda2,
+                    T22, ldt, &tau[n1], work);
+
+    // T12 = -T11 (V1^H V2) T22, where the reflectors of this panel run
+    // over the first mp rows of A2, the last mp-mf of which are upper
+    // trapezoidal.
+    int mp = imin(j0+n, m);
+    coreblas_zlarft_pent_merge(CoreBlasColumnwise, mp, n1, n2, mp-mf,
+                               A2, lda2, T, ldt);
+}
+
+/***************************************************************************//**
+ *
+ * @ingroup core_ttqrt
+ *
+ * Computes a QR factorization of a rectangular matrix
+ * formed by coupling an n-by-n upper triangular tile A1
+ * on top of an m-by-n upper triangular tile A2:
+ *
+ *    | A1 | = Q * R
+ *    | A2 |
+ *
+ * Same as coreblas_zttqrt, but each ib-wide panel is factored recursively
+ * (Elmroth-Gustavson), so that most of the panel operations are level 3
+ * BLAS. The output has the same layout as coreblas_zttqrt and can be
+ * applied with coreblas_zttmqr.
+ *
+ *******************************************************************************
+ *
+ * @param[in] m
+ *         The number of rows of the tile A2. m >= 0.
+ *
+ * @param[in] n
+ *         The number of rows of the tile A1.
+ *         The number of columns of the tiles A1 and A2. n >= 0.
+ *
+ * @param[in] ib
+ *         The inner-blocking size.  ib >= 0.
+ *
+ * @param[in,out] A1
+ *         On entry, the n-by-n tile A1.
+ *         On exit, the elements on and above the diagonal of the array
+ *         contain the n-by-n upper trapezoidal tile R;
+ *         the elements below the diagonal are not referenced.
+ *
+ * @param[in] lda1
+ *         The leading dimension of the array A1. lda1 >= max(1,n).
+ *
+ * @param[in,out] A2
+ *         On entry, the m-by-n upper triangular tile A2.
+ *         On exit, the elements on and above the diagonal of the array
+ *         with the matrix T represent
+ *         the unitary tile Q as a product of elementary reflectors
+ *
+ * @param[in] lda2
+ *         The leading dimension of the tile A2. lda2 >= max(1,m).
+ *
+ * @param[out] T
+ *         The ib-by-n triangular factor T of the block reflector.
+ *         T is upper triangular by block (economic storage);
+ *         The rest of the array is not referenced.
+ *
+ * @param[in] ldt
+ *         The leading dimension of the array T. ldt >= ib.
+ *
+ * @param tau
+ *         Auxiliary workspace array of length n.
+ *
+ * @param work
+ *         Auxiliary workspace array of length ib*n.
+ *
+ *******************************************************************************
+ *
+ * @retval CoreBlasSuccess successful exit
+ * @retval < 0 if -i, the i-th argument had an illegal value
+ *
+ ******************************************************************************/
+__attribute__((weak))
+int coreblas_zttqrt_rec(int m, int n, int ib,
+                        coreblas_complex64_t *A1, int lda1,
+                        coreblas_complex64_t *A2, int lda2,
+                        coreblas_complex64_t *T,  int ldt,
+                        coreblas_complex64_t *tau,
+                        coreblas_complex64_t *work)
+{
+#ifndef COREBLAS_UNCHECKED
+    // Check input arguments.
+    if (m < 0) {
+        coreblas_error("illegal value of m");
+        return -1;
+    }
+    if (n < 0) {
+        coreblas_error("illegal value of n");
+        return -2;
+    }
+    if (ib < 0) {
+        coreblas_error("illegal value of ib");
+        return -3;
+    }
+    if (A1 == NULL) {
+        coreblas_error("NULL A1");
+        return -4;
+    }
+    if (lda1 < imax(1, n) && n > 0) {
+        coreblas_error("illegal value of lda1");
+        return -5;
+    }
+    if (A2 == NULL) {
+        coreblas_error("NULL A2");
+        return -6;
+    }
+    if (lda2 < imax(1, m) && m > 0) {
+        coreblas_error("illegal value of lda2");
+        return -7;
+    }
+    if (T == NULL) {
+        coreblas_error("NULL T");
+        return -8;
+    }
+    if (ldt < imax(1, ib) && ib > 0) {
+        coreblas_error("illegal value of ldt");
+        return -9;
+    }
+    if (tau == NULL) {
+        coreblas_error("NULL tau");
+        return -10;
+    }
+    if (work == NULL) {
+        coreblas_error("NULL work");
+        return -11;
+    }
+#endif
+
+    // quick return
+    if ((m == 0) || (n == 0) || (ib == 0))
+        return CoreBlasSuccess;
+
+    for (int ii = 0; ii < n; ii += ib) {
+        int sb = imin(n-ii, ib);
+
+        core_zttqrt_rec(m, ii, sb,
+                        &A1[lda1*ii+ii], lda1,
+                        &A2[lda2*ii], lda2,
+                        &T[ldt*ii], ldt,
+                        &tau[ii], work);
+
+        // Apply Q^H to the rest of the matrix from the left.
+        if (n > ii+sb) {
+            int mi = imin(ii+sb, m);
+            int ni = n-(ii+sb);
+            int l  = imin(sb, imax(0, mi-ii));
+
+            coreblas_zparfb_nocheck(CoreBlasLeft, CoreBlas_ConjTrans,
+                                    CoreBlasForward, CoreBlasColumnwise,
+                                    sb, ni, mi, ni, sb, l,
+                                    &A1[lda1*(ii+sb)+ii], lda1,
+                                    &A2[lda2*(ii+sb)], lda2,
+                                    &A2[lda2*ii], lda2,
+                                    &T[ldt*ii], ldt,
+                                    work, sb);
+        }
+    }
+
+    return CoreBlasSuccess;
+}
+
+/***************************************************************************//**
+ *
+ * @ingroup core_ttqrt
+ *
+ *  Returns the minimum length of the array work of coreblas_zttqrt_rec
+ *  for the given dimensions.
+ *
+ *******************************************************************************
+ *
+ * @param[in] m
+ *         The number of rows of the tile A2.
+ *
+ * @param[in] n
+ *         The number of columns of the tiles A1 and A2.
+ *
+ * @param[in] ib
+ *         The inner-blocking size.
+ *
+ *******************************************************************************
+ *
+ * @retval the length of work, at least 1.
+ *
+ ******************************************************************************/
+size_t coreblas_zttqrt_rec_lwork(int m, int n, int ib)
+{
+    return imax(1, imin(ib, n))*(size_t)imax(1, n);
+}
@@ -86,14 +86,14 @@
  *         The leading dimension of the array C. ldc >= max(1,m).
  *
  * @param work
- *         Auxiliary workspace array of length
- *         ldwork-by-m   if side == CoreBlasLeft
- *         ldwork-by-ib  if side == CoreBlasRight
+ *         Auxiliary workspace array of length ldwork*ib + ib*ib:
+ *         the ldwork-by-ib product of C and V, followed by a copy of
+ *         the ib-by-ib triangle of V. The kernel does not allocate memory.
  *
  * @param[in] ldwork
  *         The leading dimension of the array work.
- *             ldwork >= max(1,ib) if side == CoreBlasLeft
- *             ldwork >= max(1,n)  if side == CoreBlasRight
+ *             ldwork >= max(1,n) if side == CoreBlasLeft
+ *             ldwork >= max(1,m) if side == CoreBlasRight
  *
  *******************************************************************************
  *
@@ -109,6 +109,7 @@ int coreblas_zunmlq(coreblas_enum_t side, coreblas_enum_t trans,
                       coreblas_complex64_t *C,    int ldc,
                       coreblas_complex64_t *work, int ldwork)
 {
+#ifndef COREBLAS_UNCHECKED
     // Check input arguments.
     if ((side != CoreBlasLeft) && (side != CoreBlasRight)) {
         coreblas_error("illegal value of side");
@@ -179,6 +180,7 @@ int coreblas_zunmlq(coreblas_enum_t side, coreblas_enum_t trans,
         coreblas_error("illegal value of ldwork");
         return -14;
     }
+#endif
 
     // quick return
     if (m == 0 || n == 0 || k == 0)
@@ -218,32 +220,66 @@ int coreblas_zunmlq(coreblas_enum_t side, coreblas_enum_t trans,
             ni = n - i;
             jc = i;
         }
-    #ifdef COREBLAS_USE_64BIT_BLAS
-            // Apply H or H^H.
-        LAPACKE_zlarfb64_(LAPACK_COL_MAJOR,
-                            lapack_const(side),
-                            lapack_const(trans),
-                            lapack_const(CoreBlasForward),
-                            lapack_const(CoreBlasRowwise),
-                            mi, ni, kb,
-                            &A[lda*i+i], lda,
-                            &T[ldt*i], ldt,
-                            &C[ldc*jc+ic], ldc);
-    #else
-            // Apply H or H^H.
-        LAPACKE_zlarfb_work(LAPACK_COL_MAJOR,
-                            lapack_const(side),
-                            lapack_const(trans),
-                            lapack_const(CoreBlasForward),
-                            lapack_const(CoreBlasRowwise),
-                            mi, ni, kb,
-                            &A[lda*i+i], lda,
-                            &T[ldt*i], ldt,
-                            &C[ldc*jc+ic], ldc,
-                            work, ldwork);
-    #endif
 
+        // larfb_gemm_split multiplies by the leading kb-by-kb triangle V1
+        // of V with a gemm, so V1 is copied after W with its zeros and
+        // unit diagonal made explicit. The rest of V is read in place.
+        coreblas_complex64_t *V1 = &work[(size_t)ldwork*ib];
+        for (int j = 0; j < kb; j++) {
+            for (int l = 0; l < j; l++)
+                V1[kb*j+l] = A[lda*(i+j)+(i+l)];
+            V1[kb*j+j] = 1.0;
+            for (int l = j+1; l < kb; l++)
+                V1[kb*j+l] = 0.0;
+        }
+
+        // Apply H or H^H.
+        coreblas_zlarfb_gemm_split(side, trans,
+                                   mi, ni, kb,
+                                   V1,                 kb,
+                                   &A[lda*(i+kb)+i],   lda,
+                                   &T[ldt*i],          ldt,
+                                   &C[ldc*jc+ic],      ldc,
+                                   work, ldwork);
     }
 
     return CoreBlasSuccess;
-}
\ No newline at end of file
+}
+
+/***************************************************************************//**
+ *
+ * @ingroup core_unmlq
+ *
+ *  Returns the minimum length of the array work of coreblas_zunmlq
+ *  for the given dimensions.
+ *  The leading dimension is ldwork = max(1,n) on the left
+ *  and ldwork = max(1,m) on the right.
+ *
+ *******************************************************************************
+ *
+ * @param[in] side
+ *         - CoreBlasLeft  : apply from the Left;
+ *         - CoreBlasRight : apply from the Right.
+ *
+ * @param[in] m
+ *         The number of rows of the tile C.
+ *
+ * @param[in] n
+ *         The number of columns of the tile C.
+ *
+ * @param[in] ib
+ *         The inner-blocking size.
+ *
+ *******************************************************************************
+ *
+ * @retval the length of work, at least 1.
+ *
+ ******************************************************************************/
+size_t coreblas_zunmlq_lwork(coreblas_enum_t side, int m, int n, int ib)
+{
+    size_t sib = (size_t)imax(0, ib);
+    if (side == CoreBlasLeft)
+        return imax(1, n)*(size_t)imax(1, ib) + sib*sib;
+    else
+        return imax(1, m)*(size_t)imax(1, ib) + sib*sib;
+}
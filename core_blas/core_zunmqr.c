@@ -88,14 +88,13 @@
  *         The leading dimension of the array C. ldc >= max(1,m).
  *
  * @param work
- *         Auxiliary workspace array of length
- *         ldwork-by-n  if side == CoreBlasLeft
- *         ldwork-by-ib if side == CoreBlasRight
+ *         Auxiliary workspace array of size ldwork-by-ib.
+ *         The kernel does not allocate memory.
  *
  * @param[in] ldwork
  *         The leading dimension of the array work.
- *             ldwork >= max(1,ib) if side == CoreBlasLeft
- *             ldwork >= max(1,m)  if side == CoreBlasRight
+ *             ldwork >= max(1,n) if side == CoreBlasLeft
+ *             ldwork >= max(1,m) if side == CoreBlasRight
  *
  *******************************************************************************
  *
@@ -111,6 +110,7 @@ int coreblas_zunmqr(coreblas_enum_t side, coreblas_enum_t trans,
                       coreblas_complex64_t *C,    int ldc,
                       coreblas_complex64_t *work, int ldwork)
 {
+#ifndef COREBLAS_UNCHECKED
     // Check input arguments.
     if (side != CoreBlasLeft && side != CoreBlasRight) {
         coreblas_error("illegal value of side");
@@ -181,6 +181,7 @@ int coreblas_zunmqr(coreblas_enum_t side, coreblas_enum_t trans,
         coreblas_error("illegal value of ldwork");
         return -14;
     }
+#endif
 
     // quick return
     if (m == 0 || n == 0 || k == 0)
@@ -217,7 +218,7 @@ int coreblas_zunmqr(coreblas_enum_t side, coreblas_enum_t trans,
         }
 #ifdef COREBLAS_USE_64BIT_BLAS
         // Apply H or H^H.
-        LAPACKE_zlarfb64_(LAPACK_COL_MAJOR,
+        LAPACKE_zlarfb_work64_(LAPACK_COL_MAJOR,
                             lapack_const(side),
                             lapack_const(trans),
                             lapack_const(CoreBlasForward),
@@ -225,10 +226,11 @@ int coreblas_zunmqr(coreblas_enum_t side, coreblas_enum_t trans,
                             mi, ni, kb,
                             &A[lda*i+i], lda,
                             &T[ldt*i], ldt,
-                            &C[ldc*jc+ic], ldc);
+                            &C[ldc*jc+ic], ldc,
+                            work, ldwork);
 #else
         // Apply H or H^H.
-        LAPACKE_zlarfb(LAPACK_COL_MAJOR,
+        LAPACKE_zlarfb_work(LAPACK_COL_MAJOR,
                             lapack_const(side),
                             lapack_const(trans),
                             lapack_const(CoreBlasForward),
@@ -236,10 +238,48 @@ int coreblas_zunmqr(coreblas_enum_t side, coreblas_enum_t trans,
                             mi, ni, kb,
                             &A[lda*i+i], lda,
                             &T[ldt*i], ldt,
-                            &C[ldc*jc+ic], ldc);
+                            &C[ldc*jc+ic], ldc,
+                            work, ldwork);
 #endif
 
     }
 
     return CoreBlasSuccess;
 }
+
+/***************************************************************************//**
+ *
+ * @ingroup core_unmqr
+ *
+ *  Returns the minimum length of the array work of coreblas_zunmqr
+ *  for the given dimensions.
+ *  The leading dimension is ldwork = max(1,n) on the left
+ *  and ldwork = max(1,m) on the right.
+ *
+ *******************************************************************************
+ *
+ * @param[in] side
+ *         - CoreBlasLeft  : apply from the Left;
+ *         - CoreBlasRight : apply from the Right.
+ *
+ * @param[in] m
+ *         The number of rows of the tile C.
+ *
+ * @param[in] n
+ *         The number of columns of the tile C.
+ *
+ * @param[in] ib
+ *         The inner-blocking size.
+ *
+ *******************************************************************************
+ *
+ * @retval the length of work, at least 1.
+ *
+ ******************************************************************************/
+size_t coreblas_zunmqr_lwork(coreblas_enum_t side, int m, int n, int ib)
+{
+    if (side == CoreBlasLeft)
+        return imax(1, n)*(size_t)imax(1, ib);
+    else
+        return imax(1, m)*(size_t)imax(1, ib);
+}
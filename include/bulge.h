@@ -85,6 +85,45 @@ inline static void findVTsiz(int N, int NB, int Vblksiz, int *blkcnt, int *LDV)
 
 /***************************************************************************//**
  *  Static scheduler
+ *
+ *  The sweep s = 0, ..., n-2 of the chase of a band of width nb is a
+ *  sequence of tasks t = 1, 2, ...: t = 1 is a gbtype1cb, an even t is a
+ *  gbtype2cb and an odd t > 1 is a gbtype3cb. Task (s,t) may start once
+ *  task (s,t-1) and task (s-1,t+COREBLAS_BULGE_SHIFT-1), or the last task
+ *  of the sweep s-1, are done, i.e., a sweep trails the previous one by
+ *  COREBLAS_BULGE_SHIFT tasks.
  **/
+#define COREBLAS_BULGE_SHIFT 3
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+// Sets the first and last columns of the task t of the sweep, as passed to
+// the gbtype kernels, and returns 1 if it is the last task of the sweep.
+inline static int coreblas_bulge_task(int N, int NB, int sweep, int t, int *st, int *ed)
+{
+  int j = t/2;
+  if (t%2 == 0) {
+      *st = (j-1)*NB + sweep + 1;
+      *ed = (j*NB + sweep < N-1) ? j*NB + sweep : N-1;
+      return j*NB + sweep >= N-2;
+  }
+  else {
+      *st = j*NB + sweep + 1;
+      *ed = ((j+1)*NB + sweep < N-1) ? (j+1)*NB + sweep : N-1;
+      return *st >= *ed-1 && *ed == N-1;
+  }
+}
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+// Returns the number of tasks of the sweep.
+inline static int coreblas_bulge_ntask(int N, int NB, int sweep)
+{
+  int st, ed;
+  int t = 1;
+  while (!coreblas_bulge_task(N, NB, sweep, t, &st, &ed))
+      t++;
+  return t;
+}
+////////////////////////////////////////////////////////////////////////////////////////////////////
 
 #endif
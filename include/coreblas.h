@@ -12,6 +12,8 @@
 
 #include <stdio.h>
 #include "coreblas_workspace.h"
+#include "coreblas_descriptor.h"
+#include "coreblas_barrier.h"
 
 #ifdef __cplusplus
 extern "C" {
@@ -139,5 +141,6 @@ static inline void coreblas_error_func_line_file(
 #include "coreblas_c.h"
 #include "coreblas_z.h"
 #include "coreblas_zc.h"
+#include "coreblas_half.h"
 
 #endif // COREBLAS_CORE_BLAS_H
@@ -0,0 +1,39 @@
+/**
+ *
+ * @file
+ *
+ *  COREBLAS is a software package provided by:
+ *  University of Tennessee, US,
+ *  University of Manchester, UK.
+ *
+ **/
+#ifndef COREBLAS_BARRIER_H
+#define COREBLAS_BARRIER_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/***************************************************************************//**
+ *  Sense-reversing spin barrier for the threads of a multithreaded kernel.
+ *  The arrival counter and the sense flag share one cache line, padded so
+ *  that the barrier does not share a line with neighbouring data.
+ **/
+typedef struct {
+    volatile int count;  ///< number of threads arrived in the current episode
+    volatile int sense;  ///< flipped by the last thread to arrive
+    char pad[64-2*sizeof(int)];
+} __attribute__((aligned(64))) coreblas_barrier_t;
+
+/******************************************************************************/
+void coreblas_barrier_init(coreblas_barrier_t *barrier);
+
+void coreblas_barrier_wait(coreblas_barrier_t *barrier, int size);
+
+void coreblas_barrier_wait_flag(volatile int *flag, int value);
+
+#ifdef __cplusplus
+}  // extern "C"
+#endif
+
+#endif // COREBLAS_BARRIER_H
@@ -0,0 +1,557 @@
+/**
+ *
+ * @file
+ *
+ *  COREBLAS is a software package provided by:
+ *  University of Tennessee, US,
+ *  University of Manchester, UK.
+ *
+ * @generated from include/coreblas_z.h, normal z -> c, Fri Oct 16 03:36:55 2026
+ *
+ **/
+#ifndef COREBLAS_CORE_BLAS_C_H
+#define COREBLAS_CORE_BLAS_C_H
+
+#include "coreblas_types.h"
+#include "coreblas_workspace.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#define COMPLEX
+
+/******************************************************************************/
+#ifdef COMPLEX
+float coreblas_scabs1(coreblas_complex32_t alpha);
+#endif
+
+int coreblas_icamax(int m, const coreblas_complex32_t *x, float *value);
+void coreblas_icamax_tile(int m, int n,
+                const coreblas_complex32_t *A, int lda,
+                int *imax, int *jmax, float *value);
+void coreblas_kernel_scamax(int colrow, int m, int n,
+                const coreblas_complex32_t *A, int lda,
+                float *values);
+
+void coreblas_cgbtype1cb(coreblas_enum_t uplo, int n, int nb,
+                      coreblas_complex32_t *A, int lda,
+                      coreblas_complex32_t *VQ, coreblas_complex32_t *TAUQ,
+                      coreblas_complex32_t *VP, coreblas_complex32_t *TAUP,
+                      int st, int ed, int sweep, int Vblksiz, int WANTZ,
+                      coreblas_complex32_t *work);
+size_t coreblas_cgbtype1cb_lwork(int nb);
+    
+void coreblas_cgbtype2cb(coreblas_enum_t uplo, int n, int nb,
+                      coreblas_complex32_t *A, int lda,
+                      coreblas_complex32_t *VQ, coreblas_complex32_t *TAUQ,
+                      coreblas_complex32_t *VP, coreblas_complex32_t *TAUP,
+                      int st, int ed, int sweep, int Vblksiz, int WANTZ,
+                      coreblas_complex32_t *work);
+size_t coreblas_cgbtype2cb_lwork(int nb);
+    
+void coreblas_cgbtype3cb(coreblas_enum_t uplo, int n, int nb,
+                      coreblas_complex32_t *A, int lda,
+                      coreblas_complex32_t *VQ, coreblas_complex32_t *TAUQ,
+                      coreblas_complex32_t *VP, coreblas_complex32_t *TAUP,
+                      int st, int ed, int sweep, int Vblksiz, int WANTZ,
+                      coreblas_complex32_t *work);
+size_t coreblas_cgbtype3cb_lwork(int nb);
+
+int coreblas_cgbbrd_static(coreblas_enum_t uplo, int n, int nb, int Vblksiz,
+                coreblas_complex32_t *A, int lda,
+                coreblas_complex32_t *VQ, coreblas_complex32_t *TAUQ,
+                coreblas_complex32_t *VP, coreblas_complex32_t *TAUP,
+                int wantz, coreblas_workspace_t *work, int *iwork);
+size_t coreblas_cgbbrd_static_liwork(int n, int nb);
+    
+int coreblas_cgeadd(coreblas_enum_t transa,
+                int m, int n,
+                coreblas_complex32_t alpha, const coreblas_complex32_t *A, int lda,
+                coreblas_complex32_t beta,        coreblas_complex32_t *B, int ldb);
+
+int coreblas_cgelqt(int m, int n, int ib,
+                coreblas_complex32_t *A, int lda,
+                coreblas_complex32_t *T, int ldt,
+                coreblas_complex32_t *tau,
+                coreblas_complex32_t *work);
+size_t coreblas_cgelqt_lwork(int m, int n, int ib);
+
+void coreblas_cgemm(coreblas_enum_t transa, coreblas_enum_t transb,
+                int m, int n, int k,
+                coreblas_complex32_t alpha, const coreblas_complex32_t *A, int lda,
+                                          const coreblas_complex32_t *B, int ldb,
+                coreblas_complex32_t beta,        coreblas_complex32_t *C, int ldc);
+
+int coreblas_cgemm_batched(coreblas_enum_t transa, coreblas_enum_t transb,
+                int m, int n, int k,
+                coreblas_complex32_t alpha,
+                const coreblas_complex32_t * const *A, int lda,
+                const coreblas_complex32_t * const *B, int ldb,
+                coreblas_complex32_t beta,
+                coreblas_complex32_t * const *C, int ldc,
+                int batch);
+
+int coreblas_cgemm_batched_strided(coreblas_enum_t transa,
+                coreblas_enum_t transb,
+                int m, int n, int k,
+                coreblas_complex32_t alpha,
+                const coreblas_complex32_t *A, int lda, size_t strideA,
+                const coreblas_complex32_t *B, int ldb, size_t strideB,
+                coreblas_complex32_t beta,
+                coreblas_complex32_t *C, int ldc, size_t strideC,
+                int batch);
+
+int coreblas_cgeqrt(int m, int n, int ib,
+                coreblas_complex32_t *A, int lda,
+                coreblas_complex32_t *T, int ldt,
+                coreblas_complex32_t *tau,
+                coreblas_complex32_t *work);
+size_t coreblas_cgeqrt_lwork(int m, int n, int ib);
+
+int coreblas_cgeqrt_batched(int m, int n, int ib,
+                coreblas_complex32_t * const *A, int lda,
+                coreblas_complex32_t * const *T, int ldt,
+                coreblas_workspace_t *work, int batch);
+
+int coreblas_cgeqrt_batched_strided(int m, int n, int ib,
+                coreblas_complex32_t *A, int lda, size_t strideA,
+                coreblas_complex32_t *T, int ldt, size_t strideT,
+                coreblas_workspace_t *work, int batch);
+size_t coreblas_cgeqrt_batched_lwork(int m, int n, int ib);
+
+void coreblas_cgessq(int m, int n,
+                 const coreblas_complex32_t *A, int lda,
+                 float *scale, float *sumsq);
+void coreblas_cgessq_aux(int n,
+                const float *scale, const float *sumsq,
+                float *value);
+
+void coreblas_cgetrf(coreblas_desc_t A, int *ipiv, int ib, int rank, int size,
+                 volatile int *max_idx, volatile coreblas_complex32_t *max_val,
+                 volatile int *info, coreblas_barrier_t *barrier);
+
+void coreblas_cgetrf_calu(coreblas_desc_t A, int *ipiv, int rank, int size,
+                coreblas_complex32_t *work, int *iwork,
+                volatile int *info, coreblas_barrier_t *barrier);
+size_t coreblas_cgetrf_calu_lwork(coreblas_desc_t A, int size);
+size_t coreblas_cgetrf_calu_liwork(coreblas_desc_t A, int size);
+
+int coreblas_chegst(int itype, coreblas_enum_t uplo,
+                int n,
+                coreblas_complex32_t *A, int lda,
+                coreblas_complex32_t *B, int ldb);
+
+void coreblas_chemm(coreblas_enum_t side, coreblas_enum_t uplo,
+                int m, int n,
+                coreblas_complex32_t alpha, const coreblas_complex32_t *A, int lda,
+                                          const coreblas_complex32_t *B, int ldb,
+                coreblas_complex32_t beta,        coreblas_complex32_t *C, int ldc);
+
+void coreblas_cher2k(coreblas_enum_t uplo, coreblas_enum_t trans,
+                 int n, int k,
+                 coreblas_complex32_t alpha, const coreblas_complex32_t *A, int lda,
+                                           const coreblas_complex32_t *B, int ldb,
+                 float beta,                    coreblas_complex32_t *C, int ldc);
+
+int coreblas_cherfb(coreblas_enum_t uplo, int n, int k, int ib,
+                const coreblas_complex32_t *A,    int lda,
+                const coreblas_complex32_t *T,    int ldt,
+                      coreblas_complex32_t *C,    int ldc,
+                      coreblas_complex32_t *work);
+size_t coreblas_cherfb_lwork(int n, int ib);
+
+void coreblas_cherk(coreblas_enum_t uplo, coreblas_enum_t trans,
+                int n, int k,
+                float alpha, const coreblas_complex32_t *A, int lda,
+                float beta,        coreblas_complex32_t *C, int ldc);
+
+void coreblas_chessq(coreblas_enum_t uplo,
+                 int n,
+                 const coreblas_complex32_t *A, int lda,
+                 float *scale, float *sumsq);
+
+void coreblas_csyssq(coreblas_enum_t uplo,
+                 int n,
+                 const coreblas_complex32_t *A, int lda,
+                 float *scale, float *sumsq);
+void coreblas_csyssq_aux(int m, int n,
+                const float *scale, const float *sumsq,
+                float *value);
+
+void coreblas_clacpy(coreblas_enum_t uplo, coreblas_enum_t transa,
+                 int m, int n,
+                 const coreblas_complex32_t *A, int lda,
+                       coreblas_complex32_t *B, int ldb);
+
+void coreblas_clacpy_lapack2tile_band(coreblas_enum_t uplo,
+                                  int it, int jt,
+                                  int m, int n, int nb, int kl, int ku,
+                                  const coreblas_complex32_t *A, int lda,
+                                        coreblas_complex32_t *B, int ldb);
+
+void coreblas_clacpy_tile2lapack_band(coreblas_enum_t uplo,
+                                  int it, int jt,
+                                  int m, int n, int nb, int kl, int ku,
+                                  const coreblas_complex32_t *B, int ldb,
+                                        coreblas_complex32_t *A, int lda);
+
+void coreblas_clange(coreblas_enum_t norm,
+                 int m, int n,
+                 const coreblas_complex32_t *A, int lda,
+                 float *work, float *result);
+size_t coreblas_clange_lwork(coreblas_enum_t norm, int m, int n);
+void coreblas_clange_aux(coreblas_enum_t norm, int m, int n,
+                const coreblas_complex32_t *A, int lda,
+                float *value);
+
+void coreblas_clanhe(coreblas_enum_t norm, coreblas_enum_t uplo,
+                 int n,
+                 const coreblas_complex32_t *A, int lda,
+                 float *work, float *value);
+size_t coreblas_clanhe_lwork(coreblas_enum_t norm, int n);
+void coreblas_clanhe_aux(coreblas_enum_t norm, coreblas_enum_t uplo,
+                int n,
+                const coreblas_complex32_t *A, int lda,
+                float *value);
+
+void coreblas_clansy(coreblas_enum_t norm, coreblas_enum_t uplo,
+                 int n,
+                 const coreblas_complex32_t *A, int lda,
+                 float *work, float *value);
+size_t coreblas_clansy_lwork(coreblas_enum_t norm, int n);
+void coreblas_clansy_aux(coreblas_enum_t norm, coreblas_enum_t uplo,
+                int n,
+                const coreblas_complex32_t *A, int lda,
+                float *value);
+
+void coreblas_clantr(coreblas_enum_t norm, coreblas_enum_t uplo, coreblas_enum_t diag,
+                 int m, int n,
+                 const coreblas_complex32_t *A, int lda,
+                 float *work, float *value);
+size_t coreblas_clantr_lwork(coreblas_enum_t norm, int m, int n);
+void coreblas_clantr_aux(coreblas_enum_t norm, coreblas_enum_t uplo,
+                coreblas_enum_t diag,
+                int m, int n,
+                const coreblas_complex32_t *A, int lda,
+                float *value);
+
+int coreblas_clarfb_gemm(coreblas_enum_t side, coreblas_enum_t trans, int direct, int storev,
+                     int M, int N, int K,
+                     const coreblas_complex32_t *V, int LDV,
+                     const coreblas_complex32_t *T, int LDT,
+                     coreblas_complex32_t *C, int LDC,
+                     coreblas_complex32_t *WORK, int LDWORK);
+size_t coreblas_clarfb_gemm_lwork(coreblas_enum_t side, int M, int N, int K);
+
+int coreblas_clarft(coreblas_enum_t storev, int n, int k,
+                    const coreblas_complex32_t *V, int ldv,
+                    const coreblas_complex32_t *tau,
+                          coreblas_complex32_t *T, int ldt);
+
+int coreblas_clarft_pent(coreblas_enum_t storev, int m, int k, int l,
+                         const coreblas_complex32_t *V, int ldv,
+                         const coreblas_complex32_t *tau,
+                               coreblas_complex32_t *T, int ldt);
+
+void coreblas_clascl(coreblas_enum_t uplo,
+                 float cfrom, float cto,
+                 int m, int n,
+                 coreblas_complex32_t *A, int lda);
+
+void coreblas_claset(coreblas_enum_t uplo,
+                 int m, int n,
+                 coreblas_complex32_t alpha, coreblas_complex32_t beta,
+                 coreblas_complex32_t *A, int lda);
+
+void coreblas_cgeswp(coreblas_enum_t colrow,
+                 coreblas_desc_t A, int k1, int k2, const int *ipiv, int incx);
+
+void coreblas_cgeswp_blocked(coreblas_enum_t colrow, coreblas_desc_t A,
+                int k1, int k2, const int *ipiv, int incx,
+                int rank, int size,
+                coreblas_complex32_t *work, int *iwork);
+size_t coreblas_cgeswp_blocked_lwork(coreblas_desc_t A, int k1, int k2);
+size_t coreblas_cgeswp_blocked_liwork(int k1, int k2);
+
+void coreblas_cheswp(int rank, int num_threads,
+                 int uplo, coreblas_desc_t A, int k1, int k2, const int *ipiv,
+                 int incx, coreblas_barrier_t *barrier);
+
+int coreblas_clauum(coreblas_enum_t uplo,
+                int n,
+                coreblas_complex32_t *A, int lda);
+
+int coreblas_cpamm(coreblas_enum_t op, coreblas_enum_t side,
+               coreblas_enum_t storev,
+               int m, int n, int k, int l,
+               const coreblas_complex32_t *A1, int lda1,
+                     coreblas_complex32_t *A2, int lda2,
+               const coreblas_complex32_t *V,  int ldv,
+                     coreblas_complex32_t *W,  int ldw);
+
+int coreblas_cpamm_direct(coreblas_enum_t op, coreblas_enum_t side,
+               coreblas_enum_t direct, coreblas_enum_t storev,
+               int m, int n, int k, int l,
+               const coreblas_complex32_t *A1, int lda1,
+                     coreblas_complex32_t *A2, int lda2,
+               const coreblas_complex32_t *V,  int ldv,
+                     coreblas_complex32_t *W,  int ldw);
+
+int coreblas_cparfb(coreblas_enum_t side, coreblas_enum_t trans, coreblas_enum_t direct,
+                coreblas_enum_t storev,
+                int m1, int n1, int m2, int n2, int k, int l,
+                      coreblas_complex32_t *A1,   int lda1,
+                      coreblas_complex32_t *A2,   int lda2,
+                const coreblas_complex32_t *V,    int ldv,
+                const coreblas_complex32_t *T,    int ldt,
+                      coreblas_complex32_t *work, int ldwork);
+size_t coreblas_cparfb_lwork(coreblas_enum_t side, int m1, int n1, int k);
+
+int coreblas_cpemv(coreblas_enum_t trans, int storev,
+               int m, int n, int l,
+               coreblas_complex32_t alpha,
+               const coreblas_complex32_t *A, int lda,
+               const coreblas_complex32_t *X, int incx,
+               coreblas_complex32_t beta,
+               coreblas_complex32_t *Y, int incy,
+               coreblas_complex32_t *work);
+size_t coreblas_cpemv_lwork(int m, int n, int l);
+
+int coreblas_cpotrf(coreblas_enum_t uplo,
+                int n,
+                coreblas_complex32_t *A, int lda);
+
+void coreblas_creduce_ssq(int n, const float *scale, const float *sumsq,
+                float *scl, float *sum);
+void coreblas_creduce_norm(coreblas_enum_t norm, int m, int n,
+                const float *W, int ldw, float *value);
+
+void coreblas_csymm(coreblas_enum_t side, coreblas_enum_t uplo,
+                int m, int n,
+                coreblas_complex32_t alpha, const coreblas_complex32_t *A, int lda,
+                                          const coreblas_complex32_t *B, int ldb,
+                coreblas_complex32_t beta,        coreblas_complex32_t *C, int ldc);
+
+void coreblas_csyr2k(
+    coreblas_enum_t uplo, coreblas_enum_t trans,
+    int n, int k,
+    coreblas_complex32_t alpha, const coreblas_complex32_t *A, int lda,
+                              const coreblas_complex32_t *B, int ldb,
+    coreblas_complex32_t beta,        coreblas_complex32_t *C, int ldc);
+
+void coreblas_csyrk(coreblas_enum_t uplo, coreblas_enum_t trans,
+                int n, int k,
+                coreblas_complex32_t alpha, const coreblas_complex32_t *A, int lda,
+                coreblas_complex32_t beta,        coreblas_complex32_t *C, int ldc);
+
+int coreblas_ctradd(coreblas_enum_t uplo, coreblas_enum_t transa,
+                int m, int n,
+                coreblas_complex32_t alpha, const coreblas_complex32_t *A, int lda,
+                coreblas_complex32_t beta,        coreblas_complex32_t *B, int ldb);
+
+void coreblas_ctrmm(coreblas_enum_t side, coreblas_enum_t uplo,
+                coreblas_enum_t transa, coreblas_enum_t diag,
+                int m, int n,
+                coreblas_complex32_t alpha, const coreblas_complex32_t *A, int lda,
+                                                coreblas_complex32_t *B, int ldb);
+
+void coreblas_ctrsm(coreblas_enum_t side, coreblas_enum_t uplo,
+                coreblas_enum_t transa, coreblas_enum_t diag,
+                int m, int n,
+                coreblas_complex32_t alpha, const coreblas_complex32_t *A, int lda,
+                                                coreblas_complex32_t *B, int ldb);
+
+void coreblas_ctrssq(coreblas_enum_t uplo, coreblas_enum_t diag,
+                 int m, int n,
+                 const coreblas_complex32_t *A, int lda,
+                 float *scale, float *sumsq);
+
+int coreblas_ctrtri(coreblas_enum_t uplo, coreblas_enum_t diag,
+                int n,
+                coreblas_complex32_t *A, int lda);
+
+int coreblas_ctslqt(int m, int n, int ib,
+                coreblas_complex32_t *A1, int lda1,
+                coreblas_complex32_t *A2, int lda2,
+                coreblas_complex32_t *T,  int ldt,
+                coreblas_complex32_t *tau,
+                coreblas_complex32_t *work);
+size_t coreblas_ctslqt_lwork(int m, int n, int ib);
+
+int coreblas_ctsmlq(coreblas_enum_t side, coreblas_enum_t trans,
+                int m1, int n1, int m2, int n2, int k, int ib,
+                      coreblas_complex32_t *A1,   int lda1,
+                      coreblas_complex32_t *A2,   int lda2,
+                const coreblas_complex32_t *V,    int ldv,
+                const coreblas_complex32_t *T,    int ldt,
+                      coreblas_complex32_t *work, int ldwork);
+size_t coreblas_ctsmlq_lwork(coreblas_enum_t side, int m1, int n1, int ib);
+
+int coreblas_ctsmql(coreblas_enum_t side, coreblas_enum_t trans,
+                int m1, int n1, int m2, int n2, int k, int ib,
+                      coreblas_complex32_t *A1,   int lda1,
+                      coreblas_complex32_t *A2,   int lda2,
+                const coreblas_complex32_t *V,    int ldv,
+                const coreblas_complex32_t *T,    int ldt,
+                      coreblas_complex32_t *work, int ldwork);
+size_t coreblas_ctsmql_lwork(coreblas_enum_t side, int m1, int n1, int ib);
+
+int coreblas_ctsmqr(coreblas_enum_t side, coreblas_enum_t trans,
+                int m1, int n1, int m2, int n2, int k, int ib,
+                      coreblas_complex32_t *A1,   int lda1,
+                      coreblas_complex32_t *A2,   int lda2,
+                const coreblas_complex32_t *V,    int ldv,
+                const coreblas_complex32_t *T,    int ldt,
+                      coreblas_complex32_t *work, int ldwork);
+size_t coreblas_ctsmqr_lwork(coreblas_enum_t side, int m1, int n1, int ib);
+
+int coreblas_ctsmqr_hetra1(coreblas_enum_t side, coreblas_enum_t trans,
+                int m1, int n1, int m2, int n2, int k, int ib,
+                      coreblas_complex32_t *A1,   int lda1,
+                      coreblas_complex32_t *A2,   int lda2,
+                const coreblas_complex32_t *V,    int ldv,
+                const coreblas_complex32_t *T,    int ldt,
+                      coreblas_complex32_t *work, int ldwork);
+
+int coreblas_ctsmqr_corner(int m1, int n1, int m2, int n2, int m3, int n3,
+                int k, int ib,
+                      coreblas_complex32_t *A1,   int lda1,
+                      coreblas_complex32_t *A2,   int lda2,
+                      coreblas_complex32_t *A3,   int lda3,
+                const coreblas_complex32_t *V,    int ldv,
+                const coreblas_complex32_t *T,    int ldt,
+                      coreblas_complex32_t *work);
+size_t coreblas_ctsmqr_corner_lwork(int m1, int m2, int ib);
+
+int coreblas_ctsmqr_batched(coreblas_enum_t side, coreblas_enum_t trans,
+                int m1, int n1, int m2, int n2, int k, int ib,
+                coreblas_complex32_t * const *A1, int lda1,
+                coreblas_complex32_t * const *A2, int lda2,
+                const coreblas_complex32_t * const *V, int ldv,
+                const coreblas_complex32_t * const *T, int ldt,
+                coreblas_workspace_t *work, int batch);
+
+int coreblas_ctsmqr_batched_strided(coreblas_enum_t side,
+                coreblas_enum_t trans,
+                int m1, int n1, int m2, int n2, int k, int ib,
+                coreblas_complex32_t *A1, int lda1, size_t strideA1,
+                coreblas_complex32_t *A2, int lda2, size_t strideA2,
+                const coreblas_complex32_t *V, int ldv, size_t strideV,
+                const coreblas_complex32_t *T, int ldt, size_t strideT,
+                coreblas_workspace_t *work, int batch);
+
+int coreblas_ctsmqr_row(coreblas_enum_t side, coreblas_enum_t trans,
+                int m1, int n1, int m2, int n2, int k, int ib,
+                coreblas_complex32_t * const *A1, int lda1,
+                coreblas_complex32_t * const *A2, int lda2,
+                const coreblas_complex32_t *V, int ldv,
+                const coreblas_complex32_t *T, int ldt,
+                coreblas_workspace_t *work, int ntile);
+
+int coreblas_ctsmrq(coreblas_enum_t side, coreblas_enum_t trans,
+                int m1, int n1, int m2, int n2, int k, int ib,
+                      coreblas_complex32_t *A1,   int lda1,
+                      coreblas_complex32_t *A2,   int lda2,
+                const coreblas_complex32_t *V,    int ldv,
+                const coreblas_complex32_t *T,    int ldt,
+                      coreblas_complex32_t *work, int ldwork);
+size_t coreblas_ctsmrq_lwork(coreblas_enum_t side, int m1, int n1, int ib);
+
+int coreblas_ctsqrt(int m, int n, int ib,
+                coreblas_complex32_t *A1, int lda1,
+                coreblas_complex32_t *A2, int lda2,
+                coreblas_complex32_t *T,  int ldt,
+                coreblas_complex32_t *tau,
+                coreblas_complex32_t *work);
+size_t coreblas_ctsqrt_lwork(int m, int n, int ib);
+
+int coreblas_ctsqrt_rec(int m, int n, int ib,
+                coreblas_complex32_t *A1, int lda1,
+                coreblas_complex32_t *A2, int lda2,
+                coreblas_complex32_t *T,  int ldt,
+                coreblas_complex32_t *tau,
+                coreblas_complex32_t *work);
+size_t coreblas_ctsqrt_rec_lwork(int m, int n, int ib);
+
+int coreblas_ctsqlt(int m, int n, int ib,
+                coreblas_complex32_t *A1, int lda1,
+                coreblas_complex32_t *A2, int lda2,
+                coreblas_complex32_t *T,  int ldt,
+                coreblas_complex32_t *tau,
+                coreblas_complex32_t *work);
+size_t coreblas_ctsqlt_lwork(int m, int n, int ib);
+
+int coreblas_ctsrqt(int m, int n, int ib,
+                coreblas_complex32_t *A1, int lda1,
+                coreblas_complex32_t *A2, int lda2,
+                coreblas_complex32_t *T,  int ldt,
+                coreblas_complex32_t *tau,
+                coreblas_complex32_t *work);
+size_t coreblas_ctsrqt_lwork(int m, int n, int ib);
+
+int coreblas_cttlqt(int m, int n, int ib,
+                coreblas_complex32_t *A1, int lda1,
+                coreblas_complex32_t *A2, int lda2,
+                coreblas_complex32_t *T,  int ldt,
+                coreblas_complex32_t *tau,
+                coreblas_complex32_t *work);
+size_t coreblas_cttlqt_lwork(int m, int n, int ib);
+
+int coreblas_cttmlq(coreblas_enum_t side, coreblas_enum_t trans,
+                int m1, int n1, int m2, int n2, int k, int ib,
+                      coreblas_complex32_t *A1,   int lda1,
+                      coreblas_complex32_t *A2,   int lda2,
+                const coreblas_complex32_t *V,    int ldv,
+                const coreblas_complex32_t *T,    int ldt,
+                      coreblas_complex32_t *work, int ldwork);
+size_t coreblas_cttmlq_lwork(coreblas_enum_t side, int m1, int n1, int ib);
+
+int coreblas_cttmqr(coreblas_enum_t side, coreblas_enum_t trans,
+                int m1, int n1, int m2, int n2, int k, int ib,
+                      coreblas_complex32_t *A1,   int lda1,
+                      coreblas_complex32_t *A2,   int lda2,
+                const coreblas_complex32_t *V,    int ldv,
+                const coreblas_complex32_t *T,    int ldt,
+                      coreblas_complex32_t *work, int ldwork);
+size_t coreblas_cttmqr_lwork(coreblas_enum_t side, int m1, int n1, int ib);
+
+int coreblas_cttqrt(int m, int n, int ib,
+                coreblas_complex32_t *A1, int lda1,
+                coreblas_complex32_t *A2, int lda2,
+                coreblas_complex32_t *T,  int ldt,
+                coreblas_complex32_t *tau,
+                coreblas_complex32_t *work);
+size_t coreblas_cttqrt_lwork(int m, int n, int ib);
+
+int coreblas_cttqrt_rec(int m, int n, int ib,
+                coreblas_complex32_t *A1, int lda1,
+                coreblas_complex32_t *A2, int lda2,
+                coreblas_complex32_t *T,  int ldt,
+                coreblas_complex32_t *tau,
+                coreblas_complex32_t *work);
+size_t coreblas_cttqrt_rec_lwork(int m, int n, int ib);
+
+int coreblas_cunmlq(coreblas_enum_t side, coreblas_enum_t trans,
+                int m, int n, int k, int ib,
+                const coreblas_complex32_t *A,    int lda,
+                const coreblas_complex32_t *T,    int ldt,
+                      coreblas_complex32_t *C,    int ldc,
+                      coreblas_complex32_t *work, int ldwork);
+size_t coreblas_cunmlq_lwork(coreblas_enum_t side, int m, int n, int ib);
+
+int coreblas_cunmqr(coreblas_enum_t side, coreblas_enum_t trans,
+                int m, int n, int k, int ib,
+                const coreblas_complex32_t *A,    int lda,
+                const coreblas_complex32_t *T,    int ldt,
+                      coreblas_complex32_t *C,    int ldc,
+                      coreblas_complex32_t *work, int ldwork);
+size_t coreblas_cunmqr_lwork(coreblas_enum_t side, int m, int n, int ib);
+
+#undef COMPLEX
+
+#ifdef __cplusplus
+}  // extern "C"
+#endif
+
+#endif // COREBLAS_CORE_BLAS_C_H
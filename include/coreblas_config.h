@@ -0,0 +1,17 @@
+/* PLASMA configuration options */
+
+/* #undef COREBLAS_CBLAS_ADD_TYPEDEF */
+
+/* #undef COREBLAS_HAVE_MKL */
+
+/* #undef COREBLAS_HAVE_ESSL */
+
+/* #undef COREBLAS_WITH_ESSL */
+
+/* #undef COREBLAS_WITH_MKL */
+
+/* #undef COREBLAS_WITH_NETLIB */
+
+/* #undef COREBLAS_USE_LUA */
+
+/* #undef COREBLAS_USE_64BIT_BLAS */
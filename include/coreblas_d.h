@@ -0,0 +1,557 @@
+/**
+ *
+ * @file
+ *
+ *  COREBLAS is a software package provided by:
+ *  University of Tennessee, US,
+ *  University of Manchester, UK.
+ *
+ * @generated from include/coreblas_z.h, normal z -> d, Fri Oct 16 03:36:55 2026
+ *
+ **/
+#ifndef COREBLAS_CORE_BLAS_D_H
+#define COREBLAS_CORE_BLAS_D_H
+
+#include "coreblas_types.h"
+#include "coreblas_workspace.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#define REAL
+
+/******************************************************************************/
+#ifdef COMPLEX
+double fabs(double alpha);
+#endif
+
+int coreblas_idamax(int m, const double *x, double *value);
+void coreblas_idamax_tile(int m, int n,
+                const double *A, int lda,
+                int *imax, int *jmax, double *value);
+void coreblas_kernel_damax(int colrow, int m, int n,
+                const double *A, int lda,
+                double *values);
+
+void coreblas_dgbtype1cb(coreblas_enum_t uplo, int n, int nb,
+                      double *A, int lda,
+                      double *VQ, double *TAUQ,
+                      double *VP, double *TAUP,
+                      int st, int ed, int sweep, int Vblksiz, int WANTZ,
+                      double *work);
+size_t coreblas_dgbtype1cb_lwork(int nb);
+    
+void coreblas_dgbtype2cb(coreblas_enum_t uplo, int n, int nb,
+                      double *A, int lda,
+                      double *VQ, double *TAUQ,
+                      double *VP, double *TAUP,
+                      int st, int ed, int sweep, int Vblksiz, int WANTZ,
+                      double *work);
+size_t coreblas_dgbtype2cb_lwork(int nb);
+    
+void coreblas_dgbtype3cb(coreblas_enum_t uplo, int n, int nb,
+                      double *A, int lda,
+                      double *VQ, double *TAUQ,
+                      double *VP, double *TAUP,
+                      int st, int ed, int sweep, int Vblksiz, int WANTZ,
+                      double *work);
+size_t coreblas_dgbtype3cb_lwork(int nb);
+
+int coreblas_dgbbrd_static(coreblas_enum_t uplo, int n, int nb, int Vblksiz,
+                double *A, int lda,
+                double *VQ, double *TAUQ,
+                double *VP, double *TAUP,
+                int wantz, coreblas_workspace_t *work, int *iwork);
+size_t coreblas_dgbbrd_static_liwork(int n, int nb);
+    
+int coreblas_dgeadd(coreblas_enum_t transa,
+                int m, int n,
+                double alpha, const double *A, int lda,
+                double beta,        double *B, int ldb);
+
+int coreblas_dgelqt(int m, int n, int ib,
+                double *A, int lda,
+                double *T, int ldt,
+                double *tau,
+                double *work);
+size_t coreblas_dgelqt_lwork(int m, int n, int ib);
+
+void coreblas_dgemm(coreblas_enum_t transa, coreblas_enum_t transb,
+                int m, int n, int k,
+                double alpha, const double *A, int lda,
+                                          const double *B, int ldb,
+                double beta,        double *C, int ldc);
+
+int coreblas_dgemm_batched(coreblas_enum_t transa, coreblas_enum_t transb,
+                int m, int n, int k,
+                double alpha,
+                const double * const *A, int lda,
+                const double * const *B, int ldb,
+                double beta,
+                double * const *C, int ldc,
+                int batch);
+
+int coreblas_dgemm_batched_strided(coreblas_enum_t transa,
+                coreblas_enum_t transb,
+                int m, int n, int k,
+                double alpha,
+                const double *A, int lda, size_t strideA,
+                const double *B, int ldb, size_t strideB,
+                double beta,
+                double *C, int ldc, size_t strideC,
+                int batch);
+
+int coreblas_dgeqrt(int m, int n, int ib,
+                double *A, int lda,
+                double *T, int ldt,
+                double *tau,
+                double *work);
+size_t coreblas_dgeqrt_lwork(int m, int n, int ib);
+
+int coreblas_dgeqrt_batched(int m, int n, int ib,
+                double * const *A, int lda,
+                double * const *T, int ldt,
+                coreblas_workspace_t *work, int batch);
+
+int coreblas_dgeqrt_batched_strided(int m, int n, int ib,
+                double *A, int lda, size_t strideA,
+                double *T, int ldt, size_t strideT,
+                coreblas_workspace_t *work, int batch);
+size_t coreblas_dgeqrt_batched_lwork(int m, int n, int ib);
+
+void coreblas_dgessq(int m, int n,
+                 const double *A, int lda,
+                 double *scale, double *sumsq);
+void coreblas_dgessq_aux(int n,
+                const double *scale, const double *sumsq,
+                double *value);
+
+void coreblas_dgetrf(coreblas_desc_t A, int *ipiv, int ib, int rank, int size,
+                 volatile int *max_idx, volatile double *max_val,
+                 volatile int *info, coreblas_barrier_t *barrier);
+
+void coreblas_dgetrf_calu(coreblas_desc_t A, int *ipiv, int rank, int size,
+                double *work, int *iwork,
+                volatile int *info, coreblas_barrier_t *barrier);
+size_t coreblas_dgetrf_calu_lwork(coreblas_desc_t A, int size);
+size_t coreblas_dgetrf_calu_liwork(coreblas_desc_t A, int size);
+
+int coreblas_dsygst(int itype, coreblas_enum_t uplo,
+                int n,
+                double *A, int lda,
+                double *B, int ldb);
+
+void coreblas_dsymm(coreblas_enum_t side, coreblas_enum_t uplo,
+                int m, int n,
+                double alpha, const double *A, int lda,
+                                          const double *B, int ldb,
+                double beta,        double *C, int ldc);
+
+void coreblas_dsyr2k(coreblas_enum_t uplo, coreblas_enum_t trans,
+                 int n, int k,
+                 double alpha, const double *A, int lda,
+                                           const double *B, int ldb,
+                 double beta,                    double *C, int ldc);
+
+int coreblas_dsyrfb(coreblas_enum_t uplo, int n, int k, int ib,
+                const double *A,    int lda,
+                const double *T,    int ldt,
+                      double *C,    int ldc,
+                      double *work);
+size_t coreblas_dsyrfb_lwork(int n, int ib);
+
+void coreblas_dsyrk(coreblas_enum_t uplo, coreblas_enum_t trans,
+                int n, int k,
+                double alpha, const double *A, int lda,
+                double beta,        double *C, int ldc);
+
+void coreblas_dsyssq(coreblas_enum_t uplo,
+                 int n,
+                 const double *A, int lda,
+                 double *scale, double *sumsq);
+
+void coreblas_dsyssq(coreblas_enum_t uplo,
+                 int n,
+                 const double *A, int lda,
+                 double *scale, double *sumsq);
+void coreblas_dsyssq_aux(int m, int n,
+                const double *scale, const double *sumsq,
+                double *value);
+
+void coreblas_dlacpy(coreblas_enum_t uplo, coreblas_enum_t transa,
+                 int m, int n,
+                 const double *A, int lda,
+                       double *B, int ldb);
+
+void coreblas_dlacpy_lapack2tile_band(coreblas_enum_t uplo,
+                                  int it, int jt,
+                                  int m, int n, int nb, int kl, int ku,
+                                  const double *A, int lda,
+                                        double *B, int ldb);
+
+void coreblas_dlacpy_tile2lapack_band(coreblas_enum_t uplo,
+                                  int it, int jt,
+                                  int m, int n, int nb, int kl, int ku,
+                                  const double *B, int ldb,
+                                        double *A, int lda);
+
+void coreblas_dlange(coreblas_enum_t norm,
+                 int m, int n,
+                 const double *A, int lda,
+                 double *work, double *result);
+size_t coreblas_dlange_lwork(coreblas_enum_t norm, int m, int n);
+void coreblas_dlange_aux(coreblas_enum_t norm, int m, int n,
+                const double *A, int lda,
+                double *value);
+
+void coreblas_dlansy(coreblas_enum_t norm, coreblas_enum_t uplo,
+                 int n,
+                 const double *A, int lda,
+                 double *work, double *value);
+size_t coreblas_dlansy_lwork(coreblas_enum_t norm, int n);
+void coreblas_dlansy_aux(coreblas_enum_t norm, coreblas_enum_t uplo,
+                int n,
+                const double *A, int lda,
+                double *value);
+
+void coreblas_dlansy(coreblas_enum_t norm, coreblas_enum_t uplo,
+                 int n,
+                 const double *A, int lda,
+                 double *work, double *value);
+size_t coreblas_dlansy_lwork(coreblas_enum_t norm, int n);
+void coreblas_dlansy_aux(coreblas_enum_t norm, coreblas_enum_t uplo,
+                int n,
+                const double *A, int lda,
+                double *value);
+
+void coreblas_dlantr(coreblas_enum_t norm, coreblas_enum_t uplo, coreblas_enum_t diag,
+                 int m, int n,
+                 const double *A, int lda,
+                 double *work, double *value);
+size_t coreblas_dlantr_lwork(coreblas_enum_t norm, int m, int n);
+void coreblas_dlantr_aux(coreblas_enum_t norm, coreblas_enum_t uplo,
+                coreblas_enum_t diag,
+                int m, int n,
+                const double *A, int lda,
+                double *value);
+
+int coreblas_dlarfb_gemm(coreblas_enum_t side, coreblas_enum_t trans, int direct, int storev,
+                     int M, int N, int K,
+                     const double *V, int LDV,
+                     const double *T, int LDT,
+                     double *C, int LDC,
+                     double *WORK, int LDWORK);
+size_t coreblas_dlarfb_gemm_lwork(coreblas_enum_t side, int M, int N, int K);
+
+int coreblas_dlarft(coreblas_enum_t storev, int n, int k,
+                    const double *V, int ldv,
+                    const double *tau,
+                          double *T, int ldt);
+
+int coreblas_dlarft_pent(coreblas_enum_t storev, int m, int k, int l,
+                         const double *V, int ldv,
+                         const double *tau,
+                               double *T, int ldt);
+
+void coreblas_dlascl(coreblas_enum_t uplo,
+                 double cfrom, double cto,
+                 int m, int n,
+                 double *A, int lda);
+
+void coreblas_dlaset(coreblas_enum_t uplo,
+                 int m, int n,
+                 double alpha, double beta,
+                 double *A, int lda);
+
+void coreblas_dgeswp(coreblas_enum_t colrow,
+                 coreblas_desc_t A, int k1, int k2, const int *ipiv, int incx);
+
+void coreblas_dgeswp_blocked(coreblas_enum_t colrow, coreblas_desc_t A,
+                int k1, int k2, const int *ipiv, int incx,
+                int rank, int size,
+                double *work, int *iwork);
+size_t coreblas_dgeswp_blocked_lwork(coreblas_desc_t A, int k1, int k2);
+size_t coreblas_dgeswp_blocked_liwork(int k1, int k2);
+
+void coreblas_dsyswp(int rank, int num_threads,
+                 int uplo, coreblas_desc_t A, int k1, int k2, const int *ipiv,
+                 int incx, coreblas_barrier_t *barrier);
+
+int coreblas_dlauum(coreblas_enum_t uplo,
+                int n,
+                double *A, int lda);
+
+int coreblas_dpamm(coreblas_enum_t op, coreblas_enum_t side,
+               coreblas_enum_t storev,
+               int m, int n, int k, int l,
+               const double *A1, int lda1,
+                     double *A2, int lda2,
+               const double *V,  int ldv,
+                     double *W,  int ldw);
+
+int coreblas_dpamm_direct(coreblas_enum_t op, coreblas_enum_t side,
+               coreblas_enum_t direct, coreblas_enum_t storev,
+               int m, int n, int k, int l,
+               const double *A1, int lda1,
+                     double *A2, int lda2,
+               const double *V,  int ldv,
+                     double *W,  int ldw);
+
+int coreblas_dparfb(coreblas_enum_t side, coreblas_enum_t trans, coreblas_enum_t direct,
+                coreblas_enum_t storev,
+                int m1, int n1, int m2, int n2, int k, int l,
+                      double *A1,   int lda1,
+                      double *A2,   int lda2,
+                const double *V,    int ldv,
+                const double *T,    int ldt,
+                      double *work, int ldwork);
+size_t coreblas_dparfb_lwork(coreblas_enum_t side, int m1, int n1, int k);
+
+int coreblas_dpemv(coreblas_enum_t trans, int storev,
+               int m, int n, int l,
+               double alpha,
+               const double *A, int lda,
+               const double *X, int incx,
+               double beta,
+               double *Y, int incy,
+               double *work);
+size_t coreblas_dpemv_lwork(int m, int n, int l);
+
+int coreblas_dpotrf(coreblas_enum_t uplo,
+                int n,
+                double *A, int lda);
+
+void coreblas_dreduce_ssq(int n, const double *scale, const double *sumsq,
+                double *scl, double *sum);
+void coreblas_dreduce_norm(coreblas_enum_t norm, int m, int n,
+                const double *W, int ldw, double *value);
+
+void coreblas_dsymm(coreblas_enum_t side, coreblas_enum_t uplo,
+                int m, int n,
+                double alpha, const double *A, int lda,
+                                          const double *B, int ldb,
+                double beta,        double *C, int ldc);
+
+void coreblas_dsyr2k(
+    coreblas_enum_t uplo, coreblas_enum_t trans,
+    int n, int k,
+    double alpha, const double *A, int lda,
+                              const double *B, int ldb,
+    double beta,        double *C, int ldc);
+
+void coreblas_dsyrk(coreblas_enum_t uplo, coreblas_enum_t trans,
+                int n, int k,
+                double alpha, const double *A, int lda,
+                double beta,        double *C, int ldc);
+
+int coreblas_dtradd(coreblas_enum_t uplo, coreblas_enum_t transa,
+                int m, int n,
+                double alpha, const double *A, int lda,
+                double beta,        double *B, int ldb);
+
+void coreblas_dtrmm(coreblas_enum_t side, coreblas_enum_t uplo,
+                coreblas_enum_t transa, coreblas_enum_t diag,
+                int m, int n,
+                double alpha, const double *A, int lda,
+                                                double *B, int ldb);
+
+void coreblas_dtrsm(coreblas_enum_t side, coreblas_enum_t uplo,
+                coreblas_enum_t transa, coreblas_enum_t diag,
+                int m, int n,
+                double alpha, const double *A, int lda,
+                                                double *B, int ldb);
+
+void coreblas_dtrssq(coreblas_enum_t uplo, coreblas_enum_t diag,
+                 int m, int n,
+                 const double *A, int lda,
+                 double *scale, double *sumsq);
+
+int coreblas_dtrtri(coreblas_enum_t uplo, coreblas_enum_t diag,
+                int n,
+                double *A, int lda);
+
+int coreblas_dtslqt(int m, int n, int ib,
+                double *A1, int lda1,
+                double *A2, int lda2,
+                double *T,  int ldt,
+                double *tau,
+                double *work);
+size_t coreblas_dtslqt_lwork(int m, int n, int ib);
+
+int coreblas_dtsmlq(coreblas_enum_t side, coreblas_enum_t trans,
+                int m1, int n1, int m2, int n2, int k, int ib,
+                      double *A1,   int lda1,
+                      double *A2,   int lda2,
+                const double *V,    int ldv,
+                const double *T,    int ldt,
+                      double *work, int ldwork);
+size_t coreblas_dtsmlq_lwork(coreblas_enum_t side, int m1, int n1, int ib);
+
+int coreblas_dtsmql(coreblas_enum_t side, coreblas_enum_t trans,
+                int m1, int n1, int m2, int n2, int k, int ib,
+                      double *A1,   int lda1,
+                      double *A2,   int lda2,
+                const double *V,    int ldv,
+                const double *T,    int ldt,
+                      double *work, int ldwork);
+size_t coreblas_dtsmql_lwork(coreblas_enum_t side, int m1, int n1, int ib);
+
+int coreblas_dtsmqr(coreblas_enum_t side, coreblas_enum_t trans,
+                int m1, int n1, int m2, int n2, int k, int ib,
+                      double *A1,   int lda1,
+                      double *A2,   int lda2,
+                const double *V,    int ldv,
+                const double *T,    int ldt,
+                      double *work, int ldwork);
+size_t coreblas_dtsmqr_lwork(coreblas_enum_t side, int m1, int n1, int ib);
+
+int coreblas_dtsmqr_sytra1(coreblas_enum_t side, coreblas_enum_t trans,
+                int m1, int n1, int m2, int n2, int k, int ib,
+                      double *A1,   int lda1,
+                      double *A2,   int lda2,
+                const double *V,    int ldv,
+                const double *T,    int ldt,
+                      double *work, int ldwork);
+
+int coreblas_dtsmqr_corner(int m1, int n1, int m2, int n2, int m3, int n3,
+                int k, int ib,
+                      double *A1,   int lda1,
+                      double *A2,   int lda2,
+                      double *A3,   int lda3,
+                const double *V,    int ldv,
+                const double *T,    int ldt,
+                      double *work);
+size_t coreblas_dtsmqr_corner_lwork(int m1, int m2, int ib);
+
+int coreblas_dtsmqr_batched(coreblas_enum_t side, coreblas_enum_t trans,
+                int m1, int n1, int m2, int n2, int k, int ib,
+                double * const *A1, int lda1,
+                double * const *A2, int lda2,
+                const double * const *V, int ldv,
+                const double * const *T, int ldt,
+                coreblas_workspace_t *work, int batch);
+
+int coreblas_dtsmqr_batched_strided(coreblas_enum_t side,
+                coreblas_enum_t trans,
+                int m1, int n1, int m2, int n2, int k, int ib,
+                double *A1, int lda1, size_t strideA1,
+                double *A2, int lda2, size_t strideA2,
+                const double *V, int ldv, size_t strideV,
+                const double *T, int ldt, size_t strideT,
+                coreblas_workspace_t *work, int batch);
+
+int coreblas_dtsmqr_row(coreblas_enum_t side, coreblas_enum_t trans,
+                int m1, int n1, int m2, int n2, int k, int ib,
+                double * const *A1, int lda1,
+                double * const *A2, int lda2,
+                const double *V, int ldv,
+                const double *T, int ldt,
+                coreblas_workspace_t *work, int ntile);
+
+int coreblas_dtsmrq(coreblas_enum_t side, coreblas_enum_t trans,
+                int m1, int n1, int m2, int n2, int k, int ib,
+                      double *A1,   int lda1,
+                      double *A2,   int lda2,
+                const double *V,    int ldv,
+                const double *T,    int ldt,
+                      double *work, int ldwork);
+size_t coreblas_dtsmrq_lwork(coreblas_enum_t side, int m1, int n1, int ib);
+
+int coreblas_dtsqrt(int m, int n, int ib,
+                double *A1, int lda1,
+                double *A2, int lda2,
+                double *T,  int ldt,
+                double *tau,
+                double *work);
+size_t coreblas_dtsqrt_lwork(int m, int n, int ib);
+
+int coreblas_dtsqrt_rec(int m, int n, int ib,
+                double *A1, int lda1,
+                double *A2, int lda2,
+                double *T,  int ldt,
+                double *tau,
+                double *work);
+size_t coreblas_dtsqrt_rec_lwork(int m, int n, int ib);
+
+int coreblas_dtsqlt(int m, int n, int ib,
+                double *A1, int lda1,
+                double *A2, int lda2,
+                double *T,  int ldt,
+                double *tau,
+                double *work);
+size_t coreblas_dtsqlt_lwork(int m, int n, int ib);
+
+int coreblas_dtsrqt(int m, int n, int ib,
+                double *A1, int lda1,
+                double *A2, int lda2,
+                double *T,  int ldt,
+                double *tau,
+                double *work);
+size_t coreblas_dtsrqt_lwork(int m, int n, int ib);
+
+int coreblas_dttlqt(int m, int n, int ib,
+                double *A1, int lda1,
+                double *A2, int lda2,
+                double *T,  int ldt,
+                double *tau,
+                double *work);
+size_t coreblas_dttlqt_lwork(int m, int n, int ib);
+
+int coreblas_dttmlq(coreblas_enum_t side, coreblas_enum_t trans,
+                int m1, int n1, int m2, int n2, int k, int ib,
+                      double *A1,   int lda1,
+                      double *A2,   int lda2,
+                const double *V,    int ldv,
+                const double *T,    int ldt,
+                      double *work, int ldwork);
+size_t coreblas_dttmlq_lwork(coreblas_enum_t side, int m1, int n1, int ib);
+
+int coreblas_dttmqr(coreblas_enum_t side, coreblas_enum_t trans,
+                int m1, int n1, int m2, int n2, int k, int ib,
+                      double *A1,   int lda1,
+                      double *A2,   int lda2,
+                const double *V,    int ldv,
+                const double *T,    int ldt,
+                      double *work, int ldwork);
+size_t coreblas_dttmqr_lwork(coreblas_enum_t side, int m1, int n1, int ib);
+
+int coreblas_dttqrt(int m, int n, int ib,
+                double *A1, int lda1,
+                double *A2, int lda2,
+                double *T,  int ldt,
+                double *tau,
+                double *work);
+size_t coreblas_dttqrt_lwork(int m, int n, int ib);
+
+int coreblas_dttqrt_rec(int m, int n, int ib,
+                double *A1, int lda1,
+                double *A2, int lda2,
+                double *T,  int ldt,
+                double *tau,
+                double *work);
+size_t coreblas_dttqrt_rec_lwork(int m, int n, int ib);
+
+int coreblas_dormlq(coreblas_enum_t side, coreblas_enum_t trans,
+                int m, int n, int k, int ib,
+                const double *A,    int lda,
+                const double *T,    int ldt,
+                      double *C,    int ldc,
+                      double *work, int ldwork);
+size_t coreblas_dormlq_lwork(coreblas_enum_t side, int m, int n, int ib);
+
+int coreblas_dormqr(coreblas_enum_t side, coreblas_enum_t trans,
+                int m, int n, int k, int ib,
+                const double *A,    int lda,
+                const double *T,    int ldt,
+                      double *C,    int ldc,
+                      double *work, int ldwork);
+size_t coreblas_dormqr_lwork(coreblas_enum_t side, int m, int n, int ib);
+
+#undef REAL
+
+#ifdef __cplusplus
+}  // extern "C"
+#endif
+
+#endif // COREBLAS_CORE_BLAS_D_H
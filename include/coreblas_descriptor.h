@@ -0,0 +1,213 @@
+/**
+ *
+ * @file
+ *
+ *  COREBLAS is a software package provided by:
+ *  University of Tennessee, US,
+ *  University of Manchester, UK.
+ *
+ **/
+#ifndef COREBLAS_DESCRIPTOR_H
+#define COREBLAS_DESCRIPTOR_H
+
+#include "coreblas_types.h"
+
+#include <stddef.h>
+#include <assert.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/***************************************************************************//**
+ *  Tile matrix descriptor.
+ *
+ *  Tiles are stored contiguously, column major within each tile, and the
+ *  tiles in column major order. The gm-by-gn matrix is split into
+ *  (gm/mb)-by-(gn/nb) full mb-by-nb tiles (the A11 block), followed by the
+ *  last tile row (A21), the last tile column (A12) and the corner tile (A22)
+ *  when gm or gn is not a multiple of the tile size. Each tile has a leading
+ *  dimension equal to its number of rows.
+ *
+ *  A descriptor addresses the m-by-n submatrix starting at element (i, j)
+ *  of the whole matrix; i and j must be multiples of mb and nb.
+ *
+ *  For CoreBlasGeneralBand, only the tiles intersecting the band are stored,
+ *  as (klt+kut-1) tile rows per tile column.
+ **/
+typedef struct {
+    // matrix properties
+    coreblas_enum_t type;      ///< CoreBlasGeneral or CoreBlasGeneralBand
+    coreblas_enum_t uplo;      ///< upper, lower, etc.
+    coreblas_enum_t precision; ///< CoreBlasRealFloat, ..., CoreBlasComplexDouble
+
+    // pointer and offsets
+    void *matrix;  ///< pointer to the beginning of the matrix
+    size_t A21;    ///< pointer to the beginning of A21
+    size_t A12;    ///< pointer to the beginning of A12
+    size_t A22;    ///< pointer to the beginning of A22
+
+    // tile parameters
+    int mb;  ///< number of rows in a tile
+    int nb;  ///< number of columns in a tile
+
+    // main matrix parameters
+    int gm;   ///< number of rows of the entire matrix
+    int gn;   ///< number of columns of the entire matrix
+    int gmt;  ///< number of tile rows of the entire matrix
+    int gnt;  ///< number of tile columns of the entire matrix
+
+    // submatrix parameters
+    int i;   ///< row index to the beginning of the submatrix
+    int j;   ///< column index to the beginning of the submatrix
+    int m;   ///< number of rows of the submatrix
+    int n;   ///< number of columns of the submatrix
+    int mt;  ///< number of tile rows of the submatrix
+    int nt;  ///< number of tile columns of the submatrix
+
+    // submatrix parameters for a band matrix
+    int kl;   ///< number of rows below the diagonal
+    int ku;   ///< number of rows above the diagonal
+    int klt;  ///< number of tile rows below the diagonal tile
+    int kut;  ///< number of tile rows above the diagonal tile
+} coreblas_desc_t;
+
+/******************************************************************************/
+static inline size_t coreblas_element_size(coreblas_enum_t type)
+{
+    switch (type) {
+    case CoreBlasByte:          return 1;
+    case CoreBlasInteger:       return sizeof(int);
+    case CoreBlasRealFloat:     return sizeof(float);
+    case CoreBlasRealDouble:    return sizeof(double);
+    case CoreBlasComplexFloat:  return sizeof(coreblas_complex32_t);
+    case CoreBlasComplexDouble: return sizeof(coreblas_complex64_t);
+    default:                    return 0;
+    }
+}
+
+/******************************************************************************/
+static inline void *coreblas_tile_addr_general(coreblas_desc_t A, int m, int n)
+{
+    int mm = m + A.i/A.mb;
+    int nn = n + A.j/A.nb;
+    size_t eltsize = coreblas_element_size(A.precision);
+    size_t offset = 0;
+
+    int lm1 = A.gm/A.mb;
+    int ln1 = A.gn/A.nb;
+
+    if (mm < lm1)
+        if (nn < ln1)
+            offset = A.mb*A.nb*(mm + (size_t)lm1 * nn);
+        else
+            offset = A.A12 + ((size_t)A.mb * (A.gn%A.nb) * mm);
+    else
+        if (nn < ln1)
+            offset = A.A21 + ((size_t)A.nb * (A.gm%A.mb) * nn);
+        else
+            offset = A.A22;
+
+    return (void*)((char*)A.matrix + (offset*eltsize));
+}
+
+/******************************************************************************/
+static inline void *coreblas_tile_addr_band(coreblas_desc_t A, int m, int n)
+{
+    int mm = m + A.i/A.mb;
+    int nn = n + A.j/A.nb;
+    size_t eltsize = coreblas_element_size(A.precision);
+    size_t offset = A.mb*A.nb*(mm - nn + A.kut-1 + (size_t)(A.klt+A.kut-1)*nn);
+
+    return (void*)((char*)A.matrix + (offset*eltsize));
+}
+
+/***************************************************************************//**
+ *  Returns the address of tile (m, n) of the submatrix described by A.
+ **/
+static inline void *coreblas_tile_addr(coreblas_desc_t A, int m, int n)
+{
+    if (A.type == CoreBlasGeneralBand)
+        return coreblas_tile_addr_band(A, m, n);
+    else
+        return coreblas_tile_addr_general(A, m, n);
+}
+
+/***************************************************************************//**
+ *  Returns the number of rows of tile row k of the whole matrix,
+ *  i.e., the leading dimension of the tiles in that row.
+ **/
+static inline int coreblas_tile_mmain(coreblas_desc_t A, int k)
+{
+    if (A.type == CoreBlasGeneralBand) {
+        return A.mb;
+    }
+    else {
+        if (A.i/A.mb+k < A.gm/A.mb)
+            return A.mb;
+        else
+            return A.gm%A.mb;
+    }
+}
+
+/***************************************************************************//**
+ *  Returns the number of columns of tile column k of the whole matrix.
+ **/
+static inline int coreblas_tile_nmain(coreblas_desc_t A, int k)
+{
+    if (A.j/A.nb+k < A.gn/A.nb)
+        return A.nb;
+    else
+        return A.gn%A.nb;
+}
+
+/***************************************************************************//**
+ *  Returns the number of rows of tile row k that belong to the submatrix.
+ **/
+static inline int coreblas_tile_mview(coreblas_desc_t A, int k)
+{
+    if (k < A.mt-1)
+        return A.mb;
+    else
+        if ((A.i+A.m)%A.mb == 0)
+            return A.mb;
+        else
+            return (A.i+A.m)%A.mb;
+}
+
+/***************************************************************************//**
+ *  Returns the number of columns of tile column k that belong to
+ *  the submatrix.
+ **/
+static inline int coreblas_tile_nview(coreblas_desc_t A, int k)
+{
+    if (k < A.nt-1)
+        return A.nb;
+    else
+        if ((A.j+A.n)%A.nb == 0)
+            return A.nb;
+        else
+            return (A.j+A.n)%A.nb;
+}
+
+/******************************************************************************/
+int coreblas_desc_general_init(coreblas_enum_t precision, void *matrix,
+                               int mb, int nb, int lm, int ln, int i, int j,
+                               int m, int n, coreblas_desc_t *A);
+
+int coreblas_desc_general_band_init(coreblas_enum_t precision,
+                                    coreblas_enum_t uplo, void *matrix,
+                                    int mb, int nb, int lm, int ln,
+                                    int i, int j, int m, int n, int kl, int ku,
+                                    coreblas_desc_t *A);
+
+int coreblas_desc_check(coreblas_desc_t A);
+
+coreblas_desc_t coreblas_desc_view(coreblas_desc_t A, int i, int j,
+                                   int m, int n);
+
+#ifdef __cplusplus
+}  // extern "C"
+#endif
+
+#endif // COREBLAS_DESCRIPTOR_H
@@ -0,0 +1,53 @@
+/**
+ *
+ * @file
+ *
+ *  COREBLAS is a software package provided by:
+ *  University of Tennessee, US,
+ *  University of Manchester, UK.
+ *
+ * @generated from include/coreblas_zc.h, mixed zc -> ds, Fri Oct 16 03:36:55 2026
+ *
+ **/
+#ifndef COREBLAS_CORE_BLAS_DS_H
+#define COREBLAS_CORE_BLAS_DS_H
+
+#include "coreblas_types.h"
+#include "coreblas_workspace.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/******************************************************************************/
+int coreblas_dsgemm(coreblas_enum_t transa, coreblas_enum_t transb,
+                int m, int n, int k,
+                double alpha, const float *As, int ldas,
+                                          const double *B,  int ldb,
+                double beta,        double *C,  int ldc,
+                double *work);
+
+size_t coreblas_dsgemm_lwork(int m, int k);
+
+int coreblas_dlag2s(int m, int n,
+                 double *A,  int lda,
+                 float *As, int ldas);
+
+void coreblas_slag2d(int m, int n,
+                 float *As, int ldas,
+                 double *A,  int lda);
+
+/******************************************************************************/
+void coreblas_kernel_dlag2s(int m, int n,
+                     double *A,  int lda,
+                     float *As, int ldas);
+
+void coreblas_kernel_slag2d(int m, int n,
+                     float *As, int ldas,
+                     double *A,  int lda);
+
+#ifdef __cplusplus
+}  // extern "C"
+#endif
+
+#endif // COREBLAS_CORE_BLAS_DS_H
@@ -0,0 +1,40 @@
+/**
+ *
+ * @file
+ *
+ *  COREBLAS is a software package provided by:
+ *  University of Tennessee, US,
+ *  University of Manchester, UK.
+ *
+ **/
+#ifndef COREBLAS_HALF_H
+#define COREBLAS_HALF_H
+
+#include "coreblas_types.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/******************************************************************************/
+int coreblas_slag2h(int m, int n,
+                    const float *A, int lda,
+                    coreblas_half_t *Ah, int ldah);
+
+void coreblas_hlag2s(int m, int n,
+                     const coreblas_half_t *Ah, int ldah,
+                     float *A, int lda);
+
+int coreblas_slag2b(int m, int n,
+                    const float *A, int lda,
+                    coreblas_bfloat16_t *Ab, int ldab);
+
+void coreblas_blag2s(int m, int n,
+                     const coreblas_bfloat16_t *Ab, int ldab,
+                     float *A, int lda);
+
+#ifdef __cplusplus
+}  // extern "C"
+#endif
+
+#endif // COREBLAS_HALF_H
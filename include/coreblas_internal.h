@@ -43,4 +43,9 @@ static inline int imax(int a, int b)
 }  // extern "C"
 #endif
 
+#include "coreblas_internal_s.h"
+#include "coreblas_internal_d.h"
+#include "coreblas_internal_c.h"
+#include "coreblas_internal_z.h"
+
 #endif // COREBLAS_INTERNAL_H
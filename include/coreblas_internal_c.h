@@ -0,0 +1,126 @@
+/**
+ *
+ * @file
+ *
+ *  COREBLAS is a software package provided by:
+ *  University of Tennessee, US,
+ *  University of Manchester, UK.
+ *
+ * @generated from include/coreblas_internal_z.h, normal z -> c, Fri Oct 16 03:36:55 2026
+ *
+ **/
+#ifndef COREBLAS_INTERNAL_C_H
+#define COREBLAS_INTERNAL_C_H
+
+#include "coreblas_types.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/*******************************************************************************
+ *  Kernels without argument checks, called by the kernels that nest them
+ *  after checking their own arguments.
+ **/
+int coreblas_cgeqrt_nocheck(int m, int n, int ib,
+                coreblas_complex32_t *A, int lda,
+                coreblas_complex32_t *T, int ldt,
+                coreblas_complex32_t *tau,
+                coreblas_complex32_t *work);
+
+int coreblas_cpamm_nocheck(coreblas_enum_t op, coreblas_enum_t side,
+                coreblas_enum_t direct, coreblas_enum_t storev,
+                int m, int n, int k, int l,
+                const coreblas_complex32_t *A1, int lda1,
+                      coreblas_complex32_t *A2, int lda2,
+                const coreblas_complex32_t *V,  int ldv,
+                      coreblas_complex32_t *W,  int ldw);
+
+int coreblas_cparfb_nocheck(coreblas_enum_t side, coreblas_enum_t trans,
+                coreblas_enum_t direct, coreblas_enum_t storev,
+                int m1, int n1, int m2, int n2, int k, int l,
+                      coreblas_complex32_t *A1,   int lda1,
+                      coreblas_complex32_t *A2,   int lda2,
+                const coreblas_complex32_t *V,    int ldv,
+                const coreblas_complex32_t *T,    int ldt,
+                      coreblas_complex32_t *work, int ldwork);
+
+int coreblas_ctsmlq_nocheck(coreblas_enum_t side, coreblas_enum_t trans,
+                int m1, int n1, int m2, int n2, int k, int ib,
+                      coreblas_complex32_t *A1,   int lda1,
+                      coreblas_complex32_t *A2,   int lda2,
+                const coreblas_complex32_t *V,    int ldv,
+                const coreblas_complex32_t *T,    int ldt,
+                      coreblas_complex32_t *work, int ldwork);
+
+int coreblas_ctsmql_nocheck(coreblas_enum_t side, coreblas_enum_t trans,
+                int m1, int n1, int m2, int n2, int k, int ib,
+                      coreblas_complex32_t *A1,   int lda1,
+                      coreblas_complex32_t *A2,   int lda2,
+                const coreblas_complex32_t *V,    int ldv,
+                const coreblas_complex32_t *T,    int ldt,
+                      coreblas_complex32_t *work, int ldwork);
+
+int coreblas_ctsmqr_nocheck(coreblas_enum_t side, coreblas_enum_t trans,
+                int m1, int n1, int m2, int n2, int k, int ib,
+                      coreblas_complex32_t *A1,   int lda1,
+                      coreblas_complex32_t *A2,   int lda2,
+                const coreblas_complex32_t *V,    int ldv,
+                const coreblas_complex32_t *T,    int ldt,
+                      coreblas_complex32_t *work, int ldwork);
+
+int coreblas_ctsmrq_nocheck(coreblas_enum_t side, coreblas_enum_t trans,
+                int m1, int n1, int m2, int n2, int k, int ib,
+                      coreblas_complex32_t *A1,   int lda1,
+                      coreblas_complex32_t *A2,   int lda2,
+                const coreblas_complex32_t *V,    int ldv,
+                const coreblas_complex32_t *T,    int ldt,
+                      coreblas_complex32_t *work, int ldwork);
+
+/*******************************************************************************
+ *  Merge steps of the recursive larft, shared with the recursive panels
+ *  of geqrt, tsqrt and ttqrt.
+ **/
+void coreblas_clarft_merge(coreblas_enum_t storev, int n, int k1, int k2,
+                const coreblas_complex32_t *V, int ldv,
+                      coreblas_complex32_t *T, int ldt);
+
+void coreblas_clarft_pent_merge(coreblas_enum_t storev,
+                int m, int k1, int k2, int l,
+                const coreblas_complex32_t *V, int ldv,
+                      coreblas_complex32_t *T, int ldt);
+
+/*******************************************************************************
+ *  Rowwise forward block reflector with its leading triangle passed
+ *  separately, for coreblas_cunmlq.
+ **/
+int coreblas_clarfb_gemm_split(coreblas_enum_t side, coreblas_enum_t trans,
+                int M, int N, int K,
+                const coreblas_complex32_t *V1, int LDV1,
+                const coreblas_complex32_t *V2, int LDV2,
+                const coreblas_complex32_t *T,  int LDT,
+                      coreblas_complex32_t *C,  int LDC,
+                      coreblas_complex32_t *WORK, int LDWORK);
+
+/*******************************************************************************
+ *  Sum of the absolute values of a vector, for the norm kernels.
+ **/
+float coreblas_cabsum(int m, const coreblas_complex32_t *x, float *y);
+void coreblas_cabsum_add(int m, const coreblas_complex32_t *x, float *y);
+
+/*******************************************************************************
+ *  Largest absolute value of a vector, skipping NaNs, for the pivot search.
+ **/
+int coreblas_icamax_nonan(int m, const coreblas_complex32_t *x, float *amax);
+
+/*******************************************************************************
+ *  Scaled sum of squares by Blue's algorithm, for the ssq kernels.
+ **/
+void coreblas_cssq_update(int m, const coreblas_complex32_t *x, float *acc);
+void coreblas_cssq_finish(const float *acc, float *scale, float *sumsq);
+
+#ifdef __cplusplus
+}  // extern "C"
+#endif
+
+#endif // COREBLAS_INTERNAL_C_H
@@ -0,0 +1,126 @@
+/**
+ *
+ * @file
+ *
+ *  COREBLAS is a software package provided by:
+ *  University of Tennessee, US,
+ *  University of Manchester, UK.
+ *
+ * @generated from include/coreblas_internal_z.h, normal z -> d, Fri Oct 16 03:36:55 2026
+ *
+ **/
+#ifndef COREBLAS_INTERNAL_D_H
+#define COREBLAS_INTERNAL_D_H
+
+#include "coreblas_types.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/*******************************************************************************
+ *  Kernels without argument checks, called by the kernels that nest them
+ *  after checking their own arguments.
+ **/
+int coreblas_dgeqrt_nocheck(int m, int n, int ib,
+                double *A, int lda,
+                double *T, int ldt,
+                double *tau,
+                double *work);
+
+int coreblas_dpamm_nocheck(coreblas_enum_t op, coreblas_enum_t side,
+                coreblas_enum_t direct, coreblas_enum_t storev,
+                int m, int n, int k, int l,
+                const double *A1, int lda1,
+                      double *A2, int lda2,
+                const double *V,  int ldv,
+                      double *W,  int ldw);
+
+int coreblas_dparfb_nocheck(coreblas_enum_t side, coreblas_enum_t trans,
+                coreblas_enum_t direct, coreblas_enum_t storev,
+                int m1, int n1, int m2, int n2, int k, int l,
+                      double *A1,   int lda1,
+                      double *A2,   int lda2,
+                const double *V,    int ldv,
+                const double *T,    int ldt,
+                      double *work, int ldwork);
+
+int coreblas_dtsmlq_nocheck(coreblas_enum_t side, coreblas_enum_t trans,
+                int m1, int n1, int m2, int n2, int k, int ib,
+                      double *A1,   int lda1,
+                      double *A2,   int lda2,
+                const double *V,    int ldv,
+                const double *T,    int ldt,
+                      double *work, int ldwork);
+
+int coreblas_dtsmql_nocheck(coreblas_enum_t side, coreblas_enum_t trans,
+                int m1, int n1, int m2, int n2, int k, int ib,
+                      double *A1,   int lda1,
+                      double *A2,   int lda2,
+                const double *V,    int ldv,
+                const double *T,    int ldt,
+                      double *work, int ldwork);
+
+int coreblas_dtsmqr_nocheck(coreblas_enum_t side, coreblas_enum_t trans,
+                int m1, int n1, int m2, int n2, int k, int ib,
+                      double *A1,   int lda1,
+                      double *A2,   int lda2,
+                const double *V,    int ldv,
+                const double *T,    int ldt,
+                      double *work, int ldwork);
+
+int coreblas_dtsmrq_nocheck(coreblas_enum_t side, coreblas_enum_t trans,
+                int m1, int n1, int m2, int n2, int k, int ib,
+                      double *A1,   int lda1,
+                      double *A2,   int lda2,
+                const double *V,    int ldv,
+                const double *T,    int ldt,
+                      double *work, int ldwork);
+
+/*******************************************************************************
+ *  Merge steps of the recursive larft, shared with the recursive panels
+ *  of geqrt, tsqrt and ttqrt.
+ **/
+void coreblas_dlarft_merge(coreblas_enum_t storev, int n, int k1, int k2,
+                const double *V, int ldv,
+                      double *T, int ldt);
+
+void coreblas_dlarft_pent_merge(coreblas_enum_t storev,
+                int m, int k1, int k2, int l,
+                const double *V, int ldv,
+                      double *T, int ldt);
+
+/*******************************************************************************
+ *  Rowwise forward block reflector with its leading triangle passed
+ *  separately, for coreblas_dormlq.
+ **/
+int coreblas_dlarfb_gemm_split(coreblas_enum_t side, coreblas_enum_t trans,
+                int M, int N, int K,
+                const double *V1, int LDV1,
+                const double *V2, int LDV2,
+                const double *T,  int LDT,
+                      double *C,  int LDC,
+                      double *WORK, int LDWORK);
+
+/*******************************************************************************
+ *  Sum of the absolute values of a vector, for the norm kernels.
+ **/
+double coreblas_dabsum(int m, const double *x, double *y);
+void coreblas_dabsum_add(int m, const double *x, double *y);
+
+/*******************************************************************************
+ *  Largest absolute value of a vector, skipping NaNs, for the pivot search.
+ **/
+int coreblas_idamax_nonan(int m, const double *x, double *amax);
+
+/*******************************************************************************
+ *  Scaled sum of squares by Blue's algorithm, for the ssq kernels.
+ **/
+void coreblas_dssq_update(int m, const double *x, double *acc);
+void coreblas_dssq_finish(const double *acc, double *scale, double *sumsq);
+
+#ifdef __cplusplus
+}  // extern "C"
+#endif
+
+#endif // COREBLAS_INTERNAL_D_H
@@ -0,0 +1,126 @@
+/**
+ *
+ * @file
+ *
+ *  COREBLAS is a software package provided by:
+ *  University of Tennessee, US,
+ *  University of Manchester, UK.
+ *
+ * @generated from include/coreblas_internal_z.h, normal z -> s, Fri Oct 16 03:36:55 2026
+ *
+ **/
+#ifndef COREBLAS_INTERNAL_S_H
+#define COREBLAS_INTERNAL_S_H
+
+#include "coreblas_types.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/*******************************************************************************
+ *  Kernels without argument checks, called by the kernels that nest them
+ *  after checking their own arguments.
+ **/
+int coreblas_sgeqrt_nocheck(int m, int n, int ib,
+                float *A, int lda,
+                float *T, int ldt,
+                float *tau,
+                float *work);
+
+int coreblas_spamm_nocheck(coreblas_enum_t op, coreblas_enum_t side,
+                coreblas_enum_t direct, coreblas_enum_t storev,
+                int m, int n, int k, int l,
+                const float *A1, int lda1,
+                      float *A2, int lda2,
+                const float *V,  int ldv,
+                      float *W,  int ldw);
+
+int coreblas_sparfb_nocheck(coreblas_enum_t side, coreblas_enum_t trans,
+                coreblas_enum_t direct, coreblas_enum_t storev,
+                int m1, int n1, int m2, int n2, int k, int l,
+                      float *A1,   int lda1,
+                      float *A2,   int lda2,
+                const float *V,    int ldv,
+                const float *T,    int ldt,
+                      float *work, int ldwork);
+
+int coreblas_stsmlq_nocheck(coreblas_enum_t side, coreblas_enum_t trans,
+                int m1, int n1, int m2, int n2, int k, int ib,
+                      float *A1,   int lda1,
+                      float *A2,   int lda2,
+                const float *V,    int ldv,
+                const float *T,    int ldt,
+                      float *work, int ldwork);
+
+int coreblas_stsmql_nocheck(coreblas_enum_t side, coreblas_enum_t trans,
+                int m1, int n1, int m2, int n2, int k, int ib,
+                      float *A1,   int lda1,
+                      float *A2,   int lda2,
+                const float *V,    int ldv,
+                const float *T,    int ldt,
+                      float *work, int ldwork);
+
+int coreblas_stsmqr_nocheck(coreblas_enum_t side, coreblas_enum_t trans,
+                int m1, int n1, int m2, int n2, int k, int ib,
+                      float *A1,   int lda1,
+                      float *A2,   int lda2,
+                const float *V,    int ldv,
+                const float *T,    int ldt,
+                      float *work, int ldwork);
+
+int coreblas_stsmrq_nocheck(coreblas_enum_t side, coreblas_enum_t trans,
+                int m1, int n1, int m2, int n2, int k, int ib,
+                      float *A1,   int lda1,
+                      float *A2,   int lda2,
+                const float *V,    int ldv,
+                const float *T,    int ldt,
+                      float *work, int ldwork);
+
+/*******************************************************************************
+ *  Merge steps of the recursive larft, shared with the recursive panels
+ *  of geqrt, tsqrt and ttqrt.
+ **/
+void coreblas_slarft_merge(coreblas_enum_t storev, int n, int k1, int k2,
+                const float *V, int ldv,
+                      float *T, int ldt);
+
+void coreblas_slarft_pent_merge(coreblas_enum_t storev,
+                int m, int k1, int k2, int l,
+                const float *V, int ldv,
+                      float *T, int ldt);
+
+/*******************************************************************************
+ *  Rowwise forward block reflector with its leading triangle passed
+ *  separately, for coreblas_sormlq.
+ **/
+int coreblas_slarfb_gemm_split(coreblas_enum_t side, coreblas_enum_t trans,
+                int M, int N, int K,
+                const float *V1, int LDV1,
+                const float *V2, int LDV2,
+                const float *T,  int LDT,
+                      float *C,  int LDC,
+                      float *WORK, int LDWORK);
+
+/*******************************************************************************
+ *  Sum of the absolute values of a vector, for the norm kernels.
+ **/
+float coreblas_sabsum(int m, const float *x, float *y);
+void coreblas_sabsum_add(int m, const float *x, float *y);
+
+/*******************************************************************************
+ *  Largest absolute value of a vector, skipping NaNs, for the pivot search.
+ **/
+int coreblas_isamax_nonan(int m, const float *x, float *amax);
+
+/*******************************************************************************
+ *  Scaled sum of squares by Blue's algorithm, for the ssq kernels.
+ **/
+void coreblas_sssq_update(int m, const float *x, float *acc);
+void coreblas_sssq_finish(const float *acc, float *scale, float *sumsq);
+
+#ifdef __cplusplus
+}  // extern "C"
+#endif
+
+#endif // COREBLAS_INTERNAL_S_H
@@ -0,0 +1,126 @@
+/**
+ *
+ * @file
+ *
+ *  COREBLAS is a software package provided by:
+ *  University of Tennessee, US,
+ *  University of Manchester, UK.
+ *
+ * @precisions normal z -> s d c
+ *
+ **/
+#ifndef COREBLAS_INTERNAL_Z_H
+#define COREBLAS_INTERNAL_Z_H
+
+#include "coreblas_types.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/*******************************************************************************
+ *  Kernels without argument checks, called by the kernels that nest them
+ *  after checking their own arguments.
+ **/
+int coreblas_zgeqrt_nocheck(int m, int n, int ib,
+                coreblas_complex64_t *A, int lda,
+                coreblas_complex64_t *T, int ldt,
+                coreblas_complex64_t *tau,
+                coreblas_complex64_t *work);
+
+int coreblas_zpamm_nocheck(coreblas_enum_t op, coreblas_enum_t side,
+                coreblas_enum_t direct, coreblas_enum_t storev,
+                int m, int n, int k, int l,
+                const coreblas_complex64_t *A1, int lda1,
+                      coreblas_complex64_t *A2, int lda2,
+                const coreblas_complex64_t *V,  int ldv,
+                      coreblas_complex64_t *W,  int ldw);
+
+int coreblas_zparfb_nocheck(coreblas_enum_t side, coreblas_enum_t trans,
+                coreblas_enum_t direct, coreblas_enum_t storev,
+                int m1, int n1, int m2, int n2, int k, int l,
+                      coreblas_complex64_t *A1,   int lda1,
+                      coreblas_complex64_t *A2,   int lda2,
+                const coreblas_complex64_t *V,    int ldv,
+                const coreblas_complex64_t *T,    int ldt,
+                      coreblas_complex64_t *work, int ldwork);
+
+int coreblas_ztsmlq_nocheck(coreblas_enum_t side, coreblas_enum_t trans,
+                int m1, int n1, int m2, int n2, int k, int ib,
+                      coreblas_complex64_t *A1,   int lda1,
+                      coreblas_complex64_t *A2,   int lda2,
+                const coreblas_complex64_t *V,    int ldv,
+                const coreblas_complex64_t *T,    int ldt,
+                      coreblas_complex64_t *work, int ldwork);
+
+int coreblas_ztsmql_nocheck(coreblas_enum_t side, coreblas_enum_t trans,
+                int m1, int n1, int m2, int n2, int k, int ib,
+                      coreblas_complex64_t *A1,   int lda1,
+                      coreblas_complex64_t *A2,   int lda2,
+                const coreblas_complex64_t *V,    int ldv,
+                const coreblas_complex64_t *T,    int ldt,
+                      coreblas_complex64_t *work, int ldwork);
+
+int coreblas_ztsmqr_nocheck(coreblas_enum_t side, coreblas_enum_t trans,
+                int m1, int n1, int m2, int n2, int k, int ib,
+                      coreblas_complex64_t *A1,   int lda1,
+                      coreblas_complex64_t *A2,   int lda2,
+                const coreblas_complex64_t *V,    int ldv,
+                const coreblas_complex64_t *T,    int ldt,
+                      coreblas_complex64_t *work, int ldwork);
+
+int coreblas_ztsmrq_nocheck(coreblas_enum_t side, coreblas_enum_t trans,
+                int m1, int n1, int m2, int n2, int k, int ib,
+                      coreblas_complex64_t *A1,   int lda1,
+                      coreblas_complex64_t *A2,   int lda2,
+                const coreblas_complex64_t *V,    int ldv,
+                const coreblas_complex64_t *T,    int ldt,
+                      coreblas_complex64_t *work, int ldwork);
+
+/*******************************************************************************
+ *  Merge steps of the recursive larft, shared with the recursive panels
+ *  of geqrt, tsqrt and ttqrt.
+ **/
+void coreblas_zlarft_merge(coreblas_enum_t storev, int n, int k1, int k2,
+                const coreblas_complex64_t *V, int ldv,
+                      coreblas_complex64_t *T, int ldt);
+
+void coreblas_zlarft_pent_merge(coreblas_enum_t storev,
+                int m, int k1, int k2, int l,
+                const coreblas_complex64_t *V, int ldv,
+                      coreblas_complex64_t *T, int ldt);
+
+/*******************************************************************************
+ *  Rowwise forward block reflector with its leading triangle passed
+ *  separately, for coreblas_zunmlq.
+ **/
+int coreblas_zlarfb_gemm_split(coreblas_enum_t side, coreblas_enum_t trans,
+                int M, int N, int K,
+                const coreblas_complex64_t *V1, int LDV1,
+                const coreblas_complex64_t *V2, int LDV2,
+                const coreblas_complex64_t *T,  int LDT,
+                      coreblas_complex64_t *C,  int LDC,
+                      coreblas_complex64_t *WORK, int LDWORK);
+
+/*******************************************************************************
+ *  Sum of the absolute values of a vector, for the norm kernels.
+ **/
+double coreblas_zabsum(int m, const coreblas_complex64_t *x, double *y);
+void coreblas_zabsum_add(int m, const coreblas_complex64_t *x, double *y);
+
+/*******************************************************************************
+ *  Largest absolute value of a vector, skipping NaNs, for the pivot search.
+ **/
+int coreblas_izamax_nonan(int m, const coreblas_complex64_t *x, double *amax);
+
+/*******************************************************************************
+ *  Scaled sum of squares by Blue's algorithm, for the ssq kernels.
+ **/
+void coreblas_zssq_update(int m, const coreblas_complex64_t *x, double *acc);
+void coreblas_zssq_finish(const double *acc, double *scale, double *sumsq);
+
+#ifdef __cplusplus
+}  // extern "C"
+#endif
+
+#endif // COREBLAS_INTERNAL_Z_H
@@ -0,0 +1,557 @@
+/**
+ *
+ * @file
+ *
+ *  COREBLAS is a software package provided by:
+ *  University of Tennessee, US,
+ *  University of Manchester, UK.
+ *
+ * @generated from include/coreblas_z.h, normal z -> s, Fri Oct 16 03:36:55 2026
+ *
+ **/
+#ifndef COREBLAS_CORE_BLAS_S_H
+#define COREBLAS_CORE_BLAS_S_H
+
+#include "coreblas_types.h"
+#include "coreblas_workspace.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#define REAL
+
+/******************************************************************************/
+#ifdef COMPLEX
+float fabsf(float alpha);
+#endif
+
+int coreblas_isamax(int m, const float *x, float *value);
+void coreblas_isamax_tile(int m, int n,
+                const float *A, int lda,
+                int *imax, int *jmax, float *value);
+void coreblas_kernel_samax(int colrow, int m, int n,
+                const float *A, int lda,
+                float *values);
+
+void coreblas_sgbtype1cb(coreblas_enum_t uplo, int n, int nb,
+                      float *A, int lda,
+                      float *VQ, float *TAUQ,
+                      float *VP, float *TAUP,
+                      int st, int ed, int sweep, int Vblksiz, int WANTZ,
+                      float *work);
+size_t coreblas_sgbtype1cb_lwork(int nb);
+    
+void coreblas_sgbtype2cb(coreblas_enum_t uplo, int n, int nb,
+                      float *A, int lda,
+                      float *VQ, float *TAUQ,
+                      float *VP, float *TAUP,
+                      int st, int ed, int sweep, int Vblksiz, int WANTZ,
+                      float *work);
+size_t coreblas_sgbtype2cb_lwork(int nb);
+    
+void coreblas_sgbtype3cb(coreblas_enum_t uplo, int n, int nb,
+                      float *A, int lda,
+                      float *VQ, float *TAUQ,
+                      float *VP, float *TAUP,
+                      int st, int ed, int sweep, int Vblksiz, int WANTZ,
+                      float *work);
+size_t coreblas_sgbtype3cb_lwork(int nb);
+
+int coreblas_sgbbrd_static(coreblas_enum_t uplo, int n, int nb, int Vblksiz,
+                float *A, int lda,
+                float *VQ, float *TAUQ,
+                float *VP, float *TAUP,
+                int wantz, coreblas_workspace_t *work, int *iwork);
+size_t coreblas_sgbbrd_static_liwork(int n, int nb);
+    
+int coreblas_sgeadd(coreblas_enum_t transa,
+                int m, int n,
+                float alpha, const float *A, int lda,
+                float beta,        float *B, int ldb);
+
+int coreblas_sgelqt(int m, int n, int ib,
+                float *A, int lda,
+                float *T, int ldt,
+                float *tau,
+                float *work);
+size_t coreblas_sgelqt_lwork(int m, int n, int ib);
+
+void coreblas_sgemm(coreblas_enum_t transa, coreblas_enum_t transb,
+                int m, int n, int k,
+                float alpha, const float *A, int lda,
+                                          const float *B, int ldb,
+                float beta,        float *C, int ldc);
+
+int coreblas_sgemm_batched(coreblas_enum_t transa, coreblas_enum_t transb,
+                int m, int n, int k,
+                float alpha,
+                const float * const *A, int lda,
+                const float * const *B, int ldb,
+                float beta,
+                float * const *C, int ldc,
+                int batch);
+
+int coreblas_sgemm_batched_strided(coreblas_enum_t transa,
+                coreblas_enum_t transb,
+                int m, int n, int k,
+                float alpha,
+                const float *A, int lda, size_t strideA,
+                const float *B, int ldb, size_t strideB,
+                float beta,
+                float *C, int ldc, size_t strideC,
+                int batch);
+
+int coreblas_sgeqrt(int m, int n, int ib,
+                float *A, int lda,
+                float *T, int ldt,
+                float *tau,
+                float *work);
+size_t coreblas_sgeqrt_lwork(int m, int n, int ib);
+
+int coreblas_sgeqrt_batched(int m, int n, int ib,
+                float * const *A, int lda,
+                float * const *T, int ldt,
+                coreblas_workspace_t *work, int batch);
+
+int coreblas_sgeqrt_batched_strided(int m, int n, int ib,
+                float *A, int lda, size_t strideA,
+                float *T, int ldt, size_t strideT,
+                coreblas_workspace_t *work, int batch);
+size_t coreblas_sgeqrt_batched_lwork(int m, int n, int ib);
+
+void coreblas_sgessq(int m, int n,
+                 const float *A, int lda,
+                 float *scale, float *sumsq);
+void coreblas_sgessq_aux(int n,
+                const float *scale, const float *sumsq,
+                float *value);
+
+void coreblas_sgetrf(coreblas_desc_t A, int *ipiv, int ib, int rank, int size,
+                 volatile int *max_idx, volatile float *max_val,
+                 volatile int *info, coreblas_barrier_t *barrier);
+
+void coreblas_sgetrf_calu(coreblas_desc_t A, int *ipiv, int rank, int size,
+                float *work, int *iwork,
+                volatile int *info, coreblas_barrier_t *barrier);
+size_t coreblas_sgetrf_calu_lwork(coreblas_desc_t A, int size);
+size_t coreblas_sgetrf_calu_liwork(coreblas_desc_t A, int size);
+
+int coreblas_ssygst(int itype, coreblas_enum_t uplo,
+                int n,
+                float *A, int lda,
+                float *B, int ldb);
+
+void coreblas_ssymm(coreblas_enum_t side, coreblas_enum_t uplo,
+                int m, int n,
+                float alpha, const float *A, int lda,
+                                          const float *B, int ldb,
+                float beta,        float *C, int ldc);
+
+void coreblas_ssyr2k(coreblas_enum_t uplo, coreblas_enum_t trans,
+                 int n, int k,
+                 float alpha, const float *A, int lda,
+                                           const float *B, int ldb,
+                 float beta,                    float *C, int ldc);
+
+int coreblas_ssyrfb(coreblas_enum_t uplo, int n, int k, int ib,
+                const float *A,    int lda,
+                const float *T,    int ldt,
+                      float *C,    int ldc,
+                      float *work);
+size_t coreblas_ssyrfb_lwork(int n, int ib);
+
+void coreblas_ssyrk(coreblas_enum_t uplo, coreblas_enum_t trans,
+                int n, int k,
+                float alpha, const float *A, int lda,
+                float beta,        float *C, int ldc);
+
+void coreblas_ssyssq(coreblas_enum_t uplo,
+                 int n,
+                 const float *A, int lda,
+                 float *scale, float *sumsq);
+
+void coreblas_ssyssq(coreblas_enum_t uplo,
+                 int n,
+                 const float *A, int lda,
+                 float *scale, float *sumsq);
+void coreblas_ssyssq_aux(int m, int n,
+                const float *scale, const float *sumsq,
+                float *value);
+
+void coreblas_slacpy(coreblas_enum_t uplo, coreblas_enum_t transa,
+                 int m, int n,
+                 const float *A, int lda,
+                       float *B, int ldb);
+
+void coreblas_slacpy_lapack2tile_band(coreblas_enum_t uplo,
+                                  int it, int jt,
+                                  int m, int n, int nb, int kl, int ku,
+                                  const float *A, int lda,
+                                        float *B, int ldb);
+
+void coreblas_slacpy_tile2lapack_band(coreblas_enum_t uplo,
+                                  int it, int jt,
+                                  int m, int n, int nb, int kl, int ku,
+                                  const float *B, int ldb,
+                                        float *A, int lda);
+
+void coreblas_slange(coreblas_enum_t norm,
+                 int m, int n,
+                 const float *A, int lda,
+                 float *work, float *result);
+size_t coreblas_slange_lwork(coreblas_enum_t norm, int m, int n);
+void coreblas_slange_aux(coreblas_enum_t norm, int m, int n,
+                const float *A, int lda,
+                float *value);
+
+void coreblas_slansy(coreblas_enum_t norm, coreblas_enum_t uplo,
+                 int n,
+                 const float *A, int lda,
+                 float *work, float *value);
+size_t coreblas_slansy_lwork(coreblas_enum_t norm, int n);
+void coreblas_slansy_aux(coreblas_enum_t norm, coreblas_enum_t uplo,
+                int n,
+                const float *A, int lda,
+                float *value);
+
+void coreblas_slansy(coreblas_enum_t norm, coreblas_enum_t uplo,
+                 int n,
+                 const float *A, int lda,
+                 float *work, float *value);
+size_t coreblas_slansy_lwork(coreblas_enum_t norm, int n);
+void coreblas_slansy_aux(coreblas_enum_t norm, coreblas_enum_t uplo,
+                int n,
+                const float *A, int lda,
+                float *value);
+
+void coreblas_slantr(coreblas_enum_t norm, coreblas_enum_t uplo, coreblas_enum_t diag,
+                 int m, int n,
+                 const float *A, int lda,
+                 float *work, float *value);
+size_t coreblas_slantr_lwork(coreblas_enum_t norm, int m, int n);
+void coreblas_slantr_aux(coreblas_enum_t norm, coreblas_enum_t uplo,
+                coreblas_enum_t diag,
+                int m, int n,
+                const float *A, int lda,
+                float *value);
+
+int coreblas_slarfb_gemm(coreblas_enum_t side, coreblas_enum_t trans, int direct, int storev,
+                     int M, int N, int K,
+                     const float *V, int LDV,
+                     const float *T, int LDT,
+                     float *C, int LDC,
+                     float *WORK, int LDWORK);
+size_t coreblas_slarfb_gemm_lwork(coreblas_enum_t side, int M, int N, int K);
+
+int coreblas_slarft(coreblas_enum_t storev, int n, int k,
+                    const float *V, int ldv,
+                    const float *tau,
+                          float *T, int ldt);
+
+int coreblas_slarft_pent(coreblas_enum_t storev, int m, int k, int l,
+                         const float *V, int ldv,
+                         const float *tau,
+                               float *T, int ldt);
+
+void coreblas_slascl(coreblas_enum_t uplo,
+                 float cfrom, float cto,
+                 int m, int n,
+                 float *A, int lda);
+
+void coreblas_slaset(coreblas_enum_t uplo,
+                 int m, int n,
+                 float alpha, float beta,
+                 float *A, int lda);
+
+void coreblas_sgeswp(coreblas_enum_t colrow,
+                 coreblas_desc_t A, int k1, int k2, const int *ipiv, int incx);
+
+void coreblas_sgeswp_blocked(coreblas_enum_t colrow, coreblas_desc_t A,
+                int k1, int k2, const int *ipiv, int incx,
+                int rank, int size,
+                float *work, int *iwork);
+size_t coreblas_sgeswp_blocked_lwork(coreblas_desc_t A, int k1, int k2);
+size_t coreblas_sgeswp_blocked_liwork(int k1, int k2);
+
+void coreblas_ssyswp(int rank, int num_threads,
+                 int uplo, coreblas_desc_t A, int k1, int k2, const int *ipiv,
+                 int incx, coreblas_barrier_t *barrier);
+
+int coreblas_slauum(coreblas_enum_t uplo,
+                int n,
+                float *A, int lda);
+
+int coreblas_spamm(coreblas_enum_t op, coreblas_enum_t side,
+               coreblas_enum_t storev,
+               int m, int n, int k, int l,
+               const float *A1, int lda1,
+                     float *A2, int lda2,
+               const float *V,  int ldv,
+                     float *W,  int ldw);
+
+int coreblas_spamm_direct(coreblas_enum_t op, coreblas_enum_t side,
+               coreblas_enum_t direct, coreblas_enum_t storev,
+               int m, int n, int k, int l,
+               const float *A1, int lda1,
+                     float *A2, int lda2,
+               const float *V,  int ldv,
+                     float *W,  int ldw);
+
+int coreblas_sparfb(coreblas_enum_t side, coreblas_enum_t trans, coreblas_enum_t direct,
+                coreblas_enum_t storev,
+                int m1, int n1, int m2, int n2, int k, int l,
+                      float *A1,   int lda1,
+                      float *A2,   int lda2,
+                const float *V,    int ldv,
+                const float *T,    int ldt,
+                      float *work, int ldwork);
+size_t coreblas_sparfb_lwork(coreblas_enum_t side, int m1, int n1, int k);
+
+int coreblas_spemv(coreblas_enum_t trans, int storev,
+               int m, int n, int l,
+               float alpha,
+               const float *A, int lda,
+               const float *X, int incx,
+               float beta,
+               float *Y, int incy,
+               float *work);
+size_t coreblas_spemv_lwork(int m, int n, int l);
+
+int coreblas_spotrf(coreblas_enum_t uplo,
+                int n,
+                float *A, int lda);
+
+void coreblas_sreduce_ssq(int n, const float *scale, const float *sumsq,
+                float *scl, float *sum);
+void coreblas_sreduce_norm(coreblas_enum_t norm, int m, int n,
+                const float *W, int ldw, float *value);
+
+void coreblas_ssymm(coreblas_enum_t side, coreblas_enum_t uplo,
+                int m, int n,
+                float alpha, const float *A, int lda,
+                                          const float *B, int ldb,
+                float beta,        float *C, int ldc);
+
+void coreblas_ssyr2k(
+    coreblas_enum_t uplo, coreblas_enum_t trans,
+    int n, int k,
+    float alpha, const float *A, int lda,
+                              const float *B, int ldb,
+    float beta,        float *C, int ldc);
+
+void coreblas_ssyrk(coreblas_enum_t uplo, coreblas_enum_t trans,
+                int n, int k,
+                float alpha, const float *A, int lda,
+                float beta,        float *C, int ldc);
+
+int coreblas_stradd(coreblas_enum_t uplo, coreblas_enum_t transa,
+                int m, int n,
+                float alpha, const float *A, int lda,
+                float beta,        float *B, int ldb);
+
+void coreblas_strmm(coreblas_enum_t side, coreblas_enum_t uplo,
+                coreblas_enum_t transa, coreblas_enum_t diag,
+                int m, int n,
+                float alpha, const float *A, int lda,
+                                                float *B, int ldb);
+
+void coreblas_strsm(coreblas_enum_t side, coreblas_enum_t uplo,
+                coreblas_enum_t transa, coreblas_enum_t diag,
+                int m, int n,
+                float alpha, const float *A, int lda,
+                                                float *B, int ldb);
+
+void coreblas_strssq(coreblas_enum_t uplo, coreblas_enum_t diag,
+                 int m, int n,
+                 const float *A, int lda,
+                 float *scale, float *sumsq);
+
+int coreblas_strtri(coreblas_enum_t uplo, coreblas_enum_t diag,
+                int n,
+                float *A, int lda);
+
+int coreblas_stslqt(int m, int n, int ib,
+                float *A1, int lda1,
+                float *A2, int lda2,
+                float *T,  int ldt,
+                float *tau,
+                float *work);
+size_t coreblas_stslqt_lwork(int m, int n, int ib);
+
+int coreblas_stsmlq(coreblas_enum_t side, coreblas_enum_t trans,
+                int m1, int n1, int m2, int n2, int k, int ib,
+                      float *A1,   int lda1,
+                      float *A2,   int lda2,
+                const float *V,    int ldv,
+                const float *T,    int ldt,
+                      float *work, int ldwork);
+size_t coreblas_stsmlq_lwork(coreblas_enum_t side, int m1, int n1, int ib);
+
+int coreblas_stsmql(coreblas_enum_t side, coreblas_enum_t trans,
+                int m1, int n1, int m2, int n2, int k, int ib,
+                      float *A1,   int lda1,
+                      float *A2,   int lda2,
+                const float *V,    int ldv,
+                const float *T,    int ldt,
+                      float *work, int ldwork);
+size_t coreblas_stsmql_lwork(coreblas_enum_t side, int m1, int n1, int ib);
+
+int coreblas_stsmqr(coreblas_enum_t side, coreblas_enum_t trans,
+                int m1, int n1, int m2, int n2, int k, int ib,
+                      float *A1,   int lda1,
+                      float *A2,   int lda2,
+                const float *V,    int ldv,
+                const float *T,    int ldt,
+                      float *work, int ldwork);
+size_t coreblas_stsmqr_lwork(coreblas_enum_t side, int m1, int n1, int ib);
+
+int coreblas_stsmqr_sytra1(coreblas_enum_t side, coreblas_enum_t trans,
+                int m1, int n1, int m2, int n2, int k, int ib,
+                      float *A1,   int lda1,
+                      float *A2,   int lda2,
+                const float *V,    int ldv,
+                const float *T,    int ldt,
+                      float *work, int ldwork);
+
+int coreblas_stsmqr_corner(int m1, int n1, int m2, int n2, int m3, int n3,
+                int k, int ib,
+                      float *A1,   int lda1,
+                      float *A2,   int lda2,
+                      float *A3,   int lda3,
+                const float *V,    int ldv,
+                const float *T,    int ldt,
+                      float *work);
+size_t coreblas_stsmqr_corner_lwork(int m1, int m2, int ib);
+
+int coreblas_stsmqr_batched(coreblas_enum_t side, coreblas_enum_t trans,
+                int m1, int n1, int m2, int n2, int k, int ib,
+                float * const *A1, int lda1,
+                float * const *A2, int lda2,
+                const float * const *V, int ldv,
+                const float * const *T, int ldt,
+                coreblas_workspace_t *work, int batch);
+
+int coreblas_stsmqr_batched_strided(coreblas_enum_t side,
+                coreblas_enum_t trans,
+                int m1, int n1, int m2, int n2, int k, int ib,
+                float *A1, int lda1, size_t strideA1,
+                float *A2, int lda2, size_t strideA2,
+                const float *V, int ldv, size_t strideV,
+                const float *T, int ldt, size_t strideT,
+                coreblas_workspace_t *work, int batch);
+
+int coreblas_stsmqr_row(coreblas_enum_t side, coreblas_enum_t trans,
+                int m1, int n1, int m2, int n2, int k, int ib,
+                float * const *A1, int lda1,
+                float * const *A2, int lda2,
+                const float *V, int ldv,
+                const float *T, int ldt,
+                coreblas_workspace_t *work, int ntile);
+
+int coreblas_stsmrq(coreblas_enum_t side, coreblas_enum_t trans,
+                int m1, int n1, int m2, int n2, int k, int ib,
+                      float *A1,   int lda1,
+                      float *A2,   int lda2,
+                const float *V,    int ldv,
+                const float *T,    int ldt,
+                      float *work, int ldwork);
+size_t coreblas_stsmrq_lwork(coreblas_enum_t side, int m1, int n1, int ib);
+
+int coreblas_stsqrt(int m, int n, int ib,
+                float *A1, int lda1,
+                float *A2, int lda2,
+                float *T,  int ldt,
+                float *tau,
+                float *work);
+size_t coreblas_stsqrt_lwork(int m, int n, int ib);
+
+int coreblas_stsqrt_rec(int m, int n, int ib,
+                float *A1, int lda1,
+                float *A2, int lda2,
+                float *T,  int ldt,
+                float *tau,
+                float *work);
+size_t coreblas_stsqrt_rec_lwork(int m, int n, int ib);
+
+int coreblas_stsqlt(int m, int n, int ib,
+                float *A1, int lda1,
+                float *A2, int lda2,
+                float *T,  int ldt,
+                float *tau,
+                float *work);
+size_t coreblas_stsqlt_lwork(int m, int n, int ib);
+
+int coreblas_stsrqt(int m, int n, int ib,
+                float *A1, int lda1,
+                float *A2, int lda2,
+                float *T,  int ldt,
+                float *tau,
+                float *work);
+size_t coreblas_stsrqt_lwork(int m, int n, int ib);
+
+int coreblas_sttlqt(int m, int n, int ib,
+                float *A1, int lda1,
+                float *A2, int lda2,
+                float *T,  int ldt,
+                float *tau,
+                float *work);
+size_t coreblas_sttlqt_lwork(int m, int n, int ib);
+
+int coreblas_sttmlq(coreblas_enum_t side, coreblas_enum_t trans,
+                int m1, int n1, int m2, int n2, int k, int ib,
+                      float *A1,   int lda1,
+                      float *A2,   int lda2,
+                const float *V,    int ldv,
+                const float *T,    int ldt,
+                      float *work, int ldwork);
+size_t coreblas_sttmlq_lwork(coreblas_enum_t side, int m1, int n1, int ib);
+
+int coreblas_sttmqr(coreblas_enum_t side, coreblas_enum_t trans,
+                int m1, int n1, int m2, int n2, int k, int ib,
+                      float *A1,   int lda1,
+                      float *A2,   int lda2,
+                const float *V,    int ldv,
+                const float *T,    int ldt,
+                      float *work, int ldwork);
+size_t coreblas_sttmqr_lwork(coreblas_enum_t side, int m1, int n1, int ib);
+
+int coreblas_sttqrt(int m, int n, int ib,
+                float *A1, int lda1,
+                float *A2, int lda2,
+                float *T,  int ldt,
+                float *tau,
+                float *work);
+size_t coreblas_sttqrt_lwork(int m, int n, int ib);
+
+int coreblas_sttqrt_rec(int m, int n, int ib,
+                float *A1, int lda1,
+                float *A2, int lda2,
+                float *T,  int ldt,
+                float *tau,
+                float *work);
+size_t coreblas_sttqrt_rec_lwork(int m, int n, int ib);
+
+int coreblas_sormlq(coreblas_enum_t side, coreblas_enum_t trans,
+                int m, int n, int k, int ib,
+                const float *A,    int lda,
+                const float *T,    int ldt,
+                      float *C,    int ldc,
+                      float *work, int ldwork);
+size_t coreblas_sormlq_lwork(coreblas_enum_t side, int m, int n, int ib);
+
+int coreblas_sormqr(coreblas_enum_t side, coreblas_enum_t trans,
+                int m, int n, int k, int ib,
+                const float *A,    int lda,
+                const float *T,    int ldt,
+                      float *C,    int ldc,
+                      float *work, int ldwork);
+size_t coreblas_sormqr_lwork(coreblas_enum_t side, int m, int n, int ib);
+
+#undef REAL
+
+#ifdef __cplusplus
+}  // extern "C"
+#endif
+
+#endif // COREBLAS_CORE_BLAS_S_H
@@ -11,6 +11,7 @@
 #define COREBLAS_TYPES_H
 
 #include <complex.h>
+#include <stdint.h>
 
 /*
  * RELEASE is a, b, c
@@ -159,6 +160,11 @@ typedef int coreblas_enum_t;
 typedef float  _Complex coreblas_complex32_t;
 typedef double _Complex coreblas_complex64_t;
 
+// Half precision numbers are stored as their bits: IEEE binary16 for
+// coreblas_half_t, the upper 16 bits of a float for coreblas_bfloat16_t.
+typedef uint16_t coreblas_half_t;
+typedef uint16_t coreblas_bfloat16_t;
+
 /******************************************************************************/
 coreblas_enum_t coreblas_eigt_const(char lapack_char);
 coreblas_enum_t coreblas_job_const(char lapack_char);
@@ -19,6 +19,23 @@
 extern "C" {
 #endif
 
+/***************************************************************************//**
+ *  Kernels whose workspace size can be queried with
+ *  coreblas_workspace_lwork().
+ **/
+enum {
+    CoreBlasWorkGeqrt    = 601, ///< geqrt, gelqt, tsqrt, tslqt, ttqrt, ttlqt
+    CoreBlasWorkTsmqr    = 602, ///< tsmqr, tsmlq, ttmqr, ttmlq, unmqr, unmlq
+    CoreBlasWorkParfb    = 603, ///< parfb, pamm
+    CoreBlasWorkPemv     = 604, ///< pemv
+    CoreBlasWorkGbtypecb = 605, ///< gbtype1cb, gbtype2cb, gbtype3cb
+    CoreBlasWorkHerfb    = 606  ///< herfb, tsmqr_corner
+};
+
+/***************************************************************************//**
+ *  Per-thread workspace. spaces[i] belongs to the i-th OpenMP thread;
+ *  each space is page aligned and first touched by its owning thread.
+ **/
 typedef struct {
     void **spaces;      ///< array of nthread pointers to workspaces
     size_t lworkspace;  ///< length in elements of workspace on each core
@@ -32,6 +49,8 @@ int coreblas_workspace_create(coreblas_workspace_t *workspace, size_t lworkspace
 
 int coreblas_workspace_destroy(coreblas_workspace_t *workspace);
 
+size_t coreblas_workspace_lwork(coreblas_enum_t kernel, int nb, int ib);
+
 #ifdef __cplusplus
 }  // extern "C"
 #endif
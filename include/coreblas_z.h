@@ -26,12 +26,21 @@ extern "C" {
 double coreblas_dcabs1(coreblas_complex64_t alpha);
 #endif
 
+int coreblas_izamax(int m, const coreblas_complex64_t *x, double *value);
+void coreblas_izamax_tile(int m, int n,
+                const coreblas_complex64_t *A, int lda,
+                int *imax, int *jmax, double *value);
+void coreblas_kernel_dzamax(int colrow, int m, int n,
+                const coreblas_complex64_t *A, int lda,
+                double *values);
+
 void coreblas_zgbtype1cb(coreblas_enum_t uplo, int n, int nb,
                       coreblas_complex64_t *A, int lda,
                       coreblas_complex64_t *VQ, coreblas_complex64_t *TAUQ,
                       coreblas_complex64_t *VP, coreblas_complex64_t *TAUP,
                       int st, int ed, int sweep, int Vblksiz, int WANTZ,
                       coreblas_complex64_t *work);
+size_t coreblas_zgbtype1cb_lwork(int nb);
     
 void coreblas_zgbtype2cb(coreblas_enum_t uplo, int n, int nb,
                       coreblas_complex64_t *A, int lda,
@@ -39,6 +48,7 @@ void coreblas_zgbtype2cb(coreblas_enum_t uplo, int n, int nb,
                       coreblas_complex64_t *VP, coreblas_complex64_t *TAUP,
                       int st, int ed, int sweep, int Vblksiz, int WANTZ,
                       coreblas_complex64_t *work);
+size_t coreblas_zgbtype2cb_lwork(int nb);
     
 void coreblas_zgbtype3cb(coreblas_enum_t uplo, int n, int nb,
                       coreblas_complex64_t *A, int lda,
@@ -46,6 +56,14 @@ void coreblas_zgbtype3cb(coreblas_enum_t uplo, int n, int nb,
                       coreblas_complex64_t *VP, coreblas_complex64_t *TAUP,
                       int st, int ed, int sweep, int Vblksiz, int WANTZ,
                       coreblas_complex64_t *work);
+size_t coreblas_zgbtype3cb_lwork(int nb);
+
+int coreblas_zgbbrd_static(coreblas_enum_t uplo, int n, int nb, int Vblksiz,
+                coreblas_complex64_t *A, int lda,
+                coreblas_complex64_t *VQ, coreblas_complex64_t *TAUQ,
+                coreblas_complex64_t *VP, coreblas_complex64_t *TAUP,
+                int wantz, coreblas_workspace_t *work, int *iwork);
+size_t coreblas_zgbbrd_static_liwork(int n, int nb);
     
 int coreblas_zgeadd(coreblas_enum_t transa,
                 int m, int n,
@@ -57,6 +75,7 @@ int coreblas_zgelqt(int m, int n, int ib,
                 coreblas_complex64_t *T, int ldt,
                 coreblas_complex64_t *tau,
                 coreblas_complex64_t *work);
+size_t coreblas_zgelqt_lwork(int m, int n, int ib);
 
 void coreblas_zgemm(coreblas_enum_t transa, coreblas_enum_t transb,
                 int m, int n, int k,
@@ -64,19 +83,59 @@ void coreblas_zgemm(coreblas_enum_t transa, coreblas_enum_t transb,
                                           const coreblas_complex64_t *B, int ldb,
                 coreblas_complex64_t beta,        coreblas_complex64_t *C, int ldc);
 
+int coreblas_zgemm_batched(coreblas_enum_t transa, coreblas_enum_t transb,
+                int m, int n, int k,
+                coreblas_complex64_t alpha,
+                const coreblas_complex64_t * const *A, int lda,
+                const coreblas_complex64_t * const *B, int ldb,
+                coreblas_complex64_t beta,
+                coreblas_complex64_t * const *C, int ldc,
+                int batch);
+
+int coreblas_zgemm_batched_strided(coreblas_enum_t transa,
+                coreblas_enum_t transb,
+                int m, int n, int k,
+                coreblas_complex64_t alpha,
+                const coreblas_complex64_t *A, int lda, size_t strideA,
+                const coreblas_complex64_t *B, int ldb, size_t strideB,
+                coreblas_complex64_t beta,
+                coreblas_complex64_t *C, int ldc, size_t strideC,
+                int batch);
+
 int coreblas_zgeqrt(int m, int n, int ib,
                 coreblas_complex64_t *A, int lda,
                 coreblas_complex64_t *T, int ldt,
                 coreblas_complex64_t *tau,
                 coreblas_complex64_t *work);
+size_t coreblas_zgeqrt_lwork(int m, int n, int ib);
+
+int coreblas_zgeqrt_batched(int m, int n, int ib,
+                coreblas_complex64_t * const *A, int lda,
+                coreblas_complex64_t * const *T, int ldt,
+                coreblas_workspace_t *work, int batch);
+
+int coreblas_zgeqrt_batched_strided(int m, int n, int ib,
+                coreblas_complex64_t *A, int lda, size_t strideA,
+                coreblas_complex64_t *T, int ldt, size_t strideT,
+                coreblas_workspace_t *work, int batch);
+size_t coreblas_zgeqrt_batched_lwork(int m, int n, int ib);
 
 void coreblas_zgessq(int m, int n,
                  const coreblas_complex64_t *A, int lda,
                  double *scale, double *sumsq);
+void coreblas_zgessq_aux(int n,
+                const double *scale, const double *sumsq,
+                double *value);
+
+void coreblas_zgetrf(coreblas_desc_t A, int *ipiv, int ib, int rank, int size,
+                 volatile int *max_idx, volatile coreblas_complex64_t *max_val,
+                 volatile int *info, coreblas_barrier_t *barrier);
 
-//void coreblas_zgetrf(coreblas_desc_t A, int *ipiv, int ib, int rank, int size,
-//                 volatile int *max_idx, volatile coreblas_complex64_t *max_val,
-//                 volatile int *info);
+void coreblas_zgetrf_calu(coreblas_desc_t A, int *ipiv, int rank, int size,
+                coreblas_complex64_t *work, int *iwork,
+                volatile int *info, coreblas_barrier_t *barrier);
+size_t coreblas_zgetrf_calu_lwork(coreblas_desc_t A, int size);
+size_t coreblas_zgetrf_calu_liwork(coreblas_desc_t A, int size);
 
 int coreblas_zhegst(int itype, coreblas_enum_t uplo,
                 int n,
@@ -95,6 +154,13 @@ void coreblas_zher2k(coreblas_enum_t uplo, coreblas_enum_t trans,
                                            const coreblas_complex64_t *B, int ldb,
                  double beta,                    coreblas_complex64_t *C, int ldc);
 
+int coreblas_zherfb(coreblas_enum_t uplo, int n, int k, int ib,
+                const coreblas_complex64_t *A,    int lda,
+                const coreblas_complex64_t *T,    int ldt,
+                      coreblas_complex64_t *C,    int ldc,
+                      coreblas_complex64_t *work);
+size_t coreblas_zherfb_lwork(int n, int ib);
+
 void coreblas_zherk(coreblas_enum_t uplo, coreblas_enum_t trans,
                 int n, int k,
                 double alpha, const coreblas_complex64_t *A, int lda,
@@ -109,6 +175,9 @@ void coreblas_zsyssq(coreblas_enum_t uplo,
                  int n,
                  const coreblas_complex64_t *A, int lda,
                  double *scale, double *sumsq);
+void coreblas_zsyssq_aux(int m, int n,
+                const double *scale, const double *sumsq,
+                double *value);
 
 void coreblas_zlacpy(coreblas_enum_t uplo, coreblas_enum_t transa,
                  int m, int n,
@@ -131,21 +200,41 @@ void coreblas_zlange(coreblas_enum_t norm,
                  int m, int n,
                  const coreblas_complex64_t *A, int lda,
                  double *work, double *result);
+size_t coreblas_zlange_lwork(coreblas_enum_t norm, int m, int n);
+void coreblas_zlange_aux(coreblas_enum_t norm, int m, int n,
+                const coreblas_complex64_t *A, int lda,
+                double *value);
 
 void coreblas_zlanhe(coreblas_enum_t norm, coreblas_enum_t uplo,
                  int n,
                  const coreblas_complex64_t *A, int lda,
                  double *work, double *value);
+size_t coreblas_zlanhe_lwork(coreblas_enum_t norm, int n);
+void coreblas_zlanhe_aux(coreblas_enum_t norm, coreblas_enum_t uplo,
+                int n,
+                const coreblas_complex64_t *A, int lda,
+                double *value);
 
 void coreblas_zlansy(coreblas_enum_t norm, coreblas_enum_t uplo,
                  int n,
                  const coreblas_complex64_t *A, int lda,
                  double *work, double *value);
+size_t coreblas_zlansy_lwork(coreblas_enum_t norm, int n);
+void coreblas_zlansy_aux(coreblas_enum_t norm, coreblas_enum_t uplo,
+                int n,
+                const coreblas_complex64_t *A, int lda,
+                double *value);
 
 void coreblas_zlantr(coreblas_enum_t norm, coreblas_enum_t uplo, coreblas_enum_t diag,
                  int m, int n,
                  const coreblas_complex64_t *A, int lda,
                  double *work, double *value);
+size_t coreblas_zlantr_lwork(coreblas_enum_t norm, int m, int n);
+void coreblas_zlantr_aux(coreblas_enum_t norm, coreblas_enum_t uplo,
+                coreblas_enum_t diag,
+                int m, int n,
+                const coreblas_complex64_t *A, int lda,
+                double *value);
 
 int coreblas_zlarfb_gemm(coreblas_enum_t side, coreblas_enum_t trans, int direct, int storev,
                      int M, int N, int K,
@@ -153,6 +242,17 @@ int coreblas_zlarfb_gemm(coreblas_enum_t side, coreblas_enum_t trans, int direct
                      const coreblas_complex64_t *T, int LDT,
                      coreblas_complex64_t *C, int LDC,
                      coreblas_complex64_t *WORK, int LDWORK);
+size_t coreblas_zlarfb_gemm_lwork(coreblas_enum_t side, int M, int N, int K);
+
+int coreblas_zlarft(coreblas_enum_t storev, int n, int k,
+                    const coreblas_complex64_t *V, int ldv,
+                    const coreblas_complex64_t *tau,
+                          coreblas_complex64_t *T, int ldt);
+
+int coreblas_zlarft_pent(coreblas_enum_t storev, int m, int k, int l,
+                         const coreblas_complex64_t *V, int ldv,
+                         const coreblas_complex64_t *tau,
+                               coreblas_complex64_t *T, int ldt);
 
 void coreblas_zlascl(coreblas_enum_t uplo,
                  double cfrom, double cto,
@@ -163,19 +263,35 @@ void coreblas_zlaset(coreblas_enum_t uplo,
                  int m, int n,
                  coreblas_complex64_t alpha, coreblas_complex64_t beta,
                  coreblas_complex64_t *A, int lda);
-/*
+
 void coreblas_zgeswp(coreblas_enum_t colrow,
                  coreblas_desc_t A, int k1, int k2, const int *ipiv, int incx);
 
+void coreblas_zgeswp_blocked(coreblas_enum_t colrow, coreblas_desc_t A,
+                int k1, int k2, const int *ipiv, int incx,
+                int rank, int size,
+                coreblas_complex64_t *work, int *iwork);
+size_t coreblas_zgeswp_blocked_lwork(coreblas_desc_t A, int k1, int k2);
+size_t coreblas_zgeswp_blocked_liwork(int k1, int k2);
+
 void coreblas_zheswp(int rank, int num_threads,
                  int uplo, coreblas_desc_t A, int k1, int k2, const int *ipiv,
-                 int incx);
-*/
+                 int incx, coreblas_barrier_t *barrier);
+
 int coreblas_zlauum(coreblas_enum_t uplo,
                 int n,
                 coreblas_complex64_t *A, int lda);
 
-int coreblas_zpamm(coreblas_enum_t op, coreblas_enum_t side, coreblas_enum_t storev,
+int coreblas_zpamm(coreblas_enum_t op, coreblas_enum_t side,
+               coreblas_enum_t storev,
+               int m, int n, int k, int l,
+               const coreblas_complex64_t *A1, int lda1,
+                     coreblas_complex64_t *A2, int lda2,
+               const coreblas_complex64_t *V,  int ldv,
+                     coreblas_complex64_t *W,  int ldw);
+
+int coreblas_zpamm_direct(coreblas_enum_t op, coreblas_enum_t side,
+               coreblas_enum_t direct, coreblas_enum_t storev,
                int m, int n, int k, int l,
                const coreblas_complex64_t *A1, int lda1,
                      coreblas_complex64_t *A2, int lda2,
@@ -190,6 +306,7 @@ int coreblas_zparfb(coreblas_enum_t side, coreblas_enum_t trans, coreblas_enum_t
                 const coreblas_complex64_t *V,    int ldv,
                 const coreblas_complex64_t *T,    int ldt,
                       coreblas_complex64_t *work, int ldwork);
+size_t coreblas_zparfb_lwork(coreblas_enum_t side, int m1, int n1, int k);
 
 int coreblas_zpemv(coreblas_enum_t trans, int storev,
                int m, int n, int l,
@@ -199,11 +316,17 @@ int coreblas_zpemv(coreblas_enum_t trans, int storev,
                coreblas_complex64_t beta,
                coreblas_complex64_t *Y, int incy,
                coreblas_complex64_t *work);
+size_t coreblas_zpemv_lwork(int m, int n, int l);
 
 int coreblas_zpotrf(coreblas_enum_t uplo,
                 int n,
                 coreblas_complex64_t *A, int lda);
 
+void coreblas_zreduce_ssq(int n, const double *scale, const double *sumsq,
+                double *scl, double *sum);
+void coreblas_zreduce_norm(coreblas_enum_t norm, int m, int n,
+                const double *W, int ldw, double *value);
+
 void coreblas_zsymm(coreblas_enum_t side, coreblas_enum_t uplo,
                 int m, int n,
                 coreblas_complex64_t alpha, const coreblas_complex64_t *A, int lda,
@@ -254,6 +377,7 @@ int coreblas_ztslqt(int m, int n, int ib,
                 coreblas_complex64_t *T,  int ldt,
                 coreblas_complex64_t *tau,
                 coreblas_complex64_t *work);
+size_t coreblas_ztslqt_lwork(int m, int n, int ib);
 
 int coreblas_ztsmlq(coreblas_enum_t side, coreblas_enum_t trans,
                 int m1, int n1, int m2, int n2, int k, int ib,
@@ -262,6 +386,16 @@ int coreblas_ztsmlq(coreblas_enum_t side, coreblas_enum_t trans,
                 const coreblas_complex64_t *V,    int ldv,
                 const coreblas_complex64_t *T,    int ldt,
                       coreblas_complex64_t *work, int ldwork);
+size_t coreblas_ztsmlq_lwork(coreblas_enum_t side, int m1, int n1, int ib);
+
+int coreblas_ztsmql(coreblas_enum_t side, coreblas_enum_t trans,
+                int m1, int n1, int m2, int n2, int k, int ib,
+                      coreblas_complex64_t *A1,   int lda1,
+                      coreblas_complex64_t *A2,   int lda2,
+                const coreblas_complex64_t *V,    int ldv,
+                const coreblas_complex64_t *T,    int ldt,
+                      coreblas_complex64_t *work, int ldwork);
+size_t coreblas_ztsmql_lwork(coreblas_enum_t side, int m1, int n1, int ib);
 
 int coreblas_ztsmqr(coreblas_enum_t side, coreblas_enum_t trans,
                 int m1, int n1, int m2, int n2, int k, int ib,
@@ -270,6 +404,59 @@ int coreblas_ztsmqr(coreblas_enum_t side, coreblas_enum_t trans,
                 const coreblas_complex64_t *V,    int ldv,
                 const coreblas_complex64_t *T,    int ldt,
                       coreblas_complex64_t *work, int ldwork);
+size_t coreblas_ztsmqr_lwork(coreblas_enum_t side, int m1, int n1, int ib);
+
+int coreblas_ztsmqr_hetra1(coreblas_enum_t side, coreblas_enum_t trans,
+                int m1, int n1, int m2, int n2, int k, int ib,
+                      coreblas_complex64_t *A1,   int lda1,
+                      coreblas_complex64_t *A2,   int lda2,
+                const coreblas_complex64_t *V,    int ldv,
+                const coreblas_complex64_t *T,    int ldt,
+                      coreblas_complex64_t *work, int ldwork);
+
+int coreblas_ztsmqr_corner(int m1, int n1, int m2, int n2, int m3, int n3,
+                int k, int ib,
+                      coreblas_complex64_t *A1,   int lda1,
+                      coreblas_complex64_t *A2,   int lda2,
+                      coreblas_complex64_t *A3,   int lda3,
+                const coreblas_complex64_t *V,    int ldv,
+                const coreblas_complex64_t *T,    int ldt,
+                      coreblas_complex64_t *work);
+size_t coreblas_ztsmqr_corner_lwork(int m1, int m2, int ib);
+
+int coreblas_ztsmqr_batched(coreblas_enum_t side, coreblas_enum_t trans,
+                int m1, int n1, int m2, int n2, int k, int ib,
+                coreblas_complex64_t * const *A1, int lda1,
+                coreblas_complex64_t * const *A2, int lda2,
+                const coreblas_complex64_t * const *V, int ldv,
+                const coreblas_complex64_t * const *T, int ldt,
+                coreblas_workspace_t *work, int batch);
+
+int coreblas_ztsmqr_batched_strided(coreblas_enum_t side,
+                coreblas_enum_t trans,
+                int m1, int n1, int m2, int n2, int k, int ib,
+                coreblas_complex64_t *A1, int lda1, size_t strideA1,
+                coreblas_complex64_t *A2, int lda2, size_t strideA2,
+                const coreblas_complex64_t *V, int ldv, size_t strideV,
+                const coreblas_complex64_t *T, int ldt, size_t strideT,
+                coreblas_workspace_t *work, int batch);
+
+int coreblas_ztsmqr_row(coreblas_enum_t side, coreblas_enum_t trans,
+                int m1, int n1, int m2, int n2, int k, int ib,
+                coreblas_complex64_t * const *A1, int lda1,
+                coreblas_complex64_t * const *A2, int lda2,
+                const coreblas_complex64_t *V, int ldv,
+                const coreblas_complex64_t *T, int ldt,
+                coreblas_workspace_t *work, int ntile);
+
+int coreblas_ztsmrq(coreblas_enum_t side, coreblas_enum_t trans,
+                int m1, int n1, int m2, int n2, int k, int ib,
+                      coreblas_complex64_t *A1,   int lda1,
+                      coreblas_complex64_t *A2,   int lda2,
+                const coreblas_complex64_t *V,    int ldv,
+                const coreblas_complex64_t *T,    int ldt,
+                      coreblas_complex64_t *work, int ldwork);
+size_t coreblas_ztsmrq_lwork(coreblas_enum_t side, int m1, int n1, int ib);
 
 int coreblas_ztsqrt(int m, int n, int ib,
                 coreblas_complex64_t *A1, int lda1,
@@ -277,6 +464,31 @@ int coreblas_ztsqrt(int m, int n, int ib,
                 coreblas_complex64_t *T,  int ldt,
                 coreblas_complex64_t *tau,
                 coreblas_complex64_t *work);
+size_t coreblas_ztsqrt_lwork(int m, int n, int ib);
+
+int coreblas_ztsqrt_rec(int m, int n, int ib,
+                coreblas_complex64_t *A1, int lda1,
+                coreblas_complex64_t *A2, int lda2,
+                coreblas_complex64_t *T,  int ldt,
+                coreblas_complex64_t *tau,
+                coreblas_complex64_t *work);
+size_t coreblas_ztsqrt_rec_lwork(int m, int n, int ib);
+
+int coreblas_ztsqlt(int m, int n, int ib,
+                coreblas_complex64_t *A1, int lda1,
+                coreblas_complex64_t *A2, int lda2,
+                coreblas_complex64_t *T,  int ldt,
+                coreblas_complex64_t *tau,
+                coreblas_complex64_t *work);
+size_t coreblas_ztsqlt_lwork(int m, int n, int ib);
+
+int coreblas_ztsrqt(int m, int n, int ib,
+                coreblas_complex64_t *A1, int lda1,
+                coreblas_complex64_t *A2, int lda2,
+                coreblas_complex64_t *T,  int ldt,
+                coreblas_complex64_t *tau,
+                coreblas_complex64_t *work);
+size_t coreblas_ztsrqt_lwork(int m, int n, int ib);
 
 int coreblas_zttlqt(int m, int n, int ib,
                 coreblas_complex64_t *A1, int lda1,
@@ -284,6 +496,7 @@ int coreblas_zttlqt(int m, int n, int ib,
                 coreblas_complex64_t *T,  int ldt,
                 coreblas_complex64_t *tau,
                 coreblas_complex64_t *work);
+size_t coreblas_zttlqt_lwork(int m, int n, int ib);
 
 int coreblas_zttmlq(coreblas_enum_t side, coreblas_enum_t trans,
                 int m1, int n1, int m2, int n2, int k, int ib,
@@ -292,6 +505,7 @@ int coreblas_zttmlq(coreblas_enum_t side, coreblas_enum_t trans,
                 const coreblas_complex64_t *V,    int ldv,
                 const coreblas_complex64_t *T,    int ldt,
                       coreblas_complex64_t *work, int ldwork);
+size_t coreblas_zttmlq_lwork(coreblas_enum_t side, int m1, int n1, int ib);
 
 int coreblas_zttmqr(coreblas_enum_t side, coreblas_enum_t trans,
                 int m1, int n1, int m2, int n2, int k, int ib,
@@ -300,6 +514,7 @@ int coreblas_zttmqr(coreblas_enum_t side, coreblas_enum_t trans,
                 const coreblas_complex64_t *V,    int ldv,
                 const coreblas_complex64_t *T,    int ldt,
                       coreblas_complex64_t *work, int ldwork);
+size_t coreblas_zttmqr_lwork(coreblas_enum_t side, int m1, int n1, int ib);
 
 int coreblas_zttqrt(int m, int n, int ib,
                 coreblas_complex64_t *A1, int lda1,
@@ -307,6 +522,15 @@ int coreblas_zttqrt(int m, int n, int ib,
                 coreblas_complex64_t *T,  int ldt,
                 coreblas_complex64_t *tau,
                 coreblas_complex64_t *work);
+size_t coreblas_zttqrt_lwork(int m, int n, int ib);
+
+int coreblas_zttqrt_rec(int m, int n, int ib,
+                coreblas_complex64_t *A1, int lda1,
+                coreblas_complex64_t *A2, int lda2,
+                coreblas_complex64_t *T,  int ldt,
+                coreblas_complex64_t *tau,
+                coreblas_complex64_t *work);
+size_t coreblas_zttqrt_rec_lwork(int m, int n, int ib);
 
 int coreblas_zunmlq(coreblas_enum_t side, coreblas_enum_t trans,
                 int m, int n, int k, int ib,
@@ -314,6 +538,7 @@ int coreblas_zunmlq(coreblas_enum_t side, coreblas_enum_t trans,
                 const coreblas_complex64_t *T,    int ldt,
                       coreblas_complex64_t *C,    int ldc,
                       coreblas_complex64_t *work, int ldwork);
+size_t coreblas_zunmlq_lwork(coreblas_enum_t side, int m, int n, int ib);
 
 int coreblas_zunmqr(coreblas_enum_t side, coreblas_enum_t trans,
                 int m, int n, int k, int ib,
@@ -321,6 +546,7 @@ int coreblas_zunmqr(coreblas_enum_t side, coreblas_enum_t trans,
                 const coreblas_complex64_t *T,    int ldt,
                       coreblas_complex64_t *C,    int ldc,
                       coreblas_complex64_t *work, int ldwork);
+size_t coreblas_zunmqr_lwork(coreblas_enum_t side, int m, int n, int ib);
 
 #undef COMPLEX
 
@@ -20,6 +20,15 @@ extern "C" {
 #endif
 
 /******************************************************************************/
+int coreblas_zcgemm(coreblas_enum_t transa, coreblas_enum_t transb,
+                int m, int n, int k,
+                coreblas_complex64_t alpha, const coreblas_complex32_t *As, int ldas,
+                                          const coreblas_complex64_t *B,  int ldb,
+                coreblas_complex64_t beta,        coreblas_complex64_t *C,  int ldc,
+                coreblas_complex64_t *work);
+
+size_t coreblas_zcgemm_lwork(int m, int k);
+
 int coreblas_zlag2c(int m, int n,
                  coreblas_complex64_t *A,  int lda,
                  coreblas_complex32_t *As, int ldas);
@@ -74,6 +74,7 @@ blas_mixed = [
     ('dsposv',               'zcposv'              ),
     ('dsgesv',               'zcgesv'              ),
     ('dsgbsv',               'zcgbsv'              ),
+    ('dsgemm',               'zcgemm'              ),
 
     # ----- regular routines
     ('daxpy',                'zaxpy'               ),
@@ -348,10 +349,14 @@ lapack = [
     ('strsmpl',              'dtrsmpl',              'ctrsmpl',              'ztrsmpl'             ),
     ('strssq',               'dtrssq',               'ctrssq',               'ztrssq'              ),
     ('strtri',               'dtrtri',               'ctrtri',               'ztrtri'              ),
+    ('stsmql',               'dtsmql',               'ctsmql',               'ztsmql'              ),
     ('stsmqr',               'dtsmqr',               'ctsmqr',               'ztsmqr'              ),
     ('stsmlq',               'dtsmlq',               'ctsmlq',               'ztsmlq'              ),
     ('stsqrt',               'dtsqrt',               'ctsqrt',               'ztsqrt'              ),
+    ('stsqlt',               'dtsqlt',               'ctsqlt',               'ztsqlt'              ),
+    ('stsmrq',               'dtsmrq',               'ctsmrq',               'ztsmrq'              ),
     ('stslqt',               'dtslqt',               'ctslqt',               'ztslqt'              ),
+    ('stsrqt',               'dtsrqt',               'ctsrqt',               'ztsrqt'              ),
     ('ststrf',               'dtstrf',               'ctstrf',               'ztstrf'              ),
     ('sttmqr',               'dttmqr',               'cttmqr',               'zttmqr'              ),
     ('sttmlq',               'dttmlq',               'cttmlq',               'zttmlq'              ),
@@ -435,6 +440,7 @@ subs = {
     #('LAPACKE_s',            'LAPACKE_c',          ),
     #('coreblas_d',             'coreblas_z'            ),
     #('coreblas_s',             'coreblas_c'            ),
+    ('bench_ds',             'bench_zc'            ),
 
     # ----- Fortran examples
     ('real\(',               'complex\(',          ),
@@ -510,10 +516,14 @@ subs = {
 
     # ----- COREBLAS / MAGMA functions, alphabetic order
     ('sy2sb',                'sy2sb',                'he2hb',                'he2hb'               ),
+    ('sytra1',               'sytra1',               'hetra1',               'hetra1'              ),
 
+    ('sabsum',               'dabsum',               'cabsum',               'zabsum'              ),
     ('sgbtype1cb',           'dgbtype1cb',           'cgbtype1cb',           'zgbtype1cb'          ),
     ('sgbtype2cb',           'dgbtype2cb',           'cgbtype2cb',           'zgbtype2cb'          ),
     ('sgbtype3cb',           'dgbtype3cb',           'cgbtype3cb',           'zgbtype3cb'          ),
+    ('sreduce',              'dreduce',              'creduce',              'zreduce'             ),
+    ('sssq',                 'dssq',                 'cssq',                 'zssq'                ),
 
     ('psdesc2ge',            'pddesc2ge',            'pcdesc2ge',            'pzdesc2ge'           ),
     ('psge2desc',            'pdge2desc',            'pcge2desc',            'pzge2desc'           ),
@@ -548,6 +558,7 @@ subs = {
     #('coreblas_s',             'coreblas_d',             'coreblas_c',             'coreblas_z'            ),
     #('TEST_S',               'TEST_D',               'TEST_C',               'TEST_Z'              ),
     #('test_s',               'test_d',               'test_c',               'test_z'              ),
+    ('bench_s',              'bench_d',              'bench_c',              'bench_z'             ),
 
     # ----- Fortran examples
     ('wp = sp',              'wp = dp',              'wp = sp',              'wp = dp'             ),